@@ -220,6 +220,11 @@ IPPAPI(IppStatus, ippsAES_EncryptCFB16_MB, (const Ipp8u* pSrc[], Ipp8u* pDst[],
                                             const Ipp8u* pIV[],
                                             IppStatus status[],
                                             int numBuffers))
+IPPAPI(IppStatus, ippsAES_CMAC_MB, (const Ipp8u* pSrc[], int len[],
+                                    Ipp8u* pMD[], int mdLen,
+                                    const IppsAES_CMACState* pCtx[],
+                                    IppStatus status[],
+                                    int numBuffers))
 
 /* SMS4 */
 IPPAPI(IppStatus, ippsSMS4GetSize,(int *pSize))
@@ -308,6 +313,14 @@ IPPAPI(IppStatus, ippsAES_CCMStart,(const Ipp8u* pIV, int ivLen, const Ipp8u* pA
 IPPAPI(IppStatus, ippsAES_CCMEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState))
 IPPAPI(IppStatus, ippsAES_CCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState))
 IPPAPI(IppStatus, ippsAES_CCMGetTag,(Ipp8u* pTag, int tagLen, const IppsAES_CCMState* pState))
+IPPAPI(IppStatus, ippsAES_CCMSeal,(const Ipp8u* pIV, int ivLen, const Ipp8u* pAD, int adLen,
+                                   const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                   Ipp8u* pTag, int tagLen,
+                                   const IppsAES_CCMState* pKey))
+IPPAPI(IppStatus, ippsAES_CCMOpen,(const Ipp8u* pIV, int ivLen, const Ipp8u* pAD, int adLen,
+                                   const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                   const Ipp8u* pTag, int tagLen, int* pIsValid,
+                                   const IppsAES_CCMState* pKey))
 
 /* AES-GCM */
 IPPAPI(IppStatus, ippsAES_GCMGetSize,(int * pSize))
@@ -324,7 +337,21 @@ IPPAPI(IppStatus, ippsAES_GCMStart,(const Ipp8u* pIV, int ivLen,
                                     IppsAES_GCMState* pState))
 IPPAPI(IppStatus, ippsAES_GCMEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_GCMState* pState))
 IPPAPI(IppStatus, ippsAES_GCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_GCMState* pState))
+IPPAPI(IppStatus, ippsAES_GCMEncryptV,(const IppsAES_GCMSegment* pAAD, int numAAD,
+                                       const IppsAES_GCMSegment* pTxt, int numTxt,
+                                       IppsAES_GCMState* pState))
+IPPAPI(IppStatus, ippsAES_GCMDecryptV,(const IppsAES_GCMSegment* pAAD, int numAAD,
+                                       const IppsAES_GCMSegment* pTxt, int numTxt,
+                                       IppsAES_GCMState* pState))
 IPPAPI(IppStatus, ippsAES_GCMGetTag,(Ipp8u* pDstTag, int tagLen, const IppsAES_GCMState* pState))
+IPPAPI(IppStatus, ippsAES_GCMSeal,(const Ipp8u* pIV, int ivLen, const Ipp8u* pAAD, int aadLen,
+                                   const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                   Ipp8u* pTag, int tagLen,
+                                   const IppsAES_GCMState* pKey))
+IPPAPI(IppStatus, ippsAES_GCMOpen,(const Ipp8u* pIV, int ivLen, const Ipp8u* pAAD, int aadLen,
+                                   const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                   const Ipp8u* pTag, int tagLen, int* pIsValid,
+                                   const IppsAES_GCMState* pKey))
 
 /* AES-XTS */
 IPPAPI(IppStatus, ippsAES_XTSGetSize,(int * pSize))
@@ -339,6 +366,12 @@ IPPAPI(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitSiz
                                       const IppsAES_XTSSpec* pCtx,
                                       const Ipp8u* pTweak,
                                       int startCipherBlkNo))
+IPPAPI(IppStatus, ippsAES_XTSEncryptDataUnits,(const Ipp8u* pSrc, Ipp8u* pDst, int numDUs,
+                                               Ipp64u startDUNo,
+                                               const IppsAES_XTSSpec* pCtx))
+IPPAPI(IppStatus, ippsAES_XTSDecryptDataUnits,(const Ipp8u* pSrc, Ipp8u* pDst, int numDUs,
+                                               Ipp64u startDUNo,
+                                               const IppsAES_XTSSpec* pCtx))
 
 /* AES-SIV (RFC 5297) */
 IPPAPI(IppStatus, ippsAES_S2V_CMAC,(const Ipp8u* pKey, int keyLen,
@@ -354,6 +387,19 @@ IPPAPI(IppStatus, ippsAES_SIVDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
                                       const Ipp8u* pAD[], const int pADlen[], int numAD,
                                       const Ipp8u* pSIV))
 
+/* AES-GCM-SIV (RFC 8452) */
+IPPAPI(IppStatus, ippsAES_GCM_SIVEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                                Ipp8u* pTag,
+                                          const Ipp8u* pKey, int keyLen,
+                                          const Ipp8u* pNonce, int nonceLen,
+                                          const Ipp8u* pAAD, int aadLen))
+IPPAPI(IppStatus, ippsAES_GCM_SIVDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                          int* pAuthPassed,
+                                          const Ipp8u* pKey, int keyLen,
+                                          const Ipp8u* pNonce, int nonceLen,
+                                          const Ipp8u* pAAD, int aadLen,
+                                          const Ipp8u* pTag))
+
 /* AES-CMAC */
 IPPAPI(IppStatus, ippsAES_CMACGetSize,(int* pSize))
 IPPAPI(IppStatus, ippsAES_CMACInit,(const Ipp8u* pKey, int keyLen, IppsAES_CMACState* pState, int ctxSize))
@@ -667,6 +713,14 @@ IPPAPI(IppStatus, ippsHashMessage_rmf,(const Ipp8u* pMsg, int len, Ipp8u* pMD, c
 IPPAPI(IppStatus, ippsHashMethodGetInfo,(IppsHashInfo* pInfo, const IppsHashMethod* pMethod))
 IPPAPI(IppStatus, ippsHashGetInfo_rmf,(IppsHashInfo* pInfo, const IppsHashState_rmf* pState))
 
+/* method based multi-buffer Hash Primitives */
+IPPAPI(IppStatus, ippsHashGetSize_MB_rmf,(int* pSize))
+IPPAPI(IppStatus, ippsHashInit_MB_rmf,(IppsHashState_MB_rmf* pState, const IppsHashMethod* pMethod, int numBuffers))
+IPPAPI(IppStatus, ippsHashUpdate_MB_rmf,(const Ipp8u* const pSrc[], const int len[], IppsHashState_MB_rmf* pState))
+IPPAPI(IppStatus, ippsHashFinal_MB_rmf,(Ipp8u* const pMD[], IppsHashState_MB_rmf* pState))
+IPPAPI(IppStatus, ippsHashMessage_MB_rmf,(const Ipp8u* const pMsg[], const int len[], Ipp8u* const pMD[],
+                                          int numBuffers, const IppsHashMethod* pMethod))
+
 /* general MGF Primitives*/
 IPP_DEPRECATED(OBSOLETE_API) \
 IPPAPI(IppStatus, ippsMGF,(const Ipp8u* pSeed, int seedLen, Ipp8u* pMask, int maskLen, IppHashAlgId hashAlg))
@@ -1322,6 +1376,9 @@ IPPAPI(IppStatus, ippsGFpIsUnityElement,(const IppsGFpElement* pA, int* pResult,
 IPPAPI(IppStatus, ippsGFpConj,(const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpNeg, (const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpInv, (const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
+IPPAPI(IppStatus, ippsGFpBatchInvBufferSize, (int nItems, const IppsGFpState* pGFp, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpBatchInv, (const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpBatchInv_CT, (const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpSqrt,(const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpSqr, (const IppsGFpElement* pA, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpAdd, (const IppsGFpElement* pA, const IppsGFpElement* pB,  IppsGFpElement* pR, IppsGFpState* pGFp))
@@ -1393,6 +1450,8 @@ IPPAPI(IppStatus, ippsGFpECSetPointHashBackCompatible,(Ipp32u hdr, const Ipp8u*
 IPPAPI(IppStatus, ippsGFpECSetPointHash_rmf,(Ipp32u hdr, const Ipp8u* pMsg, int msgLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, const IppsHashMethod* pMethod, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpECSetPointHashBackCompatible_rmf,(Ipp32u hdr, const Ipp8u* pMsg, int msgLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC, const IppsHashMethod* pMethod, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpECGetPoint,(const IppsGFpECPoint* pPoint, IppsGFpElement* pX, IppsGFpElement* pY, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECBatchGetPoint,(const IppsGFpECPoint* const ppPoint[], IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int nItems, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECBatchGetPoint_CT,(const IppsGFpECPoint* const ppPoint[], IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int nItems, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpECGetPointRegular,(const IppsGFpECPoint* pPoint, IppsBigNumState* pX, IppsBigNumState* pY, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECSetPointOctString,(const Ipp8u* pStr, int strLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECGetPointOctString,(const IppsGFpECPoint* pPoint, Ipp8u* pStr, int strLen, IppsGFpECState* pEC))
@@ -1404,6 +1463,8 @@ IPPAPI(IppStatus, ippsGFpECCmpPoint,(const IppsGFpECPoint* pP, const IppsGFpECPo
 IPPAPI(IppStatus, ippsGFpECNegPoint,(const IppsGFpECPoint* pP, IppsGFpECPoint* pR, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECAddPoint,(const IppsGFpECPoint* pP, const IppsGFpECPoint* pQ, IppsGFpECPoint* pR, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECMulPoint,(const IppsGFpECPoint* pP, const IppsBigNumState* pN, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECMultiScalarMulBufferSize,(int nItems, const IppsGFpECState* pEC, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpECMultiScalarMul,(const IppsGFpECPoint* const ppPoints[], const IppsBigNumState* const ppScalars[], int nItems, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 
 /* keys */
 IPPAPI(IppStatus, ippsGFpECPrivateKey,(IppsBigNumState* pPrivate, IppsGFpECState* pEC,
@@ -1438,6 +1499,14 @@ IPPAPI(IppStatus, ippsGFpECVerifyDSA, (const IppsBigNumState* pMsgDigest,
                                        const IppsBigNumState* pSignR, const IppsBigNumState* pSignS,
                                        IppECResult* pResult,
                                        IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECVerifyDSABatchBufferSize, (int nItems, const IppsGFpECState* pEC, int* pBufferSize))
+IPPAPI(IppStatus, ippsGFpECVerifyDSABatch, (const IppsBigNumState* const ppMsgDigest[],
+                                            const IppsGFpECPoint* const ppRegPublic[],
+                                            const IppsBigNumState* const ppSignR[], const IppsBigNumState* const ppSignS[],
+                                            const Ipp8u* pRecoveryId, int nItems,
+                                            IppECResult pResult[],
+                                            IppBitSupplier rndFunc, void* pRndParam,
+                                            IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 
 IPPAPI(IppStatus, ippsGFpECSignNR, (const IppsBigNumState* pMsgDigest,
                                     const IppsBigNumState* pRegPrivate,
@@ -1552,6 +1621,14 @@ IPPAPI(IppStatus, ippsXMSSVerify, (const Ipp8u* pMsg,
                                    int* pIsSignValid,
                                    const IppsXMSSPublicKeyState* pKey,
                                    Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsXMSSBufferGetSize_MB, (Ipp32s* pSize, IppsXMSSAlgo OIDAlgo))
+IPPAPI(IppStatus, ippsXMSSVerify_MB, (const Ipp8u* const pMsg[],
+                                      const Ipp32s msgLen[],
+                                      const IppsXMSSSignatureState* const pSign[],
+                                      int pIsSignValid[],
+                                      Ipp32s numSigns,
+                                      const IppsXMSSPublicKeyState* pKey,
+                                      Ipp8u* pBuffer))
 
 #endif // IPPCP_PREVIEW_XMSS
 
@@ -1570,6 +1647,54 @@ IPPAPI(IppStatus, ippsLMSVerify, (const Ipp8u* pMsg, const Ipp32s msgLen,
                                   int*  pIsSignValid,
                                   const IppsLMSPublicKeyState* pKey,
                                   Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsLMSBufferGetSize_MB, (Ipp32s* pSize, const IppsLMSAlgoType lmsType))
+IPPAPI(IppStatus, ippsLMSVerify_MB, (const Ipp8u* const pMsg[], const Ipp32s msgLen[],
+                                     const IppsLMSSignatureState* const pSign[],
+                                     int pIsSignValid[], Ipp32s numSigns,
+                                     const IppsLMSPublicKeyState* pKey,
+                                     Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsLMSPrivateKeyStateGetSize, (Ipp32s* pSize, const IppsLMSAlgoType lmsType))
+IPPAPI(IppStatus, ippsLMSKeyGenBufferGetSize, (Ipp32s* pSize, const IppsLMSAlgoType lmsType))
+IPPAPI(IppStatus, ippsLMSSignBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength, const IppsLMSAlgoType lmsType))
+IPPAPI(IppStatus, ippsLMSKeyGen, (const IppsLMSAlgoType lmsType,
+                                  IppsLMSPrivateKeyState* pPrvKey,
+                                  IppsLMSPublicKeyState* pPubKey,
+                                  IppBitSupplier rndFunc, void* pRndParam,
+                                  Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsLMSSign, (const Ipp8u* pMsg, const Ipp32s msgLen,
+                                IppsLMSPrivateKeyState* pPrvKey,
+                                IppsLMSSignatureState* pSign,
+                                IppBitSupplier rndFunc, void* pRndParam,
+                                Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsLMSPackPrivateKeyState, (const IppsLMSPrivateKeyState* pState, Ipp8u* pBuffer, Ipp32s bufSize))
+IPPAPI(IppStatus, ippsLMSUnpackPrivateKeyState, (const Ipp8u* pBuffer, IppsLMSPrivateKeyState* pState))
+IPPAPI(IppStatus, ippsLMSGetPublicKeyState, (const IppsLMSPublicKeyState* pState, Ipp8u* pI, Ipp8u* pK))
+IPPAPI(IppStatus, ippsLMSGetSignatureState, (const IppsLMSSignatureState* pState, Ipp32u* pQ, Ipp8u* pC,
+                                             Ipp8u* pY, Ipp8u* pAuthPath))
+IPPAPI(IppStatus, ippsHSSBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength))
+IPPAPI(IppStatus, ippsHSSPrivateKeyStateGetSize, (Ipp32s* pSize, Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+IPPAPI(IppStatus, ippsHSSSignatureGetSize, (Ipp32s* pSize, Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+IPPAPI(IppStatus, ippsHSSKeyGenBufferGetSize, (Ipp32s* pSize, Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+IPPAPI(IppStatus, ippsHSSSignBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength,
+                                             Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+IPPAPI(IppStatus, ippsHSSKeyGen, (Ipp32s levels, const IppsLMSAlgoType lmsType[],
+                                  IppsHSSPrivateKeyState* pPrvKey,
+                                  IppsLMSPublicKeyState* pPubKey,
+                                  IppBitSupplier rndFunc, void* pRndParam,
+                                  Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsHSSSign, (const Ipp8u* pMsg, const Ipp32s msgLen,
+                                IppsHSSPrivateKeyState* pPrvKey,
+                                Ipp8u* pSign,
+                                IppBitSupplier rndFunc, void* pRndParam,
+                                Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsHSSVerify, (const Ipp8u* pMsg, const Ipp32s msgLen,
+                                  const Ipp8u* pSign, const Ipp32s signLen,
+                                  int*  pIsSignValid,
+                                  Ipp32s levels,
+                                  const IppsLMSPublicKeyState* pKey,
+                                  Ipp8u* pBuffer))
+IPPAPI(IppStatus, ippsHSSPackPrivateKeyState, (const IppsHSSPrivateKeyState* pState, Ipp8u* pBuffer, Ipp32s bufSize))
+IPPAPI(IppStatus, ippsHSSUnpackPrivateKeyState, (const Ipp8u* pBuffer, IppsHSSPrivateKeyState* pState))
 #endif // IPPCP_PREVIEW_LMS
 
 #if defined(_MSC_VER) && !defined(__INTEL_COMPILER) && !defined(__INTEL_LLVM_COMPILER)
@@ -223,7 +223,34 @@ enum FIPS_IPPCP_FUNC {
     GFpECESDecrypt_SM2,
     GFpECESFinal_SM2,
     XMSSVerify,
-    LMSVerify
+    LMSVerify,
+    HashUpdate_MB_rmf,
+    HashFinal_MB_rmf,
+    HashMessage_MB_rmf,
+    LMSVerify_MB,
+    XMSSVerify_MB,
+    LMSKeyGen,
+    LMSSign,
+    GFpECMultiScalarMul,
+    GFpECVerifyDSABatch,
+    GFpBatchInv,
+    GFpBatchInv_CT,
+    GFpECBatchGetPoint,
+    GFpECBatchGetPoint_CT,
+    HSSKeyGen,
+    HSSSign,
+    HSSVerify,
+    AES_CCMSeal,
+    AES_CCMOpen,
+    AES_GCMEncryptV,
+    AES_GCMDecryptV,
+    AES_GCMSeal,
+    AES_GCMOpen,
+    AES_XTSEncryptDataUnits,
+    AES_XTSDecryptDataUnits,
+    AES_CMAC_MB,
+    AES_GCM_SIVEncrypt,
+    AES_GCM_SIVDecrypt
 };
 
 /**
@@ -498,6 +498,12 @@ typedef enum {
 typedef struct _cpAES_CCM        IppsAES_CCMState;
 /* AES-GCM (authentication & confidence) */
 typedef struct _cpAES_GCM        IppsAES_GCMState;
+/* AES-GCM scatter-gather segment */
+typedef struct {
+   const Ipp8u* pSrc;   /* input data                   */
+   Ipp8u*       pDst;   /* output data (unused for AAD) */
+   int          len;    /* length of the data in bytes  */
+} IppsAES_GCMSegment;
 /* AES-XTS (confidence) */
 typedef struct _cpAES_XTS        IppsAES_XTSSpec;
 
@@ -556,6 +562,9 @@ typedef struct _cpHashCtx  IppsHashState;
 
 typedef struct _cpHashMethod_rmf IppsHashMethod;
 typedef struct _cpHashCtx_rmf    IppsHashState_rmf;
+typedef struct _cpHashCtx_MB_rmf IppsHashState_MB_rmf;
+
+#define IPP_HASH_MB_MAX_BUFFERS  16   /* max number of buffers of multi-buffer hash */
 
 #define   IPP_SHA1_DIGEST_BITSIZE  160   /* digest size (bits) */
 #define IPP_SHA256_DIGEST_BITSIZE  256
@@ -931,6 +940,8 @@ IPPAPI( Ipp64u, ippcpGetCpuClocks, (void) )
 
     typedef struct _cpLMSSignatureState IppsLMSSignatureState;
     typedef struct _cpLMSPublicKeyState IppsLMSPublicKeyState;
+    typedef struct _cpLMSPrivateKeyState IppsLMSPrivateKeyState;
+    typedef struct _cpHSSPrivateKeyState IppsHSSPrivateKeyState;
 #endif // IPPCP_PREVIEW_LMS
 
 
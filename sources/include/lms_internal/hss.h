@@ -0,0 +1,155 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IPPCP_HSS_H_
+#define IPPCP_HSS_H_
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/lms.h"
+
+/* Max number of levels of HSS tree. "Section 6" LMS spec. */
+#define CP_HSS_MAX_LEVELS        (8)
+
+/* Byte size of u32str(Nspk) and u32str(L) fields */
+#define CP_HSS_NSPK_BYTESIZE     (4)
+
+/*
+ * HSS private key and signer state
+ *
+ * The state has no pointers inside: it may be packed, stored and unpacked to any address
+ * (see ippsHSSPackPrivateKeyState/ippsHSSUnpackPrivateKeyState). The structure is followed by
+ * the LMS private key states of the levels 0..L-1 and by the signed public keys of the levels
+ * 1..L-1 in the standard format:
+ *  |  prv[0] ||...|| prv[L-1] ||  sig[0]  ||  pub[1]  ||...||  sig[L-2]  ||  pub[L-1]  |
+ * where sig[i] is the LMS signature of pub[i+1] made by the key of the level i.
+ * A level key is retired (q = 2^h) before it is regenerated, so the state stays consistent
+ * if the signing fails in the middle of the regeneration.
+ */
+struct _cpHSSPrivateKeyState {
+    Ipp32u _idCtx;           // Private key ctx identifier
+    Ipp32u levels;           // number of levels L
+    IppsLMSAlgoType lmsType[CP_HSS_MAX_LEVELS];
+};
+
+/* Defines to handle contexts IDs */
+#define CP_HSS_SET_CTX_ID(ctx)    ((ctx)->_idCtx = (Ipp32u)idCtxHSS ^ (Ipp32u)IPP_UINT_PTR(ctx))
+#define CP_HSS_VALID_CTX_ID(ctx)  ((((ctx)->_idCtx) ^ (Ipp32u)IPP_UINT_PTR(ctx)) == (Ipp32u)idCtxHSS)
+#define CP_HSS_RESET_CTX_ID(ctx)  ((ctx)->_idCtx = (Ipp32u)idCtxHSS)
+
+// declarations
+#define cpHSSSetParams OWNAPI(cpHSSSetParams)
+IPP_OWN_DECL(IppStatus, cpHSSSetParams, (Ipp32s levels, const IppsLMSAlgoType lmsType[],
+            cpLMSParams lmsParams[], cpLMOTSParams lmotsParams[]))
+#define cpHSSWorkBufferSize OWNAPI(cpHSSWorkBufferSize)
+IPP_OWN_DECL(Ipp32s, cpHSSWorkBufferSize, (Ipp32s levels, Ipp32s maxMessageLength,
+            const cpLMSParams lmsParams[], const cpLMOTSParams lmotsParams[]))
+#define cpHSSEncodePublicKey OWNAPI(cpHSSEncodePublicKey)
+IPP_OWN_DECL(void, cpHSSEncodePublicKey, (Ipp8u* pOut, const IppsLMSPublicKeyState* pKey, const cpLMSParams* lmsParams))
+#define cpHSSEncodeSignature OWNAPI(cpHSSEncodeSignature)
+IPP_OWN_DECL(void, cpHSSEncodeSignature, (Ipp8u* pOut, const IppsLMSSignatureState* pSign,
+            const cpLMSParams* lmsParams, const cpLMOTSParams* lmotsParams))
+#define cpHSSDecodePublicKey OWNAPI(cpHSSDecodePublicKey)
+IPP_OWN_DECL(Ipp32s, cpHSSDecodePublicKey, (const Ipp8u* pIn, Ipp32s inLen, IppsLMSPublicKeyState* pKey))
+#define cpHSSDecodeSignature OWNAPI(cpHSSDecodeSignature)
+IPP_OWN_DECL(Ipp32s, cpHSSDecodeSignature, (const Ipp8u* pIn, Ipp32s inLen, IppsLMSSignatureState* pSign))
+#define cpHSSSignChildKey OWNAPI(cpHSSSignChildKey)
+IPP_OWN_DECL(IppStatus, cpHSSSignChildKey, (IppsHSSPrivateKeyState* pState, Ipp32u level,
+            const IppsLMSPublicKeyState* pChildKey, const cpLMSParams lmsParams[],
+            const cpLMOTSParams lmotsParams[], IppsLMSSignatureState* pSign,
+            IppBitSupplier rndFunc, void* pRndParam, Ipp8u* pBuffer))
+
+/* LMS public key state kept in the temporary buffer of the HSS key generation and signing */
+#define CP_HSS_PUBKEY_STATE_SIZE  (IPP_ALIGNED_SIZE((Ipp32s)sizeof(IppsLMSPublicKeyState) + CP_LMS_MAX_HASH_BYTESIZE, \
+                                                    CP_LMS_MB_ALIGNMENT))
+
+/* Big-endian u32str() value */
+__IPPCP_INLINE Ipp32u cpHSSGetU32(const Ipp8u* pIn) {
+    return ((Ipp32u)pIn[0] << 24) | ((Ipp32u)pIn[1] << 16) | ((Ipp32u)pIn[2] << 8) | (Ipp32u)pIn[3];
+}
+
+/* Size of the LMS signature state kept in the temporary buffer: the largest one of all levels */
+__IPPCP_INLINE Ipp32s cpHSSSignatureStateSize(Ipp32u levels, const cpLMSParams lmsParams[],
+                                             const cpLMOTSParams lmotsParams[]) {
+    Ipp32s size = 0;
+    for (Ipp32u i = 0; i < levels; i++) {
+        size = IPP_MAX(size, cpLMSSignatureStateSize(&lmsParams[i], &lmotsParams[i]));
+    }
+    return IPP_ALIGNED_SIZE(size, CP_LMS_MB_ALIGNMENT);
+}
+
+/* Byte size of the LMS public key in the standard format */
+__IPPCP_INLINE Ipp32s cpLMSPublicKeyByteSize(const cpLMSParams* lmsParams) {
+    //      type   || otstype ||          I         ||   T[1]
+    return (Ipp32s)(4 +    4    + CP_PK_I_BYTESIZE + lmsParams->m);
+}
+
+/* Byte size of the LMS signature in the standard format */
+__IPPCP_INLINE Ipp32s cpLMSSignatureByteSize(const cpLMSParams* lmsParams, const cpLMOTSParams* lmotsParams) {
+    //       q  || otstype ||       C        ||               y[0..p-1]           || type ||          path[0..h-1]
+    return (Ipp32s)(4 +   4    + lmotsParams->n + lmotsParams->p * lmotsParams->n +  4   + lmsParams->h * lmsParams->m);
+}
+
+/* Byte size of the signed public keys of the levels 1..L-1 */
+__IPPCP_INLINE Ipp32s cpHSSSignedKeysByteSize(Ipp32u levels, const cpLMSParams lmsParams[],
+                                             const cpLMOTSParams lmotsParams[]) {
+    Ipp32s size = 0;
+    for (Ipp32u i = 1; i < levels; i++) {
+        size += cpLMSSignatureByteSize(&lmsParams[i - 1], &lmotsParams[i - 1]) + cpLMSPublicKeyByteSize(&lmsParams[i]);
+    }
+    return size;
+}
+
+/* Size of the HSS private key state */
+__IPPCP_INLINE Ipp32s cpHSSPrivateKeyStateSize(Ipp32u levels, const cpLMSParams lmsParams[],
+                                              const cpLMOTSParams lmotsParams[]) {
+    Ipp32s size = (Ipp32s)sizeof(IppsHSSPrivateKeyState);
+    for (Ipp32u i = 0; i < levels; i++) {
+        size += cpLMSPrivateKeyStateSize(&lmsParams[i]);
+    }
+    return size + cpHSSSignedKeysByteSize(levels, lmsParams, lmotsParams);
+}
+
+/* Byte size of the HSS signature in the standard format */
+__IPPCP_INLINE Ipp32s cpHSSSignatureByteSize(Ipp32u levels, const cpLMSParams lmsParams[],
+                                            const cpLMOTSParams lmotsParams[]) {
+    return CP_HSS_NSPK_BYTESIZE +
+           cpHSSSignedKeysByteSize(levels, lmsParams, lmotsParams) +
+           cpLMSSignatureByteSize(&lmsParams[levels - 1], &lmotsParams[levels - 1]);
+}
+
+/* LMS private key state of the level */
+__IPPCP_INLINE IppsLMSPrivateKeyState* cpHSSLevelKey(const IppsHSSPrivateKeyState* pState, Ipp32u level,
+                                                   const cpLMSParams lmsParams[]) {
+    Ipp8u* pKey = (Ipp8u*)pState + sizeof(IppsHSSPrivateKeyState);
+    for (Ipp32u i = 0; i < level; i++) {
+        pKey += cpLMSPrivateKeyStateSize(&lmsParams[i]);
+    }
+    return (IppsLMSPrivateKeyState*)pKey;
+}
+
+/* Signed public keys of the levels 1..L-1 */
+__IPPCP_INLINE Ipp8u* cpHSSSignedKeys(const IppsHSSPrivateKeyState* pState, const cpLMSParams lmsParams[]) {
+    return (Ipp8u*)cpHSSLevelKey(pState, pState->levels, lmsParams);
+}
+
+/* Signature of the public key of the level made by its parent, the public key follows it */
+__IPPCP_INLINE Ipp8u* cpHSSSignedKey(const IppsHSSPrivateKeyState* pState, Ipp32u level,
+                                    const cpLMSParams lmsParams[], const cpLMOTSParams lmotsParams[]) {
+    return cpHSSSignedKeys(pState, lmsParams) + cpHSSSignedKeysByteSize(level, lmsParams, lmotsParams);
+}
+
+#endif /* #ifndef IPPCP_HSS_H_ */
@@ -44,6 +44,20 @@ typedef struct {
     Ipp8u* pY;
 } _cpLMOTSSignatureState;
 
+/* Size of I || u32str(q) || u16str(i) || u8str(j) prefix of the chain hash input */
+#define CP_LMOTS_CHAIN_PREFIX_BYTESIZE (16+4+2+1)
+/* Max number of chains processed simultaneously */
+#define CP_LMOTS_MAX_CHAIN_LANES       (IPP_HASH_MB_MAX_BUFFERS)
+
+// declarations
+#define cpLMOTSChains OWNAPI(cpLMOTSChains)
+IPP_OWN_DECL(IppStatus, cpLMOTSChains, (Ipp8u* const pOut[], const Ipp8u* const pIn[], const Ipp8u* const pIq[],
+            const Ipp8u* const pStart[], const Ipp8u* const pEnd[], Ipp32s numSets,
+            const cpLMOTSParams* params))
+#define cpLMOTSPrivateKeys OWNAPI(cpLMOTSPrivateKeys)
+IPP_OWN_DECL(IppStatus, cpLMOTSPrivateKeys, (Ipp8u* const pX[], const Ipp8u* const pIq[], const Ipp8u* pSeed,
+            Ipp32s numSets, const cpLMOTSParams* params))
+
 /*
  * Set LMOTS parameters
  *
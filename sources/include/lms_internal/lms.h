@@ -26,6 +26,10 @@
 #define CP_LMS_MAX_HASH_BYTESIZE (32)
 #define CP_SIG_MAX_Y_WORDSIZE    (265)
 
+/* Max number of signatures verified simultaneously by ippsLMSVerify_MB */
+#define CP_LMS_MB_MAX_SIGNS      (IPP_HASH_MB_MAX_BUFFERS)
+#define CP_LMS_MB_ALIGNMENT      ((int)sizeof(Ipp64u))
+
 /* Constants used to distinguish hashes in the system */
 #define D_PBLC (0x8080)
 #define D_MESG (0x8181)
@@ -68,9 +72,63 @@ struct _cpLMSSignatureState {
     //   Y[0]   ||   Y[1]   ||...||  Y[p-1]
 };
 
+/* Max height of LMS tree */
+#define CP_LMS_MAX_TREE_HEIGHT   (25)
+
+/*
+ * Treehash instance of the Merkle tree traversal: computes the node that replaces
+ * auth path node of its height next time. Its leaves [nextLeaf, endLeaf) are
+ * computed one per signature and merged on the instance stack.
+ */
+typedef struct {
+    Ipp32u nextLeaf;  // next leaf to compute
+    Ipp32u endLeaf;   // the last leaf of the node + 1, 0 if the instance is finished
+    Ipp32u stackSize; // number of nodes on the stack
+    Ipp8u  stackHeight[CP_LMS_MAX_TREE_HEIGHT];
+} cpLMSTreeHash;
+
+/*
+ * LMS private key and signer state
+ *
+ * The state has no pointers inside: it may be packed, stored and unpacked to any address
+ * (see ippsLMSPackPrivateKeyState/ippsLMSUnpackPrivateKeyState). The structure is followed by
+ * the traversal cache of the tree of height h:
+ *  |   auth path   ||   treehash nodes   ||  treehash stacks   |
+ *  |  h * m bytes  ||    h * m bytes     ||  h * h * m bytes   |
+ */
+struct _cpLMSPrivateKeyState {
+    Ipp32u _idCtx;           // Private key ctx identifier
+    IppsLMSAlgo   lmsOIDAlgo;
+    IppsLMOTSAlgo lmotsOIDAlgo;
+    Ipp32u q;                // the next leaf to sign, 2^h if the key is exhausted
+    Ipp8u I[CP_PK_I_BYTESIZE];
+    Ipp8u SEED[CP_LMS_MAX_HASH_BYTESIZE];
+    cpLMSTreeHash treeHash[CP_LMS_MAX_TREE_HEIGHT];
+};
+
+/* Traversal cache of the private key state */
+#define CP_LMS_AUTH_PATH(ctx)             ((Ipp8u*)(ctx) + sizeof(IppsLMSPrivateKeyState))
+#define CP_LMS_TREEHASH_NODE(ctx, h, m)   (CP_LMS_AUTH_PATH(ctx) + (h) * (m))
+#define CP_LMS_TREEHASH_STACK(ctx, h, m)  (CP_LMS_AUTH_PATH(ctx) + 2 * (h) * (m))
+
 /* Defines to handle contexts IDs */
 #define CP_LMS_SET_CTX_ID(ctx)    ((ctx)->_idCtx = (Ipp32u)idCtxLMS ^ (Ipp32u)IPP_UINT_PTR(ctx))
 #define CP_LMS_VALID_CTX_ID(ctx)  ((((ctx)->_idCtx) ^ (Ipp32u)IPP_UINT_PTR(ctx)) == (Ipp32u)idCtxLMS)
+#define CP_LMS_RESET_CTX_ID(ctx)  ((ctx)->_idCtx = (Ipp32u)idCtxLMS)
+
+// declarations
+#define cpLMSLeaves OWNAPI(cpLMSLeaves)
+IPP_OWN_DECL(IppStatus, cpLMSLeaves, (Ipp8u* const pLeaf[], const Ipp32u q[], Ipp32s numLeaves,
+            const Ipp8u* pI, const Ipp8u* pSeed, const cpLMSParams* lmsParams,
+            const cpLMOTSParams* lmotsParams, Ipp8u* pBuffer))
+#define cpLMSInnerNode OWNAPI(cpLMSInnerNode)
+IPP_OWN_DECL(IppStatus, cpLMSInnerNode, (Ipp8u* pNode, Ipp32u r, const Ipp8u* pLeft, const Ipp8u* pRight,
+            const Ipp8u* pI, const cpLMSParams* lmsParams))
+#define cpLMSTraversalUpdate OWNAPI(cpLMSTraversalUpdate)
+IPP_OWN_DECL(IppStatus, cpLMSTraversalUpdate, (IppsLMSPrivateKeyState* pState, const cpLMSParams* lmsParams,
+            const cpLMOTSParams* lmotsParams, Ipp8u* pBuffer))
+#define cpLMSTraversalIsValid OWNAPI(cpLMSTraversalIsValid)
+IPP_OWN_DECL(int, cpLMSTraversalIsValid, (const IppsLMSPrivateKeyState* pState, const cpLMSParams* lmsParams))
 
 /*
  * Set LMS parameters
@@ -109,4 +167,26 @@ __IPPCP_INLINE IppStatus setLMSParams(IppsLMSAlgo lmsOIDAlgo, cpLMSParams* param
     return ippStsNoErr;
 }
 
+/* Size of the temporary buffer of cpLMSLeaves() */
+__IPPCP_INLINE Ipp32s cpLMSLeavesBufferSize(const cpLMOTSParams* lmotsParams) {
+                 //    I       ||  q  ||  D_PBLC  ||       x[0..p-1] / y[0..p-1]
+    Ipp32u lenBufZ = CP_PK_I_BYTESIZE + 4  +    2     + lmotsParams->p * lmotsParams->n;
+    return (Ipp32s)(CP_LMS_MB_MAX_SIGNS * lenBufZ);
+}
+
+/* Size of the LMS private key state */
+__IPPCP_INLINE Ipp32s cpLMSPrivateKeyStateSize(const cpLMSParams* lmsParams) {
+    return (Ipp32s)sizeof(IppsLMSPrivateKeyState) +
+           (Ipp32s)(2 * lmsParams->h * lmsParams->m) +            /* auth path and treehash nodes */
+           (Ipp32s)(lmsParams->h * lmsParams->h * lmsParams->m);  /* treehash stacks */
+}
+
+/* Size of the LMS signature state */
+__IPPCP_INLINE Ipp32s cpLMSSignatureStateSize(const cpLMSParams* lmsParams, const cpLMOTSParams* lmotsParams) {
+    return (Ipp32s)sizeof(IppsLMSSignatureState) +
+           (Ipp32s)(lmotsParams->n * lmsParams->h) + /*_pAuthPath*/
+           (Ipp32s)lmotsParams->n                  + /* C */
+           (Ipp32s)(lmotsParams->n * lmotsParams->p); /* Y */
+}
+
 #endif /* #ifndef IPPCP_LMS_H_ */
@@ -387,7 +387,9 @@ typedef enum {
     idCtxAESXTS,
     idxCtxECES_SM2,
     idCtxGFPECKE,
-    idCtxLMS
+    idCtxLMS,
+    idCtxHashMB,
+    idCtxHSS
 } IppCtxId;
 
 
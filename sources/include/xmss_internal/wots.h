@@ -19,6 +19,7 @@
 
 #include "owndefs.h"
 #include "pcptool.h"
+#include "pcphash_mb_rmf.h"
 
 #include "stateful_sig_common/common.h"
 
@@ -32,6 +33,12 @@ typedef struct {
     IppsHashMethod* hash_method;
 } cpWOTSParams;
 
+/* Max hash size (n) and max number of WOTS+ chains (len) */
+#define CP_XMSS_MAX_HASH_BYTESIZE (64)
+#define CP_WOTS_MAX_LEN           (131)
+/* Max number of hashes computed simultaneously */
+#define CP_XMSS_MB_MAX_LANES      (IPP_HASH_MB_MAX_BUFFERS)
+
 // declarations
 #define base_w OWNAPI(base_w)
 IPP_OWN_DECL(void, base_w, (const Ipp8u* pMsg, Ipp32s out_len, Ipp8u* basew, cpWOTSParams* params))
@@ -43,13 +50,20 @@ IPP_OWN_DECL(IppStatus, do_xmss_hash, (Ipp32u padding_id, const Ipp8u* key,
 #define prf OWNAPI(prf)
 IPP_OWN_DECL(IppStatus, prf, (const Ipp8u* key, const Ipp8u* index, Ipp8u* out, Ipp8u* temp_buf, cpWOTSParams* params))
 
-#define chain OWNAPI(chain)
-IPP_OWN_DECL(IppStatus, chain, (Ipp8u* X, Ipp8u i, Ipp8u s, Ipp8u* pSeed, Ipp8u* adrs,
-            Ipp8u* out, Ipp8u* temp_buf, cpWOTSParams* params))
+#define WOTS_msgToBaseW OWNAPI(WOTS_msgToBaseW)
+IPP_OWN_DECL(void, WOTS_msgToBaseW, (const Ipp8u* M, Ipp8u* msg, cpWOTSParams* params))
+
+// multi-buffer versions
+#define prf_prehash OWNAPI(prf_prehash)
+IPP_OWN_DECL(void, prf_prehash, (const Ipp8u* key, cpHash prfState, cpWOTSParams* params))
+
+#define prf_MB OWNAPI(prf_MB)
+IPP_OWN_DECL(void, prf_MB, (const cpHash prfState, const Ipp8u* const index[], Ipp8u* const out[], Ipp32s num,
+                cpWOTSParams* params))
 
-#define WOTS_pkFromSig OWNAPI(WOTS_pkFromSig)
-IPP_OWN_DECL(IppStatus, WOTS_pkFromSig, (const Ipp8u* M, Ipp8u* sig, Ipp8u* pSeed,
-            Ipp8u* adrs, Ipp8u* out, Ipp8u* temp_buf, cpWOTSParams* params))
+#define WOTS_pkFromSig_MB OWNAPI(WOTS_pkFromSig_MB)
+IPP_OWN_DECL(IppStatus, WOTS_pkFromSig_MB, (const Ipp8u* const M[], const Ipp8u* const sig[], const Ipp8u* pSeed,
+            const Ipp8u* const adrs[], Ipp8u* const out[], Ipp32s numSets, cpWOTSParams* params))
 
 /*
  * Set idx as a 4-elements byte array to adrs
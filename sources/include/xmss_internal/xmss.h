@@ -74,14 +74,23 @@ struct _cpXMSSSignatureState {
     Ipp8u* pAuthPath;
 };
 
-// declarations
-#define ltree OWNAPI(ltree)
-IPP_OWN_DECL(IppStatus, ltree, (Ipp8u* pk, Ipp8u* seed, Ipp8u* adrs, Ipp8u* temp_buf, cpWOTSParams* params))
+/* Alignment of the multi-buffer hash state in the ippsXMSSVerify_MB buffer */
+#define CP_XMSS_MB_ALIGNMENT ((int)sizeof(Ipp64u))
 
+// declarations
 #define rand_hash OWNAPI(rand_hash)
 IPP_OWN_DECL(IppStatus, rand_hash, (Ipp8u* left, Ipp8u* right, Ipp8u* seed,
             Ipp8u* adrs, Ipp8u* out, Ipp8u* temp_buf, cpWOTSParams* params))
 
+// multi-buffer versions
+#define ltree_MB OWNAPI(ltree_MB)
+IPP_OWN_DECL(IppStatus, ltree_MB, (Ipp8u* const pk[], const Ipp8u* seed, const Ipp8u* const adrs[], Ipp32s numSets,
+            cpWOTSParams* params))
+
+#define rand_hash_MB OWNAPI(rand_hash_MB)
+IPP_OWN_DECL(IppStatus, rand_hash_MB, (const Ipp8u* const left[], const Ipp8u* const right[], const Ipp8u* seed,
+            const Ipp8u* const adrs[], Ipp8u* const out[], Ipp32s num, cpWOTSParams* params))
+
 /*
  * Set XMSS algorithms parameters
  *
@@ -0,0 +1,117 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "aes_cmac_aesni_mb.h"
+
+#if (_IPP32E>=_IPP32E_Y8)
+
+static inline void aes_encrypt4_aesni_mb4(__m128i blocks[4], __m128i enc_keys[4][15], int cipherRounds)
+{
+    blocks[0] = _mm_xor_si128(blocks[0], enc_keys[0][0]);
+    blocks[1] = _mm_xor_si128(blocks[1], enc_keys[1][0]);
+    blocks[2] = _mm_xor_si128(blocks[2], enc_keys[2][0]);
+    blocks[3] = _mm_xor_si128(blocks[3], enc_keys[3][0]);
+
+    int nr;
+
+    for (nr = 1; nr < cipherRounds; nr += 1) {
+        blocks[0] = _mm_aesenc_si128(blocks[0], enc_keys[0][nr]);
+        blocks[1] = _mm_aesenc_si128(blocks[1], enc_keys[1][nr]);
+        blocks[2] = _mm_aesenc_si128(blocks[2], enc_keys[2][nr]);
+        blocks[3] = _mm_aesenc_si128(blocks[3], enc_keys[3][nr]);
+    }
+
+    blocks[0] = _mm_aesenclast_si128(blocks[0], enc_keys[0][nr]);
+    blocks[1] = _mm_aesenclast_si128(blocks[1], enc_keys[1][nr]);
+    blocks[2] = _mm_aesenclast_si128(blocks[2], enc_keys[2][nr]);
+    blocks[3] = _mm_aesenclast_si128(blocks[3], enc_keys[3][nr]);
+}
+
+/*
+// CBC-MAC of 4 buffers:
+//    mac_pa[i] = CBC-MAC(mac_pa[i], source_pa[i]), len[i] is a multiple of 16
+// Buffers of zero length are skipped, its mac_pa[i] is not accessed.
+*/
+IPP_OWN_DEFN (void, aes_cmac_aesni_mb4, (const Ipp8u* const source_pa[4], const int len[4], const int cipherRounds, const Ipp32u* enc_keys[4], Ipp8u* const mac_pa[4]))
+{
+    const __m128i* pSrc[4];
+
+    __m128i blocks[4];
+    __m128i macBlocks[4];
+
+    int nBlocks[4];
+
+    int maxBlocks = 0;
+
+    __m128i keySchedule[4][15];
+
+    for (int i = 0; i < 4; i++) {
+        pSrc[i] = (const __m128i*)source_pa[i];
+
+        nBlocks[i] = len[i] / MBS_RIJ128;
+        blocks[i] = macBlocks[i] = _mm_setzero_si128();
+
+        if(nBlocks[i] > 0) {
+            macBlocks[i] = _mm_loadu_si128((__m128i const*)(mac_pa[i]));
+
+            for (int j = 0; j <= cipherRounds; j++) {
+                keySchedule[i][j] = _mm_loadu_si128((__m128i const*)enc_keys[i] + j);
+            }
+        }
+        else {
+            /* the lane is encrypted but the result is discarded */
+            for (int j = 0; j <= cipherRounds; j++) {
+                keySchedule[i][j] = _mm_setzero_si128();
+            }
+        }
+
+        if (nBlocks[i] > maxBlocks) {
+            maxBlocks = nBlocks[i];
+        }
+    }
+
+    for (int block = 0; block < maxBlocks; block++) {
+        for (int i = 0; i < 4; i++) {
+            if (block < nBlocks[i]) {
+                blocks[i] = _mm_xor_si128(macBlocks[i], _mm_loadu_si128(pSrc[i]));
+                pSrc[i] += 1;
+            }
+        }
+
+        aes_encrypt4_aesni_mb4(blocks, keySchedule, cipherRounds);
+
+        for (int i = 0; i < 4; i++) {
+            if (block < nBlocks[i]) {
+                macBlocks[i] = blocks[i];
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if (nBlocks[i] > 0) {
+            _mm_storeu_si128((__m128i*)(mac_pa[i]), macBlocks[i]);
+        }
+    }
+
+    PurgeBlock(keySchedule, sizeof(keySchedule));
+}
+
+#endif
@@ -0,0 +1,162 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "aes_cfb_vaes_mb.h"
+#include "aes_cmac_vaes_mb.h"
+
+#if(_IPP32E>=_IPP32E_K1)
+
+/*
+// Each 512-bit register holds the CBC-MAC chaining values of 4 independent buffers,
+// nRegs (1, 2 or 4) registers are encrypted in an interleaved manner to hide the AES latency.
+*/
+__IPPCP_INLINE void aes_encrypt_vaes_mb(__m512i* b, __m512i (*pRkey)[4], const int num_rounds, const int nRegs)
+{
+   int r, n;
+
+   for (r = 0; r < nRegs; r++)
+      b[r] = _mm512_xor_si512(b[r], pRkey[0][r]);
+
+   for (n = 1; n < num_rounds; n++) {
+      for (r = 0; r < nRegs; r++)
+         b[r] = _mm512_aesenc_epi128(b[r], pRkey[n][r]);
+   }
+
+   for (r = 0; r < nRegs; r++)
+      b[r] = _mm512_aesenclast_epi128(b[r], pRkey[num_rounds][r]);
+}
+
+// Disable optimization for MSVC
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+    #pragma optimize( "", off )
+#endif
+
+/*
+// CBC-MAC of nRegs*4 buffers:
+//    mac_pa[i] = CBC-MAC(mac_pa[i], source_pa[i]), len[i] is a multiple of 16
+// Buffers of zero length are skipped, its mac_pa[i] is not accessed.
+*/
+__IPPCP_INLINE void aes_cmac_vaes_mb(const Ipp8u* const source_pa[], const int arr_len[], const int num_rounds, const Ipp32u* enc_keys[], Ipp8u* const mac_pa[], const int nRegs)
+{
+   int i, r, s;
+   int maxBlks = 0;
+   int loc_nblks[16];
+   const Ipp8u* loc_src[16];
+   __m512i mac512[4];
+
+   __mmask8 mbMask128[16];
+
+   const int nLanes = nRegs * 4;
+
+   // - Local copy of length and source pointers, maxBlks calculation
+   for (i = 0; i < nLanes; i++) {
+      loc_nblks[i] = arr_len[i] / MBS_RIJ128;
+      loc_src[i]   = source_pa[i];
+      mbMask128[i] = (__mmask8)(loc_nblks[i] ? 0x03 << (2 * (i & 3)) : 0);
+
+      if (loc_nblks[i] > maxBlks)
+         maxBlks = loc_nblks[i];
+   }
+
+   if (!maxBlks)
+      return;
+
+   // Load the 128-bit chaining values
+   for (r = 0; r < nRegs; r++) {
+      mac512[r] = _mm512_setzero_si512();
+      mac512[r] = _mm512_mask_expandloadu_epi64(mac512[r], mbMask128[4*r],     mac_pa[4*r]);
+      mac512[r] = _mm512_mask_expandloadu_epi64(mac512[r], mbMask128[4*r + 1], mac_pa[4*r + 1]);
+      mac512[r] = _mm512_mask_expandloadu_epi64(mac512[r], mbMask128[4*r + 2], mac_pa[4*r + 2]);
+      mac512[r] = _mm512_mask_expandloadu_epi64(mac512[r], mbMask128[4*r + 3], mac_pa[4*r + 3]);
+   }
+
+   // Prepare array with key schedule
+   __m512i keySchedule[15][4];
+   for (i = 0; i <= num_rounds; i++) {
+      for (r = 0; r < nRegs; r++) {
+         __m512i tmpKeyMb = _mm512_setzero_si512();
+         tmpKeyMb = _mm512_mask_expandloadu_epi64(tmpKeyMb, mbMask128[4*r],     (const void *)(enc_keys[4*r]     + (Ipp32u)i * sizeof(Ipp32u)));
+         tmpKeyMb = _mm512_mask_expandloadu_epi64(tmpKeyMb, mbMask128[4*r + 1], (const void *)(enc_keys[4*r + 1] + (Ipp32u)i * sizeof(Ipp32u)));
+         tmpKeyMb = _mm512_mask_expandloadu_epi64(tmpKeyMb, mbMask128[4*r + 2], (const void *)(enc_keys[4*r + 2] + (Ipp32u)i * sizeof(Ipp32u)));
+         tmpKeyMb = _mm512_mask_expandloadu_epi64(tmpKeyMb, mbMask128[4*r + 3], (const void *)(enc_keys[4*r + 3] + (Ipp32u)i * sizeof(Ipp32u)));
+         keySchedule[i][r] = tmpKeyMb;
+      }
+   }
+
+   for (; maxBlks > 0; maxBlks -= 4)
+   {
+      __m512i b[16];
+      __mmask8 activeMask[4][4] = { 0 }; /* [block][register] */
+
+      // Load up to 4 blocks from the each buffer
+      for (i = 0; i < nLanes; i++) {
+         int nBlks = IPP_MAX(IPP_MIN(loc_nblks[i], 4), 0);
+         b[i] = _mm512_maskz_loadu_epi64((__mmask8)((1 << (2 * nBlks)) - 1), loc_src[i]);
+
+         for (s = 0; s < nBlks; s++)
+            activeMask[s][i >> 2] |= (__mmask8)(0x03 << (2 * (i & 3)));
+
+         if (nBlks)
+            loc_src[i] += MBS_RIJ128 * 4;
+         loc_nblks[i] -= 4;
+      }
+
+      for (r = 0; r < nRegs; r++)
+         TRANSPOSE_4x4_I128(b[4*r], b[4*r + 1], b[4*r + 2], b[4*r + 3]);   // {0,0,0,0}, {1,1,1,1}, {2,2,2,2}, {3,3,3,3}
+
+      // MAC = AES(MAC ^ block), the chaining value of the exhausted buffer is kept unchanged
+      for (s = 0; s < 4; s++) {
+         __m512i chip[4];
+         for (r = 0; r < nRegs; r++)
+            chip[r] = _mm512_xor_si512(mac512[r], b[4*r + s]);
+
+         aes_encrypt_vaes_mb(chip, keySchedule, num_rounds, nRegs);
+
+         for (r = 0; r < nRegs; r++)
+            mac512[r] = _mm512_mask_mov_epi64(mac512[r], activeMask[s][r], chip[r]);
+      }
+   }
+
+   // Store the chaining values
+   for (i = 0; i < nLanes; i++)
+      _mm512_mask_compressstoreu_epi64(mac_pa[i], mbMask128[i], mac512[i >> 2]);
+}
+
+IPP_OWN_DEFN (void, aes_cmac_vaes_mb16, (const Ipp8u* const source_pa[16], const int len[16], const int num_rounds, const Ipp32u* enc_keys[16], Ipp8u* const mac_pa[16]))
+{
+   aes_cmac_vaes_mb(source_pa, len, num_rounds, enc_keys, mac_pa, 4);
+}
+
+IPP_OWN_DEFN (void, aes_cmac_vaes_mb8, (const Ipp8u* const source_pa[8], const int len[8], const int num_rounds, const Ipp32u* enc_keys[8], Ipp8u* const mac_pa[8]))
+{
+   aes_cmac_vaes_mb(source_pa, len, num_rounds, enc_keys, mac_pa, 2);
+}
+
+IPP_OWN_DEFN (void, aes_cmac_vaes_mb4, (const Ipp8u* const source_pa[4], const int len[4], const int num_rounds, const Ipp32u* enc_keys[4], Ipp8u* const mac_pa[4]))
+{
+   aes_cmac_vaes_mb(source_pa, len, num_rounds, enc_keys, mac_pa, 1);
+}
+
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+    #pragma optimize( "", on )
+#endif
+
+#endif
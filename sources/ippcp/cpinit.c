@@ -329,12 +329,22 @@ IppStatus owncpFeaturesToIdx(  Ipp64u* cpuFeatures, int* index )
 }
 
 
+/*
+// Number of threads used by bulk cipher operations.
+// Threading is available only if the library is built with OpenMP support (IPPCP_OPENMP option),
+// otherwise the functions below have no effect and library always runs single-threaded.
+*/
 IPPFUN(IppStatus, ippcpSetNumThreads, (int numThr))
 {
    IppStatus status = ippStsNoErr;
 
+#if defined(_OPENMP)
+   IPP_BADARG_RET(numThr<1, ippStsOutOfRangeErr);
+   cpthreads_omp_of_n_ipp = numThr;
+#else
    IPP_UNREFERENCED_PARAMETER(numThr);
    status = ippStsNoOperation;
+#endif
 
    return status;
 }
@@ -344,8 +354,12 @@ IPPFUN(IppStatus, ippcpGetNumThreads, (int* pNumThr))
    IppStatus status = ippStsNoErr;
    IPP_BAD_PTR1_RET(pNumThr)
 
-      *pNumThr = 1;
+#if defined(_OPENMP)
+   *pNumThr = cpthreads_omp_of_n_ipp;
+#else
+   *pNumThr = 1;
    status = ippStsNoOperation;
+#endif
 
    return status;
 }
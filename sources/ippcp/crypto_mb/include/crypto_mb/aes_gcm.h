@@ -0,0 +1,105 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef AES_GCM_H
+#define AES_GCM_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+#include <immintrin.h>
+
+#define AES_LINES      (16) /* Max number of buffers       */
+#define AES_BLOCK_SIZE (16) /* AES data block size (bytes) */
+#define AES_MAX_ROUNDS (14) /* AES-256 number of rounds    */
+
+#define AES_GCM_HASHKEY_PWR_NUM 8
+
+/*
+// Enum to control call sequence
+//
+// Valid call sequence:
+//
+// 1) mbx_aes_gcm_init_mb16
+// 2) mbx_aes_gcm_update_iv_mb16 –  optional, can be called as many times as necessary
+// 3) mbx_aes_gcm_update_aad_mb16 –  optional, can be called as many times as necessary
+// 4) mbx_aes_gcm_encrypt_mb16/mbx_aes_gcm_decrypt_mb16 –  optional, can be called as many times as necessary
+// 5) mbx_aes_gcm_get_tag_mb16
+//
+// Call sequence restrictions are the same as for SM4-GCM (see crypto_mb/sm4_gcm.h):
+//
+// * mbx_aes_gcm_get_tag_mb16 can be called after IV is fully processed.
+// * functions at steps 2-4 can be called as many times as needed while they process buffers
+//   with full blocks (Blocks of 16 bytes size) or empty buffers and length of processed payload is not overflowed.
+// * if functions at steps 2-4 called to process a partial block, it can’t be called again.
+// * if mbx_aes_gcm_update_aad_mb16 was called, mbx_aes_gcm_update_iv_mb16 can’t be called.
+// * if mbx_aes_gcm_encrypt_mb16 or mbx_aes_gcm_decrypt_mb16 was called, mbx_aes_gcm_update_aad_mb16 and mbx_aes_gcm_update_iv_mb16 can’t be called.
+// * if mbx_aes_gcm_encrypt_mb16 was called, mbx_aes_gcm_decrypt_mb16 can’t be called and vice versa.
+*/
+typedef enum { aes_gcm_update_iv = 0xF0B1, aes_gcm_update_aad, aes_gcm_start_encdec, aes_gcm_enc, aes_gcm_dec, aes_gcm_get_tag } aes_gcm_state;
+
+struct _aes_gcm_context_mb16 {
+   __m128i hashkey[AES_GCM_HASHKEY_PWR_NUM][AES_LINES]; /* Set of hashkeys for ghash computation              */
+   __m128i j0[AES_LINES];                               /* J0 value accumulator for IV processing             */
+   __m128i ghash[AES_LINES];                            /* ghash value accumulator for AAD and TXT processing */
+   __m128i ctr[AES_LINES];                              /* counter for gctr encryption                        */
+
+   /*
+   // buffer to store IV, AAD and TXT length in bytes
+   //
+   // Layout is the same as in SM4_GCM_CTX_mb16 (see crypto_mb/sm4_gcm.h):
+   // [64 bits with IV len (buffer 0)] .. [64 bits with IV len (buffer AES_LINES-1)] for J0 computation and
+   // [64 bits with TXT len (buffer i)][64 bits with AAD len (buffer i)] for ghash computation
+   */
+   int64u len[AES_LINES * 2];
+
+   /*
+   // AES round keys
+   //
+   // round keys of 4 consecutive buffers are stored contiguously,
+   // so the keys of one round for buffers 4*i .. 4*i+3 are loaded into a single 512-bit register
+   */
+   __m128i key_sched[AES_MAX_ROUNDS + 1][AES_LINES];
+   int num_rounds;      /* number of AES rounds (10, 12 or 14) */
+   aes_gcm_state state; /* call sequence state                 */
+};
+
+typedef struct _aes_gcm_context_mb16 AES_GCM_CTX_mb16;
+
+/*
+// key_len is the length of all 16 keys in bytes: 16 (AES-128), 24 (AES-192) or 32 (AES-256)
+*/
+MBXAPI(mbx_status16, mbx_aes_gcm_init_mb16,(const int8u *const pa_key[AES_LINES],
+                                            const int key_len,
+                                            const int8u *const pa_iv[AES_LINES],
+                                            const int iv_len[AES_LINES],
+                                            AES_GCM_CTX_mb16 *p_context))
+
+MBXAPI(mbx_status16, mbx_aes_gcm_update_iv_mb16,(const int8u *const pa_iv[AES_LINES], const int iv_len[AES_LINES], AES_GCM_CTX_mb16 *p_context))
+MBXAPI(mbx_status16, mbx_aes_gcm_update_aad_mb16,(const int8u *const pa_aad[AES_LINES], const int aad_len[AES_LINES], AES_GCM_CTX_mb16 *p_context))
+
+MBXAPI(mbx_status16, mbx_aes_gcm_encrypt_mb16,(int8u *pa_out[AES_LINES],
+                                               const int8u *const pa_in[AES_LINES],
+                                               const int in_len[AES_LINES],
+                                               AES_GCM_CTX_mb16 *p_context))
+MBXAPI(mbx_status16, mbx_aes_gcm_decrypt_mb16,(int8u *pa_out[AES_LINES],
+                                               const int8u *const pa_in[AES_LINES],
+                                               const int in_len[AES_LINES],
+                                               AES_GCM_CTX_mb16 *p_context))
+
+MBXAPI(mbx_status16, mbx_aes_gcm_get_tag_mb16,(int8u *pa_tag[AES_LINES], const int tag_len[AES_LINES], AES_GCM_CTX_mb16 *p_context))
+
+#endif /* AES_GCM_H */
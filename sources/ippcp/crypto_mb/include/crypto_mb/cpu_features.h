@@ -104,13 +104,19 @@ enum MBX_ALGO {
    MBX_ALGO_EC_SM2,
    MBX_ALGO_ECDHE_SM2 = MBX_ALGO_EC_SM2,
    MBX_ALGO_ECDSA_SM2 = MBX_ALGO_EC_SM2,
+   MBX_ALGO_ENC_SM2   = MBX_ALGO_EC_SM2,
    MBX_ALGO_SM3,
+   MBX_ALGO_HMAC_SM3   = MBX_ALGO_SM3,
    MBX_ALGO_SM4,
    MBX_ALGO_ECB_SM4    = MBX_ALGO_SM4,
    MBX_ALGO_CBC_SM4    = MBX_ALGO_SM4,
    MBX_ALGO_CTR_SM4    = MBX_ALGO_SM4,
    MBX_ALGO_OFB_SM4    = MBX_ALGO_SM4,
    MBX_ALGO_OFB128_SM4 = MBX_ALGO_SM4,
+   MBX_ALGO_AES,
+   MBX_ALGO_GCM_AES    = MBX_ALGO_AES,
+   MBX_ALGO_RSA_6K,
+   MBX_ALGO_RSA_8K,
 };
 
 /* multi-buffer width implemented by library */
@@ -150,6 +150,50 @@ MBXAPI(mbx_status, mbx_nistp256_ecdsa_verify_mb8,(const int8u* const pa_sign_r[8
                                                  const int64u* const pa_puby[8],
                                                  const int64u* const pa_pubz[8],
                                                         int8u* pBuffer))
+
+/*
+// Precomputed table of the signer's public key Q for repeated ECDSA verification.
+// It holds affine points [j]*[2^(W*k)]*Q, j=1,..,2^(W-1), for every W-bit window k of the scalar,
+// so that the verification computes both [h1]*G and [h2]*Q without point doublings.
+*/
+#define MBX_NISTP256_PUBKEY_TABLE_WIN_SIZE  (5)
+#define MBX_NISTP256_PUBKEY_TABLE_LEN64     (52*16*2*5) /* windows * points * (x,y) * 52-bit digits */
+
+typedef struct _mbx_nistp256_pubkey_table {
+   int64u data[MBX_NISTP256_PUBKEY_TABLE_LEN64];
+} mbx_nistp256_pubkey_table;
+
+/*
+// Computes precomputed tables of the public keys
+// pa_table[]        array of pointers to the tables being computed
+// pa_pubx[]         array of pointers to the signer's public keys X-coordinates
+// pa_puby[]         array of pointers to the signer's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the signer's public keys Z-coordinates  (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+//
+// Note:
+// The table is not updated if the public key is not a valid point of the curve.
+*/
+MBXAPI(mbx_status, mbx_nistp256_ecdsa_pubkey_precomp_mb8,(mbx_nistp256_pubkey_table* pa_table[8],
+                                                    const int64u* const pa_pubx[8],
+                                                    const int64u* const pa_puby[8],
+                                                    const int64u* const pa_pubz[8],
+                                                           int8u* pBuffer))
+
+/*
+// Verifies ECDSA signature using precomputed tables of the public keys
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages that have been signed
+// pa_table[]        array of pointers to the signer's public key tables (see mbx_nistp256_ecdsa_pubkey_precomp_mb8)
+// pBuffer           pointer to the scratch buffer
+*/
+MBXAPI(mbx_status, mbx_nistp256_ecdsa_verify_precomp_mb8,(const int8u* const pa_sign_r[8],
+                                                          const int8u* const pa_sign_s[8],
+                                                          const int8u* const pa_msg[8],
+                                                          const mbx_nistp256_pubkey_table* const pa_table[8],
+                                                                 int8u* pBuffer))
+
 /*
 // OpenSSL's specific similar APIs
 */
@@ -110,6 +110,48 @@ MBXAPI(mbx_status, mbx_sm2_ecdsa_verify_mb8,(const int8u* const pa_sign_r[8],
                                             const int64u* const pa_pubz[8],
                                                          int8u* pBuffer))
 
+/*
+// SM2 public key encryption
+// pa_out[]          array of pointers to the ciphertexts C1||C3||C2 (1+32+32 + 32 + msg_len[] bytes)
+// pa_msg[]          array of pointers to the messages are being encrypted
+// msg_len[]         array of messages length
+// pa_eph_skey[]     array of pointers to the ephemeral private keys k
+// pa_pubx[]         array of pointers to the recipient's public keys X-coordinates
+// pa_puby[]         array of pointers to the recipient's public keys Y-coordinates
+// pa_pubz[]         array of pointers to the recipient's public keys Z-coordinates (or NULL, if affine coordinate requested)
+// pBuffer           pointer to the scratch buffer
+//
+// Note:
+// C1 is the uncompressed point 04||x1||y1 = [k]G, C3 = SM3(x2||M||y2) and C2 = M ^ KDF(x2||y2, msg_len)
+// where (x2,y2) = [k]P (GB/T 32918.4-2016, C1||C3||C2 order as ippsGFpECEncryptSM2_Ext).
+*/
+MBXAPI(mbx_status, mbx_sm2_encrypt_mb8,(int8u* pa_out[8],
+                           const int8u* const pa_msg[8],
+                                    const int msg_len[8],
+                          const int64u* const pa_eph_skey[8],
+                          const int64u* const pa_pubx[8],
+                          const int64u* const pa_puby[8],
+                          const int64u* const pa_pubz[8],
+                                       int8u* pBuffer))
+
+/*
+// SM2 public key decryption
+// pa_out[]          array of pointers to the decrypted messages (inp_len[]-97 bytes)
+// pa_inp[]          array of pointers to the ciphertexts C1||C3||C2
+// inp_len[]         array of ciphertexts length
+// pa_skey[]         array of pointers to the recipient's private keys
+// pBuffer           pointer to the scratch buffer
+//
+// Note:
+// MBX_STATUS_SIGNATURE_ERR is set for the buffer if C3 does not match the decrypted message,
+// the message is not released (output is zeroed) in this case.
+*/
+MBXAPI(mbx_status, mbx_sm2_decrypt_mb8,(int8u* pa_out[8],
+                           const int8u* const pa_inp[8],
+                                    const int inp_len[8],
+                          const int64u* const pa_skey[8],
+                                       int8u* pBuffer))
+
 /*
 // OpenSSL's specific similar APIs
 */
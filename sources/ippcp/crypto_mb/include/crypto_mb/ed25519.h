@@ -62,5 +62,28 @@ MBXAPI(mbx_status, mbx_ed25519_verify_mb8,(const ed25519_sign_component* const p
                                            const int8u* const pa_msg[8], const int32u msgLen[8],
                                            const ed25519_public_key* const pa_public_key[8]))
 
+/*
+// Verifies a batch of ed25519 signatures
+// pa_sign_r[]       array of pointers to the r-components of the verified signatures
+// pa_sign_s[]       array of pointers to the s-components of the verified signatures
+// pa_msg[]          array of pointers to the signed messages
+// msgLen[]          array of signed messages lengths
+// pa_public_key[]   array of pointers to the signer's public keys
+// pa_status[]       optional ((num+7)/8 items) statuses of the signatures, status of the i-th one is
+//                   MBX_GET_STS(pa_status[i/8], i%8), unused lanes of the last item are MBX_STATUS_NULL_PARAM_ERR
+// num               number of signatures (length of the arrays above)
+//
+// The whole batch is checked by one randomized multi-scalar multiplication. If the check fails
+// and pa_status is not NULL, the signatures are verified one by one to find invalid ones.
+// Returns MBX_STATUS_OK if all the signatures are valid, MBX_STATUS_SIGNATURE_ERR otherwise.
+//
+// Note: the batch check is cofactored, a signature with R or public key having small order
+// component may be accepted by the batch, although mbx_ed25519_verify_mb8() rejects it.
+*/
+MBXAPI(mbx_status, mbx_ed25519_verify_batch,(const ed25519_sign_component* const pa_sign_r[],
+                                             const ed25519_sign_component* const pa_sign_s[],
+                                             const int8u* const pa_msg[], const int32u msgLen[],
+                                             const ed25519_public_key* const pa_public_key[],
+                                             mbx_status pa_status[], int num))
 
 #endif /* ED25519_H */
@@ -227,6 +227,13 @@ enum FIPS_CRYPTO_MB_FUNC {
   sm4_xts_set_keys_mb16,
   sm4_xts_encrypt_mb16,
   sm4_xts_decrypt_mb16,
+
+  aes_gcm_init_mb16,
+  aes_gcm_update_iv_mb16,
+  aes_gcm_update_aad_mb16,
+  aes_gcm_encrypt_mb16,
+  aes_gcm_decrypt_mb16,
+  aes_gcm_get_tag_mb16,
 };
 
 
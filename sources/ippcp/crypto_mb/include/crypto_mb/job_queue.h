@@ -0,0 +1,124 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef JOB_QUEUE_H
+#define JOB_QUEUE_H
+
+#include <crypto_mb/defs.h>
+#include <crypto_mb/status.h>
+
+/*
+// Job queue
+//
+// Single operations are submitted one at a time (from any thread) and
+// are collected into batches of the corresponding mbx_*_mb8 function.
+// A batch is computed as soon as all 8 lanes are filled, or when the oldest
+// job of a partially filled batch has waited longer than the queue timeout
+// (checked by mbx_job_queue_submit() and mbx_job_queue_poll()).
+//
+// The batch is computed in the thread that completed or flushed it, and
+// the completion callbacks of its jobs are called from that thread.
+*/
+
+/* operations */
+typedef enum {
+   MBX_JOB_RSA_PRIVATE = 1,      /* mbx_rsa_private_mb8          */
+   MBX_JOB_RSA_PRIVATE_CRT,      /* mbx_rsa_private_crt_mb8      */
+   MBX_JOB_NISTP256_ECDSA_SIGN,  /* mbx_nistp256_ecdsa_sign_mb8  */
+   MBX_JOB_NISTP256_ECDH,        /* mbx_nistp256_ecdh_mb8        */
+   MBX_JOB_X25519                /* mbx_x25519_mb8               */
+} MBX_JOB_TYPE;
+
+typedef struct _mbx_job mbx_job;
+
+/* completion callback */
+typedef void (*mbx_job_callback)(mbx_job* pJob, void* pCallbackArg);
+
+/*
+// Job is allocated by the caller and has to stay valid until it is done.
+// The arguments are the same as of the single lane of the mb8 function.
+*/
+struct _mbx_job {
+   MBX_JOB_TYPE type;
+   union {
+      struct {
+         const int8u*  from;
+               int8u*  to;
+         const int64u* d;
+         const int64u* n;
+               int     rsaBitsize;
+      } rsa_private;
+      struct {
+         const int8u*  from;
+               int8u*  to;
+         const int64u* p;
+         const int64u* q;
+         const int64u* dp;
+         const int64u* dq;
+         const int64u* iq;
+               int     rsaBitsize;
+      } rsa_private_crt;
+      struct {
+               int8u*  sign_r;
+               int8u*  sign_s;
+         const int8u*  msg;
+         const int64u* eph_skey;
+         const int64u* reg_skey;
+      } nistp256_ecdsa_sign;
+      struct {
+               int8u*  shared_key;
+         const int64u* skey;
+         const int64u* pubx;
+         const int64u* puby;
+      } nistp256_ecdh;
+      struct {
+               int8u*  shared_key;
+         const int8u*  private_key;
+         const int8u*  public_key;
+      } x25519;
+   } args;
+
+   mbx_job_callback callback;    /* optional, may be NULL */
+   void* pCallbackArg;
+
+   /* MBX_STATUS_xxx of the operation (valid when the job is done) */
+   mbx_status status;
+
+   /* internal, must not be used by the caller */
+   struct {
+      int64u   submitTime;
+      volatile int32u done;
+   } reserved;
+};
+
+typedef struct _mbx_job_queue mbx_job_queue;
+
+/* timeoutUsec is the maximal time (in microseconds) a job waits for the batch to be filled */
+MBXAPI(mbx_job_queue*, mbx_job_queue_create,(int64u timeoutUsec))
+/* flushes pending jobs and releases the queue */
+MBXAPI(void, mbx_job_queue_destroy,(mbx_job_queue* pQueue))
+
+/* returns MBX_STATUS_OK if the job has been queued (and may be already done) */
+MBXAPI(mbx_status, mbx_job_queue_submit,(mbx_job_queue* pQueue, mbx_job* pJob))
+/* computes batches waiting longer than timeout, returns the number of completed jobs */
+MBXAPI(int, mbx_job_queue_poll,(mbx_job_queue* pQueue))
+/* computes all pending batches, returns the number of completed jobs */
+MBXAPI(int, mbx_job_queue_flush,(mbx_job_queue* pQueue))
+
+/* returns non-zero when the job is done and pJob->status is valid */
+MBXAPI(int, mbx_job_is_done,(const mbx_job* pJob))
+
+#endif /* JOB_QUEUE_H */
@@ -56,6 +56,8 @@ MBXAPI(const mbx_RSA_Method*, mbx_RSA1K_pub65537_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA2K_pub65537_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA3K_pub65537_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA4K_pub65537_Method,(void))
+MBXAPI(const mbx_RSA_Method*, mbx_RSA6K_pub65537_Method,(void))
+MBXAPI(const mbx_RSA_Method*, mbx_RSA8K_pub65537_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA_pub65537_Method,(int rsaBitsize))
 
 /* rsa private key operation */
@@ -70,6 +72,8 @@ MBXAPI(const mbx_RSA_Method*, mbx_RSA1K_private_crt_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA2K_private_crt_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA3K_private_crt_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA4K_private_crt_Method,(void))
+MBXAPI(const mbx_RSA_Method*, mbx_RSA6K_private_crt_Method,(void))
+MBXAPI(const mbx_RSA_Method*, mbx_RSA8K_private_crt_Method,(void))
 MBXAPI(const mbx_RSA_Method*, mbx_RSA_private_crt_Method,(int rsaBitsize))
 
 MBXAPI(int, mbx_RSA_Method_BufSize,(const mbx_RSA_Method* m))
@@ -101,4 +105,33 @@ MBXAPI(mbx_status, mbx_rsa_private_crt_mb8,(const int8u* const from_pa[8],
                                    const mbx_RSA_Method* m,
                                                   int8u* pBuffer))
 
+/*
+// Operations over the batch of different modulus sizes
+// rsaBitlen[]       modulus size of each buffer (1024, 2048, 3072, 4096, 6144 or 8192)
+// pBuffer           optional scratch buffer (NULL - allocated internally), shared by all size groups
+//
+// Buffers are grouped by the modulus size, each group is computed by a single mb8 call.
+// Buffer of unsupported size gets MBX_STATUS_MISMATCH_PARAM_ERR status.
+//
+// The same pBuffer is passed to every group's mb8 call, so it must fit the largest group:
+//    mbx_rsa_public_mixed_mb8()      - mbx_RSA_Method_BufSize(mbx_RSA_pub65537_Method(maxBitlen)) bytes
+//    mbx_rsa_private_crt_mixed_mb8() - mbx_RSA_Method_BufSize(mbx_RSA_private_crt_Method(maxBitlen)) bytes
+// where maxBitlen is the largest supported value of rsaBitlen[] in the batch.
+*/
+MBXAPI(mbx_status, mbx_rsa_public_mixed_mb8,(const int8u* const from_pa[8],
+                                                   int8u* const to_pa[8],
+                                            const int64u* const n_pa[8],
+                                               const int rsaBitlen[8],
+                                                   int8u* pBuffer))
+
+MBXAPI(mbx_status, mbx_rsa_private_crt_mixed_mb8,(const int8u* const from_pa[8],
+                                                        int8u* const to_pa[8],
+                                                 const int64u* const p_pa[8],
+                                                 const int64u* const q_pa[8],
+                                                 const int64u* const dp_pa[8],
+                                                 const int64u* const dq_pa[8],
+                                                 const int64u* const iq_pa[8],
+                                                    const int rsaBitlen[8],
+                                                        int8u* pBuffer))
+
 #endif /* RSA_H */
@@ -56,4 +56,48 @@ MBXAPI(mbx_status16, mbx_sm3_msg_digest_mb16,(const int8u* const  msg_pa[16],
                                                               int len[16],
                                                            int8u* hash_pa[16]))
 
+/*
+// HMAC-SM3 context for mb16
+//
+// The SM3 states after the (key ^ ipad) and (key ^ opad) blocks are computed once by
+// mbx_hmac_sm3_init_mb16(); mbx_hmac_sm3_final_mb16() restarts the context from the
+// ipad state, so any number of messages can be processed under the same keys.
+*/
+
+struct _hmac_sm3_context_mb16 {
+    SM3_CTX_mb16    msg_ctx;                                            /*          inner hash of message        */
+    __ALIGN64
+    sm3_hash_mb     ipad_hash;                                          /*        hash of (key ^ ipad) block     */
+    __ALIGN64
+    sm3_hash_mb     opad_hash;                                          /*        hash of (key ^ opad) block     */
+};
+
+typedef struct _hmac_sm3_context_mb16 HMAC_SM3_CTX_mb16;
+
+MBXAPI(mbx_status16, mbx_hmac_sm3_init_mb16,(const int8u* const key_pa[16],
+                                                       const int key_len[16],
+                                              HMAC_SM3_CTX_mb16* p_state))
+
+MBXAPI(mbx_status16, mbx_hmac_sm3_update_mb16,(const int8u* const msg_pa[16],
+                                                              int len[16],
+                                                HMAC_SM3_CTX_mb16* p_state))
+
+MBXAPI(mbx_status16, mbx_hmac_sm3_final_mb16,(int8u* mac_pa[16],
+                                   HMAC_SM3_CTX_mb16* p_state))
+
+MBXAPI(mbx_status16, mbx_hmac_sm3_mb16,(const int8u* const msg_pa[16],
+                                                       int len[16],
+                                        const int8u* const key_pa[16],
+                                                 const int key_len[16],
+                                                    int8u* mac_pa[16]))
+
+/*
+// SM3 key derivation function (GB/T 32918.4-2016, 5.4.3)
+// out = SM3(Z||ct) || SM3(Z||ct+1) || ..., ct = 0x00000001, truncated to out_len[] bytes
+*/
+MBXAPI(mbx_status16, mbx_sm3_kdf_mb16,(int8u* out_pa[16],
+                                   const int out_len[16],
+                         const int8u* const z_pa[16],
+                                  const int z_len[16]))
+
 #endif /* SM3_H */
@@ -98,6 +98,11 @@ __MBX_INLINE mbx_status16 MBX_SET_STS16(mbx_status16 status, int numb, mbx_statu
    return status |= (sttVal & 0xF) << (numb*4);
 }
 
+__MBX_INLINE mbx_status MBX_GET_STS16(mbx_status16 status, int numb)
+{
+   return (mbx_status)((status >> (numb*4)) & 0xF);
+}
+
 __MBX_INLINE mbx_status16 MBX_SET_STS16_BY_MASK(mbx_status16 status, int16u mask, mbx_status16 sttVal)
 {
     int numb;
@@ -0,0 +1,175 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/aes_gcm.h>
+
+/* GHASH kernels and constants are shared with SM4-GCM */
+#include <internal/sm4/sm4_gcm_mb.h>
+
+#ifndef AES_GCM_MB_H
+#define AES_GCM_MB_H
+
+/*
+// Buffers are processed in natural order:
+// 512-bit register number i keeps 128-bit blocks of buffers 4*i, 4*i+1, 4*i+2, 4*i+3.
+// Unlike SM4-GCM no rearrangement of input pointers and lengths is required,
+// because AES is computed on whole 128-bit blocks by VAES instructions.
+*/
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// Encrypt 4 registers (16 blocks of 16 buffers) with the round keys of corresponding buffers
+//
+// RK is a pointer to __m128i[AES_MAX_ROUNDS+1][AES_LINES] key schedule
+*/
+#define AES_ENCRYPT_VAES_MB16(B0, B1, B2, B3, RK, NR)                        \
+   {                                                                         \
+      B0 = _mm512_xor_si512(B0, loadu((RK)[0] + 0));                         \
+      B1 = _mm512_xor_si512(B1, loadu((RK)[0] + 4));                         \
+      B2 = _mm512_xor_si512(B2, loadu((RK)[0] + 8));                         \
+      B3 = _mm512_xor_si512(B3, loadu((RK)[0] + 12));                        \
+      for (int rnd_ = 1; rnd_ < (NR); rnd_++) {                              \
+         B0 = _mm512_aesenc_epi128(B0, loadu((RK)[rnd_] + 0));               \
+         B1 = _mm512_aesenc_epi128(B1, loadu((RK)[rnd_] + 4));               \
+         B2 = _mm512_aesenc_epi128(B2, loadu((RK)[rnd_] + 8));               \
+         B3 = _mm512_aesenc_epi128(B3, loadu((RK)[rnd_] + 12));              \
+      }                                                                      \
+      B0 = _mm512_aesenclast_epi128(B0, loadu((RK)[(NR)] + 0));              \
+      B1 = _mm512_aesenclast_epi128(B1, loadu((RK)[(NR)] + 4));              \
+      B2 = _mm512_aesenclast_epi128(B2, loadu((RK)[(NR)] + 8));              \
+      B3 = _mm512_aesenclast_epi128(B3, loadu((RK)[(NR)] + 12));             \
+   }
+
+/* Transpose 4x4 matrix of 128-bit blocks */
+#define AES_TRANSPOSE_4x4_I128(X0, X1, X2, X3)                        \
+   {                                                                  \
+      __m512i T0_ = _mm512_shuffle_i64x2(X0, X1, 0b01000100);         \
+      __m512i T1_ = _mm512_shuffle_i64x2(X2, X3, 0b01000100);         \
+      __m512i T2_ = _mm512_shuffle_i64x2(X0, X1, 0b11101110);         \
+      __m512i T3_ = _mm512_shuffle_i64x2(X2, X3, 0b11101110);         \
+                                                                      \
+      X0 = _mm512_shuffle_i64x2(T0_, T1_, 0b10001000);                \
+      X1 = _mm512_shuffle_i64x2(T0_, T1_, 0b11011101);                \
+      X2 = _mm512_shuffle_i64x2(T2_, T3_, 0b10001000);                \
+      X3 = _mm512_shuffle_i64x2(T2_, T3_, 0b11011101);                \
+   }
+
+/*
+// Internal functions
+*/
+
+EXTERN_C void aes_set_round_keys_mb16(__m128i key_sched[AES_MAX_ROUNDS + 1][AES_LINES],
+                                      const int8u *const pa_key[AES_LINES],
+                                      int key_len,
+                                      __mmask16 mb_mask);
+
+EXTERN_C void aes_gcm_precompute_hashkey_mb16(AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C __mmask16 aes_gcm_update_iv_mb16(const int8u *const pa_iv[AES_LINES],
+                                          const int iv_len[AES_LINES],
+                                          __mmask16 mb_mask,
+                                          AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C void aes_gcm_finalize_iv_mb16(const int8u *const pa_iv[AES_LINES], __mmask16 mb_mask, AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C __mmask16 aes_gcm_update_aad_mb16(const int8u *const pa_aad[AES_LINES],
+                                           const int aad_len[AES_LINES],
+                                           __mmask16 mb_mask,
+                                           AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C void aes_gctr_kernel_mb16(int8u *pa_out[AES_LINES],
+                                   const int8u *const pa_inp[AES_LINES],
+                                   const int len[AES_LINES],
+                                   __mmask16 mb_mask,
+                                   AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C __mmask16 aes_gcm_encrypt_mb16(int8u *pa_out[AES_LINES],
+                                        const int8u *const pa_in[AES_LINES],
+                                        const int in_len[AES_LINES],
+                                        __mmask16 mb_mask,
+                                        AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C __mmask16 aes_gcm_decrypt_mb16(int8u *pa_out[AES_LINES],
+                                        const int8u *const pa_in[AES_LINES],
+                                        const int in_len[AES_LINES],
+                                        __mmask16 mb_mask,
+                                        AES_GCM_CTX_mb16 *p_context);
+
+EXTERN_C mbx_status16 aes_gcm_get_tag_mb16(int8u *pa_out[AES_LINES], const int tag_len[AES_LINES], __mmask16 mb_mask, AES_GCM_CTX_mb16 *p_context);
+
+mbx_status16 internal_avx512_aes_gcm_init_mb16(const int8u *const pa_key[AES_LINES],
+                                               const int key_len,
+                                               const int8u *const pa_iv[AES_LINES],
+                                               const int iv_len[AES_LINES],
+                                               AES_GCM_CTX_mb16 *p_context,
+                                               __mmask16 mb_mask_iv,
+                                               __mmask16 mb_mask);
+
+/* Expand 16-bit buffers mask to 8-bit mask of 64-bit words for register number i */
+__MBX_INLINE __mmask8 aes_gcm_qword_mask(__mmask16 mb_mask, int i)
+{
+   return (__mmask8)(0x03 * (0x1 & ((mb_mask >> i * 4) >> 0)) | 0x0C * (0x1 & ((mb_mask >> i * 4) >> 1)) |
+                     0x30 * (0x1 & ((mb_mask >> i * 4) >> 2)) | 0xC0 * (0x1 & ((mb_mask >> i * 4) >> 3)));
+}
+
+/*
+// Update TXT or AAD length accumulated in context:
+// len_pos = 0 - TXT length (low 64 bits of length block), len_pos = 1 - AAD length (high 64 bits of length block)
+// Function returns mask where bit is set to 1 if accumulated length is greater than max_len
+*/
+__MBX_INLINE __mmask16 aes_gcm_update_len_mb16(int64u *p_len, const int len[AES_LINES], int len_pos, int64u max_len)
+{
+   __mmask16 overflow_mask = 0;
+
+   for (int i = 0; i < 4; i++) {
+      __m512i len_update  = _mm512_maskz_expandloadu_epi32((__mmask16)(0x1111 << (2 * len_pos)), (void *)(len + i * 4));
+      __m512i len_context = loadu(BUFFER_REG_NUM(p_len, i));
+
+      len_context = add_epi64(len_context, len_update);
+      storeu(BUFFER_REG_NUM(p_len, i), len_context);
+
+      __mmask8 overflow_mask_part = cmp_epi64_mask(set1_epi64((long long)max_len), len_context, _MM_CMPINT_LT) >> len_pos;
+
+      overflow_mask_part =
+         (overflow_mask_part & 0x01) | (overflow_mask_part & 0x04) >> 1 | (overflow_mask_part & 0x10) >> 2 | (overflow_mask_part & 0x40) >> 3;
+      overflow_mask = overflow_mask | overflow_mask_part << (i * 4);
+   }
+
+   return overflow_mask;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+/* Context accessors */
+
+#define AES_GCM_CONTEXT_HASHKEY(context) ((context)->hashkey)
+#define AES_GCM_CONTEXT_J0(context) ((context)->j0)
+#define AES_GCM_CONTEXT_GHASH(context) ((context)->ghash)
+#define AES_GCM_CONTEXT_CTR(context) ((context)->ctr)
+
+#define AES_GCM_CONTEXT_LEN(context) ((context)->len)
+
+#define AES_GCM_CONTEXT_KEY(context) ((context)->key_sched)
+#define AES_GCM_CONTEXT_ROUNDS(context) ((context)->num_rounds)
+
+#define AES_GCM_CONTEXT_STATE(context) ((context)->state)
+
+/* Position of TXT and AAD lengths of buffer buf_no in the AES_GCM_CONTEXT_LEN(context) array */
+#define AES_GCM_TXT_LEN_POS(buf_no) (2 * (buf_no) + 0)
+#define AES_GCM_AAD_LEN_POS(buf_no) (2 * (buf_no) + 1)
+
+#endif /* AES_GCM_MB_H */
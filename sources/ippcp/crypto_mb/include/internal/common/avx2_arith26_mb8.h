@@ -0,0 +1,107 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef AVX2_ARITH26_MB8_H
+#define AVX2_ARITH26_MB8_H
+
+#include <crypto_mb/defs.h>
+#include <internal/common/ifma_defs.h>
+
+#if (_MBX==_MBX_L9)
+
+/*
+// AVX2 multi-buffer arithmetic
+//
+// Numbers are kept in radix 2^26 and stored in the same transposed form
+// as the IFMA code uses: x[i][n] is the i-th digit of the n-th buffer.
+// Each digit row holds 8 lanes, processed as two halves of 4 lanes
+// by _mm256_mul_epu32.
+//
+// Montgomery multiplication is "almost" Montgomery: for operands
+// in [0, 2m) the result is in [0, 2m) as long as R = 2^(26*len) > 4m.
+*/
+#define DIGIT_SIZE_26   (26)
+#define DIGIT_MASK_26   ((int64u)0x3FFFFFF)
+
+/* number of radix 2^26 digits to handle modulus of "bitsize" bits */
+#define LEN26(bitsize)  (NUMBER_OF_DIGITS((bitsize)+2, DIGIT_SIZE_26))
+
+/* max number of digits (RSA-8192 modulus) */
+#define MAX_LEN26       (LEN26(IFMA_MAX_BITSIZE))
+
+/* exponentiation window size */
+#define EXP_WIN_SIZE_26 (5)
+
+/* size (in int64u[8] rows) of the scratch used by avx2_modexp26_mb8() */
+#define MODEXP26_BUFF_ROWS(len)  (((1<<EXP_WIN_SIZE_26)+1)*(len))
+
+EXTERN_C void avx2_zero26_mb8(int64u r[][8], int len);
+EXTERN_C void avx2_copy26_mb8(int64u r[][8], const int64u a[][8], int len);
+EXTERN_C void avx2_set26_mb8(int64u r[][8], int64u val, int len);
+EXTERN_C void avx2_mask_mov26_mb8(int64u r[][8], const int64u a[][8], int8u mask, int len);
+EXTERN_C void avx2_cswap26_mb8(int64u a[][8], int64u b[][8], const int64u swap[8], int len);
+
+/* conversions (NULL pointers are treated as zero input / skipped output) */
+EXTERN_C void avx2_BNU_to_mb8_26(int64u r[][8], const int64u* const pa[8], int bitLen, int len);
+EXTERN_C void avx2_HexStr8_to_mb8_26(int64u r[][8], const int8u* const pa[8], int bitLen, int len);
+EXTERN_C void avx2_mb8_26_to_BNU(int64u* const pa[8], const int64u a[][8], int bitLen);
+EXTERN_C void avx2_mb8_26_to_HexStr8(int8u* const pa[8], const int64u a[][8], int bitLen);
+EXTERN_C void avx2_BNU_transpose_copy(int64u r[][8], const int64u* const pa[8], int bitLen);
+EXTERN_C void avx2_const_to_mb8_26(int64u r[][8], const int64u* c, int bitLen, int len);
+
+/* comparisons (lane masks) */
+EXTERN_C int8u avx2_is_zero26_mb8(const int64u a[][8], int len);
+EXTERN_C int8u avx2_cmp_eq26_mb8(const int64u a[][8], const int64u b[][8], int len);
+EXTERN_C int8u avx2_cmp_lt26_mb8(const int64u a[][8], const int64u b[][8], int len);
+
+/* Montgomery arithmetic */
+EXTERN_C void avx2_montFactor26_mb8(int64u k0[8], const int64u m[][8]);
+EXTERN_C void avx2_montRR26_mb8(int64u rr[][8], const int64u m[][8], const int64u k0[8], int len);
+EXTERN_C void avx2_amm26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8],
+                             const int64u m[][8], const int64u k0[8], int len);
+EXTERN_C void avx2_amred26_mb8(int64u r[][8], const int64u a[][8],
+                               const int64u m[][8], const int64u k0[8], int len);
+EXTERN_C void avx2_mont_mul26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8],
+                                  const int64u m[][8], const int64u k0[8], int len);
+EXTERN_C void avx2_to_mont26_mb8(int64u r[][8], const int64u a[][8], const int64u rr[][8],
+                                 const int64u m[][8], const int64u k0[8], int len);
+EXTERN_C void avx2_from_mont26_mb8(int64u r[][8], const int64u a[][8],
+                                   const int64u m[][8], const int64u k0[8], int len);
+
+/* modular add/sub, operands in [0, m) */
+EXTERN_C void avx2_reduce26_mb8(int64u r[][8], const int64u a[][8], const int64u m[][8], int len);
+EXTERN_C void avx2_add26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8], const int64u m[][8], int len);
+EXTERN_C void avx2_sub26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8], const int64u m[][8], int len);
+
+/* r[2*len] += a[len]*b[len] */
+EXTERN_C void avx2_addmul26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8], int len);
+
+/* r = base^exp mod m, base and result in regular domain */
+EXTERN_C void avx2_modexp26_mb8(int64u r[][8], const int64u base[][8],
+                                const int64u exp[][8], int expBitLen,
+                                const int64u m[][8], const int64u rr[][8], const int64u k0[8],
+                                int len, int64u buffer[][8]);
+/* r = base^65537 mod m */
+EXTERN_C void avx2_modexp26_65537_mb8(int64u r[][8], const int64u base[][8],
+                                      const int64u m[][8], const int64u rr[][8], const int64u k0[8],
+                                      int len, int64u buffer[][8]);
+/* r = a^exp mod m for exponent common for all lanes; a and r in Montgomery domain */
+EXTERN_C void avx2_mont_pow26_mb8(int64u r[][8], const int64u a[][8], const int64u* exp, int expBitLen,
+                                  const int64u m[][8], const int64u k0[8], int len);
+
+#endif /* #if (_MBX==_MBX_L9) */
+
+#endif /* AVX2_ARITH26_MB8_H */
@@ -58,7 +58,7 @@
 #define SIMD_TYPE(LEN) typedef __m ## LEN ## i U64;
 
 /* max internal data bitsize */
-#define IFMA_MAX_BITSIZE   (4096)
+#define IFMA_MAX_BITSIZE   (8192)
 
 /* internal radix definition */
 #define DIGIT_SIZE (52)
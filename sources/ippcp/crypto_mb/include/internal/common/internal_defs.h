@@ -50,6 +50,7 @@
 #define _MBX_K1 4096
 
 #if defined( _L9 ) || (_K1)
+   #include "aes_gcm_cpuspc.h"
    #include "ec_nistp256_cpuspc.h"
    #include "ec_nistp384_cpuspc.h"
    #include "ec_nistp521_cpuspc.h"
@@ -18,6 +18,7 @@
 #define IFMA_ECPOINT_P256_H
 
 #include "crypto_mb/status.h"
+#include <crypto_mb/ec_nistp256.h>
 #include <internal/ecnist/ifma_arith_p256.h>
 
 #ifndef BN_OPENSSL_DISABLE
@@ -46,6 +47,11 @@ typedef struct {
    int64u y[P256_LEN52];
 } SINGLE_P256_POINT_AFFINE;
 
+/* per public key precomputed tables (mbx_nistp256_pubkey_table) */
+#define PK_WIN_SIZE  MBX_NISTP256_PUBKEY_TABLE_WIN_SIZE
+#define PK_N_SLOTS   NUMBER_OF_DIGITS(P256_BITSIZE+1, PK_WIN_SIZE)
+#define PK_N_ENTRY   (1<<(PK_WIN_SIZE-1))
+
 
 /* check if coordinate is zero */
 __MBX_INLINE __mb_mask MB_FUNC_NAME(is_zero_point_cordinate_)(const U64 T[])
@@ -97,6 +103,8 @@ EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(P256_POINT* r, const P25
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_add_point_affine_)(P256_POINT* r, const P256_POINT* p, const P256_POINT_AFFINE* q);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(P256_POINT* r, const P256_POINT* p, const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(P256_POINT* r, const U64* scalar);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_precomp_point_tbl_)(SINGLE_P256_POINT_AFFINE* const pa_tbl[8], const P256_POINT* p, __mb_mask mask);
+EXTERN_C void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_tbl_)(P256_POINT* r, const SINGLE_P256_POINT_AFFINE* const pa_tbl[8], const U64* scalar);
 EXTERN_C void MB_FUNC_NAME(get_nistp256_ec_affine_coords_)(U64 x[], U64 y[], const P256_POINT* P);
 EXTERN_C const U64* MB_FUNC_NAME(ifma_ec_nistp256_coord_one_)(void);
 EXTERN_C __mb_mask MB_FUNC_NAME(ifma_is_on_curve_p256_)(const P256_POINT* p, int use_jproj_coords);
@@ -181,6 +189,18 @@ mbx_status internal_avx512_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_
                                                      const int64u* const pa_pubz[8],                                       
                                                int8u* pBuffer, int use_jproj_coords);
 
+mbx_status internal_avx512_nistp256_ecdsa_verify_precomp_mb8(const int8u* const pa_sign_r[8],
+                                                             const int8u* const pa_sign_s[8],
+                                                             const int8u* const pa_msg[8],
+                                                             const mbx_nistp256_pubkey_table* const pa_table[8],
+                                                                   int8u* pBuffer);
+
+mbx_status internal_avx512_nistp256_ecdsa_pubkey_precomp_mb8(mbx_nistp256_pubkey_table* pa_table[8],
+                                                       const int64u* const pa_pubx[8],
+                                                       const int64u* const pa_puby[8],
+                                                       const int64u* const pa_pubz[8],
+                                                             int8u* pBuffer, int use_jproj_coords);
+
 mbx_status internal_avx512_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
                                                      int64u* pa_puby[8],
                                                      int64u* pa_pubz[8],
@@ -189,4 +209,50 @@ mbx_status internal_avx512_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
 
 #endif /* #if (_MBX>=_MBX_K1) */
 
+#if (_MBX==_MBX_L9)
+
+/* AVX2 (radix 2^26) P-256 kernels */
+mbx_status internal_avx2_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                                     const int64u* const pa_skey[8],
+                                     const int64u* const pa_pubx[8],
+                                     const int64u* const pa_puby[8],
+                                     const int64u* const pa_pubz[8],
+                                     int8u* pBuffer, int use_jproj_coords);
+
+mbx_status internal_avx2_nistp256_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
+                                                       int64u* pa_sign_rp[8],
+                                                 const int64u* const pa_eph_skey[8],
+                                                       int8u* pBuffer);
+
+mbx_status internal_avx2_nistp256_ecdsa_sign_complete_mb8(int8u* pa_sign_r[8],
+                                                          int8u* pa_sign_s[8],
+                                                    const int8u* const pa_msg[8],
+                                                    const int64u* const pa_sign_rp[8],
+                                                    const int64u* const pa_inv_eph_skey[8],
+                                                    const int64u* const pa_reg_skey[8],
+                                                          int8u* pBuffer);
+
+mbx_status internal_avx2_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                                 int8u* pa_sign_s[8],
+                                           const int8u* const pa_msg[8],
+                                           const int64u* const pa_eph_skey[8],
+                                           const int64u* const pa_reg_skey[8],
+                                                 int8u* pBuffer);
+
+mbx_status internal_avx2_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                                   const int8u* const pa_sign_s[8],
+                                                   const int8u* const pa_msg[8],
+                                                   const int64u* const pa_pubx[8],
+                                                   const int64u* const pa_puby[8],
+                                                   const int64u* const pa_pubz[8],
+                                                         int8u* pBuffer, int use_jproj_coords);
+
+mbx_status internal_avx2_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                                   int64u* pa_puby[8],
+                                                   int64u* pa_pubz[8],
+                                             const int64u* const pa_skey[8],
+                                                   int8u* pBuffer, int use_jproj_coords);
+
+#endif /* #if (_MBX==_MBX_L9) */
+
 #endif /* IFMA_ECPOINT_P256_H */
@@ -19,6 +19,8 @@
 
 #include <crypto_mb/ed25519.h>
 #include <internal/ed25519/ifma_arith_p25519.h>
+#include <internal/ed25519/ifma_arith_n25519.h>
+#include <internal/ed25519/ifma_ed25519_basepoint.h>
 
 #if (_MBX>=_MBX_K1)
 
@@ -155,8 +157,16 @@ void ifma_ed25519_mul_basepoint(ge52_ext_mb* r, const U64 scalar[]);
 void ifma_ed25519_mul_point(ge52_ext_mb* r, const ge52_ext_mb* p, const U64 scalar[]);
 void ifma_ed25519_prod_point(ge52_ext_mb* r, const ge52_ext_mb* p, const U64 scalarP[], const U64 scalarG[]);
 
+/* multi-scalar multiplication */
+#define ED25519_MSM_MAX_WIN      (8)
+#define ED25519_MSM_MAX_BUCKETS  (1 << (ED25519_MSM_MAX_WIN-1))
+void ifma_ed25519_multi_mul_point(ge52_ext_mb* r, const ge52_cached_mb p[], const U64 scalar[][NE_LEN64+1], const int bitsize[], int num, ge52_ext_mb buckets[]);
+
 void ge52_ext_compress(fe52_mb fe, const ge52_ext_mb* p);
 __mb_mask ge52_ext_decompress(ge52_ext_mb* p, const fe52_mb fe);
+void ge52_ext_to_cached(ge52_cached_mb* r, const ge52_ext_mb* p);
+void ge52_ext_add(ge52_ext_mb* r, const ge52_ext_mb* p, const ge52_ext_mb* q);
+void ge52_ext_dbl_n(ge52_ext_mb* r, const ge52_ext_mb* p, int n);
 
 mbx_status MB_FUNC_NAME(internal_avx512_ed25519_public_key_)(ed25519_public_key* pa_public_key[8],
                                                const ed25519_private_key* const pa_private_key[8]);
@@ -172,6 +182,17 @@ mbx_status MB_FUNC_NAME(internal_avx512_ed25519_verify_)(const ed25519_sign_comp
                                                          const int8u* const pa_msg[8], const int32u msgLen[8],
                                                          const ed25519_public_key* const pa_public_key[8]);
 
+/* max number of 8-signature groups verified by the single multi-scalar multiplication */
+#define ED25519_BATCH_MAX_GROUPS  (256)
+
+int ed25519_verify_batch_buffsize(int numGroups);
+mbx_status internal_avx512_ed25519_verify_batch(const ed25519_sign_component* const pa_sign_r[],
+                                                const ed25519_sign_component* const pa_sign_s[],
+                                                const int8u* const pa_msg[], const int32u msgLen[],
+                                                const ed25519_public_key* const pa_public_key[],
+                                                mbx_status pa_status[], int num,
+                                                int8u* pBuffer, int numGroups);
+
 #endif /* #if (_MBX>=_MBX_K1) */ 
 
 #endif /* IFMA_ED25519_H */
@@ -0,0 +1,38 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+// Fixed-base multiplication of the Ed25519 base point shared with x25519.
+// Kept apart from ifma_arith_ed25519.h, whose field arithmetic names clash
+// with the x25519 implementation.
+*/
+
+#ifndef IFMA_ED25519_BASEPOINT_H
+#define IFMA_ED25519_BASEPOINT_H
+
+#include <internal/common/ifma_defs.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* number of 52-bit digits of GF(2^255-19) element, the same as FE_LEN52 */
+#define ED25519_BASEPOINT_LEN52 (5)
+
+/* u = [scalar]*G in Curve25519 Montgomery form (u is a fe52_mb element) */
+void ifma_ed25519_mul_basepoint_u(U64 u[ED25519_BASEPOINT_LEN52], const U64 scalar[]);
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* IFMA_ED25519_BASEPOINT_H */
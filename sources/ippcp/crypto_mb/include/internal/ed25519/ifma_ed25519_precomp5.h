@@ -0,0 +1,502 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IFMA_ED25519_PRECOMP5_H
+#define IFMA_ED25519_PRECOMP5_H
+
+#include <internal/ed25519/ifma_arith_ed25519.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define MUL_BASEPOINT_WIN_SIZE (5)
+
+#define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE
+#define BP_N_ENTRY (1<<(BP_WIN_SIZE-1))
+
+__ALIGN64 static ge52_precomp ifma_ed25519_bp_precomp[][BP_N_ENTRY] = {
+{ /* slot=0 [{1,2,3,..,16} * 32^(2*0)] * G) */
+{{0x00003905d740913e,0x00005d140beb39d1,0x00088f8a09fd399f,0x0001267a5c184346,0x000044fd2f9298f8}, {0x000c93c6f58c3b85,0x000c6fb8c0e192fb,0x00043d42c2cf932d,0x000ba65270b48986,0x000007cf9d3a33d4}, {0x00091205877aaa68,0x00023ccaac49eabc,0x000d43598c26d9e8,0x00065a85a1b7dcbd,0x00006f117b689f0c}},
+{{0x0009a56042b4d5a8,0x0000c4e60acf68a9,0x00016e37aa8f2b81,0x0002555e09e236bb,0x00006bb595a669c9}, {0x0004e7fc933c71d7,0x000967a0ff5b5922,0x0001d607029f469d,0x0002e2e5aa69a65e,0x0000590c063fa87d}, {0x000aa8b3a59b7a5f,0x000dd5d9acf7843f,0x000b3d6a3136c16b,0x0000b73500fa0840,0x0000701af5b13ea5}},
+{{0x00011fe8a4fcd265,0x000fde5c1ba7d566,0x00014bd6bd3bd353,0x000da628131f31a2,0x00002ab91587555b}, {0x0005b0a84cee9730,0x00030e8864b8aaf2,0x000f016732025a84,0x000f8f4c11b50029,0x00007a164e1b9a80}, {0x000e933f0dd0d889,0x000221c35da6214a,0x000cf2db4c589423,0x000b4c6d170e5458,0x00005a2826af12b9}},
+{{0x000e050a056818bf,0x000715660faa995f,0x0006a05073327e89,0x000a49ac3e8e3cd0,0x000027933f4c7445}, {0x000351b98efc099f,0x000f47dfd2538287,0x000b0a92656765c6,0x0008727ca348d3df,0x0000680e910321e5}, {0x0003fbe9c476ff09,0x000457b5cc1725a1,0x00002b44946e9e39,0x0003e2b5ddbdcf91,0x00007f9d0cbf6355}},
+{{0x000182c3a447d6ba,0x000d14b2729b77f9,0x000864a087d50014,0x00055f3e33cf11cb,0x0000154a7e73eb1b}, {0x0002bc4408a5bb33,0x000c3c75eed02a21,0x000abfec448d5048,0x00006ebdd1beb0c5,0x00002945ccf146e2}, {0x000bdbf1812a8285,0x00007d0bdd1fcbcb,0x000bbda72d270e08,0x000b69ab41b670b1,0x000043aabe696b3b}},
+{{0x000806b67b7d8ca4,0x0008427d22739499,0x00004553b9575be2,0x0007884bb085ce72,0x000038b64c41ae41}, {0x000ceeeb77157131,0x0008900c8af883a0,0x000a59a7369b2715,0x00038bd8065b668d,0x000051e57bb6a2cc}, {0x000c326702ea4b71,0x0000341a1bb0185a,0x00083bc144be70e0,0x00061e353e4a24b0,0x000010b8e91a9f0d}},
+{{0x000f2c9aaa3221b1,0x000533bba23a7ba6,0x0002192c3a6ca021,0x00017e09dea764f9,0x00001d6edd5d2e53}, {0x000a5cd0944ea3bf,0x0003ab39dc0d26b1,0x0008542e49747035,0x000927e71b252822,0x0000461bea69283c}, {0x00036dc801b8b3a2,0x00047053ea49af18,0x000877adf3b3035f,0x00090a7529c41ba5,0x00007a9fbb1c6a0f}},
+{{0x00075dedf39234d9,0x00080e1b558f9e2a,0x000e3c23fb963d76,0x00001c32c2741ac6,0x00003a9024a1320e}, {0x0007596604dd3e8f,0x00077e288702c59b,0x000ed9c3236cb303,0x000e52fb1339c665,0x00000915e76061bc}, {0x0001f5d9c9a2911a,0x000788bcca7d7e7c,0x000eb62a32b8a371,0x0004e95636412190,0x000026907c5c2ecc}},
+{{0x000e217e039d8064,0x000b6f520419bf36,0x00075eb04498a081,0x0009c8f96cbc608e,0x000049c05a51fadc}, {0x000e678aa6a8632f,0x0006f51bc46c59b2,0x000686f5b5a6509e,0x0007f59ceb233c9c,0x000034b9ed338add}, {0x0004e8bf9045af1b,0x000e8a719d22f06b,0x0003d4cf16e2ff83,0x0008b06aaf6fc299,0x000073c172021b00}},
+{{0x0003558e227081dd,0x0003665a9f02f75f,0x0005dc395804f818,0x000b70284739745f,0x00000353832c4950}, {0x000d93d2b360748e,0x000d41617e057ff1,0x000b55464645f534,0x00091ed0d5503639,0x000043ac7628aae5}, {0x000d2ae403d0f8d8,0x000cbd3f06340d03,0x000731b5091d0c1c,0x0004ce7ff169f0f6,0x00000ec62af470bf}},
+{{0x000f5b0249864348,0x0006977088381315,0x000a8deb953ed6b3,0x000c77fa3a075556,0x000018ab598029d5}, {0x000f00848a802ade,0x000cf02302e272fb,0x0007703406e5d9fe,0x0008faf113e84711,0x00004275aae2546d}, {0x000b2cc5fd6089e9,0x000a13282e4a4d82,0x00051a8622031eb4,0x000f94844311199b,0x00003dc65522b53d}},
+{{0x000f8375b53d54b9,0x00090ccb25b24856,0x0006d5dbdd23b2bf,0x00022ed884dfb6e5,0x00007956ece28a60}, {0x00058042a71e7539,0x000d7d834d1a9e23,0x00001a6f9388de3d,0x000dd5845ecdd2e7,0x0000078aafde8d3c}, {0x000594d87f944553,0x00023a24e180beea,0x0004976461f66cda,0x000d0c6ffcb589af,0x000037c6a5151c83}},
+{{0x000f013b327fbf93,0x000c99b776f6b506,0x000aad5968aefceb,0x00024a79d12b232a,0x00000267882d1760}, {0x0000c222a2007f6d,0x0009ab5bcdedbbf7,0x000b07ba07bf84b3,0x000f241537a0e12f,0x0000234fd7eec346}, {0x0000a119732ea378,0x000b1df8dd471536,0x0001a7e5332437e6,0x0007863a2ef37f89,0x0000497ba6fdaa09}},
+{{0x000b8a44d4171280,0x0000fdb7ca331dfd,0x000eec47a9ce69b2,0x00080d2112e56f16,0x00002df0ea2c5b3c}, {0x000870ec3f213df2,0x000c057efa98726f,0x000881bdd580277f,0x00016301a474c042,0x00006eaf60b2464d}, {0x0001c5877a1e1b82,0x000eda2a9bf5496a,0x000ecb1baaf02397,0x0009c939c1fdf703,0x000024bf7e3cd8ba}},
+{{0x000bcd86468ccf0b,0x000a42a9910d6040,0x0007b25192d3829b,0x0005ebf750830080,0x000043b5cd4218d0}, {0x000ecc0313cfeaa0,0x0008d189c246d24c,0x0001f2d4d08648c2,0x000e72b2dbdbdfac,0x000061e22917f12d}, {0x000a762f9bd0b516,0x0004e373fdeee5d9,0x0003d64270eb38af,0x000d842032e5a7d9,0x0000511d61210ae4}},
+{{0x000851ca553e2df3,0x000cba64878b37ec,0x000288d1e7a71284,0x0008883e6b5e4193,0x00004cf210ec5a9a}, {0x000d04a52d9021f6,0x0003375c6bf9c322,0x0002d20b09b9c19f,0x000fe61587a3a434,0x0000143b1cf8aa64}, {0x00067c7d968acaab,0x0008e270927299f8,0x000a1809755f5425,0x00026e1d0a7d34be,0x000021b546a33741}},
+},
+{ /* slot=1 [{1,2,3,..,16} * 32^(2*1)] * G) */
+{{0x00037b8497dd95c2,0x00030aa4eb5a7ff4,0x000c85e88b6c744e,0x00081739e0c5d613,0x00002fd9c71e5f75}, {0x00070b2f4e71ecb8,0x000b940a477e321e,0x000e1d4f80e656dd,0x0007b7ebf6556cec,0x000005fc3bc4535d}, {0x0008b3ae52afdedd,0x0008ced3b30cf24b,0x0009be8195349563,0x0001f0433a4bc83a,0x0000373767475c65}},
+{{0x000d58a649fe1e44,0x000a231ad777e644,0x00087fd0d221fcae,0x00011f302441c5a8,0x00004901aa7183c5}, {0x0002d29dc4244e45,0x0007493d8de0a3df,0x00020c214d2b020e,0x000b90a6cc8067e8,0x0000413779166fea}, {0x0001b7548c1af8f0,0x0007c246299b408b,0x000e06d939ce0f7a,0x0001213f760b0f91,0x000041bb887b726d}},
+{{0x000060e0cdbe51bc,0x0005bfc7364047b9,0x000c446580534055,0x0001d2116b4ede8f,0x0000472f669da096}, {0x0002a86a2b59fca3,0x000bfa3e3cbeed24,0x00084952a29d8d3c,0x000d2cb2dbcd5142,0x000049618ce3a351}, {0x000fe154241f9049,0x00089a9720924ee8,0x000e00650ad0d438,0x0008a3ef6518b654,0x00003508cfa3a6b2}},
+{{0x0007806c567c49d8,0x000ccca791e6a926,0x0003cc394b066d04,0x0008cd2a69f5645e,0x00005c95b686a078}, {0x000980e0aa39f7d2,0x0004252c6b51c97d,0x0007cd55aa35d038,0x000c3627d43f4930,0x000056bd36cfb78a}, {0x000519c10d14a954,0x000b494b5fa902ac,0x0009f87a5aeaf474,0x000e094e6af8382a,0x00000dea6db1879b}},
+{{0x0000b74116de4654,0x000a8a643a9955f0,0x0009699fbb33168e,0x0007769636d92889,0x000038aab9193a59}, {0x0000db1f065b2938,0x000ea31e97327e9c,0x0008300f96dc890d,0x0000f7371d7581bc,0x00007780c78c3a6b}, {0x0001ae23f8673711,0x000675bacf1bee05,0x0001945044539fd4,0x0006b5c50671c7a1,0x00000c247fb289f4}},
+{{0x0004107556d2cfaa,0x00018e07962809c7,0x000ade8acb971ba9,0x0006aa137b654c7e,0x0000661bc5c81634}, {0x000a8bce88173ec9,0x00021c43e04982fa,0x000f3ce5476e1762,0x000ee05ea851ed5b,0x00005c0b0f37211b}, {0x000a734ef8f66149,0x00020ad20dfb37e1,0x000207e1d3e4a984,0x00007189bba01792,0x00004cfb400c9b34}},
+{{0x000627fbda02d79a,0x00037198283d0df4,0x000f0bf8fb025c57,0x000cbdb873aec6bc,0x00005fa64e9f2656}, {0x00077ba4efa57b33,0x000c72f747facc9d,0x000ae12f03e4c4ab,0x00092285df70cc0e,0x00002203d9cc2048}, {0x000caeb4663724ce,0x000bb73e82d2641f,0x000de4b5d7f8493a,0x000d7c53e1a80b95,0x000025f4279bed4b}},
+{{0x0006bf547344e5ab,0x000888f1b4309aa6,0x000d564b2fda1258,0x000b1dd5e87d2b3f,0x00005b2c78885483}, {0x000aeb74d6a8797a,0x000f1fac4173215b,0x000c8b05c57ef55c,0x000ccfb29001f5a3,0x00000ad7cc8752ea}, {0x00051362793408cf,0x0000319963d94521,0x00083d9466eb0f17,0x0003c78a833b2fa8,0x0000093a7fa77500}},
+{{0x000a0251b40278a2,0x000555d36bc68bcc,0x000d063e08b03a5c,0x0000367df64c67d0,0x00003f58dcf44f6f}, {0x0001784169242c10,0x000d3dedf69dd6e3,0x0004a1aa85963829,0x00060025d4d5bec6,0x00002f4fa5661176}, {0x00036225f142f058,0x000bcc4bf2b6615c,0x000d6d5d432f254a,0x000412f9ff466456,0x000028cebade6b46}},
+{{0x000f4e76f3ea260a,0x0005dbebd3efd5af,0x0004dfce81baaa72,0x000e6de58bab970e,0x0000645f15742a65}, {0x0009d7e292980e5d,0x000d3a7d666538b9,0x0000f126002ebf0e,0x000530a99967b1a5,0x000073a1354b7434}, {0x000f0e4f31ce8302,0x00028c5f2a53ee6c,0x000cdbd40056da9b,0x0003391e80380fc5,0x00003c9d24ff455a}},
+{{0x000e7e388988c89c,0x0009db6dd126736d,0x000dc6bc3fe4ea2e,0x0000f9c3d1efa102,0x0000298463c75b7d}, {0x000a6c89b9b4fed3,0x00048c0bcb9ce09d,0x0009270fc90c13a9,0x000a07642ae102d7,0x00003e8489ba3175}, {0x000dc4a75e965c7b,0x0001cd7f7e2ff000,0x0000c63470c25355,0x00045c875af2ac59,0x00001cda5f8fa03d}},
+{{0x00007de63a16d7be,0x000dc9af332cfe51,0x00040b677fa377ff,0x000140370d5bf184,0x00006a252b19a4a3}, {0x0009604460a91286,0x000047778d3deb8e,0x000f8a5e2d7f3fd8,0x000653e67d01e31b,0x00007b038a06c27b}, {0x000919d5d36990f3,0x000bbdb4eb9f29ed,0x000cb991355213ae,0x0000e56c708ea054,0x000058ded57f7226}},
+{{0x000a4ace789b612e,0x000cffd0fe4f0b9a,0x000623834427e0af,0x000ffe24c5032914,0x00000f87d0692dbc}, {0x00026dccbe0b91fc,0x000dafae350cd528,0x000fe23927420b20,0x000832855446e016,0x00001602710fb37d}, {0x00042c2c0741bdf8,0x000f0e7a5b3f0d88,0x000f4c098095b2ff,0x00098c534f852e54,0x000000967fff91e6}},
+{{0x0005d349c134d77c,0x000eee6033163d4e,0x000d78785796df61,0x000d5438967e8379,0x0000258b88152dd2}, {0x000242ae5974a179,0x0002202fb09861b3,0x00055f131eba0efd,0x00022c60a5e007cb,0x00007a70eed7e5fe}, {0x00006ca8f0303a80,0x00048b98c7a615f5,0x00058e72e20aec35,0x00012c4115c8d95c,0x000028b909c91232}},
+{{0x0004547922cea526,0x00045e34b1484c70,0x00087460e745c2fb,0x0002b47c2984bdf2,0x00003f11529f7e8c}, {0x000233deef7b75ff,0x0000e6a026a5190f,0x00013d032f575309,0x000b183a48045d97,0x0000185867318b16}, {0x000384b76463218b,0x0003db96a4607b1e,0x000210c33f99c42b,0x000fc1c093c77a39,0x000065588e3d6ef1}},
+{{0x00079dade9413d77,0x000d59729e67d78e,0x00037aa7e6f257f9,0x000039c59db910ee,0x00006aa11b5bbb9e}, {0x000d53265b0fd48b,0x0003193bfa988da6,0x0001d57e28896082,0x0008143d78ac9326,0x000079f2942d3a5c}, {0x000a2f25b6c88de9,0x000eaacf2016997d,0x000f4eb4e4251ba7,0x0007da509b44f87e,0x00007d90ab1bbc6a}},
+},
+{ /* slot=2 [{1,2,3,..,16} * 32^(2*2)] * G) */
+{{0x00070bf5d3f0af0b,0x0008ae32e71f750b,0x00055bbd344feaf4,0x000d1ed60e84ed3a,0x000000ed489b3f50}, {0x0006c72aed261ae5,0x000d988e100f7390,0x00033601979ab68f,0x0006d47f5e9059af,0x00000e53dc78bf2b}, {0x000829bf7971877a,0x000636d17e631b90,0x00082768935e4444,0x0004af54d05c52e1,0x000027632d9a5a4a}},
+{{0x000ff05154b260ce,0x0008e72f95270d11,0x00067cc138d86dc3,0x0000ccd601fcd0d2,0x00002b67916429e9}, {0x000285d187eaffdb,0x000bbd8d0a864a98,0x00022663f7a5b4fb,0x000e282b658f27f0,0x00003bbc2b22d99c}, {0x0007c952583c0a58,0x000b80fe4c6f3b91,0x000cdf3c0c653ff9,0x000d60e9b0da7d7b,0x000043a0eeb6ab54}},
+{{0x000966a46d4a5487,0x0008aac2bb3ba396,0x000628b26bf811a1,0x0009b9266e4685b5,0x000070a477029d92}, {0x0006322357875fe8,0x000ecf5fbcb8f3ac,0x00082bb620d9d4f4,0x0009fdc8dee84933,0x000050c5eaa14c79}, {0x000edc8bd6f2fb3c,0x000a79cc7b7a0dd0,0x000c8d9f1a54c63a,0x00067fbae0b032b2,0x00006f9ce1076029}},
+{{0x000054b1cde1c22a,0x0000248eb32dfad1,0x000ccdc0eac4a8e9,0x000963e5f3e7b33a,0x000072364713fc79}, {0x000693063520e0b5,0x0007c88ea03fe139,0x0003c959bc437fcf,0x000ded9f7d4c40bd,0x0000699154d1f893}, {0x000d5c75b4b27526,0x0002d0236daa5315,0x00045fee8ecccb84,0x000dbed22f0c8a33,0x000073975a617d39}},
+{{0x00024df96375da10,0x0001a1830c870e40,0x00058cd91c78d325,0x000438a902b19486,0x00007e18b10b29b7}, {0x0007f392f4433e46,0x000a11f566b186f3,0x000fd1d6620e19b9,0x000c94d220fb78a1,0x0000362a4258a381}, {0x0001d9132b6beb2f,0x000ad28418247907,0x000dec925d0f26e9,0x000f2deeab91ec9b,0x00004be65bc8f48a}},
+{{0x00087feba36e7028,0x000001dd8ce34784,0x000b30c4895f3f13,0x0000a2b934fb12d4,0x0000056c244d397f}, {0x0000fba257c26234,0x0003adeb0678b1d5,0x0006538af57bd482,0x000a73ec2b0dc6ea,0x00005665eec6351d}, {0x000ee00943bfb210,0x0008720800ac2db3,0x0003bd8667497201,0x000493826ab5d617,0x000020b209c2ab20}},
+{{0x000e342ac07fb34b,0x0000821373d93549,0x000cd1f56702d822,0x000c784bc262d70a,0x00007a92c9fdfbca}, {0x000ca94516bd3289,0x000aa414204281fc,0x0006a55d62448d65,0x0002cd859c3b7b21,0x000049992cc64e61}, {0x000d1bea70f801de,0x000c0fe49e28a65b,0x0001b2ae4a1befb7,0x0002a09a86306cdb,0x00003b7ac0cd265c}},
+{{0x000bee438c01bcec,0x00025c0fbc73b822,0x0001953fe9530cb5,0x0000f5b48519034c,0x0000265cc261e09a}, {0x00054e4f22ed39a7,0x0001e5608150af0d,0x000ddae875a2aae9,0x000e992f421b2e9e,0x000031bc531d6b7d}, {0x000d134da980f971,0x000d1221a22a7df3,0x0005aad6d87a4fb8,0x000125e3df7d4203,0x00002a14edcc6a1a}},
+{{0x000fc4197bd6631f,0x0004038f99b30de8,0x000c1b549fb9673a,0x000cb69f35db2a39,0x0000578e866d9553}, {0x000920b3ba6ec6a8,0x0002b2777981c597,0x000ee76838f2f292,0x00020eeb288902d0,0x00007fcff60e48af}, {0x0009558c15a49d17,0x0005a47aef784a89,0x0007d12b9a76fbb6,0x0009571cd6287658,0x00003cce27ed5d3c}},
+{{0x000fc1e063228d1a,0x0004c41f9f4313b5,0x0003321bd8d063b4,0x0004f3cf2e39e867,0x0000601ce18b0943}, {0x000ddae6b1011ce6,0x00096eb9b1ddcefe,0x00057b8c11989e11,0x0008b1035c740c47,0x000069cb142e3f88}, {0x000cce812fb1a6eb,0x000d1f9bc60b5bbc,0x000e13554abe2d9c,0x0007d29551273cd6,0x000059335b5eee59}},
+{{0x0009be91bc16ca69,0x000a4e4d97c12b11,0x0002167b0273f0cf,0x00015654b8eb8e67,0x00004b5ef8fc05a8}, {0x000c2e816765b5cd,0x00068375986fc70f,0x000787ba91ae9695,0x000a6f74b697c72d,0x00005c60ccc5f0d2}, {0x0001b2ce5962dc93,0x00091b5ce56b656f,0x0002c93dc87a3e38,0x000c0d617b7aec86,0x0000063242203c9f}},
+{{0x000378613d2eab67,0x000e8bf81523ccd6,0x00056da37e4bd4e7,0x0002d5d17c44c8a1,0x00004cc78b171067}, {0x000d3f49d0b574c8,0x000c1f89eb145650,0x0006a7c15f556096,0x000883a43b535b86,0x00007542c170d1b3}, {0x0004b96664ad698f,0x000c1508c1e6065a,0x000c54fc2179f6e7,0x000cdbc31365d35e,0x00001872aac51b4f}},
+{{0x000e746346350e7e,0x000b06e35108f057,0x000f4edefe5181c4,0x0008ed1ece115bcf,0x000071b95265eefe}, {0x0008d2ad87080d85,0x00026c4806120960,0x000689ee5dc8b701,0x000df2c42157a87d,0x000021e4a5f3b0d7}, {0x000008260b27b561,0x000b24013b22fa16,0x0001ea934a90cd2a,0x000b2134b4f4e55f,0x000012cb8b751680}},
+{{0x000238d136999448,0x0001e7a1b98076cd,0x00041fd9fe1ea006,0x00083e6e79a750ea,0x000007108ca92aeb}, {0x0005fa7b960a2d4a,0x000cb5c04d195060,0x000cdb7f2ea26f83,0x0004d9326367ab98,0x00005d79e97c93cc}, {0x000b77bd0b0054ac,0x000b7814125732bb,0x0004d7d81df7a26d,0x0002a9b02a72dd33,0x00003976d7e5c7de}},
+{{0x00063bcf238f89c3,0x000fc20c11832681,0x0008c2b78ad85fd1,0x000582847029e777,0x00004f8ef157dbd3}, {0x000287997625b930,0x0009f8f8a3df25f2,0x00041afb4a374935,0x000ee937c4a3458c,0x0000719d6f0a6a99}, {0x000a3c564b645070,0x000ea3081682bef8,0x000f17d39d02e7b7,0x0007b1bee86e22f7,0x00005102cb8b9527}},
+{{0x0008ee0752cfce4e,0x000f306ec08b7df4,0x00095459c4c3fffa,0x000a38d05710b2ab,0x0000161d25fa963e}, {0x000a8c570478433c,0x0000ec281439d231,0x0003d9079fb7b527,0x00003d9dbaa99eae,0x00002c03f5256c2b}, {0x000f18757b53a47d,0x00030cf0c5879790,0x00057ef7f9307b01,0x000bbaf31903d772,0x0000699468bdbd96}},
+},
+{ /* slot=3 [{1,2,3,..,16} * 32^(2*3)] * G) */
+{{0x000cb118a9d0ddbc,0x0003408b4802b98b,0x0008a6b104ee449e,0x000915d87089226b,0x0000685f349a45c7}, {0x0001acf85c74ccf1,0x00081082652519b4,0x0001adb147b67331,0x000b40f99c92aed1,0x00007a47d70d34ec}, {0x0000c4cbcc43a4f5,0x000ca3677bea960a,0x000ff8f5ed775c66,0x000fdc0a17aa1752,0x000011ded9020e01}},
+{{0x00083916c11a1897,0x000efe506d008856,0x000664bd012d69a4,0x00017c639af1378f,0x0000659421313615}, {0x000ccf90b4d3b66d,0x000e561732e60c0a,0x0000c6b0baa7059d,0x00046e4033d1f787,0x0000584161cd26d9}, {0x0002b1a072d27ca2,0x00059fbdec704bbf,0x000262b81ebf393c,0x000b589e98dbbcee,0x000002eebd0b3029}},
+{{0x0005107a4d935737,0x000d89be48321204,0x00003107e4678360,0x000fefeb9a0d6dee,0x000045028fe917dd}, {0x00017689a0711a50,0x0003bda1e1b2026c,0x000f5f17a7faeca8,0x000f98056bf1ed0d,0x00001f88bd9fd43b}, {0x000f3c0373726586,0x000b4f2aed50b3a8,0x000fe2a1360455e7,0x000c30a3634e2a2d,0x0000109075126d95}},
+{{0x00068756a60dac5f,0x0006aebabdc57613,0x000cce0f7d17e02f,0x000dcf07f193f2d4,0x000020234a7789ec}, {0x0005b69f7b85c5e8,0x0008bd168bab2876,0x000d330f9b6ff067,0x0008e7c3a70e77c1,0x00003a5f6d51b0af}, {0x00020db67178b252,0x000f9d51ed16076d,0x0003e41170071c34,0x000e366f62a4a20b,0x00007cd682353cff}},
+{{0x000b429185b56004,0x000b8de859e71d0f,0x00020f3f88c59bd0,0x000b1eaebb63de27,0x00002d23b7368082}, {0x0009babddffd31d0,0x000778e9e3b5c59f,0x0006884099db5cf0,0x000956f5d869571a,0x00003fa02b627b17}, {0x000de55970620108,0x00020ff54343713c,0x000e1a580f088cc2,0x0007520db795c58b,0x00001f7882bce218}},
+{{0x000b7a1f73ae6a31,0x00092cd09778acf2,0x0006d20c0ab55997,0x000b30525eb0f50f,0x000041fede25c6fb}, {0x0000ca7f8b5cb1ee,0x000235dc7b18b9fd,0x000c3b2a5ac1246b,0x00025556d64dce5e,0x0000508b0de7473e}, {0x000f4a753566b61c,0x0002f7a0bd6fdba3,0x00073665cbb4e968,0x000e24848f39f12c,0x00005c4ec39194a8}},
+{{0x0007c57870c7c84b,0x000ac8fe2be138c7,0x000552d4a3474acc,0x00088bc0a857fbfb,0x00005c8fbd2471ad}, {0x0002b91d56eb287b,0x000454835efd14a0,0x000e8d95c22bc4cc,0x00099eda46bfbb68,0x00004fca003af91e}, {0x0005ec8a729ab797,0x000e9ae5ef55c972,0x0003c4c8cb1e9741,0x000d91f56612c070,0x0000360fb6166884}},
+{{0x0001a45bd887fab6,0x00032ba403b6e0be,0x00096e60002a846a,0x0000943d9921012e,0x00002838c8863bdc}, {0x0005cd6068acf4f3,0x000183cd7e3d3a66,0x00036025d942d92d,0x000d8ff5759389d3,0x00003ef0253b2b2c}, {0x000bb0cf4a465030,0x0004115c577abd16,0x0004ab419dfa496b,0x000281282cfae8af,0x000021dcb8a606a8}},
+{{0x0008a15f2dd73890,0x000101f418e11e06,0x000a54e11baa3ab7,0x0004568775983151,0x000074afc5120afd}, {0x000c308f404c00ae,0x0003caecba2dabe8,0x00012a13e94b48d7,0x000a7613f4aba0c2,0x00004f750eb9a880}, {0x00012b6a472952db,0x000cf33df186c8aa,0x000300778f4e1613,0x000588b617cb5b3c,0x00007a5adc23a580}},
+{{0x000aa7d93ee5f2c9,0x000db1ee159d1c7a,0x0008788d5b51272b,0x000c99cbae8f9e16,0x00004d44c4645da6}, {0x000f77f3f4d50063,0x000b4440d1ad08f9,0x000439359c3a740d,0x0008211389156635,0x00006913f1449e77}, {0x000aa675d4b609c4,0x000be08acb744c45,0x000cd3556683743a,0x0003db4b662bbc9b,0x0000006057d83912}},
+{{0x000831526ea463f7,0x000ec026a56f3e8f,0x000d55bd8e4cb13c,0x00019d43222c93e0,0x000077381f0a45e9}, {0x000c8071b3fd3d24,0x0008476e70cd6c7b,0x0003465389ccde1d,0x000525f6549ddf74,0x00007a9e0d016ae3}, {0x000e8aee6bf3784b,0x000ca499d8df4dc9,0x000d17d49da46531,0x0003d4d39e41acf6,0x00006657d71f8802}},
+{{0x000004468c9d9fc8,0x0006ed42aa3cb5c6,0x0002ee2f9c254009,0x0001dab125b4d4c1,0x00000bc3d08194a3}, {0x000d00fabe7731ba,0x0007e629e18899a8,0x0003f3d97f820360,0x000678bb2cc02374,0x00005d840dbf6c6f}, {0x000e380d309fe18b,0x000a6b9e165c7706,0x000dae20ab6eb02d,0x00096dd57bbba997,0x00003a4276232ac1}},
+{{0x000545a295a2ab8f,0x000b049e3e0d85ae,0x0002d75981e30237,0x000717b47e1eafd9,0x00003224f6f6e0ba}, {0x000e3ce7646adaf9,0x0005c1443661b3a0,0x0001d12f9492434b,0x000a43c6bc21cc95,0x0000218fac425bf0}, {0x000a617a53cba588,0x0007644203491086,0x000a244ada5bf314,0x00032df14d8bd4ec,0x000039ef737626f3}},
+{{0x000aa76ae434ad5b,0x000096eb69f861b4,0x00062b9e1b04977d,0x000ed310ad19fa8a,0x00006f6359310dcf}, {0x0001a4540a083187,0x0003824c3256d034,0x000fd05910c1a6e0,0x0007ff6635871eec,0x000028f53f8d1260}, {0x000798cc33c06bb2,0x000fab4f44acbc9e,0x00014bb0d16ea566,0x00098b2b47938c97,0x000023d2ad95c944}},
+{{0x000e2258b5dd92d2,0x0008e3a509c0d38e,0x000f965055044469,0x000e96fb0e2bef8f,0x0000561fc3190493}, {0x00086d2207eadf66,0x0006558218f9bb7c,0x0005188ef7df4427,0x000485641203c6fd,0x00003c160f77d611}, {0x000300a1aa4cd92c,0x0004f8689c21697e,0x0002ef78db5cd4c4,0x0007b59e1ecba806,0x00004b1d88c88b3f}},
+{{0x0002432c8a7084fa,0x000e3dfb9e5454b4,0x000c58e45d898a19,0x000ebd1be9f00219,0x00001ff177cea16d}, {0x0008c172db447ecb,0x0001fc6282dbd3bf,0x0005aa15fe5fcfc4,0x000a9f980acffc07,0x00000770c9e824e1}, {0x0001d99a45b5b5fd,0x000e91b3a7924cf6,0x00003e3e89860984,0x0000b1ee73009193,0x000039f264fd4150}},
+},
+{ /* slot=4 [{1,2,3,..,16} * 32^(2*4)] * G) */
+{{0x000bb6a1a6205275,0x000d7413c8e836e7,0x00088f5cb2aa4f21,0x0005be16f56d155e,0x00002de25d4ba634}, {0x0004d8961cae743f,0x000f5ee1c63edd07,0x0007f4ed29f86d18,0x000b10897bdc55be,0x00004cbad279663a}, {0x00019024a0d71fcd,0x0000afb288af880d,0x000f3a6419c525c2,0x0007233b1a3974b5,0x00007d7fbcefe200}},
+{{0x000f1e6a266b2801,0x000c4d5739f16fae,0x000b03762c866c68,0x0005a8df68a2fbc1,0x00005975435e87b7}, {0x000c5dc5f3c29094,0x0009a2a9105abcd7,0x00021c3058c781a2,0x000d4d780c61d364,0x00004f9cd196dcd8}, {0x000297d86a7b3768,0x000241ad17a63199,0x000c1c0c17d0d058,0x0000307ba029cad5,0x00007ccdd084387a}},
+{{0x0006422c6d260417,0x00050948240bddca,0x000b68c677ae153d,0x000cf53a9c0c1b4f,0x0000428bd0ed61d0}, {0x000c84186760cc93,0x0007a1ab32a999b0,0x00020bda18cdae00,0x000ca44a88dec866,0x00003593ca848190}, {0x0003189a5e849aa7,0x0003565d8facd921,0x0003fdbbd1d4d8c3,0x00063e68c52545b5,0x000027398308da2d}},
+{{0x00038d28435ed413,0x000603278ccc942c,0x0009da03efbd50f3,0x0003355bb07ab1a7,0x0000269597aebe8c}, {0x00010e4c0a702453,0x00066d57d1bdeb9a,0x000d27daf70fa258,0x00033fdffb9d9b5c,0x0000572c2945492c}, {0x000fc745d6cd30be,0x000d3e3baaefbc77,0x000a5dda0ce4dfe8,0x000ca80a22c8830a,0x00007f985498c05b}},
+{{0x0009ce889f0be117,0x0001b7b54a288384,0x0003fc921c8005ad,0x000f3043da3c39f2,0x000076c2ec470a31}, {0x000615520fbf6363,0x00045cf4dfba6d35,0x00073fa0c208045a,0x00012e7eec24fbc8,0x000030f2653cd69b}, {0x0008c938aac10c85,0x00060db276bcb8a0,0x000e6fac7046179b,0x00073daa920c01e0,0x00002f1273f15964}},
+{{0x0009fc7c8ae01e11,0x000904a6aab9f473,0x0007728f2efd5274,0x00069f241d98a828,0x00005d9e572ad85b}, {0x00088bd755a70bc0,0x000a4f1d442e7304,0x000c59616206d6b5,0x000f784ead1a69eb,0x000038ac1997edc5}, {0x0006b517a751b13b,0x000867e9b858c066,0x00054dde49747d06,0x000e69cacacc0114,0x000022dfcd9cbfe9}},
+{{0x000bd2e0c30d0cd9,0x0005facbb43338dd,0x00022a961fad8e66,0x000c1c78f6b258c3,0x00006b2916c05448}, {0x000c59b4103be0a1,0x000ecd259f96956e,0x0003f5cd322ee3ba,0x000e472797cb2941,0x00000fe9877824cd}, {0x000b34d10aba913b,0x000822e6dac0e7ed,0x000578f8154ea3cd,0x0000a1766083dff6,0x00004c303f307ff0}},
+{{0x000a3bd617b28c85,0x000b739773bead30,0x000e6a5cbfc5d377,0x000b7c4c6c6e78c1,0x00000d61b8f78b2a}, {0x000c03580dd94500,0x000a46fbbec9329f,0x0002e2a7f8ecd27a,0x000a1d5130a155fc,0x0000416b151ab706}, {0x0008d7efe9c136b0,0x000cd58e44b2056a,0x000b57e0abbd07e5,0x000e8d2afe62fda1,0x0000191a2af74277}},
+{{0x000ab59caa32debd,0x00059ff502d6b0e8,0x0007b1c7d958cc7c,0x000a6f86826b0431,0x000063efa6c34ae8}, {0x0000e9137c0d1177,0x000d4c75c89461ab,0x00098573c65d95ae,0x000dc5c36f72c1f0,0x00006956286c7206}, {0x00000438d6cf3a39,0x0002559500769777,0x000370836d47caef,0x0009327c49f98ffa,0x00000453eaea6938}},
+{{0x000a5c1dc54dc0f1,0x00019c2f6e712b30,0x000b62354f8b78b0,0x00061ebd1b213ad4,0x000056c5319b842b}, {0x000e19e97235cd1e,0x000d968c84f41727,0x0005b0f54acf2a86,0x000fc113758332f2,0x00007fceed59ba35}, {0x0004d1ce2069e466,0x00028ea7dd400607,0x0000c831cabc4fc9,0x000e307d1f698add,0x00003b5e0a5a64bd}},
+{{0x000598e28b4a15ee,0x000db7db2f573261,0x0005c31aa9345454,0x0009699330c60e88,0x000009b65af15a8c}, {0x0005156355c6ad20,0x000f703e5b8e299b,0x000cd0d662fcf4cc,0x000046f794a3b833,0x00005abcbc9767af}, {0x000d46264952fd57,0x000c9c59ca2adddb,0x0002f29793e8d903,0x000cb30d2389b9d4,0x000032e24215b60f}},
+{{0x000f9399287a03bb,0x000c8f2cb27e0cfd,0x000dccce88ca3378,0x000988ffadc628fe,0x000073ca56bce0be}, {0x000fcb30cacc8521,0x000406572971a0be,0x000c7d02adf4445b,0x000bb2e8181678d4,0x00007e168be4c930}, {0x0000728374645878,0x00059d27f5b4ae84,0x000639cc2eec091c,0x0001d162f4d72e47,0x000067d9b63dd451}},
+{{0x000e44649bc2aaab,0x00018bee6eb415b6,0x00043a2fb5393753,0x0009868288640535,0x000041dd8e9602c2}, {0x000454302b1a8acd,0x00022be20aaa7169,0x0007af82663d83bd,0x00040663a39ffcba,0x00000fd6b71d06e0}, {0x000ccda716926c32,0x00022dad674bf410,0x000da12ff079fe46,0x0006138bf992cfdd,0x00004733b7688721}},
+{{0x000f9a6c27f741fc,0x0006064bf373bdf0,0x000ee5701c18cb16,0x0006d16836006be0,0x000070abebc1e8b2}, {0x0000f4df90c0f71f,0x000f0b2a2d604717,0x0006b7ee8de1e004,0x0006fd4fdcd1248a,0x0000013c1e14d386}, {0x000b880fb3fce6e4,0x000a7a990ed1ff4d,0x000b8685213a9898,0x0006075d5e47caf4,0x000054d149158a97}},
+{{0x000ff99bb12ec81a,0x000ee7184a659443,0x0007b3170edb0204,0x000509bbab854748,0x00002a6138b62825}, {0x000a28a964d63b6d,0x00089b1201782953,0x0004ad169211c91a,0x0008ef303dde15f0,0x000018d974e03c54}, {0x00027087200cb1f4,0x000e0193e9174a58,0x00053587ff0a6217,0x00045c95e1e8f9a1,0x00006f5302b1fd90}},
+{{0x0000095bab6f4985,0x0005b4fbfaf1ad55,0x000a0c754004f4cd,0x00022869d8e2ed12,0x00002bc24e04b221}, {0x0004b60b2fe09a14,0x000afdbb1747e09d,0x0008b5fd6ec384f0,0x0009b0a58e2ea897,0x0000519ef577b5e0}, {0x0003d7d91124cca9,0x00045b88a708e186,0x00057031f57ac081,0x000fae52bcd73098,0x000062337a6e8ab8}},
+},
+{ /* slot=5 [{1,2,3,..,16} * 32^(2*5)] * G) */
+{{0x0006c1bb560855eb,0x00038f893f09d6a4,0x000f71acc12416bb,0x00096ead71d11378,0x000075f76914a318}, {0x000122b5b6e423c6,0x00010f286ff8eeeb,0x000dcf5d8c939d70,0x000eb1090a92a831,0x0000136fda9f42c5}, {0x000cdfb1a305bdd1,0x0009d9ff82c08f94,0x0003bb588a0f364b,0x000dcba2a87d8a5c,0x0000022183510be8}},
+{{0x000a4fbd305fa0bb,0x000e054c663ad0e7,0x000fe33848829d4c,0x0004c42f421c3832,0x0000795ac80d1bf6}, {0x000e706efc7c3484,0x000b4c3c1cf61b36,0x00081cc7e573dfc9,0x000675ceb1d79c97,0x000070459adb7daf}, {0x0001db4991b42bb3,0x000234b02dcca1b9,0x000f8c78dc572696,0x0001fd39fdf9ee51,0x00005fe162848ce2}},
+{{0x000fcf5f66e10884,0x0008fcabcddc8f77,0x00046cf7571eb4a4,0x0000d8d45a6a9000,0x000073e118d4ed1d}, {0x000fd50423856f94,0x000595331b7b56dd,0x000a2d6c8a4f0139,0x000a6c46fd0941d6,0x0000242248a82c64}, {0x0009d04192d88051,0x0004d38825b28da4,0x000dcbe632bf3a22,0x000fd5dc2b008c93,0x000001cdf7aa40dd}},
+{{0x00090aae4d077c41,0x00070db7469a3e27,0x000abd16a28b9382,0x0004b726eb632dc8,0x0000720814ecaa06}, {0x000c29c795115389,0x00007862f74ce315,0x0005927432d7e0e5,0x000a1e40c4a76218,0x000072de6c984a25}, {0x000ab553bf6aa310,0x000a9806d6e1bae9,0x000dff5139050a50,0x000618b92bb7403a,0x00000394d27645be}},
+{{0x0009b4da4221bf5e,0x0008f91ede2ae6a2,0x0008e5649799d9df,0x000c1a1abbb7282e,0x00007c5e489da07f}, {0x000c74707d311c32,0x0000dde55ea5d0c9,0x000a17ebf0801bb6,0x000c20b286960c29,0x00001f52de08817e}, {0x00095c2148011ff4,0x0000ab8fe024bf3c,0x0007ca0838005d74,0x000fcbb0e3297825,0x000069a312ed86e3}},
+{{0x000657d96828352c,0x000301ca8d42e982,0x000fcda00d488030,0x000348e978e99ec9,0x000056b69985f077}, {0x000537fed52ce247,0x000db6f605010872,0x000b349f8bfb3fbb,0x000433921209e314,0x0000019162b71d96}, {0x00008641e53c3448,0x0009554ecd606d45,0x0004313ae049bc5c,0x000733026bdb90ca,0x000025e1c978deb9}},
+{{0x000bc31059b111ee,0x000825e66c59b951,0x0007999793f1fbbc,0x00030d01bbe9daf9,0x00002854b76e38c4}, {0x0008ea72a0a8a7b8,0x00000b30d0d559d7,0x00055b7b1f4f3902,0x0005e4647ad2c6dd,0x0000646b80e6d2fb}, {0x000ea8a54e1205bf,0x0002e3a8e7d259db,0x000e22723730b462,0x000733c13e16cdf4,0x000028259a8f6a16}},
+{{0x00072251857eedf4,0x000dde19e93c54d5,0x000b797035e3724e,0x000e7438a71420e0,0x00003b3c833687ab}, {0x00096425b23545a4,0x0007e98fbb296f53,0x00036fdd8615a7a2,0x00034eeab6c52bc6,0x000079d995a84193}, {0x000a8ea61195dd75,0x000a81dd9a82fcd8,0x00035879b6a504d8,0x0006a8a540dca81a,0x000060dd16a379c8}},
+{{0x000369a6b6bb8609,0x0009412dd45ced4f,0x0001177cd141e717,0x000caeef2315c83f,0x000072b62dc93dd1}, {0x0004fcb69f8111a9,0x0003b13cc4a5b00b,0x00012ccca5532d8f,0x0004b22ea096bfcb,0x000042b18b503008}, {0x0007ce2e3c0cea72,0x00067fe5049463a0,0x0000e59b17a1e044,0x000a0821d95d441a,0x00006bc93e2e92be}},
+{{0x000a02b825afa716,0x0003c3b993b75469,0x00014663b063b43d,0x000c226257dbe7fd,0x000000f9d5825ed3}, {0x0006081f8b145e5a,0x000ab35aae3e9ba2,0x0002b1aa50708ab9,0x000bcbe33a9c06d6,0x00007b27141799c4}, {0x00089589575f7b63,0x000d1306940c8ced,0x000dae8720e4753b,0x000f6b1d76506bca,0x00006ded02dab5e0}},
+{{0x000e2ad04349acef,0x00012defa8a58a10,0x0000a01e45f20cce,0x000d59fbc3d67c62,0x00006b21d35b9296}, {0x00064e333d30b2f1,0x00018bcc585bd5dd,0x0004dd7b2f762625,0x00055de0dd7b23b7,0x00000507119e707a}, {0x000f63bea54fa4fb,0x0004e627cab1a410,0x000f966250e9f6a9,0x000089c9d0f62a5b,0x00007bd8888b8947}},
+{{0x0002c8487381e559,0x000a6d78082cb35a,0x000ba7b653596ffe,0x000a685cb9771ebd,0x00005a08b5019b4d}, {0x0001d6f8153e47b8,0x0005414a2f60c350,0x00055d9523b7a967,0x000ea8a112ee8b64,0x00004e62a3c18112}, {0x0004ac04516ab786,0x000215295b23dc8d,0x000b0230c1595af3,0x00041ccd6edd234d,0x00000929efe8825b}},
+{{0x0005be1bb92cc499,0x000b679753024a90,0x000075bb030cfd0e,0x000e7cbaf601df0f,0x00006d5b167dfddf}, {0x000a798d95da9d2c,0x000f461eb9fbd8c1,0x000141ebff738dd0,0x000637075ec70eb5,0x00004a1943cab76c}, {0x0009a2508f23b94e,0x000ceb05e3b4b9eb,0x0009b61015dc9e6e,0x00027186e0ff5de6,0x00004197b6c64fba}},
+{{0x000452e9b940ad83,0x0000992cf66b1ec3,0x000c1aae4c6d3d13,0x000efca783344171,0x00006aeb71365c57}, {0x000d2f5ffdcafb65,0x000f83da0b41f748,0x000a5789f39c27c2,0x000759c188fda7ba,0x00003c074779b134}, {0x0008e27661c68269,0x000b7e3e4eba3c52,0x000c0c4954deb0fd,0x000de8cb9977a29f,0x0000756cce556a30}},
+{{0x0003499f47a80ccd,0x000c528d6058047e,0x0006b67312bdc786,0x000385d355910c48,0x0000128847c6cbb4}, {0x000034098999e331,0x000f716dba15e16c,0x0005d3cc536e1db2,0x0002a3a0e3a2cafe,0x000060542b3e617d}, {0x000fa05b7e023784,0x00005c1b8c2a917f,0x0002b033f9f69eba,0x000847c36f5b29cd,0x0000198f8429e1bc}},
+{{0x000601d1cbd0f2d3,0x0002f6132bb7f5f0,0x00038dde87736e41,0x000753c836044322,0x00001e3a5272f5c0}, {0x000172b7ad56651d,0x0007a3fabd7178b3,0x00024df6e401581b,0x000284f2dc94df64,0x000030376e5d2c29}, {0x00018da78159a59c,0x000d93f0713f3d29,0x000acd65906bdc1c,0x000c128565f7a934,0x000053daacec4cb4}},
+},
+{ /* slot=6 [{1,2,3,..,16} * 32^(2*6)] * G) */
+{{0x00055ec27c59b23f,0x0003e154d04f2caf,0x00014141f499aeed,0x000a0a268441d72e,0x0000140345133932}, {0x000430e0dc028c3c,0x000a85217c771d91,0x000c99a1fa0eb955,0x000743c4b09e1ed2,0x000042881af2bd6a}, {0x000ec69aab5cad3d,0x000d34cb2cfad7bf,0x000b37d6a2c23e8c,0x0007a18685dd14bf,0x00000ad6d6441567}},
+{{0x000a439e417becb5,0x0008cd10e0266781,0x000692ac244ac593,0x00012335da385110,0x000011b065a2ade3}, {0x0004892847927e9f,0x000ef370aa877791,0x000112270333dad6,0x00095921f8f24fa1,0x00005265ac2f2adf}, {0x000fdd309afcb346,0x0004428e63f54405,0x000f65aaaed9723d,0x000080994c01df05,0x000043e4dc3ae14c}},
+{{0x0002c7f1a938a517,0x000ab3180b2e1bc1,0x000bcd254a473028,0x000f90f3f78571ef,0x000074e534426ff6}, {0x000f7ac3adc2c6a3,0x000f6e9717c94ea6,0x000645eaf5d0e928,0x000fbbee2d379ead,0x000046dd8785c51f}, {0x000801be375c8898,0x000b5e3fd8348709,0x00072307144b06da,0x0004c4275880ced2,0x00002b09468fdd2f}},
+{{0x000749eeb701cb96,0x000d4b6a369c397c,0x000a402cd983f438,0x000df7b62962b8b9,0x00006976c7509888}, {0x0007946582ffa02a,0x00051fea8f5495b9,0x000f77af9bda096a,0x0001e76a06351375,0x00001bcfde61201d}, {0x000a5490246a59a2,0x000dee87fdd904a4,0x000d2371fad63ebd,0x0008ed6d9437c670,0x000069e87308d30f}},
+{{0x000a8bb15656beb0,0x000ba4f4d5bca435,0x000548c075f8fac9,0x000b622b9b278c41,0x00003eb0ef76e892}, {0x0000bf028bc80303,0x000b37a18cefb0f8,0x00072cd6a36aae16,0x00039aadd47ea47d,0x000061943588f4ed}, {0x000e5c3e91039f85,0x0007df6f33aa9d26,0x0000066a93c0e9e7,0x000addde8968c557,0x00003c34d1881faa}},
+{{0x000d2b5ea09f9ec0,0x0006fb623a8903f9,0x0002d926c41dab3b,0x000b36da09ba3ea7,0x0000374193513fd8}, {0x000b0b8f2fffe0d9,0x000103ed24fb9bd5,0x00026821c46aa254,0x000a36a2ac7d7bcb,0x0000605b394b60dc}, {0x000856e45a9d1ed2,0x000766c97a9a2b4e,0x000e5eee7defe848,0x0001c8fb104cf641,0x00002f50b81c88a7}},
+{{0x00023c61fc6811bb,0x000486211800f317,0x00079957539cb450,0x0002fcd768933d34,0x00003491a5350275}, {0x00052ca0a7da522a,0x00036449b02502b5,0x0004b99fb93230b3,0x0004a22f2c4c5bca,0x00007b2c67495807}, {0x000165883ed28cdf,0x000d2d362de39d55,0x0003378e4f12d84f,0x0003e740a874ad3e,0x0000000d2b1f7c76}},
+{{0x00020811d06d4a67,0x0008590e0ffe33d4,0x000d487bdebefc04,0x000fa28f870c6b7b,0x00006e2a7316319a}, {0x0004778c3e94a8ab,0x000cee9a78bec962,0x000d743c4f0ad6f3,0x000fccc948ac7810,0x000076627935aaec}, {0x0008ac24d6d59a9f,0x0003e3096f00656a,0x000f4c5299c8db75,0x0006114477f41e68,0x0000588d851cf6c8}},
+{{0x00078246eeee8700,0x000533af5feab90b,0x000a78e95fa81915,0x0000a5079f680c99,0x00006d7467dc36e6}, {0x000695ae2b28085a,0x000ac66da8caa2c8,0x00039a990c58167a,0x0006b009a8b40701,0x000055cd49391c9d}, {0x000b6f34cd8612da,0x000f0058fb329681,0x0000c53795f95210,0x000e4004a0f71b17,0x00005845382d8bcf}},
+{{0x000dfe5452527d03,0x000958ef04d23c23,0x000120221c400884,0x00062c3bb1bec946,0x00005765f3e490e4}, {0x000185e8e82ac206,0x000d8d3594892356,0x0002340227063078,0x000634d52a0018f4,0x000040e5b0e668d0}, {0x0006a687f66be558,0x000841b2a0bbb394,0x000a62d2e62c954e,0x00043ed9aff92619,0x0000248abd1d530f}},
+{{0x0000e51c2a20938e,0x000e7d964cc5195d,0x00053927406e59d6,0x000c70e5dd84e197,0x00007eb74af44975}, {0x00066d9a09f4271a,0x000427f45650aeaf,0x0006241a7b4c899e,0x000d9249232e5496,0x00004e8937d290a4}, {0x00083ae74b53d5a8,0x00081f4549b0822d,0x000bbf907512b2da,0x000be794906ffb30,0x00000c068de93916}},
+{{0x000bb1e5f91006a0,0x000819ef1f871e24,0x000033e02f943686,0x0008cd0d1f196cdb,0x00001cf137641d6b}, {0x0003ba402c88ebb3,0x0004c19142a8fd35,0x000267932417a8c4,0x0007011ed62061e8,0x000028682db56693}, {0x00059c751661bfb6,0x000b7738503f390a,0x000f998c2ad05c1d,0x000c831f73350800,0x000064f0e3be4552}},
+{{0x000ca273b72ae1b1,0x00028a95c62cf6b7,0x0003b5a1ea737285,0x000253b72ad93f7d,0x0000002bb828c80d}, {0x0009f186cf7fa6ab,0x000b8e9e121c0ae6,0x0001017bcdd40ad1,0x000f0f87b7dd8d0f,0x000025c41d21e358}, {0x0006eaf9bb329cb0,0x00071c0d52856940,0x000cbe08cd12eaf0,0x000cccef444076e4,0x00006a2a15c4ba3f}},
+{{0x000b0301f19f6461,0x000cb50cdb7c72c1,0x0000d3bdb71702e0,0x000af10e42bbcc9f,0x000078c2d3976208}, {0x0000f39fdf0f978d,0x000e02f62cb7eab8,0x000a102c5f7c2b01,0x000bbcd027cfbb66,0x00001f89108467e5}, {0x000c86a07919daf1,0x00034eff52659e5e,0x0001fc6f65f4e527,0x00031f42146435b8,0x00001b1e8ee91963}},
+{{0x000bee85210f219c,0x0006c6c853a42449,0x0004788df98bee82,0x00092215562a1b14,0x000018d7bb57fbc5}, {0x0006fbd9843401be,0x000daf4977edea62,0x000f4e52bd0c8b50,0x000e89d60ec1a206,0x00006f0d8778b691}, {0x000eea407587a77d,0x000f9bb08d10a03a,0x000b05ac06d6e3ca,0x0003552ebe3aab8a,0x00005176392c18c0}},
+{{0x00038ec78df6b0fe,0x00089e575f51b511,0x00017af1b95397da,0x000d65009207a1d7,0x00002102fdba2b20}, {0x000a65e777d1f515,0x000878faa60f1cd2,0x000abc06e5548991,0x000c9fbb1b73bbcd,0x0000654878cba97c}, {0x000ee405055ce6a1,0x000681251ad29969,0x000a7da41536bca7,0x000b2ba3a1af517a,0x00000ad725db29ec}},
+},
+{ /* slot=7 [{1,2,3,..,16} * 32^(2*7)] * G) */
+{{0x0006b79ebf8469ad,0x00004e2663135e1f,0x000f74181b158010,0x000673c9a498330a,0x00003ba2504f049b}, {0x000ce876760321fd,0x000109eb63ad89a6,0x000ac805927fe2b5,0x000723a00e7d4ae8,0x000073d86b7abb6f}, {0x0002b5606dba5ab6,0x0000fbbb1edab0b5,0x000b04a635a9134f,0x000e5db30a9520d9,0x00006813b8f37973}},
+{{0x000ae701c5738dd3,0x00035b26f1beedbd,0x0002f15ef4f9c6f6,0x000a4d861e96a804,0x00003aa1d11faf60}, {0x000d6dfa726ccc74,0x000fe2f53b96514f,0x0002a2c8b43b084c,0x000166af33ae4f55,0x000059aab07a0d40}, {0x000cec4c925eac25,0x000846013773877b,0x000ea9f451184871,0x000aa465b374337f,0x00001865e78ec8e6}},
+{{0x000157e62914a03c,0x000d7797b4f24edc,0x0007773ec21906e8,0x000144ed2dd866c8,0x000063d223c83e81}, {0x000fd1dad6a1b645,0x000478d49d876833,0x000861bd2e706b8f,0x0001e66ac0cbd408,0x000058d4f3c210c3}, {0x000735da96155e15,0x00096b0a8e850373,0x0002dae858505c0d,0x0003a3dd8c0b9d6c,0x000021ddebb6b92d}},
+{{0x0004b7c7b66e1f7a,0x00025f50c2f7eccc,0x00013eaf1c44157e,0x00063f73ef06dfc7,0x0000582f446752da}, {0x000c54e91c529ccb,0x0009264c635fb967,0x000812196530f626,0x0006f5c2747aff47,0x000017038418eaf6}, {0x00017bd320324ce4,0x000e8a4488bc4c63,0x000e5a1364a81042,0x0008dc9b21ef18b4,0x00000c2a1c4bcda2}},
+{{0x000bcb2dfe982283,0x000d3e216a584e3b,0x0001ff0b7d892ff2,0x0009f2d79bbce234,0x00000fbbe90fefff}, {0x00002fa9b507ecfe,0x00003b0a18a6a900,0x000324cae4951e24,0x000c5aa47f4d3bac,0x000007bba53eefa8}, {0x000f6d4c516a4b61,0x00031674e50830b6,0x000214611032ba14,0x00052595106d3d06,0x000055cb5ee4032a}},
+{{0x000b08008c5de967,0x0002bce935138f66,0x000a95cf1ce1bc2a,0x0003a35737d9b83f,0x000066a130afaa0b}, {0x0002b29b7caa19b7,0x000f84d3e41998e6,0x000ce503749c142a,0x0000d7ab743dc46d,0x00004ababfdbc85d}, {0x000ae4425cdcfde0,0x000bad77a001aad9,0x000aff8313ee2f18,0x000e0e4a67d448c7,0x00005d3758babfd4}},
+{{0x00098c0dddbb6ef5,0x000fe2a76281a2f4,0x00012c5de08a8d34,0x000ead38699dd9a3,0x00001252d1c82742}, {0x000258aece8a047d,0x00035ffa09813c98,0x000df7723692105f,0x000c33f453280d2c,0x000025ada8e98fe3}, {0x000c0b833e348d2c,0x000e0ba8811e2fa9,0x000c5dfe5a602118,0x0001fd3eb14fb4ad,0x00004210c779e9df}},
+{{0x000dc7d06f1f0447,0x0003edb87c059d24,0x000bb2d28fb2269e,0x0004877d15b0272f,0x00007c558bd1c6f6}, {0x0004814869bd6945,0x0007dbe1c8d22edc,0x00055cc5ab0d6d90,0x000dc83c63bd212d,0x00005a6a9b30a314}, {0x000c1524d396463d,0x0008ac35a24f0d0e,0x000cbc5fa412bb62,0x000afc3a50c3a791,0x00000404a5ca0afb}},
+{{0x000696e65c72151d,0x00009911ee681c8e,0x0004b775227dce54,0x000f71e89448262f,0x0000206a553d12d5}, {0x0008031ab15ef51b,0x0000daa01e9e054a,0x000a132498532f4c,0x000d476b5bfd4cfd,0x00007dd29417f997}, {0x000af69c5d8aa236,0x00047b3f367af7bc,0x0005376d89bfb294,0x0007cec96e69f8dd,0x000047f8afc86cdb}},
+{{0x000d50c1087b8389,0x0009ef104944e83c,0x000a9d488ffd2984,0x00060fca7ce5a322,0x00000ed560ec4530}, {0x00050302fb35f3c4,0x000bbd2b205b1c04,0x000f1ecb1e156248,0x000b12829f18a151,0x00006f59360a7107}, {0x000bb0c06ae9cd5c,0x000e6ef47efb8036,0x0002b8e91cf9febf,0x000394c816c832e2,0x000037e7c36ac935}},
+{{0x0001b0965c664faf,0x000216897d2d180b,0x0009c5d781ecf688,0x00065eb3a197130c,0x00000a89a2c5d70d}, {0x00058abda9b5fab2,0x000974331187d5c0,0x000f7541c1b72aa8,0x0004a4889a27f38a,0x0000591cf22c4f62}, {0x0000f043e498fb98,0x000e3af4b55e5078,0x000112f9d9fb440f,0x00049aa675d5d20c,0x0000423d188feb25}},
+{{0x000f40070aa743d6,0x000cb5b265ee88c1,0x00068fd2deccbad0,0x0009633574b046b6,0x000046395bfdcadd}, {0x000c9e1b2a416fd1,0x00028e350598b62b,0x000d5d6967b5c6f7,0x000ee9804343fd83,0x000039527516e7f8}, {0x000fdb2d1a5d9a9c,0x000bcd1005c2a117,0x0004d56fea9c7745,0x000d016efd4bef15,0x000076579a29e822}},
+{{0x000fb91117f2e17b,0x00026d19c33be45a,0x0000a78ff51bd2c1,0x000e79ec0a83cd2f,0x000014af5c2521d5}, {0x000bba8cdcfd72e3,0x000cb87f879af112,0x0008bb8afa601581,0x00074f612c76f9da,0x00007f2ce474c70f}, {0x00008d91ebb35be1,0x00073128f3b2602d,0x000e32bbc6cb740d,0x000935382412f0a3,0x0000389e9fbdeb4b}},
+{{0x000d8a6b64fa2a47,0x000a371751718683,0x0000801801f2ceee,0x000a0414cb8e88bb,0x000042fd12f8710b}, {0x000b10e9bc867734,0x00051b05ed6864d7,0x000a03e1ddb2fc6f,0x0006d6da132df6ca,0x000015ac49f730ef}, {0x000fe16f76e808db,0x0007e5b3e8570f1e,0x0006fb74a389088c,0x000cc52880025857,0x00001f27856bcd7c}},
+{{0x000019cd44291356,0x000bb2628443b411,0x000e2cae46734681,0x000e07a04abbdcc3,0x00000a6656cf8c5b}, {0x0008d054e2c6a19e,0x000e55aa12109f89,0x000b3e12792b6747,0x0003024e3a2430f9,0x000061364079e948}, {0x00075ae3686595ea,0x000338dda0bad579,0x000eec49c60adc71,0x000be833f10eb4d6,0x000035a351dff7cf}},
+{{0x00068e7e49c02a17,0x000a2bca9a37f45b,0x000c224c1b23cd51,0x000bdb13ed65f11e,0x000043a384dc9e05}, {0x000cb51352b434f2,0x0004993de80e1333,0x00050d35ced83228,0x00077c1b55128877,0x000002c514bb2a27}, {0x000bd5da8bf1b645,0x0007ef6b54b53684,0x0009b0d253fb8bd3,0x0008059313916d7a,0x0000116092096154}},
+},
+{ /* slot=8 [{1,2,3,..,16} * 32^(2*8)] * G) */
+{{0x0005058a382b33f3,0x0000bad48c0b489f,0x00053db36e5ae2ba,0x00032e68f93b503a,0x00005aa3ed9d95a2}, {0x0008aaf9b4b75601,0x000135c8dad72279,0x0001b7a0235eac72,0x0007d4ed2ceaa616,0x00001bbfb284e98f}, {0x000777e9c7d96561,0x0005472c78036656,0x0009506eeecb2b12,0x00057cc65053299d,0x00004a07e14e5e89}},
+{{0x000412cb980df999,0x0006f3c6ec7714ee,0x00025c77fda315d7,0x0003402bba5edde9,0x00003f0bac391d31}, {0x000b58cdc477a49b,0x000de6447f017240,0x0007c86aadfd38da,0x000a08119928d32a,0x000050af7aed84af}, {0x000fde0115f65be5,0x00021216109b26e4,0x000badd6d9299826,0x000d006780205810,0x00001921a316baeb}},
+{{0x00022f7edfb870fc,0x000eb4f76b3bd894,0x0006c24df72c296b,0x000aeb00738f1d43,0x00006458df41e273}, {0x000aad9ad9f3c18b,0x000ef60b1c19cd75,0x00055c0ed9566a0e,0x000c7f53e9a0bac2,0x00007b049deca062}, {0x000be37a35444483,0x000330fedbe93dcc,0x0002c5dd87758879,0x0000e64786004c31,0x00006093dccbc295}},
+{{0x00039a8585e0706d,0x000d8b3e739331ff,0x00018f453b36d0a5,0x000a97c43b9f2e17,0x000057d1ea084827}, {0x000eeebe6084034b,0x000b6780fb8546bd,0x00062d06953199c2,0x0007d90973376abb,0x00006e3180c98b64}, {0x000ab6e7a128b071,0x0006d93a88baaee7,0x0002216130a4c159,0x000bd18f7b4de82b,0x0000363e999ddd97}},
+{{0x000843c135ee1fc4,0x0005508e4c8cf96a,0x00058cd330976eb3,0x000052bb42f6801b,0x000048ee9b78693a}, {0x000848dce24baec6,0x00055babcaf602f1,0x000cefe931769b72,0x000b35590cb3c6e3,0x0000231f979bc6f9}, {0x0001de4bcc2af3c6,0x00030fe208d1f5c3,0x00014fb466b04bb0,0x0002413b78d7009c,0x0000079bfa9b0879}},
+{{0x00003a51da300df4,0x000233da95ab0e39,0x000b356480843964,0x0007194ed3cf12d0,0x0000038c77f68481}, {0x0009ed80a2d54245,0x0007877f63952f3c,0x00010854750aa08b,0x000636bd76dac63d,0x00001ef4fb159470}, {0x000e5ee65b167bec,0x0004296d0cdc2854,0x000810219959590a,0x000ff5672b2df349,0x0000575ee92a4a0b}},
+{{0x000080908a182fcf,0x000c299489dbdd4c,0x0002f733de30e170,0x000fd0005babd575,0x000043d4e7112cd3}, {0x0006bc450aa4d801,0x00027a533b9d85d4,0x000b8906c2c3af12,0x000581b389e3b262,0x0000200a1e7e382f}, {0x000db967eaf93ac5,0x0009b056652c0518,0x00067197f571bc98,0x0004e38fe2b85d95,0x0000050eca52651e}},
+{{0x00031ade453f0c9c,0x0005eff703b9bc34,0x000d847b3de9f504,0x000f4c6fcd97ac9e,0x00004b0ee6c21c58}, {0x000c397660e668ea,0x000fe153ab49797a,0x0004eca79f9b19bb,0x000ae574cb179b53,0x00006151c09fa131}, {0x00055c0dfdf05d96,0x000e02ab4ee7a3af,0x0002171709dd262e,0x000030b11b2bb871,0x00001fef24fa800f}},
+{{0x0009415fee42707e,0x000b89c5e90bac11,0x000878d374b4b77b,0x00054adda0aa5fc4,0x00007f3b3c8ab8e5}, {0x000989bd2b03ff59,0x000c843a26f06145,0x000c8eac6b80c846,0x00025dc5246f4468,0x000037de25a68e39}, {0x000699a3e971ea7e,0x0007271b82612e49,0x000b3aa76493763f,0x0000dd8db5d3208f,0x00004101ae820243}},
+{{0x00050da3231955ba,0x0009ba01e66272f9,0x000c8249d8232503,0x00086875ffc98387,0x000014e6262c635a}, {0x00063019541b5adc,0x000b9fead06d9e3d,0x000ae2071436ac81,0x000cc70e08f79cd0,0x000049466a16e7a9}, {0x00085db4d99b7873,0x0007466e9e611690,0x0008f29a1e61cccd,0x000a899c4082e022,0x000006c33ec93bf0}},
+{{0x0001de76af0916fc,0x000ed14b825a6a46,0x000f6ce795df8c91,0x0000e8c04e7f4161,0x000076baa89b608d}, {0x000712c9ff3f6699,0x000584a7a4994038,0x000122019ba719ce,0x000da40e40e2379d,0x0000620192966d6b}, {0x000327ded56846f4,0x00034db8ea2ef9e6,0x000aa26f516d1801,0x000c0692ccf138c8,0x00001422088ce676}},
+{{0x0005806036caf803,0x000de849d4f1267f,0x00035c3172e2d500,0x000768dc13862f10,0x000068d1529a53e0}, {0x000de4243e3f8d56,0x0006a78e7bdfc311,0x000db4e65e32e369,0x000e5aacd27d9e8a,0x00000cb40e456c36}, {0x000c95f1ea24ee60,0x000ed7dd165c2cd0,0x0006b270ed9c4213,0x000a301cdecac403,0x00001a1a04e7879c}},
+{{0x000c2b34be5fb035,0x00094ee6ddf5457b,0x0009ad6874846378,0x00080880cb527caa,0x00002af6269ddac4}, {0x0007de9f69906e79,0x000b8c289fe95372,0x000b1c042b87da82,0x000434e065d336c7,0x000049832ee87102}, {0x0003212b5381c115,0x000922e3272bf6c9,0x00022d89682e8f83,0x000d21c9a4fc717b,0x00005d3f41dd6061}},
+{{0x000e4c2b79519940,0x000c939d4fab8313,0x000bf615aba29c65,0x0001d50849bb217c,0x00006912f842709b}, {0x0002570673e49b05,0x000a9ab38501eb02,0x000f4354467201e2,0x0007f21a8d7c2d6a,0x00005207af90c5d6}, {0x000d71f0d7089be2,0x00077a9f1a823a8e,0x000e1966d09470fe,0x000bc24607df448b,0x00004a3e7a3a6473}},
+{{0x0005b731f7712e75,0x0003f658a8887ea2,0x0004b40ef570cc1f,0x000f2d1daab839bc,0x00006edef7213d47}, {0x00073ed992378f5c,0x000167dce699ebb0,0x0001364cfbce4575,0x0009753ede24e108,0x00003fdc0d88a700}, {0x0002b7ce124b75ae,0x0004cd5fa00435f1,0x000c039ca4f2a1a1,0x00085741932785aa,0x00002ba8aff614f6}},
+{{0x0006123a6b6c6609,0x0008580ab5938b49,0x0007c27a5fa750fe,0x000193cf471bf39b,0x0000507903ce77ac}, {0x0001a66a90166220,0x000ae5bf1e009ff9,0x000f90df7cf22552,0x0006fb97dff85d87,0x00004f620ffe0c73}, {0x00090d65dfde3e34,0x00092b9fa5fad62f,0x0006164510cf28c5,0x0006c8499c86ef9c,0x000025d448044a25}},
+},
+{ /* slot=9 [{1,2,3,..,16} * 32^(2*9)] * G) */
+{{0x000253a6bccba34a,0x000a13838219b80d,0x000882e3963e61c3,0x000e66f90c3b6019,0x00001c3d05775d0e}, {0x00086f40216bc059,0x0001d12bcd87ecda,0x0007c709901fbb23,0x0002e55b4956a9e1,0x000038750c3b66d1}, {0x000ef1409422e51a,0x0003c2b5df671692,0x00044ce029cbc0c7,0x000487c21014fe77,0x00000621e2c7d330}},
+{{0x00002b4b3b144951,0x0006b444bbcb3575,0x00066385db8e67ff,0x00095c8b8bd69271,0x000013186f31e392}, {0x000147ab2bbea455,0x0004f92079129893,0x000e30f7a78c53a2,0x000d43d4b49f948b,0x000012e990086e4f}, {0x000c96b37fdfbb2e,0x0005e121ceaf9f10,0x000a5b983f9f9a93,0x00099afdf1136c43,0x000077b2e3f05d3e}},
+{{0x00054a12dac2cb00,0x00040ff5414615a6,0x000abacb75950cae,0x00071b6f304c4ca9,0x0000538178696a4c}, {0x000c4f287ee8821a,0x000799747729d906,0x00010ff53e8e6a2b,0x000b9b2c2118a30e,0x00002ba3cfe49da0}, {0x000f283178fa4e49,0x000edaf9832fa20f,0x0003a5c84d223af5,0x0001fa2ebdade079,0x0000381fac8a1b63}},
+{{0x000d75879cf12657,0x00094e53a0e29fd0,0x000bbb4be7e82fef,0x00038a2cc34a7f05,0x00000b251172a50c}, {0x0002f48fcc5cd29b,0x000bea3ce3671953,0x00011229412ba851,0x00004f232dacaa05,0x0000478d99d93500}, {0x000ad94890bb02c0,0x000b10ec251151d5,0x000ef2170250e208,0x0004805a26a22894,0x00004dc923343b52}},
+{{0x000105293da94e06,0x000f41e623c6634f,0x000fb6886589ae46,0x000f87fbeda080d8,0x0000755176f3b4b4}, {0x000dc3ee82da81c8,0x0001a01ce747306d,0x000db6d6b3b1ed1f,0x0002235cf27bf804,0x000009a32ae02246}, {0x000582ee731bb879,0x000b75d9990ba6b5,0x00092a7706c3f99c,0x000c17fa276caa65,0x000074fea9604c8e}},
+{{0x0002ca591ab016d8,0x000b196c189751a4,0x0002f54837e42ac0,0x00066aaf20187e1b,0x000044f879ced649}, {0x00088134d3f6a924,0x0002702523db17b8,0x0007ed0535d81a5d,0x000ff1a50665d94a,0x000053f4b9e75ad8}, {0x000380ac92259e82,0x00065e2073d1c0f9,0x0009f29bc93de824,0x0002d1420e4a9450,0x0000186cd4582917}},
+{{0x000b2bb568de83a7,0x000a4765a6e07d24,0x0008419825c9a30f,0x000387a1f25cde55,0x000012bebe097070}, {0x000c6c9ccae52923,0x000ad8f36a1e793e,0x0007df23ec1d3431,0x0000c7c5c6890e13,0x00000626dab9f088}, {0x000b6c5fbe8992be,0x00087e7a7886f6ae,0x000bb0d0414a5afb,0x00026f38a6e048ac,0x00002128ed3e40fd}},
+{{0x00028c400f8086b6,0x000f7979f0dc8e38,0x000df42cb43f77e6,0x000d7847ef6de304,0x00005265797cb6ab}, {0x0003e3ebf36c4975,0x000a5378621253ad,0x000025a516d75d25,0x000c847e873943da,0x00006bbc7cb4c411}, {0x000f9cd1d4a50d56,0x00077c6feab7e3c6,0x000580972eb62440,0x000acfb6ff9bf483,0x000000375883b332}},
+{{0x0000508546bf44ba,0x000e4c8143488a93,0x0004441ecbc676e4,0x000106e5880eaf23,0x0000659fac04e9a4}, {0x0005584fa8e3a052,0x0008d48fc049e1ac,0x000e5015eb6cc51a,0x000b94dd428a9225,0x00006cb64137f074}, {0x000e128a79d7bba9,0x0009020695c7efe8,0x000bc5d393aa2969,0x000fd8ffcda975bb,0x00004504e14e20ae}},
+{{0x000aca2530166bf7,0x00003c02169cef8f,0x00065fb9a30c96ea,0x000ca0deb13e668c,0x00000ebb6e298d96}, {0x0003b4ecbf4df71f,0x000ba1251c44acc1,0x0003825bca3cf056,0x000923d97cbbaef5,0x00000155f595e409}, {0x00091039a9ed9d6d,0x000381aad533490f,0x00044e472960a180,0x000cacf79f4d4bf1,0x00003799d4aa46cc}},
+{{0x00046ff99ba66de2,0x000306280abc05d6,0x000b15684c3ac550,0x000cc84e7ed589bf,0x00001900a43a3b52}, {0x00075b53dc640f04,0x000ac6a666376696,0x000970e39efad089,0x000085b6ba4b5172,0x00005c78d4483a32}, {0x000d650c1c73650f,0x000c97a79e7e45b2,0x0009640a6f40c1c5,0x0001166d7bea4235,0x000000bd2a877c17}},
+{{0x0001b2cd28cb0940,0x000a06f1c24c9000,0x000cd5ca3163fb51,0x0000660b5ad8691d,0x000067238dbd8c45}, {0x000bec856c75c99c,0x000c000e33cf4c98,0x000a907634e44184,0x00079d70a676b9bb,0x0000669e2cb571f3}, {0x00016b73a49bd308,0x0006b2392729ecb1,0x000f55d9b1025aad,0x0008bb9b4793efa3,0x000072a105614067}},
+{{0x000819948da7d515,0x000658c4d4a4d131,0x000fa5fbe6db75d2,0x0000bac82f2f9fe9,0x00000b2839d22d7f}, {0x000264363b7e27de,0x000077e3de6eb3c3,0x0000980bac1a7512,0x000dff2f4f4772a0,0x00003119f1fd5d0f}, {0x0008803d60278702,0x000952cf9db1f2d0,0x000fb78ace5aaa6f,0x0004fcbaed06af20,0x0000112caf8d80be}},
+{{0x000ca88d8919ac5c,0x0009138e17fa44d0,0x000609fb258753f9,0x000e01d89c9955dd,0x00004e6ec333a20b}, {0x000eb990b6f5b607,0x00006630bbdeab9e,0x000ac9aa62043615,0x000d0fac17501215,0x0000773e8d3612b9}, {0x0007834bc40f7a0e,0x00071796494e91dd,0x000b264d1f9a8833,0x0006f5e7e6c6c3a7,0x000003d1924a0fc2}},
+{{0x000b3576632eafbe,0x000fc7a4ea1f81e4,0x0001b87acdca36a0,0x000e9f3479c36896,0x00006eb315bce5fe}, {0x000f747281ff2d06,0x000a40be5c45d706,0x0006dc6b91e782bb,0x00097b4c91cb9adc,0x000013b76649c9ca}, {0x000dbba62d30abd2,0x0000c1cc5fa03247,0x0007fcabf1cd069e,0x000a1ce8eb224a23,0x00007e3d761440f3}},
+{{0x0006812b1cc9249d,0x000ee21211f58a2b,0x000df10ece62866e,0x000ae002cb5c5b85,0x000003a6b259e263}, {0x000d2909e2e505b6,0x000abc02912300d8,0x0009b1232798ca78,0x0009b4777ef5569a,0x00007c77897b8143}, {0x0001b5e2de331cb5,0x0008e15fca420f1c,0x000bd932b15a9f5d,0x00046e79fa438f17,0x00002a381bf01c61}},
+},
+{ /* slot=10 [{1,2,3,..,16} * 32^(2*10)] * G) */
+{{0x000cd613efa9d697,0x000a41c0679597af,0x0001fada960cc45a,0x0000365a56fe104c,0x00003a73b70472e4}, {0x0006e56b9e2d4734,0x0002b81c616757b2,0x000c9cde7fc4c713,0x00043adef5c9525e,0x000039c80b16e717}, {0x00096e0d1b826c68,0x000e24960e3db0f1,0x0003b7436cf71ff0,0x0007282611316702,0x00000cf0ea5877da}},
+{{0x000c80a4ddd4ccbd,0x0005d95f2dd9d196,0x0000d6c71b22e6f5,0x000042fc75e33c74,0x00007bb51279cb3c}, {0x0002ced43ba6945a,0x00061e881c05de33,0x000e67ed3bde0b13,0x0003d5d1ad40f095,0x00005da8acdab8c6}, {0x0006664a3a70159f,0x0000f0a904e14c4b,0x0004096c1376194f,0x000eceda5614c39a,0x00006cd0ff50979f}},
+{{0x000067e78f4428ac,0x000b0a61135e3c0e,0x000806293514835a,0x000849cf21d14f33,0x00006390a4c8df04}, {0x000cfabdb04ba18e,0x000fc3bddbcf77fe,0x00057a131cd0fc7b,0x0003a61a41d486e0,0x0000641a4391f222}, {0x0006b95aa606a8db,0x0009eb06825f1c5c,0x0004fc9eff914b7f,0x0005cfc2a731f6b4,0x000030ddf3856270}},
+{{0x000dcbdad1bff7f9,0x00082206457174e3,0x000f189d56c9118e,0x0007668bacccebc0,0x00001b4822e9d446}, {0x000ef2bd68bcd52c,0x000b069482ef233b,0x0001cb1aeec649db,0x000a7e5b5b6ee0c4,0x00005c294d270212}, {0x00060a7f25563781,0x0008a480f7958ab3,0x000114b4e3251222,0x000fe2ac75d05276,0x0000222d9625d976}},
+{{0x00017f85b372ace1,0x000694638bf181c7,0x000bc08b5881930e,0x000fff4239cad056,0x00000b34271c87f8}, {0x0004be7e0a344f85,0x0008c87f22c380f9,0x000ee16f0feb2faa,0x0008dea9ce1e75e4,0x000043e64e5418a0}, {0x0005e2521a35ce63,0x0004df912028e815,0x00057ddcecbe100d,0x000c6e4bff80bf8a,0x000057342dc96d6b}},
+{{0x000ef065c8ce5998,0x00010b5cbeaa2efe,0x0000b7c458bf0295,0x00048558c64a1062,0x000035134fb231c2}, {0x0003bcb71e707bf6,0x0008c7291a762f3c,0x000ad69a33351d9b,0x000807f00502e6ed,0x0000522f521f1ec8}, {0x000c1f46f9a3902b,0x000b799657bcc272,0x000f8a1c0ec91ba3,0x000017bae614b304,0x00007afcaad70b99}},
+{{0x000ded54a4b8be41,0x000e11bb0e2ddc25,0x000de82ab2902d13,0x000e7cb41f43233c,0x00001085faa5c3aa}, {0x000141ecef842b6b,0x0004797abe6c5a88,0x0003784ffe55e7b1,0x00000b78c748f970,0x00005b50a1f7afcd}, {0x00040f66f1361315,0x00042701003e99b8,0x0004a25080184622,0x000732065ed45fae,0x00000a2862393fda}},
+{{0x000b13c8347cbc9d,0x000d499c1238346a,0x0007d64ac93849e8,0x0009ee74cea31408,0x00001f354134b1a2}, {0x000e737b6ecb9d17,0x00048d67ceae1960,0x00055e1b89faf249,0x00059eb37e7a9b4d,0x00005cb7173cb46c}, {0x0009e68b82b7abf0,0x000279ba6b7b94a8,0x00018d876ff41cd9,0x00009c616e6c210e,0x00007cacdb0f7f1b}},
+{{0x00077fae780c1c7a,0x0001ec84f7cc852c,0x0005298384ed2487,0x0002000c9ef1b003,0x0000520d4226f15e}, {0x000b19771a094304,0x0009cec284fcdd58,0x000ffc840e93bd3f,0x000ae624852d9523,0x000024c6dbc6ea80}, {0x0004679cbfe90581,0x000f14d0ee9385d5,0x000f75d3fa651537,0x00025f5f9229ff4a,0x00007b1216f5eb60}},
+{{0x0000c483602bd648,0x0004ccec93bd4f6d,0x000906c6d7c423de,0x000fb091120b11b7,0x000067eda79a93aa}, {0x000968de4331ee65,0x000a8e66d27fda98,0x0007d9872caed850,0x000e23925551c4af,0x00004c8a726ec39d}, {0x00070806a7d02c75,0x0001466b14e90b09,0x000bde6598be72ad,0x000ab17abbb2bea7,0x00007a9e35523b1c}},
+{{0x0006d71e46f59597,0x0001a5f3faa6c64a,0x000a5cf37e0a0e65,0x000d852cb09df547,0x000058e7a1a3e7b5}, {0x000e6d0abf8b8af4,0x0004e18e68269b65,0x000d6a5245b8f865,0x0004dabe3d0c0705,0x000000bdf11e6e67}, {0x0006473ff43cc476,0x00097c05856ffba7,0x00062dd6752ddd31,0x0001e116e77247cb,0x00005203a80ccce2}},
+{{0x000faa3b3d3bf8cb,0x0007b85ce3ef93c9,0x0007128a1d92bda3,0x000e27d022436fd9,0x00007e05b83ce996}, {0x0000752e4ea74da6,0x00075f493ec22551,0x000ae489f408586c,0x000fc8fa2f9c5109,0x0000132cec56efe6}, {0x0003d3bb526f3702,0x000114341c4c8139,0x000f51c300a36d27,0x000b7a1ec6fd4057,0x00003a2761e52a63}},
+{{0x000c9f4184807894,0x0000f77c7a7bf830,0x000a73602418527b,0x0004973845a30a69,0x0000221aac4ec38a}, {0x0000dbb277cb64af,0x00086088bc380ffe,0x0007b7894cfc3f4c,0x0000d5c52b9b20ad,0x00000971548537da}, {0x0004902dc4190ea1,0x000b8fcf93525a89,0x000c342e4de68f23,0x0000bac2e30dd7e3,0x00005ac25a7e59b9}},
+{{0x000fe92c63308134,0x000d11f03deff66c,0x000bd35ab41af35f,0x00034b13f7542ea9,0x00007c86a4f6dbc5}, {0x000c66c0fcbfcac0,0x0008d643bc1adbfa,0x0007adb834389f65,0x000f2a9e13eb79e8,0x000052ae510d0308}, {0x000b7a59cdfdd59d,0x000adc695ae8f80b,0x000deb21bdf924a7,0x0002fcb8eda2c888,0x000049602bd3b7c3}},
+{{0x00070a401b3a3936,0x0000749e9e19d9c7,0x00010995a7dbae94,0x00019435934c19df,0x0000742b9faf0bdc}, {0x000324325464995d,0x000dad2ea59b4768,0x000819a0045947c4,0x00006f3aed56916d,0x000076b1c324be42}, {0x000922d087f905a3,0x0003b1078d30aa58,0x00033a29c28c7f60,0x0006f2c5095ec422,0x00004533c94ce3c8}},
+{{0x0002b2e0d91a78bc,0x0009cc8509667906,0x00005070b847c988,0x000a1bf9df54a664,0x00007369e6a92493}, {0x00014434dcc5caed,0x000963c84fb33e10,0x000d86a0e747ed5d,0x000f9e470019576e,0x000025b2697bd267}, {0x00073ffb13986864,0x000d9415dc7b89d6,0x000f273b5e3ca5fb,0x0004cd2e04ecc3bd,0x00001420683db54e}},
+},
+{ /* slot=11 [{1,2,3,..,16} * 32^(2*11)] * G) */
+{{0x000a50b9d85c0fb8,0x000258bcf097b751,0x000309a969d1afdc,0x00006592f16a6a38,0x000014ddff9ee5b0}, {0x00070996f12309d6,0x00085e9c3d539d6d,0x0007552411dbfb23,0x0003e0c46d602b0f,0x0000270a0b055784}, {0x000f0640a7862bcc,0x0009a5f11abfe61f,0x0005d12abb81cac0,0x000e873904783045,0x000019a4bde1945a}},
+{{0x0004e93563144691,0x000a0d61f23f4dc8,0x0002a9a8d5632fe8,0x00018d34caa80061,0x000048f9dbfa0e99}, {0x0004b3333a8a85f8,0x00089e78d7d58d59,0x000e8e351f4ea376,0x000ebb473bf9f455,0x00005507d7d2bc41}, {0x000b2903299572fc,0x000a29502d0ee1ce,0x0001cce67b7c8cca,0x00031e791bfa4341,0x00005784481964a8}},
+{{0x0003134729dabc56,0x000a26314566b845,0x000a66b4cbb19385,0x00000637d73f7579,0x00003e70c42ddd2c}, {0x0000137c630b94ca,0x000e2c34e035923b,0x000f6850ab9f05b2,0x0008e5e5c504752d,0x00004e165fe78314}, {0x00033e88e5d5b328,0x000f8e58a8ebf4ac,0x0008c8c3a164653b,0x000c2215832177c9,0x0000621d49cdc3b2}},
+{{0x000c2b256768d593,0x000574422ca13da7,0x000a0ace1d98c1c0,0x000a690f1a80bd5c,0x000029cdd1adc088}, {0x000fd1ef5fddc09c,0x000fdf7575dced6c,0x00001634c2e82b3e,0x0002b9b25d56b5d2,0x00003041c6bb04ed}, {0x0002f2f9d956e148,0x000759f356b2e0ff,0x000f6c025cade797,0x0009a7b1a4698bb5,0x0000104bbd681404}},
+{{0x0009a90c6ea464ee,0x0001eb1c46127f11,0x000f2531b7ced877,0x000a817d21a4fe6e,0x000076ce9a42f459}, {0x000693607d862f24,0x0006fe3322e53368,0x0004092ec6474a99,0x000ee416fbe91701,0x000043429d86b998}, {0x000f62ca47a19d7b,0x0000bd8c36c8b413,0x00099ae711cd1b4a,0x0005cff2623e2a01,0x00003ece61dd366f}},
+{{0x000b760d9db5f9c3,0x00070caba5121c35,0x0001f74c0964590c,0x0007488458d8a934,0x0000745062a5ec26}, {0x000352d8c543dd6f,0x000624e9a7af73b7,0x000bccfb9ce96c16,0x00016337916da27a,0x00006d16a65382f9}, {0x000e980c1ecffc41,0x000c7e0d49f06316,0x00087c8e61c7b4ab,0x0005db59fd5c247c,0x000077d76a5aacb5}},
+{{0x000616c2bae6bea0,0x0002a3b221e6bc27,0x0007ea4f3bb9de19,0x00056cdf8e883608,0x0000261d6f4d87c7}, {0x000fcaabd000938a,0x000fe9cec5e98aa8,0x000abccf571240ef,0x00007f9c49495f15,0x00004d35815daaa1}, {0x000bc52d50e2a4eb,0x00004c067f66c2f9,0x0006c72c35a2d7e2,0x00022e7153a318db,0x00004d93e0f3ff4b}},
+{{0x0000fd3168f1ed67,0x000cdd86f3bc251f,0x0004d2f2de2c811d,0x000714944dc5c430,0x00005be8cc57092a}, {0x000d9a5fd67ff163,0x0009d4cc75681a95,0x000e20f257e92be6,0x0002df5b7f8024cd,0x0000204f2a20fb07}, {0x00043b3d30ebb079,0x0005abd652e30c81,0x000f6d5c31758915,0x000161f653c3c318,0x00002570fb17c279}},
+{{0x000bf83dcf6f5fd8,0x00078a2f04c8d07b,0x0003710c63fb5c26,0x0000a65a3093ed83,0x000012cf2b5e098e}, {0x000282627009c961,0x000d9ab16ca306ba,0x0005b2897c1536ef,0x00052987ee470fdf,0x000050286df764f3}, {0x000cc0f42a339d72,0x0004592461553a0f,0x0004e42a339581d6,0x000030ad3df4000c,0x000009d57371a58b}},
+{{0x0005ec6a5d0dde05,0x000d274062bfe9dc,0x0002e77964a46291,0x000c334de407c637,0x00006da2f9fa7054}, {0x000d7430ce6de65c,0x000462337d522cef,0x000f72af62a4c87b,0x00048cdb298f0934,0x00007769f56b018c}, {0x00015a7b9397d6a5,0x0003de97f5226e46,0x0002a8e8bb79e86e,0x0009d94c5b3c02bb,0x000038b3aa080482}},
+{{0x000b81654b7ed1da,0x0000eca7c9552717,0x00007cc9ad2eee0f,0x0002a6872ed662f4,0x00001e63427335cc}, {0x000dd2a031841df1,0x000dd592248fe0d4,0x000a0d84c84eca7e,0x0005580b74fe9a71,0x00002519f06d8c1d}, {0x000176c0b14e503e,0x000b93d257610980,0x0002a140736429c6,0x0009873e2c88b83f,0x000007be6dce3de4}},
+{{0x000a367f2cb61575,0x000761cd6026c3ef,0x0005b52562f5f96f,0x0000acde8c7142a6,0x00003dcb65ea5303}, {0x000ea9550bb8245a,0x000a88f9050d1192,0x0008a4c935c8e6fb,0x00086687986ea2d8,0x0000241c5f91de01}, {0x0008172940de6caa,0x000f022d9733a28d,0x00035b01d18fbf2c,0x000f0e516d7fcdd2,0x000008420edd5fcd}},
+{{0x00043a0f9dba2ae4,0x0001545e981a914d,0x00011773dc2a44e0,0x000a5e6e7799aedf,0x00002d5afbe9bafd}, {0x0001bf1d976a862e,0x00031aa317ba9ce8,0x00082f842786d9a2,0x0005a40103ea57f1,0x000005c2acb11f3b}, {0x0007f6374abe8e98,0x0008eb016ef6fcd1,0x000a89c7e34d86b5,0x0003878c901d6e55,0x00002e431a634d9d}},
+{{0x0003886ca9497d9c,0x000126431dd17d89,0x0007d8f4551c1d55,0x0007ea23bec9af3d,0x0000763c42a196bb}, {0x00090ea512ec4ae7,0x000e14b8dc445621,0x0005216018cd392c,0x000207a3bf7360f3,0x00002f6cbedbf17c}, {0x000f2e37fd5d240f,0x000933075af850a5,0x000b861d4fe72e50,0x000af99e044dd092,0x0000558e55f50cae}},
+{{0x0006f837ba787ed2,0x0001f2852a27ed25,0x000cd27f2733fb60,0x0003283f8b66dd9d,0x000026df30dfe44f}, {0x0002e2e5e58577e2,0x000a6a5cb012ea21,0x00097656f13203eb,0x000796f91f9efbef,0x0000477d637f7929}, {0x0009f74b5d14eedf,0x000bfd001836b0c7,0x000588a2c5471f90,0x000c9049004de6e8,0x00004501075a2d19}},
+{{0x000f20ab8362fa4a,0x000d4e21a3e6ecdf,0x000c39e62b57e118,0x00069fde3179617f,0x00000d9a53efbc17}, {0x0008c34e04f410ce,0x0005a276e0685035,0x000bb91521b6135b,0x000889c5d9670c7e,0x000004d654f321db}, {0x000dc116ddbdb5d5,0x000b68da5dd2d5e7,0x000334a2922954de,0x0001ad71cb608173,0x00004a7a4f261899}},
+},
+{ /* slot=12 [{1,2,3,..,16} * 32^(2*12)] * G) */
+{{0x000e9624089c0a2e,0x000c03afe4738239,0x00064fa12ac748c4,0x000858217dbed2a7,0x0000639b93f0321c}, {0x000f788f3f78d289,0x0002ca1404d9fc08,0x000f65cc9dfe30a7,0x0002021f2778bfcc,0x00007ee498165acb}, {0x000508e39111a1c3,0x000d4809074897bd,0x000e72fd192b2b90,0x00002a6e7d2aec2a,0x00000edf493c85b6}},
+{{0x000c8158599b5a68,0x0000febade20eaec,0x0002b67f07ea574f,0x0004fb44fe41d742,0x0000403b92e3019d}, {0x0007c4d284764113,0x0003ff7f5f835676,0x000ae6bedea09040,0x000a3691c8fcffac,0x000004c00c54d1df}, {0x00022f818b465cf8,0x0005a1480eff84dc,0x0004c7d65771a0f3,0x00076f4aee8bfad0,0x0000355bb12ab261}},
+{{0x000e64cc7493bbf4,0x000d9eca3b0c3a71,0x000a05e785e5bd84,0x000c3120a6bc50cf,0x00000f9b8132182e}, {0x0001dac75a8c7318,0x0009db3ceaa11a30,0x000bae3f2ded9003,0x000ad8e6f077cbf3,0x00007518eaf8e052}, {0x000859c41b7f6c32,0x000bcf4383298a48,0x0009b1d1d90f2d60,0x00055c41815a929c,0x000047c3871bbb17}},
+{{0x0004539771ec4f48,0x0007dc98c5d6e514,0x0007c3c66bf805b1,0x00099dcf762c11a4,0x000000b89b857646}, {0x00065d50c85066b0,0x000b0b3a299b0fbe,0x00041ae8e062ecc4,0x0008d5fe53754ea4,0x000008fea02ce8d4}, {0x000ddd7668deead0,0x000204b685d23824,0x000d89d665c86445,0x000d537b514cfcd5,0x0000473829a74f75}},
+{{0x0002da754679c418,0x000d8b2618df082d,0x000c47eb0ae63bd7,0x000c6b4355eef24a,0x00002078684c4833}, {0x0009533aad3902c9,0x000ceef03588f23d,0x000fe12fb464c2dd,0x000d39015257390c,0x00006c668b4d44e4}, {0x0008cf217a78820c,0x000b281273e973b4,0x000c8eed7bf76a0a,0x000433fa96c65a78,0x00007411a6054f8a}},
+{{0x00059d32b99dc86d,0x00075603af1154d6,0x000cc2e488044cdc,0x00034ffb34c712cd,0x00007c136574fb81}, {0x000ae53d18b175b4,0x00059f392a102579,0x000eef35f5687131,0x000398f8455ecba1,0x00001ec9a872458c}, {0x0006a4d400a2509b,0x000020bc882b4b8e,0x00019575619b81d7,0x000646057e7cc9bf,0x00003add88a5c7cd}},
+{{0x00095770b635dcf2,0x0006cf66c1fbcab8,0x000eb6d18702dfef,0x0009e7485530268b,0x0000249929fccc87}, {0x000298d459393046,0x000985ff659ec85c,0x0002f66e3a8f7e35,0x000a7201d2ca22af,0x000061ba1131a406}, {0x0000a0f116959029,0x0006cba7ebd89a3d,0x0006783307023b6b,0x000ece77bf15a3e2,0x00005620310cbbd8}},
+{{0x000993434934d643,0x00006a51222f5528,0x0003f41c22b9dbf8,0x00097308f6d878fc,0x000037676a2a4d9d}, {0x0006b5f477e285d6,0x000676c8f6193664,0x000bb594dd40e8ff,0x000ec4da6ec7311a,0x00007ec846f3658c}, {0x000e8f3f1da22ec7,0x000776c01cd139b5,0x0002989fb8130f1d,0x0009dd5214c8fcfa,0x00006daaf723399b}},
+{{0x000720592032e20b,0x000025f89ef2ffb6,0x000fe3a169a3b198,0x0002031728f23394,0x0000213a9c7a5c88}, {0x00015ad72357c57a,0x000c37428e48ac48,0x0003c110e0a72841,0x000f918a4fe3a26a,0x000038fc45179973}, {0x0006bc83af3ca4fd,0x000e027a99ff67f0,0x0007a06712792758,0x00078f9da1f5ef63,0x000008b4cc40feda}},
+{{0x0009d034a88637e1,0x00057d4899b52445,0x000d06ade8b5d905,0x000137b495b128b7,0x000042517e7c6339}, {0x000237918db9016c,0x0000a278e253ea47,0x0002dc75eec49eeb,0x00039746fbf68f28,0x000067f65ee35bc6}, {0x00004dc87e976952,0x000e090616e9b0a9,0x000a3d9882508b13,0x000cca887f92500d,0x000071a1132c13b8}},
+{{0x0007471d1c8ec3a6,0x000c34fbd6fadd1f,0x000e5212b463de58,0x00045afabf2c1437,0x00000b894e91e5bf}, {0x0002516141a0dc3d,0x00039492a5dccd06,0x000dc575a5ba9d94,0x0005f70299f7c9d1,0x00002243fff87a86}, {0x000f8f139a1d052f,0x0003eb0cb461052e,0x0001a48a4a3f4916,0x0005c7239a31b6d9,0x00006b0b4761d23a}},
+{{0x000e2cceb7160ffd,0x00086c62a82bd083,0x0006a1a911b33336,0x0007eeab15533da0,0x000042e5c04acb13}, {0x0002b594b65c224f,0x0004e42564e3663a,0x0004f210d6ecd076,0x00043be391a1a8c3,0x00002e1a955b7d95}, {0x000d574e4831c376,0x000f91c09d1c144f,0x000670c106f749d9,0x000ad8a06af2c5b2,0x00000f7bc2188e50}},
+{{0x000ca6ef739a2535,0x000cf8abc48eebde,0x000a2ddb173126e2,0x0003dd117b3f7b5e,0x00002ad5b215d705}, {0x000e812f83865ef8,0x000accd2ebfa1056,0x000175c3b9986097,0x00077da48c4414d0,0x000007abaa4608d4}, {0x00038997e95d110d,0x00028aaafc938663,0x000f0aa2d2e61ea2,0x000eaface8ac50df,0x000066382115d607}},
+{{0x00027eb17d43f08b,0x00005350b6460797,0x0008fd238d98cf24,0x0006ff013cff37c8,0x000034123c156504}, {0x000488ee9ed3db11,0x00047d3b64bc079d,0x000500f82c182fc3,0x000c91acf266f8c8,0x00007ae19a742662}, {0x000ba44a002ab527,0x000413e0bc32ba95,0x000ff68575be7b4a,0x00031a8129eac01b,0x00005050dc93402f}},
+{{0x000ca61ca213efcd,0x0000131244fe75ef,0x0000b146bbabd62c,0x0008239c79c8b16b,0x000010efb4f1ca6b}, {0x0008b27c844a8843,0x0009106aff2029c1,0x000abc6c69a6872f,0x0006884b14f08669,0x00004d4b8217df44}, {0x0001f9a743aa8b23,0x0007d65bb9ad5d50,0x00003c9cf3e1daf3,0x00062e7bfc087a34,0x00007c2c3de9b420}},
+{{0x000e4a5610628564,0x0007ca8b4df34591,0x0007a38e432a4bb8,0x000046ede2a2572e,0x00003cbdabd9fee5}, {0x000ebbdd2cd13070,0x00025f85a0e9e81a,0x000adffecb962e43,0x00030e6de9391aac,0x000053177fda52c2}, {0x000c970650b9de79,0x000fbc301b59ba7b,0x00036ae38c3d12a7,0x00099dc02652e68d,0x000079d739835a61}},
+},
+{ /* slot=13 [{1,2,3,..,16} * 32^(2*13)] * G) */
+{{0x0008b0f8e4616ced,0x0000e9e25a87dc3a,0x0004bca59cf70066,0x0000be961e3061ff,0x00002e0c92bfbdc4}, {0x0008f6d97cbec113,0x000e674bfdbe49d1,0x000c4e60d6844a06,0x0005e5120f5b522a,0x0000720a5bc05095}, {0x000f09439b805a35,0x000376242abfc0c3,0x000c229346e84e8b,0x000f0ec691417f35,0x00000e9b9cbb144e}},
+{{0x000eb24194ae4e54,0x000511857ef6c44b,0x00068d04985f541c,0x000f7aba61e6b2d3,0x0000445484a4972e}, {0x000cd91db73bb638,0x000aafc129c08962,0x0003b61689e60577,0x000ee816f619b39f,0x00003451995f2944}, {0x0002fcd09fea7d7c,0x00094b0935cf6915,0x0007285c404a816c,0x00093b7258e9aaa4,0x000010b89ca60428}},
+{{0x000a2120bf310f6e,0x000182154ef4e532,0x0001c7710ce6e815,0x0009d9b80da4db2a,0x00000ac2129186a4}, {0x000adfbe60e27cd7,0x0004f3b9ff9aea9e,0x00007f8bda481c5d,0x000961797d27cfec,0x0000346f01acd286}, {0x000700075cb01065,0x00075a28106b2d88,0x000fe2336c423079,0x000fd694768ac983,0x00000970c3f002e3}},
+{{0x000a426e3b646025,0x00090385ce4cf9b2,0x000d6dea45321271,0x000de75a25cffc2d,0x000006409010bea8}, {0x000cded679d34aa0,0x000c0cc4db39fd67,0x00035d190fcc0b9e,0x0006fefa535a456e,0x00002e05d9eaf61f}, {0x0007901ad61beb59,0x000bce5dc880ac44,0x0007ca6827661f19,0x0007f2624685482b,0x0000293c778cefe0}},
+{{0x00055077bba9d1cf,0x00053036f67dee05,0x0003d5b1d3527dc8,0x000de6de09c2a13b,0x00004f9b5a5b384d}, {0x00063b43896f9346,0x0002825b1f150ee7,0x00065a104f9c019c,0x000404520fed32c0,0x00005c6ac6f20218}, {0x0004fb81703b3a97,0x0008f6b75fbee03d,0x000114662fd34ad1,0x000f50bd70ba52c3,0x0000116ade0f0c3a}},
+{{0x000eee0fe838ab22,0x0003da1be148b795,0x000a83201f1d1f7a,0x000137d937159234,0x000046785f6e9e09}, {0x0001324bff709850,0x000d955bca9891c9,0x0002368013009634,0x000be032f371874e,0x00006cb38c89e457}, {0x000e83eca129234c,0x0003709f08b4aaf4,0x0000912e37df1833,0x0006ff6311c59d36,0x00007bba5431bca7}},
+{{0x0000952982e7bdab,0x000090631c0cb295,0x000add99b4012ac6,0x000503c4c39e0a61,0x0000082b3d95b81d}, {0x000354fdf67dbb72,0x000d6bfa0a80a397,0x00071fdef13cac00,0x000004b565e0c351,0x0000786c11f422b6}, {0x00054bc1c835b149,0x000cc3ccc3a31eab,0x00088516f1df0501,0x000ec67545b6109d,0x000079593a61efc2}},
+{{0x00009e7007069096,0x00015e4e50189868,0x00021a0147aad75b,0x0005d5e07f35715a,0x00000487f3f11281}, {0x000795d6a11ff200,0x000e2b15815c916c,0x000b5395b5cb70d0,0x0007b4f89f293209,0x000050b8c2d031e4}, {0x00050c08068a4962,0x0005351092c9a483,0x000f6fc8dd6ffdd0,0x000a58b17af4f4aa,0x00004b0553b53cdb}},
+{{0x000e2f2f2593e409,0x0001c6f153c7985c,0x000d0d44fffc4f1c,0x000a9ed43ebf62e8,0x0000502ddb71bb9a}, {0x000dab65f3f624fe,0x0007668f9c4759a5,0x0009b5096bc3b6e6,0x000589b7993e0011,0x000059de00448918}, {0x000e1eb21320283c,0x00054513060eefdf,0x0005a0587da4550a,0x000dba61e845b066,0x00004560794d369e}},
+{{0x00043460eaa08de2,0x0006087e3d5c1b1f,0x00065152cb0d2183,0x0002e8e15f6272ae,0x00002071b5f318a1}, {0x000e457f0b1a90da,0x0008d3eb359d6e89,0x000398bed0ef06ce,0x000cbaa9f10efc5d,0x0000024d127c0b1c}, {0x0004b50084927524,0x000b297c70357a50,0x0008931553e33633,0x00054cee2a53c02d,0x00001d140135e652}},
+{{0x0002c35dfe727026,0x0001083bba50c675,0x000888afb2e31b53,0x00070744d217b04b,0x00007180771c829f}, {0x0002e35e5b95f14d,0x000230da55379566,0x000ddf6878b252e3,0x000a938d8d589f9a,0x000035982724cabf}, {0x000b64f2ddc97340,0x000043b30cd774ad,0x000ca5db5004ef65,0x000ff9eb55ceb78f,0x00006f6efdcbe76e}},
+{{0x0005fcbe1b32ff79,0x0009f03b50f9b9c6,0x000c07e606eb75ea,0x0007908fced2a6c6,0x000035106cd55171}, {0x0005211b27c152d4,0x00049bd1af639bf0,0x000e6fab985ec268,0x00008405e0b2caa8,0x0000054c8bdd50bd}, {0x0000b12f1dcf073d,0x000a3b7f6a27638a,0x0003404f9a4b60a8,0x000c229fed5ac25d,0x000072e82d5e5505}},
+{{0x0001cbb8ab6befcf,0x0007f02ad2e2e9fe,0x000b282061c81fcc,0x0008dfc67779da5a,0x0000199cc3eb9529}, {0x000765296c75b946,0x0003879bd17d873d,0x000b3420858e4c8e,0x0005ed288e0b82a1,0x0000176e80feafd6}, {0x0007d38dc8893b1a,0x00079144a07fbdc1,0x0007d1439e0bea94,0x00049394ae9b1b87,0x000007a91d9445f8}},
+{{0x000754e1f471f7dd,0x000c92b5bf106efc,0x0008e90987080222,0x0000c3a0676e6172,0x0000597ea4c5cb2e}, {0x000a3a631c0053b9,0x000c129f01e5cde5,0x000986d3a930acb6,0x0009be0b9b3a7101,0x00003ad2c7546b76}, {0x0005aa028b43f0ef,0x00045b5c50642234,0x00078f51ceade79b,0x000bba14a057c653,0x00002f35bdda16d3}},
+{{0x00026c0c0f266c17,0x000f72cee8614fd8,0x000dd6b730404fc1,0x000f9c4a66f8060d,0x00002d68905794a8}, {0x000f3104fd45f3c8,0x00045a5b02f86618,0x000b274d45dc6b1d,0x000b3aa8ab069671,0x00000385da9f416d}, {0x0007ebbe0b574c75,0x00036d062e37a900,0x00033a17a52bb041,0x000ca61f3ac04bae,0x00001469bc10e9af}},
+{{0x000b697ff0d844c8,0x0005cd979cb496b0,0x0001da0f1fbb12f8,0x0007211d2a541c6c,0x00007b7c242958ce}, {0x0009cdfd69771d02,0x000cd6cfbf17e00d,0x000cb12ec7410276,0x00008614c45306c1,0x00002857bf162750}, {0x0001903f0101689e,0x000d3bf8610059f2,0x000deb0f1bd779df,0x00000d4a122ee5f3,0x0000510df84b485a}},
+},
+{ /* slot=14 [{1,2,3,..,16} * 32^(2*14)] * G) */
+{{0x000c5303f7957be4,0x00020e085c1450c9,0x0000850050a3c31a,0x000f2dab0721d71d,0x00000aba390eab0b}, {0x000fdffe638c7bf3,0x00060388b4995529,0x000bad0249df2b9e,0x00074ede027b34f1,0x00007bc92fc9b9fa}, {0x0007ef2e801ad9f9,0x0005479afda3a9f9,0x000d596b5083697d,0x000b8e0e906b3ffb,0x000002672b37dd3f}},
+{{0x0002ca8b260885e4,0x000ec82b34c1c48b,0x0007f58f74a4286b,0x000a2a5937e1a261,0x0000741d1fcbab2c}, {0x000ba729398ca7f5,0x000257a4849dbee9,0x000ec544e1eb9ca6,0x000e2c829eb29ce7,0x0000232ca21ef736}, {0x0001423d253fcb17,0x000eafa39eb14bf6,0x000851c7af08803c,0x000414bf18602df9,0x00000400f3a049e3}},
+{{0x000e0476ba61c55b,0x000d7c4d39716abc,0x0008d82d0936a3d6,0x00056fb6eb259d5e,0x00000c9176e984d7}, {0x000ba412a06e7b06,0x000452c8d25602ef,0x00067a91c7146785,0x000adf3df9713ebd,0x000032830ac7157e}, {0x00082a7ab73769e8,0x0007875b18e2c0e7,0x000bcceae104a05d,0x000a82029525226e,0x00000d794f8383eb}},
+{{0x0005f5cb9e1516f4,0x000cf648aae45ff3,0x00093a9ef3ee805b,0x000a6c2f0d73c2bb,0x0000097b0bf22092}, {0x00044ce7a7a2e1ac,0x0003efad1b8b77be,0x000d5f7c9b411fd9,0x000db161734a1d70,0x00000d6592233127}, {0x000bab1521a9d733,0x000ead61abb25c48,0x0006cb4305a6c2ea,0x0003a67625c6c1cc,0x00007fc90fea93eb}},
+{{0x0008f1fe1f5c5926,0x0005e3b258bf4040,0x000dc716691a8f2f,0x000577e40a951a2f,0x00006598ee93c98b}, {0x0007deb59c7cb23d,0x000695328404ec52,0x000ccf2c7a955391,0x000fa11d64392817,0x00006ce97dabf7d8}, {0x0005a8e50ef7c48f,0x000116f2ce53225b,0x00053de537eb6034,0x000bb03c5e75173e,0x000073119fa08c12}},
+{{0x0000129453f1a4cb,0x000c9c8f53787ed3,0x0008bee7b9bce621,0x000428cfacb2b133,0x00003025798a9ea8}, {0x0005b94d21f4774d,0x0006c7897b727784,0x000c56522bbf62f1,0x0001212671857c03,0x00003cd6a8529562}, {0x000cde923aeca999,0x0000062e8c12f3fe,0x0006988adebdaa5b,0x000103667b99dfc9,0x00003f52c0285266}},
+{{0x000aa48e2a1351c6,0x00054fa7f53d7ffe,0x000582ddf1286247,0x000ac590b5ba9e57,0x000060c0104ba696}, {0x0008bf99eec416c6,0x00017a9d2f671925,0x0006dea4abac8a50,0x0001569629549ab1,0x000005d0e85c9909}, {0x000de020de9cbe97,0x00056b50bcf74051,0x000f11df65fa07fc,0x000de4d378cec9f0,0x000036853c69ab96}},
+{{0x0009b8de78f39b2d,0x00071a847b9ec36d,0x0009bd3fde7f42ed,0x000ce6b241cd1d67,0x00006a704fec92fb}, {0x0003c0b0fac5e7be,0x000854c08dcbe443,0x0006978f9b724bae,0x0005fc8f1f24cc44,0x00004a0aff6d6282}, {0x0007fb9e61095301,0x0009402a092f8e91,0x000a66190bc102df,0x000fe37bf09e2f5f,0x0000681109bee0dc}},
+{{0x000355e70b74b679,0x0007f12f42af467e,0x000e750d4616d8e7,0x000fa92b388e4bdf,0x0000718b2ad721d0}, {0x0002d8060bddda5b,0x0008004e4733d576,0x000029722be71bc2,0x000c2fdca2f140eb,0x000013f50b4a919b}, {0x000f9e9135c3d1f0,0x0000f6ddc2c4ea75,0x000106a42d8f9bc5,0x00049fb31a4cc78e,0x00000da8bc68cc47}},
+{{0x000a31de887c6285,0x000c9630e685ad23,0x000b93e68c2b1a00,0x000474028ed2d72b,0x0000622a9d7da8ee}, {0x000ca4fd803dd355,0x000564b241559f5e,0x000d8740dcde0ab6,0x000cd960e1dab442,0x000073187fa7c5c7}, {0x0000142b04a84201,0x000caaa7ec4c584c,0x000713560b7d7880,0x000ad8637cb4544d,0x0000397cb12559ea}},
+{{0x00090c2f01527611,0x000effb39e82fe7d,0x000d86300278d54d,0x000c761147ae873d,0x00002e062d9265cc}, {0x0002a76344d19b8a,0x000ba7d73bc00efb,0x000093499b9b21d7,0x000facb636bae223,0x000068b58e920d0f}, {0x000b2b75614714a8,0x0007570c4b340e82,0x0001a84fa05ee658,0x000a41ab9a55923c,0x0000090e311660e2}},
+{{0x0000589d9f497147,0x000a4d32023c7c52,0x000f220420f45467,0x000cdf95bbed49d6,0x00001ffc4ff2e1ba}, {0x000b148c43e25292,0x000a840e48ea7bd8,0x000f34eb63b45d07,0x0006c8a549e9762a,0x00005727b3f2462e}, {0x000afd4bf58d3e7a,0x0000e7da81adde18,0x000447d659072250,0x000354b3d9a36649,0x00004aeb1db9a870}},
+{{0x000a84c356188f25,0x00065ca2fcc1b2a8,0x000c39bf5d9338f7,0x0001ab4011bf863d,0x00000c9cbbc1818d}, {0x0007dfdf45ea9b0c,0x0003584f56946992,0x000728ca36ba5145,0x00001277fc03e5f8,0x00002ba53aa49e88}, {0x000e5c21133879f7,0x000a3fda18551dce,0x0000d20f92b52b9c,0x000be84e05aaad20,0x0000294a103e01bd}},
+{{0x000154cca7eef00d,0x0007804e08ffdf64,0x0008f343120f9218,0x00028348f2f67c73,0x00000d9da8044fc8}, {0x0003b8d294494827,0x000dce55915aa722,0x0003f5af0d4770c8,0x0009bfefa28d6cf3,0x00005ed0b58417d7}, {0x000e50c4dc3a414f,0x0000a74b9ffb905f,0x000501f8c4aa6fc2,0x0008125661966be7,0x0000311e7bc49372}},
+{{0x0000f2dea24ede0a,0x000183e4058bb558,0x0005bc0487698cf0,0x000955143f194e17,0x00000635fe385b3d}, {0x000c4a64e03842ea,0x000a155baa602d60,0x0001daadac30db1a,0x00049a96cbf3141e,0x00007e8b773078c6}, {0x0008a3acb0928174,0x00028c804ffcf5fe,0x0001572ce40ab92b,0x000334dd7c86cc80,0x00005b56664e2bb5}},
+{{0x000a0cc9782a0dde,0x000b2ea718385559,0x0001ef238c551dcd,0x000613d7f62865b3,0x0000504aa7767973}, {0x0008fcfa36048d13,0x000b373899ddd9c1,0x000f92d0aa29159d,0x00019d4dc9f350b9,0x000026f57eee878a}, {0x000b2cd55687efb1,0x00062247af17b0ca,0x000f5a24675180d1,0x000306985c15a344,0x00004041943d9dba}},
+},
+{ /* slot=15 [{1,2,3,..,16} * 32^(2*15)] * G) */
+{{0x000c85ea63fe2e89,0x000910e9412ec9c9,0x0006fbfe7bbe1baf,0x0008b6c8f7baa8a8,0x00000fb17f9fef96}, {0x00016676706ff64e,0x000dd0d86a53d59a,0x000e5c0b9610b953,0x0000c685848e1e6c,0x00002d8b78e71278}, {0x0005c62eafc3902b,0x0005289e8072879d,0x00010120b9773a21,0x0001a6dc38ae640e,0x000009ae23717b2b}},
+{{0x0006005ca5b1b143,0x000b87fd1cda21d0,0x0003fcffe76d4c6b,0x0001ea56ef596765,0x0000097c29e8c1ce}, {0x000cecb943f5a53b,0x0001d06c08df25c3,0x00058954479cc9a6,0x0009fd5cfba639a8,0x00005a845ae80df0}, {0x00097dbe5deb94ca,0x000388c709c484ce,0x000169d09738d0a4,0x00087c3c43eced4a,0x00000a1249fff7e5}},
+{{0x0008064e00d0e481,0x0004ed8bf389ae55,0x0005d1608e42131a,0x0001169bbde28eb7,0x00003349b8512849}, {0x000b1aec0d07a536,0x000d08634890c599,0x00087dfb7b79e706,0x0008c0819143da1b,0x00006a78f6618d4b}, {0x0000eedf2053a19b,0x0004b330b1ffa17b,0x000daade247c58d8,0x000c0f5ae53db7ba,0x00003505a7a47978}},
+{{0x0000071b276d01c9,0x000c586c48c7012f,0x0001d6fba9e7b8ba,0x000b7925308129b7,0x00005d88fbf95a3d}, {0x00008d9e7354b610,0x000535ba85b6e0b4,0x000a58a207806b32,0x000df2cdbe63a034,0x0000173bd9ddc9a1}, {0x00000f1efe5872df,0x0002ed43918c12b5,0x0009673ae058d658,0x000a319e6ed278ec,0x000006e1cd13b19e}},
+{{0x0005556af39a161c,0x00063313b967d3fa,0x00056104566d0df8,0x000f027a4fb5a867,0x00005edc0b1646e8}, {0x000207d94f8708b8,0x00041abce0852028,0x000732fe9cfbdec9,0x000626ec91f219c7,0x00001dc385de2abc}, {0x000ed5be76ef3796,0x00083791dffbc811,0x0002e3fd48c65934,0x000604347b3c94ea,0x00004167fd900bdd}},
+{{0x0009475fca70423d,0x00001397752c26f6,0x00051de5945490c6,0x000cce049df98452,0x000060c4e4aa68e1}, {0x000d7512aa88838e,0x000346c8a9ef0b43,0x0001b94e68c1c081,0x000395e3d8d4b54e,0x0000655888fa3810}, {0x000bea7190b43846,0x00079dd8cf89c431,0x000c96c9601b5f50,0x000091977584412e,0x000068477ca9c1d3}},
+{{0x000e7641d3962c96,0x0003c0b7bc9833ec,0x0004f7a772d107da,0x000249c08f519ad8,0x000029f6cefffd39}, {0x000a155aca692363,0x00054ae08d415809,0x0003b400b1aa837d,0x0004d8f85a4e2b0f,0x00002db30a6a2d90}, {0x000c9be4fea7d9a6,0x000ce9d34ae29dc2,0x000503bf76afe6ab,0x000e3c7099bc710c,0x00005b1f27e31f4d}},
+{{0x0000ad516f166f23,0x000931fab6abe40d,0x00004d088e118e32,0x00062663fe35e14a,0x00003080603526e1}, {0x000baf629e5b0353,0x00090278d0447472,0x000643bf273baa0b,0x0007b130c785f469,0x00007f3a6a1a8d83}, {0x000644395d3d800b,0x00055c901edf6f7e,0x00092c633995a8d5,0x000307e68cd78305,0x000030d0fded2e51}},
+{{0x000df990b67b4dd7,0x00080113ac874b50,0x00004f5a0472fd7e,0x000add0fc5ae38c7,0x000030bea73a8efc}, {0x000ec67834a1b1a0,0x000ac28bd90e497a,0x00086bb3672ee0c9,0x0007b664932b0ac2,0x00004bfe8a259bd3}, {0x00085d64af1b8301,0x0001408af9c2cb13,0x000d9e30f6e971fe,0x0009fed118fec232,0x000063d2add55b8b}},
+{{0x000f265c69327680,0x00032f0d08525df9,0x0001749c28d4cb94,0x000c301c6547958a,0x0000010fffed756c}, {0x00094f0e7efe7a97,0x000c97c517b89103,0x0006947ab2adf7bf,0x000b35d0c446a221,0x000020717ca59786}, {0x0009b8822a3fd8d6,0x000aef8d877e12d6,0x000ec19a2eec6080,0x00010bddc2225e15,0x00000a4147b43799}},
+{{0x000fdc4a7ff016d3,0x00084c6c5d08df0f,0x000ac16ee28e8550,0x000a97a97440a17c,0x00006f151bc60f1b}, {0x000055ab31e68d89,0x000c9e794938fb32,0x0007de1ef2d376b2,0x0001e9f19742419a,0x00004084c1587823}, {0x000e23b6a3ee00bc,0x00031727a3d773c8,0x0003f56f4be13eaa,0x0009a37e505b5a44,0x000048003612adc6}},
+{{0x00094d1af21233b3,0x0008ef0cc4d9ce05,0x000f499a771bdbe7,0x00098686965187f8,0x00000a9214202c09}, {0x0004971e68b84750,0x000296664bbcf9cb,0x0002fa412ba09572,0x00089d95c8de7267,0x00004615084351c5}, {0x000019c0aeb9a02e,0x0000d16034caebc9,0x00059932ec55c711,0x0005dfe0e6df5016,0x00003bca0d2895ca}},
+{{0x000742fea2ec6390,0x0000b8ba134d0872,0x0006e78f33b318c0,0x000cbfa5235ff2d9,0x0000332a979df299}, {0x000ee0ad9bb9215d,0x0007c64aa67598ec,0x000df07be68ad0dd,0x00046a291fae1a7a,0x00007d32a95cc153}, {0x000d7c0523c1f126,0x0001704555e61aaa,0x00001ded00c83e9e,0x00027a8396919549,0x00003fddaf7bb765}},
+{{0x000be7cc6c6f8c02,0x0006bcd183160608,0x000688b24c8dc378,0x0000c89d3f86ee23,0x000052179b184461}, {0x000ff98ad2dd7b03,0x000f7bc40a9c33c2,0x000691ab00c0811f,0x000ec780419841ca,0x0000579a8adfc85a}, {0x000bb00f417d1fb2,0x000d41c09978d7fc,0x0007666c9253bac2,0x0002e4a95e84fb67,0x000001791c62e77b}},
+{{0x000ef47ae7f86a86,0x000035cb6122113c,0x000038d4593153d1,0x0001b125123cc202,0x00003c4022b1c09e}, {0x000b942572970716,0x00023f0a8a946441,0x000c425278062acc,0x000bdf24da571740,0x00000e6867ee9a1c}, {0x0004b2521a37664b,0x0000c5ef0449f205,0x000e000e6977aca0,0x0003858a4bf8b88e,0x00005e940529360c}},
+{{0x000031bc3c5d62a4,0x0003ecff07a6040f,0x00030fb54519fc8b,0x00013cd98183da21,0x00005631deddae8f}, {0x00088eb69ecc01bf,0x000ada644896f9c6,0x000f7a9fe2f0bc83,0x0008241ca2d955f5,0x00004ea8b4038df2}, {0x000d460af1cad202,0x00005a48cee832ae,0x0009f11a5f463053,0x000a463912177454,0x000024ce0930542c}},
+},
+{ /* slot=16 [{1,2,3,..,16} * 32^(2*16)] * G) */
+{{0x0007974e8c58aedc,0x000fbabf041a4463,0x000980718ab9ef22,0x000a8a6e185d956e,0x00002f1b78fab143}, {0x000ebffb305b2f51,0x000ad889596b896e,0x0006d5dd25d3f938,0x0000095f0f52dc74,0x000057968290bb3a}, {0x000ab8430a20e101,0x0008d24f0ec47f71,0x000ee2eed1f39365,0x000a3e1cf7509a86,0x00007dc43e35dc2a}},
+{{0x00066665887dd9c3,0x000314bb05355859,0x000f2079b1c90f9b,0x000c12fc6e08df8e,0x00007ef72016758c}, {0x00082a5c273e9718,0x000995e4efd945a7,0x000f237d3e3576c6,0x0000a990f2ed8051,0x0000044fb81d82d5}, {0x000f18c5a907e3d9,0x0001dce4c6359c1d,0x000201bb4957b337,0x000dd2eca704534b,0x00007f79823f9c30}},
+{{0x0004d239a3b513e8,0x000d4b91fa8d8833,0x000590bd33c13670,0x000d9b412b54136f,0x00000a4e0373d784}, {0x000c1ff068f587ba,0x0004e0050c8de6a9,0x000ded5be7082789,0x000d6f03cbf99557,0x000064a9b0431c06}, {0x0003d6a15b7d2919,0x000a0d53a82352eb,0x0009a45d47b0b4f6,0x000346c7156ce438,0x0000071a7d0ace18}},
+{{0x00072daac887ba0b,0x00005bfa562eed30,0x0000ef768b012629,0x0007e9ccf543002c,0x00002c3bcc7146ea}, {0x000c355220e14431,0x0000709b15141cc0,0x00009d5f360d6595,0x00055d39af5621b2,0x00007c69bcf76177}, {0x0000d7eb04e8295f,0x000252f50f37d07f,0x00071798d710db18,0x000a51de951a9a31,0x00006f5a9a7322ac}},
+{{0x0001000c2f41c6c5,0x000c10cfefb9b8ba,0x000cc51c9fc49f79,0x000afca4efa47703,0x0000494e21a2e147}, {0x0009d4eba3d944be,0x000408078af9ee72,0x0007869c038d9e09,0x0003b244525567a4,0x000002ab9680ee8d}, {0x00048a85dde50d9a,0x0004e0fb9a249efa,0x00091ef6d9219a22,0x000bb34fa091f1dd,0x00006b5d76cbea46}},
+{{0x0007556cec0cd994,0x0006f5cd01dba885,0x000f42b4776472dc,0x0007354af0169148,0x00000ae333f68527}, {0x000941171e782522,0x00074036936d3e0f,0x0000fcc746f1e6ae,0x000313e408b3ea2d,0x000016fb869c03dd}, {0x000e199733b60962,0x000b4d8abe133288,0x000991d03e24fc72,0x000d0754811f7ed0,0x00003f81e38b8f70}},
+{{0x00010fcc7ed9affe,0x000a12465874b7f9,0x000b0c4704545cb8,0x0000993a8397ed24,0x000050510fc104f5}, {0x000b7f355f17c824,0x000c3d74299a40ad,0x000bf8eaf774b923,0x000dc3dd57c3e8bc,0x00000ad3e2d34cde}, {0x000c0fc5336e249d,0x00019c331cfd96f0,0x0009eefe1c745ede,0x0001ebef2d6fd000,0x0000127c158bf0fa}},
+{{0x00097c422e9879a2,0x000d452ca3647f61,0x000b4eaccba44add,0x0004f689b413fc14,0x0000354ef87d07ef}, {0x00028fc4ae51b974,0x000d3744dfe96dea,0x00073848a81d9973,0x000df956240680b8,0x00004ed82479d167}, {0x0003b52260c5d975,0x000fceb41b0b8fee,0x0009f6653c50352e,0x000236d8808ac30a,0x0000302d92d20539}},
+{{0x00073c1349d93ebe,0x000ce431e03d6cf4,0x000be63c01a9cdff,0x0003956742e7c1e0,0x00002406901582cb}, {0x0008883fc739dc86,0x00059ed9e16d2ab0,0x000a7c240753e59b,0x000b9f5aa174f19d,0x00001d7ad57afe99}, {0x000336c1053761bf,0x0008a6b3c7b6dbea,0x0009b46497e7dff8,0x000c4dbebaa337ff,0x00003042c5dbf294}},
+{{0x000f9235b5441414,0x0001eaf41ba80a5a,0x000ff9039e10cd15,0x0002c8f6dbf9c06b,0x00007db1b183cd0b}, {0x00011dddc83091f2,0x0006c3ba7d4ef046,0x000709b5ad14266e,0x0009ce3f42adcad1,0x00005bc0b6997021}, {0x0007dba1789d8a7d,0x000787e9e4583ee3,0x000b111eb38e69f5,0x0003e21eeda6dfdb,0x000032412583af02}},
+{{0x0005f4ac331504d2,0x000c0160a5cc3492,0x000453b875dba624,0x000d6da79fe00113,0x00000c3e22d0d60d}, {0x0003377d9ab0f2b5,0x000fb51209348ec5,0x000d73c8829b88c9,0x000dbfa9611c582e,0x00003992d9fc84e2}, {0x0009f8c2ded92e03,0x000dda9443ac350d,0x000e3660b43aa3fe,0x000f89392ecc3b10,0x000046ff1058eb86}},
+{{0x000847ad483de24b,0x00056243432e6535,0x000b4499ee85dd90,0x00023afd35b7b5ef,0x000056cb9275594d}, {0x00083f03c31f7806,0x0009b13cc4ae7101,0x0001af5f4b30cf80,0x000ffc99b630894f,0x00007fdaa5f6e8a4}, {0x000be932ade672f3,0x0004116d76c0211f,0x0006350e1f307bc6,0x000b40d9f6bfa0ef,0x000015414c1b8d9c}},
+{{0x00092202bfcc6d84,0x00002213938d6c20,0x000b6355ae0ac476,0x0007c21b128ba74f,0x0000453d54d2157a}, {0x000a4fad67882fbb,0x000a06c7637b15cc,0x000d2c047561abde,0x000a15c303b2f083,0x000076f34ea3376f}, {0x0000169f8420bdd6,0x000531c7472b9c6b,0x0003dfabf7198949,0x00094635f4f65ef5,0x0000248e14cee8e1}},
+{{0x000527ce7c831666,0x000b7f9b894a9536,0x000e04f004c03cfc,0x000d3c11891fd4fa,0x00007aca19657268}, {0x000b2e1a8b07e155,0x00001b15c7bed250,0x00072ed7234444d7,0x0005a402a2cfdcee,0x00003802940f6bff}, {0x000bea164eb08890,0x000c163d74eb816d,0x000a6793f6cdd9ac,0x0006585ca092553f,0x0000269611ba5c0f}},
+{{0x00099ba7522de4ed,0x000bd5e605b9f61b,0x00053eee6436b9ab,0x00094a0e3fef083b,0x00007ae310cf2a35}, {0x000c465b71b0a016,0x00091f28617d651d,0x000356ea47fd76bf,0x00029d9f9f320b9e,0x00004faf5f03202d}, {0x00034ce2adc14f6a,0x00017ac32df1779a,0x000a6aa2a752af88,0x0003b134d069ca55,0x0000509eb2eed9bb}},
+{{0x0009023fcb3efb7c,0x00099c63c2a944c5,0x0003c7e0846c2fcb,0x00074d9ba4190e2c,0x00000e545daea518}, {0x000b8b8b0df53c30,0x0000a8e60f098957,0x00045796de2a1c77,0x0009bc9bbc7a6703,0x000022a48f9a90c9}, {0x000dc0dc8d3fac58,0x0006ce6e42bfd6b7,0x000400d3055497cd,0x0009136542f7d1bf,0x00004159f47f048d}},
+},
+{ /* slot=17 [{1,2,3,..,16} * 32^(2*17)] * G) */
+{{0x0000dbd7add1d518,0x00088cfc11f1118f,0x000114759b979f78,0x0003a018732e1f07,0x000079b5b81a65ca}, {0x000716bce22e83fe,0x00019e80985c1f5c,0x0004254aaeb42beb,0x000a613ec9da6371,0x00005972ea051590}, {0x0004ac20dc8f7811,0x00094ac4d4fa80fd,0x00033604349a9ad2,0x0003bdbc01b2d64b,0x00004f7e9c95905f}},
+{{0x000aa0416270220d,0x000faf9245b4e812,0x000072ef05995a89,0x000eb73ffadc4ce5,0x000023bc2103aa73}, {0x0002fa8cb5c7db77,0x000f8c734c155408,0x0006e7a57e068686,0x0009bcf29e6c8d9f,0x00000473d308a763}, {0x000e792603589e05,0x0001246dcc492cae,0x000601a94f2b4b42,0x000341a02a1ef74e,0x0000102f73bfde04}},
+{{0x00088bfeb5fbf396,0x000722bab6fae620,0x000878256323244c,0x000fdd1862717dd8,0x000003237aa33c2a}, {0x000356ea2096bada,0x000af413dbf558c7,0x00036b53dca7d363,0x000e5ccfec73d8f1,0x00007790288af7a9}, {0x000059999f6e34eb,0x000387a053d1bbce,0x000618f8b2edcbf8,0x00041c588cea08ce,0x00003163fa98d0cf}},
+{{0x0002d50c7ec20d3e,0x0006ea0c97263b5a,0x0001ff734dc64bdd,0x000faba56e89052c,0x00004929c6f72b2f}, {0x000ecba293a36247,0x00062b268fd65358,0x0008a01c89af8f98,0x0004524412f7e996,0x00005786f312cd75}, {0x000788ffca14032c,0x00028447f1ee3337,0x00031bccadf39210,0x00047838b14071f2,0x00004c817b4bf234}},
+{{0x000634c709324e2a,0x000d380135df8a1b,0x0009d08c1b9ee4e9,0x000a6e782b7d7de2,0x000005ee0540cc55}, {0x0000e71f5469a9f9,0x0002b95ae6f926e0,0x000a908b298ed8d6,0x000481f89e6d6238,0x0000795a20df8375}, {0x000b076211194906,0x000b26b1e7eefd76,0x000619339eca4093,0x0005fdb71e914304,0x000013d7e950472d}},
+{{0x0002cd2b37386683,0x0009ce4694fb6278,0x000ae11d7c08ac60,0x0001963665b49b25,0x0000301f5f7cb503}, {0x0002d21e57196c45,0x00079747b796bcad,0x000f89de69392d76,0x000793150a3516f0,0x00002f2430fabcc5}, {0x0000648c9a834429,0x00053ed56ac0b135,0x0000d782cd76b3cc,0x0005727dfe89804f,0x00007c4d328a72a9}},
+{{0x00055e79db8b98c1,0x00063529c219232e,0x000ed6007fc88813,0x000f6084c9f4cd9d,0x000064a3cda34a69}, {0x0002d88c45668fc7,0x000f7138a60c0f15,0x0004ccec1a27889c,0x0008db678ed9edfb,0x000017582fa5b44b}, {0x000e3bd46639b89a,0x0007d3c119a1c0c6,0x0003c9630538baa0,0x0009dff54f70fc6f,0x00005235d0af34d9}},
+{{0x000853852871b96e,0x000ab60c3f1bb0ff,0x0005344402e13e9f,0x000744beefd59532,0x00000a37c37075b7}, {0x000ba057a40b4484,0x0001a4f5f6a43413,0x000ee1d61cba4c2e,0x000dc53614ba0a5a,0x000078a1531a8b05}, {0x000df1703ad0562b,0x00030c92521a36cb,0x000d8424e78ecf48,0x000c56fdaebd303f,0x000072ad82a42e5e}},
+{{0x00021b16443306fc,0x0008107d6f70489d,0x00044457ad93bfdc,0x00087cb73793da6a,0x0000437c9e4a6eb9}, {0x0002b02532d8cc87,0x000389ab405e4137,0x00073845e6a9c36b,0x0001bd5efde7d424,0x00006fe0d1844064}, {0x000c03ac8e09965e,0x0000347ba73543bb,0x000b75a5fd530cc0,0x000b7840f54d972e,0x000045180463b582}},
+{{0x0009ce067d1426db,0x000fe07a2870613b,0x00021b5e314feef1,0x000b13f367abaa3d,0x0000247a60a5863b}, {0x00037a89fafb0f48,0x000d6352de2bc855,0x000dd29ec9ab2189,0x000347385e907b2c,0x0000524091d862d9}, {0x000461f1322f4867,0x0001b7adc599f436,0x0000f08e4cc4b29e,0x00056dff6baf7943,0x0000503faebb1a47}},
+{{0x000c3a71e0cf3bac,0x0007effd051271f6,0x000e44ff066bc17a,0x000b2effcd1ade7b,0x00007c1ea80190e6}, {0x00063e9e98838920,0x0005373ee8ff95a9,0x00012581cd1b09ba,0x000792e6a3e6d574,0x0000181e8925884f}, {0x00067ac41941ab5f,0x0004361aaacd56ec,0x0003c6139b2915a0,0x000ea94212215a80,0x0000718a012af501}},
+{{0x000e8e35bafb65f6,0x000c8f27293a13f9,0x000cf6a3d039d69e,0x000ae6d6cb8cd958,0x00001734778173ad}, {0x0008939167024bc3,0x0006d49502fdac36,0x00045f4b298e69d1,0x000cbc4fcf2ec3ce,0x0000065f669ea3b4}, {0x0000aec75532db4d,0x000e443e31bb18a0,0x0003a7f515b869a4,0x0007c084a0f8552d,0x000019adeb7c303d}},
+{{0x00098b24e5b9ca38,0x00007bd7d5048559,0x000e77ac74fea772,0x000e6efeeb53fd08,0x000029d472d4b890}, {0x000edfd1a4faef4b,0x0004b08f74d31b77,0x000b289ae6902da3,0x0000addf78d46a33,0x0000552bb35dc938}, {0x0001bac9f8348cca,0x0000784c364dd0cf,0x00059e498edaf3ea,0x00021b0fa88fd2d2,0x00005f63aeddc982}},
+{{0x00046ce3a63ff1cc,0x0009dfe3b7e0fdcb,0x0001fe7cf90ebe0f,0x00031255512b6ed8,0x00003dff10e54446}, {0x000fae74735962a5,0x0002fa1fa8d863dd,0x0008634a3bf1cf1f,0x000425d40101c75f,0x000059337b0d843e}, {0x0001a0abd3f73907,0x0009ab62962896c1,0x000dffabd70b07db,0x00053158f305c3a2,0x00001340dd1dcb08}},
+{{0x000bed212869fd19,0x0007bf273e709db4,0x0003f7e078868917,0x000cd7c6747a04c1,0x00005abe0ed72a1b}, {0x000f4df01490b336,0x000ae2f388e6ca33,0x00031b3a07920935,0x000f18322f3c2d79,0x00006fae7b34c346}, {0x000a694c2d7ff4af,0x00081a4605a1eb6e,0x0003b5d54849df3b,0x00089b72766b7c44,0x0000495a3c5a0c15}},
+{{0x0000cb6153ead9a3,0x0007f512b636ec72,0x00040290b155b2c9,0x0000ee2b1e35b5fd,0x00002fd9ccf13b53}, {0x0005ba7d43c31794,0x000ff933225269d0,0x00061974382470c8,0x0009b538323dec81,0x0000285270988156}, {0x000d475b47f796b8,0x00013542c8f5407b,0x000b24f87ed2c7b0,0x00001d62dbd23f43,0x00006551afd77b09}},
+},
+{ /* slot=18 [{1,2,3,..,16} * 32^(2*18)] * G) */
+{{0x000aeac733a63aef,0x0005d4442454ef19,0x000795e4412c7fba,0x000b0f55da87aa04,0x0000413051e1a4e0}, {0x000dd1fd3d578bbe,0x00072c3286108852,0x000ace22732b65ce,0x000ab40658c07f4e,0x00000933f804ec38}, {0x000b69798d496476,0x000defcb5abc8a7a,0x000b5394728121aa,0x000351aa5dc12ef7,0x000007fd47065e45}},
+{{0x00083c3d258d2bcd,0x0004daf60b73fc85,0x00016a378117029a,0x000fb23fa0fc9d64,0x00001c1e5fba38b3}, {0x000211559ae8e7c3,0x00029944882a5304,0x00078250e4f281b2,0x00048f48a13ac2e3,0x0000014afa0954ba}, {0x000197001bb3666c,0x000524bffecb9cb3,0x000a88233c330060,0x000d364293711991,0x0000291884363d4e}},
+{{0x000c6805dc4babfa,0x0005e5596ecc1033,0x00059b1d3b2c15bf,0x0000ec51bc70624b,0x00003ede9850a19f}, {0x000d37c3bc1ab6eb,0x000534d57a240fb9,0x0008a5e1f602be14,0x0008188f4d73415f,0x00005964f4300ccc}, {0x000a23152d096800,0x0005970866996e44,0x0006affb6e5c08c5,0x000fd89df2db60a4,0x0000579155c1f856}},
+{{0x00024edd12e0c9ef,0x0008df2420297963,0x0004f573be468b87,0x000e92a199a3776a,0x00001e7fbcf18e91}, {0x00016b630817e7a6,0x000233c351026b5f,0x0004cef201808c69,0x0005345324a983b5,0x000053c092084a48}, {0x00041481f1cbafbf,0x000b6716174e5d2d,0x0002a55c98231d2d,0x00095f60b7d7656e,0x00003e955cd82aa4}},
+{{0x000f535e3ed15433,0x0002a0d7270a3e48,0x000ade6387d07569,0x00095f540fbd21da,0x000014264887cf44}, {0x0009f3ef61bb3a3f,0x000652eb9193eab3,0x0008c11f748eb400,0x000c49fb5de6ecc3,0x0000654d7e9626f3}, {0x0004cfdd5c7d2ceb,0x000ded737ccb9e56,0x0001f9b0ab82eeaf,0x0008dbb6107db62d,0x00000b6baac3b435}},
+{{0x00062bcb8622fe98,0x00056ceb891af7ae,0x0002e406b4477622,0x00015011a5a92bcf,0x00007d29401784e4}, {0x000abad63700a93b,0x000d3da779373204,0x00033ab709be0023,0x0000412d85f03466,0x000000496dc49082}, {0x0004b88dc27e6360,0x000268d14850c1c7,0x000e0dcb30074854,0x0003b23a145fb7b3,0x000010843f1b4380}},
+{{0x00090455376276dd,0x0008dd7645cd9c5f,0x000d366b39ce5915,0x00096c492f65d511,0x000011574b6e5269}, {0x000f672de324689b,0x000edb394a981d56,0x000168cfedd1da8a,0x000c1e8dd7b58fe9,0x00007ce246cd4d56}, {0x0004308e7f80be53,0x000cb34a9d397b8f,0x0003cc2b2c5f3cb8,0x000f67118a961bd3,0x0000710045fb3a9a}},
+{{0x00093d36101b95eb,0x000794f6f448673f,0x000f15e562faef33,0x0000da15651735f8,0x00007fa3f19058b4}, {0x000fc862059d699e,0x000a19a619e69a03,0x000f823deb2370cf,0x000844ec4fe3b122,0x00001d1b056fa7f0}, {0x00064631e56bf61f,0x000106e5382a31bc,0x000540168dd379ab,0x000d8e44d58c57e0,0x0000566256628442}},
+{{0x00009db7707023bc,0x0001b7fb3c6390cb,0x0005b20da369cde4,0x00042ed4fd98a902,0x000014403e084893}, {0x000fb17aa4cfa6a8,0x000f604c3f8cd0f8,0x0006ed16e7f10a1f,0x0006e4f9d9260ac3,0x000066f05afb22bf}, {0x000fc62a8850c41c,0x000d883794580db7,0x0004618ca4ba218f,0x000a2fd3c28c6534,0x000016a64f763963}},
+{{0x000320d2a85dc4df,0x00038c5eb76dabf5,0x000b517cf327a0da,0x000a1efd2eb72a2f,0x000076bc96275c9c}, {0x0007c0f47cd1e95e,0x0006285866e88440,0x00052cbba20342cb,0x000d9a417b999829,0x0000343ebecc3bfa}, {0x000aeee4efac1277,0x0004647d56dcea45,0x00085f7bf033deb9,0x0001e8b90f3cf566,0x00000a6e78e1d4ba}},
+{{0x000793176ad3f8ea,0x0005fa4189546449,0x00081d3f1c2b53da,0x000dc79d1ab514be,0x00000dc3e18cb672}, {0x0002c83fa98c223c,0x00008b7e584168ce,0x000404f33a81ddca,0x000b0bccb6913d10,0x000061da2f198e00}, {0x0001694e18df62c4,0x000ee696261db893,0x000334e4848890d0,0x00014826cecb70dd,0x000049f0257b1b89}},
+{{0x00001f08dcd6ec77,0x0003d40ce356cc0a,0x0004377df1057b52,0x000a0d5af5e15c88,0x000008aded3748b9}, {0x000b689a03641c46,0x000d2755172d6489,0x00008fe43a6d63bc,0x00036e23f61f8f9e,0x00005feaae4db6d9}, {0x00021e84893e747e,0x000281eb609e6eaa,0x000e48ce6dbbca1f,0x000cc1b3f73a7d10,0x00002cf88a206992}},
+{{0x000dfb233f79bd98,0x000d4b0cf9123006,0x0005fd6eaf8e0d70,0x000cd20865ec732b,0x00005d69c3241c55}, {0x000a52f79d55e3e9,0x0009a64e762e584e,0x000d7295ee60a721,0x000fb7cf5d4315a0,0x000072234b33eba9}, {0x00061f97a8de0870,0x000c132cf7bacace,0x000ca1bcc47d8017,0x0006ccef32291aee,0x000007e5d451f649}},
+{{0x000c8f52c9ae957a,0x000b5c6a7e1f5fcf,0x0007e39068486155,0x000e4d54b1f93c10,0x0000650dcb667282}, {0x000a06a4098539ab,0x000614de6b10e1bb,0x000a83f3e3257739,0x000188252841fcfe,0x00004c5ace535d78}, {0x0000b746cca28cdb,0x000544e5f84591f0,0x00002c00bf025c1f,0x000720f3f28167b6,0x00002685b798f87c}},
+{{0x00040b86c96eaf46,0x000de5d7a8dda70d,0x000b72a69851592b,0x000083fd1bbe5eb3,0x0000494e65648519}, {0x0002e59ee2face13,0x000e57aec3942d98,0x0008c38719ee7f8b,0x00093dfa6a198fbd,0x00004b51bdf2386d}, {0x0009d92009b63896,0x0005786937b64f2a,0x000160002b7ae6b4,0x000e19c7a712201c,0x0000333d783db108}},
+{{0x000499def6267ff6,0x0007b742c0843b9e,0x0009a4f2b17772ca,0x000500623a0153fe,0x00002cdfdfecd5d0}, {0x00099cd61ff38640,0x000c3063625a0dd4,0x000dd73dc329cd9b,0x000923151e2d8023,0x00004a25707a203b}, {0x0007668a53f6ed6a,0x000581dd170a12ab,0x000ae20161304242,0x00049fc4000144c3,0x00005721896d248e}},
+},
+{ /* slot=19 [{1,2,3,..,16} * 32^(2*19)] * G) */
+{{0x000d8483ef30c5cf,0x000962361cc0cd63,0x00048426ac4cd4b4,0x0004eebee90e500a,0x00000af51d7d18c1}, {0x000ba4a01efcae9e,0x000eedc308a94a57,0x000603cb2e769f4b,0x0001278d1f10eeb3,0x00004099ce5e7e44}, {0x00098e4f8a5121e9,0x00044dbfa2fe01ac,0x0006430df97dae95,0x0002fb58320aa0dd,0x0000667282652c4a}},
+{{0x0001ddc26b89792d,0x000c6da512664a31,0x000f1508591b30b4,0x00094080ca77b4cc,0x00001de443df1b00}, {0x00093a7acc36e6e0,0x000a37d586eed8e7,0x000ae1f4e4f9fab7,0x000447e3a4f9692b,0x00001c14b03eff5f}, {0x00047bd114a85291,0x000b21034d3af196,0x000f9d6dfa57b76c,0x00014936329db440,0x00005ef43e586a57}},
+{{0x00088cb7a006bfdf,0x000cf2d0ea457ade,0x0008b624074f8917,0x00012f69cce8dafb,0x000005302255d066}, {0x0000600f3ae2b7cb,0x0006d780fe7ba50c,0x000f87d1d3349b6b,0x0001acf43b599bb2,0x000046b6e402e66d}, {0x000dfa5fb154fb6a,0x0008e72ad19e838d,0x00072f88e6c79966,0x000c599e1d2c5c7a,0x00005c22833331b0}},
+{{0x00082014385675a6,0x00030aafda9e8ef7,0x000cdfa8cba2649f,0x000c0b34cd1eb505,0x000046115aba1d4d}, {0x000dcc9dc80c1ac0,0x000f41b38a436a66,0x0005dbd7c697a05c,0x0007daba7ebf3be9,0x00007da0b8f68d7e}, {0x000f1953c3b5da76,0x0007321119e9bd40,0x000eb259601dac6f,0x0004b4b03cc6021f,0x00005a5f887e8367}},
+{{0x00063e674c2dd837,0x0005ed367aab6dd6,0x000a996753a8efca,0x000acc65384f53f5,0x00007af92429597f}, {0x000d5528ccd59310,0x0002c71512e7352c,0x00028a7a70d1e8db,0x000faeacbc0e958a,0x000067ebead86ef8}, {0x000603713a8ce9bb,0x000a8e8f98155388,0x000bb18a1aa3d9ff,0x000c5faa0bc01ac4,0x000022bafbc5d240}},
+{{0x000cda73aece9aeb,0x000ce796884dc519,0x00096abee33403fa,0x00050ab53388d3cf,0x00003bd7be95edfc}, {0x0000169c21887119,0x00020f17c3456ca6,0x0006ac11f5563baa,0x000e15750d36a5b3,0x0000374a0c316eec}, {0x0004e7b4bd0b5b7e,0x00040626d06531f5,0x00033e0055a1b3ad,0x0009b99e6f2e04a3,0x00005dd89a2270c4}},
+{{0x0005573804094f13,0x000b268a50523dfb,0x000afc5280a196ba,0x0000c109cebfcb8b,0x000003e147fcd30a}, {0x00027ad0f9bdd9fd,0x000c3cabc20db748,0x00014981a276310b,0x00026e08985cbfbd,0x000004dcf7b775d7}, {0x000e35f5c6e2c8fc,0x0008f2f6715b67bd,0x0002815cbf7e9183,0x00020e8b32a9b463,0x00003e6a34fe0d78}},
+{{0x000301cf70a13d11,0x00015350dd0c48f6,0x0004bca47ecfceb8,0x0001434f70297d4a,0x00003669b656e44d}, {0x000628d3a0a643b9,0x00000e6c320649e9,0x000c2dec32b5c3cb,0x000c70c9b5302897,0x000043e37ae2d5d1}, {0x000e3f06eda6e133,0x0005199a13ac0387,0x000626381167301d,0x000e9bebd5ad8f83,0x00006a21e6cd4fd5}},
+{{0x000c365e9b0890ff,0x000f55882952b268,0x000885dd816d8140,0x00001a47e7435381,0x000031b88fd4f564}, {0x00004bbf81eb77e2,0x0007a9bdb2f0832b,0x000af06945232f17,0x000664698d04d30e,0x0000510427cd2edb}, {0x000afaff30a03a9e,0x000fa8406e492188,0x000aaf648c722ec9,0x000f25c558c1ae4e,0x00001c284fcb7fe2}},
+{{0x0005cde4392f68e7,0x0000dc887add4546,0x000b904337e03fdc,0x0003d38d5c396094,0x000054d17c61d271}, {0x000c082030af6c10,0x000f68d654a55490,0x000b5b792c8667e8,0x0004e6c5199c2541,0x00006f09107e98bb}, {0x000a1bc6cb7de286,0x000a09715f85586a,0x000c1452c12c8538,0x000eb1c6911a2abe,0x00000907a415f76e}},
+{{0x0008f40637a6a9fe,0x00025a45bef03b8e,0x000dcaa31b74a2f7,0x000ef3041e6d4d26,0x00001e681e465c92}, {0x0004648b9b205f03,0x000cb43c31d77ba7,0x000d9b38294fe712,0x0001cbc94325bfe3,0x00005b4737db86af}, {0x000487fdd83f48a2,0x000a97f37e28e43b,0x0001ab97baf87a7f,0x000d80d4a7e8598f,0x000035678d1c801b}},
+{{0x0006170a3046e65f,0x0002a00d23524f1c,0x000c82b75558712a,0x000ff5769dbbd3c8,0x0000586bf9f1a195}, {0x000129126699b2e3,0x00047708d1301ef4,0x000182b0bd71d308,0x0008b36325432d01,0x000045371b07001e}, {0x000b088d5ef8790b,0x000dc610937e5a6d,0x0001a16eb85278f0,0x0002179ac0349d26,0x00000eafb03790e5}},
+{{0x00017740febdc7e6,0x000538c82ced005e,0x0002497e9d0f3707,0x0003f7297e954997,0x000054625729460f}, {0x0004aae22f79b4ea,0x000e5631609eb724,0x0007140be7c0b657,0x00011751841a77b2,0x00006e08ace6dd42}, {0x000b94d5c87d8e18,0x000fbaa759164f42,0x000422d43f7ab82c,0x0009408f16f829b6,0x0000308d6d9606a3}},
+{{0x0008adf19b58cf2f,0x000f8c5f17fdebac,0x000ca9125969cfa8,0x0008682a141e06c1,0x000010e0a62434c5}, {0x0004e0c7acd88bb7,0x0003ce5eef6d3588,0x00080f30aa6aea09,0x000631364c88ecde,0x000057e9c7abc102}, {0x000bb8dc9a79d84f,0x00025cbe56318c5a,0x000376c2a0517dfc,0x0003178c7dc3dbda,0x000056f5997127cf}},
+{{0x00034061d0aaf22f,0x0006368dba2db3bc,0x000b121f25e86b4f,0x0001a26d835e2685,0x00001617c7918619}, {0x0008651f3d13d261,0x000d77672c25d262,0x000330c26632d948,0x0000edfe36dc0b08,0x0000694950c7fd28}, {0x000f214b181e7768,0x000c6cbe9a35ef65,0x000fe66f7219541e,0x00009b47e5a408f1,0x0000584990d57443}},
+{{0x000555c13748042f,0x000e6820baa11960,0x0003486d0c219a41,0x000c6611c81f7387,0x0000309acc675a02}, {0x0000805e0f75ae1d,0x000e32662cc30514,0x000a92396dec02fb,0x0005bb32cebdf1ee,0x000044ae3344c543}, {0x000289b9bba543ee,0x0009d5ac971429cf,0x000f9360aaf3760e,0x000678f1d82e5c64,0x000062d5221b7f94}},
+},
+{ /* slot=20 [{1,2,3,..,16} * 32^(2*20)] * G) */
+{{0x000e919a74ef4fad,0x000ecf6a308a295f,0x0009a47b013a827b,0x000c797964e01d30,0x000071c43c4f5ba3}, {0x000ef4bd567ae7a9,0x000b2d64498bdbc1,0x000c1f4ec83f624c,0x0004001e41064d22,0x00002ef9c5a5ba38}, {0x000d6df6fa9e74cd,0x000bce4af267ab6f,0x0001ef990ef18278,0x000f2938255b3d0f,0x00005a758ca390c5}},
+{{0x00072710d9462495,0x000d2d57d5003a2b,0x0000b487ca3aa8c6,0x00072ece3d400bfa,0x00002dbae244b3eb}, {0x0000918b1d61dc94,0x000469a8130668ce,0x000fe8aad38ded36,0x000d43fd4e6a829a,0x00000a738027f639}, {0x000f4a2f57ffe1cc,0x0000de1839843980,0x0009fb15fd00670d,0x000a69c105c3f4a4,0x00002698ca635126}},
+{{0x0005318832b0ba78,0x000f7925cff8be76,0x0000291fcc381831,0x000eb0708a81b91a,0x00001fb43dcc49ca}, {0x000d702f5e3dd90e,0x00018e4d253862e3,0x00024da96a9e3f09,0x00033325e773ef60,0x00003c004b0c4afa}, {0x000946ac06f4b82b,0x000a5a806c4f39aa,0x0006cd47871ca284,0x000d2173ed3265fc,0x00006b43fd01cd1f}},
+{{0x00075d4b4697c544,0x00048df0fffbfc7a,0x000a46785a15fdf8,0x000f7142868b9eba,0x00005a68d7105b52}, {0x000742583e760ef3,0x000b9ee0ab990b5c,0x00072b923f75dc52,0x000d9f0bf1427c20,0x000073420b2d6ff0}, {0x000cf6cb9e851e06,0x00013c62238c4af2,0x0009fbf3738f5939,0x000bc9eda8ab8969,0x00003db5632fea34}},
+{{0x000eee2bf75dd9d8,0x000f6396759a5f46,0x00099e72730d17b1,0x0005f131bf2d1314,0x000004321adf49d7}, {0x000990b1829825d5,0x000873e9a89912e4,0x000c704af8edeaeb,0x0002b0eeef03d394,0x000059197ea495df}, {0x00016019e4e55aae,0x0007a7e2f92e904e,0x000f159aa4e77b43,0x0000cc0c7ce2dc16,0x000045eafdc1f4d7}},
+{{0x000401858045d72b,0x000a2cf2f0651698,0x000b222dc64c22fa,0x000dade941a36656,0x00005a5eebc80362}, {0x000e4624cfccb1ed,0x00092bd5c0395b60,0x000c0481c959dbc2,0x000d94031a09d1dd,0x00003f73ceea5d56}, {0x0007bfd10a4e8dc6,0x0007e44c9b339b7a,0x000557aefabe5700,0x00018db60c1207f1,0x0000260588912662}},
+{{0x000704a68360ff04,0x000de7661e6f459f,0x0002873551c3d93f,0x0005d57831b2a731,0x000054ad0c2e4e61}, {0x00018e3cc676e542,0x0009303ceccad4c8,0x0004129f085e422c,0x00043b8ec07cccab,0x00000dedfa10b244}, {0x000b67d5b82b522a,0x000469fa5c1ebee3,0x000ec19fd336f163,0x0009408a5b4d2f26,0x000062ecb2baa77a}},
+{{0x000d795261152b3d,0x0007d0eddd7d1e5e,0x00096b4c71496235,0x000d8be7482c8d0b,0x00002e59f919a966}, {0x00072836afb62874,0x0008579e104a5920,0x000630a14a5fcd5e,0x0003f985aad01adc,0x000061913d507566}, {0x00062d361a3231da,0x00032942002700dc,0x000f9594cefa4758,0x0005d5c02d801513,0x00003ddbc2a131c0}},
+{{0x000fcd27c9bda895,0x00084bb64d2f8aa4,0x0002f860640dc6a3,0x000741bde8438c29,0x0000282092bcbbc4}, {0x000a5c8f9bdd5af0,0x00082986276856db,0x00036c2f3a5dab38,0x0003c8726318617b,0x000019f15d90ee02}, {0x0004c1d5219c8f18,0x000f4519df5cd2c4,0x000ac7a011af3554,0x000c91af5c63b753,0x00006ee4a17943c5}},
+{{0x000101ae355154cc,0x0008cd48c9cd9a21,0x0002a7a8117ce7c5,0x000b4da0f7fd2029,0x00001b5468e9d04e}, {0x0003a00aead88af3,0x000ecfd33a4a7e45,0x0006102080c87497,0x00057139f266a7f8,0x00002c879237d465}, {0x0007fc9faf9170c7,0x00084ed2b5c42f58,0x00038cc039e5229d,0x00036cd7175b09b0,0x000061f0a9f16903}},
+{{0x000597eecc84c0e4,0x000cdb17f3d327d8,0x00014ad2e64474a2,0x0005388d675d2a0d,0x00004f1baf94e115}, {0x0000b79840a516bb,0x000a7fc48f5d1265,0x000be4ffb174b2b2,0x000248b259d17ad3,0x00003d38fdd1ed6d}, {0x0004fca280736be5,0x000c5016782973bb,0x000e2e8e2691a827,0x00095d982f79d317,0x0000375700d478c1}},
+{{0x000fbbdfbeb7d071,0x000f9a193e66e606,0x00000c8ed052186a,0x00040059ecc62f3c,0x00002dfb73786834}, {0x000c79b27ec6adb4,0x000c28e1197f4c09,0x000eaf64254d6f0f,0x0001d453daf9d8a0,0x000057a55c49a639}, {0x0000f87383948495,0x000ca0f135b8f309,0x0007b49324ebe041,0x0006ee6482c660a4,0x00002775ade56ff4}},
+{{0x0006ddf48d3819de,0x000b57f3f54248e8,0x000ad0f3aaf5218c,0x000dfa9f9a7eeb3e,0x000074e601892518}, {0x0000136d07820aa7,0x0009c7a4b2ddbb48,0x000d4aed39895145,0x000ec167ed6c1247,0x00007165b7f83fe2}, {0x0003098d9a0fb303,0x000c70a3dc6c0ec9,0x000526049218436e,0x000e49b1fee7ed92,0x00002c919f8050f3}},
+{{0x00000065d04ff8d1,0x0001aea259bd6de4,0x00055dced7b57076,0x000d2f35eaf87c9b,0x000030755a0e1401}, {0x000aa498f819063f,0x000d84dda158cd27,0x00066a2c1e561bd5,0x0000739edee3ef69,0x00004033f7302232}, {0x00077a6404879f7c,0x00098d0f6867412f,0x000a732c608448e3,0x00054973567a981c,0x00006fcdb5807dcd}},
+{{0x000d7d0799c1eff2,0x000dd013b2f274df,0x0003b32e9fb3c50c,0x000dec73499c1336,0x00002cc6e0b79b06}, {0x00000ff58733abba,0x000f64e1298f710e,0x000094eb6be72f18,0x000144d9c3f4b4f6,0x00003031d7ff646c}, {0x0002f9345150668f,0x000324c943ad112a,0x00029efd12cf90cf,0x00015de21e4eccca,0x0000711f54c64a1b}},
+{{0x0000a50a4ffb81ef,0x000093bf420bf3f5,0x0006aa2cd0b1e035,0x0007a409baa8e1cc,0x000032239861fa23}, {0x00035ac2004a35d1,0x000433a6607c3fb7,0x000528d59931de0f,0x000050c7b8591bfc,0x000055be9a25f5bb}, {0x00005acd33db3dbf,0x0007c80ac35e20d0,0x000f88ebeb0111b3,0x000fbcd4892d66c6,0x0000770eadb16508}},
+},
+{ /* slot=21 [{1,2,3,..,16} * 32^(2*21)] * G) */
+{{0x000b8a7559230a93,0x0006960e6f45d18f,0x0004a93cb51d168f,0x000d0fd3a85a9451,0x000038dc083705ac}, {0x0005dfa56de66fde,0x000002c40483ac84,0x0007b4f632e152a5,0x0001b65e9d2e163c,0x000030f4452edcbc}, {0x000d2782c5759740,0x00069f99cbecc856,0x0000ea4e71fa1345,0x00024698844fc73c,0x0000632d9a1a593f}},
+{{0x000c62f587e593fb,0x000deca5d3e71b16,0x0004cc3e6d4999ed,0x000dba8b491c1e01,0x000008f5114789a8}, {0x0004fb0e63066222,0x0008987acba3f330,0x000c1061a3fb3506,0x0008620bd1924778,0x00003058ad43d183}, {0x000c0ffde57663d0,0x00038a22ea610323,0x000c994f9a05c3df,0x000dc99bdc78abda,0x000026549fa4efe3}},
+{{0x0004d462de864067,0x0008e861404886bd,0x000d18f4f516156e,0x000a0dcfcefe07cf,0x00002aab4cdeb6af}, {0x00068d5ffebb50a7,0x0006b54ce640c698,0x000b9f9fd4f0743e,0x0008c83815a098bb,0x000016e05886620c}, {0x000fb012ea8a685a,0x000b37060b971b25,0x000116deea6ea0cd,0x000e00bf294d389f,0x0000121d162bda6f}},
+{{0x000b38d787ce8f89,0x000e24179a88d738,0x000151316db62658,0x00075c930738c9cf,0x000049128c7f7272}, {0x000bbc17f75396b9,0x000d7d2f8674604d,0x00053eabc669e6a2,0x00025d2c6409d99f,0x0000606175f6332e}, {0x0001370ef540e7dd,0x000f5a1f1d0a5402,0x000b06b8070910d6,0x000f2354634aacd5,0x00006a39e6356944}},
+{{0x0005c27b7db5f6c1,0x0000d76a447a670e,0x000019e9c1f75411,0x000fe68e7476fb8a,0x000012fff160ab3e}, {0x00074401de1f0b8b,0x0005a64352758865,0x00038e4ac86bd121,0x000d1bb509895efd,0x00006078628121b4}, {0x00083bac36dd6b3c,0x00074dc02529037f,0x000de378833e40cb,0x000dc0f6ecf90aba,0x000078da471a8077}},
+{{0x000d81adf1b88c86,0x000a831dd5817f80,0x00060b380c9456ed,0x0002d8dfe5dddb1e,0x000074b9962ff12a}, {0x000f90407ff40aac,0x0006f4feb12d294a,0x0004bc1863d5ff66,0x00051ffd34f46754,0x0000792e6ee065d7}, {0x0000531002d9d83b,0x00026588406fb064,0x00092c2a776d5747,0x0004eb7284b1acc6,0x00003e761555f0f1}},
+{{0x00095187577c6496,0x0005b3c2030bc06e,0x000b969f4390c154,0x0000e7e45340014e,0x00002318291c4bd4}, {0x000b093b01e8fb26,0x0001a1a0864f199c,0x0006c83066982799,0x000a259124ace20f,0x000070dd0d5c3332}, {0x000cff53fbfa638e,0x000dd5b5f906fbbb,0x00031391a1d563fb,0x000d5912c29dd45a,0x0000476a1b78de28}},
+{{0x000d5640df90f3e7,0x0000edbfa25ea96c,0x0009e33cc46c3a76,0x0002e5824f3ef095,0x000042889e7e530d}, {0x0001965774049e9d,0x000a198fe352b1da,0x000c5236a6fbcd6e,0x00046e2b1cbcd50c,0x00001f5ec83d3f98}, {0x000b23c3328ccb75,0x00007dd876ee98ef,0x000dfae796af42a2,0x0009f5120fbdadc5,0x0000241e246b06bf}},
+{{0x000279a3bfba8c75,0x0008dd4da31efb4f,0x0003999df952b59c,0x0004181de08c09eb,0x000014919d286131}, {0x000b342234c38720,0x0004f39dfb0b23fd,0x000234d58f14a081,0x000286f93a03ca2a,0x000068fa0077621a}, {0x000af3bc8bc6fcbd,0x00025992cbe3fbf4,0x000c392f08a93b0d,0x000a2428654d1d2b,0x00007e5772f65bfe}},
+{{0x00098a2f6555415b,0x000e2f9498020a44,0x0007b170ce3e197c,0x0009a6c07ece7606,0x0000344801b82b25}, {0x0004ce7012053bed,0x0000a3f38891df8b,0x0005079bdf1684b6,0x00020e35d8d83a97,0x000057333db8a78b}, {0x000d73be3680dfad,0x000a818ae391ba33,0x000c5f18de9e41c8,0x000dd7a218a8dc30,0x000067e4405b048a}},
+{{0x000b2178b9df8abf,0x00094a2759d67729,0x00075e4a5e2dff89,0x00028afb0e6a1149,0x00002da07d7a9b41}, {0x000918becdab4c20,0x000fe471a5789cbd,0x0007fece233dcce2,0x000cc7698c79dd0a,0x00007a97eda3a1c7}, {0x000df7aa601d2989,0x00066fbc27e77fb7,0x000e1f79683f01c6,0x0009a7e0f470b3f6,0x00004e225ed2835b}},
+{{0x00068e57ad6e98f6,0x000c80b46206529e,0x00051ebb4b4c9260,0x00090973f00862ea,0x00005bc2c77fb38d}, {0x000afc9a6280bbb8,0x00012f403d8097ea,0x000bfc8d2022a70f,0x00053ee31ce40bb1,0x00002bc65635e8bd}, {0x0005dc9fa96bad93,0x0007dde1947dce8d,0x0005185fa3e58fb1,0x0007830681532ea6,0x00001fdd6c3b034a}},
+{{0x000b1c9932a678c6,0x000c3d5b6cdd5fef,0x000499a4f0c44048,0x0003a5faddda6884,0x000063f1730c5ee0}, {0x00072295e5af3331,0x000c0176e94070d7,0x000bfa7c9eebca9f,0x000e65b1f8492223,0x0000086ba5215b57}, {0x0004fd5372cea6de,0x000052e9134a8d63,0x0008574cf502d0c5,0x000498fb0ddc5463,0x000009209d93fd84}},
+{{0x0008300997ecb7d5,0x0001e6e8243c66e6,0x0006ea7685fd235d,0x000dd13f896ba2f1,0x0000474fb8e1047a}, {0x000ebce89bb1cb45,0x000bde6cc2d39743,0x000a9c7d96dea084,0x00058434ff493b0a,0x0000354d55bea1ad}, {0x0008a2c01800d98b,0x0003c9b9b6851927,0x000f19907e067fa6,0x0004016c58c8cd71,0x00005cfbba3d0b56}},
+{{0x000be18267e9a0f7,0x0008c2ca7d7a3a87,0x000b7ee198b2ccd2,0x000b996536cefff6,0x00004c7ea6db6f4b}, {0x0006a35abfec5336,0x0004d93c84b28ea5,0x000c38721fd060af,0x000e5c0786b77bbe,0x0000094056fa8ece}, {0x000969fee6948af3,0x000a82c5d34be772,0x000c372588d88ca5,0x0006719a1a39cc7c,0x0000757eaa99d8ef}},
+{{0x0004e28c55dc18fe,0x000993399ebdd0a6,0x0000e2e652e3df9e,0x000cc0e79ac43237,0x000035ff7fc33ae4}, {0x0003a6a52dd8f7a9,0x0008c3efdcabf9c1,0x000e08f7b52dbb1f,0x000c9e5961e32405,0x000048c8a121bbe6}, {0x00015a7c59646445,0x000d7c128b615fc4,0x0005fbb912d224b2,0x0009fab6035c9c90,0x000042d7a9127442}},
+},
+{ /* slot=22 [{1,2,3,..,16} * 32^(2*22)] * G) */
+{{0x0005b5556c032bff,0x000b729297a3acbb,0x000ded81bbdf7191,0x00003f5c1ff7326a,0x000071ade8bb68be}, {0x000284c5806b467c,0x0007be75d607b1e6,0x000378d262c5f699,0x0008b708b67d958b,0x00003d88d66a81cd}, {0x00067a93204ed789,0x000cb9fa0ae2a8b7,0x000dce4887762fca,0x0005fb3771febcc6,0x0000343062158ff0}},
+{{0x000da1a7e1f5bf49,0x0006dd4736092e05,0x0003cc32f626457d,0x0005fcd77dcb0777,0x00000a5d94969cdd}, {0x000219072a7b31b4,0x00075aa578016fce,0x00074793244d7adc,0x0004beb0ec276a68,0x00006d6d9d5d1fda}, {0x0001a58ae9b08183,0x00071c15c388b22b,0x00050a0517fd95d0,0x000335ea98123768,0x000033384cbabb7f}},
+{{0x000fa2680ca2c7b5,0x000046fb64fda3c6,0x000431d6de1b5082,0x0009c89eb53349c5,0x00005278b38f6b87}, {0x000c627a26218b8d,0x0001fc7a80c6133b,0x00073e9ee6ea80b2,0x00030599458b12b1,0x0000076247be0e2f}, {0x000105f61416375a,0x0003685abeba452e,0x0003a67c36ec97af,0x000fb0126e6b5062,0x00005cf0e856f3d4}},
+{{0x000968731ae8cab4,0x0001ecb4f92c5f6c,0x000ccdbc3e5e2074,0x0000df72da53be58,0x00002dddfea26997}, {0x000ece313db342a8,0x0005b842db7eebea,0x00017f13efcba363,0x000d5c6e88c66208,0x00001b9438aa4e76}, {0x0000777e166f031a,0x000f10fb7a3288a5,0x00010fbd76067b39,0x00009051925c9a60,0x00006df9b575cc74}},
+{{0x0001192927f6bdcf,0x0007a403d61ca42c,0x000b9e1f618f9191,0x0000f8ddc1c5a668,0x00001596047804ec}, {0x000fc35b48cade41,0x0001fb2328270ecd,0x0000a01b6a6a8847,0x0005f29740a4a244,0x0000471e5796003b}, {0x0006bbb3aced37ac,0x000b5e9208ceada9,0x0008aebae27a2423,0x000ae2f24cc5c303,0x000050c356afdc5d}},
+{{0x000cbf4341c30318,0x0001183181dce09d,0x000c1e29a1eeba06,0x00035b0c179c0ced,0x00001dbf7b89073f}, {0x000d9cdf1b31b964,0x000858ca51af3cfe,0x000a8c1f84f486a9,0x000cc0014897265e,0x0000784a53dd932a}, {0x0009f9df14fc4920,0x0000cc4499fe52d9,0x0005cf000376ccb6,0x00000eaa4132cbbe,0x00003f93d82354f0}},
+{{0x0003e7689e04ce85,0x0001e04465341818,0x000688edac678fb7,0x000099aad92058f6,0x00005da350d3532b}, {0x000c12d179e14978,0x000f3bbebff5eeaa,0x000663ce27ff923f,0x000f5ff4af663e40,0x00000fd381a811a5}, {0x0006aceca436df54,0x00068ae69d6e8f25,0x000b5d036c108b61,0x000af5020d986cb6,0x0000655957b9fee2}},
+{{0x0008b07fa902030f,0x0006af463d143aea,0x000c787a60f88c76,0x000a4a815b083663,0x000008eab1148267}, {0x0001409bd002d0ac,0x00045b5ccd9a6bdc,0x000ade85ec666602,0x000df0d82317dc4f,0x000002fe934b6ad7}, {0x000cf100cfb7ea74,0x00033a1cb42acef5,0x000ef285e2228976,0x0006a55d4ce0c54c,0x000030408c048a14}},
+{{0x000baf5acf46bef7,0x000303aed3cefbe9,0x000cac1c564be0d8,0x000813a4d95b31c4,0x0000792cffee64aa}, {0x00011bc0d628214d,0x0001f08c138acc3f,0x000601a49578fb58,0x00009e53e6043719,0x000050b2e26788b9}, {0x00037cb5c7a9774d,0x0000e83d294385d2,0x0003eb824273e862,0x0000a35824e95092,0x00005f220d748c17}},
+{{0x000761d9e118c0ad,0x0008c626da5ba407,0x0006677a75535fef,0x000c73a10566f178,0x00006b513827d9a9}, {0x0004d71defcbde08,0x000eec53ef746d0e,0x00007f5f98740a5b,0x000e505d3296ca55,0x0000065ec91096f5}, {0x000c99aac7581142,0x0000f0dd9306b2e5,0x000bcdb0ee1d375c,0x00072180b3094330,0x0000371c7c87888f}},
+{{0x000897ad934c0f37,0x00031c532483a2ed,0x000869554b339bc5,0x000a1a814f694b34,0x00000ea10c83f155}, {0x000c2dae712287e0,0x000f5d4c25f093bd,0x000d9c251f25c248,0x000faa717ab4f113,0x0000022a0b14e2dc}, {0x00083844cd1a2ac5,0x000c6b60111cfd6b,0x000a8a52b52fdb73,0x0009d009ab5f3971,0x00005c80eaeb7441}},
+{{0x0001fc193eb7ff76,0x0004c702f4863395,0x0009a60ed585f81b,0x00027906c27a38fc,0x000040b265cb8b74}, {0x000d39f44a8f7ba4,0x000b4f4b9784de6e,0x0007d0f6e01e805a,0x00039d8e6fd2f905,0x00004a60eb2e3b8e}, {0x000662235d5344fe,0x0003f71b96849866,0x00062832900d74e9,0x00070f36dfabed4f,0x00003b2d249ec5f9}},
+{{0x000491bb95a4565d,0x000153870f29b5f9,0x000d2442478cfa63,0x0005e6f7d1477453,0x0000498d0f058d89}, {0x00042ab0f51f7144,0x00007ebdacd8607c,0x000ed8245891ce05,0x000ad4501bde2dc7,0x00003d542eda6831}, {0x0005201666f01bd2,0x0007227b24c7af9f,0x000847ec1e7b3550,0x0009242c6332dfe6,0x0000427236fe655e}},
+{{0x000cca0a3f68a281,0x0002ec14a50e3174,0x0007d28d2176fac6,0x00000352a4a70755,0x0000563ab43fb8f9}, {0x00059d24d4b3fc23,0x0009b2f0cd08a365,0x000032ea3b74b453,0x0002403dd714832e,0x00007b55aeec8511}, {0x000ee67e61cd0c23,0x000016ee59b9202c,0x000b9ceb1ade0f53,0x000b641d0f997bb8,0x000076f7e3311a1c}},
+{{0x000b95d4d2e7040a,0x00075428a1297eac,0x00065fb569b8c332,0x000953854fe84fbd,0x00004faee859f003}, {0x000cc6836b803ee3,0x0009dcd19368e683,0x0007bb17b35b355f,0x00045d543ca1b22e,0x00005d8618287034}, {0x000e3334fa4c2687,0x00034311b2aa33ba,0x0007d0805cd1b053,0x0008af2de3f4d6e0,0x000043443a4573af}},
+{{0x000d8845832fcedb,0x000c9ae6bf863739,0x00074ffef7fa38d6,0x000e45e32bc0dcab,0x000073937e8814bc}, {0x000e00c9193b877f,0x00090e0dc506bbb2,0x0006de649fece3a8,0x0009e1aecf3b7c03,0x00005f46040898de}, {0x00037116297bf48d,0x00022d4f06834b90,0x000696bdc6a9d13b,0x000e835e19715574,0x00002cf8a4e891d5}},
+},
+{ /* slot=23 [{1,2,3,..,16} * 32^(2*23)] * G) */
+{{0x00050d37f42ad2ee,0x0000498a1fbf5125,0x0003894cb28b78e0,0x0008d0c5d5307823,0x000002c84e4e3e49}, {0x0003896880baaa52,0x000c4f285940e449,0x00045448b64c98af,0x000ae7fef4aa79ba,0x00005278c510a57a}, {0x000dd074294c0b94,0x000b8df18ffb6a54,0x000dae8366f55d46,0x000d165f06fecc58,0x0000588657668190}},
+{{0x000ffea44f901e5c,0x000b72184b7820c1,0x000114db882b0b6f,0x000a142e587ff910,0x000037130f364785}, {0x0005505c0d58359f,0x000c7fc28c46b121,0x0009ea664e2a2013,0x0000e1f24a0a1af8,0x00004400b638a113}, {0x0001b76496ed19c3,0x000b0ed3272303a0,0x0003ca15b131e00a,0x000bec7520a88578,0x000006aab9875acc}},
+{{0x0001e53d33e0c7a9,0x000bab2f154bc0da,0x0001e7409ea09748,0x0007685202b09294,0x000035f1382dfb77}, {0x000d5aae407cb59e,0x000007591de795cd,0x000ea5099c2c8de2,0x0008fa8581a3530c,0x00005d46138d81c7}, {0x00063a66dd75ce87,0x000ae6773b0c2ae8,0x000a94d9fe7952b5,0x000d1cf9f420e3b8,0x000040edb7b67eb1}},
+{{0x00039983f5df0ebb,0x0008f512c4cacc13,0x000bb398e1c0f375,0x0000c622cf1130a0,0x00006b3cecf9aa27}, {0x0009acf3512eeaef,0x000d31cc1cb49534,0x00099a688d20c141,0x0002d1724180c07a,0x0000555ef9d1c64b}, {0x000770ba3b73bd08,0x00008a3afbf0c36a,0x00040946f2624aef,0x000749d5737ff98b,0x0000675f4de13381}},
+{{0x0001893bb2d75496,0x00001212c93e8866,0x0000320b1dd1dc5c,0x000c6459cfce6b7d,0x000047120a214c9d}, {0x0004142c4f290f40,0x000bc9ccf0cf5160,0x00031c500755d6d7,0x000b7a0e10c7574b,0x0000409795532a84}, {0x0004a6574218a7c5,0x000e92f280c0f036,0x0008fa7b5f67970b,0x000aaa343e2c1dcb,0x000009a7ad5aca55}},
+{{0x00055046b6c13a80,0x00001a0ec43b9757,0x00054a0849cc552f,0x000c065bf8f4b518,0x000036d45bec9a8c}, {0x0008cd8c9f2475bf,0x000111628f704e87,0x0004d5dffa7d3eab,0x00068031d78edccc,0x000051e6b17b3a4b}, {0x0008703f86556c2e,0x000783bf8cebc6f5,0x000d32aa73663b93,0x00093dd8bfa513cf,0x000052e4a38e699b}},
+{{0x0004302ef3bda4af,0x000d280f040a5bde,0x000376e307997454,0x000b193d5e383b0e,0x00000f1ac574ecb7}, {0x00075aa19726e27e,0x000a52d66f5fd30e,0x000a044ea3acce4a,0x0006425a342467e4,0x000053bfa50df3c3}, {0x0000a9fab2929430,0x00093084a6d3051c,0x000f8e23537a29c6,0x000da51eb2fa1eee,0x00002ec0bb1ba585}},
+{{0x000c52036b1782fc,0x000816cad83b40e2,0x000964073e64816c,0x000c520d0dcbdd96,0x000013d99df70164}, {0x000ff6d93bdab31d,0x0000f9d652dfea12,0x000abe94870725d8,0x0003c43019c4ff39,0x000060f450b882cd}, {0x000b5ec321e5c0ca,0x000c9d719bfa2014,0x00050023a04fcb69,0x000ac804e5f1c187,0x00001c06de9e55ed}},
+{{0x000eb071ee474c45,0x0002a3e9dd1eb327,0x000a47b36fea6219,0x000cc3a357ddcaca,0x00006b2dc268924c}, {0x0008feab1438db0a,0x000e00a23886d22e,0x00089e7b062ee837,0x000ed899bab307c0,0x000003650636ebbe}, {0x000112e5291be11f,0x000e215ae769adea,0x00065dce46114e59,0x000626f52401e802,0x0000725c6b113c29}},
+{{0x00007f426831ac88,0x0007be363a91f134,0x000d1a1ec877c06a,0x000cef1c3b572300,0x00005e95d35542ba}, {0x0003f6bec169da02,0x0001c4ff56b8e285,0x000237703fc6472c,0x000c164692b8bbae,0x000073947897ad76}, {0x00060183fd8fcce3,0x00070ce52c5b84c4,0x0005cad98b99d4f3,0x000a34d6a01d4905,0x0000710e0880a3cf}},
+{{0x000cd51fdd373efe,0x000efc7a38380c0a,0x000b7e5e8b910d56,0x000b71ebf7203bd2,0x0000375ecd3312e9}, {0x0004e863109e746c,0x00054d204d688177,0x000c448dafe2a862,0x00055261201f3065,0x00007bb66a376fdb}, {0x000b063c26cb0782,0x0008e495b08002c7,0x000235c3b55f701c,0x00019fc0fd2f9ab2,0x000001de6b4e59d4}},
+{{0x000f7ad6a33ec4e2,0x00038be2ee08e990,0x00032845156608f9,0x000b60d9ca143c56,0x00004cf38a1fec2d}, {0x00052b40ff6d69aa,0x00018dc4049bbffd,0x00034d989734530b,0x000ba2d5e4a5c2fa,0x000078096f8e7d32}, {0x000aaa650dfa5ce7,0x0002a48b5478ca0a,0x000003725bf9c49e,0x0001abe4f09cc7d7,0x0000373cad3a2609}},
+{{0x0001d5e09fbadd56,0x000cb1188442bc3e,0x0000d8dc90bec988,0x000709bbc3f4e942,0x00006bf76cdaa4b0}, {0x000b21287c958e0c,0x000262bba7493e13,0x00069921b5f58940,0x0002601ce6515ac3,0x000063e97082bfc5}, {0x000cdb3ae1955279,0x0004b4d64ea686a4,0x0003d02d3b72d458,0x000797ea0617eb4a,0x000016e5d60f0235}},
+{{0x000595b08707498f,0x000d5137e0298655,0x0007f68182b27368,0x000ae904f2403ae9,0x00003e44a6856af9}, {0x000646597547defe,0x0007f2a66e7d8d3e,0x00085a962be846eb,0x0001f51d4f3d3057,0x00002933cc1039f2}, {0x00046865d0b053ab,0x0009d8983b6c211a,0x0002c68914ebb5c6,0x000f5ff0e27894f5,0x00002bcb765e7078}},
+{{0x000f060209918bd7,0x000112c8bee70bbb,0x000ed6508df63581,0x0006dff08718c35e,0x0000105d516c3266}, {0x000879f43a912845,0x000a14136015a50b,0x0006ed151bf6e07b,0x0008a52cffb2561e,0x00004c53e80e3ee3}, {0x000e2925d3bf880f,0x000929ef5f9d9213,0x000a2686fb4e56c2,0x00070c43f3a2a7eb,0x00006e156101de00}},
+{{0x0004634d82c9f57c,0x000e124934536b29,0x00018cdb5a1fcbfd,0x00019fc9e9c4db34,0x00000040f3d94544}, {0x000ea8fb89ddbbad,0x000bc61aeaecbf1b,0x000f9b8d9d3bcb2c,0x000a6868f58a7bb1,0x000021547eda5112}, {0x000de939fd5986d3,0x00089510a380cdef,0x000b3119b9f4272c,0x0004df4b72ba407b,0x000063550a334a25}},
+},
+{ /* slot=24 [{1,2,3,..,16} * 32^(2*24)] * G) */
+{{0x000048478f387475,0x000f49cbecb3c51f,0x00099f2055b25dbc,0x000a5d69aab1244d,0x00002c709e6c1c10}, {0x0007f29362730383,0x000ffebca8a2ce1b,0x000fd413144b5279,0x000610fdafc778ab,0x00007deb10149c72}, {0x0002af6a8766ee7a,0x000045553cd0ecb6,0x000f0be4b566cbec,0x000e2ea588001380,0x000008e68e9ff62c}},
+{{0x000d500a4bc130ad,0x000493d0bd49c34a,0x00000a89be8d38db,0x0003b09a25c3d985,0x00002f1f3f87eeba}, {0x000d09d50ab8f2f9,0x0008dc55923df2f2,0x0003766cb9acb921,0x00019f54a8f34267,0x00004cb13bd738f7}, {0x00048c75e515b64a,0x000badb4a9038f78,0x000f751b50a59501,0x0002ee8c20d313f3,0x000019a1e353c0ae}},
+{{0x000c7560bafa05c3,0x000a0c6e55e617d1,0x0000d66473b3e1a0,0x0003486e3529718c,0x000041546b11c20c}, {0x000172cdd596bdbd,0x0004398eefc40b42,0x00044109b593e045,0x000ae349fb15347b,0x0000736bd3990266}, {0x00032d509334b3b4,0x0004b60816573855,0x00025c837546fd11,0x000ab5ccc5f5f304,0x0000412295a2b87f}},
+{{0x00099b88f57ed6e9,0x000266df8c82519c,0x00030ad2735393cb,0x0002e345cee3213b,0x000014e153ebb52d}, {0x00055261e293eac6,0x000032133acdb2e6,0x000900996b845a92,0x000dd80460975cb7,0x00000760bb8d195a}, {0x000e1a17cde6818a,0x000a9ed69a084413,0x0006caccb157156d,0x000c5f22cbf268f4,0x00006b34be9bc33a}},
+{{0x000f2f643a78c0b2,0x0001ef22e027cf3d,0x0009c1b5a34c3e97,0x000dd2dec7d1c5e4,0x00002012c18f0922}, {0x000c69656571f2d3,0x00045530e737a11f,0x0004fe5035c6c9e8,0x000d30be33ae7a2d,0x000001b9c7b62e6d}, {0x000b55e55ac89d29,0x0001f45a0a763880,0x0002e76c1f148324,0x000ade83d36efdfc,0x000008af5b784e4b}},
+{{0x000499dc881f2533,0x000da779323b6283,0x00073441f49d0525,0x000168d897addfb6,0x000032b79d71163a}, {0x000314d289cc2c4b,0x00011a287178de27,0x000a3364ce4be4bd,0x000826e18d528d6f,0x00006423c1d5afd9}, {0x0005f8d9edfcb36a,0x0008f3746e5f9cc8,0x0009e5d3cd22bcc2,0x0002dcce49de338f,0x0000480a5efbc13e}},
+{{0x0001e70b01622071,0x000cf8b1dafc50b5,0x000f5aabcd06b505,0x000bf312c6bb061e,0x000047aa27600cb7}, {0x00014ce442ce221f,0x000cc4c053928b66,0x000c1cbe036e199d,0x0008e06663fb4a4d,0x000024b31d47691c}, {0x00041eedc015f8c3,0x0007e7c693f7c2a5,0x000ea278d611a4fe,0x000a094f0af66134,0x0000545b585d14dd}},
+{{0x000f275ea0d43a0f,0x00034089beebe67b,0x000479e72eade68e,0x00054544289134cd,0x00000f62f9c332ba}, {0x0004e4d0e3b321e1,0x0007a28ff1e95620,0x000b99bd9e3baa63,0x000d0710b0ccffd5,0x00004d22dc3e64c8}, {0x00046589d63b5f39,0x0003f57cbcf61fcb,0x00053afa055cae6a,0x0001436febac2d29,0x00001c0fa01a3637}},
+{{0x0007c0785d132cb1,0x00069c65cc1a5f18,0x000870ac1276d0c0,0x000232d43032ac34,0x00002877f9a0e442}, {0x000525cc3814ec1f,0x000b9635d7ed4d66,0x0000bee3f3ccc8a3,0x000e6c765f536bc7,0x0000227098525cc4}, {0x00073765d745ef15,0x000dae4a9801c3a5,0x000f4b6e4ee197e8,0x00028b08946bd073,0x00005b875f2667ba}},
+{{0x000ec995f8ac8311,0x00086eea43e541dd,0x0002d063818f6121,0x000253dcda4cb09b,0x00000871258a9aee}, {0x000d312b48b972a3,0x000308d26be89731,0x000347b00169d74f,0x0008f31ad4484bc5,0x00007d8e4a358801}, {0x0002a3ea284b370e,0x00062641860856d2,0x000f2757b5eacb98,0x0004fee0badc9058,0x00001224c304f633}},
+{{0x0000c0b2ceccb06f,0x000888143f398cc2,0x000f62ce022673a9,0x000d586b34e55ec8,0x00005b951b54e5ad}, {0x000064010c450bd9,0x0006f6a552bef5b5,0x00099314521e1897,0x0009f8d45b84c985,0x0000701d31686b1f}, {0x0007e787a513025b,0x0000d0bd3b909fc7,0x000cc217fe644ecf,0x000c04d9a36a530b,0x00005132d1e91054}},
+{{0x000ce10ba7db2ca3,0x000dbda20fff66bb,0x000cf7a1c05c459c,0x00021b032ae4fe69,0x00003891c02063d1}, {0x000eb57d88ac5d88,0x0001c44fb4042ba7,0x000fd1dc480ab26a,0x000c2f90b237dde8,0x00007b9906e88fec}, {0x0006a0949e185020,0x000d1d56d16f81ec,0x00042136dba2bbb2,0x0009c117e56177e9,0x00007281471bb483}},
+{{0x000bdceb0c24a9ac,0x000e99afd70fd3bc,0x00005cb87b7dbe29,0x0005ddbc8dcd584c,0x00003d13a782285c}, {0x00097ceff2238316,0x0008b5e1e4c300d2,0x0002078dac0a6e36,0x0000fd45bbff89c8,0x00005338333f2b2a}, {0x00066afa6c14eadd,0x000cf5032da8eb9b,0x000c74a2f7a97735,0x0008dd1cf9f881a9,0x00003cd13f5c9646}},
+{{0x00095c4c7a4a71aa,0x0000a1d9c2905b65,0x00066095eb2ecafc,0x000bf88ebee2be88,0x0000501363db6764}, {0x0009372c3fceb682,0x000447b291d1062e,0x0003d80f4966b222,0x0003f74d9dd74100,0x00006add899bdc50}, {0x0009725af0892aeb,0x000fb5b94e32e319,0x0001e02e3ab06085,0x0008b973739e087e,0x00003d170bc4477a}},
+{{0x00078f4e25942853,0x00075e2a6f54a123,0x00015e2089651b21,0x0007b38571917403,0x000037b9d0188c87}, {0x0009c8ee652e4e4e,0x0003bfaf914b88b9,0x00063f2dfbc6df82,0x00013a996086f2d9,0x0000051d4cbb6f2d}, {0x000d7f0144ec87c3,0x00011806a25d4837,0x00066e66969ab8de,0x0005ac857caf805f,0x00001a031e6df801}},
+{{0x00047449bc7cd692,0x000aae6f73ddfe75,0x0000837e290f9abe,0x000c1834af01ca70,0x000063ab1b5d3f1b}, {0x000ee5e854c53fae,0x000c12b4f3ff4c11,0x0000b67a726a0b06,0x000e3ef33540f80e,0x000015f18fc3cd07}, {0x00050763b028f48c,0x00040556a065f327,0x0003495b58060207,0x000508dd53bd812c,0x000008706c9b865f}},
+},
+{ /* slot=25 [{1,2,3,..,16} * 32^(2*25)] * G) */
+{{0x00038378b3eb54d5,0x00066a5553c7ca77,0x00092800ba1d69d3,0x00032170a26cf62f,0x000001ab12d5807e}, {0x000891e7f6d266fd,0x0009b0307781b9c4,0x000061e23b0744a1,0x000d50e88388f1d6,0x0000123ea6a3354b}, {0x000d189041e32d96,0x000c2d8315848118,0x00083245d9b9ede3,0x000a1541eab4271d,0x00004a3961e2c918}},
+{{0x000c92af49c5342e,0x00011b2e6fad01ab,0x000cc84e29ffeed8,0x000c543efa28c8df,0x000011b5df18a44c}, {0x000bbb8a42a975fc,0x0007796ada358bf7,0x000dedaa488c5c39,0x00020a6e27fc76fc,0x000019735fd7f6bc}, {0x000b90d042c84266,0x0000f7f19547ee3a,0x0005a497b9eb848e,0x000895f2503a1d06,0x00000fef911191df}},
+{{0x0007b80ece590002,0x0007c34fdb1df675,0x000bd291e4a603ef,0x0005134c791dd148,0x0000492ee64881d5}, {0x000720ad093f064e,0x0006ae1188c96585,0x000ed8fed78933a6,0x0008d0dae7d2640d,0x00002b301a7de532}, {0x000c37d8df9b528b,0x000e75bde24b07ed,0x000474f941dcce8c,0x000b2ca3477d1654,0x0000216fda00c35d}},
+{{0x00007ca1ab1c6eb9,0x0003e16b687b3b15,0x000c7a91abbd448f,0x000dec13455fb7f2,0x00007579229e2f2a}, {0x0005dcb85b1c16b7,0x000e83c7b27a56ab,0x00035517be94c0fc,0x000afaaa4b11c1a7,0x0000499238d0ba0e}, {0x00046e527aba8b57,0x000478bd1647becf,0x000f706fef15a08c,0x00030d57af1c6a65,0x00006345fa78f03a}},
+{{0x00080ef89cadd573,0x0001898593bf876e,0x0000f5d1de670508,0x000fe193c7567d4f,0x00002771beabfbf7}, {0x000e7c39c352063b,0x00059cc4a9a57598,0x0000cfc72d7f2991,0x00092ad7b344792f,0x0000362a887bd9ff}, {0x000e2ac8fe50d8a9,0x0004729f9c52b3c0,0x0009fb5574083748,0x000315a2e91fcdde,0x000059be8b4ead7c}},
+{{0x00056e5b30772b10,0x00039592ed9743da,0x0009083f6fc83e2c,0x000cce0b5d11e566,0x000079e9ab147028}, {0x000d63b43e8d3c70,0x000ea2d80214bee7,0x000a76213127b057,0x0004e724042b5a8c,0x00004d31faf29a35}, {0x000626fcad0c5813,0x000b300784602554,0x0007764b420a0e7c,0x0000297c5f6e6808,0x000017a062cace06}},
+{{0x000dbd4b94253ca2,0x0008012947c0a6e5,0x000206b60279bdc3,0x000dea48d2ea2d63,0x000019b9bf4c8d31}, {0x000b149ffd77b8cf,0x00085095479cfec2,0x0004d412a3f7e185,0x000a65d60c5ab8e4,0x00006d848dda9ac9}, {0x0007b08d9af6697e,0x0007f8938742c85c,0x00010c6639384c53,0x00095f8bda7d0553,0x000000faa9dad7af}},
+{{0x0002f95f1015e7a1,0x0001da9b40263df0,0x0003ea1107790ec4,0x000f8c94d3a0ea13,0x000054f70be7e33a}, {0x0003cbe9bdd8f0a4,0x0001bfd17730293d,0x000f17a875db152c,0x0006efe7dbddc6d7,0x00003e1a71cc8f42}, {0x000ca3e390babd62,0x000670291c833c83,0x00037900c480ede3,0x0001fa1c88038ccd,0x00002c5fc0231ec3}},
+{{0x00065f52f96a6ee5,0x000567c6d58291e1,0x0005b052ec5c1f2e,0x00084c4ec9041cfb,0x00001746739952d6}, {0x000f85d918cb9aaa,0x0003093d5e808446,0x000e3526c23026d9,0x0005305de6921260,0x00005b0274e59604}, {0x000b0095f60f6a17,0x0005bd3736404345,0x000c2c173923856e,0x000c3325397858e3,0x000015300f5876cd}},
+{{0x000556a693d12050,0x00075bf68122d2e7,0x000411011f0fb6e6,0x000c4aac56e2b7ec,0x0000163636743397}, {0x000fdd301fd10f94,0x00006e512acc1371,0x0009a295ca3d5096,0x0007934695db2117,0x00001ee359ea28b7}, {0x00043f48c222473c,0x00025cbe4f046559,0x00052aa59aad8a9a,0x00017de7c8962cbc,0x0000006b56f384c7}},
+{{0x0004fd2662101940,0x0002cadc33de071b,0x0003b6c6b2c6f5b2,0x0002edee9a7ef996,0x00003bfe0e4efbd6}, {0x000cf5948995c62a,0x000ced2d860e5ba2,0x000ff1cb0652e547,0x0006b7f76de91f4d,0x000044b040587e6e}, {0x00012787135f1f50,0x000f532ed5184c5c,0x0008acf7ceef1f65,0x000efe3b8d4606d4,0x00003ef952676302}},
+{{0x000a911717038b4f,0x00021c9deef81feb,0x000d0d8834e51237,0x0003bc61c97e4e75,0x000068afae7a23dc}, {0x0002e4d102456e65,0x000c1cad47b91c42,0x0002b6ffdd87414a,0x000100f1592e2bba,0x000075d9d2bff5c2}, {0x0009b4763626e81c,0x00036bca02edd5bd,0x0001f077b3899669,0x00054710a41193d6,0x00003097a24200ce}},
+{{0x000bf35367820cc5,0x000465eeeb237458,0x000ca9766690a9b2,0x0000f7f103878bfd,0x00002df29426c34f}, {0x000c01193997ebdd,0x0005b609da280250,0x000cde7101bc34be,0x00077e4629d2de81,0x00006e4cbf6bd332}, {0x00030d76a8ecde6b,0x000717292ce88fe4,0x00058699510aeb27,0x000fc905e25e870b,0x000074ddd25666ce}},
+{{0x00010c71987420b5,0x000b1a26bad54c97,0x0005eb74368bc563,0x000e5d54cf3d598b,0x0000276f8953418f}, {0x00093b8142eb5d3a,0x0004edae709c8396,0x000c5c9d87a21c11,0x00013b98937b3207,0x00006d92586bac16}, {0x000eb57913e6f756,0x0004596a0193bff7,0x000fb663082b83a6,0x000d498fb45e4445,0x00000f84900322ae}},
+{{0x00002bf25e8f4d87,0x00065e80415b7858,0x00026296f4ad2e7b,0x000771275edf6be6,0x00005db2d18dc49a}, {0x000c0b033507a42e,0x000248ebf1dc7b25,0x00071f2e1cb34614,0x0003e1f14a355c52,0x00004b5aba5177f9}, {0x000a2f2f18d9abf0,0x000335d90136488b,0x0004263976f05b47,0x0000a70901e7c764,0x00006e63bef1a843}},
+{{0x00027734c7f8b84c,0x0003e01b270e9574,0x0004e564a6f141a1,0x000bd4802d1adfeb,0x00004bb23d92ce83}, {0x0002e7246695c486,0x0003435a89607a16,0x0000d12a37131d63,0x000b36330521561a,0x000056704bada6af}, {0x000c4aa752f912b9,0x0006cd86770c8af6,0x0003c8cd585e665f,0x0008a7e4c35ac83a,0x00002b7a29c010a5}},
+},
+};
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* #define IFMA_ED25519_PRECOMP5_H */
@@ -0,0 +1,782 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IFMA_ED25519_PRECOMP6_H
+#define IFMA_ED25519_PRECOMP6_H
+
+#include <internal/ed25519/ifma_arith_ed25519.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define MUL_BASEPOINT_WIN_SIZE (6)
+
+#define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE
+#define BP_N_ENTRY (1<<(BP_WIN_SIZE-1))
+
+__ALIGN64 static ge52_precomp ifma_ed25519_bp_precomp[][BP_N_ENTRY] = {
+{ /* slot=0 [{1,2,3,..,32} * 64^(2*0)] * G) */
+{{0x00003905d740913e,0x00005d140beb39d1,0x00088f8a09fd399f,0x0001267a5c184346,0x000044fd2f9298f8}, {0x000c93c6f58c3b85,0x000c6fb8c0e192fb,0x00043d42c2cf932d,0x000ba65270b48986,0x000007cf9d3a33d4}, {0x00091205877aaa68,0x00023ccaac49eabc,0x000d43598c26d9e8,0x00065a85a1b7dcbd,0x00006f117b689f0c}},
+{{0x0009a56042b4d5a8,0x0000c4e60acf68a9,0x00016e37aa8f2b81,0x0002555e09e236bb,0x00006bb595a669c9}, {0x0004e7fc933c71d7,0x000967a0ff5b5922,0x0001d607029f469d,0x0002e2e5aa69a65e,0x0000590c063fa87d}, {0x000aa8b3a59b7a5f,0x000dd5d9acf7843f,0x000b3d6a3136c16b,0x0000b73500fa0840,0x0000701af5b13ea5}},
+{{0x00011fe8a4fcd265,0x000fde5c1ba7d566,0x00014bd6bd3bd353,0x000da628131f31a2,0x00002ab91587555b}, {0x0005b0a84cee9730,0x00030e8864b8aaf2,0x000f016732025a84,0x000f8f4c11b50029,0x00007a164e1b9a80}, {0x000e933f0dd0d889,0x000221c35da6214a,0x000cf2db4c589423,0x000b4c6d170e5458,0x00005a2826af12b9}},
+{{0x000e050a056818bf,0x000715660faa995f,0x0006a05073327e89,0x000a49ac3e8e3cd0,0x000027933f4c7445}, {0x000351b98efc099f,0x000f47dfd2538287,0x000b0a92656765c6,0x0008727ca348d3df,0x0000680e910321e5}, {0x0003fbe9c476ff09,0x000457b5cc1725a1,0x00002b44946e9e39,0x0003e2b5ddbdcf91,0x00007f9d0cbf6355}},
+{{0x000182c3a447d6ba,0x000d14b2729b77f9,0x000864a087d50014,0x00055f3e33cf11cb,0x0000154a7e73eb1b}, {0x0002bc4408a5bb33,0x000c3c75eed02a21,0x000abfec448d5048,0x00006ebdd1beb0c5,0x00002945ccf146e2}, {0x000bdbf1812a8285,0x00007d0bdd1fcbcb,0x000bbda72d270e08,0x000b69ab41b670b1,0x000043aabe696b3b}},
+{{0x000806b67b7d8ca4,0x0008427d22739499,0x00004553b9575be2,0x0007884bb085ce72,0x000038b64c41ae41}, {0x000ceeeb77157131,0x0008900c8af883a0,0x000a59a7369b2715,0x00038bd8065b668d,0x000051e57bb6a2cc}, {0x000c326702ea4b71,0x0000341a1bb0185a,0x00083bc144be70e0,0x00061e353e4a24b0,0x000010b8e91a9f0d}},
+{{0x000f2c9aaa3221b1,0x000533bba23a7ba6,0x0002192c3a6ca021,0x00017e09dea764f9,0x00001d6edd5d2e53}, {0x000a5cd0944ea3bf,0x0003ab39dc0d26b1,0x0008542e49747035,0x000927e71b252822,0x0000461bea69283c}, {0x00036dc801b8b3a2,0x00047053ea49af18,0x000877adf3b3035f,0x00090a7529c41ba5,0x00007a9fbb1c6a0f}},
+{{0x00075dedf39234d9,0x00080e1b558f9e2a,0x000e3c23fb963d76,0x00001c32c2741ac6,0x00003a9024a1320e}, {0x0007596604dd3e8f,0x00077e288702c59b,0x000ed9c3236cb303,0x000e52fb1339c665,0x00000915e76061bc}, {0x0001f5d9c9a2911a,0x000788bcca7d7e7c,0x000eb62a32b8a371,0x0004e95636412190,0x000026907c5c2ecc}},
+{{0x000e217e039d8064,0x000b6f520419bf36,0x00075eb04498a081,0x0009c8f96cbc608e,0x000049c05a51fadc}, {0x000e678aa6a8632f,0x0006f51bc46c59b2,0x000686f5b5a6509e,0x0007f59ceb233c9c,0x000034b9ed338add}, {0x0004e8bf9045af1b,0x000e8a719d22f06b,0x0003d4cf16e2ff83,0x0008b06aaf6fc299,0x000073c172021b00}},
+{{0x0003558e227081dd,0x0003665a9f02f75f,0x0005dc395804f818,0x000b70284739745f,0x00000353832c4950}, {0x000d93d2b360748e,0x000d41617e057ff1,0x000b55464645f534,0x00091ed0d5503639,0x000043ac7628aae5}, {0x000d2ae403d0f8d8,0x000cbd3f06340d03,0x000731b5091d0c1c,0x0004ce7ff169f0f6,0x00000ec62af470bf}},
+{{0x000f5b0249864348,0x0006977088381315,0x000a8deb953ed6b3,0x000c77fa3a075556,0x000018ab598029d5}, {0x000f00848a802ade,0x000cf02302e272fb,0x0007703406e5d9fe,0x0008faf113e84711,0x00004275aae2546d}, {0x000b2cc5fd6089e9,0x000a13282e4a4d82,0x00051a8622031eb4,0x000f94844311199b,0x00003dc65522b53d}},
+{{0x000f8375b53d54b9,0x00090ccb25b24856,0x0006d5dbdd23b2bf,0x00022ed884dfb6e5,0x00007956ece28a60}, {0x00058042a71e7539,0x000d7d834d1a9e23,0x00001a6f9388de3d,0x000dd5845ecdd2e7,0x0000078aafde8d3c}, {0x000594d87f944553,0x00023a24e180beea,0x0004976461f66cda,0x000d0c6ffcb589af,0x000037c6a5151c83}},
+{{0x000f013b327fbf93,0x000c99b776f6b506,0x000aad5968aefceb,0x00024a79d12b232a,0x00000267882d1760}, {0x0000c222a2007f6d,0x0009ab5bcdedbbf7,0x000b07ba07bf84b3,0x000f241537a0e12f,0x0000234fd7eec346}, {0x0000a119732ea378,0x000b1df8dd471536,0x0001a7e5332437e6,0x0007863a2ef37f89,0x0000497ba6fdaa09}},
+{{0x000b8a44d4171280,0x0000fdb7ca331dfd,0x000eec47a9ce69b2,0x00080d2112e56f16,0x00002df0ea2c5b3c}, {0x000870ec3f213df2,0x000c057efa98726f,0x000881bdd580277f,0x00016301a474c042,0x00006eaf60b2464d}, {0x0001c5877a1e1b82,0x000eda2a9bf5496a,0x000ecb1baaf02397,0x0009c939c1fdf703,0x000024bf7e3cd8ba}},
+{{0x000bcd86468ccf0b,0x000a42a9910d6040,0x0007b25192d3829b,0x0005ebf750830080,0x000043b5cd4218d0}, {0x000ecc0313cfeaa0,0x0008d189c246d24c,0x0001f2d4d08648c2,0x000e72b2dbdbdfac,0x000061e22917f12d}, {0x000a762f9bd0b516,0x0004e373fdeee5d9,0x0003d64270eb38af,0x000d842032e5a7d9,0x0000511d61210ae4}},
+{{0x000851ca553e2df3,0x000cba64878b37ec,0x000288d1e7a71284,0x0008883e6b5e4193,0x00004cf210ec5a9a}, {0x000d04a52d9021f6,0x0003375c6bf9c322,0x0002d20b09b9c19f,0x000fe61587a3a434,0x0000143b1cf8aa64}, {0x00067c7d968acaab,0x0008e270927299f8,0x000a1809755f5425,0x00026e1d0a7d34be,0x000021b546a33741}},
+{{0x000386484420de87,0x00016b592edb4081,0x0009942d258a1cf0,0x000281039fa4e272,0x000071a7fe6fe248}, {0x000676ef950e9d81,0x000cdc0d7044f92c,0x000f8f1248a54620,0x00055e3aa9b36646,0x00006d325924ddb8}, {0x000182b8a5c8c854,0x00079fe5f2a036c7,0x0003778d0c33fd14,0x000eaa972cf59188,0x00004746c4b6559e}},
+{{0x0007f9ea94c4a4b4,0x000d6601c969d9d9,0x000e6bb51f2b2875,0x000af6dce4ce556c,0x00001aa89f0535a4}, {0x000483372c26bbe0,0x000c74d8c96c2cd0,0x0006c1d22c4dd9a6,0x00001c32d84ec7e4,0x00004179ae03c673}, {0x0009e6ad449f3eff,0x000bb3315da1a6c7,0x00035ac021329ebe,0x0004804daa089517,0x00006a76f18365b8}},
+{{0x000546c864741147,0x000dd0efcc849348,0x000672a3327d35ae,0x000e6d6ff939a760,0x0000219663497db5}, {0x00077b3c6dc69a2b,0x000276f89f617d37,0x00053a16b5defab2,0x0009fb745651cf7b,0x00005c9a51de34fe}, {0x0000f1cf79f10e67,0x000a1e658515bf51,0x0000142277ffddda,0x00023bb09c3a7171,0x00004804503c6082}},
+{{0x00089966c3ef6076,0x000af495f3f843cd,0x0003cdfb5254ecba,0x00071e40f0e80bbf,0x00002c3085e1c84f}, {0x000a5e4e1a8953e7,0x000cce3f381ef7d8,0x000fbc708f27f6e4,0x000a356adc5fba6e,0x00007aa95177a3fc}, {0x000da2bab61a40e7,0x00010793d45be1b3,0x0008f785d8d90acd,0x00060cefb579e7a4,0x00000c11ce6dfee5}},
+{{0x000821d23a36d175,0x000a7e99b9e323b6,0x0000838a47bbb40a,0x0004c5e5d9e5ce42,0x0000771e098858de}, {0x00049ed02ca37fc7,0x000e3a615acabc42,0x00096e0e23a059a0,0x000696d88a96ed7c,0x0000553398a51650}, {0x0002f5d278451edf,0x0007985899ccb9a1,0x000fa595083ada5d,0x000a611477f4a2d9,0x00005a5ed1d68ff5}},
+{{0x000308188dab2f97,0x000cb58dfe71ce7e,0x000a8f67deaf96fa,0x000373dcb8382cc1,0x000068bd2db3a04d}, {0x0001cc70e3838e9e,0x000014ddbb6ae68d,0x000b323d88ec05d0,0x000f5472d11fdb28,0x000024c264dab96f}, {0x000ee8439445bb44,0x00013e31e4698f06,0x00091454c140d23c,0x0003d937a7c10162,0x0000749f6e1e3ccb}},
+{{0x0005e0c558527359,0x00019cadb9d7ebae,0x000a1cabe9392e5c,0x000dc4428653c1ed,0x0000019b60135fef}, {0x0005122afe150e83,0x000257e4b35d8119,0x000e711e20cf209a,0x00092f07387f8291,0x000044acb897d8bf}, {0x000068145e134b83,0x0004f24304c161e6,0x000c1a3ed7c4f5e6,0x0002f92506e88a8f,0x0000150c49fde6ad}},
+{{0x000a7d3104f30e5d,0x00031b6186bfa513,0x0004f31a2f7e90f9,0x00079828d33a632f,0x00006fb5bc6b411a}, {0x000a0b6ed603e585,0x000f25b6bae177e2,0x000f4e0d6c40aeaa,0x000f9904e60c16c1,0x000050e67abc4fd4}, {0x000b6eb937c63dac,0x00070765b07b191a,0x00090afbc76ded35,0x00022be88e61f274,0x00004f0498a77597}},
+{{0x0009863c9cdca868,0x000dbb8714ad0b84,0x000c36168dc83f44,0x000fbc1fe3ee3560,0x000078a6d7791e05}, {0x000bf29509471138,0x000394f75a6518e7,0x0005a708ad5d6fef,0x000992210af79c42,0x00006b2b5a075bb9}, {0x000f704b47a0b976,0x00055741748d558b,0x000542f590a601b3,0x0005d00aa2b1fb1d,0x0000725c7ffc4ad5}},
+{{0x000a3f2780814523,0x00000e1d376f1fb0,0x000765427c13097a,0x000fbf798087abf7,0x000064ceb883653c}, {0x00059437c372eef5,0x000008dd9066e28b,0x0003be6b4f7fd7ad,0x000a39c3b3a86812,0x000073ff174e7024}, {0x00070ad05a63cbe3,0x00028a7c853b9f69,0x00068469c5fdaa82,0x000cd92ec4aebb6b,0x000071215035d428}},
+{{0x00002bf71cd098c0,0x000a4ed5e6366918,0x000902994cfe416c,0x000fae7df585d714,0x00004cd54625f855}, {0x00026715d1cf99b2,0x0001102a20d34e44,0x000b12109f7352d5,0x000f3a323d1157b8,0x0000794cc9277cb1}, {0x0006c426c2ac5053,0x000ad32f672584af,0x000a311021bc9aed,0x0008e852ad032f10,0x00007008357b6fcc}},
+{{0x00020d3ad7046e2a,0x00051c4016d1e8d4,0x000bbc80e2a485e1,0x000952314ef89a2f,0x00006eacc4376634}, {0x000df8a569ed734c,0x000a7f5b01881a4d,0x000661842a353d98,0x000d2b211729e92d,0x0000779d143037ba}, {0x000be44157371551,0x000e5463096ebf03,0x000c21823ec9e093,0x0000945a78169c9a,0x00003d6b19ebd18f}},
+{{0x000b9fbb82584a34,0x00063d2b4792bd01,0x000853620247ab64,0x000d428b631639c4,0x000013a92a3669d6}, {0x0008672738773f01,0x000fa95fbccfb0b8,0x0009ad29b6b8ccc8,0x0000f6a8d2dd5a3b,0x000006ef7e9851ad}, {0x0003771cc0577de5,0x0001e5035dc5cca9,0x000802e0717540e4,0x000f86a24680f01d,0x00003c296ddf8a2a}},
+{{0x00087e588f5111ed,0x000e8e88f5c586c2,0x000e499b389a09b6,0x00059da24ccdf679,0x000035e65aa86f6f}, {0x00002c8f8054d5db,0x000079c55dfe8dc0,0x0009ecd5c0c07637,0x0002f1bbb0d5dce9,0x000032682755caea}, {0x00003be93ec09db4,0x0000884f5cfa0304,0x000922cbe88ea43c,0x0002f39ce646a7a9,0x0000688adcea4112}},
+{{0x000b4d2ebb1f2541,0x000c740adb91ffce,0x0000a1ad05b89510,0x000717bfc71a37dd,0x00000a892c700747}, {0x000d15f9d914a713,0x000f98c8ff912aea,0x000f53d730a92f7b,0x00077baaff823179,0x00007a99d393490c}, {0x0002ed2436bda3e8,0x0004157e807948f5,0x00062f9ce077a8c8,0x000f7d2a5a965632,0x0000286762d28302}},
+{{0x000ff858a2888343,0x000565313ed3ca94,0x0005bf34face0ed4,0x000b371f55c3dcfb,0x00000a653ca5c9ea}, {0x000a7a45d185218f,0x0007846049335490,0x000c31e1f69a1537,0x000e9650060ea09c,0x00007e041577f86e}, {0x0002a496ce5b67f3,0x000d8bd56979666b,0x000a592cd0ff5492,0x000acb2503cec294,0x0000566943650813}},
+},
+{ /* slot=1 [{1,2,3,..,32} * 64^(2*1)] * G) */
+{{0x0007806c567c49d8,0x000ccca791e6a926,0x0003cc394b066d04,0x0008cd2a69f5645e,0x00005c95b686a078}, {0x000980e0aa39f7d2,0x0004252c6b51c97d,0x0007cd55aa35d038,0x000c3627d43f4930,0x000056bd36cfb78a}, {0x000519c10d14a954,0x000b494b5fa902ac,0x0009f87a5aeaf474,0x000e094e6af8382a,0x00000dea6db1879b}},
+{{0x0006bf547344e5ab,0x000888f1b4309aa6,0x000d564b2fda1258,0x000b1dd5e87d2b3f,0x00005b2c78885483}, {0x000aeb74d6a8797a,0x000f1fac4173215b,0x000c8b05c57ef55c,0x000ccfb29001f5a3,0x00000ad7cc8752ea}, {0x00051362793408cf,0x0000319963d94521,0x00083d9466eb0f17,0x0003c78a833b2fa8,0x0000093a7fa77500}},
+{{0x00007de63a16d7be,0x000dc9af332cfe51,0x00040b677fa377ff,0x000140370d5bf184,0x00006a252b19a4a3}, {0x0009604460a91286,0x000047778d3deb8e,0x000f8a5e2d7f3fd8,0x000653e67d01e31b,0x00007b038a06c27b}, {0x000919d5d36990f3,0x000bbdb4eb9f29ed,0x000cb991355213ae,0x0000e56c708ea054,0x000058ded57f7226}},
+{{0x00079dade9413d77,0x000d59729e67d78e,0x00037aa7e6f257f9,0x000039c59db910ee,0x00006aa11b5bbb9e}, {0x000d53265b0fd48b,0x0003193bfa988da6,0x0001d57e28896082,0x0008143d78ac9326,0x000079f2942d3a5c}, {0x000a2f25b6c88de9,0x000eaacf2016997d,0x000f4eb4e4251ba7,0x0007da509b44f87e,0x00007d90ab1bbc6a}},
+{{0x000ca683a7016bfe,0x0004df2c50b6d9ac,0x000ce435aa90505f,0x000ff966b610d5fc,0x000019a10d446198}, {0x0007a3f496b3c397,0x000188f4e25321a0,0x0007751bf011ceaa,0x000d8a07d9498d5a,0x000019ed161f508d}, {0x000a2cd687dce6ca,0x000c48664cf4d560,0x0002803a387f3568,0x00053fc8741e9522,0x0000483bdab15956}},
+{{0x00080f148734fa49,0x00070360534e0fa7,0x0003e307bd106f0b,0x000a0fe2210776fe,0x00003286c109dde6}, {0x000f4d0ab4da80f6,0x00045f8307fe0d6c,0x000e6f9da482483e,0x000877a05005269a,0x00001c7052909cf7}, {0x000e7de2874e98d4,0x000e9b97e0c6032e,0x000a60a38a14c362,0x000a8405781dcde6,0x0000217dd5eaaa7a}},
+{{0x0007c4d0248e1eb0,0x000e14d74bf529db,0x000c562354e07697,0x00049651e6a9b173,0x00007fa7c21f795a}, {0x000f1fb9be8c0ec8,0x000f8e30a02828bd,0x000d6c4f6c00bae7,0x000f60a4963991da,0x000007058a6e5df6}, {0x000b02c4db31f67f,0x0008910bcfb2be9e,0x000c5cddb4ed25fd,0x0009bce46c8131f5,0x000033b21c13a0cb}},
+{{0x000692f8087d8e31,0x00037d27163f7360,0x0005ea5963f4dcc6,0x00060d925a4e6206,0x0000659bf72e5ac1}, {0x000fb9b05ee38c5b,0x0004e071a13c79aa,0x000933290abf9d2d,0x00097178eee6e6de,0x00001c3bab17ae10}, {0x000ab216c7cab7b0,0x0007407bbc3cc1c9,0x00004a58d57d65d3,0x0002990527447505,0x000009f2606b131a}},
+{{0x000b10337c461ed6,0x00074f6712f69f91,0x000ab63572eb806f,0x000f31e646bf7b38,0x000003d47fbe3cb7}, {0x0005be888a20a7f7,0x000cc558c5a5ce9e,0x000f552e849bd6f5,0x000c1ccddf8b008a,0x0000116e1153a977}, {0x000fda586d9d979c,0x000b9abd4fa563d6,0x00015b45a09ddc2c,0x000719c10b0bc2fc,0x00002b12ac93e785}},
+{{0x000c1c7ee78c76c9,0x00072d0ce9aa64fd,0x000314943e6abd37,0x00060c8f4bf5bda5,0x00000ad7c2de1689}, {0x000f3f29fcc30b11,0x000da7e4292de9a4,0x0009c2ad1f63a1a1,0x0006931054efd032,0x00000a9fe12092de}, {0x0004d2831f960d1c,0x0007a2352c56dc81,0x000b91bcd39c2f76,0x00097110661d4ac7,0x000016599a9ec836}},
+{{0x00069cf7615b82c7,0x000f07acd4a3f957,0x00039f774d08d839,0x0007eb1ba2bc9f82,0x0000602fce51fa2c}, {0x00085d4dca61559d,0x0003ca521ba3e829,0x0007542ed6d86082,0x000c7771341ca065,0x0000488e714c13dc}, {0x000d0eacf65c21ca,0x000e803019019618,0x000ead3db6a6c545,0x0006cac45e3371f4,0x00001a6ab8920d40}},
+{{0x000248bcab71e8d1,0x000cf21704d387fc,0x0002776f92808f98,0x0004752fb0a44b70,0x00005dfe1c6403d7}, {0x000360a6dee7e770,0x00092aeb8d1a1d4f,0x0004642b973f772c,0x00022e656d285c99,0x0000379ab59dd615}, {0x000bd528d7522bf5,0x0007adaecda9ee24,0x000d82b1e5728a99,0x000ca4943bf96242,0x000079dfb624bd76}},
+{{0x0007dc1340a1792c,0x00058b0756becfb0,0x0000afb5254ff681,0x000395893005e2d7,0x00001a68aef642e9}, {0x000684062c0194a7,0x000ca5c287ddee28,0x0000b05c12f65424,0x000b71d984dd4528,0x00001314def640a4}, {0x000398cb1b513049,0x0003a2209fdda2f8,0x00071ea893e4b6b4,0x000dd06619f65397,0x00003c9c9f56d416}},
+{{0x000482b01b43a8d5,0x00040669bb6dbb16,0x0004228d1dd58007,0x000e7e8b6ffcdbfa,0x00003fa68d344769}, {0x000a3921a0deed15,0x0003d17e47823d00,0x0002d98e999f0f7f,0x000a9f23205433c4,0x00000fe3db25d5fb}, {0x0005d4002027e1ae,0x0005cd7a641d5492,0x00090c019c3d440a,0x00076fbf06167685,0x000037c7aec10adc}},
+{{0x0007024c8b1240a1,0x00005621887cf76a,0x000aa103dd37f94d,0x000bd48b1bfd008f,0x00003333658994e8}, {0x000725d86f094e7d,0x000203733ae68dd3,0x000c59f5068034e2,0x00032ae095eed75f,0x000006fc745449c3}, {0x00046ca94f413848,0x000dae48720fe06b,0x000f37b64cc51ab9,0x000e4d8940b58b80,0x00004880953c7d34}},
+{{0x00087d44744346be,0x000d415b52b2540e,0x00013b603e1d48da,0x000bdf77c3a8a18a,0x00004eb728c12fcd}, {0x00034c597c6691ae,0x0003d0a85b4c87e2,0x00054afae764889d,0x0009e1ddae2c90c3,0x00000a871e070c6a}, {0x0001b5994bbc8989,0x0003a5bdd4260330,0x0009d59e3c736bae,0x000d4640d61ade21,0x00003ee7300f2685}},
+{{0x000ef58b7bdbda99,0x00017b04cf272f60,0x000cc281e0f1cff2,0x0007fda2c03c2536,0x000061d0fd94fdd1}, {0x000450697f5b75de,0x0000f400cc5fede3,0x000cdcc51c63dc4a,0x000cafe917c7d0ff,0x0000716aa935ba0e}, {0x000cc9042d7010bb,0x000062d67a4a075e,0x0008cd8911b8216c,0x00062293f8e01ce5,0x00001a026827ee30}},
+{{0x000b99658bf34219,0x00021696754c7a6f,0x000d89371a7f57e5,0x000c555ad1b86152,0x0000566f0ce6ceef}, {0x00084ed59edc2312,0x000422437a623c3d,0x00064b42cdda10ba,0x000eec165c7e76e3,0x00005b441c265d33}, {0x0002376f5372b868,0x0005f86e9ecf7d4a,0x0001d50bbb03b6e4,0x0003ddcadf8cc6cb,0x00003da7265fa8d9}},
+{{0x000e9a338a12d54f,0x0000df30c70b94fb,0x0001d7b4148bf34c,0x000693cf82f8c20a,0x000013bfe2e7355c}, {0x000086007239d2e0,0x000528de32ecd6ff,0x000276fc04380c3c,0x00049a88d14d5c8a,0x00005c7cff0ce61e}, {0x0001152edef3023b,0x000f25ce13895c60,0x0004bf295d64a5a7,0x0007d3f5088840de,0x0000404265e11d1b}},
+{{0x0008b28eaffd75f7,0x000645bb3ccc220b,0x000ae13825060963,0x000cc1ab9a5ead23,0x0000681aa88b2c17}, {0x000b259508cd1471,0x000e91d06bb3057b,0x0007336cec09ffba,0x000ace3084562862,0x000064685f208164}, {0x0008c9d0e5369f76,0x000b71d7b7b6dc44,0x0003aefcd3ec2007,0x0005d18ac220d41d,0x000062f3c67d5e26}},
+{{0x000f39e42c4ec6c2,0x000b9891d4cee27a,0x0002dfc625d7655f,0x000c5db1603bfd74,0x0000418d8435230e}, {0x000a53c044f7e8dc,0x0000c1fc8a1189fd,0x0007cc2335ac6d03,0x000acdec4b3e5bdf,0x000040bc9f936d7a}, {0x000e531093d02f6a,0x00076d3171dd365e,0x000d2ce513b27dd9,0x000ac73f7889472c,0x00006f9dfe178e58}},
+{{0x000d64f8fe5bbdff,0x00051ac0d41a4fde,0x000866e8979c3322,0x000b6d0566ccf9a6,0x000068bcd7e42ae7}, {0x000e2152b1848752,0x0007fbf1a3fa1d33,0x00047136e738b917,0x00025d3199de2af9,0x00005c36d454b4f2}, {0x000f774054883b84,0x000d5f6b80603be3,0x00021d6b349a4bb0,0x000dbcebacec0d2f,0x000012f6a1199c03}},
+{{0x00024cdea5ddb3bb,0x000e33829ffda383,0x000f1c1dc41d13d0,0x000dd3d19423bd12,0x00001e7e86b45e98}, {0x000fe4455f9a5d5f,0x000a9a94d4e9711f,0x00030837eca3e9be,0x000002f966b43167,0x00005c3887b454e3}, {0x0009c7751b67e340,0x000bfa334d08e379,0x00020d3075975515,0x0001675875cac416,0x00006a64db4c79c2}},
+{{0x00070019a3aeffb9,0x000676aff58e3e75,0x00068aa025673546,0x00015fdb4a74bbab,0x0000341be6e189d3}, {0x000ea9b34e0cad1a,0x0006df8f2a75a9ce,0x0007ab028dbe8f80,0x000d785ddab5c46b,0x000016a292a96b0c}, {0x0006ae4cd6292da2,0x000670e2dae28234,0x000cdf6f9e8ce4f4,0x000bc284a3d2d94c,0x00004351147c9f75}},
+{{0x0009a97589ebfab0,0x000e4f56ed608072,0x00004a7896f3711d,0x0004abdb388d883d,0x00000c6a9f722357}, {0x000b20c14d4c28e0,0x000d968c60ff528d,0x000aba1d9a89c393,0x000f4604f9ee63eb,0x00002f3beb8ce7ef}, {0x00050d4b364a9972,0x000f03849f069926,0x00054f82c27602a6,0x0004d103abdee752,0x000067f499f5f9d9}},
+{{0x0002546f22b941f7,0x000ad6f8f9a83cc8,0x000fccf1c2949417,0x00030c1a8cb0ce5c,0x00005530ccfa40a9}, {0x0003e6c9d84e0c3e,0x0001e1412b9f5596,0x00028c86f114e0c9,0x0002017572200bee,0x000007f2e4038229}, {0x000205b05c478891,0x000057edbcd96a03,0x000c96d4c5a19c00,0x000fc1f8751773bf,0x0000442ca8f82d98}},
+{{0x000a9fe055b523d3,0x0007099a21dadee2,0x000030110b91a5e8,0x0005438027a11037,0x0000000495b26568}, {0x00044c040504c8d1,0x00022c378e953386,0x00008533c2e8c60a,0x000bcaf1dd3594b9,0x0000560ffacd51d8}, {0x000e8baad3f81144,0x000f72cd6a99294d,0x000dc35a3cb0c615,0x00011dbd8fdc7f39,0x00007fecdf28b2ec}},
+{{0x000e4c7dd435efff,0x000834da2b4432d3,0x00048ec598374529,0x000389cdce746efd,0x000057f3959e8e43}, {0x000d90d0769ab291,0x00037769d24818c4,0x000775aea2619667,0x00066e3cbd9e65c2,0x00007ac31e46169c}, {0x000317e844dbfc50,0x0007442a39d37852,0x00063d9df1e79c39,0x0004f09092c5bb98,0x00005142370ac8fd}},
+{{0x000556314cb2662e,0x0004398049d33277,0x0005e3e97fd9575d,0x000bd9cda3fdff88,0x0000476279e31ab2}, {0x000e22ca144cc937,0x0009edde1bab9a01,0x000cf64b2310273b,0x000accfd40caeb05,0x0000129a13cc03dc}, {0x000fcc16bd190569,0x0000452617a54409,0x0004a3d993ba5faf,0x000a993090fc0261,0x0000793b36997faa}},
+{{0x00053621ebb50064,0x0008e5bbe0579c67,0x00009752f988910a,0x000ede4a7c050197,0x000014fdf49816dd}, {0x000b1d0d0adc482e,0x000f9d853a2dcdfc,0x000ff954e5e406ff,0x00070ba9ed922f0d,0x00001a9aea2ada12}, {0x000365cbdd0b9979,0x0009845398eb3260,0x000e5cb62f630a16,0x0009ec5e3a8b3079,0x00007b9e94819803}},
+{{0x00023c442d5f53ea,0x000d1215a4f3e550,0x000722cee4bea910,0x0008a430f0f9c889,0x00006fe06a9a1736}, {0x0004cc8e6dd83773,0x000be792cd29caf4,0x000536daa24188d7,0x0007d569f99c7359,0x00003e6db3212ccd}, {0x000e5586217a8ee8,0x00087aa9ccd11b91,0x00008763b34d52ec,0x0004ed942eacedd8,0x000036b49951abdb}},
+{{0x000255e49e7dd6b7,0x0005c610b1eacf5d,0x0002e187ca801611,0x00025c23c99975d9,0x0000138157629791}, {0x000a7947841e7518,0x00059639c46d743f,0x0003052b74e5c6fa,0x0009030a1065e1de,0x00007d47c6a2cfb8}, {0x000ad0148ef0d6e0,0x0009a91546f3c3fd,0x0006bb81579d3e74,0x000ec8071ec62102,0x0000148cf58d34c9}},
+},
+{ /* slot=2 [{1,2,3,..,32} * 64^(2*2)] * G) */
+{{0x0008ee0752cfce4e,0x000f306ec08b7df4,0x00095459c4c3fffa,0x000a38d05710b2ab,0x0000161d25fa963e}, {0x000a8c570478433c,0x0000ec281439d231,0x0003d9079fb7b527,0x00003d9dbaa99eae,0x00002c03f5256c2b}, {0x000f18757b53a47d,0x00030cf0c5879790,0x00057ef7f9307b01,0x000bbaf31903d772,0x0000699468bdbd96}},
+{{0x000f2f46f4dafecf,0x00014a47fd6f7bd1,0x000a47b37f7cef01,0x0005785d31ffdda4,0x0000525219a47390}, {0x000d3de66aa91948,0x000c22fc0d2ccd8d,0x0004fdea2f485064,0x0002e3a9b4824663,0x0000293e1c4e6c4a}, {0x000e134b925112e1,0x000b5dca15da0376,0x00061c3111703778,0x0002823b04589af4,0x00005b605c447f03}},
+{{0x0005805920c47c89,0x0000c923b8fccb96,0x0002e2ef77e7f010,0x000b3ee000125650,0x000024a76dcea8ae}, {0x0009fec6f0e7f04c,0x0009e75e349623be,0x000e1de61a866a57,0x000bdd55542ef161,0x00002f12fef4cc5a}, {0x000522b2dfc0c740,0x0007f40c9a4070a4,0x0008cff66810d06e,0x0003790c6cf14417,0x00005e607b2518a4}},
+{{0x00031d8f6cdf1818,0x0004fc36258a258b,0x0006e61d6e35cfa7,0x000d5f7e1b3ff4f6,0x00005067acab6ccd}, {0x000c431ca596cf14,0x00040aed3e400a02,0x000e0f26dbe3c42d,0x0007068d24526802,0x0000201f33139e45}, {0x00027f6b08039d51,0x00064017c0006fd5,0x000e25a4a818b149,0x0000375d5220eb02,0x0000397cba886246}},
+{{0x00013093f05959b2,0x0008de9a9797630c,0x00021d5e26e23aa1,0x0006c3a222fd4917,0x00002339d320766e}, {0x0005c3fbc81379e7,0x00020dde12af1781,0x0005a8fdd5a66194,0x000c252ffa9c0f88,0x0000771b4022c1e1}, {0x000dd986513a2fa7,0x00071f9d4cf08d87,0x000ea283b3f5ac9b,0x0001a76d06bc31b1,0x0000331a18921997}},
+{{0x00066f45fb4f80c6,0x000de61c775cff51,0x000041d91c9c36c7,0x000fe21e3d4e81b9,0x000031167c6b83bd}, {0x00012f3a9d7572af,0x0008868074a9e265,0x000180f7c45bcbe2,0x000a67b84edc1c11,0x00001ac9619ff649}, {0x000b3842524b1068,0x0003bee9ce987f22,0x000a6250c8506834,0x000b111fc9d71844,0x0000612436341f08}},
+{{0x000d41db874e898d,0x000f16c07dc20d99,0x00000f9bbc09fea5,0x000ff40793d2c67d,0x000046ebe2309e5e}, {0x000349e31a2d2638,0x000009bd3fd358b6,0x0003a06ba49ddfb7,0x00004457f8bf1b8a,0x00001522aa3178d9}, {0x00082f5369614938,0x0009ab72d6d102c3,0x000646f227dafe40,0x000306ce8c83391b,0x000045fe70f50524}},
+{{0x000875a6960c0b8c,0x00076ef0e2f20da4,0x000d0b8fd45b68d0,0x00092d407fb51cf3,0x0000428d1623a0e3}, {0x00024920c8951491,0x000c83f630ca262f,0x0005c9d4b805f007,0x00022456fbb45d2f,0x000016619f6db57a}, {0x000f4a4401a308fd,0x000c376a5caac084,0x0003d1bc7da82219,0x00038c6deb8de464,0x00001d81592d60bd}},
+{{0x0006f273ce33f6b7,0x0008ccc3ad645cb8,0x000dad4a909d8d70,0x000ee8bc2c16f9dc,0x00003efa77e59257}, {0x000b5e2fb96d7927,0x000ab0058e7b6f39,0x00099160525e5242,0x000757118f1243c3,0x0000020942e93529}, {0x0007fd32710f3bed,0x0005b1aacce7c0d5,0x00061b07cb27d8fd,0x00068d6e7f07bfc4,0x00001d8ac21dc63b}},
+{{0x00043e0287c313a6,0x000f1055344e613d,0x000e51500dfedd14,0x000c16a782c84e2f,0x00003b9f59bd9751}, {0x00051e5bbe353f24,0x0008d3e66012d11a,0x0000887546f932f1,0x00038156f597b525,0x0000525a9fde1728}, {0x0002ff695cf4dbdb,0x000e8ccd2e096559,0x000ef73072e00e98,0x0009cc0f05f6c3c9,0x00003f38f7079c22}},
+{{0x000a2046c3534fa5,0x000443cc055dd4a1,0x000f764aa154a256,0x000797a90cc26b66,0x000027f08814afd6}, {0x000de4ec079efb0a,0x0001d9774881f765,0x000f71a25af4f6b4,0x0002ac6e732c9db4,0x00001cb4bed7bcd6}, {0x000bd67fbba4e2f6,0x000062b43d434b9e,0x000b789ad336c2ee,0x0002b912ed505ef9,0x00001f1ed5cbf78f}},
+{{0x00007292614f8a6c,0x0009bd603ad1b21c,0x000876cea0adbf47,0x000680f9d81ec39b,0x00006dc7ff88b338}, {0x000e62a64e81d56a,0x000d116ae0300c40,0x0004c6d14068ce3a,0x00083fa0d3298635,0x00002e0b57a610d0}, {0x0005f25c53631816,0x000bad1a8716448d,0x000665156bfb6bcb,0x0005243a7e803ea5,0x0000492330cb35bd}},
+{{0x000a94d227aa4bd3,0x00041e862dbaf1d3,0x000e613ad02262ac,0x00006dfdf08a50d0,0x000022026a7ec754}, {0x0003f7315847ad08,0x00074fbb18c9e7e2,0x0005cc903aea1a60,0x0003f8830960be07,0x00002f27ac1a1a18}, {0x000bfb142be22e4c,0x00047a43f2412e20,0x000e3479f70a5a6e,0x000906280fe55f44,0x000057cfc844ab26}},
+{{0x000852488a9b7da8,0x000b29cd4ec72a2e,0x00072f820b673eeb,0x00032b5e8bc466ff,0x00006f0239bf7567}, {0x00036c0bfaba393d,0x000f88d4e73c201e,0x000a0efaf49c0c05,0x000eebbaf07b9131,0x00002d1055ad59a5}, {0x0000c20ebb69ea28,0x0005460d650f3a99,0x0009b30776c88b8c,0x0006b43f68f9e896,0x0000200979ad9e4b}},
+{{0x0002130565ed86ad,0x0000943fca0d4a74,0x000518db71c6e0d5,0x000c3d80d47ea9f7,0x00007a8ff7474616}, {0x000eba56fc8c48ec,0x000d25110ef8206a,0x0003c40df40e2d15,0x000e28593751cd39,0x00006eb6ae25a1a2}, {0x0005fe9a30d21bd3,0x000003810a093c4f,0x000c6ef4efb6deff,0x00093fbfc29112c2,0x00002c52163e4597}},
+{{0x0003d7beec2a4c38,0x000830acc20edd83,0x0002df75812c9162,0x0004a81e93a47aa9,0x0000702d67a3333c}, {0x000a369a2f89c8a1,0x0001d7c8de80d3a4,0x0008eda01563137a,0x000b03fbcac008a7,0x00002cb8b3a5b483}, {0x000417cbcb1b90a1,0x000aa7f11794e36e,0x00085bc60733b3dd,0x000020d3f5108088,0x000024141dc0e6a8}},
+{{0x000b6f61367d8229,0x000a2f633455b71e,0x00026056bfe58060,0x000b2bacacaae07a,0x00003bb665a8f601}, {0x000d39867176aca7,0x000be815b3962d3d,0x0008350f6d345936,0x0009352c2eb6e68f,0x000012403ada9ffb}, {0x0007de490727082e,0x000adbb5ec71bcd6,0x0003c8217d4a235c,0x00077bd995337352,0x000056ba05579206}},
+{{0x000338c7b5ad4bb1,0x000d2430d22e55a9,0x00014966f094e22d,0x0007a03a21ab16d0,0x000001521d613cf7}, {0x000412ee4f4f7524,0x000715d7fb641fdf,0x0009028d0d3e1fcf,0x000c20e9117c8b6c,0x00006c497c763f0a}, {0x000a3d7829829a4e,0x000ccc165472e052,0x0008e345447a137a,0x0001fa481433cf94,0x00007505fbc31659}},
+{{0x000ca5b6729cb93c,0x00001462e61c7bbe,0x000b469090258f20,0x0001786df255c2bc,0x000002d2929c14b9}, {0x0003a41c1e3f0891,0x000cfeb40f3c15b7,0x00043bce64e35821,0x00036d55c692bdd0,0x000047c1de166fae}, {0x0007ff62fc95ad73,0x0001d42e2a7e303c,0x0000c6eeaa4cae2a,0x00001eae7e9b89f7,0x0000025ba9b3eb02}},
+{{0x000813014c7da302,0x000fea4cf1534b49,0x00008545d0038ce3,0x0008d0a9f5373548,0x000043b5c8277f76}, {0x0005fdb16d126dd6,0x000eb5825f640f53,0x000a7ebd80fdfdf9,0x0004dda18f9497c0,0x00002a5457f08460}, {0x00054a066b92adac,0x0007cac91d30516e,0x0007684fa843b427,0x000fd6c27c2f246f,0x00002482a0c53a16}},
+{{0x000c6541a2ef7d99,0x0000cd10413276dd,0x0006296a0c22c8c5,0x000f8ffd3d437820,0x00005af9b0571544}, {0x0006b192d3f1c157,0x0009cbd85b28c34c,0x000ee89bc2834f8a,0x000c20d220cb3814,0x0000509e1e3b532e}, {0x000c6dad612464dd,0x00024256840c3878,0x00088780ff6685a8,0x00051bee17a918fb,0x00004b1447b5b898}},
+{{0x000de61bdb6dbc29,0x000d7892679f9794,0x000e48017bd74d78,0x000b13cfdbc9b59c,0x000042b3346ede94}, {0x0004281be16a9bf6,0x00082764fd50bcb5,0x00002a650115b8b3,0x000a029afb8c7402,0x00007c6757423069}, {0x00096c733487e8fa,0x00072391135ad87c,0x000c7cb550155922,0x000e60239c869b52,0x00004644bddd95ed}},
+{{0x00055cec3a2af95c,0x00033203b48ba503,0x000db3c0f9133fbb,0x000cf36a21e73275,0x0000641364e6eba4}, {0x0006aa6eaffd2905,0x000fe2276b78b02f,0x00044e431d38287b,0x00099e5ef2055e26,0x000053860aab8375}, {0x000a01aa75dd8add,0x0003e82b5db3a8c2,0x00053f4d82773884,0x000e0cd26ded1734,0x000028a9d1afc8fb}},
+{{0x000a138ccf479c4d,0x0003c0ea5f849f6d,0x00052cf9aa3e6345,0x000c76d123ee9486,0x00002e745d925def}, {0x000116c3b21e6c5a,0x000c3ba17e0bc698,0x00070e40a2b599a6,0x00060dc91eb2c520,0x000059c2b81c84fe}, {0x0002adde036cf224,0x000b2a3ffb390885,0x000fa64bbf0dcf92,0x00024fd5a785971b,0x00005f05fe366c4a}},
+{{0x00040d4ce328b378,0x0000ae69bc1dfca0,0x0009abab2957b20c,0x000780c8f54ddc8e,0x00006ba8af0cf942}, {0x000fceb168d22690,0x000128a7b6ea5ba7,0x00020ed620416f84,0x0000037433858f17,0x00006dc63e34e98a}, {0x00002db1b4780fc5,0x0001c0db12f0ea9d,0x0003252353b01e6c,0x00074dba305c5cb7,0x00005eeffd363c7d}},
+{{0x00032afa5658c2db,0x0004f67e76fe9ee4,0x000187f7d3cf5867,0x000b3728dd627c1b,0x000071dba0fb6216}, {0x000742c9e2286e84,0x0000aad4256a360e,0x0007ba89ec450a9f,0x0009914e444c1dce,0x000015907f3e97fe}, {0x000af0a17bcd6a58,0x0007ca2b31bc8aa7,0x000f285ba10a04c0,0x000a9c9fd0e63341,0x00006ce611f30aed}},
+{{0x0008220eaeb03b91,0x0005140bec4d2442,0x00095dfa75d2ce47,0x0005693c61774ad5,0x000032eee01a4964}, {0x0005dad481f5aeb5,0x000182108b88b204,0x000dff0cf44c8938,0x000ffdc302d38a60,0x00005d1f6ba50b68}, {0x0005187c085307c7,0x0007d407844971a5,0x00020c19734c5ea6,0x000c9eab922eee50,0x000026b2c2300582}},
+{{0x00086b25334830be,0x000d0e46422ed078,0x000bb0b41e00f5a7,0x000bb06cd3e81616,0x00005dd823df37ae}, {0x00005b3a0381ec71,0x000d61daa281b2dc,0x00042a32d41609b3,0x0003c38e160a9c7b,0x00000b6c8795f540}, {0x00007a9c485f6e9a,0x00036437277dbe09,0x0007cdc904e469ce,0x000f4c8189ab4dac,0x00004988e90b9300}},
+{{0x0009a2003ebb58ff,0x0000044ee1cf0b93,0x000b59f2383f3741,0x0001d7df027a91ea,0x00003ed945b3214f}, {0x000663a303397e64,0x00050300102d4525,0x000ba5a09145ce9f,0x000e2f899c828a75,0x0000057a98851c1f}, {0x000ec45b2b427690,0x000c8e0dd4831e62,0x000388a525c3945e,0x000de1bd729589a3,0x000028305c6031b3}},
+{{0x000ed1c367c172cf,0x00014787f53cee5e,0x000815d79b526cdb,0x000de9b27d6142b0,0x000037b097135ac7}, {0x00049f54b18d6cc2,0x000215d461953713,0x0001be02eb624aea,0x0003c3d4c8219d98,0x00003aa2ba5720c3}, {0x0005321f494be127,0x000ac8a72b2e92d5,0x00026f21e689e94b,0x0008dccd65dd4b4b,0x000023b4f23b08e1}},
+{{0x00025776fb410225,0x0007c1b80c29c1bc,0x000bbcb7aafb0c1c,0x0006f0d9a0c88c72,0x000074527fb76502}, {0x000a8917f468a333,0x00008cab2137bc38,0x0005a34553ca44b0,0x00073e26ae081ec6,0x00003a8d7cb259a4}, {0x000d1822c01133be,0x000c6d782d3afdbe,0x0003cdce1d8d1aa6,0x000167ccf083c34b,0x00007f3c1d61b34d}},
+{{0x00073c773fefee9d,0x00089c1cf989d59f,0x00002e545fb3f1ef,0x000b47ce35dfb42e,0x00005766120b47a1}, {0x00025dccbd83157d,0x0005322cc8094919,0x000f90d6e43ca120,0x000767b28e57f183,0x00001a4714cede2e}, {0x0000ba0fb8b6b7ff,0x000b677511fa1db2,0x0009f02d89b732c3,0x000a5f1a92b51c09,0x00004f3875ad489c}},
+},
+{ /* slot=3 [{1,2,3,..,32} * 64^(2*3)] * G) */
+{{0x000e4d2ad8453902,0x0008ee8db2d1df8a,0x0007d2c11e701805,0x000ca79aab3995fc,0x000053b16d2324cc}, {0x00064d66b2cae0b5,0x00033ebca6576232,0x0000d24ac87dbaed,0x0005510030ebed6f,0x00002a887f78f763}, {0x0003b9e75c012d4f,0x00051cae1f2ea2a2,0x00075d70ca0c9746,0x00003f52fb632736,0x00000ba7250b8644}},
+{{0x000d18fd029c6421,0x0002189298f02bb0,0x000b250e96bc2d14,0x00071c98347f8e68,0x00007b9f2fe8032d}, {0x0003589386f86d9c,0x00076e13a85a4dd6,0x000eaa7d57616991,0x000bdfb2e5111954,0x000032c21b57fb60}, {0x000823cd319e0780,0x000c1897775c5d87,0x000a0ab3f7efc4cf,0x000c3714854fb129,0x000012c49d417238}},
+{{0x0000b533ffe83769,0x0001d8e1d6bd1095,0x000302e51021861c,0x000cab4f022d8381,0x00002509200c6391}, {0x0003a01783799542,0x0008faad5ee3f09b,0x000b70149f626dd0,0x00044c9ba00bceee,0x00001421b246a0a4}, {0x00043a8e8c24a7c7,0x00040d8f05ef54aa,0x000b3eb9dc04c1f5,0x0009ce3adba5e0c0,0x00002ab5504448a4}},
+{{0x000227266f0f5dec,0x000415ed508242ed,0x000468d4159824ee,0x000e23f807bec7c9,0x00007093bae1b521}, {0x0007ac631c5d3afa,0x00071f9df8c6cdc0,0x000d73e2b0586151,0x000e15d72a079d89,0x00007301f4ceb4ea}, {0x0009e759d6722c41,0x000cf72bf729b640,0x000c21e569a674e1,0x000cb23bc0a24eb3,0x0000390167d24eba}},
+{{0x00058e3bba353f1c,0x0004dbf6a436127f,0x000e5626504c4776,0x000a45dafbbc4e56,0x000007db2ee6aae1}, {0x000b054ba2f2120b,0x000aeb10589b7d7b,0x0003c0edbee2b9ce,0x000cb693fe8bac8f,0x00004cbd40767112}, {0x00003cc029c58176,0x000825cb15d610b6,0x000cf0ad8d5988e3,0x00032872bb61413d,0x00007b8eec6c7418}},
+{{0x000a40782cd27cb0,0x00023fbe967bde4c,0x000ad41e9edaf9c3,0x000de4db29bd34a8,0x000072810497626e}, {0x000ee570fc386b73,0x00041da3a8cc732f,0x0008968359da8b01,0x000a855975ffd0ac,0x00006ee809a1b132}, {0x0004bb31fcfd863a,0x0000a3e4e48c5944,0x000088fa252fe369,0x000292edc29c867d,0x000013bd1e38d173}},
+{{0x000b4cd8696149b5,0x000d781d8aab7d32,0x000e122b94e55937,0x00099b00bcb2127a,0x000041e86fcfb140}, {0x000fb5cf1dfac521,0x000316f554450223,0x00059177ac325c25,0x000a4bd030b98d76,0x00001ed018b64f88}, {0x0000dfa1b802a6b0,0x0004742ad3bd5363,0x000ec5a4d4880f87,0x000c5d90af90d6ce,0x0000746a247a37cd}},
+{{0x0001b8bd2b7b9af6,0x0003537fc5b51d53,0x000593546d500509,0x0000f49232fcf25c,0x000020a365142bb4}, {0x000cd85278d941ed,0x00083d22f78436ec,0x000bbfcdb72254ae,0x000e4e2c522d02e7,0x0000681e3351bff0}, {0x0004b59d83034f45,0x000f21fa20efb8b6,0x000a6550e42f8b71,0x000472b69249495b,0x0000539ef98e45d5}},
+{{0x000c8f7a56c21079,0x000b70690ec2aa2d,0x0005545a07e0fb90,0x0000a93f090f9fb8,0x00002bab9a342f78}, {0x000432db1c82f8cf,0x00060dff0b4f404b,0x000a61e74e698e80,0x000400f5e649b008,0x00003e8bd3476568}, {0x000d48f48f3ae403,0x00087e43cd9454d1,0x00013a1e75a2a633,0x000478a2f792cec5,0x00004d93e4ca33c7}},
+{{0x0008f9bd0bd217cb,0x00031ba64f7f26b5,0x00096e103d330350,0x000174dede8c445c,0x000049e1b291cd56}, {0x0003ee503d9e62e5,0x0007adba7ab82fd8,0x0001d8333b8a0a7f,0x00032908750deda0,0x0000236f0c720a16}, {0x000bd8c94c49c694,0x000ab9fd2ee65ad2,0x000fa5304a5241dc,0x000cefd83f9d95b2,0x00005702e44f3558}},
+{{0x00097e43bd725b56,0x0007d17e9ae98c53,0x0009dc2472f2f67e,0x000bfb465d85e788,0x00006eb5cf2d2aac}, {0x0004184ea454d3aa,0x00016772636a6072,0x0007e18d9650c3b5,0x000cc6a88fe9fb6b,0x000003ffb8bcb47c}, {0x0005806680135b4f,0x000f96d404ac38b8,0x00002d2605c2dcc1,0x000837c855e23e34,0x00001e2fcf045127}},
+{{0x000a483b684c9999,0x0002360546c4d257,0x00019d515d28b5ba,0x0006ece550882056,0x00003d069d05a682}, {0x000151b81f75284f,0x00021b14d6d4318f,0x00077c7c3fc69015,0x0007de31b5d46067,0x0000118fa36fde45}, {0x0001d5ab2549f8d4,0x0002e2ad390bc53b,0x00052c134fd82ed0,0x000e7a660387de73,0x00002e953af08ea0}},
+{{0x000e3b6a9ffce88d,0x000d9d069e6abf3d,0x000df96b7390927f,0x000dda85824f14e2,0x000027b0fe1240e7}, {0x0002fed3e79e6f22,0x000b6da329458960,0x000ac91fa9a187c4,0x00029a3ccc0219cf,0x0000006bc1bd6bd2}, {0x000d316c3dd2a625,0x000b9ee7312266a9,0x0007e1fab5bed1f4,0x000d48548e94d296,0x0000615b6086599f}},
+{{0x0001ad66c09d38b2,0x0002e84f38bdeab1,0x0008a4eb0ca81afd,0x000e3ccc5c69e4ff,0x00000b99680aa6af}, {0x000c1c9256889d97,0x000f3bab6175a13d,0x000626792cb9cb18,0x000370561c3e9d2b,0x000053da8be1b63a}, {0x0001b0cd12dc6604,0x000d93aa4912ecaa,0x00046d8e805746be,0x0007a6fbb4717752,0x00004de3ba8d27af}},
+{{0x0005277ae82c4180,0x000aa61e07503f32,0x0009350fad734dcd,0x0003f99778938aa0,0x00000ca1bccd158a}, {0x0006e734b8ed9ada,0x00092254d855aadf,0x0008851130c70ccf,0x000c7ad824533d0f,0x0000314cabc8f8ef}, {0x000d05a53695082e,0x000a43509bf5fad7,0x0004a51d2f7806e4,0x000e4f7e42734b1c,0x0000171a3b0c05db}},
+{{0x000bb6a1a6205275,0x000d7413c8e836e7,0x00088f5cb2aa4f21,0x0005be16f56d155e,0x00002de25d4ba634}, {0x0004d8961cae743f,0x000f5ee1c63edd07,0x0007f4ed29f86d18,0x000b10897bdc55be,0x00004cbad279663a}, {0x00019024a0d71fcd,0x0000afb288af880d,0x000f3a6419c525c2,0x0007233b1a3974b5,0x00007d7fbcefe200}},
+{{0x00035783c64a65da,0x00016081590e39bb,0x000b32e5b21ddb3c,0x0002bc7ed2ac2d22,0x00003d8861f20e3f}, {0x0000251371380646,0x000371867ddde1a6,0x0006e58b342cd270,0x0001e8caf41f65eb,0x00000ecd847d35ca}, {0x0006e3f052d7e756,0x000ec922010e5129,0x00078ab3e90b2556,0x000ea1cf1c052fc4,0x0000157d37d8eb1e}},
+{{0x0006ede489fca992,0x000ac67186fb8292,0x000ef4a7ae4c7497,0x000ea2a34ad58b4f,0x00001deada9569f6}, {0x0004dba82fab43af,0x000f96b4410602a1,0x00021d6b5cadfa85,0x000f9d02674ba7e5,0x00003a224738c57b}, {0x000e4a6a64bbcd68,0x00055da91dd17f16,0x000c10247a7e094f,0x0005c80f44aee6f7,0x000077a242e8b5b4}},
+{{0x000018c2ba79724b,0x00035f0221eb3dba,0x00004f5b8795dbb3,0x000c547517c6442c,0x00000f1594b1e0cf}, {0x00027125087ccde3,0x0003beb27c66d1bf,0x000dfb19f2bb2701,0x00067d75e8ab264c,0x00005d23a00e02d0}, {0x000dfe638da24b0b,0x000825f7f14647ed,0x000b852111b59ec4,0x000c1edc36aa6530,0x00001040786e8d74}},
+{{0x000d761a45b7f78a,0x000949982eb4ddf5,0x0002ff8b3129a24e,0x00011754b9a9733a,0x00000fdbe7f1a8d9}, {0x00055ce4fbef5e12,0x0001be3960d743e4,0x00068d6b4fd9bbb8,0x0004494d03caf025,0x0000440a769ab644}, {0x00068577b4d77f6e,0x0005adae472c10ef,0x0005a33b884a58b1,0x0009040c36edd948,0x00000193ec4b60a4}},
+{{0x000cc67665ce3f94,0x000a4a8c2509b203,0x000d9c72b1816f26,0x000f4861b4fe8187,0x0000232b96c61613}, {0x0009a582cd0cbef0,0x000ee5154955e49f,0x000d58f3fad70987,0x000a2e8e4956c384,0x00007253210dcc70}, {0x000564bffa3e8993,0x0006edc8eaa8e6a8,0x000aa49ebd91b6f5,0x000996cfb605e2ab,0x0000450e11ad020c}},
+{{0x0000bed6e219415a,0x000b51edff61ad00,0x00033709f59b2a55,0x00006d8f308aeea4,0x0000550b001de14e}, {0x000bdb89d2f79528,0x00099a010a6495b6,0x0008d8eec3949ff4,0x000120fe57ab19d7,0x0000225ac300dd20}, {0x000a7bdb82913645,0x000dc19138b019c5,0x00077c62c1430a86,0x000b71ddf74ff457,0x000029de662011f5}},
+{{0x000e5f7a5025735e,0x00000502351abf65,0x0009a1723208e6af,0x00014f45a7d0023d,0x00002933180adbc7}, {0x0003237785265cd6,0x000645148b421be0,0x000afb9e2adffd75,0x000569a9c16cb3ed,0x000079efe8e8e544}, {0x0003d5c2d8d4376a,0x0001591c35cbdc69,0x000013b04fc52898,0x0008338968bd723f,0x00006daa5bcbb805}},
+{{0x0007b91707cfcb69,0x000d322d4f788ed2,0x00041f8a6529f9ed,0x0005052b8bf8ff07,0x00007c46cdbb0ad3}, {0x00036b1670ecb60d,0x00049fe0fa5f89ae,0x0007545575eba568,0x0000b21fdc86085e,0x0000395cd6e95503}, {0x000aa1bfac3a2aee,0x0006a29c72e31135,0x00020052dec95c4d,0x0006e8b08c6f3e20,0x00007902550c20b0}},
+{{0x0008d66e5d633544,0x000ee9b7a3b83ec1,0x00008f9772e06b25,0x00063c7c2103adf1,0x00001c74aefc50cc}, {0x00082f39d3a66884,0x000bc3ecc8e41f04,0x0007aa9a93183c75,0x000baab1e1275faa,0x00001570d14bfe5b}, {0x000767856efc0d67,0x000615e826a830fe,0x000aa47dd2214b78,0x0000e07665eb06b0,0x00005f8838d00783}},
+{{0x000fb57f1c1f549a,0x0005ddcd4a7959a3,0x000c9536205bc117,0x000a9b29d07022e3,0x000051f0165170bd}, {0x00091af9a45910c8,0x00013362ccde5e4d,0x00002ef760310645,0x000375ac2549ee38,0x00005198f09a5958}, {0x000e2a7850c0079f,0x000fb505862122a3,0x000017871042b796,0x000c6b2019a6428f,0x00003cbd71763501}},
+{{0x0009775bb001f846,0x000a4a37699f3dd5,0x0005c00b3de81e24,0x000799fdf4bf2451,0x000055bf2fe88438}, {0x00033e872c97b56b,0x0003977c395a1369,0x0006b827ff762f96,0x0003bd8d5f23b20b,0x0000539260230941}, {0x000e1c1331d6aa34,0x0006287161d56bd6,0x000f9cc621425342,0x0005caa94c669917,0x00000a4faf62bfb1}},
+{{0x000c55ed0dad4c66,0x00090fabed329731,0x0000e1d5a1ec797d,0x000805414c40135b,0x0000650813ee6f79}, {0x000ac207b8a56a39,0x00067c5e9246db35,0x000e7d51d3016d5b,0x000f3b8d2c782e53,0x00007d765c198910}, {0x0007e14719a901be,0x0001dde3c85f5454,0x000988d7a76b9302,0x000aa791ef0e6058,0x00000d40d22b0797}},
+{{0x00067534fc9b3f2c,0x0003be0bef4ff81d,0x0003b9f6b367acc2,0x00066bbe27cbdd74,0x000035ea2c547425}, {0x0009d1977dc55054,0x000432159ca54dd4,0x000b9311cd5dc45a,0x000082315710725c,0x00001824841616bd}, {0x000aa23f08c66f61,0x000c94411303d2b4,0x00050b442ffb7ee0,0x000139963aa555af,0x00002357bcc3eafb}},
+{{0x000d1791459331a3,0x000815d47703c241,0x000c2a6ffd37631f,0x0008ca367ae1e0f6,0x00001766173248c5}, {0x000e3eab7afd1be3,0x000190de49f4706c,0x000caadb07d38a33,0x0005848036e7c381,0x000023a386691e69}, {0x0000b6975f7e9572,0x000294471d6bad54,0x000046c32ad7d459,0x000ad61b00d28037,0x00000d13a72d1f57}},
+{{0x0000f88cedd4825f,0x00081c1364419926,0x000550f29f2e6c99,0x000972b13df72c6e,0x000064aab38958c8}, {0x000d13b1efdbd0b6,0x000cc6c7513d6d04,0x000ad9065f4c2f9e,0x00049cfac0e2fa22,0x000048431115fdd0}, {0x000dd9ff528c3f2f,0x0002c569aa9f6281,0x0002781cd9b217fe,0x0007adfe65447a47,0x00006962f1de4bfc}},
+{{0x000f1e6a266b2801,0x000c4d5739f16fae,0x000b03762c866c68,0x0005a8df68a2fbc1,0x00005975435e87b7}, {0x000c5dc5f3c29094,0x0009a2a9105abcd7,0x00021c3058c781a2,0x000d4d780c61d364,0x00004f9cd196dcd8}, {0x000297d86a7b3768,0x000241ad17a63199,0x000c1c0c17d0d058,0x0000307ba029cad5,0x00007ccdd084387a}},
+},
+{ /* slot=4 [{1,2,3,..,32} * 64^(2*4)] * G) */
+{{0x0006f74bc53c1431,0x000ce2072eddece1,0x0005b23ee72b9725,0x000c908b8b9c36fb,0x00007e2e0e450b5c}, {0x00062b434f460efb,0x000d4a63607d69fe,0x0007a0da24ded303,0x0005b93f052210eb,0x0000237e7dbe0054}, {0x000575ed6701b430,0x000e69f0bfd10013,0x0003e47f22231094,0x00055e375320f158,0x000071afa699b111}},
+{{0x000e6f9b3953b61d,0x000eaafa141e665c,0x0009f759fec65839,0x000c28e0f435ffda,0x0000021142e9c2b1}, {0x00023c1c473b50d6,0x0001f3b38ef10ea4,0x0002c9be9551e87a,0x0009a1c9b84bf5fb,0x000000731fbc78f8}, {0x0000c71848f81880,0x000225ecec119e43,0x000bba15e3bf960c,0x0005808b6dae0836,0x00004c4d6f3347e1}},
+{{0x0007eccfc17d1fc9,0x000a651403c1418f,0x0007ee0cdf6c75f5,0x0007a22dbde712bf,0x0000193fddaaa7e4}, {0x000cddfc988f1970,0x00027b0b9f51b2f0,0x00079176be6b9162,0x0009fa86ec7b6c47,0x000038bf9500a88f}, {0x0002c93c37e8876f,0x0005a18d1462c1fd,0x0009241276a2f61e,0x00049695080f5823,0x00006a6fb99ebf0d}},
+{{0x0006c1bb560855eb,0x00038f893f09d6a4,0x000f71acc12416bb,0x00096ead71d11378,0x000075f76914a318}, {0x000122b5b6e423c6,0x00010f286ff8eeeb,0x000dcf5d8c939d70,0x000eb1090a92a831,0x0000136fda9f42c5}, {0x000cdfb1a305bdd1,0x0009d9ff82c08f94,0x0003bb588a0f364b,0x000dcba2a87d8a5c,0x0000022183510be8}},
+{{0x000766385ead2d14,0x00080ca7c58304af,0x0000211e3da08ed8,0x0006c030d13a6e61,0x00006a071ce17b80}, {0x000a710143307a7f,0x0009ec47da45f9d5,0x000e927ad3b063de,0x000426c22bbfe52b,0x00001387c441fd40}, {0x0003c3d187978af8,0x0003d7f0e4413b5d,0x000b477ca0722b5a,0x000dc920d7b4848b,0x00003171b26aaf1e}},
+{{0x000f319097564ca8,0x0004c2275e119a92,0x0004875150ff7bb8,0x000835a4f55fe37a,0x0000221fd4873cf0}, {0x000db7d8b28a47d1,0x000d61770a4f1a60,0x0003ddbd58a6bf14,0x00043e9d4a1f8935,0x00006c514a633442}, {0x0002204f3a156341,0x000e9ba0a032d232,0x00010f030efb73e0,0x0004aaafce0dd4c4,0x000048daa596fb92}},
+{{0x000a8e665ca59cc7,0x0004b2e38aca06ec,0x00021e17cea84725,0x0004af731afc708d,0x0000676dd6fccad8}, {0x00061d5dc84c9793,0x000e3ef41820614f,0x00046277ac9941f9,0x00079a9cdf5b88f3,0x000058c837fa0e8a}, {0x0009688596fc9058,0x000f37b56a01b0cf,0x000935d66a1ddcbb,0x0007f0adcc2e77d4,0x00001c4f73f2c6a5}},
+{{0x000a4fbd305fa0bb,0x000e054c663ad0e7,0x000fe33848829d4c,0x0004c42f421c3832,0x0000795ac80d1bf6}, {0x000e706efc7c3484,0x000b4c3c1cf61b36,0x00081cc7e573dfc9,0x000675ceb1d79c97,0x000070459adb7daf}, {0x0001db4991b42bb3,0x000234b02dcca1b9,0x000f8c78dc572696,0x0001fd39fdf9ee51,0x00005fe162848ce2}},
+{{0x000e7f8c0c5e532a,0x000116a2076f86d9,0x00018efe552dc7b0,0x0004ee9f1c170122,0x00006eaf6def038b}, {0x000df8718ed12d9d,0x0002dd5107fcbb19,0x000c9be252d07abe,0x0007d0ce348a3a86,0x00001d65bd894a9c}, {0x000d056edd9d19af,0x000d709286a28d63,0x000f02c3ade3f4fa,0x0004b0eebf2e3ea6,0x0000387b08593188}},
+{{0x00041883c6f65f40,0x000eccada868d2c8,0x000b4423adafbfd0,0x000352ac48c89b94,0x00003f94f1a9bdc2}, {0x0009b83bd843ef80,0x0007c284cf427ac5,0x00085b0ccab28649,0x000bdd23660b60b3,0x000023fe7564850b}, {0x0009f5b229efb0cf,0x000a19ea402067d2,0x0004ed3bef75e086,0x00076b561b2cea95,0x00007f61b4ad84d3}},
+{{0x0008a026f12c0d8a,0x000befaab6be2eae,0x0008bd1d9b76d638,0x000f77100db10e21,0x00001f1d1909d735}, {0x0007fc7eb589d7d8,0x000c621b07781af5,0x0000ee281a990774,0x00019dfa91f06bb8,0x00002e6ff9668b09}, {0x000c12f51c2e2dbc,0x0002850f919d8183,0x000cbfc0fb74c2f6,0x0008aac8a669ded2,0x0000468385209826}},
+{{0x000fcf5f66e10884,0x0008fcabcddc8f77,0x00046cf7571eb4a4,0x0000d8d45a6a9000,0x000073e118d4ed1d}, {0x000fd50423856f94,0x000595331b7b56dd,0x000a2d6c8a4f0139,0x000a6c46fd0941d6,0x0000242248a82c64}, {0x0009d04192d88051,0x0004d38825b28da4,0x000dcbe632bf3a22,0x000fd5dc2b008c93,0x000001cdf7aa40dd}},
+{{0x000a1bc721c57fff,0x000105498c08ca1e,0x00078d3fd075241f,0x00008f6fc68c24bf,0x0000209071ac1f48}, {0x000cb9edbbeba5ec,0x00081bd521e548ec,0x00038533882d336c,0x000605ed34852201,0x00001ca5c367ec2b}, {0x00035ac8de0ff080,0x000474601c615796,0x0001a5e3acf8a407,0x000f8d7fad484d77,0x00006caaa614a4e2}},
+{{0x0009d9b6e552651f,0x000877a64cc22c0f,0x00036bf9593c7dec,0x0007cab782464b94,0x00005dec6eda62bc}, {0x0005a802760ac0fe,0x00004af62ff589aa,0x000d861c9b34e27f,0x0000c540322e0cd2,0x00004330817fc22c}, {0x00040d5fa085ec5b,0x000e66d567b80adf,0x000149704ffc127f,0x000d6b0db23092d9,0x000038ee5aebeee7}},
+{{0x000f31f63f922cc2,0x000d878a02c83279,0x0006c429494dce84,0x0006234f31ea380d,0x00004f1c96cdf4aa}, {0x000ccca233c16c65,0x000fe7ba6586743a,0x000f922370169b12,0x000317480330e274,0x00002bd0e69041e1}, {0x000ca3a9c4ac7e37,0x00094a73dc0643f4,0x0007ded52afeecea,0x00081c0fd267dc60,0x000059718a4dabd4}},
+{{0x00090aae4d077c41,0x00070db7469a3e27,0x000abd16a28b9382,0x0004b726eb632dc8,0x0000720814ecaa06}, {0x000c29c795115389,0x00007862f74ce315,0x0005927432d7e0e5,0x000a1e40c4a76218,0x000072de6c984a25}, {0x000ab553bf6aa310,0x000a9806d6e1bae9,0x000dff5139050a50,0x000618b92bb7403a,0x00000394d27645be}},
+{{0x000381279b16dcfd,0x00083f29a66fe5c6,0x0003420737851ac7,0x000c73e9b357c57a,0x00001170b9016794}, {0x0009b4f512f675e1,0x000484ca394add18,0x000d09f0c921c9ee,0x0000b8ab84179597,0x0000408e5996dd9c}, {0x000060e9c470c2be,0x0006b13bf53812d4,0x000ca64c65eb9e5b,0x00081edb58c92d5b,0x000042018feb68b7}},
+{{0x000d6145587699b6,0x0003c91459e0003e,0x000c54795168b900,0x000a1498679ba59d,0x000045ab246af68e}, {0x000739669758ae5d,0x00084817f8db3efb,0x00027bdd1bd151db,0x000d07c56c732b77,0x000047aa20b1e1b0}, {0x000daa7972b748ac,0x00011725c2bffbee,0x00039a6a736cc1c2,0x0001b6ba42219026,0x00003767e41ded82}},
+{{0x000b26ce4cac5f29,0x0002cc197778f16f,0x000b98c1d6cf02bb,0x0003f4455f3c635a,0x000068f20d52905f}, {0x00016519fece35ba,0x00039d804efa2916,0x000edb21c1209e12,0x000152523db7fc51,0x0000104b5fcbcb2a}, {0x000673233662edbd,0x00093a4ab91c5916,0x000467f6f4e55693,0x000e4a7544a672bb,0x0000504e03b1004a}},
+{{0x0009b4da4221bf5e,0x0008f91ede2ae6a2,0x0008e5649799d9df,0x000c1a1abbb7282e,0x00007c5e489da07f}, {0x000c74707d311c32,0x0000dde55ea5d0c9,0x000a17ebf0801bb6,0x000c20b286960c29,0x00001f52de08817e}, {0x00095c2148011ff4,0x0000ab8fe024bf3c,0x0007ca0838005d74,0x000fcbb0e3297825,0x000069a312ed86e3}},
+{{0x000eba9e1461956a,0x000f046c2cb0d2ae,0x00071f08d91a0c24,0x000efe44b252e76a,0x000012c62a3fdf4a}, {0x0008410de12d0ef6,0x000b57405efd097c,0x0009764ae161bcdc,0x000646362510463b,0x00002dc095cf8a4b}, {0x0007ff560d5be777,0x000ee60bf560a3e0,0x000cc8748df034cc,0x000b93e0f79c8d5f,0x00007b95d33bda6c}},
+{{0x00018aa2e03eef8b,0x000cce579b74971b,0x00015d0dcdd4680b,0x0003e02e1b157fd7,0x000029a5a5f7d1de}, {0x000bc6a8cd303b42,0x000e4f84e1e47b3b,0x0009bbcf8bbdc252,0x000018a10b8d949b,0x0000296b59895bbc}, {0x000f1fba8ea88872,0x000f9906bcb70938,0x000f153a781662d7,0x00036221a578b015,0x00001cbb2bf3bd35}},
+{{0x0003d1d03a51c7ce,0x000eb811f7ce8716,0x00068baf182df64f,0x0000b61401a7652d,0x0000730f03dc714e}, {0x000ad185fff9a2a6,0x0009eda666eb37fd,0x000b62f86c17e439,0x0002d702bf4ed489,0x0000087c66726e17}, {0x000611fc3dc83271,0x000748a7ab732302,0x0007e1f9b0f3021c,0x000322799fd36062,0x00006bce46f80da6}},
+{{0x000657d96828352c,0x000301ca8d42e982,0x000fcda00d488030,0x000348e978e99ec9,0x000056b69985f077}, {0x000537fed52ce247,0x000db6f605010872,0x000b349f8bfb3fbb,0x000433921209e314,0x0000019162b71d96}, {0x00008641e53c3448,0x0009554ecd606d45,0x0004313ae049bc5c,0x000733026bdb90ca,0x000025e1c978deb9}},
+{{0x0000476bf3161b20,0x0007c1117c851b49,0x000c8855a0c69b1f,0x000862c7425647d6,0x00005646193cb7e4}, {0x000223df2dea40df,0x000caae97c0c97c9,0x000648d11790ea4b,0x000177308ee0cfdf,0x0000106175b77afe}, {0x000bae6f75ee1c64,0x000e16fca3a37a26,0x0001e070dfb39bdd,0x0006e368eb82fc53,0x000009bad2e52be9}},
+{{0x0002ab5817f7bafc,0x000b4e13766c152c,0x000c3f65ec0c3962,0x0004e9de63477211,0x00001d524841164b}, {0x00096b7a35cb93af,0x00049149322d0eba,0x00051e54d2701fc8,0x000abf273abe278e,0x0000103cc7ff8e57}, {0x000494f26fd1b512,0x00066500528f16cd,0x000418e2ff9e63c3,0x000338c476e08c73,0x0000025105c96ff9}},
+{{0x000c3285e5e53e0a,0x000f01fe5df01abf,0x000a7be0665e9beb,0x000e9200ebce0958,0x00006928db4d8439}, {0x000bd23789f5040c,0x000aced0a3884e93,0x0004e8f6dc2f0dd3,0x000046825103e514,0x00002f1237f0ebcc}, {0x000c1e1721c880e8,0x000d4abdf2ef3c1c,0x000b362c2dd62949,0x000619401c6129b1,0x000032d482ca9803}},
+{{0x000bc31059b111ee,0x000825e66c59b951,0x0007999793f1fbbc,0x00030d01bbe9daf9,0x00002854b76e38c4}, {0x0008ea72a0a8a7b8,0x00000b30d0d559d7,0x00055b7b1f4f3902,0x0005e4647ad2c6dd,0x0000646b80e6d2fb}, {0x000ea8a54e1205bf,0x0002e3a8e7d259db,0x000e22723730b462,0x000733c13e16cdf4,0x000028259a8f6a16}},
+{{0x0007dcf79c559b00,0x000cce7865481401,0x000b2192d4599d9c,0x00064ce2ef3f9029,0x00007b401d277223}, {0x000903340c0fd613,0x000a81360190e2b0,0x0008d0785012218f,0x0008738e7fd49f83,0x00004056a6271965}, {0x0003663c170e3878,0x000228fe3706c63c,0x00088139d93200c2,0x00014bbd9012ae49,0x000052540a9052a7}},
+{{0x0006ab62fb3668c9,0x000f05eb48299a02,0x0000d7aebd354b51,0x000d2b7b70885c9a,0x00000b89415f57f0}, {0x000ccde0e6a7ea42,0x000a8c0085d7099c,0x0004c22f35eaeeee,0x000ced8d939863af,0x00003aeb31e0de4f}, {0x000fd5d5f8bdee0a,0x000720d4358339b3,0x0005634f678358ff,0x00021eb5a3311877,0x000072a155710117}},
+{{0x00066ed092a65391,0x0006f0b606e35ecb,0x0009ba6938f94cdb,0x000cccf4b76a2134,0x000065f747b8ee6e}, {0x00077047fbfbfd0d,0x000a6346ce1010aa,0x0003271a32e59d0c,0x00040549028bd4bb,0x00000756d3192afd}, {0x000162d35b57baaf,0x0001522855d5e61c,0x000e2aeabfb2042f,0x0000c5913d970562,0x00003e6f621ad30b}},
+{{0x00072251857eedf4,0x000dde19e93c54d5,0x000b797035e3724e,0x000e7438a71420e0,0x00003b3c833687ab}, {0x00096425b23545a4,0x0007e98fbb296f53,0x00036fdd8615a7a2,0x00034eeab6c52bc6,0x000079d995a84193}, {0x000a8ea61195dd75,0x000a81dd9a82fcd8,0x00035879b6a504d8,0x0006a8a540dca81a,0x000060dd16a379c8}},
+},
+{ /* slot=5 [{1,2,3,..,32} * 64^(2*5)] * G) */
+{{0x00055ec27c59b23f,0x0003e154d04f2caf,0x00014141f499aeed,0x000a0a268441d72e,0x0000140345133932}, {0x000430e0dc028c3c,0x000a85217c771d91,0x000c99a1fa0eb955,0x000743c4b09e1ed2,0x000042881af2bd6a}, {0x000ec69aab5cad3d,0x000d34cb2cfad7bf,0x000b37d6a2c23e8c,0x0007a18685dd14bf,0x00000ad6d6441567}},
+{{0x000a439e417becb5,0x0008cd10e0266781,0x000692ac244ac593,0x00012335da385110,0x000011b065a2ade3}, {0x0004892847927e9f,0x000ef370aa877791,0x000112270333dad6,0x00095921f8f24fa1,0x00005265ac2f2adf}, {0x000fdd309afcb346,0x0004428e63f54405,0x000f65aaaed9723d,0x000080994c01df05,0x000043e4dc3ae14c}},
+{{0x0002c7f1a938a517,0x000ab3180b2e1bc1,0x000bcd254a473028,0x000f90f3f78571ef,0x000074e534426ff6}, {0x000f7ac3adc2c6a3,0x000f6e9717c94ea6,0x000645eaf5d0e928,0x000fbbee2d379ead,0x000046dd8785c51f}, {0x000801be375c8898,0x000b5e3fd8348709,0x00072307144b06da,0x0004c4275880ced2,0x00002b09468fdd2f}},
+{{0x000749eeb701cb96,0x000d4b6a369c397c,0x000a402cd983f438,0x000df7b62962b8b9,0x00006976c7509888}, {0x0007946582ffa02a,0x00051fea8f5495b9,0x000f77af9bda096a,0x0001e76a06351375,0x00001bcfde61201d}, {0x000a5490246a59a2,0x000dee87fdd904a4,0x000d2371fad63ebd,0x0008ed6d9437c670,0x000069e87308d30f}},
+{{0x000a8bb15656beb0,0x000ba4f4d5bca435,0x000548c075f8fac9,0x000b622b9b278c41,0x00003eb0ef76e892}, {0x0000bf028bc80303,0x000b37a18cefb0f8,0x00072cd6a36aae16,0x00039aadd47ea47d,0x000061943588f4ed}, {0x000e5c3e91039f85,0x0007df6f33aa9d26,0x0000066a93c0e9e7,0x000addde8968c557,0x00003c34d1881faa}},
+{{0x000d2b5ea09f9ec0,0x0006fb623a8903f9,0x0002d926c41dab3b,0x000b36da09ba3ea7,0x0000374193513fd8}, {0x000b0b8f2fffe0d9,0x000103ed24fb9bd5,0x00026821c46aa254,0x000a36a2ac7d7bcb,0x0000605b394b60dc}, {0x000856e45a9d1ed2,0x000766c97a9a2b4e,0x000e5eee7defe848,0x0001c8fb104cf641,0x00002f50b81c88a7}},
+{{0x00023c61fc6811bb,0x000486211800f317,0x00079957539cb450,0x0002fcd768933d34,0x00003491a5350275}, {0x00052ca0a7da522a,0x00036449b02502b5,0x0004b99fb93230b3,0x0004a22f2c4c5bca,0x00007b2c67495807}, {0x000165883ed28cdf,0x000d2d362de39d55,0x0003378e4f12d84f,0x0003e740a874ad3e,0x0000000d2b1f7c76}},
+{{0x00020811d06d4a67,0x0008590e0ffe33d4,0x000d487bdebefc04,0x000fa28f870c6b7b,0x00006e2a7316319a}, {0x0004778c3e94a8ab,0x000cee9a78bec962,0x000d743c4f0ad6f3,0x000fccc948ac7810,0x000076627935aaec}, {0x0008ac24d6d59a9f,0x0003e3096f00656a,0x000f4c5299c8db75,0x0006114477f41e68,0x0000588d851cf6c8}},
+{{0x00078246eeee8700,0x000533af5feab90b,0x000a78e95fa81915,0x0000a5079f680c99,0x00006d7467dc36e6}, {0x000695ae2b28085a,0x000ac66da8caa2c8,0x00039a990c58167a,0x0006b009a8b40701,0x000055cd49391c9d}, {0x000b6f34cd8612da,0x000f0058fb329681,0x0000c53795f95210,0x000e4004a0f71b17,0x00005845382d8bcf}},
+{{0x000dfe5452527d03,0x000958ef04d23c23,0x000120221c400884,0x00062c3bb1bec946,0x00005765f3e490e4}, {0x000185e8e82ac206,0x000d8d3594892356,0x0002340227063078,0x000634d52a0018f4,0x000040e5b0e668d0}, {0x0006a687f66be558,0x000841b2a0bbb394,0x000a62d2e62c954e,0x00043ed9aff92619,0x0000248abd1d530f}},
+{{0x0000e51c2a20938e,0x000e7d964cc5195d,0x00053927406e59d6,0x000c70e5dd84e197,0x00007eb74af44975}, {0x00066d9a09f4271a,0x000427f45650aeaf,0x0006241a7b4c899e,0x000d9249232e5496,0x00004e8937d290a4}, {0x00083ae74b53d5a8,0x00081f4549b0822d,0x000bbf907512b2da,0x000be794906ffb30,0x00000c068de93916}},
+{{0x000bb1e5f91006a0,0x000819ef1f871e24,0x000033e02f943686,0x0008cd0d1f196cdb,0x00001cf137641d6b}, {0x0003ba402c88ebb3,0x0004c19142a8fd35,0x000267932417a8c4,0x0007011ed62061e8,0x000028682db56693}, {0x00059c751661bfb6,0x000b7738503f390a,0x000f998c2ad05c1d,0x000c831f73350800,0x000064f0e3be4552}},
+{{0x000ca273b72ae1b1,0x00028a95c62cf6b7,0x0003b5a1ea737285,0x000253b72ad93f7d,0x0000002bb828c80d}, {0x0009f186cf7fa6ab,0x000b8e9e121c0ae6,0x0001017bcdd40ad1,0x000f0f87b7dd8d0f,0x000025c41d21e358}, {0x0006eaf9bb329cb0,0x00071c0d52856940,0x000cbe08cd12eaf0,0x000cccef444076e4,0x00006a2a15c4ba3f}},
+{{0x000b0301f19f6461,0x000cb50cdb7c72c1,0x0000d3bdb71702e0,0x000af10e42bbcc9f,0x000078c2d3976208}, {0x0000f39fdf0f978d,0x000e02f62cb7eab8,0x000a102c5f7c2b01,0x000bbcd027cfbb66,0x00001f89108467e5}, {0x000c86a07919daf1,0x00034eff52659e5e,0x0001fc6f65f4e527,0x00031f42146435b8,0x00001b1e8ee91963}},
+{{0x000bee85210f219c,0x0006c6c853a42449,0x0004788df98bee82,0x00092215562a1b14,0x000018d7bb57fbc5}, {0x0006fbd9843401be,0x000daf4977edea62,0x000f4e52bd0c8b50,0x000e89d60ec1a206,0x00006f0d8778b691}, {0x000eea407587a77d,0x000f9bb08d10a03a,0x000b05ac06d6e3ca,0x0003552ebe3aab8a,0x00005176392c18c0}},
+{{0x00038ec78df6b0fe,0x00089e575f51b511,0x00017af1b95397da,0x000d65009207a1d7,0x00002102fdba2b20}, {0x000a65e777d1f515,0x000878faa60f1cd2,0x000abc06e5548991,0x000c9fbb1b73bbcd,0x0000654878cba97c}, {0x000ee405055ce6a1,0x000681251ad29969,0x000a7da41536bca7,0x000b2ba3a1af517a,0x00000ad725db29ec}},
+{{0x000bbef58e4a9414,0x00077a99da2e8a35,0x0001f010cde3674f,0x000c6d5844488737,0x000015bf060e7f22}, {0x000c1d7323f63387,0x000581be62e71f3a,0x00026c1ab91ac2ce,0x000bd53cdab18758,0x00006016a592f4f6}, {0x00077a3cd1b3a870,0x00007154241372f5,0x000b12ee015a9970,0x000a44a6c2ef1b87,0x0000129ad40ffe9f}},
+{{0x000fb4e1ed5a0e94,0x0002d4094edd8382,0x000ab4c8c25e37e3,0x00039e2d4a6bc461,0x0000429cfc2dcfd5}, {0x00002a051b2958cf,0x00073edc5f1ddff7,0x000fabd70666afb0,0x00072c9192aa71bd,0x0000228121df7154}, {0x000271d484353a4b,0x000d3b40f1a032e4,0x0007a0f37c88d49e,0x00038a0935fca435,0x000075f7accc231a}},
+{{0x000cd03927c6dc1f,0x000316ac5ca0d5be,0x00031503b3b771d4,0x000ea4794f25de50,0x00002848b8df0e78}, {0x0006c87c91c5fd74,0x00032c8429d59da0,0x00046511c27a4884,0x000f42cba28a2cd1,0x000062183ba1b20a}, {0x0000142da0874d09,0x000414b3f28c9019,0x000495d494f1bfbe,0x00015dfdef0d20d3,0x00003e4daa17b6ad}},
+{{0x000b55c1a6081dd8,0x000db4fffbabb596,0x000f01c8163c92f6,0x000e19e103416b25,0x00003bdb0f24fb01}, {0x000e148f6d195ac1,0x00095cb6619042b3,0x00019913967bd024,0x000c442ba2071aa7,0x000044dc01303f5f}, {0x00001ace08117ff2,0x0008de953f0985c1,0x00084d910e1cfed7,0x00041ae29910e2a2,0x000012b4c1ceb274}},
+{{0x000ede2f2f56adc2,0x000b423611780d62,0x000cedd1eecf5ec0,0x00009f38688cd7c0,0x00005a76091a6845}, {0x00092fa9e98ec51f,0x00096852388091d5,0x00028d00203d1edc,0x000bd0ae03fe4f58,0x0000377f96ee52cb}, {0x0006c5a96804bbb3,0x000948d4cf264417,0x000a00eee7b6a55b,0x000ad078a1a09cb1,0x00005574e77974e9}},
+{{0x0001474903cd663c,0x000dc04e658f7f16,0x000eb711219f8035,0x00044d914477c3ff,0x00007d629dbba374}, {0x000c741d35cdab98,0x0006b30946069350,0x00045ea123bbcff9,0x000ce6f155a3b143,0x000061eb28153e89}, {0x0006fb8a416ce61a,0x00069efcd065c9f1,0x000660c168ae6134,0x0008a2aaa7ef2d2c,0x0000567430f819da}},
+{{0x00073785eca78139,0x0001a667af64c67d,0x000eec69f55f5d9f,0x000f0ce556329a99,0x0000192192a0c8d9}, {0x00033c1bcbc87396,0x0007a106c183289d,0x000327d8077ef249,0x000e832ac3ccfbfb,0x000070f6dc6ef2b2}, {0x0001641047d1f42b,0x00040f8811df926b,0x00008604434619b2,0x00081affd115071e,0x00000ce8f4bdaeb5}},
+{{0x00042dedf11695a9,0x00011bf2e6acc7cc,0x000b105fa317d95a,0x000b5df8b754a616,0x000025db7cba5bb7}, {0x0000e998e9b6c25e,0x000065c135a9db0b,0x000ed4788e057020,0x000746b81206f924,0x0000782cb8f73a71}, {0x0001e3d0d6c67442,0x000afe9b0a661845,0x0003fcd35fe999ef,0x000b0f185a36210f,0x00005e3c4c361014}},
+{{0x00074d8a6ded27f7,0x0000533c402122fa,0x0003811ee80c108d,0x000e00586d9b6c22,0x000025648f8c99e5}, {0x000f8c8d8cab843f,0x000001e13cc961da,0x000a2595beceeaeb,0x000af63e1a23f4f7,0x00006cde0be506e0}, {0x0005821eef006399,0x0002241e52659254,0x00005dade196c388,0x000f0efa5814b1ec,0x000079ac73a0ff59}},
+{{0x00040d29c1bfb17a,0x000fff65f3237740,0x00099edb830efda9,0x0002bd146a8c40df,0x000051f273361277}, {0x0005e3927a8bd8eb,0x0006da2995ab025b,0x0001a747ecd9ac8d,0x0008d6d290793b4d,0x00006c17f52eee0a}, {0x000968d7bf2c04e2,0x00093325ed2bb2d9,0x000a2958f0362aac,0x0003910f897a149e,0x0000496e22844518}},
+{{0x0007ae604c2436c9,0x000b9e64462aed73,0x00007cbd0fbb2065,0x0003135e07a70f8d,0x00000b2964203d51}, {0x0004406c60f157a5,0x000afebba3739156,0x00084899e90a0bed,0x00077bb22b373911,0x000022628143866c}, {0x0007b1d418daf5e5,0x00081a5d233d1262,0x0005db44313e4bcd,0x000d41001e1e96a3,0x00005079a6327a81}},
+{{0x00031e4a8cab302b,0x000a03b275d1401c,0x00079eec7926ef25,0x000d1786aadeeda2,0x00002ca8fc4e4c52}, {0x00094f7036c2b354,0x0001d1b98092e188,0x000f9f46442f9dff,0x000180718c1a81a2,0x000030959c0d041f}, {0x000ad6cb1cf6889a,0x000d3423d0dd2139,0x000d70a9ae51d54b,0x00024e21f143e572,0x0000383d6f6aa013}},
+{{0x000f538779e8a7d9,0x000c0aa1f84838d0,0x00087bb794947814,0x000a56f005dcc99f,0x00001f82fb488417}, {0x000f16d95b6f6d01,0x000e6efea678c9d6,0x0008c3d9df477b54,0x000f3ae78b01c3c2,0x0000105a541971cb}, {0x00029a9209f42470,0x000617dd35e716de,0x0002e6b964f5864b,0x000b971827e098a2,0x00007c69ad2bea0e}},
+{{0x000ebc89754816ba,0x0008beba606c9265,0x0002925121d2621a,0x00081866a4620988,0x0000265f27255518}, {0x000c1ea0964397a3,0x000f40a044ae4e9a,0x0005f5757766fb10,0x0002192cc0858b03,0x00000fcabe856cd9}, {0x0003117af99d6925,0x000e7adcf6af9532,0x00056c48391633f3,0x000fb2dc7880367c,0x00003cbc843ff182}},
+{{0x0000666fc7195533,0x000ec07b82e85595,0x000b8a64f7018b1b,0x000b967a01f6d1c2,0x000079b1d3f1c6c8}, {0x000817d33110186d,0x000c5e4d2e58a2f8,0x00001909fcd767e8,0x000b49b8a96fc8a0,0x00005f44c326afc3}, {0x00078a1a89354d2e,0x000a8f0d426cc408,0x000790ccd6d6fdd6,0x00053d68e1147186,0x00007abe8cc56ee2}},
+{{0x000267b1834e2457,0x000b570ce1bc5dc4,0x0007d15ed7b67544,0x00036501af07a0bf,0x00004aefcffb71a0}, {0x0007bc0c9b056f85,0x00068e7f5ffd7fec,0x000312aefa537d52,0x0009fd977afc6624,0x00004f675f530239}, {0x000d36360415171e,0x000118998483bc32,0x0000945110cd2bef,0x0006561870a6eadd,0x00000bccbb72a2a8}},
+},
+{ /* slot=6 [{1,2,3,..,32} * 64^(2*6)] * G) */
+{{0x0004b7c7b66e1f7a,0x00025f50c2f7eccc,0x00013eaf1c44157e,0x00063f73ef06dfc7,0x0000582f446752da}, {0x000c54e91c529ccb,0x0009264c635fb967,0x000812196530f626,0x0006f5c2747aff47,0x000017038418eaf6}, {0x00017bd320324ce4,0x000e8a4488bc4c63,0x000e5a1364a81042,0x0008dc9b21ef18b4,0x00000c2a1c4bcda2}},
+{{0x000dc7d06f1f0447,0x0003edb87c059d24,0x000bb2d28fb2269e,0x0004877d15b0272f,0x00007c558bd1c6f6}, {0x0004814869bd6945,0x0007dbe1c8d22edc,0x00055cc5ab0d6d90,0x000dc83c63bd212d,0x00005a6a9b30a314}, {0x000c1524d396463d,0x0008ac35a24f0d0e,0x000cbc5fa412bb62,0x000afc3a50c3a791,0x00000404a5ca0afb}},
+{{0x000f40070aa743d6,0x000cb5b265ee88c1,0x00068fd2deccbad0,0x0009633574b046b6,0x000046395bfdcadd}, {0x000c9e1b2a416fd1,0x00028e350598b62b,0x000d5d6967b5c6f7,0x000ee9804343fd83,0x000039527516e7f8}, {0x000fdb2d1a5d9a9c,0x000bcd1005c2a117,0x0004d56fea9c7745,0x000d016efd4bef15,0x000076579a29e822}},
+{{0x00068e7e49c02a17,0x000a2bca9a37f45b,0x000c224c1b23cd51,0x000bdb13ed65f11e,0x000043a384dc9e05}, {0x000cb51352b434f2,0x0004993de80e1333,0x00050d35ced83228,0x00077c1b55128877,0x000002c514bb2a27}, {0x000bd5da8bf1b645,0x0007ef6b54b53684,0x0009b0d253fb8bd3,0x0008059313916d7a,0x0000116092096154}},
+{{0x000d166929dacfaa,0x0004c8413598fb44,0x00053d5559da529f,0x0008e0be9ef63ca4,0x0000351e125bc569}, {0x00085616369b4dcd,0x000a7655c35637a3,0x0004f1802175c02c,0x000e0427dc21bf9d,0x00002f637d7491e6}, {0x00049b461af67bbe,0x0007ac8ab8961d4b,0x0009a699fbd60303,0x0002a9a71dee19ff,0x00007f182d06e7ce}},
+{{0x000c8e64ab0168ec,0x0005515edc5437a7,0x0007cd0edacb5a4a,0x00093b0095519d34,0x000067d4ac8c343e}, {0x00054b728e217522,0x000f4d484b8d8094,0x000f46903caa58e8,0x0005217d358254d7,0x000044acc043241c}, {0x000d6bbb4f7a5777,0x000d4918313e11c7,0x00096b46848b35fe,0x00071bd4adca1c6c,0x0000556d1c8312ad}},
+{{0x000f40e30c8d3982,0x0003e15a3fa3417e,0x000773646e31f707,0x0004eff4f21f3cb0,0x0000746c6c6d1d82}, {0x00006756b11be821,0x0002310a3f3dd81f,0x000a99465d0faff8,0x0007f05f8b2d0556,0x0000097abe38cc8c}, {0x0009c9877ea52da4,0x000559bdc1d430c4,0x0007ccebd24c4369,0x00084bd022c3809f,0x0000577e14a34bee}},
+{{0x000268ac61a73b0a,0x000103791a5f5f0e,0x000b6d00e9f2fafa,0x0008f42c1e13e826,0x000060fa7ee96fd7}, {0x000ecebebd4dd72b,0x000da060f221194f,0x0000c8d1fff46a4f,0x0009295124a5977c,0x0000705304b8fb00}, {0x000d1d354d296ec6,0x0003e5fad31d8b63,0x0004bd42ecf3c305,0x00053fd670b958cb,0x000021398e0ca163}},
+{{0x0006982f71033891,0x000cb3fd4aa1ae41,0x000c98adb7be0de8,0x000c8eff5e627f24,0x0000180284ce7860}, {0x000c07518ade616f,0x000ce3411335ec44,0x0005763f981eba39,0x000700ecaf5d21ba,0x00000817fa483f96}, {0x0007db7c0ef507ef,0x000f6788e4ea2e60,0x000bf899a04b89c8,0x00007fb3a1868696,0x0000756efc48e627}},
+{{0x00027468d6069569,0x000047e31c50cbe6,0x00084f7c4b245d74,0x0004c4f83633fe14,0x0000563eda16d88b}, {0x00010ce84af07ed3,0x0002d78bd3497f0f,0x000591df187523b9,0x000665b9d1c3a6d8,0x00000ad92ce8908e}, {0x0003a2a87ee5a9cb,0x000dc9ddbf18fcc3,0x000deb170274b3df,0x0009ae9c5861924c,0x00002efac9a32ca7}},
+{{0x00065e5eb4066b1f,0x0000819bfd9b0603,0x000c5f556924d774,0x000300353cb22338,0x000038fd7bd72c4b}, {0x00023c43b7599f46,0x000093006b68eb36,0x00021ffe84605f01,0x000c30b4a0c02920,0x0000769c701aa554}, {0x00039789596d5760,0x0006ca29c182ffb8,0x000a5ad6f0ab2300,0x00047600890e59e0,0x000010abf924042a}},
+{{0x000defaca2b3fe9d,0x000f66c7ec7de005,0x00041e7c71135e8b,0x000c2d39b2b62745,0x000037d8127af782}, {0x000dd64141e2b45c,0x00097c979ab77839,0x000f8f2180586bea,0x0000855c7a9d27da,0x00001758d03d158f}, {0x00074630213c0408,0x000a37fd1da9e4e3,0x0002505a8beca028,0x0007cf7595d014d6,0x00006ed8797c4ff1}},
+{{0x000e9f3319c736e8,0x000d9413ffa3e067,0x000e28e08f20356d,0x0000f72ce44f8a07,0x00003c71cc12b2b4}, {0x00007041ab34a678,0x0008027c7aab307a,0x0006f052eaf7d57c,0x000a4355e1e4bf21,0x00004ed25641c32b}, {0x000c7280322c7bbc,0x000b263731f39e46,0x0008d9282b3619c5,0x00098c1877acca09,0x0000168bd21df528}},
+{{0x000300d01c79beff,0x000d13ec362cbe81,0x000c12a951f73ffb,0x0005f344338bc129,0x000003075741b755}, {0x0008fe52c01aa385,0x000f87e63ff2ce29,0x000c33c15b972440,0x000a72ef06138aa8,0x00004c3a62cc0c79}, {0x00084b86164a5c61,0x000cc06bcf0d580b,0x00050d020262beb4,0x000912cb91af69dc,0x00004c338160ba22}},
+{{0x000886393ecc0b56,0x000062ecebc79dd7,0x0009e7d26b195fcf,0x0007b21b6ada91e4,0x00006caf423fe696}, {0x000f0159e59d2828,0x000b23651d05a58a,0x000a4408b8755ecd,0x00069fd14abbd013,0x0000474257a650c3}, {0x000ae5204c8ae852,0x000781a9b4599af9,0x000ea29d96fdc5d5,0x00068cfc7f271cb9,0x000005ba24e3a7df}},
+{{0x000ab2ca8da7d2ef,0x000dd99f42827216,0x000fdd3c75366ad9,0x0009e62ae64b9004,0x0000403a395b5390}, {0x0005fc16861b7e9a,0x000476a27c45186c,0x0001e93597f6a330,0x000dfeb01667267a,0x000005ffb9cd6082}, {0x0007fa9ff53f6139,0x000e513e66cb6a61,0x0003448aa460f2b5,0x000a192d7a8beefb,0x00007a2932856f5e}},
+{{0x000af055aba5402c,0x00029e22ef241009,0x0001f0f092fe6116,0x000e5dda1e82b098,0x00002d113297030c}, {0x000a69d9058a942b,0x0001aa5b33e291ea,0x000c9803bf0bd1a0,0x0004684c29ed828c,0x00006407c4d9c86d}, {0x000c847d92bc2b9d,0x000d2d413da4252e,0x0005e97946d57689,0x0008d288fade359e,0x000003435a60986b}},
+{{0x0003362bfa5a0b90,0x000ef87e50f25d7b,0x000ac704155bae05,0x0008e0d9274f7942,0x0000209037254b52}, {0x0006fa78604e8a8b,0x0000ad2bd8230488,0x000f11f8e13479c8,0x0007162e2e2a17bf,0x00000334ead871a8}, {0x0004d1bfcd873d95,0x0005347f9fb5412e,0x00069db10b1cb74a,0x000c5cd1486adbf1,0x000065c4c9933ad1}},
+{{0x0007390061cd267b,0x000b44f4c6d8c9e8,0x000b0645abe85f58,0x00067086b6700dfc,0x0000362e2d3482f1}, {0x000d3ccac5e9943b,0x000cc2c3f6d1f9cc,0x000efd75c24ea942,0x000b6eb8b883cb89,0x000019334ee4902e}, {0x00022d7e49312368,0x000cd67bc9517220,0x00002597faf6ffca,0x000d20dc1bd57386,0x0000000ba51af691}},
+{{0x0004cfd6e48e37c0,0x000559d402f0b8bb,0x0003eece73092bed,0x00087a56247b2d07,0x00001042671d1fc3}, {0x0004b115c7c3fbf6,0x000f7d0be2bcc15e,0x000256abec2624dd,0x000f5ff44191338a,0x00000543d6968185}, {0x00061eb8f41461f9,0x00057cd0e3f945ee,0x000d12aa2c0ababb,0x000f447e22884efa,0x0000244eb6c1cc3f}},
+{{0x0009cb7bd5cdc8d5,0x000d6a494d7ed3c9,0x00010a5f19954e22,0x000320d4f32a63e1,0x00006b50a8015b59}, {0x000cee481ca7a909,0x00008e5cc89a53fa,0x0002d632f0abd831,0x00003f62417b6ed5,0x00003f0f1506f627}, {0x000e516328493b5f,0x000fcce0f94d7355,0x000658894b6578ff,0x0003afd33d21c4a8,0x00001bb3c35b6014}},
+{{0x000819d5dc792a5e,0x00050b4848864003,0x000343fe7716243c,0x000d8fd05c0bb619,0x000064ac4a755eb2}, {0x000f55274155bb73,0x000d543e8cf64b9a,0x00064e35e0740001,0x0006a05ea79b5968,0x00004cba3c30829d}, {0x000b0ee09c6e4a7f,0x0009e8f1bc2f53a4,0x000f9252b25c2395,0x0000d4f81942606f,0x000029a159c7209b}},
+{{0x000c976c50980f21,0x000806f82d9f3433,0x0007b233a5be82b9,0x0007df0b370946dc,0x00000e1f1ee9b589}, {0x000bbbf85ea5ad7d,0x000ed9078a4160fe,0x000a7b1a9569fc91,0x00058a6469a8bc0e,0x00003cdf65224f94}, {0x0009736d6ba3cd50,0x00008a0cb0c1fa2b,0x0006b48f88adad4b,0x000cd8ee185f34cb,0x000000d64ec06383}},
+{{0x00033f07cb2d19ee,0x0005877c4a126dac,0x0009146246e1f7ee,0x00014a9e1a7fa443,0x00004df07a41fd9b}, {0x0008481eff883244,0x000c77621fd1d88a,0x00048974b2a459e7,0x00075c0fb44d594d,0x00007c12aa95b35b}, {0x000446c0094037ea,0x0001ea6d42426615,0x000425ca592ef0b1,0x00095ce964746181,0x000042f5823623db}},
+{{0x000a51f39693952d,0x0009f25246be9bb4,0x0003e3c58fb0af3a,0x0004c0d2f5d2d2f6,0x0000587d34b61364}, {0x000bbd157c3976ca,0x000658a678ab3f6f,0x000a0a03c8252397,0x000ec7aec47c75a3,0x00005db94f73f39c}, {0x0007a731fa073283,0x00011b487e539e2a,0x000b9af92a43a679,0x000160d6cc7e0957,0x00005587888bd021}},
+{{0x00026bbfd89d4282,0x000474df472135c9,0x00067438094c5166,0x0001ea880971362b,0x00007ee5bfa2521c}, {0x000cdda57b6f0f6d,0x0002443a19eaf8ec,0x00023c5f7f5eb1e1,0x000103a55274c6d3,0x00000ee54f8c298a}, {0x000717ea4f7c5f98,0x000035e49e0385f4,0x000f91428ab91698,0x000893fa4a983123,0x000075363be9ff10}},
+{{0x00077a3d38c1f41d,0x00008024c17879aa,0x000063467a8204d1,0x00086e0fa1cadece,0x0000422bc9536e61}, {0x0009f03199ae873c,0x000eba09d6d72de5,0x000775505e3e155a,0x00068a8fb503ad5c,0x00003f5857409809}, {0x0006ec0bc0e5e3ba,0x0004647edfaec9d1,0x000abe4bda3114a2,0x000388269869c8f7,0x00003badd35e18f8}},
+{{0x00093a0c32491ad7,0x0002d6c6cc076890,0x00070bddbd0714b3,0x000c45c0c2b037e5,0x00001d93f6845dd5}, {0x0007378c72b3aa97,0x00087a3d62734acd,0x000e011c4330aa6a,0x000b82e85b92a63f,0x0000410321a79eeb}, {0x00033b7638f6333d,0x0005d97ced6b123b,0x0009949a3c82018a,0x000653054847a5e0,0x000008640def690b}},
+{{0x000dc3a31368b41f,0x000df799896e2e16,0x000971e9a9ceeada,0x000bf54f7851c894,0x0000150899468a9b}, {0x000e45737584bedb,0x0006fd1817810e35,0x000860850e3d3f83,0x000f82ac473300da,0x00004b15053e45ce}, {0x000c8c72e38b16fd,0x00093ea90a37acdd,0x000d86a236893742,0x000caabfb53c638b,0x00000261a5f9c26f}},
+{{0x000467881c1a5676,0x000b9802e85c3579,0x00077bcf3776d089,0x0009b403bd862fac,0x00001016ac8e21d1}, {0x000d765b80c99182,0x000ea7318d698356,0x000c39e0ad4e3513,0x000fd71f721259fd,0x000005181e9138a7}, {0x0001c2e762db9e0c,0x000edd11b1370a2d,0x0006c868052a200f,0x000492df74d869f0,0x00006bf4fd2b86de}},
+{{0x00021794e3fabb42,0x000cab53c92a7412,0x0003da36e384f086,0x0009cadcae9e0460,0x0000449b36b6d34a}, {0x0006d035ff5f28dd,0x000af8863397e046,0x000b76c3f6f934d6,0x000292f8624479d5,0x00007d895d2690db}, {0x0003e757669a812e,0x0005d0e03c8561aa,0x000a762c274a6fab,0x0001a4c0aef4ce38,0x000026d794ecc61e}},
+{{0x0009d761b02de888,0x0007ed2414e1f0b3,0x0002e1a9405f550e,0x0007b99a6bfa4582,0x0000050a2f7dfd44}, {0x000c444879639302,0x0009350c67f2cb89,0x00081af9c64ae4f1,0x0001017f0b35da8c,0x000039d000354687}, {0x000c3b33a650db77,0x0001dbac52bb2437,0x000db7d3186bafe8,0x000a6cefe99402d2,0x00002b5b7eec372b}},
+},
+{ /* slot=7 [{1,2,3,..,32} * 64^(2*7)] * G) */
+{{0x0006123a6b6c6609,0x0008580ab5938b49,0x0007c27a5fa750fe,0x000193cf471bf39b,0x0000507903ce77ac}, {0x0001a66a90166220,0x000ae5bf1e009ff9,0x000f90df7cf22552,0x0006fb97dff85d87,0x00004f620ffe0c73}, {0x00090d65dfde3e34,0x00092b9fa5fad62f,0x0006164510cf28c5,0x0006c8499c86ef9c,0x000025d448044a25}},
+{{0x0008230ec7e9b16f,0x000c1c1c5795dbd6,0x0005b6b1ff0eb1b9,0x000cf5e7943c8c49,0x00002f9faf620bba}, {0x000c4415c9022b55,0x00041812eb1fe2c7,0x0007b65e0d56a0d2,0x0003b26f02ea1c9d,0x00004180512fd532}, {0x000f3e698a48a5db,0x00006bd95403ba4f,0x0007d5b65dba6a38,0x000d2fb9f7ce1af4,0x000015e087e55939}},
+{{0x00007543745c1496,0x000fdda38610c122,0x000c71c34fdaff3c,0x000ede9e4e797272,0x000039c07b1934bd}, {0x0004186efb963f38,0x00080dc639bd5889,0x00096c1c9948a00e,0x0003661a4e8092be,0x00005a097d54ca57}, {0x0005892b17c9e755,0x0007289308df82d4,0x00025b8bd9d033fd,0x000c0796c2fe9d95,0x00002edbecf1c11c}},
+{{0x0006a4e3c715a0d2,0x000b0f8341d4d161,0x0007e899cb53623c,0x000baa696ef5329c,0x00003d4e8dbba668}, {0x000f0fddd087a25f,0x000555c3e34eeee0,0x000fab3ab59c7531,0x000d3b2660c572e8,0x00000854fc44544c}, {0x000ba0c555edad19,0x000fef0a83de661e,0x0003baa5f824b533,0x0007e8d3b7704288,0x0000678f82b898a4}},
+{{0x00091d0bd6900c54,0x0002c9d132636b14,0x000b362bc9353972,0x00069df4db928920,0x00004d7cd1fea68b}, {0x0009d94057775696,0x0005c3cd951db1e0,0x0000bce16feed126,0x00089f4fa9dac2b2,0x00000f7f76e0e8d0}, {0x0009ebc5d485b00c,0x00092e4adb36536d,0x0002119ccda25964,0x0000d5fc1659480c,0x000045306349186e}},
+{{0x000dd0c1a6cdff1d,0x00015e84213ae94d,0x00092fcf6a55f6f1,0x000f16f6c935f859,0x0000067ee0f54a37}, {0x000414ec2b072491,0x0008127a7b65b96a,0x000e8a4af01bb221,0x000765f6d2849596,0x000065f3b08ccd27}, {0x00029fff199801f7,0x0001fa2a0f72fecb,0x0005fd2f499d361d,0x0000fe225f11d237,0x0000124cefe80fe1}},
+{{0x00026cf9d18df255,0x000e9147a63b64c1,0x0003c93b5fc1d471,0x00086a22c6d3c73f,0x00006be3a6a2e3ff}, {0x0008e85b31b16489,0x000b7db710bfb151,0x00014ae2398faadc,0x00020c139b0bdf4a,0x000005f4cbea503d}, {0x00040e9ec04145bc,0x000e208f6834cce0,0x000b8847a3c71ff4,0x000aba5bd546e8da,0x000064666aa0a4d2}},
+{{0x0001435a7c06d912,0x00021bb3f830b684,0x0001cbe278ca123c,0x0005046d4b37b27b,0x00001d753b84c76f}, {0x00053bf73337e94c,0x0007e11e14f15b0c,0x000930c7507cb569,0x00004684b84abac1,0x000028dd4abfe064}, {0x0000b64c44cb9f44,0x000ace3925dbf7dc,0x000d0457c418a3e1,0x000892e7a3034862,0x00004c498bf78a0c}},
+{{0x0002e90b7aadd808,0x000a54ee51c0648b,0x000630832b8282ec,0x000197b79bf5292b,0x00001463e6b9bb9d}, {0x0007d68ea08a7d76,0x00092ac4bb6e3d2f,0x0009ed52b9f652a9,0x000035b2afb26eee,0x0000164e0a1ef3c6}, {0x000b238058bd0515,0x000ed88be433cf46,0x0008aebfa4cfc2b9,0x0008865f1f410ea1,0x00006619461fa446}},
+{{0x000bdd408ed6bb19,0x000d2b266831ce06,0x0009d37f8dbd6a32,0x000404dab187eecb,0x00006e26c676b92e}, {0x000fc105a03b9d8c,0x0005a5662c8852a4,0x00087a8f69bbc856,0x00011f87e4b35499,0x0000361758a6af14}, {0x0000aa98694aeefd,0x0006250bd0bfd7e2,0x00097c01c0375511,0x00060e8f1cbb73c6,0x00003e64792a813b}},
+{{0x00053e19fc6a63d5,0x00092f23ef160539,0x000d8d7160ba9a68,0x0008cbc9cf131559,0x00004de5b29f1baa}, {0x0006981c62974d10,0x0001c1dc4b523029,0x0005fb970ea50538,0x000d3d2d94bb50ce,0x000002da246fddfb}, {0x000b1c4fa5e477d4,0x0003e9a8be3f6275,0x000bb3cdb02e4146,0x0003b93002d172b5,0x000077a6ba07bc4d}},
+{{0x0000d542761dae58,0x00051bb3853d7e1f,0x000fa0384e0626b6,0x00085e27217d3069,0x000007eca458ba5b}, {0x000e83bd9633a6f3,0x00044521e2a4f8e3,0x000afa471f48462b,0x000a52fddce596ce,0x000008f1cf564dc9}, {0x0002ec7078b2da10,0x0001cfbdbfd68b38,0x000363a4b3115587,0x00038a7b96b04704,0x000039a5804ca2db}},
+{{0x000ef67e01313c90,0x000d583cd3526277,0x0009a84642dcbe63,0x00048f0268aca07a,0x000018f20c02bc3d}, {0x0007efbf1a9fb0b3,0x0009c583ef38a71d,0x000c6280f515edfd,0x000d1df5b0699414,0x00001e0e659bb67d}, {0x000bfa2fbbed3371,0x000d9a9449d496ee,0x00057edad87b1c61,0x000e0b492f9846a1,0x00003b5283ab2860}},
+{{0x000157667579d008,0x00066501629f1355,0x0008c96b540149bc,0x000909e2425f4271,0x000050dfb55de41f}, {0x0009643543ce6179,0x000275e9e548f2a1,0x000b2c7be0b2af40,0x000c225f85e3653d,0x0000154802e8d378}, {0x0003b391d1a3ae79,0x0007888759cbd3c1,0x0008cf0be600e90a,0x000513a07c216671,0x000036805672d2d4}},
+{{0x000e933728f865af,0x0006bf9c8b323d40,0x000cbe78ed0f7039,0x000a5179b19f13c2,0x0000186e2b93f4f6}, {0x00097d563505dad1,0x000d740aac09a7b8,0x000b6f3c40ad386c,0x000a4528b219692b,0x00003cfd636f871d}, {0x000ff4dc3a7dc716,0x0002c997ed505614,0x00083d769b631f29,0x00094bbdb19f1be8,0x00000f7fbb6982a0}},
+{{0x000653fb1aa73196,0x000303fd7641837d,0x000b3a17b20f9495,0x000613ead200b09f,0x0000544d49292fc8}, {0x0002aff530976b86,0x00006c2d2460422d,0x000de5bae58d90b8,0x0000c17dca1896c4,0x000028005fe6c834}, {0x000fba9f34528688,0x0009425107da16ae,0x0006d94b365c1bff,0x0006dfaf75bbbcd6,0x000072e472930f31}},
+{{0x00032c51b2bc1f64,0x000db6a69b8f192d,0x00091fbfa6192126,0x0004964d0bb1ccec,0x000045226c60ce05}, {0x000233d47015baa6,0x000cd6b3d56eab45,0x0009203a212f9029,0x000aa1fdd51f1632,0x00000af8c8aac00c}, {0x000a6b1237055479,0x00007373fbfcb202,0x000285fe3f0099bf,0x0006e224249d5f54,0x000049bb92103620}},
+{{0x00030cefcd71fec9,0x000325f1ad933053,0x000cafad8b708093,0x000b6a6911ef5d0a,0x000040b548533a9f}, {0x000daaf7c057f81f,0x00017931f7240dab,0x000dc1bb84f248bc,0x0005756ddc4ba270,0x00002ba3a29a0d27}, {0x0006a9bdb837d0ba,0x000a6d38ca813263,0x000b3bb38962339b,0x000e928a4bdf8190,0x000054ef7ceca01a}},
+{{0x00019eec66ea5129,0x0003893216f7db75,0x00009c9cfacd1257,0x00040df213100386,0x000051663fdb06c4}, {0x00007f8876a5b63f,0x0001e32788314887,0x000f925d36b5da36,0x0000cbf0280adba8,0x00000503e2361719}, {0x000b629bf543012a,0x000480a67939b3de,0x000ca1e4f6c2810f,0x000f855d78cb0a22,0x00001d1929c3a1d1}},
+{{0x0004e8cf181016b5,0x0006125a6b5f25a5,0x000438e1740e4c1f,0x000cd47b529e5af2,0x000022a6ac6d603a}, {0x000df83b3df5edaa,0x0006bbe3264713d0,0x000d873d3107ee51,0x00024c68cff70e18,0x00006bf09d8b29d1}, {0x000c298eab1e97de,0x0008185acb022b40,0x000e73f11968631b,0x000105b800f24855,0x000006a581c37dc8}},
+{{0x000a7cdb1140308e,0x000512f824d0834a,0x00074e34a5d7d338,0x000745ead83b7fa1,0x00005431e5a8cf97}, {0x000bad204e65c2e6,0x000ccf084818e858,0x000b840a86b3d96f,0x0003523ac00f43a9,0x000013687cbef97d}, {0x000d6d07c8b8c498,0x0002ce5c7b9aeee3,0x0008232859914ccb,0x000b147f80bf1940,0x00003fa6f8003899}},
+{{0x000e78c37b9ef111,0x0000100ba2188994,0x000a50200c6bff3c,0x0004d08ac134dc03,0x00004bc3014b2020}, {0x000198787ba68cdb,0x000d0e2c96612a4f,0x0007a20eb0b5a2be,0x000081c730a2cd01,0x0000065b2517b0b7}, {0x000dec2feabc580d,0x0003ac02e795a21b,0x00067c34378b0484,0x0007cb2c3683e08e,0x00001f68f10e9923}},
+{{0x0000cb5836da90bb,0x000917018b2d4507,0x000cdbb06c83579f,0x00054cdde74d77e3,0x000015717c73f181}, {0x0002a3912b7abe65,0x000c6a6627189602,0x0008b2f1315572e0,0x000061219b8bbd83,0x00003079fdb80ec6}, {0x000ae82b97ab2fc5,0x00066ec040b565ee,0x000786fac272e735,0x00009c31093e06cd,0x00002b012926127d}},
+{{0x000136cddf306cd3,0x000e008a341436e1,0x00026ab424a4de02,0x000ce4a224ec6454,0x000074d660210d77}, {0x0004ee9c02699304,0x0004e32f3c84f4ff,0x0004e80fe2f49bbd,0x000814c0f0686e3d,0x00001953cf2b85a2}, {0x0001460a039a6846,0x000a02f9b8061663,0x00062fc0d6a04820,0x0002e149d355ca00,0x0000581e05489183}},
+{{0x00026197b5c89250,0x000ba332a163bf9a,0x00044cac98465042,0x0005e3f6cf3d3457,0x0000220d614b753c}, {0x00088ca764937b1a,0x0001562332241203,0x000222da6370756e,0x0000027bc33848cb,0x00006554d96518aa}, {0x0007898e025c7612,0x00093781a99753c7,0x000f54d176db8202,0x0009693e3c0453ca,0x000048d4db9c2e88}},
+{{0x000551a6fe5f7281,0x000627c7f3fbee45,0x00037072e494fe05,0x0002abfcf5c6d382,0x00006d13e8dedb98}, {0x000b2d9b9ad1076b,0x000a337fc3e494ac,0x0007ceed602dca0b,0x000439d1461e3613,0x000061a76b971fee}, {0x000e428a04cca531,0x000e7a2121d12b49,0x000f16e43d5c17ff,0x000f81bcc44ce50a,0x0000040021fed596}},
+{{0x0009e01187ca7e5c,0x000acb33fc4d128a,0x000be8b189718b5d,0x000e33b29ad5c91a,0x000008ff0201b13f}, {0x00080b05bfede1fa,0x000270950c9ba971,0x0003d183b3425bb7,0x00090d77a3d7928e,0x0000326c2d92c434}, {0x0008d9c1d83c1861,0x00026f80670e061f,0x00073a3232f39292,0x000f699c7b8e9ad2,0x00001be70da43216}},
+{{0x000145574aab866b,0x00082e8177fcd1d0,0x000c3c878b51d878,0x000f699cc366dfde,0x0000716b7b7dd86f}, {0x000811b98044ccc4,0x00004d2b9b46e104,0x00023f6e202ff1ec,0x000de1f5e4c0e05d,0x00003bb4f49d8d4a}, {0x000ad848bfb46081,0x000dbe10a9c636f3,0x0002ea9e6a9cc9c2,0x00023689df90959c,0x00003372ecd5beda}},
+{{0x000e1a18526ed91a,0x00057d4c78cb6b7f,0x00097abc48b9add5,0x000048dee29f0bbd,0x000019b08abbb914}, {0x000aceebc161340b,0x0007461f67afea84,0x0000fc73e2f3da0d,0x0004b8bcf07710ee,0x000019800fc86d9b}, {0x000c64b973096d2a,0x000fe86e41f72efe,0x000ee8a04bd90c5a,0x000d7fc7ffe2a672,0x00005bfa63cdd511}},
+{{0x0006d7b7870e0f3b,0x0003f9f5fd0661d0,0x0003434accd33a44,0x0007f862233b5a8b,0x0000161fd5d14145}, {0x000bd820518187dc,0x0007c1426220342c,0x000703a04a3ef5d1,0x0001ac943cb78a06,0x0000199ae12a9a90}, {0x000479c8458af959,0x00038c7a92140169,0x000b11ac8bc3c249,0x0004c43f6a77e2e5,0x00007020bd198dcc}},
+{{0x000fda3599c6c516,0x0008c0413ed6dd1c,0x0009e742b35cd280,0x0001c3925511844e,0x000011a52bce8e37}, {0x0007317db7c6aae4,0x00027af585ee66e7,0x0005b9ca211e28f5,0x000d934790a84ba6,0x000072ad2d2cb609}, {0x00046efad61217ca,0x000c6659bfbcbc1b,0x0002d3e0722a77f4,0x000f9cbba4050655,0x00000406cf012859}},
+{{0x0005208c9781084f,0x0000b23450ee1269,0x0003efde02b1502a,0x000a34cfd9daea60,0x00005a9d2e8c2733}, {0x0003f635d32a7627,0x000865f6566f007f,0x0008d044507aaa4d,0x00064383c85e7972,0x00001fee7f000fe0}, {0x000305da03dbf7e5,0x000491434cdbd765,0x00024a88eca4daf2,0x00005437b4ad5cdd,0x000000f94051ee04}},
+},
+{ /* slot=8 [{1,2,3,..,32} * 64^(2*8)] * G) */
+{{0x000fa9c59c2ec4de,0x000bf4f84f3cb296,0x0007a8f908bc8b61,0x000255d1c7706d91,0x000063b795fc7ad3}, {0x0008639c12ddb0a4,0x00030c024866bd59,0x0008fce460a5d19f,0x0005e8ad17c2f035,0x000007a195152e09}, {0x00068f02389e5fc8,0x00002cf8de43ba83,0x000541264390433b,0x0000137afa1fd5dc,0x00003e8fe83d032f}},
+{{0x000b15b90570a294,0x00070670845492f8,0x0001bbfd8494f242,0x0004007de1c5ae16,0x000075ba3b797fac}, {0x00004c8de8efd13c,0x0008e33e03731087,0x000260cde3dfc51a,0x0008c86a59d5da51,0x000022d60899a625}, {0x0009dbc070cdd196,0x0008b6c7d8a9a623,0x000b40126060fe8a,0x0009e5eb38847bce,0x00000904d07b8777}},
+{{0x000e1fd4ddba919c,0x0003ec74c8daab4c,0x000d86cc51cf31db,0x000de072c63cc63a,0x000043e2143fbc1d}, {0x00022d6648f940b9,0x0000cbd2d0c39f43,0x000081f93106952f,0x0002a6c167697ada,0x00006240aacebaf7}, {0x0004749c5ba295a0,0x0005bca37d25af83,0x0007c9316ad6947c,0x0000cac66f13ba7e,0x000056bdaf238db4}},
+{{0x000ab9e3f53533eb,0x000d56eb93d40362,0x000d5a5572338568,0x00013189e0e14521,0x00001d24a86d8374}, {0x0000d36cc19d3bb2,0x000b7622386b9131,0x0007a14f5c062a6b,0x00057547c9b8591d,0x000003aa31507e1e}, {0x000c7648ffd4ce1f,0x000f054ac8c1cf4e,0x000d09357ce045ea,0x000485988d225821,0x000043b261dc9aeb}},
+{{0x000b1e1988bb79bb,0x0007dc17a359de55,0x00003dea33a09ed0,0x0006bc2b02c2ee26,0x0000326055cf5b27}, {0x00013d8b6c951364,0x00026000bf47b195,0x00054f956794fe71,0x0000964028d10ddd,0x000002b4d5e24294}, {0x000155cb28d18df2,0x00046186ce508b4a,0x000c824389eacc46,0x0003410c49cf4936,0x000027a6c809ae5d}},
+{{0x0006ebcd1f0db188,0x0003a675a5be88ba,0x0005f5585a37d3d7,0x000a17ef22edfa31,0x00002cb67174ff60}, {0x000c270ac43d6954,0x000576a66cab2cd2,0x0009d7036cdd4a3e,0x000259979fa59246,0x0000221503603d8c}, {0x000ecdf9390be1d0,0x00044728ce3f159e,0x000a94f0f4a94220,0x000f43682891c667,0x00007b1df4b73890}},
+{{0x0002f2e0b3b2a224,0x000062b551160e49,0x000d7f7b0e7c6c9e,0x000599215eb8fe20,0x000061fcef2658fc}, {0x000e221807f8f58c,0x0009fd49409d45f2,0x000fb6a630e3555c,0x000e03db2aaa88d1,0x000068698245d352}, {0x00015d852a18187a,0x000d386ddacd7dbb,0x000ff6c482f3e4aa,0x00001cf44bae2810,0x000046cf4c473daf}},
+{{0x000525ed9ec4e5f9,0x0000116903303426,0x000be5cadc0e5eda,0x0005f4072b1a7f2c,0x000029387bcd14eb}, {0x000c6ea7f1498140,0x000f8392b4854213,0x000629ceba7c1e7e,0x000c5bb2488c38c5,0x00001065aae50d8c}, {0x000c4525df200d57,0x000d6bfca674a1c2,0x00018340305c3b2d,0x000e7160a07e7b1e,0x000069a198e64f1c}},
+{{0x00055531a8008200,0x000ec0075319488c,0x000d1a20efb162ed,0x0006580fb5582078,0x00005af14d2f26e2}, {0x000c725b8c0b77ed,0x000f9e9624fe136a,0x00070a4bc77e0aa3,0x000caaf579db1614,0x00006e370171be4d}, {0x000fee959af78abd,0x0004e9cb178edd8c,0x000edf97aadcbe46,0x0000ac5d3fce713c,0x000060323d90642d}},
+{{0x000944c5947f2254,0x000759f4a156791f,0x00066a028dab8ce2,0x00097f35f777fecd,0x00002b892c891fd4}, {0x000555d3e59e035e,0x000d6528625d1fab,0x0000b87924860aa5,0x000351519a1b72be,0x000007c99f0fe56d}, {0x000547405eacad6e,0x000e0f557de9ede4,0x000c2ceae3bb164c,0x0007583975057924,0x00000e5406da4213}},
+{{0x000e9fe3c77a43f0,0x000c2cf36fa64b50,0x00041b6b3708f0fd,0x0008ae7685a523ee,0x000064669a5f42c2}, {0x000dc0b6d93deed1,0x000c5335ecb50d40,0x00076ab4b894c02c,0x000b8db17dad1f01,0x000036ee03441063}, {0x000f480894895815,0x000a8b30c81026c9,0x000a00d594b37a71,0x000a576e10e8c059,0x000064197797c994}},
+{{0x000b39c7426f6b96,0x0008508bea681f79,0x00051eaf5571b23e,0x0002a08b2c7f676d,0x00004ba27608710b}, {0x000f35dd318ad089,0x0000f634c643afa7,0x000247348573bff4,0x00006631cdc10c7a,0x000019705014a499}, {0x0001d3068afd2af5,0x00097c6c9f86d5cf,0x000612ac760ab1d4,0x000ab4e6a5fe5887,0x000029448a53ec33}},
+{{0x0007b7d1da0bd10a,0x0009813d984cb673,0x0006796564df7a51,0x0003d2f96cbf4429,0x000030d54fc53a94}, {0x000bce694d144a49,0x000f64a17c6e9c13,0x0009b85b175be937,0x000b909d45e522f6,0x000005ed922e78d3}, {0x000144f39241b7b6,0x0009d2cdbd08daba,0x000daa8b2f3ecc00,0x000cc63808c8ac36,0x00006aa6c86942ce}},
+{{0x0007648a2a8557f6,0x000e7312f3d74243,0x000972a86946b7a4,0x0006eb08fbd97fe8,0x0000465836b6ed03}, {0x00090c475ba92a5c,0x0007cf90f78f4255,0x0004f305da2c7245,0x000903c4ed2ae8b4,0x00002fa92084208d}, {0x000c63176e7d043a,0x000401bc369bfad4,0x0007da2d1fe86eba,0x000b3aac6e143f0d,0x00000958b9aeb147}},
+{{0x000bb2429ef5e79c,0x000bed97b5f7924f,0x000c95fd8a11a35e,0x0005054d578c0741,0x00000259815ef0bb}, {0x000933b3e858171f,0x000dcbece660cb69,0x0004da7a57cbc92f,0x000caf08d63a2e59,0x0000013fbd47827f}, {0x0006377cc96aac5b,0x000ec62835d70896,0x000d8b55abf352bf,0x000a2d3b66904ade,0x000053640740e32f}},
+{{0x000cd613efa9d697,0x000a41c0679597af,0x0001fada960cc45a,0x0000365a56fe104c,0x00003a73b70472e4}, {0x0006e56b9e2d4734,0x0002b81c616757b2,0x000c9cde7fc4c713,0x00043adef5c9525e,0x000039c80b16e717}, {0x00096e0d1b826c68,0x000e24960e3db0f1,0x0003b7436cf71ff0,0x0007282611316702,0x00000cf0ea5877da}},
+{{0x0001cb5bb884a508,0x000384831af42d7e,0x00092f153206a246,0x0005ff712d712813,0x00001b02d4a7c49b}, {0x0004f3a4f0b8a1d6,0x000a18e4791eb033,0x00023e22497a7ae5,0x000863f14ec1cd69,0x000023c55103243e}, {0x000e3c8ae919345d,0x000660b19f5617a6,0x000c807f87deb9ee,0x0002d0df8a13ec18,0x00006779ab8ae47c}},
+{{0x0003add81624c491,0x000a4b60566cdb00,0x0003fead78e727cf,0x000e8ef16bbbe74a,0x0000020e78dd5da7}, {0x000a85f9784657a0,0x000c7407f7c056b7,0x000ae7ca9f695eba,0x000789fed65402a4,0x00005a44eca2dbfc}, {0x00050393a82fffdf,0x000e4616a4f1dcfd,0x00005e7fb7f8124d,0x000d1101ce682624,0x00004f68e814a891}},
+{{0x0001a58f7b5948fb,0x000f5f12ea1108b3,0x000c52310d62c203,0x0009f4a19c40a408,0x0000281352250137}, {0x000b113ea4b99df4,0x000063afcd2462e1,0x00096b6cff7425e3,0x000997b98b288ba1,0x00000728b1c597ef}, {0x0009eae0141ae4aa,0x00037b7ddaa58ffa,0x000a41d1964ea88c,0x0002c69f6cf10ebe,0x0000390a614bed44}},
+{{0x0007bf61a0c14aa7,0x0005a2bcb2eb53d9,0x0006cd902f47bcf2,0x000da4acf07d5244,0x0000626885038a32}, {0x0009a6bd2bc7ec5b,0x00056b7ee961d317,0x0004f63db82cf19b,0x0003d934b2930c8f,0x00007370b8f2032a}, {0x0001c99e83ea1dca,0x00016af5919b899c,0x0005a376b8ef4c61,0x000dbf6d76f41c4f,0x0000235443d642ab}},
+{{0x0007735429315689,0x000f0c021311a1f5,0x000bbb797ab58ccb,0x000b2f01a3c25134,0x0000676cc7fd466e}, {0x000d540872880fe8,0x000d41608a7ca7e0,0x0008e3d91e3e6768,0x0006423acbdb8e81,0x00005ab4ae1e0c4c}, {0x0001f64d1262c1b7,0x0007667d5b1b1c4b,0x000468cf443f9c5c,0x000ce467cad62fe0,0x000017b284bd6f11}},
+{{0x0002cd094b2e4784,0x00001ad50a7153d5,0x000783ffe170008d,0x0003ccbfd3fafe99,0x0000721decd83fda}, {0x000244774bfca642,0x00029e7d981fe654,0x0005b37c53818182,0x000e590d7ae87f76,0x000033cffcd3d590}, {0x00083407c96d3931,0x000eec02e830e207,0x000f242a11ded2ce,0x0008dab0c8692d44,0x00003683e2f7bb4a}},
+{{0x0004fd955b423351,0x00020e37d511b2d0,0x000c381d620f2221,0x000762be34d68f24,0x00001f22105b4391}, {0x0000ced302e3177b,0x000c7f98f7c2ffb7,0x00008a8b91910dc7,0x0003767fb38fea78,0x00005eaf3b278e65}, {0x00064f626daf70c7,0x0003c2f677142cf5,0x00098fd0ca9fce28,0x000aba18bffbd64e,0x00005753389b6bff}},
+{{0x0003da3f4d16b4ef,0x000f8e257f899143,0x000f5cac487c3d53,0x000745c2fc9f50e6,0x00007b8215e42847}, {0x00077b2954969414,0x000546004f42fb48,0x000a8e00ac7d3413,0x000215fc6ef138e4,0x00006df35cacee4a}, {0x00027b5aeff0b8b2,0x0006ef35929b86e1,0x000d421c550dae66,0x000127c502cf5bc6,0x00006766bbb0d845}},
+{{0x00004f337f4eed62,0x000348c73ab50df0,0x0004d3f225092d82,0x000a8adc757629ae,0x00007aaeceb4f541}, {0x000f0f30458ad63d,0x000f634dfa0347af,0x000be7d474f67b74,0x000d911811fe8da1,0x00002456cedcae0c}, {0x00024bd1caa1b8ed,0x000f9e2e89a32b2a,0x0002929d12b7f551,0x000dfd4858ce8d8b,0x00002aaf1fbdcc52}},
+{{0x000215adc17f10bb,0x00019f981d50d88f,0x000bd778c9b86d92,0x000a5e4bee696989,0x00007df44527eb3a}, {0x0001d6bdfab1caf5,0x000b0d8aa1d1b77b,0x0006de65b77c9d94,0x000effa32ce1af2c,0x00000e7f21005635}, {0x0007838906da84fc,0x0000b4baa1babf82,0x00010f499b173498,0x000a54164c58dace,0x00000ae9d32b1052}},
+{{0x0000e8ca4fc62a09,0x0006f481cf630fd9,0x0002eb0cd0420c08,0x0002a3011c6a942c,0x000049b08b8c3c2f}, {0x000603095a8c9169,0x00009cfbf039bc34,0x0007f97810a6990a,0x00075ca083787a5f,0x000046ce61d23775}, {0x0002673199ed4be2,0x000edfcbcdd49e35,0x0007c28a803c2811,0x0008f76277317f30,0x0000616674c2a147}},
+{{0x0006431c33bcdec6,0x0007113a6b69c758,0x00071fb83d106205,0x0007e485abb69ca0,0x00003f0a16fe8a37}, {0x0005b1ee815409d5,0x0001bc1594c3b3e2,0x000178d38c21a5a8,0x0007341e8e846460,0x000019719715164e}, {0x000f5c7d00d821b6,0x000bca475f71d98b,0x000c5f516ba027e6,0x000775397d2361bf,0x00006d9df6755d54}},
+{{0x000b77e18c328d71,0x0001f13c5858c9c0,0x000178a8a558173c,0x000297cac6815662,0x0000122bfedfccfe}, {0x0001e30f540e4e7f,0x000d90effcf63932,0x000bdbc5ad248641,0x00075af0fc432cab,0x00004295b325352f}, {0x0008f18947584fe9,0x000e90bef7b67d82,0x0002c5e7dd54b184,0x00031ac30f8c19af,0x000030c981aee337}},
+{{0x000e53357a75a1e2,0x0005a162157d419a,0x000ce1b6806c8a15,0x000b2a7cbb9631d8,0x00004b70c8326a87}, {0x0006832ce86399b9,0x00055fc1ffbaccea,0x000c239e42341f29,0x000ea68daf590376,0x00001588e1fb1a1d}, {0x0002b14d201baf51,0x000bf2a2a0883675,0x0003831358b223e5,0x000482117206e568,0x0000427812e4dc65}},
+{{0x000f7115bec002b0,0x000ebd1616ffe4ff,0x0006655390916ad7,0x0003060fadc1fdd0,0x00006bb88d6a1433}, {0x0006dc8ac5b4e450,0x00047a33fbee54bd,0x00088e7db9550036,0x000cd69639340b68,0x0000362a870fd81a}, {0x0003e927fe58cad9,0x000a0a5f179b54c7,0x000ccb3352ce9a84,0x000d1ede606755ce,0x000026b64a4e0735}},
+{{0x000c80a4ddd4ccbd,0x0005d95f2dd9d196,0x0000d6c71b22e6f5,0x000042fc75e33c74,0x00007bb51279cb3c}, {0x0002ced43ba6945a,0x00061e881c05de33,0x000e67ed3bde0b13,0x0003d5d1ad40f095,0x00005da8acdab8c6}, {0x0006664a3a70159f,0x0000f0a904e14c4b,0x0004096c1376194f,0x000eceda5614c39a,0x00006cd0ff50979f}},
+},
+{ /* slot=9 [{1,2,3,..,32} * 64^(2*9)] * G) */
+{{0x000acbee4324c0e9,0x000883f955bb7dfd,0x000a31609f054442,0x0007cffdef7aaa8e,0x000068aee7064228}, {0x000fe2e8809de054,0x0006a9c82bad1f68,0x000aadbf45e3bc09,0x000959e076353d40,0x00007b9b1fb5dea1}, {0x000cc8f17471cc0c,0x00037579082bbf01,0x0003e46b5f95242e,0x00085fb27776093d,0x00002d13d55a28bd}},
+{{0x0005d2065b35b8da,0x0009a85624bb7fac,0x000d21cd0fa8da8a,0x0000d58ccd2ca913,0x00006b8341ee8bf9}, {0x00019cce7aee7a52,0x000b6e454ead3bf0,0x0007a8bb19a8ded2,0x00016d83c619f0b8,0x00003619b5d75609}, {0x0009f26b0282c4b2,0x000f24fafefae357,0x0008c8c7c064d592,0x000a8d7b7cded7b2,0x00006a927b6b7173}},
+{{0x000db24f986e4656,0x0002ed1e9105b1f6,0x000cc0a3751021c0,0x0002592f8ff3fff2,0x00001d2a6bf8c6c8}, {0x000040863ece88eb,0x000a980eec08c8d7,0x000d788fdaf0e307,0x000478dac2250610,0x0000056d92a43a0d}, {0x0005a196fc3da5a1,0x000c243b59ed01b0,0x0007d1791877d7a8,0x00053f706da3d629,0x000066fbb494f123}},
+{{0x000a50b9d85c0fb8,0x000258bcf097b751,0x000309a969d1afdc,0x00006592f16a6a38,0x000014ddff9ee5b0}, {0x00070996f12309d6,0x00085e9c3d539d6d,0x0007552411dbfb23,0x0003e0c46d602b0f,0x0000270a0b055784}, {0x000f0640a7862bcc,0x0009a5f11abfe61f,0x0005d12abb81cac0,0x000e873904783045,0x000019a4bde1945a}},
+{{0x000f26f520a6200a,0x00043cf13eaf89b9,0x000631edd3648044,0x0009dc18a63673f8,0x000072bbbce11ed3}, {0x000709dec076c49f,0x000f27f3e53f640c,0x000ca042c4657bfa,0x000df0440662331e,0x000014b375487eb4}, {0x00053c94ab66dc47,0x0003edf762d6eae8,0x000fb2f7d1eb6234,0x000b37af08e0e186,0x00004f0b1c02700a}},
+{{0x00006787d81951fa,0x0008eb290c77be17,0x000ed66773a10a2c,0x0004b54e7382fa03,0x00000a4d84710bcc}, {0x000d21ccc1b2e23f,0x00081453df52a79f,0x000151486b4ae7c2,0x0007534c8172ec9d,0x000068abe9443e0a}, {0x0002c6c407831dcb,0x000d74d5c510dda1,0x000bd404e10da230,0x00040ef4ab1531e6,0x00004106b166bcf4}},
+{{0x00057a421cd23668,0x0005d0eaef6fd02e,0x00012444804ad9fb,0x000f331954e6727b,0x00007f792f9d2699}, {0x0005ccd539e4ecf2,0x000ad0555bab5a48,0x00037df82d5aa3f3,0x000283f145e34399,0x00001238b51e1214}, {0x00086b925fd4d924,0x0007a3626a80d0b8,0x00098abd1260906f,0x00044cfecd367b4b,0x00002876beb1def3}},
+{{0x0004e93563144691,0x000a0d61f23f4dc8,0x0002a9a8d5632fe8,0x00018d34caa80061,0x000048f9dbfa0e99}, {0x0004b3333a8a85f8,0x00089e78d7d58d59,0x000e8e351f4ea376,0x000ebb473bf9f455,0x00005507d7d2bc41}, {0x000b2903299572fc,0x000a29502d0ee1ce,0x0001cce67b7c8cca,0x00031e791bfa4341,0x00005784481964a8}},
+{{0x00086222cd4db1ac,0x00087995454aeff8,0x0003da71003fc160,0x0009289e56b7a86d,0x000064f7369981f7}, {0x0008ec0dc2f7479f,0x00058921ea46f522,0x000161a4c0e2db76,0x0007f34fd5a3209d,0x00003ae0b7e1bbb6}, {0x0003a5572d74b3aa,0x000da706c68f7789,0x00099e794e257d96,0x000f368b8142493b,0x00006dcf9232ed50}},
+{{0x0006bd519accb953,0x00025352b3946713,0x000e1637db674041,0x0001af12e53ee4f9,0x00006eb1b2f6415e}, {0x00040f9e079a3982,0x0005ab74bd7bbae7,0x000bda4146861022,0x000e0f3f9a530a33,0x000016b7bfa429e1}, {0x0003c18b80ae4c27,0x00033f4c0f2ca081,0x000ae4de89cc66d3,0x000df5d847840c22,0x0000592854eb41a2}},
+{{0x0003b596ead2f426,0x000cdcd56bccec54,0x000412e00d607f82,0x000328df8b9c1479,0x000060dc085f0ff8}, {0x00091dfac314aa69,0x00030d92150c6e17,0x000e4ec3dc8b0a76,0x0005febf58aecb01,0x0000111b4a68f56c}, {0x00028ba3f300acbe,0x000d5fb62451a0ac,0x000d95c61b1a0379,0x0004c60915bab3b7,0x000068429b26b9ba}},
+{{0x0003134729dabc56,0x000a26314566b845,0x000a66b4cbb19385,0x00000637d73f7579,0x00003e70c42ddd2c}, {0x0000137c630b94ca,0x000e2c34e035923b,0x000f6850ab9f05b2,0x0008e5e5c504752d,0x00004e165fe78314}, {0x00033e88e5d5b328,0x000f8e58a8ebf4ac,0x0008c8c3a164653b,0x000c2215832177c9,0x0000621d49cdc3b2}},
+{{0x000e33f7a68b98fc,0x0005fc0b0454d0e4,0x0004a738b79dedc7,0x0007833dc9295deb,0x00000e435a0977e6}, {0x000ffd1b412f8ed2,0x000260fd91b93a28,0x0000aedbf14eaa62,0x00076dbfb1b735b3,0x000061893d8a35e0}, {0x000f055e75e9110a,0x000a429ee8c77b5d,0x0009657983fe834b,0x000660ddbedcdb43,0x00003bfc4750bfde}},
+{{0x0002c61c25c64d90,0x00066d78e7a361f7,0x0007922b40af8644,0x000cf7fa3c74af04,0x00006d1ccb56be16}, {0x00089658fb5d4a33,0x000bdacdb05f493c,0x000f20002a6891ca,0x0008666dc517644c,0x00002809841b15e9}, {0x000c95b27c09b60e,0x0003c5198a523da4,0x00098d71393e05c9,0x000c9f212db89acb,0x000007f26a43edf5}},
+{{0x0007bb3cca3478ae,0x000125c5b262f819,0x000c9cf1d6f062a2,0x000b8265c4059beb,0x00005b85162e17e4}, {0x0008c4bdcf030fcd,0x000295e0f36836b4,0x0008bc601166318c,0x000cf836471d99eb,0x00001539d724c7fc}, {0x0009b303a4a9f677,0x00088a4d851ad32a,0x0006387904fb357b,0x000d2a36dcf9e4aa,0x00005cfc38784da0}},
+{{0x000c2b256768d593,0x000574422ca13da7,0x000a0ace1d98c1c0,0x000a690f1a80bd5c,0x000029cdd1adc088}, {0x000fd1ef5fddc09c,0x000fdf7575dced6c,0x00001634c2e82b3e,0x0002b9b25d56b5d2,0x00003041c6bb04ed}, {0x0002f2f9d956e148,0x000759f356b2e0ff,0x000f6c025cade797,0x0009a7b1a4698bb5,0x0000104bbd681404}},
+{{0x000677c270c75fda,0x0000d93e494112a1,0x00032c093c82a95b,0x000a371dc73b16e9,0x0000056a568206c6}, {0x0005b618f14c7aaa,0x0009a77996c37a17,0x000ecf2c3d05bac9,0x0001f1290a856143,0x0000769a66c4bfd8}, {0x0009edef32c88772,0x000e3a363221d29b,0x000e698fa9d797ce,0x000415a6bbf591e5,0x00006dffc678c396}},
+{{0x0005adeff520c84f,0x000c17f2e9af0de0,0x0002382ec772d026,0x000515a33b15c0d8,0x0000098245ad973a}, {0x0003fb616f73efd3,0x000fc6e8dd6f6d48,0x0002ca49e96da002,0x0007f29dc4c303b5,0x0000464589e8c98b}, {0x000fe4d644f10e9a,0x000a4d4c8436ad5c,0x0009616875b72541,0x0001de0d990e4b11,0x000054368b94ff59}},
+{{0x0004aa1f07ab2fd1,0x000f6cde15f41264,0x0005e9cdd16c8e55,0x0007f20a42b463e6,0x00003d3c9b5edbf7}, {0x00075cfa99617bbe,0x0002187f2037d614,0x000297672677eb4f,0x0006a4fe2b1795e4,0x00006ce58869f9ac}, {0x000180b99133c5b4,0x00063d951d508202,0x000182bd48af1776,0x000375ba11fe4243,0x0000761d4e8af615}},
+{{0x0009a90c6ea464ee,0x0001eb1c46127f11,0x000f2531b7ced877,0x000a817d21a4fe6e,0x000076ce9a42f459}, {0x000693607d862f24,0x0006fe3322e53368,0x0004092ec6474a99,0x000ee416fbe91701,0x000043429d86b998}, {0x000f62ca47a19d7b,0x0000bd8c36c8b413,0x00099ae711cd1b4a,0x0005cff2623e2a01,0x00003ece61dd366f}},
+{{0x000daefc7ae451ac,0x0001b47b6508ea96,0x000a2036dacaa174,0x000572ea21d2b7ec,0x0000309e93e59cea}, {0x000fbf6330768d0f,0x00070d15818c8291,0x0001249f3d4282a4,0x000f32003f208b8f,0x00002d82311c8dc1}, {0x000dcde561f8e4a4,0x0004875421dbe67d,0x0006b4da4a41f51c,0x0006e3eace449a25,0x0000750c8651598f}},
+{{0x0006b9c8f3a482ba,0x000606713c7e6c77,0x00020f862ff62f17,0x0008d02c379ab937,0x00003aeda319af35}, {0x000b1bcc16b87c07,0x000a95da9cc19a0c,0x00079447f6ecf227,0x000e9316f04c48c8,0x0000009f3d08f8bc}, {0x000b298c343585a6,0x0002b083c6aee0a0,0x000d14a006e52b6f,0x000bdeb969402ffe,0x00003d8484e857a1}},
+{{0x000c1beeb1fbefea,0x00090488da195fc1,0x0004e1aab035f336,0x0006fc6a8c2d5655,0x00005e8d80d36718}, {0x0000f238df88935b,0x00080ca644f2c40a,0x000b8903a1d2bbd9,0x0003110130773ca2,0x00005cff0f804e88}, {0x00046a0721127732,0x000c4babef99f60a,0x00011722b3039e16,0x000d508249093f33,0x00001f3b35617c33}},
+{{0x000b760d9db5f9c3,0x00070caba5121c35,0x0001f74c0964590c,0x0007488458d8a934,0x0000745062a5ec26}, {0x000352d8c543dd6f,0x000624e9a7af73b7,0x000bccfb9ce96c16,0x00016337916da27a,0x00006d16a65382f9}, {0x000e980c1ecffc41,0x000c7e0d49f06316,0x00087c8e61c7b4ab,0x0005db59fd5c247c,0x000077d76a5aacb5}},
+{{0x0009b2421d5e91ae,0x000944cc83149493,0x000e319708504bef,0x000debb80174d67d,0x0000534e18fc9e7f}, {0x0009905e19cba8cc,0x00041b5b17c4c971,0x0001341f2e9caba4,0x00056ceb1f6eef3e,0x000053e72034b616}, {0x000b4adb07955cd9,0x000d13ba0dd28289,0x000e1b3a9b8a9584,0x0003a21f0a0408cf,0x00004770182af1b8}},
+{{0x000870e965d9cc48,0x000162263ff495ad,0x00060614bd48daf8,0x0001130c25b30a90,0x00005ef2b6ed6861}, {0x0002c7080e54e5a1,0x0000395099a7a610,0x000c6d97841fc3cf,0x000cfd74d6296bb9,0x0000625c5b4ad108}, {0x000315bde84ef6ac,0x0005306e60980bd3,0x000fb039136b5221,0x00059bbfc0e5d29e,0x0000177d63e8cfa3}},
+{{0x000bc534f79dda59,0x0006dcd5ffd9ee7f,0x00026f65bd4e4511,0x000247592716821a,0x0000281047921cfa}, {0x00030d2e3c3604f6,0x00079c455f994ac7,0x000a060faac93fdc,0x0005c5da8fcb5127,0x000064fef228bb0c}, {0x000d032e379b368e,0x000dcd8d0024dc87,0x000b1f6014006a70,0x0008286014d8355a,0x00007d89d2405222}},
+{{0x000616c2bae6bea0,0x0002a3b221e6bc27,0x0007ea4f3bb9de19,0x00056cdf8e883608,0x0000261d6f4d87c7}, {0x000fcaabd000938a,0x000fe9cec5e98aa8,0x000abccf571240ef,0x00007f9c49495f15,0x00004d35815daaa1}, {0x000bc52d50e2a4eb,0x00004c067f66c2f9,0x0006c72c35a2d7e2,0x00022e7153a318db,0x00004d93e0f3ff4b}},
+{{0x0000f5a2a422a263,0x000dbf2aec9d2d28,0x000a6be26cd5b446,0x000b6150d3f923e8,0x000034e435f3f2b1}, {0x00042b351bd33a63,0x000243edd212a882,0x000d576ba21bea36,0x0004c5e70b1e16b0,0x00007d61bf74385f}, {0x0003bf28a2cf3741,0x0009ec0b2b168f20,0x00073b421ef51961,0x0000b12fcff74b8d,0x0000283e6c4674ee}},
+{{0x000d9dcf4b4eb3cb,0x000f74ceacb029ec,0x000d9149145ba10f,0x00091c4c762c287b,0x00006eef4999c7d2}, {0x00034e4ce850b732,0x000a8bf9c0007743,0x00048ae67d973ea0,0x000a8ff2e6a10df2,0x00004892edb22b42}, {0x00011a63b7bfbd82,0x0007e9e7015d83db,0x0008259cc7700006,0x000829e6ff7060d5,0x00003a864e4cc053}},
+{{0x000cf3c82abdf1d3,0x000ab825ca0e5e52,0x000138e6dfb4cc28,0x000ecf687edf4a63,0x000024420e74a931}, {0x000db897c200750a,0x00054d6f1d70e68c,0x0005bd50d399e1f2,0x000b5f6c11a66a44,0x00002616edf771ab}, {0x000129ccbbbdf7cf,0x000b9eae7735fe02,0x0002c64dcf3ccf32,0x0000ce50d004d8f1,0x0000681bf4262c9a}},
+{{0x0000fd3168f1ed67,0x000cdd86f3bc251f,0x0004d2f2de2c811d,0x000714944dc5c430,0x00005be8cc57092a}, {0x000d9a5fd67ff163,0x0009d4cc75681a95,0x000e20f257e92be6,0x0002df5b7f8024cd,0x0000204f2a20fb07}, {0x00043b3d30ebb079,0x0005abd652e30c81,0x000f6d5c31758915,0x000161f653c3c318,0x00002570fb17c279}},
+},
+{ /* slot=10 [{1,2,3,..,32} * 64^(2*10)] * G) */
+{{0x000e9624089c0a2e,0x000c03afe4738239,0x00064fa12ac748c4,0x000858217dbed2a7,0x0000639b93f0321c}, {0x000f788f3f78d289,0x0002ca1404d9fc08,0x000f65cc9dfe30a7,0x0002021f2778bfcc,0x00007ee498165acb}, {0x000508e39111a1c3,0x000d4809074897bd,0x000e72fd192b2b90,0x00002a6e7d2aec2a,0x00000edf493c85b6}},
+{{0x000c8158599b5a68,0x0000febade20eaec,0x0002b67f07ea574f,0x0004fb44fe41d742,0x0000403b92e3019d}, {0x0007c4d284764113,0x0003ff7f5f835676,0x000ae6bedea09040,0x000a3691c8fcffac,0x000004c00c54d1df}, {0x00022f818b465cf8,0x0005a1480eff84dc,0x0004c7d65771a0f3,0x00076f4aee8bfad0,0x0000355bb12ab261}},
+{{0x000e64cc7493bbf4,0x000d9eca3b0c3a71,0x000a05e785e5bd84,0x000c3120a6bc50cf,0x00000f9b8132182e}, {0x0001dac75a8c7318,0x0009db3ceaa11a30,0x000bae3f2ded9003,0x000ad8e6f077cbf3,0x00007518eaf8e052}, {0x000859c41b7f6c32,0x000bcf4383298a48,0x0009b1d1d90f2d60,0x00055c41815a929c,0x000047c3871bbb17}},
+{{0x0004539771ec4f48,0x0007dc98c5d6e514,0x0007c3c66bf805b1,0x00099dcf762c11a4,0x000000b89b857646}, {0x00065d50c85066b0,0x000b0b3a299b0fbe,0x00041ae8e062ecc4,0x0008d5fe53754ea4,0x000008fea02ce8d4}, {0x000ddd7668deead0,0x000204b685d23824,0x000d89d665c86445,0x000d537b514cfcd5,0x0000473829a74f75}},
+{{0x0002da754679c418,0x000d8b2618df082d,0x000c47eb0ae63bd7,0x000c6b4355eef24a,0x00002078684c4833}, {0x0009533aad3902c9,0x000ceef03588f23d,0x000fe12fb464c2dd,0x000d39015257390c,0x00006c668b4d44e4}, {0x0008cf217a78820c,0x000b281273e973b4,0x000c8eed7bf76a0a,0x000433fa96c65a78,0x00007411a6054f8a}},
+{{0x00059d32b99dc86d,0x00075603af1154d6,0x000cc2e488044cdc,0x00034ffb34c712cd,0x00007c136574fb81}, {0x000ae53d18b175b4,0x00059f392a102579,0x000eef35f5687131,0x000398f8455ecba1,0x00001ec9a872458c}, {0x0006a4d400a2509b,0x000020bc882b4b8e,0x00019575619b81d7,0x000646057e7cc9bf,0x00003add88a5c7cd}},
+{{0x00095770b635dcf2,0x0006cf66c1fbcab8,0x000eb6d18702dfef,0x0009e7485530268b,0x0000249929fccc87}, {0x000298d459393046,0x000985ff659ec85c,0x0002f66e3a8f7e35,0x000a7201d2ca22af,0x000061ba1131a406}, {0x0000a0f116959029,0x0006cba7ebd89a3d,0x0006783307023b6b,0x000ece77bf15a3e2,0x00005620310cbbd8}},
+{{0x000993434934d643,0x00006a51222f5528,0x0003f41c22b9dbf8,0x00097308f6d878fc,0x000037676a2a4d9d}, {0x0006b5f477e285d6,0x000676c8f6193664,0x000bb594dd40e8ff,0x000ec4da6ec7311a,0x00007ec846f3658c}, {0x000e8f3f1da22ec7,0x000776c01cd139b5,0x0002989fb8130f1d,0x0009dd5214c8fcfa,0x00006daaf723399b}},
+{{0x000720592032e20b,0x000025f89ef2ffb6,0x000fe3a169a3b198,0x0002031728f23394,0x0000213a9c7a5c88}, {0x00015ad72357c57a,0x000c37428e48ac48,0x0003c110e0a72841,0x000f918a4fe3a26a,0x000038fc45179973}, {0x0006bc83af3ca4fd,0x000e027a99ff67f0,0x0007a06712792758,0x00078f9da1f5ef63,0x000008b4cc40feda}},
+{{0x0009d034a88637e1,0x00057d4899b52445,0x000d06ade8b5d905,0x000137b495b128b7,0x000042517e7c6339}, {0x000237918db9016c,0x0000a278e253ea47,0x0002dc75eec49eeb,0x00039746fbf68f28,0x000067f65ee35bc6}, {0x00004dc87e976952,0x000e090616e9b0a9,0x000a3d9882508b13,0x000cca887f92500d,0x000071a1132c13b8}},
+{{0x0007471d1c8ec3a6,0x000c34fbd6fadd1f,0x000e5212b463de58,0x00045afabf2c1437,0x00000b894e91e5bf}, {0x0002516141a0dc3d,0x00039492a5dccd06,0x000dc575a5ba9d94,0x0005f70299f7c9d1,0x00002243fff87a86}, {0x000f8f139a1d052f,0x0003eb0cb461052e,0x0001a48a4a3f4916,0x0005c7239a31b6d9,0x00006b0b4761d23a}},
+{{0x000e2cceb7160ffd,0x00086c62a82bd083,0x0006a1a911b33336,0x0007eeab15533da0,0x000042e5c04acb13}, {0x0002b594b65c224f,0x0004e42564e3663a,0x0004f210d6ecd076,0x00043be391a1a8c3,0x00002e1a955b7d95}, {0x000d574e4831c376,0x000f91c09d1c144f,0x000670c106f749d9,0x000ad8a06af2c5b2,0x00000f7bc2188e50}},
+{{0x000ca6ef739a2535,0x000cf8abc48eebde,0x000a2ddb173126e2,0x0003dd117b3f7b5e,0x00002ad5b215d705}, {0x000e812f83865ef8,0x000accd2ebfa1056,0x000175c3b9986097,0x00077da48c4414d0,0x000007abaa4608d4}, {0x00038997e95d110d,0x00028aaafc938663,0x000f0aa2d2e61ea2,0x000eaface8ac50df,0x000066382115d607}},
+{{0x00027eb17d43f08b,0x00005350b6460797,0x0008fd238d98cf24,0x0006ff013cff37c8,0x000034123c156504}, {0x000488ee9ed3db11,0x00047d3b64bc079d,0x000500f82c182fc3,0x000c91acf266f8c8,0x00007ae19a742662}, {0x000ba44a002ab527,0x000413e0bc32ba95,0x000ff68575be7b4a,0x00031a8129eac01b,0x00005050dc93402f}},
+{{0x000ca61ca213efcd,0x0000131244fe75ef,0x0000b146bbabd62c,0x0008239c79c8b16b,0x000010efb4f1ca6b}, {0x0008b27c844a8843,0x0009106aff2029c1,0x000abc6c69a6872f,0x0006884b14f08669,0x00004d4b8217df44}, {0x0001f9a743aa8b23,0x0007d65bb9ad5d50,0x00003c9cf3e1daf3,0x00062e7bfc087a34,0x00007c2c3de9b420}},
+{{0x000e4a5610628564,0x0007ca8b4df34591,0x0007a38e432a4bb8,0x000046ede2a2572e,0x00003cbdabd9fee5}, {0x000ebbdd2cd13070,0x00025f85a0e9e81a,0x000adffecb962e43,0x00030e6de9391aac,0x000053177fda52c2}, {0x000c970650b9de79,0x000fbc301b59ba7b,0x00036ae38c3d12a7,0x00099dc02652e68d,0x000079d739835a61}},
+{{0x000d3cf4d9397edb,0x0005b5e58bdbca2e,0x0004567274537d0c,0x000493e3642ac140,0x00002dd203663739}, {0x000c365c210464f0,0x0001320433e7a524,0x000865663dc0fa31,0x000edbdcefe371a2,0x00007a36d0bbaf2a}, {0x000c8dca43fba9c0,0x0007ffea4701c773,0x0000c3b217534b8c,0x000590bc0ab492cf,0x000064b4e3167b7d}},
+{{0x000c1dd1891ee571,0x000e55dfae31ae01,0x00090e69d5d0af18,0x000f4d9cc84fcf8c,0x0000203fa7b2d0a9}, {0x00068b31154c3f97,0x0001125a32062179,0x000d005d12e7c767,0x0009bacdb82c1869,0x000075e4f7445be8}, {0x00086b7aea0dd467,0x000cfc5eaca64ba9,0x0003c5e9f3869435,0x0007cc041cd4c11e,0x00000a6238d957b0}},
+{{0x0004c28e9d036af6,0x0000d265073caf5a,0x00046c454fc94f11,0x000164057e1a18ec,0x000073b9713881bd}, {0x000de1a9d7b1013d,0x00043bb580c912ed,0x0006e2428ac9acf7,0x000340be32b9cc18,0x00002c6296b6335f}, {0x00003a0ffcd042eb,0x00048dafd18a4c13,0x00096c15c596b642,0x000c3f55a9ae3087,0x00003fbfbb6b3e5f}},
+{{0x0006e999a4dcda63,0x000bd70a7744de41,0x0003ce979228a700,0x000b5f7f6dc4190c,0x0000502994f2735b}, {0x00030383358773ad,0x00026b9909e300f8,0x000e10770f27510b,0x000d75c8f4e4cdb0,0x0000554e149bfea2}, {0x000380c180af96a5,0x000e8a3f1805d352,0x00048005f34e28a1,0x0002484913289311,0x00002f35b9f32917}},
+{{0x000d140dde36d1a6,0x0009a54b0807a1d4,0x00053b12487424e0,0x00061430e7f45f91,0x00000e1362c390f9}, {0x000c58e88ccc8869,0x00038540be9f8e7a,0x000f3485b3438b65,0x000272e0306d6792,0x000002e4ccf9ea0f}, {0x000cb2248b4ebeee,0x000110d5c5922677,0x0005c6a5ff7eb707,0x00037586637409fb,0x0000737259ae9dfc}},
+{{0x000ece7c60f0124e,0x00018914f3586286,0x000a4f13060f6221,0x000a8b42def6ac2f,0x000037de72daed62}, {0x000f0d7cc3e1c2b5,0x000d8607248ded25,0x000cdd51cbb329c2,0x000126075eb5e5c1,0x000070c710ea2167}, {0x000411ed1854d5f2,0x0001642852bd5184,0x000c8250c30a36e2,0x000809b43af112cc,0x000041919f4f2e14}},
+{{0x000abda1be5af3d6,0x0007757187043b4f,0x000fbeeb0d9fd3ed,0x00023d919b6bf9c8,0x0000389b8668b698}, {0x0001b151fb755816,0x000b956d841407a2,0x00086ec5e125412c,0x0001dda007581ae8,0x000011d399398517}, {0x00022c5102c07013,0x0002a189756cc2bf,0x0009658da2d3701b,0x0001bda1bcc90a0f,0x000005995fe69ccd}},
+{{0x0008d5579e9a7a1f,0x000173f99f472d8d,0x000fb4412aad6fe0,0x000185267fbb6aef,0x000061a7dabae142}, {0x000b10b3d20f7be5,0x000f5faf2745fcc2,0x000f1894c701af0c,0x000826b8725991ef,0x00002f941df05593}, {0x0005ca26e1729394,0x000acfb89929e3fd,0x000e3c58d0c117b7,0x000e4044c1636390,0x00006ea4eb27d468}},
+{{0x000343f1670d2993,0x000ad3b3dc824108,0x00082a34ab26e736,0x0008c650a676ba37,0x0000537248b6d659}, {0x000c4b83f37a3e2c,0x0008aebc4de8945d,0x000a1c86e17511b9,0x0007a02b538d977f,0x0000735e17f387d2}, {0x000aecb81e8916d1,0x000f99f9bf947f5a,0x000fd7076cb56f4c,0x00097e9fbe69e995,0x0000055286bc8182}},
+{{0x0001d11ef8cca31e,0x000beef2776f737e,0x000b9fd7e4a91b95,0x00014c5904cb887c,0x00003687b376a06a}, {0x000bf4b3d7935d5e,0x000904f597e632c7,0x0002f8ace983afdf,0x000af029e9328fb3,0x000069f1c6d54e22}, {0x0001f4fdae147f89,0x00068cb21bca2c8f,0x000e6ef67086f710,0x000638b04f85af1b,0x00006c1483267b97}},
+{{0x0003c497bb345349,0x000ef498d342fc7c,0x000bbb2d6e649569,0x000f3dce38a7e03f,0x0000515008612edf}, {0x00058eb8604caa98,0x0002d7b714317c5d,0x000f8c66f95f9199,0x000444020f42b251,0x000038b1ce357337}, {0x000db52241f52773,0x0003fab7e8e298da,0x0001765a41639dbf,0x0004ef56543c35f2,0x00000b671d5ae452}},
+{{0x00009fc728d088fa,0x0008481e2dc6e434,0x000555f8bf9f3f78,0x0003ffe30d3fb986,0x00000f72605eb0e4}, {0x000584b71a9b8cd4,0x0004173a508f0485,0x000129fdd99cf24d,0x0005d3727b882aa8,0x0000586392d590f6}, {0x0004452bb8b7ccd6,0x0006def1e24e7671,0x000d60b858bc711d,0x000971db10671f93,0x00006d5f9a57b5e3}},
+{{0x00045c835617f1b9,0x0001ec95d114c365,0x000c491b03d120fa,0x00008f5de8e99278,0x0000328cdea31be1}, {0x000e3091f864ef0f,0x0008d59f2de3face,0x000bcad53944bcd0,0x0003a2fd83445b0a,0x0000271852c19f8c}, {0x0007e2e76d9f3a9e,0x000cea45c8dd0cf9,0x000566d9df6c51bb,0x00078bd59ddb6703,0x000018772c589b75}},
+{{0x0008c58f88529827,0x000fc4708ace7b4f,0x00019849bbcc9071,0x0007bc533f8204b7,0x000048a742879b7a}, {0x000cfb744b23598e,0x000cf771d54e2d17,0x000fb87985c38ced,0x000ed1303d47a6fe,0x0000319ce9704d0d}, {0x0006230173b40fc4,0x0003feb6bb2a5587,0x0006a22ec05a85ce,0x000d4db8e9a4724c,0x0000773622f712c1}},
+{{0x000668494f4e1d7d,0x00094a0c11d622df,0x000b8a37fb75b37f,0x00092cdc2714a68b,0x00001d344fed1ee6}, {0x0006f23ee3c9876d,0x0001b0a70d8be62a,0x0007b1584d31d1a9,0x000c67394b6327c3,0x0000427acd4e66f4}, {0x000dd5713bef32b7,0x00031b584c638742,0x000ffc8fb8c8085f,0x000ec0756b47c04d,0x000029472aee5a65}},
+{{0x00054df64131c1bd,0x000a186ec5822d93,0x000459f3c2758094,0x00032824464ee12e,0x00006c11fce4cb13}, {0x0009d9920d591737,0x000d2e9b46cd621c,0x000d89bfca9bea41,0x0005ff8e20e84200,0x000079d99f946eae}, {0x000b483568673205,0x000e83caad96cf17,0x0006ffe386387dea,0x000a59961b471fd5,0x000031741195b745}},
+},
+{ /* slot=11 [{1,2,3,..,32} * 64^(2*11)] * G) */
+{{0x000a426e3b646025,0x00090385ce4cf9b2,0x000d6dea45321271,0x000de75a25cffc2d,0x000006409010bea8}, {0x000cded679d34aa0,0x000c0cc4db39fd67,0x00035d190fcc0b9e,0x0006fefa535a456e,0x00002e05d9eaf61f}, {0x0007901ad61beb59,0x000bce5dc880ac44,0x0007ca6827661f19,0x0007f2624685482b,0x0000293c778cefe0}},
+{{0x00009e7007069096,0x00015e4e50189868,0x00021a0147aad75b,0x0005d5e07f35715a,0x00000487f3f11281}, {0x000795d6a11ff200,0x000e2b15815c916c,0x000b5395b5cb70d0,0x0007b4f89f293209,0x000050b8c2d031e4}, {0x00050c08068a4962,0x0005351092c9a483,0x000f6fc8dd6ffdd0,0x000a58b17af4f4aa,0x00004b0553b53cdb}},
+{{0x0005fcbe1b32ff79,0x0009f03b50f9b9c6,0x000c07e606eb75ea,0x0007908fced2a6c6,0x000035106cd55171}, {0x0005211b27c152d4,0x00049bd1af639bf0,0x000e6fab985ec268,0x00008405e0b2caa8,0x0000054c8bdd50bd}, {0x0000b12f1dcf073d,0x000a3b7f6a27638a,0x0003404f9a4b60a8,0x000c229fed5ac25d,0x000072e82d5e5505}},
+{{0x000b697ff0d844c8,0x0005cd979cb496b0,0x0001da0f1fbb12f8,0x0007211d2a541c6c,0x00007b7c242958ce}, {0x0009cdfd69771d02,0x000cd6cfbf17e00d,0x000cb12ec7410276,0x00008614c45306c1,0x00002857bf162750}, {0x0001903f0101689e,0x000d3bf8610059f2,0x000deb0f1bd779df,0x00000d4a122ee5f3,0x0000510df84b485a}},
+{{0x000133bb9277a1fa,0x0006263991237a54,0x0005d2f15a74ec3b,0x000ba3a1a3c54dc3,0x00002d347144e482}, {0x0003c887c70ac15e,0x00057fb81b73224b,0x000578cc1bb0f3a5,0x0004f8e9b2cde2fe,0x00004cf7ed0703b5}, {0x00047c6598fbee0f,0x000e2ab55be2d6bd,0x00027610c59e4733,0x000eaa41093f6241,0x00004e05e26ad0a1}},
+{{0x000b6b624b531f20,0x0000e77509abbda9,0x000823cb80429a76,0x0008f82dbe9f522e,0x0000618f1856880c}, {0x0003c773e18fe6c0,0x0001ad3c87265183,0x000116b283e3c471,0x0004db83bfd3c4f0,0x00001955875eb4cd}, {0x0006de8f0e399799,0x000a440fda1786da,0x000e3563dd7ad61a,0x00040aeb32cd8105,0x000015f6beae2ae3}},
+{{0x000bcb0c31ec3a62,0x000451138f3c2862,0x0009dac2a4810e2b,0x0009281788ec4b83,0x000028f76867ae2a}, {0x000a0f7b9245e215,0x0002dd98c0dbbba9,0x000220b020f36861,0x0000eda2e84e4cbf,0x00006ba92fe962d9}, {0x000df9655884e2aa,0x000dbdbd465a53e4,0x000de9e524bd62fb,0x000b3d7d7596caa0,0x00006e8042ccb2b1}},
+{{0x000d3c29ce28ca6e,0x00040fcb6093df10,0x0002ea2d3fbad345,0x00098b9e7426ed7a,0x000008af9d4e4ff2}, {0x0000653616521f7e,0x000b896203dba153,0x00045f0879660d06,0x000d7b02d3989bc5,0x00004b5303af78eb}, {0x0008a6c3bebcbde8,0x0004adc3a8e8972f,0x0007bfdf7a4f0fca,0x0004eb76fa9d4e8c,0x00000dcf2d679b62}},
+{{0x00026f215e942f70,0x0000bbc7b4e50bda,0x000e69a7eb10f9b3,0x000f33efe757d94b,0x00007c2e84982e7f}, {0x000c67097e8ff1cd,0x00008c4f692bee24,0x0002b4ba72e16872,0x0005ae3766ffa5c9,0x0000235125c85884}, {0x000990599c667123,0x000fb8ec2e26af24,0x000f6632c92220d4,0x000d54a68c4bf64d,0x000041c5b949774d}},
+{{0x00094d337f422347,0x000ee8f436fe19eb,0x000c0f390f7873c3,0x0003ff28cd04ab0f,0x00005ac951ae9fe2}, {0x0005bfcf3fe8ed0e,0x000566ee33983b77,0x00061689df492284,0x00067c1ad7035e1c,0x00004d11b556b1ef}, {0x000b4bd2961543f6,0x000251408f4a34a0,0x00068b5dc352a516,0x000cb959f2c740cf,0x000009e597bf33a1}},
+{{0x000dcd80bfc6cd84,0x00053e26cae38b7a,0x00045775bba3ae44,0x00062cbefb3aa25d,0x000004b6a42d801e}, {0x00020f300512bd72,0x0006f69cb0c2786b,0x0002cef3480e9c5d,0x000274ce00824bb6,0x0000732f8dbe7398}, {0x00062a9ac4e22b86,0x00023fde802cfe48,0x000553a97ed1c589,0x000f21c2b40831c0,0x0000544e552c59ae}},
+{{0x000888de47bd4469,0x000afbaa88a7969f,0x00016284f4199f28,0x000207c3ed3da437,0x00007ec568ee0ad3}, {0x0000c3525d050e0c,0x00081c7829c74ea1,0x00083e095d5de581,0x00065b9173f94346,0x0000483537326fe0}, {0x0002ab07003726a8,0x000cb6be1a0459b7,0x00000d344f42a7e6,0x000309fa5f6e0302,0x00000dbfd3388b37}},
+{{0x000e829d95511398,0x0001c30cca1b3d5b,0x0002bd9637dfd752,0x0005bebd71c7e7ad,0x00006698d44c0ddc}, {0x000fb64807e30876,0x0001e1fc7ab66a67,0x00019e339eee38f0,0x00056e95f19529fc,0x000034a2ff415f70}, {0x00027a9e25a5d910,0x00066ebea277eada,0x000d3bba61d95502,0x000f675ab52ed7f1,0x0000412b0cc4d382}},
+{{0x000f0e7a76023c8c,0x0002df3ccc0ad5d7,0x000b332aed513b96,0x000ffeaceb84272a,0x00001366bc491d63}, {0x0006e69f1145025f,0x00062f75eb57a1de,0x00069ec9b9b1a16d,0x000ea986f8fc0cbd,0x00007a4fd3cb02af}, {0x0005841b84bc28ac,0x000caf1ad18732e9,0x000fb81f6110219b,0x000cb46168cabfff,0x00000f9df99e9856}},
+{{0x000d2cfba8fc7e5a,0x0001ff71089345c2,0x0009ae4131fdfe4b,0x000256010ec81847,0x00001ec5d621fe3f}, {0x00047a62ba97abc3,0x00081f1ad8e84dc9,0x000cea02a4da65c8,0x000aa557be10632c,0x0000372d98dc22e6}, {0x000c91c7f544fbbf,0x00008259379b0f5c,0x000cda66dfeaf309,0x0009560160bcf124,0x000029a50619db13}},
+{{0x000947499718289c,0x000c524533f263d5,0x0004c3ef1512ebf8,0x000518e0262bfcb1,0x000020b878d577b7}, {0x000941be5a45f06e,0x000ed6d9c5f65753,0x0002ff51b6d07cae,0x0004da911776b9c7,0x000017d2d1d9ef0d}, {0x0002af18073f3e6a,0x00019d752106927f,0x000ca60022fd3fe5,0x000c6a722e3b72c3,0x000072214f63cc65}},
+{{0x000a222282fc105e,0x0006be0533d08174,0x0001ef19b9a19f7e,0x000dcb0a8fb61855,0x000026c69003ace4}, {0x000285d17549bb9c,0x000f67e30706eab5,0x0009b0e409b46332,0x0002965ce51a1d7d,0x000040eac9259061}, {0x000a1b5253b93f81,0x000f47b59826e47b,0x0005dad452edf12e,0x0004724b57dcf4ce,0x0000310d60ca5ffc}},
+{{0x000ecac9ac33f7b9,0x0008868225c9ebe6,0x000cc456e40e0b60,0x0001ea6189d2e79d,0x00005d562d4e260a}, {0x0002f8719295dba6,0x000bc15a144a7ba3,0x000b8f9a97fae6af,0x0002e2a6c9e57392,0x000059016b95a113}, {0x000d221f1f792f57,0x000ac87c93db86c0,0x000f461bfd6bf2b6,0x000737565dba6a56,0x000011a9e2611aac}},
+{{0x000b22cb2f8c6d44,0x000a74ea3ee68269,0x0004504eff56fb89,0x0000763d22627de5,0x00006bc6ac8768a2}, {0x000736e068dc1121,0x000988479d0d0419,0x000499f319ebbc75,0x00084123dfb9cff9,0x0000330183830e0a}, {0x000e9e406fec2aa1,0x0002a50aa185d5f0,0x0004473c764090f6,0x0006a69851ce61fd,0x000016768ba40e44}},
+{{0x000f8e5d9e98df6e,0x00097f9f4dcfbcf5,0x000e9e4e9f393ea6,0x000242eadc1b8b8c,0x00005bad6df322ae}, {0x0009c54e4c17ffda,0x00017d464f340a5c,0x00056bdbda7d8605,0x0008770bd3a8a941,0x0000231024297345}, {0x00035ccec0695318,0x0003a46b05278969,0x000e307aef03c954,0x000101ab81adcb8b,0x0000341d8a410120}},
+{{0x000389a8498059b3,0x000c915870703310,0x00065c7f69a80e5d,0x000c631fde1887f7,0x000017e3504a7655}, {0x000e0a483ea67c7d,0x00045bc26d1c865f,0x0002795c3f36de0c,0x00015f61a1fc51d0,0x00007a33e0147d6b}, {0x0001b9603c715995,0x000c92d4f12d2782,0x000688cec6701b33,0x000bb47a3989f6dd,0x0000672f0022a375}},
+{{0x0004bf51eefca309,0x00078afd7853b5ba,0x00093ca20aa3d990,0x0004cc846a539c07,0x00000689005382cb}, {0x0003ca366eab5694,0x0003d576840fa4c0,0x000ae48d6e6bdebf,0x0000c3de6ab08de4,0x00005587ec203236}, {0x000bdfc7b3b1019f,0x0003f5378a78472b,0x000ab5e1541bbaeb,0x0000cd362de6a9b3,0x00006a4ebf305af5}},
+{{0x000bbfd35163d9e6,0x000ff064e67d445a,0x000b02f64481b869,0x0002c9325850d291,0x00001f954d88e7cf}, {0x00060132c44c5cea,0x000a06558f6b2ac8,0x00052bb3ab2010ec,0x0006d19b5d973405,0x00000204fa0585a3}, {0x000d416e79c02eb5,0x000f3044d8b17c1f,0x000451b5c0c9fafc,0x000ecaaff907e065,0x000075fddb501abf}},
+{{0x000503bff6d869f5,0x0008b5a2b03d1ad5,0x00067ae1c78e9683,0x000a14943fd24e50,0x00000ed17afac3d9}, {0x0007436356ac8f13,0x000605172efe7ce4,0x000449a62c3daddd,0x0005dcfbb3dc7091,0x00002a6dddeb0522}, {0x000c0745f452ec80,0x000b50878f6bb709,0x000879b728470be1,0x000209a73b60196c,0x000042a0b6d811e5}},
+{{0x000098ae4163f45a,0x000b000dbfc34325,0x000bb3b34e9ac1b8,0x0007dee8c29ad91f,0x00000f471d8b643b}, {0x0003d3efedf137ce,0x0003c148fc262999,0x0000f910254c03a9,0x000a8696152fd66c,0x00007503c69ba97f}, {0x00024ea41c3a9029,0x000ee7bef88bfba1,0x000199772d262b72,0x00057bf251c03e79,0x00003a92f6e4faff}},
+{{0x000cd9ed766c2157,0x0009547cf06af38a,0x0006046cf1173ffa,0x00077afc8fb696a6,0x0000797b3806070f}, {0x000df83578d609bd,0x00071881bd95fd4a,0x00024a8fa45b60fc,0x0008a088813fb9b5,0x000024befbb9c392}, {0x0004367e8fc36c56,0x00064aca51ab1240,0x0005fab79d2dae3f,0x000bbebb2f4850e4,0x0000179c4163310b}},
+{{0x000321bb8ec0766f,0x0004adcdd9d06df8,0x000398653ba816ca,0x0008b9c337a7e6e2,0x00003bed3273395c}, {0x0006033b9a6a5cbc,0x000299065eb2489b,0x000f6b93cdeb6dfc,0x000f3a88c2bcbf24,0x000006308f101ff0}, {0x000cfd2dc4fced43,0x000bcf3798d83a96,0x0000120c11bdda36,0x0002c528f86e7668,0x000006a30d31f552}},
+{{0x000b6941710ea67f,0x0007485f25df00fd,0x0001627e6143ecd8,0x000f20e4cd786f14,0x00001123ae5dc4e7}, {0x000457620b9a842f,0x00016e3b8a557075,0x000cd4393d456c84,0x000822bcc9e55434,0x000041936d4ab977}, {0x00023ef73b6a2ad1,0x000d326079f064b9,0x0007fd5986ba352d,0x0007b29dd41467cb,0x00001e649f3f5d74}},
+{{0x0006b280e1027fc8,0x0005d9dccceb11e0,0x000dcab30154dd90,0x000e9227cbe36c47,0x0000236f5f0de06a}, {0x000808f6343becab,0x000ded7beae385ec,0x0008129dbf332d96,0x000958153683eff2,0x00006d308618e1b5}, {0x000f1c1bcace3934,0x000e59a4ba220cf8,0x00053a489380ded4,0x00004fec891065d1,0x00002944d729154d}},
+{{0x00095329f789213a,0x0003d74f7cbe5eca,0x00066e65385d6786,0x0004033f520cd865,0x000006e65023186f}, {0x000c33205f270d49,0x000336c52cdb1cce,0x00063ca42a538ea7,0x000a23e3941eb04e,0x00002edb380e248b}, {0x000b33e873b935d7,0x0008eaa6394abfe3,0x0008f6e3afc53ced,0x00092cef039c2681,0x000058c6525d0365}},
+{{0x0003fc2a5279b24f,0x0009dcb49716ea09,0x0003516b1fcc8a0a,0x000ea6cfb208c3c6,0x00000e7a48f046a2}, {0x000f53e52f069da9,0x0005fc6621c89ae0,0x0009759d17a8191d,0x000776e1081ede00,0x0000001d0d31b526}, {0x000a8c61616da4c7,0x0003d3ab06f7bd6f,0x000953969c81c35a,0x00076f64234d8022,0x000020a07f98572b}},
+{{0x00037f405307a693,0x000d72f336795b4e,0x0003761099aba714,0x000cbc9d6fbd0a77,0x00005fdf48c58171}, {0x000db7b9f43b29c9,0x0004a4f518f751d9,0x00012f9dc4d60582,0x00045b0f2c072bd3,0x00001f24ac855a15}, {0x000608328e9505aa,0x000d10c1420ee24d,0x0006fb25a24748c1,0x00095e6c7ffe45c0,0x000000ba739e2ae3}},
+},
+{ /* slot=12 [{1,2,3,..,32} * 64^(2*12)] * G) */
+{{0x000a0cc9782a0dde,0x000b2ea718385559,0x0001ef238c551dcd,0x000613d7f62865b3,0x0000504aa7767973}, {0x0008fcfa36048d13,0x000b373899ddd9c1,0x000f92d0aa29159d,0x00019d4dc9f350b9,0x000026f57eee878a}, {0x000b2cd55687efb1,0x00062247af17b0ca,0x000f5a24675180d1,0x000306985c15a344,0x00004041943d9dba}},
+{{0x0000eeba43ebcc96,0x0009c26ea9cafc3c,0x000c77ccc68d749c,0x000340fd9fa95ee1,0x00001420a1d97684}, {0x00017743a26caadd,0x00024648ab7ce4b2,0x0003fbc9e347a6b4,0x000d019cb1d4f7a0,0x000012d931429800}, {0x00067799d337594f,0x00040b23aa47b00c,0x00035ff3955e3c51,0x000a01244182854e,0x00001b4f92314359}},
+{{0x000c109d89150951,0x000912de9696a3e5,0x00075f302039cefa,0x0002dae20eae43f9,0x0000239b572a7f13}, {0x000f3030a49866b1,0x000d2215f485933c,0x0001def4f6251f73,0x00023f6ab82aa405,0x00005ff191d56f9a}, {0x000ed433ac2d9068,0x000795fc98523819,0x000593eb3d2883ab,0x00036cbef4572805,0x0000020c526a758f}},
+{{0x000834f89ed8dbbc,0x000f9dc7ca46c779,0x0003e1b074c8f2aa,0x0003877a9524cdca,0x000002aacc461531}, {0x0001ef59f042cc89,0x0009d8e124bb6e93,0x000ec759972c589c,0x000c50cadc8e18aa,0x0000452cfe0a5602}, {0x0000f7a0647877df,0x000270e607c9f86a,0x0001fb11c9bbc464,0x000877bab17ea25f,0x00004cfb7d7b304b}},
+{{0x00043d6cb89b75fe,0x000d99c6adc8072b,0x000ee34c9f54c694,0x0005364b8c3aa373,0x000014b4622b3907}, {0x000699c29789ef12,0x00071df57190de28,0x000cc970d02b6ecd,0x0003ac5c343c857e,0x00005b1d4cbc434d}, {0x000b2615cc0a9f26,0x0002bb88dcce5b6f,0x000369a7053a4f0e,0x0002dd11301498b3,0x00002f98f7125859}},
+{{0x0004a74cb50f9e56,0x000a98e8e13200c9,0x0002300f675b1ff4,0x000aaf99a2acc218,0x00003a6ae249d806}, {0x0002ae444f54a701,0x000f0a9cbd7de2e1,0x0005835de0fcfe3e,0x0004554cebf890d7,0x00001d8062e9e761}, {0x000ada85a9907c5a,0x000b591b90f62657,0x000f34b4e91a0ea8,0x0005ff38d0e1dfbd,0x0000298b8ce8aef2}},
+{{0x00027953eff70cb2,0x0002a791570762a9,0x0000a7cf6a4b89c9,0x000e4859418457a3,0x000034b8a8404d5c}, {0x000a72ea0a2165de,0x000b40bcf79f6837,0x000738ae703fab07,0x000d7dc521636c77,0x00006ba6271803a7}, {0x000eecb583693335,0x000df63b5fefdc26,0x0004b22573d5a813,0x0001c6aa293aa9aa,0x000071d62bdd465e}},
+{{0x0003cc28d378df80,0x000790a0fa4b4653,0x000701da5af6db43,0x0002ba4e3645ff9f,0x000074d5f317f317}, {0x000db5dab1f75ef5,0x000cf16b065f5cd2,0x000f49f085d77f95,0x0002b3d14571fea3,0x00001c333621262b}, {0x000fe55467d9ca81,0x000752b298c37a86,0x0003ac623b398b7c,0x000d98cda6d0892e,0x00004aebcc4547e9}},
+{{0x000e582fd579b33c,0x00094e75e600171d,0x000ebd009bd9ed4a,0x0000ba80776add7a,0x0000495da247024b}, {0x0001ad36ed9a0b41,0x000100076cad8c49,0x000d37236cfea6d6,0x000fc481aa61c985,0x00003499c85415c2}, {0x000e76baf6047579,0x00090e770bd29d83,0x000378051d3d2f80,0x00041b95c72be68d,0x000036ca2598aee5}},
+{{0x000a6ecb4a34518f,0x000abedd4139d8ef,0x000b4bff00433000,0x000ee10ebca79219,0x000013dd2127f378}, {0x00090def76712acc,0x0004ba99625f8712,0x000fdacb20710b28,0x000c091d97d2c3b7,0x00001d852dd67efd}, {0x000ac5fb9c23cf32,0x0009220581c54073,0x0006ccddf39cc908,0x00039a0606558481,0x000072c35c64555f}},
+{{0x0009f07bb578a59b,0x000216f837a576f6,0x00067600ea80dc08,0x000476b12548e664,0x0000445065cfe0ca}, {0x0007801fe0d6943f,0x000f4a0605e55a88,0x000fc50f507270df,0x0001ee390218c8c1,0x000045401afaac8f}, {0x000e6ecdd8a5156f,0x000db10cd1833df5,0x00009ae5759e957a,0x00078e6346e6476a,0x00006f68c1e9415b}},
+{{0x00097a4ad0d98bf3,0x000c9a5c9e982362,0x00002e01351ea8d4,0x0008564c7051f262,0x0000795f07444360}, {0x00054ff3796e5750,0x0006b38fcfff6d91,0x00096b6fd5fe1ab2,0x000ebc157f56c86d,0x000018e0c7c8d514}, {0x0002a4c6eccfb757,0x000ebe4d47b64625,0x0002a2c2c8de003d,0x0005f1175314012d,0x00000417c6caac16}},
+{{0x000836c6b31d6645,0x000d35e7facfb2c4,0x000c9200bbeddb9a,0x000039cac72d250a,0x00002e0e0496aeca}, {0x0008de2b8532d8c7,0x000f8da02142ccce,0x000b1e90541891ed,0x0002e33d54fb5455,0x000077c5a3eeeb2b}, {0x0003c5777c502507,0x0006017996525af1,0x000468651389179e,0x000c85ebe6f16a45,0x00004598e8cb60fa}},
+{{0x000b337e5c463d31,0x0003404590db92da,0x000ae3eed91c71b9,0x00080b739da607a4,0x00007e2bff5f8f99}, {0x000877fa3bfd0e91,0x00010dfbed4bee8c,0x000ad2e223eb3285,0x0008f7f3cf1dc537,0x00006686301aa111}, {0x00065e0f7509a6e3,0x000bab2c9f2bedb6,0x000c0bccb7a0257c,0x000f5ace3eb3df70,0x00003867319753bb}},
+{{0x000996518ca41d95,0x000569a895c667e6,0x00009309d9a5c52f,0x000c049c3f0f9e2d,0x0000307dcec4fc9f}, {0x000ed89d5e7d08a5,0x000f1a823e58df41,0x0009693add824cd3,0x00047a822e0a3071,0x0000428ff2e63460}, {0x000b8f02acbf0857,0x000b184bbb4dec42,0x000b39a834aacc74,0x00095745af2ee7da,0x00007469dce8a0c2}},
+{{0x00075a7205d21a77,0x00022d3b934d4531,0x000d5deadcb0c044,0x000ff8cadd9f24bd,0x0000074f46e69f10}, {0x0009b204a059a445,0x000aa4b17ad0f0de,0x000f79c557e15cb4,0x000081be1bbec521,0x00002633f1b9d071}, {0x000b4177018b9910,0x000dc6c0fe140c1f,0x000354c6ffa6ea20,0x000407ad661f3e74,0x00005ecb72e6f1a3}},
+{{0x000e6b8359d04f3d,0x000b3b9a6274b207,0x00051973dce84316,0x00030f4ba37cf636,0x00006dc20c1dfef2}, {0x0006155db98284ce,0x000302ba62be058c,0x0003d9ea8c9cfa29,0x000c322d1f6a301b,0x00004bd5f8ac6cce}, {0x000e6128caa08f0d,0x00040411b476ddfd,0x0004baab58db60d7,0x0003158166afe532,0x0000363dc10f8759}},
+{{0x000fbb4b144245b3,0x000494bae4067d46,0x000ad62107f3ad41,0x00062a61b1ea714d,0x0000194ebffdf383}, {0x000cfc65316b466f,0x000c337b93e38613,0x00092dc526e91f96,0x00014f36591a2005,0x000050ad4f0433b9}, {0x0006990416766775,0x00071037a66a65c1,0x000a4152e7771a9f,0x0001b46074a3a943,0x000054ef39d7ca2e}},
+{{0x000a917e78ac78d9,0x000f32c8757cd1f6,0x00003bb4b32900f5,0x000434a0636e28db,0x00000386b90cdbba}, {0x000a45afd3a00421,0x0008c1d598216027,0x000eb48a182043e1,0x0003057af8f734a2,0x000048960aa65fc6}, {0x00031788d28232ab,0x000c787b055bf4ae,0x00009a42cd20adaa,0x00007043abd12c62,0x00001ae0f89191ff}},
+{{0x00041571e8ebd187,0x000d48b244d7f9ba,0x000db4393b8842ca,0x00053a3e1227f697,0x0000401e5e5dc2e2}, {0x000208ba951bdc7a,0x00070d6ba32cd389,0x0008c5c7d42e610c,0x0009810465d0b4d3,0x00005f29d0d8d315}, {0x0008cda5893aecd7,0x0006904c6d152b23,0x000e3d94331c7a62,0x00089baa5a494187,0x000051c94534da87}},
+{{0x0002f294788582d3,0x00028242716b04d0,0x000efad83a9ad44f,0x000032b0f065cf9d,0x000031c2dc935365}, {0x000bfcf005cdd2b5,0x0000085681e21aac,0x000e7fbbf024ab2f,0x000f1ec441982804,0x00000512a462c3a7}, {0x000a1aa73e5a1711,0x000f92f264ad66b4,0x0005ca9838e66249,0x000dfbc9ca5ddcba,0x0000138dacad7816}},
+{{0x0008bc800c6265aa,0x000afd0d77387521,0x000a35a993dcdefa,0x0006f16edf141f07,0x000072f9912986f9}, {0x000d51a054cd6f00,0x0005b2b6f91b77c5,0x000a7e349cbabe92,0x000dd82155d1aa50,0x00002415888f8cf5}, {0x00076c0334850e5f,0x00011ce0c587706e,0x0009e41693326652,0x0001b279e86545ef,0x0000698c31e80603}},
+{{0x000ec7737ecd9454,0x000eb88f8704f283,0x0003171b7c0d33f2,0x0003eb97ee488407,0x00007fe50d27f089}, {0x000510ca17b11afe,0x00027ed57fa110eb,0x00025eb269ec7698,0x0000b715269cc498,0x00007c34e8cf234a}, {0x000577ee806d0cd3,0x0000b49a33161810,0x0001193d6134e123,0x000b924de1f61bce,0x00000df55d086f3e}},
+{{0x0003c823224fdafc,0x000fd02e4a3c6d09,0x00010fc319dfc92e,0x0003af63ac6c275f,0x00006a3845085fa2}, {0x000acc3b9fdc24a9,0x0001c6779661df3c,0x000d0e71ce9e743f,0x000eaf6c0ecd95fb,0x0000423e70adfe79}, {0x00066be0ca3191a6,0x0009e83b3250d27f,0x0001b31063a07236,0x0001dbd625dc84c1,0x000069b1bab5e852}},
+{{0x0005dce40813e309,0x000d680a45bf37a9,0x0009d512f5da4fa9,0x000affc924c34fd9,0x0000570cbb3be0bc}, {0x0000c901b066f103,0x0004d3925ad865c4,0x0002ac8692ddc983,0x000ecdbf5e19692e,0x00002526294a9ff8}, {0x0002db3fc75144df,0x000632cf68195164,0x0006694e22360b1e,0x00048e5ad17bd403,0x0000142ba192e80d}},
+{{0x0005edadd51284fd,0x000a537f05ced3ef,0x00076b36843c467e,0x0004ec4ecca9c4ab,0x00004c15bcc41758}, {0x00041f726fcdb405,0x000c16dbead39af2,0x000ee1af152ca1c6,0x0006fb0368732a3e,0x00000c272113dfeb}, {0x00022bc72ae2a056,0x00019cd8697a77fb,0x000ce9048f018e9b,0x000aca3d5ff93ecc,0x00003e193d1355b4}},
+{{0x000c14ad7aaa8f37,0x0003499666ac68dd,0x00090d1e0957f5c1,0x0009f6a2c234b109,0x000006fb0be3b366}, {0x000fb3bb4758788a,0x000cd18feacf4290,0x00065394744ffa08,0x0007ced8b9a08c36,0x00004bb26e1a2b0b}, {0x0002acf64e1ad08f,0x000df82a56d05e3c,0x00072855b4078266,0x000e579a19a674a9,0x00004f0d4870e118}},
+{{0x0008da686ef28353,0x00084a7445a76e9c,0x000a54c2692bb151,0x000c0aa8797a5e42,0x000017073e4dbde0}, {0x000a89e07ae4be56,0x000d8a1ffd9ded00,0x0006d688dce0670d,0x000c6e6496b6333b,0x00004f342d86e125}, {0x0004482cce304316,0x00004413ccadd3b8,0x0008bc6255e4bf63,0x00004234b286045a,0x00005df0f4c5191d}},
+{{0x0009a071f111f52e,0x000242294d6e7580,0x000a3dac6f88f8e9,0x000dae8174d57cfb,0x000062e134c5cef6}, {0x000b16277cbcf7fb,0x00012ac8c864212a,0x0001dd1378e796d3,0x000acedfa4854658,0x000055470fbfde40}, {0x000bae5c814a7b25,0x00022344da610106,0x00084339a9c0ff2d,0x0006cdd526a6a4f6,0x0000687b5e5c5fcf}},
+{{0x000e78331b91d694,0x00039f7584e18089,0x0001c89ffb03baa9,0x000b4496ebe0a975,0x0000653aa944644d}, {0x00003d92b340736f,0x0006e609990cb4ad,0x0005186046e77c7f,0x0008e124d13a565a,0x000077ea98414126}, {0x0009ada295f05b3e,0x000d2296ed0a0e35,0x000a8b23c92b11a7,0x0004af681f90b369,0x000073b3f5ba08f7}},
+{{0x000f6c5d0d850258,0x00057e018d6b766b,0x00038ff3f97afbd2,0x000c43db15fcc227,0x00000df5a4b5523c}, {0x0006a636ec2fe8f8,0x000da84cfa9c7ba2,0x00098f47eda0ec72,0x000fbbd6b921601d,0x000057c2931042cc}, {0x00045adefe4d2ef7,0x0007060c62384b20,0x0007f7004f1152c9,0x000ef547434f65fb,0x00000491742230b9}},
+{{0x0005a31b2259fb4e,0x000972bcac52fa51,0x000d3454cb0960f3,0x000c019edb52fec8,0x0000382e2720c476}, {0x000ae106e8e86997,0x0007f98d09383fee,0x000a06ebef986333,0x000c2d09470480ea,0x0000038b6898d4c5}, {0x0001c51d8ace50a6,0x000b9ae2d2948f39,0x000f24ca803142d0,0x0000ea8db4d5a1a7,0x000021aeba8b5925}},
+},
+{ /* slot=13 [{1,2,3,..,32} * 64^(2*13)] * G) */
+{{0x000d438cd11e0d4a,0x0000d43ccf30888b,0x0001937bcc30cb61,0x000720ce09a0e379,0x00004559135b25b1}, {0x000436837c6da1e9,0x000af1fb9bdbe1ea,0x000e5dd155f9c189,0x000be52303001fcc,0x000028a7c99ebc57}, {0x000d9399e8d19e9d,0x000cb962423ffb8f,0x0007c742a3908191,0x00044c4b2b948d74,0x000037f33226d7fb}},
+{{0x000e8767b55f6e08,0x000b35b203a020da,0x0000af8c794a43b3,0x000a7a3e3725a6e8,0x00000f7a7fd1705f}, {0x00012553c821b11d,0x000c241e301df339,0x00004222fd66ed42,0x000168f066fcc111,0x0000307a3b41c192}, {0x000b5d076eb55ce0,0x000bfaa0d925a8ee,0x000cb6c6e82fc536,0x000af52be81830fd,0x0000556c7045827b}},
+{{0x000b517302e9d8b7,0x00069248714e88e2,0x000ca960b5e3e522,0x000ada9bd4fbd774,0x00006f4b4199c5ec}, {0x000b90022bf44406,0x0007eff90b534b94,0x000af86d3aabd423,0x0002ee37600a960f,0x00002f45abdac232}, {0x000f4912c8ef8a6a,0x000fe43fb6e5e61a,0x000fd427cfe58fa4,0x00011ebb5afcc5d6,0x00006a5393281e1e}},
+{{0x000a5139a5d1ee89,0x0007cff936988f3d,0x0000e188c4814545,0x0005a3d3f622fed0,0x00000f513815db8b}, {0x000f04fe149443cf,0x000d9865cddd70ff,0x00031ed1b753cac6,0x000039d31385b035,0x00005846a27cacd1}, {0x0005cdac1eb08717,0x0009590f2e9bc4ff,0x00037afa9967e8b2,0x000b8b244093b5e2,0x00000d414bed8708}},
+{{0x00068265fd0e75f6,0x00028bb90e707cfb,0x000ff92c7ae45b3e,0x00002dd7242a8de9,0x0000685b32019332}, {0x00086a92294ac9e8,0x00045d55547be818,0x000371598323162b,0x000c40194cfbc440,0x000050eb8fdb134b}, {0x00073ec6d6b330cd,0x00007132faff1c0b,0x0004a5dee184e448,0x000d2d2732b7352c,0x00005d7c7cf1aa7c}},
+{{0x000b46bf7a4aafa2,0x000ec4d40d411af3,0x000a7c15e3b78705,0x0009d4d114f0c6ac,0x00003f364faaa948}, {0x0001013e9b73a562,0x0005748ec26e133d,0x000d468058925cef,0x000a438a7fce614d,0x000078b0fad41e9a}, {0x0006a431ed05b488,0x0006c9c495c7ebf5,0x0007f3651aa533e6,0x0006c33e8652baf8,0x00000241800059d6}},
+{{0x000077fea37a5be4,0x00002e5a5eeb7ceb,0x00071270b8db642f,0x000529cc2e6d0c54,0x00004771b65538e4}, {0x00050c7dcf38ea01,0x000c0b2917ab6283,0x00057082f77c6cdb,0x000a1e0ace7cfbe8,0x00004d2845aba2d9}, {0x00037fe0447070de,0x000436dd557dfbb5,0x000600dbcbcba744,0x000d7f8d3b5a3473,0x00004aeabbe6f9ff}},
+{{0x0000119e40d8f78c,0x000c53c710e11463,0x000910dd79a01a9b,0x00024e5486d2b258,0x00001e6c47b3db03}, {0x000134bcc4a9c8f2,0x0001c8ace2e376a2,0x000911a0bafbf8fd,0x0009b9e000ae3049,0x0000046e3a616bc8}, {0x00065442f03906be,0x00054e362be2a14e,0x000dc230c74a019d,0x000861c68ccdfec8,0x00007cfb7e3faf6b}},
+{{0x0000c6786bac8112,0x0005c602f7593087,0x000aace887c608c1,0x0005a949bc60b82e,0x000044f42cab0c96}, {0x000e77c3d5b74a0f,0x000613b6a29eb07b,0x0003c86a801867f3,0x000120e160be0ff1,0x00002aff12a714f0}, {0x000620f188e61911,0x0004cca1d5144466,0x00001d4ac1b677e4,0x000f4c89e66c969d,0x00002abcf3c81daf}},
+{{0x000c44850a3e4545,0x000711540a45c911,0x000f6afb54948b09,0x000fe2c1cea6e720,0x00002e8881b4aa14}, {0x00092e73de0517e5,0x0000f3b632932cb2,0x0009be02e0070bec,0x0003493e71795eb9,0x0000724ad40e5382}, {0x000c1b730877c7f3,0x0004dafc65a4b0ec,0x000edbff8d752a31,0x0007bebacb7c618e,0x00003392751462a1}},
+{{0x000764bf505de2e7,0x000544574c6e1d0c,0x0008f8cfe6085a40,0x0009f282d2dcd150,0x00003fe32267db37}, {0x0005cc04fd37c214,0x0007cb926c3fb257,0x000c297876fef390,0x000a30cac349ee25,0x0000761c34547928}, {0x0005e45c9f9d6421,0x0006da1d0ed1890e,0x000336af307d943e,0x000a88146472f9aa,0x00004106fa9caf38}},
+{{0x00032fed6b46ea69,0x0008b53b80d7c3f6,0x000a926edbdc016a,0x000de48e6eba1898,0x0000508c9980cdab}, {0x000c97aafb2feb6b,0x00033acfabf83fa6,0x00078cf93b97ab72,0x0005df5f742577ef,0x00006b98a85b957a}, {0x000a5d04caf3fe7e,0x000d19a112f33e5d,0x0008ff4badaa057a,0x000ae48558714538,0x000015b124144c89}},
+{{0x00035b58cd14178f,0x00068ba63df31ea4,0x0004b2e5d07a725c,0x00030918adebdc73,0x000072b154a7bd9e}, {0x000dbc71999a6616,0x0002e263a6e9b53e,0x000e3e12ef5fbb66,0x00061bd0fedddcb2,0x00006e020a6ffbb5}, {0x0003e1975702dba8,0x000baa532d76ac76,0x0004e3e812c43fa6,0x00042c87825e7a23,0x0000613bee8fe143}},
+{{0x000e76327c810f3a,0x0009742aab366846,0x00005b2db2703290,0x0000a0e1ef2a7b61,0x00003774b60646ad}, {0x0001e71866fb354e,0x000f16591a597106,0x00009f6d9a2fdbe6,0x000dc51dd90b5651,0x00007956bf34bdd7}, {0x000a27f74c1135a0,0x0007c85539321c80,0x0005827b65f6d07d,0x00063c14c2405b5e,0x00000480c57fa85f}},
+{{0x000a4a6723ba62b9,0x0006c1cfc9ba7499,0x000b50a89c0efb75,0x000e5b9512740e64,0x00001ab7dcc2e3dd}, {0x000a4090217b5ea0,0x000074d8b1b605cc,0x000733fe2e5448ca,0x000f1846062f4cba,0x000067f38c058fd5}, {0x000ccba56e6a60f7,0x00075bc5c15eb317,0x000ec193b7d92daf,0x0004fd31f7998646,0x00003a3ac023f28f}},
+{{0x0007974e8c58aedc,0x000fbabf041a4463,0x000980718ab9ef22,0x000a8a6e185d956e,0x00002f1b78fab143}, {0x000ebffb305b2f51,0x000ad889596b896e,0x0006d5dd25d3f938,0x0000095f0f52dc74,0x000057968290bb3a}, {0x000ab8430a20e101,0x0008d24f0ec47f71,0x000ee2eed1f39365,0x000a3e1cf7509a86,0x00007dc43e35dc2a}},
+{{0x0007ddb0b03bd495,0x000ae901157a853d,0x0005ef66f06d4e23,0x0004ac9d5b944383,0x00004021c7520710}, {0x000f7179dc8a7eac,0x000f7129763dfa49,0x000d83f5898193c3,0x000039dd93c4e836,0x00003a9b171acd24}, {0x000f7a76643bff76,0x000b4c7d3aafecf6,0x00092677f800894d,0x000b0fd176f9b963,0x0000706b9e679407}},
+{{0x00084454707b56e9,0x000019121f284214,0x000577e6efb6806e,0x000f72e94d29c259,0x0000487fb50e863c}, {0x00088b516d2fdee3,0x000c7fe59d589df7,0x000d6348c53bc2cb,0x00009dd44b202280,0x000057548b880c45}, {0x0003b873f2f59ed5,0x000f195b4dcee5d1,0x00030a0a54f7b9c3,0x0002e3dd358b55ff,0x00004c5688939517}},
+{{0x000174a7a2aa2a5f,0x000cb9686df81beb,0x0004c4c6bfd4c722,0x000c1b845dce910c,0x00007de00c9f60c0}, {0x000aebf1d9241077,0x00021ddebdc3a62f,0x0005a7d72cea9e82,0x00061f2a09ee2848,0x00002c9659e3768e}, {0x000e00e861165fbc,0x00094e0729a7dfdc,0x0002a466df69ac65,0x000c353d4d3d5a76,0x0000250d70bf8311}},
+{{0x000d72f86289a06e,0x000a534310a52155,0x00071aa179e9ffb2,0x00064346f924380f,0x00001bc8b8f1f6a3}, {0x0004478c4867226e,0x000f4db44848bd6e,0x000c2567818c1a04,0x000869977c027725,0x00000701a415f7d8}, {0x000677e0006af865,0x00096b8108048dae,0x00089557687a862a,0x00070acdbb409081,0x00005cf5543013b4}},
+{{0x0007299e6cd9c61b,0x000d46e0e0862e76,0x00066c9bf0a48daf,0x0007435a8386fa89,0x00002f104747faaa}, {0x0008d8780ad77d1d,0x00056eff39635c96,0x00018c7ad5d91094,0x0009ef2e977c6e86,0x00002b6afa7fc3ce}, {0x0003048c5da8d952,0x0004e2efcf4ba6c8,0x000b8c5f23c9f5d8,0x000c2386af842365,0x00007f6003cf14a1}},
+{{0x000cd4395ac17bb7,0x00066a1663fc7f79,0x0006e32202d0390a,0x000f7e354b212a3f,0x000003f9b5b4d543}, {0x000aa8bab60ee3a3,0x000073af3c94bac9,0x00066a1456908b11,0x00051c315c2a6ab4,0x00005d407fe682b3}, {0x00002c2e0c7e36b3,0x00003adc95f3fa5f,0x00065532cc76f2f7,0x0005240ca001c808,0x00004e02bea52bc9}},
+{{0x000136bab0763ae9,0x000b168a91756e9f,0x0002927f92961fca,0x00006a7866ae4fe8,0x00007f594e2d6ab5}, {0x000cc12dc820dd75,0x0002f0f3244a8cf0,0x000ed23ea48393c3,0x0009488a73238f11,0x000055355c099a88}, {0x000dc841a64fd6a2,0x00035a3b2cb38c1f,0x000f83077cec2b62,0x000fd1e62b2bfa1f,0x0000189462613ceb}},
+{{0x000daf16e34f2aff,0x000cc37e84fa6a6b,0x0006ad30310aa1e9,0x00030a59a2e312e8,0x000064fe7005130c}, {0x000be7dbaae23d65,0x000df0835d8680ee,0x000016264f78ff6f,0x00021494426249bc,0x0000738d5fd9da9d}, {0x000e96dde8dad58c,0x00010b22f4922d5c,0x000c1ceb27147edc,0x00009df82728502a,0x00003184ef3be37b}},
+{{0x0005fd4d1f228298,0x000f8ca93e035344,0x000640544584e430,0x0001507525d30f93,0x00005e3e448c379c}, {0x00066c5cb731457e,0x000e0947c01c77a6,0x00034153784629b6,0x0009e0dff31f19f9,0x00006ec28f6924b3}, {0x0000f44d906d0c31,0x0002f2327852233d,0x00046df212d1662a,0x000910dafc9bbada,0x00006891e6445d6a}},
+{{0x000162416640835f,0x000eb3d2464887e8,0x000dfc9ee700e692,0x000df68e710d7abc,0x0000463d829f6ffc}, {0x0003abfadcdf40a9,0x000c24c4aa006a4a,0x000dba75539e0e38,0x0009dec37834567d,0x00004a663076e43c}, {0x000bc05e825ce585,0x000e0de53947be47,0x0006ed54eeaa0033,0x0001865055ed4c93,0x000018ce230f6c64}},
+{{0x0003ee2af5184844,0x000d2866a9d9849f,0x000087d8dcc6db0a,0x00073be27e982c93,0x00007c61a9127657}, {0x00077d85a54a1e35,0x000521df4a6bd3f1,0x0008003e2bda5d1f,0x000e3fd19344f58d,0x000017c0924b36b3}, {0x0009dc773cfa66bf,0x000f1992b68de34f,0x000c8adb60b1fc1c,0x000cf335a7d2de02,0x00004d5e92753bc9}},
+{{0x000023eb45a6187b,0x0006bb29cf803e79,0x00064a24f35278f2,0x0006ae4d69a505b3,0x0000587501587f39}, {0x000dee2938f7e106,0x000d76fe6e260f46,0x0001445b21f5df8f,0x000305ea3c0a4ba5,0x00006a47c1a82aae}, {0x0001ad542727a3ca,0x000fafef2a9fcb2c,0x0005fd326e10a50f,0x00067befae789c65,0x00004e678149d1df}},
+{{0x000e3bae4b739859,0x000b611f094afcd2,0x0004d68c38048e38,0x000057acc69149d5,0x0000259a6796a24e}, {0x00092e190673737a,0x000dcdae69dddadd,0x000b03fb5ce3e0a7,0x000daae8aeb6d664,0x00004c81a22109a1}, {0x0006d04f332c749c,0x000e5334af62219a,0x000c24df812d3330,0x00038c49348416ba,0x000018821202f2d7}},
+{{0x000cc411d7e1bea9,0x000e4790ba62ab5a,0x00046a435d92b84d,0x000b0feea5c261a7,0x0000168905d4ef49}, {0x0006a1686bbf31b5,0x0007787698ff2947,0x000db6fbca83dd58,0x0002c474d5ba8756,0x00003499412dd212}, {0x00084b17a1760418,0x0006d2329f461401,0x00078aaa76738f7c,0x000b50f1a5b9931f,0x0000756a415b0a9a}},
+{{0x000d14ee02c0365d,0x0000985d9bd5407b,0x000ae62bd4fe765a,0x0004803448466828,0x000025d5936b4f88}, {0x000d51d6b3e8d444,0x000e3d36da6dfb81,0x000cf82dbdc9da5c,0x0009a3a7db57e4b9,0x0000127f04beccc4}, {0x0000e3117843c069,0x0003b025b79dc412,0x0007c13657327b80,0x00015745adb3b9c9,0x0000767412a63714}},
+{{0x00066665887dd9c3,0x000314bb05355859,0x000f2079b1c90f9b,0x000c12fc6e08df8e,0x00007ef72016758c}, {0x00082a5c273e9718,0x000995e4efd945a7,0x000f237d3e3576c6,0x0000a990f2ed8051,0x0000044fb81d82d5}, {0x000f18c5a907e3d9,0x0001dce4c6359c1d,0x000201bb4957b337,0x000dd2eca704534b,0x00007f79823f9c30}},
+},
+{ /* slot=14 [{1,2,3,..,32} * 64^(2*14)] * G) */
+{{0x0003c1a2bca4283d,0x00091a1863dd9781,0x000268fa86ed62f0,0x000ae4caec7bcb8c,0x000010e5d3b76f1c}, {0x000c6fb6e4e0f177,0x00029a4bd6a932db,0x00087af6e804e1bf,0x000d0605e1966d47,0x00000edc5f5eb426}, {0x0003bfd653da8e67,0x000ec24a9f641545,0x0003578a23e9dc1e,0x000ba72bf87263b0,0x000045b46c51361c}},
+{{0x00002abf314f7fa1,0x000dc8e8cf450a94,0x0003a8be84e257f1,0x000713b1dbbd54b2,0x00002177bfa36dcb}, {0x000d4ddd8a7fe3e4,0x0005676620e30ce9,0x00030e9958ab1364,0x00029df4b594f7bb,0x00005c1c0aef3212}, {0x00081bbcfa79db8f,0x0001ec25f59b3370,0x000c832487604881,0x000b5bb087a76659,0x00004ae619387d8a}},
+{{0x000bf6aa5344a32e,0x000b4b41b40788dd,0x000a130d607d88ea,0x0003e035eb0eb974,0x00001a00d91b17bf}, {0x00017e44985bfb83,0x0002a71963136611,0x000425904bfce046,0x0003d6483ac3448d,0x000075685abe5ba4}, {0x00060933eb61f2b2,0x000a8c9ff49526e9,0x000af66569543d0f,0x000e6aadf7275107,0x0000135529b623b0}},
+{{0x0000dbd7add1d518,0x00088cfc11f1118f,0x000114759b979f78,0x0003a018732e1f07,0x000079b5b81a65ca}, {0x000716bce22e83fe,0x00019e80985c1f5c,0x0004254aaeb42beb,0x000a613ec9da6371,0x00005972ea051590}, {0x0004ac20dc8f7811,0x00094ac4d4fa80fd,0x00033604349a9ad2,0x0003bdbc01b2d64b,0x00004f7e9c95905f}},
+{{0x00074bbc5781302e,0x0003989addc0f626,0x0003fbd9c6d8520f,0x0008e4c8c2999ae5,0x000031993ad92e63}, {0x0008443d355299fe,0x0001cdbebead771c,0x0001a494668bcd3b,0x000adc88092499ef,0x00001942eec4a144}, {0x000c5319ae234992,0x000910cea3e927da,0x00053c11222c1b3d,0x000ca75553ce4942,0x00002a0a65314ef9}},
+{{0x0007937ff7f927c2,0x0000617d0a6352db,0x000155af76db741f,0x0002ded5982f3a21,0x00004cf6e218647c}, {0x00061acd3c1c793a,0x000ac5a35bc3bcf3,0x0008cda6ab2f9ebc,0x0001a1360e860e9a,0x0000055dc39b6dea}, {0x0009227cc28d5bb6,0x000bc774dffabb11,0x0004a32c8907e24e,0x00024b6a83c78cee,0x0000121a307710aa}},
+{{0x000b5d5e9f034a97,0x000093034bc2de4d,0x000551d3b1e153fc,0x000e52d460546919,0x0000333fc76c7a40}, {0x0009713ec77483c9,0x00077b82b96afd65,0x000097bcd388bfe0,0x0003a9b289e28231,0x0000527bb94a6ced}, {0x000d992a995b482e,0x0007c6e383801563,0x000f64d8e53405d0,0x000a9f7485035de2,0x00006b89069b20a7}},
+{{0x000aa0416270220d,0x000faf9245b4e812,0x000072ef05995a89,0x000eb73ffadc4ce5,0x000023bc2103aa73}, {0x0002fa8cb5c7db77,0x000f8c734c155408,0x0006e7a57e068686,0x0009bcf29e6c8d9f,0x00000473d308a763}, {0x000e792603589e05,0x0001246dcc492cae,0x000601a94f2b4b42,0x000341a02a1ef74e,0x0000102f73bfde04}},
+{{0x0005593d553df3d5,0x000b5f2482069a99,0x0009808d1da01d7d,0x000739b8f096fdbf,0x00006efba66f963b}, {0x000ab809660078f6,0x00077c67dd5f338b,0x0006e4ef4f69c7ab,0x00073f3960111bba,0x00001d680f3fc38d}, {0x00035dbfcd04e0d9,0x000eabacb06f9568,0x000ebe1e6a4f0675,0x0000e63e41ab47b9,0x0000559c02f0ac92}},
+{{0x000e2ab4bf8467b1,0x000f7d9a83a10c56,0x00081764baa1528d,0x0000c996fa5fbd41,0x000048126b174c50}, {0x0002ce6131c554aa,0x000a2ab18bf3b4c5,0x000f04eba0b96ef6,0x0007a299a99a4b41,0x000000b0a50c42e3}, {0x0000f8352a5be441,0x00010a0d959a6d48,0x000a5520f88278f1,0x000b770f4543ce03,0x00001a85b2b3f938}},
+{{0x000808d3e592dc72,0x000698b9699be621,0x00053962d07b6072,0x000336c50e2ed0d4,0x00004cc7b3d8eaeb}, {0x0000d845f792604d,0x000d188530b963f5,0x000a5b484e6d4668,0x000d5876d81b8755,0x0000249f252da35a}, {0x00003dd083197e17,0x000a06b6158f8728,0x000f45fa3c00a177,0x0002d8d9255fe2f5,0x00003965be6b7db6}},
+{{0x00088bfeb5fbf396,0x000722bab6fae620,0x000878256323244c,0x000fdd1862717dd8,0x000003237aa33c2a}, {0x000356ea2096bada,0x000af413dbf558c7,0x00036b53dca7d363,0x000e5ccfec73d8f1,0x00007790288af7a9}, {0x000059999f6e34eb,0x000387a053d1bbce,0x000618f8b2edcbf8,0x00041c588cea08ce,0x00003163fa98d0cf}},
+{{0x00002ba12e6fb61d,0x000c8c01c7a8d10a,0x0009409f5212633e,0x00084523afec98f9,0x000056a0de118e80}, {0x000f1b05c369e585,0x0006b6a59ebe7111,0x00074201a4f40759,0x000e280b12331701,0x00001cf79771a39a}, {0x000dd6258ee90b22,0x0003022db8596bc4,0x00027baafba21ccb,0x0008735d2278b6e5,0x000071bd6a4a2a8f}},
+{{0x000bf45a386cb214,0x000b41b9c063dc08,0x0006c29ad7055f36,0x0004d9dd96f4b299,0x000052b7bdbcae03}, {0x0002d2a6af827b1b,0x000dd627450e17fc,0x000f45c2ceeb69b8,0x00094047472d8bbd,0x000054810835ed45}, {0x000ef2f8e990635b,0x0007c6363579bd05,0x000da929ecb53eff,0x0000ca4c157578b9,0x00007ffc5cf37baa}},
+{{0x000332654bbac18c,0x0007baddea6f31da,0x000ff375df45886d,0x0007ddf118773c3c,0x00003cb3dc9a52ee}, {0x000413d0b392a36f,0x000fe103fe8a1138,0x000b5188cc21dc27,0x000f8b1503591812,0x00005e2de8347dac}, {0x0003873a0f4536c8,0x000814bbb50c2dc1,0x000f163dd1810d6c,0x0003db8b0123ec96,0x00004fc005162dc4}},
+{{0x0002d50c7ec20d3e,0x0006ea0c97263b5a,0x0001ff734dc64bdd,0x000faba56e89052c,0x00004929c6f72b2f}, {0x000ecba293a36247,0x00062b268fd65358,0x0008a01c89af8f98,0x0004524412f7e996,0x00005786f312cd75}, {0x000788ffca14032c,0x00028447f1ee3337,0x00031bccadf39210,0x00047838b14071f2,0x00004c817b4bf234}},
+{{0x000dd9a7ea2bb416,0x0001d1ba1909a28c,0x000719ed8e331076,0x00064bc293f4992d,0x000060abc5b3194f}, {0x0007140c4ff8cb4b,0x000206ecfb035ced,0x000f25635a1933f2,0x0005850dc50cdf27,0x00003b6437eec375}, {0x00084286590f032f,0x0009c1ae04f25fdf,0x000e54854c9f9399,0x000663474f44cec6,0x00005e5935749e0e}},
+{{0x000bfac21ae390e3,0x000f2582ee0948c5,0x00001659e6255b0b,0x00008843f004ad9c,0x00004bb71f82b796}, {0x000600926ac9f32c,0x000428f8adfef9dd,0x000873ac470d558d,0x000e19723b4acc79,0x000045c237189f34}, {0x0001d78b2dec06a4,0x000e4f20fef72fa4,0x000681b32a26849f,0x0006691e87a5a243,0x00007973667a390c}},
+{{0x000e448eadef2476,0x0003b1f30d78a306,0x0002771ab6434cab,0x00050ec66ada0faf,0x000064c33dd7500c}, {0x000e7e3823ced76e,0x00078e0856661495,0x000ecc71294c3915,0x000710c2bee4d328,0x0000677569121e02}, {0x0003b2ab2c6b0c1a,0x0009f5bb9134cbab,0x000f22e53aa86174,0x0008b7ee1c9b4ebe,0x00002ff5cba9ab2e}},
+{{0x000634c709324e2a,0x000d380135df8a1b,0x0009d08c1b9ee4e9,0x000a6e782b7d7de2,0x000005ee0540cc55}, {0x0000e71f5469a9f9,0x0002b95ae6f926e0,0x000a908b298ed8d6,0x000481f89e6d6238,0x0000795a20df8375}, {0x000b076211194906,0x000b26b1e7eefd76,0x000619339eca4093,0x0005fdb71e914304,0x000013d7e950472d}},
+{{0x000afae1561d67a0,0x000c06cb64712ff8,0x00084b721908a921,0x000058a07184aadd,0x00001993c62d9cdb}, {0x000046cebb5c2484,0x0002a25761352641,0x000a95262105dc0d,0x000df39338dbce7f,0x00007d5cb2570cbf}, {0x000d4a5ffc824eaa,0x000e049ee92a52cc,0x0008808082633e73,0x0007a1a17f79b9c9,0x0000186625b853f2}},
+{{0x00087e634bff79d2,0x0009c70e08d24376,0x000e3d4e886b2bf0,0x0000c9b8f3e4a613,0x00001b5cc060c719}, {0x000a08ddb9503a12,0x000b7adb13df5777,0x0005b89143c502a6,0x000144860dbc5185,0x000042c1e9bd2e84}, {0x0009908b455c2f42,0x0004eae7b2779052,0x000923c7038d7fb4,0x0000a40a0eeb53a6,0x00001b1ccd090a49}},
+{{0x00046a07e40eade2,0x0003c8d062e798a3,0x0002115c3493a3b0,0x000acb0307d99ee7,0x000051315b5fcd77}, {0x0004a1de98c7b4ff,0x000bded909e07503,0x0003ae853be0a1cb,0x000947c4198fe02d,0x0000307cfd354285}, {0x00098bb9386ecb47,0x00089b16d7eeef0d,0x000d213bc4feb8dc,0x000eee448a430fc5,0x0000664d5464c0e3}},
+{{0x0002cd2b37386683,0x0009ce4694fb6278,0x000ae11d7c08ac60,0x0001963665b49b25,0x0000301f5f7cb503}, {0x0002d21e57196c45,0x00079747b796bcad,0x000f89de69392d76,0x000793150a3516f0,0x00002f2430fabcc5}, {0x0000648c9a834429,0x00053ed56ac0b135,0x0000d782cd76b3cc,0x0005727dfe89804f,0x00007c4d328a72a9}},
+{{0x0006dc0b06bc55e7,0x0009f3777d686821,0x000d57e315e692c7,0x0006c43798abfb90,0x000035cba6d8b877}, {0x000bfba138ae82bc,0x0009a5be694f284b,0x000b4daa7e1f236e,0x000368bb5572aa23,0x00001fcf530fe364}, {0x0006073da9186af8,0x000090659e3b5db3,0x000205c719d96705,0x0005ed1f0f0c5bfd,0x000060f50e8fd26b}},
+{{0x000ceb1fcc5ecafd,0x00009f0bdefac109,0x000a4399e9d39a60,0x00055d144ff5b2c7,0x00003e4851b40e7f}, {0x000d3361a83b70eb,0x0006a87a10ec9f0f,0x000edfa7ee45e6ba,0x000c8a88fb4dfc0a,0x00004d8eef0ae790}, {0x000e1f75e6789140,0x000e1c970d90b842,0x000e03e394fab7e8,0x000d4c21256e0979,0x00006670c1f9d1e3}},
+{{0x00087d840e4e4f71,0x00003308e91a0f25,0x000fc891c5f098f8,0x0002a50d6413fbcf,0x0000032ea8130fdd}, {0x000ef1747a44fa11,0x0007eafc28f2e540,0x000e7fc398cd1b0a,0x000b688e79c7f544,0x00007e4a35595e82}, {0x000bc79c464ed11a,0x0001ee78c405a6f9,0x0002a1e3c326e2ca,0x0001df56853b516e,0x000027ce113be711}},
+{{0x00055e79db8b98c1,0x00063529c219232e,0x000ed6007fc88813,0x000f6084c9f4cd9d,0x000064a3cda34a69}, {0x0002d88c45668fc7,0x000f7138a60c0f15,0x0004ccec1a27889c,0x0008db678ed9edfb,0x000017582fa5b44b}, {0x000e3bd46639b89a,0x0007d3c119a1c0c6,0x0003c9630538baa0,0x0009dff54f70fc6f,0x00005235d0af34d9}},
+{{0x000db8ec899cf03a,0x0003ad3d2c19a029,0x000385fdc5e4bbb7,0x000a3741d03fa898,0x00007a5dc3cd1890}, {0x0005a3dba26aa0ee,0x000c9d868c2c5931,0x0008ece49e118833,0x00072c069c20dc50,0x000041273efe18ff}, {0x000ec623d2407132,0x0008181b75fefc18,0x000e85d620d8ceaa,0x000411384f5dd2ed,0x0000719807c5b769}},
+{{0x0006d0d8dc118efb,0x00039a3648fcaad7,0x000311b0a6f65f3d,0x0002eeac94e15dee,0x0000415693e308cc}, {0x00073fc09f114c42,0x000d1d2a489cc1e9,0x000fcbf7505e630e,0x00051b718ab8b6b7,0x0000264de442de86}, {0x000934e6a8421178,0x000ef8779b2b5635,0x000d56de27b01b6d,0x000076179810ccd3,0x0000781ae16baa3c}},
+{{0x000fef81dc5edd71,0x00056f956825ad1a,0x000658d67982ed6d,0x0005626d5fa69c3e,0x00005ba543accc2a}, {0x000eb177f81f4e33,0x000fe6fd6cba39b5,0x000d830c50a6991d,0x000d89c6db266e85,0x000055ac20978c22}, {0x00072130830474c4,0x0004f0c28b63ab00,0x000d28cabea843d6,0x000644be65780b1f,0x00002ffd768b3b8b}},
+{{0x000853852871b96e,0x000ab60c3f1bb0ff,0x0005344402e13e9f,0x000744beefd59532,0x00000a37c37075b7}, {0x000ba057a40b4484,0x0001a4f5f6a43413,0x000ee1d61cba4c2e,0x000dc53614ba0a5a,0x000078a1531a8b05}, {0x000df1703ad0562b,0x00030c92521a36cb,0x000d8424e78ecf48,0x000c56fdaebd303f,0x000072ad82a42e5e}},
+},
+{ /* slot=15 [{1,2,3,..,32} * 64^(2*15)] * G) */
+{{0x000aeac733a63aef,0x0005d4442454ef19,0x000795e4412c7fba,0x000b0f55da87aa04,0x0000413051e1a4e0}, {0x000dd1fd3d578bbe,0x00072c3286108852,0x000ace22732b65ce,0x000ab40658c07f4e,0x00000933f804ec38}, {0x000b69798d496476,0x000defcb5abc8a7a,0x000b5394728121aa,0x000351aa5dc12ef7,0x000007fd47065e45}},
+{{0x00083c3d258d2bcd,0x0004daf60b73fc85,0x00016a378117029a,0x000fb23fa0fc9d64,0x00001c1e5fba38b3}, {0x000211559ae8e7c3,0x00029944882a5304,0x00078250e4f281b2,0x00048f48a13ac2e3,0x0000014afa0954ba}, {0x000197001bb3666c,0x000524bffecb9cb3,0x000a88233c330060,0x000d364293711991,0x0000291884363d4e}},
+{{0x000c6805dc4babfa,0x0005e5596ecc1033,0x00059b1d3b2c15bf,0x0000ec51bc70624b,0x00003ede9850a19f}, {0x000d37c3bc1ab6eb,0x000534d57a240fb9,0x0008a5e1f602be14,0x0008188f4d73415f,0x00005964f4300ccc}, {0x000a23152d096800,0x0005970866996e44,0x0006affb6e5c08c5,0x000fd89df2db60a4,0x0000579155c1f856}},
+{{0x00024edd12e0c9ef,0x0008df2420297963,0x0004f573be468b87,0x000e92a199a3776a,0x00001e7fbcf18e91}, {0x00016b630817e7a6,0x000233c351026b5f,0x0004cef201808c69,0x0005345324a983b5,0x000053c092084a48}, {0x00041481f1cbafbf,0x000b6716174e5d2d,0x0002a55c98231d2d,0x00095f60b7d7656e,0x00003e955cd82aa4}},
+{{0x000f535e3ed15433,0x0002a0d7270a3e48,0x000ade6387d07569,0x00095f540fbd21da,0x000014264887cf44}, {0x0009f3ef61bb3a3f,0x000652eb9193eab3,0x0008c11f748eb400,0x000c49fb5de6ecc3,0x0000654d7e9626f3}, {0x0004cfdd5c7d2ceb,0x000ded737ccb9e56,0x0001f9b0ab82eeaf,0x0008dbb6107db62d,0x00000b6baac3b435}},
+{{0x00062bcb8622fe98,0x00056ceb891af7ae,0x0002e406b4477622,0x00015011a5a92bcf,0x00007d29401784e4}, {0x000abad63700a93b,0x000d3da779373204,0x00033ab709be0023,0x0000412d85f03466,0x000000496dc49082}, {0x0004b88dc27e6360,0x000268d14850c1c7,0x000e0dcb30074854,0x0003b23a145fb7b3,0x000010843f1b4380}},
+{{0x00090455376276dd,0x0008dd7645cd9c5f,0x000d366b39ce5915,0x00096c492f65d511,0x000011574b6e5269}, {0x000f672de324689b,0x000edb394a981d56,0x000168cfedd1da8a,0x000c1e8dd7b58fe9,0x00007ce246cd4d56}, {0x0004308e7f80be53,0x000cb34a9d397b8f,0x0003cc2b2c5f3cb8,0x000f67118a961bd3,0x0000710045fb3a9a}},
+{{0x00093d36101b95eb,0x000794f6f448673f,0x000f15e562faef33,0x0000da15651735f8,0x00007fa3f19058b4}, {0x000fc862059d699e,0x000a19a619e69a03,0x000f823deb2370cf,0x000844ec4fe3b122,0x00001d1b056fa7f0}, {0x00064631e56bf61f,0x000106e5382a31bc,0x000540168dd379ab,0x000d8e44d58c57e0,0x0000566256628442}},
+{{0x00009db7707023bc,0x0001b7fb3c6390cb,0x0005b20da369cde4,0x00042ed4fd98a902,0x000014403e084893}, {0x000fb17aa4cfa6a8,0x000f604c3f8cd0f8,0x0006ed16e7f10a1f,0x0006e4f9d9260ac3,0x000066f05afb22bf}, {0x000fc62a8850c41c,0x000d883794580db7,0x0004618ca4ba218f,0x000a2fd3c28c6534,0x000016a64f763963}},
+{{0x000320d2a85dc4df,0x00038c5eb76dabf5,0x000b517cf327a0da,0x000a1efd2eb72a2f,0x000076bc96275c9c}, {0x0007c0f47cd1e95e,0x0006285866e88440,0x00052cbba20342cb,0x000d9a417b999829,0x0000343ebecc3bfa}, {0x000aeee4efac1277,0x0004647d56dcea45,0x00085f7bf033deb9,0x0001e8b90f3cf566,0x00000a6e78e1d4ba}},
+{{0x000793176ad3f8ea,0x0005fa4189546449,0x00081d3f1c2b53da,0x000dc79d1ab514be,0x00000dc3e18cb672}, {0x0002c83fa98c223c,0x00008b7e584168ce,0x000404f33a81ddca,0x000b0bccb6913d10,0x000061da2f198e00}, {0x0001694e18df62c4,0x000ee696261db893,0x000334e4848890d0,0x00014826cecb70dd,0x000049f0257b1b89}},
+{{0x00001f08dcd6ec77,0x0003d40ce356cc0a,0x0004377df1057b52,0x000a0d5af5e15c88,0x000008aded3748b9}, {0x000b689a03641c46,0x000d2755172d6489,0x00008fe43a6d63bc,0x00036e23f61f8f9e,0x00005feaae4db6d9}, {0x00021e84893e747e,0x000281eb609e6eaa,0x000e48ce6dbbca1f,0x000cc1b3f73a7d10,0x00002cf88a206992}},
+{{0x000dfb233f79bd98,0x000d4b0cf9123006,0x0005fd6eaf8e0d70,0x000cd20865ec732b,0x00005d69c3241c55}, {0x000a52f79d55e3e9,0x0009a64e762e584e,0x000d7295ee60a721,0x000fb7cf5d4315a0,0x000072234b33eba9}, {0x00061f97a8de0870,0x000c132cf7bacace,0x000ca1bcc47d8017,0x0006ccef32291aee,0x000007e5d451f649}},
+{{0x000c8f52c9ae957a,0x000b5c6a7e1f5fcf,0x0007e39068486155,0x000e4d54b1f93c10,0x0000650dcb667282}, {0x000a06a4098539ab,0x000614de6b10e1bb,0x000a83f3e3257739,0x000188252841fcfe,0x00004c5ace535d78}, {0x0000b746cca28cdb,0x000544e5f84591f0,0x00002c00bf025c1f,0x000720f3f28167b6,0x00002685b798f87c}},
+{{0x00040b86c96eaf46,0x000de5d7a8dda70d,0x000b72a69851592b,0x000083fd1bbe5eb3,0x0000494e65648519}, {0x0002e59ee2face13,0x000e57aec3942d98,0x0008c38719ee7f8b,0x00093dfa6a198fbd,0x00004b51bdf2386d}, {0x0009d92009b63896,0x0005786937b64f2a,0x000160002b7ae6b4,0x000e19c7a712201c,0x0000333d783db108}},
+{{0x000499def6267ff6,0x0007b742c0843b9e,0x0009a4f2b17772ca,0x000500623a0153fe,0x00002cdfdfecd5d0}, {0x00099cd61ff38640,0x000c3063625a0dd4,0x000dd73dc329cd9b,0x000923151e2d8023,0x00004a25707a203b}, {0x0007668a53f6ed6a,0x000581dd170a12ab,0x000ae20161304242,0x00049fc4000144c3,0x00005721896d248e}},
+{{0x000a48c6983a885f,0x000f69d7b85ae592,0x0001a31614d69b35,0x0006160526c8f320,0x000061334e5c8236}, {0x000c0178adb05cf7,0x000b637c8ec08e60,0x000c244d9a91345b,0x000af7ef4c1ec627,0x00001c1bb86e05ef}, {0x000443c63ef0345b,0x0004efeb1e89a813,0x000d91686a432a06,0x000d8a3890864ccb,0x00000c9223e46cd2}},
+{{0x00062a6d86990ea1,0x000f6ca1472a1345,0x000c29ff7c5b3ccd,0x0001f9c039f8aa3f,0x000054cd6932874d}, {0x0000bea24bc624d4,0x00040d51bde5210a,0x000c956d05059fa9,0x000e6e1f19370030,0x00003f720b2d4021}, {0x0001c59d2fd740c1,0x000b41ae4df9a1c1,0x0004287595d836bf,0x000c05195a19e612,0x0000128204872cc7}},
+{{0x00030331e87afa49,0x000f28cc6115e56a,0x000bfb3c829d9d55,0x000db70aa218362e,0x00000e92608e3d68}, {0x000a42fc3427e82d,0x0000f1e81c331962,0x00047982de2cb9fa,0x000c07b992a0a7b2,0x000038de9d5582e9}, {0x00022f55edb9a8a3,0x000761a85717dbab,0x0000f9d029f10a71,0x00098a5fa6388b9c,0x00002f2833791fa5}},
+{{0x000aefd52e9b5805,0x000009485e2d45ba,0x00053649591d70af,0x00060c82b7a32c47,0x00001216a2862de5}, {0x000ae7b077bc5547,0x0008d0de43a5675d,0x0005f3c725051e01,0x0002c33dcc2bd007,0x000050e99aa09be7}, {0x000f89b2fe68d895,0x000242dc9388108f,0x000fbe70d89684b1,0x000ba69e4cb655b2,0x0000069bfdadb3b5}},
+{{0x000c770d9f476e0f,0x0004b7cbe789fdc3,0x0007a6d07c312375,0x000fcdd7855d6522,0x00004ef5c3bcb0fb}, {0x000b60a60eb194ab,0x000464891ecf41a5,0x000b5f695ed657ec,0x000a338b4ebbad54,0x00002c707d062ce9}, {0x000fec17f98344d6,0x0009fdc5de487d31,0x000d67e20d6abe65,0x00096d4c2a6688b2,0x000057adf45c4773}},
+{{0x000cb41d187cc287,0x000dd1cf81fba00a,0x000dbed7138fc9f5,0x000b175aa8d1d70a,0x0000621c7df96e28}, {0x0003f30c043a8bbe,0x000ea7a6e5d94e98,0x000626c5036e2e5f,0x000bbfcf3b083d34,0x000005187bc86442}, {0x000c88139900a43c,0x0001f11b0e700320,0x00070be50df45a99,0x000c4b5497002d6e,0x00001abdfdb1819c}},
+{{0x0006668051407d75,0x0001e1c2fed8fbdf,0x000684a5c8ea5de1,0x0004da975129b110,0x00003828c673c579}, {0x000a0361c27e34d3,0x000fe4553ecc789c,0x000f6f2c5f043cb0,0x000e9c2565504b23,0x0000506d1312b4f0}, {0x000becf7006058ae,0x000193ab299cb4dd,0x000041989b1a7c2d,0x000c309d082dc797,0x000071ca4602737e}},
+{{0x000d07093c842496,0x00042a9121a0a66d,0x000b2462fdc7ac6e,0x000acd355bb3238f,0x0000595b63664da7}, {0x0006dc5c177a921d,0x000b6aa360f948b0,0x000cf667ab60dfa5,0x0009e5c6e87b2863,0x000019633236b4b3}, {0x00096a6f761207ed,0x0004dc534e0eb3bf,0x00088c1420d19fa2,0x0005b596f913c336,0x000069bcfdc8ce29}},
+{{0x000b25cc6e77dfdd,0x000792d27467a636,0x00081bb3d7fce638,0x000bd850d0ae9ccb,0x000028ab5deaf3b9}, {0x000e927228fd064e,0x00071a66c6aa5751,0x0004beec9d7e49d2,0x000ee12ce3b0f8c0,0x000072904e606156}, {0x000a5d1bab08323a,0x000e63ea84b19fc1,0x000c227d2b55f8b7,0x000b81d5fe23da71,0x00005e4798a41b4c}},
+{{0x00055c45ef84dc24,0x0007d1e5a2b5f4c9,0x0005bb889adeb431,0x00071f0f0a36c971,0x0000004408febe8a}, {0x0006b514e05a80d1,0x000325243cef9f43,0x000486b9a5ee53ab,0x000dc004ba168b57,0x00006dee63385fca}, {0x0008580e0d851269,0x000667350514cd94,0x000be1c340d275e0,0x00058fcd88bf01b6,0x000018f825b8ce44}},
+{{0x00055fbc7d8f8d6a,0x00077909e062b807,0x0007a48d1cd55885,0x0002b5beeac30908,0x00005c7fba6309b0}, {0x00079490e3930ce3,0x000abf374e08346f,0x000ab98d81bdcc46,0x000f95eef568db6a,0x0000467c58b4db20}, {0x000dfcd3c4e47b7c,0x00078917e5aadac5,0x00040ae6f34c87cf,0x00007c22d08cd2bf,0x00006c583b314004}},
+{{0x000cc81db7f271a1,0x0005afdff5d69418,0x000e4b616f640e8a,0x0003c195e05e4d9f,0x00003bf73c36b849}, {0x0003db2c1e257f49,0x000fef3847662576,0x0007364b6ee17154,0x0004642ede89b725,0x0000677a3dabdf86}, {0x000b94475fccd9d7,0x000836bd4db3065b,0x000adc4a56773538,0x000aa015b1fcd2a2,0x000045aa3e879a6b}},
+{{0x000f965d68fa8dea,0x00052c71c12a35c9,0x0004c33aa4c6893e,0x00006bf11806e5b3,0x000077fc7ccaadde}, {0x0007c358b38caaf5,0x00080294a0fd83ff,0x00045dc5a64be255,0x000a9dabbfe7c0db,0x000004c70487b9fe}, {0x00046bd90d0139e6,0x000033dd5e4988e0,0x000caa62c78cb8a1,0x000fe685e6df81ff,0x000041d140ea0d16}},
+{{0x00009ffa35ee90e0,0x000af6426d717790,0x000824a6dac5cf1d,0x0001f7c1e4194d65,0x0000216211d9701f}, {0x000c1ee985794d1c,0x000ac5775592c21c,0x000f945dadd53f53,0x00029f3ab4d6e7cf,0x000061cbd9daf063}, {0x00006f8a4585f40d,0x000552111227e93d,0x000acde960ede8d7,0x0009b3af188ace1c,0x00002c6e2caf0374}},
+{{0x00080d7d5e137336,0x0005defeafd06670,0x000636b79b4565ea,0x0008150b0944b87e,0x00007e72ef078c45}, {0x000896d7aadba580,0x0003a9a9a379b3a3,0x000bf4569d3c58aa,0x000f912bd2fc8e0d,0x00001507a4cc60f5}, {0x0002745f65639593,0x00094a0df6c92944,0x0004551c5a8d8d68,0x0000e3739bb88130,0x00003bc085053d34}},
+{{0x000e5517fd181bae,0x0009f2bb963b40b6,0x0002064625902262,0x00013da5509bce93,0x0000578edd74f63c}, {0x000d5091a1d0da4e,0x000a7b5fe3e08285,0x00019393b34baa6f,0x00030fd63e5177ce,0x000003c935afc4b0}, {0x000276c6492b0c3d,0x000c4dfe205fc997,0x000d623a3c47ccc2,0x000c7a2dcd29b84d,0x00003ec2ab590288}},
+},
+{ /* slot=16 [{1,2,3,..,32} * 64^(2*16)] * G) */
+{{0x00082014385675a6,0x00030aafda9e8ef7,0x000cdfa8cba2649f,0x000c0b34cd1eb505,0x000046115aba1d4d}, {0x000dcc9dc80c1ac0,0x000f41b38a436a66,0x0005dbd7c697a05c,0x0007daba7ebf3be9,0x00007da0b8f68d7e}, {0x000f1953c3b5da76,0x0007321119e9bd40,0x000eb259601dac6f,0x0004b4b03cc6021f,0x00005a5f887e8367}},
+{{0x000301cf70a13d11,0x00015350dd0c48f6,0x0004bca47ecfceb8,0x0001434f70297d4a,0x00003669b656e44d}, {0x000628d3a0a643b9,0x00000e6c320649e9,0x000c2dec32b5c3cb,0x000c70c9b5302897,0x000043e37ae2d5d1}, {0x000e3f06eda6e133,0x0005199a13ac0387,0x000626381167301d,0x000e9bebd5ad8f83,0x00006a21e6cd4fd5}},
+{{0x0006170a3046e65f,0x0002a00d23524f1c,0x000c82b75558712a,0x000ff5769dbbd3c8,0x0000586bf9f1a195}, {0x000129126699b2e3,0x00047708d1301ef4,0x000182b0bd71d308,0x0008b36325432d01,0x000045371b07001e}, {0x000b088d5ef8790b,0x000dc610937e5a6d,0x0001a16eb85278f0,0x0002179ac0349d26,0x00000eafb03790e5}},
+{{0x000555c13748042f,0x000e6820baa11960,0x0003486d0c219a41,0x000c6611c81f7387,0x0000309acc675a02}, {0x0000805e0f75ae1d,0x000e32662cc30514,0x000a92396dec02fb,0x0005bb32cebdf1ee,0x000044ae3344c543}, {0x000289b9bba543ee,0x0009d5ac971429cf,0x000f9360aaf3760e,0x000678f1d82e5c64,0x000062d5221b7f94}},
+{{0x000c299c18d0936d,0x0006c8a0c1a0c524,0x000b4a8631c86bb5,0x0004562a375052ed,0x00005c0efde4bc75}, {0x0005d4263af77a3c,0x00011fee9144d758,0x0009f7193ddfae7b,0x0002037a50670805,0x000014f29a538392}, {0x00017edc25b2d7f5,0x000db99b53040df7,0x0003ed4c6221f970,0x000093eda9234b7c,0x00005e72365c7bee}},
+{{0x000bfc074571217f,0x0005d0694d95b575,0x0004191e33377967,0x000eabc9a0a37bbf,0x000077f1104c47b4}, {0x000339062f08b33e,0x000e5df9f32be7d9,0x000f9ebdfd5b9659,0x00049b7acff3dad1,0x000070b20555cb73}, {0x000113c555112c4c,0x0003a9a881fcdbe5,0x000e503b47668842,0x000404a446677855,0x00000e34398f4a06}},
+{{0x000d22d93ecebde8,0x0004127822f07b67,0x00005b6d8d09b3e8,0x0002372743fa61fb,0x00005e5405368a36}, {0x00030b093e4b1928,0x0000e73f3f640189,0x0003395d6f7de3e1,0x0009c3ef43217da7,0x00006f8aded6ca37}, {0x0000123dfdb7b29a,0x000e1a21ab291e34,0x000de6949e487b97,0x000de97f9967d02f,0x0000780de72ec8d3}},
+{{0x00028545089ae7bc,0x000cf1c7f4d060ae,0x000a4811b8388dde,0x0008ce438ac15510,0x00000eb28bf67192}, {0x000feaf300f42772,0x0002a2a8c41aa671,0x00073732928f72eb,0x00087a629a17fd79,0x00001defc6ad32b5}, {0x000bbe1aef5195a7,0x00077917b15edaf5,0x000ae5da2e148c12,0x00028672991f7fb7,0x0000467d201bf8dd}},
+{{0x000cb4ab471cbced,0x00023971c6837d11,0x0008eb5bff5cea02,0x000cc8b141081dfc,0x0000166f19391a11}, {0x00074bf772ec328b,0x000f1e89368d34cb,0x0004864f13ffed90,0x000ce0f69b640237,0x00003ef7c1ab7acb}, {0x0005a3e049ea16ba,0x000a2cc075e1f986,0x000454e7b697ef82,0x00025367b6429bc6,0x000014ccd4a19122}},
+{{0x00017c934b338da5,0x000190a266975568,0x0000fae7287120b1,0x00033e6b20118a74,0x00007c8453d2e47b}, {0x00028b84478f3d3b,0x000a0c56a8fb945a,0x000c7bf816918324,0x000581f755aa1c0a,0x000072cba38cb7bc}, {0x000da48708eddde8,0x000da8a6adb68e09,0x000ea65bee5223a7,0x000a4e3e5f9095eb,0x00002443e70425eb}},
+{{0x0006fb64e7ed26b4,0x000fc54e216bf3ec,0x0002dd9fbaa1f955,0x000d3e43a0d52469,0x00003349ed00b559}, {0x000977bf5e83617f,0x00084ed41e2412d1,0x0003a9e4c7e33968,0x000b664a4036e4ae,0x0000445c94fb3866}, {0x0002f2f238cf2986,0x00021b4e90bb798a,0x000759dfc01c3247,0x000a8f38f3e40df2,0x000029c89a29b62c}},
+{{0x000b9878e73666c5,0x00023af3878057fe,0x0003deaffcfacf47,0x0003543a3d2d9c0f,0x000043c258dc825a}, {0x000218ef737a150a,0x000d3c4eb5fba43d,0x000a675aafd8b90c,0x000a51c69580abdb,0x00000af04c893de7}, {0x0004f5cdc698fed2,0x000ff56d86369ac7,0x00048b0329e8e97d,0x0006bcfec040ad20,0x00003d56f36c5547}},
+{{0x000599bc36f7bea5,0x0006336f08a8c05d,0x000b4059b547dfd4,0x000467b8ad9c40a1,0x00007aa56c365978}, {0x0002492390bf4ca8,0x00019a16c2eaf1ab,0x00088fb337e9dbd0,0x0008d569561108d6,0x00003fe46cb74f44}, {0x0004704de6f4834f,0x0006225c6d771d53,0x00031e50a4ac7909,0x000d4263253b501d,0x000042fdb9014fb9}},
+{{0x0000c0bb4b17c37d,0x0003aead9ba94dc3,0x0003bf4171f92d8e,0x0000caf99dde2405,0x00000018c51cd117}, {0x000258efdab4eb18,0x0006e7e3c3a8073a,0x0008b4e8c112d3a4,0x0005f0ae3f34e9a5,0x000019122ceebb62}, {0x0005e1129dc87b7b,0x00015cf000f35608,0x00066c05550a2296,0x000c0d4b306467a2,0x0000057b8f648a95}},
+{{0x000c985ef74c6add,0x0000eb8d0e5ba175,0x000c6c0e0e62090f,0x0000a71cbaf07d56,0x000069590f15ef2f}, {0x000e50aeb74f4a44,0x000eacc09774bf22,0x00068c213513f9f1,0x000edfd2141239e3,0x00003df041ab3b6d}, {0x0002f638987e0f96,0x000526912d917f0b,0x000e822ce70a5787,0x00042db7aae02d4c,0x0000766ba4cc1b42}},
+{{0x0006ee72f7bd2e6b,0x000d6109abf4e790,0x000941a8a405d270,0x00042878d5cfe45b,0x000044c218671c97}, {0x000f9d56296bc318,0x000d4d8152e65745,0x000839e9ce993580,0x00021c0b0e5b13f5,0x000051fc2b28d439}, {0x000fd11795e2a98c,0x000e12b6b62911b8,0x000424b5721c4e5e,0x0004ac65b30e7107,0x00006e6b9de84c4f}},
+{{0x000314cccddb9362,0x00043e1130ed082f,0x000d0d5cafe303ef,0x000554bc87798603,0x00004cb304c95d78}, {0x0008590916f2cf65,0x000d14074da22b4f,0x000c96ee55514b2b,0x000c3b7a6fab777f,0x00003a8b20467a10}, {0x0002fac13646549e,0x000f00da40bf74d8,0x0000ab1383cebf34,0x000ea3690715649f,0x00004b1148e3e83c}},
+{{0x00003d04ab195c68,0x000c991917366d25,0x0005a81624ffe9da,0x000508bc231f60b3,0x000047d691dd9630}, {0x000a58c6d5c0b02d,0x0006d9500584c0a6,0x000954e85b7645b3,0x0004bc47f24711df,0x00000779cfaf7e36}, {0x0003ea5f13feb45a,0x000675bfb529bdd7,0x000210d547b6cb2e,0x000582e90c8ab12c,0x00005ac9afe1d91c}},
+{{0x0007c1c9c28d8db8,0x000b77456f5d5397,0x000710c95a7b43a9,0x0009207b41cbef70,0x000057d6c49e1ac2}, {0x000c34e290edb506,0x000bc9221f8ffcba,0x000f7da6c3c06009,0x000fd4c896cd9171,0x000038dcff1b4bde}, {0x000d214292b7ff7e,0x00065b78e6a44377,0x0003afce2b2b0abd,0x00095d0eb087ead4,0x00006708e91c332e}},
+{{0x000bb1cab5996816,0x00097e69b18c711e,0x000a01e1ba454dde,0x0001cd67011ea22f,0x0000043e2eefc698}, {0x0007c4dee9301422,0x000686ed01068460,0x000a79eb413f3343,0x00074f6c16e7e8b4,0x0000520fa6c42a20}, {0x00056f4b169474c7,0x00087911140622f9,0x0000d359c23ddb75,0x00045a7378d3e95d,0x00006b8c28314c59}},
+{{0x0000e43c23e4ea14,0x000fe7071fae39d5,0x00031a59c16a38df,0x000490b584232f1b,0x00003aa9356ff59a}, {0x000bade4d1f84492,0x00025bdb36fa26af,0x000627f7c028ee08,0x000e5fd658977ca2,0x000044db03b3f990}, {0x0008c7edf3a6014d,0x000ad3f54a483a1d,0x00014f2f83ee1207,0x000090145922aa68,0x000040296e07e181}},
+{{0x0008554ca3f30451,0x00035df1ece7a6ba,0x000a80f58e079d12,0x000fcb748b9a3a00,0x00003c96329ad5e0}, {0x000ed3106899f4c3,0x000bc67314c47f58,0x0009dea521b18601,0x0001ee23e131c8da,0x00006e9ff361f62a}, {0x000b1180526bd78f,0x000a78d9ee5946a0,0x000acf73f2f070bc,0x000427dc9d966bec,0x0000479c13177a4d}},
+{{0x000b377ff890c452,0x000ef22b084366cd,0x000668b9d159a936,0x000793870fd17bd1,0x00005af8b52f4d2d}, {0x0003be1f649b1415,0x00009094dc85b630,0x000ade7ea6d8e37c,0x0007bb8e988a8c6d,0x000010d82115883f}, {0x000a396841445aea,0x0009b914b306bb32,0x000b3572f198046b,0x0006419176ccfe76,0x00002fd1ea763ff3}},
+{{0x000ea535d198eb58,0x00068863e1be3b1b,0x0001193bbc1cb036,0x000bc69580fd74a9,0x000071e99ab52400}, {0x000e11f5ca6957bf,0x000e8e48757aafc5,0x0004f351adbb735d,0x000209175e827025,0x00001e6c5ff840bf}, {0x000656a080de210d,0x0001331453155b16,0x0009fbf01b457509,0x0000507268b2ef2b,0x00007756230e8ac6}},
+{{0x000f327da58f809a,0x00032142d44f47ac,0x000cff3b3b256065,0x0002f825fd9a1fff,0x000040039a3017d7}, {0x000a7b8b5a1b9c2d,0x0004d332dec294eb,0x00046e7da11a393d,0x000e8e03b88fda71,0x00000af67c0cbd64}, {0x000b1ff8e63ec9b5,0x00025faf069f9da9,0x00099df56c2ec6ec,0x0007ad2c6054f4e8,0x00003754fa7bd662}},
+{{0x00077370f8649bf6,0x00051788bf00b667,0x0009020c38774f14,0x0005f3651696f3ea,0x00001e1d1529ed6e}, {0x00076519f6d5bafb,0x000ee08d862b5c19,0x0000dbb6e5186c10,0x000a8a7b751daa26,0x000023405ceeb719}, {0x000d0712d8ec5f6e,0x000b5c5c78e088bf,0x0005b7f8245c0eda,0x00041781a9b03fde,0x000002927305e32f}},
+{{0x000eddf5d7025e2e,0x000eac16658215fd,0x0006b8e2c8972acf,0x000fad20393fbdae,0x000023aa24a06f2a}, {0x0000837309fe195b,0x000ec51b66ff44a7,0x000ecded13f06b9e,0x000616717f26025a,0x00007d534f90c0e5}, {0x000d52cd39714435,0x0005b77176cd4aa5,0x0008388a2d93ef36,0x000c63455be8b235,0x00004d481de5a98c}},
+{{0x00068da341aed55e,0x0005975bfd7f1324,0x000f5e908504020f,0x000f9712eca91c02,0x0000372f2c8edd7c}, {0x000f9db127e66454,0x0009b6aa2245e32b,0x00067986bb347e73,0x000b0ea6bd6a2ad0,0x00006318ab2c67ea}, {0x0000d6aaef2e3493,0x0006446086330f4f,0x00055f8650051f6b,0x000b6c32fc439edd,0x00000d9afbb3df97}},
+{{0x00081e807cf48673,0x00023f4f76c75d9c,0x0001412dfc5f6aad,0x000dc9795427c8bc,0x00000d898b28a700}, {0x000c14077679d14c,0x0003b09272880220,0x000e6f8ecce33b74,0x0009863831141bb5,0x00001330ac03d16b}, {0x000e3ef99e41784e,0x0006e7bf8da39817,0x000abf94eb3e8024,0x000eaba883f78406,0x0000221a77ae91f9}},
+{{0x000b6470330f2ca6,0x0006f04a992001b7,0x000c2da0626ee206,0x000d379c79cb0fe3,0x0000382153aaec9d}, {0x0003030f9284d1ed,0x0002c28078df3e8f,0x000629f5da0cb836,0x0005416f0064752d,0x00003840361bb223}, {0x00071d47caed179a,0x000a706ad41afde2,0x000313205c4c5dcd,0x000b553f4706af4b,0x00004cbc9759068b}},
+{{0x000708ddb695f9df,0x0008e7096fa6373f,0x000d778160568e42,0x000c3d1e8f728a7f,0x000017e071c9bf1a}, {0x0002a6ac34d56136,0x000a5581ab77ce09,0x0002e3d06b45869e,0x000c324f21836044,0x00000890b2114de1}, {0x00006bcfe3a41548,0x000cb5e4ec23aa93,0x00015075c2bf3a31,0x000e1773a70f9056,0x000050b821ed2fb1}},
+{{0x00025fce4b1de151,0x000c7e11c4025dff,0x0004749c87d841c0,0x0000df92554b3c85,0x00002d292459908e}, {0x000c5f10f80cb088,0x000dc56e421516b7,0x0006ef99c4736b54,0x0006f42c2b620a5c,0x00005f4c802cc3a0}, {0x0005c8f17d0752da,0x00038c77ee8009b6,0x000b62f9e3881ce3,0x0000d48c3b514f05,0x000066ed5dd5bec1}},
+},
+{ /* slot=17 [{1,2,3,..,32} * 64^(2*17)] * G) */
+{{0x0000a50a4ffb81ef,0x000093bf420bf3f5,0x0006aa2cd0b1e035,0x0007a409baa8e1cc,0x000032239861fa23}, {0x00035ac2004a35d1,0x000433a6607c3fb7,0x000528d59931de0f,0x000050c7b8591bfc,0x000055be9a25f5bb}, {0x00005acd33db3dbf,0x0007c80ac35e20d0,0x000f88ebeb0111b3,0x000fbcd4892d66c6,0x0000770eadb16508}},
+{{0x0001f9e05e4e89dd,0x000ffbc793937845,0x0006a6495cc06302,0x00003fb5d2274955,0x000009a6755ca056}, {0x0003b681a05071b9,0x0009a3592ff3af1d,0x000881e40e220765,0x000374e5f0169297,0x000016bedd0e86ba}, {0x000ccc4f2c2737b5,0x0000c2dccb7035ec,0x000ec43df343b79e,0x00066c033e008bc4,0x000006c1b840f075}},
+{{0x0008a5c6a388f877,0x00014deb2b6ac768,0x000b8c2af802a96c,0x000eed664c9f3431,0x00003628435554a1}, {0x000e9e7f9b02805c,0x0008a547d164069e,0x0002430968cbff82,0x00069723d93a869b,0x000046b7b8cd3fe2}, {0x00012086fe7eebe0,0x000e72f515437e98,0x00016efae94cba6b,0x0002cb91d04168b5,0x00005ea139104398}},
+{{0x00025c9cf4702ee1,0x0001f8b25b32d491,0x00001fef7e4520b7,0x000eb2b331930265,0x0000656d8997c8d2}, {0x000b3be4d5d3b002,0x000d96a09c8806f2,0x0008bcc4ccafec33,0x000198b035f73a4a,0x000022c5b9284662}, {0x0008c8fe433d8939,0x0002e6a8d7e50cb5,0x0009fbbe5a89a0cb,0x000c10679ca95530,0x00000c626616cd7f}},
+{{0x000eb80a4879b61f,0x0006e4ada21ed1ff,0x00068025ba639672,0x000178833c7b0933,0x0000471aa0c6f3c3}, {0x000fc379fbf454b1,0x00070f1a4b7718fd,0x000ad3591545a5a9,0x0002192ac921ef7b,0x000042d088dca81c}, {0x000a0f37a0165199,0x00077c8a0e3438fd,0x000875e8200adadb,0x00006e720fbfdfcc,0x00001cf2bea80c22}},
+{{0x000df1deb36202ac,0x00009d2e27aa5c2d,0x000c09f1d392a5fe,0x00049597d1648f6f,0x000074c2cc0513bc}, {0x000d6e1a02c0412f,0x00083db58e8fe982,0x000cb18bc090fa4c,0x000bc6601c2f5bcd,0x0000686e0c90216a}, {0x000dbadba54395a7,0x000a0ae0da66a1fa,0x000ba37c07b41a02,0x000430dbf19f598b,0x00006a12b8acde48}},
+{{0x000aea1f39d495d9,0x0000e525f1dfcf8d,0x0009991d1b592c19,0x0000cb7db8cbd04c,0x000011f7fda3d88f}, {0x000bdd801aaeeb5f,0x000aac1518871793,0x000f2136b400a2a0,0x000ef19e8a373a31,0x000048aab888fc91}, {0x000f7e925830f40e,0x000a979661c06041,0x000b046a2e002d6c,0x00093d186dc9ff92,0x0000760360928b04}},
+{{0x000b41c6120cf9c6,0x00012decda59b21b,0x000aa48b34eab2aa,0x0003b68c1a72d020,0x0000215d4d27e87d}, {0x000108e5695a0b05,0x000e8ad37a38bb43,0x00035373816cb00e,0x00032245edad6eea,0x00003f2602d4b6dc}, {0x000247b65bcaf19c,0x000c3b1b2c652c8b,0x0005ece2e249779d,0x000e03989a180bbd,0x000013f098a3cec8}},
+{{0x0001ff8d68c5d02f,0x000b4b3d3aff7120,0x000c1e32209aa888,0x000667fbcee2dd62,0x00007232fab9d063}, {0x0008441853ee6183,0x000edb6275e2a23f,0x0005e99e9e31964f,0x0001fbc745ba438e,0x000079e728206c65}, {0x0009a901c90ab5bf,0x00070201e568ac06,0x00043d777b7bc620,0x000249e8ab00b18e,0x0000434654348a32}},
+{{0x0009b17bc3f52f3a,0x000fb918f60264fb,0x00035f632d6b5617,0x0000c321a41040f5,0x00001ff0ae309211}, {0x000cf8f8f5b73529,0x0002da7b519a26f3,0x000e8f41e3b27604,0x000a2245a3e45720,0x000042deb1ada997}, {0x0001128ba734d87d,0x00085eb3bacdea68,0x00040bd1371aee25,0x0004e5d783c90791,0x00004e5bf1fff2fe}},
+{{0x0003503a672baccb,0x000e5959e1dbb04e,0x000d891b4c4a847e,0x000d6837c7444f7d,0x00006a960eeebf78}, {0x000ce5d50bf65fe7,0x0005c0ca22dce97f,0x0008874cda95273d,0x000c6006279cbd25,0x000058aacc3ad372}, {0x000303191b9fecbc,0x0006ad1f23fcd164,0x000cfc3caf1dacaf,0x00077548ac472d1c,0x00006b48419c3879}},
+{{0x0001b21aa6dda3fe,0x0009c35bdeef9476,0x00001b8effc7343d,0x000219d1c53779e6,0x000068cfe05f6b32}, {0x000ff851daf765a0,0x0005ca68119c8150,0x0009b2fb7f808146,0x000c559bc41e757e,0x000075f11a72e696}, {0x0003bb5b87894349,0x0004893ebe79c434,0x000b3ccae872dbf2,0x00049242409c2f4c,0x00005a3a9a33834d}},
+{{0x000a64f52878cb52,0x000f57d30b3d0024,0x0007479385b2a6a1,0x000e8935f9af2c27,0x00007d715f746696}, {0x000ffc48badd41bb,0x0004f1307bb3d5c0,0x00020db6a898b9fc,0x000bbf0639c58aff,0x00005a626634d394}, {0x000a8a44c117c91b,0x000b96bda86541fe,0x000796abcd9a5340,0x000dd4f63eb5275f,0x00001c98a6c11d8c}},
+{{0x000df4fbe5643b11,0x0004d0bcc312257c,0x0004731200f56939,0x000a4191134a2156,0x00000d3c7524b679}, {0x0006b31e196f84ab,0x000268f7018a91a0,0x000f61142bc5ecad,0x0007a88d5316edf0,0x00000ff7104f87f6}, {0x0000ca51f966b604,0x0007577c2a51a267,0x000650fb38b6ddf5,0x0005e6f292318fb4,0x00005a40684d6afa}},
+{{0x000bbed12b9c381e,0x0005aa4bdbc56b2d,0x000b9e2df51a90e9,0x000cf4ec744ff264,0x000053fdaf135a10}, {0x000c7c550a2342c3,0x0004a39deeb475c2,0x00010959d6732ad6,0x0000e6e5432c1e93,0x00002c765d6fb8ab}, {0x0007c486355248d1,0x000f61fc523ce132,0x000e22b2f5946ed3,0x000a3fb7745f0ff2,0x0000014e01e6f41d}},
+{{0x000c0ff9ce5ec54b,0x0006b8c2f130d9ad,0x0000f89515039c2a,0x000b36b028007c7f,0x000078968314ac04}, {0x000a57a22796bb14,0x000b79b07da21f3a,0x0001a0391c883aba,0x00005f9e54be2183,0x00005ee7fb38d832}, {0x000dfdcb41446a8e,0x000a9434937f9538,0x00063c8c78a5acfd,0x0000d0946af908d2,0x000061d0633c9bca}},
+{{0x000e77b1570ee8dd,0x00033293e58377c1,0x00084afa7b61ecd8,0x00007a1fb9bdb0fd,0x000075e95e6616c9}, {0x000c80bc599aeeeb,0x000c69e867d7816a,0x000491e2e3451d9f,0x0004fe4b473eeb72,0x0000714329012c90}, {0x000b8306a7f56bf9,0x0006301c716f9393,0x00074d4c3e5b038f,0x0007aa07f307fbcf,0x00003ff7166f6c40}},
+{{0x000bc88e39eff6bb,0x000bdd49eb4518c7,0x0005f154f69c8a5e,0x0009a2e4ef15fd01,0x00002898ea28f000}, {0x0003ab3452340d6e,0x00059261f0bd23fd,0x00062ef6a0ad06e1,0x00076cdc2ac786d3,0x000068a43a26dcd5}, {0x0009d58b9b1d6228,0x000533c0d01334f9,0x000a317463dec60c,0x0009dae3faa1baee,0x000050553b3300c2}},
+{{0x000dc089d8af4657,0x00003c71073735df,0x0005c3332982f44a,0x000a7fab036b4bdf,0x00007578d8a1a005}, {0x0009d78babd73584,0x0002eeff9d64e4d4,0x00096bf504e821f0,0x00073cda4484dc1e,0x00003aee9491ded0}, {0x000e2ab212a6eb2e,0x0005411a79fe8cb9,0x000584bad55b0874,0x000176e39ff3a935,0x00007042d3f02bf7}},
+{{0x00041dd2d9177f8f,0x000a2941f2095343,0x0001b2a978003e41,0x00046f793a075736,0x0000303a58441b55}, {0x000f0a79f11adeb6,0x0007e36f22f6e1b6,0x00048671cd14ded2,0x0001f16d9abe1902,0x0000359b60439a10}, {0x0001dc25ea5e3f1b,0x000f5ad69c373fc7,0x0008ace54c15651d,0x00072626f390b609,0x0000287f5d0c71dd}},
+{{0x0002d56c690ee0cd,0x00053a2b0642d4b0,0x0002a79fb58071e0,0x0008685f65a3730e,0x00000e7ba15a4c95}, {0x000bcb3edcaf9049,0x000be37a6bdf10b8,0x0000c333818db343,0x0001bf6d5573ad5f,0x0000623ad4fa5725}, {0x0007c6b7559c5a59,0x000b2c62edfb8bd0,0x000bf203ebf81430,0x000a239320ec7d6a,0x00004d027c10f9c1}},
+{{0x000139b0992e99f6,0x00059b86ab793c23,0x0004a6e0f165ae6c,0x000ac9d89a17c140,0x00002785695369dd}, {0x000db4721dc36692,0x000f60fe99fef9b8,0x0003ce4a316c3066,0x000618fb50c9b5bf,0x00007b17f2bb279d}, {0x000e143939d4e368,0x000165dc9b80d0b3,0x000b4cf45aee5ae0,0x000f6c83017124f6,0x000077b9e03afe35}},
+{{0x000932a62b8008bc,0x000b1c479549cb7c,0x0009729a87553543,0x0005d431693a903f,0x0000330318a9380c}, {0x000627656f70a79d,0x00010ec5822c52df,0x00074ff7a9e494b3,0x0005846fbc73bfaf,0x00002a816a7cb6db}, {0x00037c24f826f0c2,0x000c335c83adc285,0x000ad13cd719d639,0x000116def3830921,0x00000914f5793822}},
+{{0x0006d2f834f92891,0x00042206f3b586ec,0x000469a01afc0851,0x000ee15a97cb08ac,0x0000279f656460e4}, {0x000068b67012f5b0,0x00026a9f5b14a1ac,0x00065ace7236fa1e,0x000066b3bbe19151,0x00000656ef87b5b4}, {0x000e1440cb54834b,0x00053032ffabd0e0,0x000e62be6cd45aea,0x00058adc051a3ae9,0x0000560efb8b510b}},
+{{0x0000cd406ebc4974,0x0007995a77abf408,0x000c370a941a9282,0x000d182bcb8c3b0e,0x00006f7e0bf723ef}, {0x000e064aaed35523,0x0002ca7187777e2e,0x000f42e8a6aefda4,0x00008161635941cf,0x000077fc550717aa}, {0x0005dd67d17905fd,0x0001228d36d9ed58,0x0003fef5def17528,0x000d5d2812377dd0,0x0000430d118ce8f5}},
+{{0x0006c5ad5f7d70d9,0x0001c2fb57a4b4f4,0x000f7b916c3836cc,0x00085f621de15989,0x000017d81a3fcd2c}, {0x000504ad0d309e2f,0x000efde018e05bc5,0x0006b859b982e9dc,0x0009ad89630456c1,0x000029851e63b40d}, {0x000f8976fbebb3ab,0x00090a8a6c0e478d,0x000057ceffd2ca9c,0x000fea139525ba46,0x000008b33f239392}},
+{{0x0005b9cec697bed9,0x000eca2fb991612a,0x0003d764f8b0c98f,0x000fc9239b9bf303,0x000076e0ee1499df}, {0x00071b584599e898,0x000b30848565113a,0x0007690005643e08,0x0004597d9b3ba9ef,0x000066de54817e6e}, {0x000f8cbb56942e56,0x000ac8e7c334e34f,0x000cd15321fbd0c6,0x000394fe522ae77c,0x00006103148c7764}},
+{{0x0008bdb2c25a154b,0x000689c26bb9afae,0x0005def701ff3448,0x00006f0b8701ddba,0x000055e9fcf1fcdd}, {0x0001eef62c755cbd,0x00058e22ce464694,0x000c510f4212cc8a,0x000b339f746e0446,0x0000016e3e6ecbd2}, {0x00045f055a073639,0x00011b1dba02256c,0x000c68fdfee6fa4f,0x0005f5b49aa6bf28,0x00006db0abbbbf8d}},
+{{0x00025064dc0c0765,0x00003a94c3a332b2,0x000e35411b3dccfe,0x0008bbf9c0295b68,0x0000786e6ff975c8}, {0x00001752d87a44f8,0x00098fa5e2d9da18,0x000a800f1b43a84f,0x000943395eb850a9,0x00001c30f3f940b7}, {0x000d22868f26352e,0x00050b9c74348833,0x0005baf64f3bb6d2,0x000dc79b3504a5da,0x0000547ebf1080ae}},
+{{0x000539a408530789,0x000b07b7c64db81c,0x0001a1a09277e108,0x000856adaf7c8825,0x00006b93c91fa4ae}, {0x0004b0cecb369653,0x000ebbf4eb26c61b,0x000a51211bce6e56,0x00017ed76b6949c6,0x000024f2e97afae4}, {0x0005dcf86f2c71bb,0x000810b2ac26a731,0x0003f6f842cee1d5,0x000e3a81ea4d9e39,0x0000276b2b9b2639}},
+{{0x000249d0d9bd27fe,0x000861b18e4c6007,0x000ce9277ba981b3,0x0006c71b8ec7c85d,0x000030088cda96cd}, {0x000f7f0db1790823,0x0004ec0ddec255ad,0x000d8eb3f4c28905,0x00086de59c9ee239,0x00006a656d4944e7}, {0x0006b5cbb5e5ab05,0x000af328b2b8cadd,0x000fd5fc686b8b1b,0x000e0dc1dc5eb010,0x000055752425f60d}},
+{{0x00044935ffdb2566,0x00089780b68bb637,0x00053eec03c5bd6b,0x000d7f56f1b32805,0x00006e965fd847ae}, {0x000328bcf8fc73df,0x0005da6f037fcada,0x0008c2a909ee8469,0x0007bdc637fb4db3,0x00005b23ac2df806}, {0x0002b953ee80527b,0x000aafade6d8d9ad,0x00050e82cfe88f19,0x000dedc0e7117041,0x000079b9bbb9dd95}},
+},
+{ /* slot=18 [{1,2,3,..,32} * 64^(2*18)] * G) */
+{{0x000d5a461e6bf9d6,0x000fc7777a581741,0x000474d3d92305b3,0x000e0ffd45574a26,0x00001926e1dc6401}, {0x00068549af3f666e,0x00004f14a0ea5db4,0x0004ba0c47d77fcf,0x0003c853df23ff7a,0x00003a10dfe132ce}, {0x000f4e8aea17cea0,0x000463a1fc1fde07,0x0001f2c0f12fd515,0x0005d15175322fd3,0x00001fa1d01d861e}},
+{{0x000055947d599832,0x000da37f15520cc8,0x000e0593201e4656,0x000cf3399f6f7744,0x0000773563bc6a75}, {0x000cac00d1df94ab,0x000ddd1080de938d,0x000dd5e2622e712b,0x00001e57f13e93ef,0x000073fced18ee9a}, {0x0001e90863139cb3,0x00067c5a03ecd06b,0x000d638932a493da,0x0004f448d77cec8a,0x00001f426b701b86}},
+{{0x0009264c41911c01,0x000b817a22c25efc,0x00030f1447f1a3b7,0x000b0905875da6bf,0x00004e1af5271d31}, {0x000e35c891a12552,0x00053575e9c76f17,0x000d9b723eb76b81,0x000e438fa83406f0,0x00000b76bb1b3fa7}, {0x0008c1f97f92939b,0x000cbd444ab6e08b,0x0009bb8017be6771,0x000a95522e564639,0x00007b6dd61eb772}},
+{{0x000dc1e850f33d92,0x0004f608cd5cfb7a,0x000dfc5bdb7998fa,0x0002f4fad962dbd8,0x0000703e9bceaf1d}, {0x0000abf9ab01d2c7,0x000dc40143b18573,0x0000cbb28116fb76,0x0006afe866cbe65a,0x000053fa9b659bff}, {0x0004c8e994885455,0x0006665aed4e56c1,0x000cd65af1843a5d,0x0001f50181bb73eb,0x0000398d93e5c4c6}},
+{{0x000bd16733e248f3,0x0008715bf0a5f1c4,0x00010b0376bd9e12,0x0001b13d43f8cf0a,0x000053b09b5ddf19}, {0x00077c60d2e7e3f2,0x000a030828bb1c38,0x00039ef1383b34aa,0x0000577283e26e77,0x0000699c9c9002c3}, {0x0006a7235946f1cc,0x000b5cce5d97df30,0x0001b4e975921718,0x000d90728cdd2478,0x000051caf30c6fcd}},
+{{0x000ba7427674e00a,0x00070a17a7bf3a60,0x000f3324cc630e85,0x000fdaa3758563dc,0x00005504aa292383}, {0x000af99a18ac54c7,0x000dcc51cb30f737,0x000ce10cc7903378,0x000e99a2b89bc334,0x000012ae29c189f8}, {0x000ec0cb1f0d01cf,0x000cc3a34f7aea99,0x00009c4e220dd1ef,0x000a5ea55ca7521d,0x00005fd14fe958eb}},
+{{0x000c2ddf2845ab2c,0x000b10a7fe993b5d,0x000002e346069491,0x00074d14daaf3d64,0x0000093ff26e5864}, {0x0002fe5ebf93cb8e,0x0005136d4565f3c4,0x00084220e8bedfa8,0x000d128e0f0859e8,0x00007dd73f960725}, {0x000d24fe68059829,0x00072dbaf23e5b10,0x000457ac29757306,0x00070a41367253ab,0x00002f59bcbc86b4}},
+{{0x00047d429917135f,0x0001f567d03d7838,0x000e77aad1ad1b91,0x000af4a7e7748d9b,0x00005458b42e2e51}, {0x0001d560b691c301,0x0003fadd7e71e704,0x000133558585201b,0x00028b116c2e1631,0x00002aa55e3d0108}, {0x000192e60c07444f,0x0002d74421d10ed5,0x000db5c86442c54e,0x0008664352b4c82f,0x000013e9004a8a76}},
+{{0x000aeb052170848a,0x000e1773c26377b5,0x0006e5b8d0bcd956,0x0005cea56b8d5734,0x00007f198fa27b01}, {0x000b92b64b6be1dc,0x000b06c9e73c17bd,0x000f1dc2af944044,0x000690ca2944741c,0x00006c2f248094d8}, {0x000c32883caccf44,0x000cea3dde579028,0x00069631aa6ae63d,0x00057f8da51082c3,0x00005b82ae38fc8d}},
+{{0x000abefb7374c18d,0x000852785dbe2ca8,0x000773e810abaa41,0x0001abd6c3c31aff,0x0000635a46d135e6}, {0x00035c6b3c4ae338,0x000cbfbc2e611c3b,0x000c117a423c3e01,0x0004b614d496d17e,0x00002ae1cbdcb304}, {0x000fc717d87ae74e,0x0005056f03cb7f01,0x0006f8a55eec7280,0x000eb4d4aaddfe33,0x00006aac7f33fc30}},
+{{0x000d496233d5d496,0x00042e2dd93ae0a5,0x000bb5119423a759,0x0003f2c85cd87e65,0x000023bbb2c0a869}, {0x0008622dd2d9fbc7,0x0000e2bbe892e051,0x000d5af95da6af89,0x0008bdd36bec5cd7,0x00007ef1d6e471de}, {0x000026635549cd30,0x000da25463a47822,0x0003a7db94eddab9,0x000d2e247d0165d1,0x000009822fb95389}},
+{{0x0000a2464739bbe8,0x000aacc5ac8402ae,0x000a9e48d618ad8e,0x000c425f0c90a639,0x0000094df25668cf}, {0x0006e41fb55fda3a,0x000ba8fdc8c3bc23,0x000e25d3504c1e8e,0x0004bfde872b2d01,0x00000d6c2ce9997a}, {0x000a652fa1e51844,0x00097d12ee353426,0x000d0a3300155e29,0x000a45927269730b,0x0000523275a29d47}},
+{{0x00090b9b272d5cb6,0x00027baab2fe11c0,0x00029d68dc2d1538,0x000185602cab6ec8,0x00002e89b864111a}, {0x000445eb4a484080,0x000801ff5cd047c0,0x000c8b4c9b63c3f9,0x000af2b3736bf9ed,0x00003b845d45c0c8}, {0x000d9f0668d60904,0x0004765a6d83e868,0x000301470cebd91f,0x00060ac2a2779ef7,0x00000f5a39cfb01c}},
+{{0x0003e0b85f6b7258,0x0007fba8d8faf089,0x000ee61ae4788db3,0x00073d7f025ff2a6,0x000053927c699c6c}, {0x000438f52398430e,0x0006607a287df65d,0x00099539495b3245,0x0007f50568be0f80,0x000031668598a350}, {0x00070a3cf9ac35eb,0x000c40b652db5a69,0x0007cfbc957014ff,0x000f86482bb86ff1,0x00006fdbc2a79763}},
+{{0x000c4668eb93b828,0x0006aab42d2d33cb,0x00063ac04bed621b,0x0006cbe003f6caca,0x00001bc5ba7ff2d2}, {0x000eeba9c40c3c7c,0x000bda8d5975bfe8,0x000e30059ed8221c,0x00046f163d7ecb32,0x000021f1ce26ab22}, {0x000cec7425064837,0x000b5be87d51dfd5,0x0007e39e7d25553d,0x000601f50af1aa78,0x00001ffdf55279df}},
+{{0x0005b5556c032bff,0x000b729297a3acbb,0x000ded81bbdf7191,0x00003f5c1ff7326a,0x000071ade8bb68be}, {0x000284c5806b467c,0x0007be75d607b1e6,0x000378d262c5f699,0x0008b708b67d958b,0x00003d88d66a81cd}, {0x00067a93204ed789,0x000cb9fa0ae2a8b7,0x000dce4887762fca,0x0005fb3771febcc6,0x0000343062158ff0}},
+{{0x00077996455e96d0,0x0000fa3cb4eee928,0x00081983971560dc,0x000dffce60882ef8,0x00007df87710632d}, {0x000e6c25bc8c10e5,0x0000404c68bba4d3,0x000cc54f7df10ae2,0x000e98d36d1a1f93,0x0000672990ed714c}, {0x000c59783ec3eaf1,0x0000084eea1c6e7f,0x0000675de9d29802,0x000bf084219a84d5,0x000073604f2c9326}},
+{{0x00071f9fb411ec26,0x00045b252655b8fb,0x000624a9cb3049e4,0x000dbe5410376861,0x00007df3cb182196}, {0x000ba616aa7a2330,0x00027c76ee3f64d6,0x0000d0315e9a4aeb,0x000ac517d892932a,0x00002d1389811f75}, {0x000784c2e710d8bd,0x000232fe7077aac9,0x000e3688c5f81303,0x0008c14e0b90c0f4,0x000054c411f16547}},
+{{0x000f79864bf6495b,0x000f8e4de40104d4,0x00022208e505e900,0x0006aaf8dd6c7429,0x000038806953c0cf}, {0x000fec7707529a8a,0x000c2c9542513453,0x0001c24470bde9a1,0x00064e9c80afe48a,0x000074f89b8d3630}, {0x0001a1127f156098,0x00085cfe784118cd,0x000eab94a7f2611e,0x000fc673810d2390,0x000053b259ee3bc1}},
+{{0x000b5a1925c68152,0x0004d40ef6925ba3,0x000adf5a13cb3f01,0x000d5ab6d8606107,0x000058754820a686}, {0x00095a9754326a5b,0x0008c587387c5f01,0x0001e774ac6deff6,0x0009ff48031e687e,0x000064a7d3054b22}, {0x0002d1fb45fd9d6b,0x0000caa8c513dce1,0x000866a7903b86de,0x0008ec8a8fd9498c,0x000048d697d62a78}},
+{{0x00032b830425c286,0x0000d233c662ec27,0x000025c072055898,0x0008d6faf11a81ba,0x00005922b82a0fb9}, {0x00040417f7b3d874,0x00047256bae78771,0x000958a6190b332c,0x00073e8fe0f97642,0x0000660e4a3c690a}, {0x000b8ae272697201,0x0003d55892cdcab3,0x000d62c7aea2521e,0x0009fc2a6affedc1,0x000026b9020ad9df}},
+{{0x0008207f0c7c2853,0x000c9af6379dc14c,0x000867aba50b2bb9,0x000d741d74d4079b,0x00002561c6bed402}, {0x000a11d2de1dba6e,0x000c19363bead16a,0x00048d70e70907aa,0x0008829536d8e811,0x0000761a3998a564}, {0x0003c1fd1a656d33,0x000a5e88aeaad0f5,0x000f2cd20173a25f,0x000c1d32e2a0db5f,0x00004d1b26b703e6}},
+{{0x0008b2b5e8dec660,0x0001540a75fff0c4,0x0000a9927ff19446,0x000e28d541c79d7c,0x00005c408c0b9f42}, {0x000fe12826d588ab,0x0000600394caf599,0x0001123d9f4afacd,0x0006d6fccc321431,0x0000638b7bf2ea73}, {0x0000c3d36de716de,0x000608fb06d34b97,0x0003c31433b533de,0x000084ebc3f44482,0x000072efe0f73610}},
+{{0x0006facad6847cfd,0x000bea0c81d48bd6,0x0006aede42603a6c,0x000c0b5c5a90c910,0x0000725e3ba2d22c}, {0x000ba0c701fec44a,0x000cc15d50f94e80,0x0008cf3b5bd70718,0x000ca6a69d9a23b2,0x00005d780e20b2b5}, {0x0001e9c9203249a9,0x00072220ccdea676,0x00085878bbda82b8,0x0001a33ed4058cc0,0x00007bbb43e0f940}},
+{{0x00053d19a5f16ffb,0x000db0565403de81,0x00071c94e55baaf9,0x000b3e7590b0f4f5,0x000079ce8479465f}, {0x000a7a00c5ced1d7,0x000d593cde486069,0x000454ef1aa6e6bd,0x000ea3f52abeca53,0x00005b0189d0117a}, {0x0003d6a8546173cd,0x00060eaf5e89121b,0x000911c7c141f13b,0x0003cc7778a5b5eb,0x00005457964dcbbc}},
+{{0x000dbe6cd087f6ea,0x000eff785ec7f3af,0x0004282919de6555,0x0003a1439303918f,0x000001b272e64715}, {0x000b82d67407ce61,0x000772831ed49c3b,0x000aecd31a93a5dc,0x000981a37e388537,0x000077a063db82f1}, {0x000ce3115d9a6d4a,0x000b4a4ef67c4a5e,0x0004dee683bc485a,0x00061fbd9022b781,0x00001d40b3761944}},
+{{0x0006844beb90c05b,0x000d0b86edea2070,0x000157c8dd47d484,0x0000e876ee675fc8,0x00002677c812f15c}, {0x000925fec838bb4d,0x0000c8e64da865a3,0x000b39ce33f248d2,0x000fd057d53bee8b,0x0000587b97a2cf8c}, {0x000ca367fb531b76,0x00042f0f20a1c44e,0x0003e4d844f43b95,0x00090fe087349d7f,0x00001a37e87544c5}},
+{{0x0001d2c135ed5056,0x000d0e80b200113f,0x0000e37d5c053820,0x0006fc8649041c36,0x000033d447b742de}, {0x000d2f4eeabc2009,0x00064fa90cc48a37,0x0008fe673eaf1f9f,0x0004c1ecc6eb4b4b,0x00005829251fdad7}, {0x000be69f69f69777,0x000b07fcebfb2713,0x00037af36550130a,0x000cbdb4e5c665bf,0x0000708b139273ed}},
+{{0x000db71160f60e97,0x0000cbfd6832c6c9,0x00060d30da88a213,0x00046a00534a4c7d,0x00006f97095b8f05}, {0x000409d8e428eae1,0x000b072473f12417,0x000992b90b3646d9,0x000d1952d829e26a,0x00005019095d9021}, {0x000db3f1b4577569,0x0000283819e4f78f,0x00049945f6526611,0x000ceae5f0697a05,0x00006f8bb28dd7e4}},
+{{0x0007d8b92cdf4136,0x00061c4a76421be8,0x000d5e916749f09f,0x00080899ffe27b1f,0x0000396b73cfa74d}, {0x00068b639f942686,0x00098fc03766e2f2,0x0009d449c1ee33b3,0x00056bc7172c054c,0x0000653321064d7d}, {0x000e1ec44d4bd7ab,0x0001dd91ff90e494,0x000aff4c9af5fb27,0x0000130121ed6ba8,0x000053c2293502c0}},
+{{0x000ccb5161c09739,0x0007c6719422ceb9,0x00048e5e37917a58,0x0008887c9a0993a0,0x000067f39575a732}, {0x000f0f7b33157bef,0x0007698f58d28709,0x000b7727e5ac93c2,0x0004f672a574f7f0,0x00003755a8eeb3c6}, {0x0009a2ed29cb5f6d,0x0002c8b4f7d4ceac,0x000cb5df11e46db1,0x000cbfb6227d8a18,0x0000372289213e4f}},
+{{0x000da1a7e1f5bf49,0x0006dd4736092e05,0x0003cc32f626457d,0x0005fcd77dcb0777,0x00000a5d94969cdd}, {0x000219072a7b31b4,0x00075aa578016fce,0x00074793244d7adc,0x0004beb0ec276a68,0x00006d6d9d5d1fda}, {0x0001a58ae9b08183,0x00071c15c388b22b,0x00050a0517fd95d0,0x000335ea98123768,0x000033384cbabb7f}},
+},
+{ /* slot=19 [{1,2,3,..,32} * 64^(2*19)] * G) */
+{{0x000cd756b637ff2d,0x0008fc987f0c4e9d,0x0003fbc7b7ec4c34,0x000ea87ced59285f,0x00003305354793e1}, {0x00018980c5fe9f94,0x00069716fd5c801c,0x000195a086cd6567,0x0007982816045c3d,0x00006e2b7f3266cc}, {0x00002468f7c3568f,0x0008219974cb3cc8,0x0005b813609de9ba,0x000ba62abb7229cb,0x000044e2017a6fbe}},
+{{0x0002a74354dab774,0x0003c4eaf031ac4c,0x0002838f178e5d4c,0x000e4eab76c23d24,0x0000749a098f68dc}, {0x00082cf3b6ca6ecd,0x0003e18f4a0c287f,0x000604e557580f89,0x0009c1d058930072,0x00006cab6ac256d1}, {0x000fe0a02cc1de60,0x000ff51c5575bdcd,0x00073abeeb032665,0x00086062c0c32f10,0x00006a882014cd7b}},
+{{0x000a92fea4747fb5,0x000491fa5ab89a52,0x000847a4cedc12a4,0x000cc4ed82da94bb,0x00004d77edce9512}, {0x0001d17caf4feb6e,0x00042b33aa4a3d11,0x000eb46c30050bba,0x0007d7517514c3ce,0x000054bedb8b1bc2}, {0x0008e14577e2189c,0x0006aff99c44577c,0x000d335343a3e46f,0x00016a93144dfc86,0x00003a96559e7c42}},
+{{0x00050d37f42ad2ee,0x0000498a1fbf5125,0x0003894cb28b78e0,0x0008d0c5d5307823,0x000002c84e4e3e49}, {0x0003896880baaa52,0x000c4f285940e449,0x00045448b64c98af,0x000ae7fef4aa79ba,0x00005278c510a57a}, {0x000dd074294c0b94,0x000b8df18ffb6a54,0x000dae8366f55d46,0x000d165f06fecc58,0x0000588657668190}},
+{{0x000712311aef7117,0x00001229e92c7d47,0x000d159b97503431,0x00029c97a95e1849,0x00002449959b8b5d}, {0x000834f03de25cc3,0x000aed6815496bf5,0x000481e892b887c8,0x0003f935105221a9,0x00006760ed19f772}, {0x000ba3b7ac35e160,0x0003fba842056669,0x0000804f072eccf7,0x000f4e71aec1f17c,0x00000d96bc031856}},
+{{0x0008be7775c52d82,0x000b554d0aab9331,0x000c773d914cb764,0x000288aabcf3d27c,0x00003bf4d1848123}, {0x000534b0cc7505e1,0x0003416c35288b1d,0x000762c29d32cd00,0x0000bf8cb36a5800,0x00005bfe69b9237a}, {0x000eab7e78a151ab,0x000c999093763183,0x000ac7e335bbe990,0x0009f88ff717d6e4,0x00004c5cddb325f3}},
+{{0x0006b74d6190a6eb,0x000a42db8f4e4c0f,0x000731576020ea81,0x0007c21a8bd6f7d9,0x000033b1d60262ac}, {0x00050967e7a9f902,0x000fc4f5b467e577,0x000177ba462c37fd,0x000532bb261663a3,0x00003a375e78dc2d}, {0x0001e72f2d4dddea,0x0009862c607c8814,0x00073cafd0e6eafe,0x000734623c284585,0x000046b9476f4ff9}},
+{{0x000ffea44f901e5c,0x000b72184b7820c1,0x000114db882b0b6f,0x000a142e587ff910,0x000037130f364785}, {0x0005505c0d58359f,0x000c7fc28c46b121,0x0009ea664e2a2013,0x0000e1f24a0a1af8,0x00004400b638a113}, {0x0001b76496ed19c3,0x000b0ed3272303a0,0x0003ca15b131e00a,0x000bec7520a88578,0x000006aab9875acc}},
+{{0x0003969e911dc419,0x000e3b8d130b7a5c,0x0007519c7bea7655,0x000c5e62a6fcc4c9,0x000039f07d050b79}, {0x000fd50631176d79,0x000ba0f2e0cf32ed,0x0000275de5daca49,0x000ca0ff3cebcb5d,0x000016818e0f604d}, {0x00017b43fee41a30,0x000d73237411c843,0x0002492362ca8133,0x000b7f65a5aa6f8f,0x0000389406137add}},
+{{0x000c22809be69ba9,0x000c242140c0ab5d,0x000f7f501d4b8bb0,0x000f4bbb446a9ffc,0x000054f432b9e0dc}, {0x000de071ca9af477,0x00084e9a64a449a7,0x000de1aff4ad08f5,0x00032e31012ba121,0x00003e7d3d226ca9}, {0x000e3e0fc093d88b,0x00043443ed3cb92e,0x000354c474ab88a2,0x0009c4f3279eef51,0x0000084c85629add}},
+{{0x000550663fa2dd5d,0x00061e3a84248076,0x000aa7a28381a62d,0x000c48d05e6bee36,0x00003e2df83eaecf}, {0x000adeece0b9ffbe,0x0002eaba60987ed2,0x000591425262a94c,0x0004b81c9aefe30d,0x000028e281f0480f}, {0x0001399465ad7b71,0x000556750029f432,0x000ee836c3d42175,0x000665efd1e73cd1,0x0000198e16f0794f}},
+{{0x0001e53d33e0c7a9,0x000bab2f154bc0da,0x0001e7409ea09748,0x0007685202b09294,0x000035f1382dfb77}, {0x000d5aae407cb59e,0x000007591de795cd,0x000ea5099c2c8de2,0x0008fa8581a3530c,0x00005d46138d81c7}, {0x00063a66dd75ce87,0x000ae6773b0c2ae8,0x000a94d9fe7952b5,0x000d1cf9f420e3b8,0x000040edb7b67eb1}},
+{{0x000d08ea6f227d54,0x000fb241e03347c6,0x00013059ba1d1a37,0x000f540afd86d4b4,0x00001b04c5417519}, {0x000b8a40cae0ed36,0x000273c365d45dd9,0x000b972784e24b9a,0x000692c2e477fecd,0x0000176a42a34211}, {0x0003117a0e33783e,0x0002b809a022d811,0x00058429d864cf42,0x0007062a544f298e,0x000006fb42910bf0}},
+{{0x0003a80feec1180f,0x00042537232614c6,0x00068b6771071913,0x0006a0acb4ee2ccd,0x000043dbae002573}, {0x000a0d16509b48f2,0x0002051aa48d6d0b,0x000c48507d05cf51,0x000232b9a156dcb2,0x00007b011ab4f4f9}, {0x000760b48fa15740,0x00061ed3530f3753,0x00072d67334f7954,0x000eaab29d8ef8f9,0x000004f32c857f26}},
+{{0x00082fae703ce1a9,0x000a2959bd6b76de,0x000165267acf5e0e,0x000ac9dcf5ab5329,0x00000fafdc3172c2}, {0x000f9c41c4765676,0x000d4d31b9e2f459,0x000a69f1a6157e14,0x0007fa7a50141207,0x00007ba9f136be78}, {0x000b2fea0d9c84ad,0x0008cf52a1e6db5e,0x0004c48a2b96d107,0x000d23ffe4f93535,0x00005ff955dc3432}},
+{{0x00039983f5df0ebb,0x0008f512c4cacc13,0x000bb398e1c0f375,0x0000c622cf1130a0,0x00006b3cecf9aa27}, {0x0009acf3512eeaef,0x000d31cc1cb49534,0x00099a688d20c141,0x0002d1724180c07a,0x0000555ef9d1c64b}, {0x000770ba3b73bd08,0x00008a3afbf0c36a,0x00040946f2624aef,0x000749d5737ff98b,0x0000675f4de13381}},
+{{0x000962dbfb636ecf,0x000d946a24eca17c,0x000b2a45ecd109b6,0x000b92a9aaf2300f,0x000044e97626d0b4}, {0x00017ba45a4ca1bd,0x0001c4ddde290781,0x000c11ec5a1d317e,0x000c5719d51d8a06,0x0000356640ae8876}, {0x00007a1719efa777,0x000692b0ac1199d8,0x000df4e62c2f2888,0x00012d3c341576e7,0x000043758bca6e99}},
+{{0x0006d137440585bd,0x000b2fb19c051257,0x000135b07c1a66d2,0x0001236b7569bdd0,0x000002797fd18662}, {0x000430afce47c779,0x0009108c3bb84ea7,0x00055822bce8c1bb,0x000403a02c6d09f3,0x00006b8cd7ad690f}, {0x00035ed13e3fb4a5,0x000b8173cd4500ce,0x0007c64723674201,0x000918f80f98d719,0x0000098f40e1ade4}},
+{{0x0006c19155d8d5d2,0x00050205700be2dc,0x00034cf4fb54b27b,0x0005ac7c243bcbb6,0x00000b2e1b18fc09}, {0x000007dd05f014f9,0x000b2f34542cc1aa,0x000805b0c97292e7,0x000d9d37caa94bc7,0x00007fd28b21db83}, {0x000bd270188a7235,0x00081ac426d3856c,0x00001cef4a207ae7,0x00020bfa3cbbfcfb,0x00004bac88923356}},
+{{0x0001893bb2d75496,0x00001212c93e8866,0x0000320b1dd1dc5c,0x000c6459cfce6b7d,0x000047120a214c9d}, {0x0004142c4f290f40,0x000bc9ccf0cf5160,0x00031c500755d6d7,0x000b7a0e10c7574b,0x0000409795532a84}, {0x0004a6574218a7c5,0x000e92f280c0f036,0x0008fa7b5f67970b,0x000aaa343e2c1dcb,0x000009a7ad5aca55}},
+{{0x0009f5d94fe710ec,0x000c3d7b43ec6a40,0x000fd0678950f1be,0x000e764241ddf0b2,0x000040720f74aaab}, {0x00099c4aca7f90b3,0x00085bc5876a166a,0x000a2c7358f654da,0x0006267ea5b11331,0x00000c3d3efa04ce}, {0x000665c85a904cb9,0x0009542976ae088f,0x000554bcb93166fe,0x0009cdcdd9b6a5ed,0x000024f9b35e96e8}},
+{{0x00033a8110217bb5,0x0003887bddb75c3f,0x000a2eac112556ad,0x000bf7de771c2a47,0x00005e6af51a72b7}, {0x000df0dcbf3d2554,0x0000ef6701dff477,0x0000739bc197a2be,0x000db3ae40e89205,0x00006a342ba84085}, {0x000078fec7d12b4f,0x00021b2b718c2c1b,0x000da208d61fe3f2,0x0006a9da76f27f07,0x00004713504248f8}},
+{{0x0006a239d3b69b3e,0x0006b5c2c757584a,0x00090091df848ea0,0x0004726ef2b94356,0x00000a723aac139d}, {0x000b1b5822c8a7c7,0x00098a4dd3ca44b1,0x000cb88587b1542b,0x0002c2b2351740bb,0x000006b4b12d9264}, {0x0007f039c8a1ae67,0x0003467f2ecb76b0,0x0009248d4ffc8a04,0x000985fef14a0c99,0x00007c45d2f40a2f}},
+{{0x00055046b6c13a80,0x00001a0ec43b9757,0x00054a0849cc552f,0x000c065bf8f4b518,0x000036d45bec9a8c}, {0x0008cd8c9f2475bf,0x000111628f704e87,0x0004d5dffa7d3eab,0x00068031d78edccc,0x000051e6b17b3a4b}, {0x0008703f86556c2e,0x000783bf8cebc6f5,0x000d32aa73663b93,0x00093dd8bfa513cf,0x000052e4a38e699b}},
+{{0x000a911d6eb0f114,0x000d47bdcbbe94e4,0x000259bf2ebfa23b,0x000630698e05d171,0x00006ad84014d817}, {0x000d10f164b46649,0x0005737cadc23c1f,0x00007270e4f73d95,0x000a08db11c7200a,0x00004b0c0600e9fa}, {0x000087fe4a2367f7,0x00017ce1e07f1dcf,0x00011a38fcc6beab,0x00055859601052cd,0x000049040031f60e}},
+{{0x000595261d1f5264,0x000760eed6cda43c,0x0007823df2b74689,0x000d5be0890f2ba4,0x000005d610568baf}, {0x000a354bb5ec46bd,0x000e9c4848571677,0x000f733c18bbe82c,0x000db0e40feeae74,0x00007b8d231fd067}, {0x000d3b890a0d9ddb,0x0001ba994878be84,0x0000635b10f8034a,0x00045ffc8df9b09c,0x000008e4170048f0}},
+{{0x0002b2f705c5d513,0x0000b31026cbcdec,0x0004924b9d82069d,0x0000a7043e0240be,0x00005aa3fc5c3f17}, {0x000f8af16b8a8958,0x00003458b7caf776,0x0005414ff621d799,0x0004fa03f21ee2d6,0x00005b86e8586b84}, {0x000b6389a62c4d43,0x00042b41d024de51,0x0008543d64089b2d,0x000c904a6f98e4e9,0x000070095f90bb1b}},
+{{0x0004302ef3bda4af,0x000d280f040a5bde,0x000376e307997454,0x000b193d5e383b0e,0x00000f1ac574ecb7}, {0x00075aa19726e27e,0x000a52d66f5fd30e,0x000a044ea3acce4a,0x0006425a342467e4,0x000053bfa50df3c3}, {0x0000a9fab2929430,0x00093084a6d3051c,0x000f8e23537a29c6,0x000da51eb2fa1eee,0x00002ec0bb1ba585}},
+{{0x0000972f788dfd2c,0x00084b36782f1739,0x000af6c68d524249,0x0001bf95bb9c9e2e,0x00007061e6e8978f}, {0x0008a5ca605506d5,0x000f7034dce6bff7,0x000c433aa1218e5e,0x000931292e92aed8,0x00007a9fcce69383}, {0x0004d643c7cbb5bb,0x0008590aef06d012,0x00060fa7c6feac21,0x000b4f1a8188e067,0x00001a3be9c907b4}},
+{{0x00003f29ba945b86,0x0007ca67a709dff5,0x0009c7325ea2dbe4,0x000e8c0a107e584b,0x000054d78e4935c4}, {0x00027eac2c0a6bc5,0x000105cb290d9672,0x000090db65534c68,0x000b52dfbbd9c39e,0x00001bfd8bd9cc52}, {0x0003c03831fe9c7c,0x000e6ac45a3c76f9,0x00095f4172fd5d85,0x00099ff6982d1749,0x00002cb9f9391540}},
+{{0x000d3339bf21ee61,0x000250bc97e67f14,0x000ecf13d50e188d,0x0002da51f26570be,0x00006372fc9979ea}, {0x0009e0c866a367ae,0x00078a365b32dea5,0x000034835e661e41,0x0007052c7c84939c,0x00006673c0a99e1b}, {0x000e27c61be9531e,0x000fa05e79a2e3ea,0x0005731dcd03bbff,0x00011849682a2d38,0x00005310f6906835}},
+{{0x000c52036b1782fc,0x000816cad83b40e2,0x000964073e64816c,0x000c520d0dcbdd96,0x000013d99df70164}, {0x000ff6d93bdab31d,0x0000f9d652dfea12,0x000abe94870725d8,0x0003c43019c4ff39,0x000060f450b882cd}, {0x000b5ec321e5c0ca,0x000c9d719bfa2014,0x00050023a04fcb69,0x000ac804e5f1c187,0x00001c06de9e55ed}},
+},
+{ /* slot=20 [{1,2,3,..,32} * 64^(2*20)] * G) */
+{{0x000048478f387475,0x000f49cbecb3c51f,0x00099f2055b25dbc,0x000a5d69aab1244d,0x00002c709e6c1c10}, {0x0007f29362730383,0x000ffebca8a2ce1b,0x000fd413144b5279,0x000610fdafc778ab,0x00007deb10149c72}, {0x0002af6a8766ee7a,0x000045553cd0ecb6,0x000f0be4b566cbec,0x000e2ea588001380,0x000008e68e9ff62c}},
+{{0x000d500a4bc130ad,0x000493d0bd49c34a,0x00000a89be8d38db,0x0003b09a25c3d985,0x00002f1f3f87eeba}, {0x000d09d50ab8f2f9,0x0008dc55923df2f2,0x0003766cb9acb921,0x00019f54a8f34267,0x00004cb13bd738f7}, {0x00048c75e515b64a,0x000badb4a9038f78,0x000f751b50a59501,0x0002ee8c20d313f3,0x000019a1e353c0ae}},
+{{0x000c7560bafa05c3,0x000a0c6e55e617d1,0x0000d66473b3e1a0,0x0003486e3529718c,0x000041546b11c20c}, {0x000172cdd596bdbd,0x0004398eefc40b42,0x00044109b593e045,0x000ae349fb15347b,0x0000736bd3990266}, {0x00032d509334b3b4,0x0004b60816573855,0x00025c837546fd11,0x000ab5ccc5f5f304,0x0000412295a2b87f}},
+{{0x00099b88f57ed6e9,0x000266df8c82519c,0x00030ad2735393cb,0x0002e345cee3213b,0x000014e153ebb52d}, {0x00055261e293eac6,0x000032133acdb2e6,0x000900996b845a92,0x000dd80460975cb7,0x00000760bb8d195a}, {0x000e1a17cde6818a,0x000a9ed69a084413,0x0006caccb157156d,0x000c5f22cbf268f4,0x00006b34be9bc33a}},
+{{0x000f2f643a78c0b2,0x0001ef22e027cf3d,0x0009c1b5a34c3e97,0x000dd2dec7d1c5e4,0x00002012c18f0922}, {0x000c69656571f2d3,0x00045530e737a11f,0x0004fe5035c6c9e8,0x000d30be33ae7a2d,0x000001b9c7b62e6d}, {0x000b55e55ac89d29,0x0001f45a0a763880,0x0002e76c1f148324,0x000ade83d36efdfc,0x000008af5b784e4b}},
+{{0x000499dc881f2533,0x000da779323b6283,0x00073441f49d0525,0x000168d897addfb6,0x000032b79d71163a}, {0x000314d289cc2c4b,0x00011a287178de27,0x000a3364ce4be4bd,0x000826e18d528d6f,0x00006423c1d5afd9}, {0x0005f8d9edfcb36a,0x0008f3746e5f9cc8,0x0009e5d3cd22bcc2,0x0002dcce49de338f,0x0000480a5efbc13e}},
+{{0x0001e70b01622071,0x000cf8b1dafc50b5,0x000f5aabcd06b505,0x000bf312c6bb061e,0x000047aa27600cb7}, {0x00014ce442ce221f,0x000cc4c053928b66,0x000c1cbe036e199d,0x0008e06663fb4a4d,0x000024b31d47691c}, {0x00041eedc015f8c3,0x0007e7c693f7c2a5,0x000ea278d611a4fe,0x000a094f0af66134,0x0000545b585d14dd}},
+{{0x000f275ea0d43a0f,0x00034089beebe67b,0x000479e72eade68e,0x00054544289134cd,0x00000f62f9c332ba}, {0x0004e4d0e3b321e1,0x0007a28ff1e95620,0x000b99bd9e3baa63,0x000d0710b0ccffd5,0x00004d22dc3e64c8}, {0x00046589d63b5f39,0x0003f57cbcf61fcb,0x00053afa055cae6a,0x0001436febac2d29,0x00001c0fa01a3637}},
+{{0x0007c0785d132cb1,0x00069c65cc1a5f18,0x000870ac1276d0c0,0x000232d43032ac34,0x00002877f9a0e442}, {0x000525cc3814ec1f,0x000b9635d7ed4d66,0x0000bee3f3ccc8a3,0x000e6c765f536bc7,0x0000227098525cc4}, {0x00073765d745ef15,0x000dae4a9801c3a5,0x000f4b6e4ee197e8,0x00028b08946bd073,0x00005b875f2667ba}},
+{{0x000ec995f8ac8311,0x00086eea43e541dd,0x0002d063818f6121,0x000253dcda4cb09b,0x00000871258a9aee}, {0x000d312b48b972a3,0x000308d26be89731,0x000347b00169d74f,0x0008f31ad4484bc5,0x00007d8e4a358801}, {0x0002a3ea284b370e,0x00062641860856d2,0x000f2757b5eacb98,0x0004fee0badc9058,0x00001224c304f633}},
+{{0x0000c0b2ceccb06f,0x000888143f398cc2,0x000f62ce022673a9,0x000d586b34e55ec8,0x00005b951b54e5ad}, {0x000064010c450bd9,0x0006f6a552bef5b5,0x00099314521e1897,0x0009f8d45b84c985,0x0000701d31686b1f}, {0x0007e787a513025b,0x0000d0bd3b909fc7,0x000cc217fe644ecf,0x000c04d9a36a530b,0x00005132d1e91054}},
+{{0x000ce10ba7db2ca3,0x000dbda20fff66bb,0x000cf7a1c05c459c,0x00021b032ae4fe69,0x00003891c02063d1}, {0x000eb57d88ac5d88,0x0001c44fb4042ba7,0x000fd1dc480ab26a,0x000c2f90b237dde8,0x00007b9906e88fec}, {0x0006a0949e185020,0x000d1d56d16f81ec,0x00042136dba2bbb2,0x0009c117e56177e9,0x00007281471bb483}},
+{{0x000bdceb0c24a9ac,0x000e99afd70fd3bc,0x00005cb87b7dbe29,0x0005ddbc8dcd584c,0x00003d13a782285c}, {0x00097ceff2238316,0x0008b5e1e4c300d2,0x0002078dac0a6e36,0x0000fd45bbff89c8,0x00005338333f2b2a}, {0x00066afa6c14eadd,0x000cf5032da8eb9b,0x000c74a2f7a97735,0x0008dd1cf9f881a9,0x00003cd13f5c9646}},
+{{0x00095c4c7a4a71aa,0x0000a1d9c2905b65,0x00066095eb2ecafc,0x000bf88ebee2be88,0x0000501363db6764}, {0x0009372c3fceb682,0x000447b291d1062e,0x0003d80f4966b222,0x0003f74d9dd74100,0x00006add899bdc50}, {0x0009725af0892aeb,0x000fb5b94e32e319,0x0001e02e3ab06085,0x0008b973739e087e,0x00003d170bc4477a}},
+{{0x00078f4e25942853,0x00075e2a6f54a123,0x00015e2089651b21,0x0007b38571917403,0x000037b9d0188c87}, {0x0009c8ee652e4e4e,0x0003bfaf914b88b9,0x00063f2dfbc6df82,0x00013a996086f2d9,0x0000051d4cbb6f2d}, {0x000d7f0144ec87c3,0x00011806a25d4837,0x00066e66969ab8de,0x0005ac857caf805f,0x00001a031e6df801}},
+{{0x00047449bc7cd692,0x000aae6f73ddfe75,0x0000837e290f9abe,0x000c1834af01ca70,0x000063ab1b5d3f1b}, {0x000ee5e854c53fae,0x000c12b4f3ff4c11,0x0000b67a726a0b06,0x000e3ef33540f80e,0x000015f18fc3cd07}, {0x00050763b028f48c,0x00040556a065f327,0x0003495b58060207,0x000508dd53bd812c,0x000008706c9b865f}},
+{{0x000479fc9d587e8b,0x0003a1b53f597012,0x0003c3664f8fca54,0x000200c0041eafee,0x00003b8ef66da4ed}, {0x000117635538f94d,0x000014f8f25d4386,0x000cd872c8768ebc,0x00024d756c8ac5d0,0x00004534738b5223}, {0x0007072c0e418cea,0x0002367df45f8e8e,0x000fd7c735eb457b,0x00088b5b60de6054,0x0000440a9d31a1cd}},
+{{0x000053fbfa7e4fa7,0x000fa011658dd0dc,0x00087f5e807ccf45,0x000f7ff78bd6e84d,0x00001038166de32c}, {0x000731e46fd844b3,0x000f878ba281005d,0x0006f9c674f663ff,0x000ed42c4540c269,0x0000321319bc3299}, {0x00066cb740c5f9f8,0x00009532bc7f8396,0x000252bf59172c50,0x00070c1b06e61aae,0x000073aff8d02ac4}},
+{{0x0005aa5d0b67c1db,0x000177e6af1fcd85,0x0009399f95e6266c,0x000576d93e63b724,0x00002fd03aa1a5d9}, {0x000afaf297a24ff7,0x000978262cc29a98,0x000dc1c73b3b1ce4,0x0000c0a7f6d3c547,0x0000375b26ccde57}, {0x00087bc0916ab6cd,0x00032a6c812becf7,0x000eda1acc1ba235,0x000f9296a0c1aae6,0x0000392ca44a3991}},
+{{0x00083556bbe1a5ee,0x0000499a6ad1d449,0x0007fd8feff9c333,0x000cf24e68aa0589,0x00006eaef4d92ba6}, {0x0001d9b5cbd4d528,0x000fb8ad61e8677f,0x0004e961015861c8,0x000bcfb20676a31c,0x0000198a442d10b2}, {0x0005cca1bb1e3269,0x000bc572e54bf827,0x000c9ad88c84bcb8,0x0000a2c068f8bf1f,0x000074c9cfa8834c}},
+{{0x0004dd57e4c909a0,0x0004fac6cb5d526c,0x0001b751efd4737b,0x0009d01b6f1ee038,0x00005db1b9c82dcf}, {0x00074bfa32c5676b,0x0000512735b70a50,0x00079edbcf84141f,0x000b785af87c1d92,0x0000746a70c2d9cf}, {0x000826715ffd467b,0x00070a3e2648e85c,0x000fb0be1c445a1f,0x000e6e1c6f929c5b,0x0000584df1e607b3}},
+{{0x000d1c99ec591d57,0x000ddd47ad5b6ea3,0x0006ff88ab700034,0x000adbc50ea08bea,0x000074e9a7d21c21}, {0x000b964bfce56021,0x000a8bcb222ed646,0x00068a235a27a9d6,0x0000ecf303c61491,0x00003898020a1a20}, {0x000a69d402191bdb,0x00027b7fa9266429,0x000be09ffdc28311,0x000c2b91cdb3f805,0x0000606639faf891}},
+{{0x000f0a4dbff979bf,0x000eb17b893321b5,0x000c7ba8519b2ef8,0x00004c69fd888c9a,0x0000082817a7f55c}, {0x0007ce5095061c84,0x000175cb42d04469,0x000dba1eaae264b5,0x000993b0413f5937,0x00006ac41228b4cf}, {0x0002c1a17bdc5c10,0x000cbf9c5fbe8bff,0x0001055cab3682d9,0x00014505e4c75045,0x00001b1cf9558844}},
+{{0x000690f238cc58cc,0x000991eccfb7221b,0x0007cf975ffc42f7,0x0002d746069ed713,0x000025ea6fb2826a}, {0x000f0024fd627067,0x0005ebcc0405aa0b,0x000f96ddda50610f,0x0000cbff9912826e,0x000076c43beda570}, {0x000a49e8e16ca602,0x000f80adb159cc2b,0x000c1e1259823c61,0x000711392b241168,0x0000743fe577c2bf}},
+{{0x000a1beea7360374,0x000d676c25760348,0x0008336ea3f28048,0x000568153a5d4af1,0x00005f8274b065c2}, {0x000357779395f508,0x00079fd700578670,0x00051a9f51338d85,0x000e226fefba7246,0x000028b321720ef3}, {0x000d3b6c3757aa1f,0x000d779f18eaf6f4,0x000e12122813fdac,0x000566db69d58ae6,0x000017dbc53a6a25}},
+{{0x0006df0089ef58e1,0x000520b7984aa42b,0x00069bbff4c46c62,0x00008e078618f9cc,0x000029fb123fea4e}, {0x00073aa8a308fad9,0x0006a62a994e8558,0x0007e85751f02773,0x00005e73f229bea1,0x0000711eb714cbcc}, {0x000d3db39ab937c3,0x000053dbb15e0402,0x0000b427c5a63243,0x0002dd9a32c5c485,0x000061e4b34cb252}},
+{{0x0007c8ad0426d2aa,0x000f8547592d285c,0x00049d5ec3c2a101,0x0008cc0584ff2338,0x00004931e11694f3}, {0x0000d8c06c38ce58,0x000def5f7c72fec7,0x0008695545411115,0x000a407f840f0f89,0x0000411dca6c75ee}, {0x0007a16302124e67,0x00072354aa971e07,0x0008ef5329725c14,0x0009043bfbba4ffe,0x0000321800f88a6e}},
+{{0x000f52d60378a72e,0x00087f31909e8799,0x000a9b08642d71a2,0x000c3edc3fc780c2,0x00005bca89c5a796}, {0x000dd684a4ee4ff5,0x000cba723f1ce953,0x000960e2d81b1196,0x0002f0b53defefb0,0x00006341bce00f43}, {0x0000d61059b0924f,0x00039d1360884a6d,0x000144bdc90e2260,0x000196f5e689e5ac,0x00005dcf76d85c7d}},
+{{0x000cb1ff98923f2a,0x0006784a5d7f8674,0x0009af8b993970f5,0x000de5bd03e560b3,0x000020305b1e72c5}, {0x000951da6ffaa4ce,0x0000c1b0ac017abb,0x000fff43e2a962c8,0x0006ecabc1f2a819,0x0000427606bdf16f}, {0x000411f262a2bf3d,0x000890e97a210be7,0x0000e5a30dbf1ab5,0x00006e4e2d1198a6,0x0000215d63d45b9b}},
+{{0x00061e82dd243c46,0x0003d9e1467476a0,0x000319abcce297a3,0x000cbb7e2f3c254e,0x00001e9cbb31295f}, {0x000971d63023b865,0x000db55bd22a3b9d,0x00031e6ae8d41f44,0x000fb3725a50eab4,0x00002773db159c22}, {0x000aeefac15cefdc,0x0003af6d9c18b139,0x000e1d0dcd67b5b7,0x000eecd784d0d36b,0x0000655d9d56eba8}},
+{{0x000603958808bcaa,0x00036fa215930446,0x0006b03c3d46065c,0x000350410671d163,0x00006695371ed2c2}, {0x0007e9290253d14d,0x000cbcb18304feb3,0x000a22513be3a99f,0x0006d9c82d33c463,0x00007b873c80c934}, {0x0001593bbc5599d0,0x000a1c649ab20806,0x00077f89c948a3d0,0x000aa9dc27bbd6ec,0x00004108230823d5}},
+{{0x000ca2ab3d343dff,0x0002d80abc617f37,0x0004ccffca1a8c6a,0x000d1b98e49e035d,0x000048b46beebaa1}, {0x00091b4138b41246,0x000526f9ac26bcc9,0x0007cbabbd243b9c,0x000ed00b9ef494db,0x00005fba433dd082}, {0x0009e355c9941ad0,0x000de74498f849c4,0x0006663e5cb9734a,0x00010b341c3fed06,0x00000ecfedf8e8e7}},
+},
+{ /* slot=21 [{1,2,3,..,32} * 64^(2*21)] * G) */
+{{0x00007ca1ab1c6eb9,0x0003e16b687b3b15,0x000c7a91abbd448f,0x000dec13455fb7f2,0x00007579229e2f2a}, {0x0005dcb85b1c16b7,0x000e83c7b27a56ab,0x00035517be94c0fc,0x000afaaa4b11c1a7,0x0000499238d0ba0e}, {0x00046e527aba8b57,0x000478bd1647becf,0x000f706fef15a08c,0x00030d57af1c6a65,0x00006345fa78f03a}},
+{{0x0002f95f1015e7a1,0x0001da9b40263df0,0x0003ea1107790ec4,0x000f8c94d3a0ea13,0x000054f70be7e33a}, {0x0003cbe9bdd8f0a4,0x0001bfd17730293d,0x000f17a875db152c,0x0006efe7dbddc6d7,0x00003e1a71cc8f42}, {0x000ca3e390babd62,0x000670291c833c83,0x00037900c480ede3,0x0001fa1c88038ccd,0x00002c5fc0231ec3}},
+{{0x000a911717038b4f,0x00021c9deef81feb,0x000d0d8834e51237,0x0003bc61c97e4e75,0x000068afae7a23dc}, {0x0002e4d102456e65,0x000c1cad47b91c42,0x0002b6ffdd87414a,0x000100f1592e2bba,0x000075d9d2bff5c2}, {0x0009b4763626e81c,0x00036bca02edd5bd,0x0001f077b3899669,0x00054710a41193d6,0x00003097a24200ce}},
+{{0x00027734c7f8b84c,0x0003e01b270e9574,0x0004e564a6f141a1,0x000bd4802d1adfeb,0x00004bb23d92ce83}, {0x0002e7246695c486,0x0003435a89607a16,0x0000d12a37131d63,0x000b36330521561a,0x000056704bada6af}, {0x000c4aa752f912b9,0x0006cd86770c8af6,0x0003c8cd585e665f,0x0008a7e4c35ac83a,0x00002b7a29c010a5}},
+{{0x00007f77d0c1cec3,0x000b6bac492f8c40,0x000e69daaf8d1020,0x000fce032ec29d57,0x0000599408759d95}, {0x00010a23bf00086e,0x0005ee736ff7c338,0x00024922d4afce92,0x000061b3d60e670e,0x000011ce9e714f96}, {0x000ef713d815bac1,0x0005d485be25c219,0x000e513c51f14146,0x00043936d5447cc4,0x0000174926be5ef4}},
+{{0x000eb2f9fc5bd5bb,0x0002ae1d810e1b5d,0x00072a1c5992daa7,0x0002a24afc4cfdcb,0x0000497d78813fc2}, {0x0005d41593ea022e,0x000a20ed0eed63ef,0x0007382c8c5cbcc1,0x000e1ad8fd24ecf0,0x00006fa42ead06d8}, {0x0006824a1f73371f,0x0001c4f5b6736e27,0x0004fa46e77f7cf0,0x0008c967e201fe30,0x0000785a36a35780}},
+{{0x000fbdfd63014d2b,0x0009c6ca7578b825,0x000c0b5df0c85236,0x0008c8f5b2fcd285,0x000012ab214c5804}, {0x000442985d517bc3,0x000c7ae653678070,0x00085a77636acd56,0x000662b00a279839,0x00005167effae512}, {0x000ea9e10f53c4b6,0x0005f8ac91a14bd4,0x000acc1aba1673dc,0x0002a25a8f81a4e2,0x000033a92a792433}},
+{{0x0001f49927996c02,0x00058e04d17529dd,0x000fd02c3e0cb3b0,0x0003eb11f7e88967,0x00002f964268cb8b}, {0x00095ba0218f2ada,0x00087330fb9ca7ba,0x0006c6d907cff422,0x000ee54dada496d5,0x00005380c296f4be}, {0x000f270466898d0a,0x000990aff3f7a9d4,0x0007daba453d0987,0x000669cd09ef3626,0x00007761455e7b1c}},
+{{0x000e8d50a45c8f4c,0x00004de764c235cc,0x000e21a75fa8272c,0x000911c093248617,0x000067e690cb60f7}, {0x000250974b220084,0x00047eae43674adb,0x0004c6a8ad78aa3d,0x0007dc2e9acbe63a,0x000064e6b5aaf0fa}, {0x0003e338fbd2ae14,0x00064c8d9d74e4b6,0x000ef7d865d3a8f2,0x000bc87e98571607,0x0000515db7babc04}},
+{{0x0004f7b75ebe86b2,0x0008ccbf0af34082,0x0004a488e31d7f15,0x000c8498756d8ce7,0x0000430e7af36238}, {0x0007b7a93d37ecba,0x000c8d00c11a0937,0x000b46b8667eb1c7,0x00011ca81efeb5f3,0x00007dccbe7c3c1f}, {0x0006ee996ab57210,0x0005830b686cfbb1,0x0001a40eb6914aed,0x000f9147b72a61c8,0x000022319bbb07f9}},
+{{0x0004e70580a4e308,0x0006b1eb988e4997,0x000cb5faa55f5e0c,0x00055d65bb9c6aaf,0x00002e2470b9cc70}, {0x0003dc5c41cd0e9d,0x000d571a3c70ed93,0x0009332e193e4ab8,0x000766c1f2dd11a0,0x000032e93ccd6c7f}, {0x000feca593ed697d,0x000642cb49544939,0x0002cbd732bbe921,0x0007b0a795c5ad2a,0x000042c8165c092c}},
+{{0x0006f75d53a77ef1,0x000a3cd284dd8f13,0x0006f0af5aadb7b2,0x000975096b7524bc,0x00007f1ca117116f}, {0x00028d00fe586fdb,0x000eacb9cbddd9e6,0x000e7f9b90279f4b,0x0002a3f26c63761e,0x00001dcad910b053}, {0x00045bc962e0b7cb,0x000a8a12b5c7d43e,0x000fe1ada9277996,0x000f4577daae8de3,0x00004f32e1aabdec}},
+{{0x00010f12310d696d,0x000a6f9870b5b3b5,0x00091ba6a82d8bca,0x000dc30f0620cf6c,0x000045f6f13fe001}, {0x000f16b0548cef7a,0x00017a588951da9f,0x000ce9babc18287e,0x000e962965e153fe,0x000014e99a2dd99c}, {0x0000bef03639ede6,0x00021392a770ff73,0x000f565c6bf67134,0x000521b8441c8ac2,0x000021484b13a200}},
+{{0x000854ab15e49075,0x0001c12de893836e,0x000cb994b3adc32e,0x000d9442ca757edd,0x00001b02bcad4677}, {0x0007451dc96fbc0a,0x00009c64f498f080,0x000a4b201caa3d8e,0x000203a7b42739d6,0x000023c146182e44}, {0x000dc5f3624cf0a5,0x000ecd4937060b05,0x000f8d7c7602f077,0x0004ab7484a99302,0x00001c168c269d2a}},
+{{0x000a3c9ecd606cd2,0x00052afb705735a2,0x00046ceeadf3c37a,0x000e6efcc0052915,0x000061ea8443beaf}, {0x0001cdc2395f36f8,0x000a4c064e0dbbe8,0x000a2043d95de2f2,0x000ccb23b5572f54,0x000023a705402e5a}, {0x000954e6e6328bef,0x00016b04287dbb07,0x0008ebcf8880ac37,0x000aa988055e7ac4,0x00002cb36aaf2832}},
+{{0x0008fe097e44b439,0x0008357087dd7126,0x0001ad9b3ce34fa8,0x000ee9834cb95573,0x00006c9068c07c8d}, {0x00085c014dce6191,0x0008a491f9dfcd56,0x00020c06df69e452,0x000daaac68921298,0x000013f85b8ffc7e}, {0x00096cbad956f568,0x0000a60b1da47005,0x0007dc50cdc31719,0x000fa7989760bc78,0x000031a35ea4c1a2}},
+{{0x000412e65c69c325,0x000fb6a6b5b909b3,0x000b52b7cdf177da,0x00044ff1a41a7c07,0x00002d6a966d415b}, {0x000158ef87d02f58,0x000e0dc74141a723,0x000fd1fbd922a7a6,0x000018cd25a4d564,0x0000760f81f3b592}, {0x000b1dce50021b0d,0x000f204f8afdec9a,0x00056438fb85c0d6,0x000730c299da33da,0x00003f452cef1d22}},
+{{0x00039ae7a4c42f04,0x00076b82903109bb,0x000877bab543cd81,0x00034baad8e9039c,0x0000135fc7a69111}, {0x000ca9bc617f1f43,0x000d138e1f13fdcb,0x0005fa935e042fde,0x000d846c6a7078d0,0x000065e613ab6a8f}, {0x00083cde5b2fa359,0x00079aea8f42448b,0x000bcf7ddcfeb2ad,0x000f7d775698f9c1,0x00002c886f406165}},
+{{0x000b54d18cb13ef6,0x000a4332d81252ce,0x000a5e4a1ea66af6,0x000beef939bafad2,0x0000217d0fc1ed0f}, {0x000901c45fdba5f6,0x000e6ec2beb79c60,0x00044f4b340f62fe,0x0009e563f9b95c57,0x000054190d858ed4}, {0x0007ca12e661a26d,0x0004820f7c75c159,0x0006b19266909899,0x000ef36a08901760,0x000059c8a2894961}},
+{{0x000c2fb02bd4e895,0x00018a34863efe41,0x000dbd55fdba506b,0x0005d098fd842e3a,0x000016a86aa0df1e}, {0x000ef027c69b287b,0x00094b128f95fafd,0x0000c4e70b6bb623,0x000f736351bc5c80,0x00006d2aaed1df38}, {0x000173c419e1d140,0x000faf0471663bd0,0x0008ddf45b5f36eb,0x00032e7c8766233d,0x000039c1ec3c0ba4}},
+{{0x00070e0a40c8b09a,0x0008888af1645a34,0x0000736d1226eb47,0x0002e2c53865f103,0x00005c557446c2ce}, {0x0005285ddd1fd1ec,0x0008802aa0a87fdc,0x000f920f2e48eb8c,0x0006ff0d7ae338a6,0x00007aaafa13b53a}, {0x000b30982557a5bc,0x00076d7df0e3cff2,0x00039448fac950a7,0x0004912d292f4158,0x0000270477647161}},
+{{0x0005c8c51849d37f,0x000c783810144493,0x0005a6da2f047ca4,0x000c196ddad8d2c5,0x0000118093549240}, {0x0002732505df4420,0x0002080e950f3ab3,0x000d35a0d3ea9393,0x0009bdfd3f628a06,0x000079887a90135b}, {0x0000690c65e5a282,0x000d3bf6a88f430a,0x000d1034f8823652,0x00051bfcb247795a,0x00006f0f1797e801}},
+{{0x0007c2418f8ed4d4,0x000df922167b2ccb,0x00097ff1c478e33d,0x0001fb860699e012,0x000022a0a2105183}, {0x00032d6bd3a84088,0x000cfff291462531,0x0000e0cd9454b933,0x0008670f27d78562,0x0000312e12a2b894}, {0x00086b29b5c11b48,0x000c8bfd6025244c,0x0002989ba1c443e2,0x000e7df42313b507,0x00002f3a3075bb38}},
+{{0x000d4c49a25c9945,0x000d1e46af782178,0x0008095ee36c61c4,0x00098ab7880e84ab,0x000013be93cc523d}, {0x000db378c1d9d8c4,0x00026b2b333b10e9,0x00076e238fb83636,0x000c1bdbed728eb6,0x000015c9b5088ebc}, {0x000f3edb3e8966af,0x00076c2e32e5f13d,0x0002eea1e79cb428,0x000f03cce12fdc04,0x000046c12f6248c1}},
+{{0x000fee4f3b33750c,0x00037968f46e6199,0x000f4503ec4abf82,0x000fd42860a61729,0x00002b56b7b11eff}, {0x000f72d28d1d6dac,0x0009fea9e1e1e206,0x0009b1ba9b39d8d0,0x0001c8a5a0bc73aa,0x0000520eb9ac7da4}, {0x000e4f35891bc85c,0x0000f7de98a38be8,0x00050a89dae41261,0x00047ce887273cae,0x000063bd2f4f9589}},
+{{0x000911385786ef9a,0x000ee6f08b57ae68,0x000fc220862a195f,0x0002045dd7291313,0x00007fb86019e28c}, {0x000e6e1d01325bb6,0x0003d8bb319fe511,0x000bfb7d684ac373,0x0000dea986229d46,0x0000708660d0c69a}, {0x000bd35a70c2cbb8,0x00051b01d03bbb17,0x000282485b1420ea,0x00006dbdb0ce9f12,0x0000273cd1908ed1}},
+{{0x00020bdcc13cd7be,0x0009c32f9679312a,0x000c723d56d8cfb9,0x0001c2a4b00dea81,0x000072d5b460d900}, {0x00020dc4d1ad0617,0x0005253510170609,0x00044e5be8c41534,0x000d3df0bbbdbe94,0x00006dab6ede625e}, {0x000023f035bb7935,0x000998629b9007e9,0x000d3f4172075bbd,0x000627a3149514bf,0x000028bb763464b3}},
+{{0x000407c9922eadbe,0x0005dc71dd2e816b,0x00014f7210e2b340,0x0005f683c5c4fdf3,0x000047ba81791a29}, {0x000034c393b4ffc4,0x000f1889f68d618e,0x000a88a50e751131,0x000acc021f42e867,0x0000758f39fd14d9}, {0x00005d9075598720,0x000b698bbcf701f7,0x000652862f4ff74f,0x00076fce30dcba7a,0x000045059b2f5f56}},
+{{0x0008d0dbb99ad827,0x000ac05c48417660,0x00084e689faf0051,0x000584cc0c5f54b1,0x00003aacb8429169}, {0x000a41f4f1cbd865,0x000214df253ae849,0x000c2a845546adcb,0x000d65153db011c5,0x0000066ab26c5c3b}, {0x000a959649cf1849,0x0001225c9eadd8d4,0x000f0316cfa77ee1,0x000b3382512ec17a,0x000060cbca4790ff}},
+{{0x000a29d97d8275fb,0x000ec1f030b0987e,0x00073b5faee1ec8d,0x000199dffcc8ce09,0x00005d0af2fb28db}, {0x000170e51ca53506,0x000b1d99406522e7,0x0006d741c816604c,0x0007cb689ee471ff,0x0000341cf1fc44a8}, {0x0001870b78d58790,0x000cf7d8590aec2d,0x00032f9eaf10b9d1,0x000bf3ec604c6141,0x00007a4fba8fd377}},
+{{0x0009d1d2f459efb0,0x000005b9599883fa,0x000ed7dd183fa512,0x0003927b635ef01d,0x00004444899c2c6c}, {0x000b6a6eb658f1ec,0x000b161cf3d2771a,0x0007e3d181925828,0x0004a2c517393a63,0x00005cdd3780fb2e}, {0x000cd08c86c44f49,0x00089699838109b0,0x000054ccdb3006e8,0x0002da050093916f,0x00000431452993e4}},
+{{0x0001ff2a27e6c06b,0x0002af0bd84b1890,0x000e9ba9e5063ea6,0x000930caf225d96f,0x00007cb33327137b}, {0x0007da8fb551086a,0x000ee2de73a1f4f7,0x000c883a166a8c09,0x000ff360486ac222,0x000023bb4c073624}, {0x000a133c7a03dc75,0x0004188ab77bdc5e,0x00029fa15b2c02a1,0x0008dbdc89b01092,0x00004aad4d476d90}},
+},
+};
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* #define IFMA_ED25519_PRECOMP6_H */
@@ -0,0 +1,1288 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IFMA_ED25519_PRECOMP7_H
+#define IFMA_ED25519_PRECOMP7_H
+
+#include <internal/ed25519/ifma_arith_ed25519.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define MUL_BASEPOINT_WIN_SIZE (7)
+
+#define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE
+#define BP_N_ENTRY (1<<(BP_WIN_SIZE-1))
+
+__ALIGN64 static ge52_precomp ifma_ed25519_bp_precomp[][BP_N_ENTRY] = {
+{ /* slot=0 [{1,2,3,..,64} * 128^(2*0)] * G) */
+{{0x00003905d740913e,0x00005d140beb39d1,0x00088f8a09fd399f,0x0001267a5c184346,0x000044fd2f9298f8}, {0x000c93c6f58c3b85,0x000c6fb8c0e192fb,0x00043d42c2cf932d,0x000ba65270b48986,0x000007cf9d3a33d4}, {0x00091205877aaa68,0x00023ccaac49eabc,0x000d43598c26d9e8,0x00065a85a1b7dcbd,0x00006f117b689f0c}},
+{{0x0009a56042b4d5a8,0x0000c4e60acf68a9,0x00016e37aa8f2b81,0x0002555e09e236bb,0x00006bb595a669c9}, {0x0004e7fc933c71d7,0x000967a0ff5b5922,0x0001d607029f469d,0x0002e2e5aa69a65e,0x0000590c063fa87d}, {0x000aa8b3a59b7a5f,0x000dd5d9acf7843f,0x000b3d6a3136c16b,0x0000b73500fa0840,0x0000701af5b13ea5}},
+{{0x00011fe8a4fcd265,0x000fde5c1ba7d566,0x00014bd6bd3bd353,0x000da628131f31a2,0x00002ab91587555b}, {0x0005b0a84cee9730,0x00030e8864b8aaf2,0x000f016732025a84,0x000f8f4c11b50029,0x00007a164e1b9a80}, {0x000e933f0dd0d889,0x000221c35da6214a,0x000cf2db4c589423,0x000b4c6d170e5458,0x00005a2826af12b9}},
+{{0x000e050a056818bf,0x000715660faa995f,0x0006a05073327e89,0x000a49ac3e8e3cd0,0x000027933f4c7445}, {0x000351b98efc099f,0x000f47dfd2538287,0x000b0a92656765c6,0x0008727ca348d3df,0x0000680e910321e5}, {0x0003fbe9c476ff09,0x000457b5cc1725a1,0x00002b44946e9e39,0x0003e2b5ddbdcf91,0x00007f9d0cbf6355}},
+{{0x000182c3a447d6ba,0x000d14b2729b77f9,0x000864a087d50014,0x00055f3e33cf11cb,0x0000154a7e73eb1b}, {0x0002bc4408a5bb33,0x000c3c75eed02a21,0x000abfec448d5048,0x00006ebdd1beb0c5,0x00002945ccf146e2}, {0x000bdbf1812a8285,0x00007d0bdd1fcbcb,0x000bbda72d270e08,0x000b69ab41b670b1,0x000043aabe696b3b}},
+{{0x000806b67b7d8ca4,0x0008427d22739499,0x00004553b9575be2,0x0007884bb085ce72,0x000038b64c41ae41}, {0x000ceeeb77157131,0x0008900c8af883a0,0x000a59a7369b2715,0x00038bd8065b668d,0x000051e57bb6a2cc}, {0x000c326702ea4b71,0x0000341a1bb0185a,0x00083bc144be70e0,0x00061e353e4a24b0,0x000010b8e91a9f0d}},
+{{0x000f2c9aaa3221b1,0x000533bba23a7ba6,0x0002192c3a6ca021,0x00017e09dea764f9,0x00001d6edd5d2e53}, {0x000a5cd0944ea3bf,0x0003ab39dc0d26b1,0x0008542e49747035,0x000927e71b252822,0x0000461bea69283c}, {0x00036dc801b8b3a2,0x00047053ea49af18,0x000877adf3b3035f,0x00090a7529c41ba5,0x00007a9fbb1c6a0f}},
+{{0x00075dedf39234d9,0x00080e1b558f9e2a,0x000e3c23fb963d76,0x00001c32c2741ac6,0x00003a9024a1320e}, {0x0007596604dd3e8f,0x00077e288702c59b,0x000ed9c3236cb303,0x000e52fb1339c665,0x00000915e76061bc}, {0x0001f5d9c9a2911a,0x000788bcca7d7e7c,0x000eb62a32b8a371,0x0004e95636412190,0x000026907c5c2ecc}},
+{{0x000e217e039d8064,0x000b6f520419bf36,0x00075eb04498a081,0x0009c8f96cbc608e,0x000049c05a51fadc}, {0x000e678aa6a8632f,0x0006f51bc46c59b2,0x000686f5b5a6509e,0x0007f59ceb233c9c,0x000034b9ed338add}, {0x0004e8bf9045af1b,0x000e8a719d22f06b,0x0003d4cf16e2ff83,0x0008b06aaf6fc299,0x000073c172021b00}},
+{{0x0003558e227081dd,0x0003665a9f02f75f,0x0005dc395804f818,0x000b70284739745f,0x00000353832c4950}, {0x000d93d2b360748e,0x000d41617e057ff1,0x000b55464645f534,0x00091ed0d5503639,0x000043ac7628aae5}, {0x000d2ae403d0f8d8,0x000cbd3f06340d03,0x000731b5091d0c1c,0x0004ce7ff169f0f6,0x00000ec62af470bf}},
+{{0x000f5b0249864348,0x0006977088381315,0x000a8deb953ed6b3,0x000c77fa3a075556,0x000018ab598029d5}, {0x000f00848a802ade,0x000cf02302e272fb,0x0007703406e5d9fe,0x0008faf113e84711,0x00004275aae2546d}, {0x000b2cc5fd6089e9,0x000a13282e4a4d82,0x00051a8622031eb4,0x000f94844311199b,0x00003dc65522b53d}},
+{{0x000f8375b53d54b9,0x00090ccb25b24856,0x0006d5dbdd23b2bf,0x00022ed884dfb6e5,0x00007956ece28a60}, {0x00058042a71e7539,0x000d7d834d1a9e23,0x00001a6f9388de3d,0x000dd5845ecdd2e7,0x0000078aafde8d3c}, {0x000594d87f944553,0x00023a24e180beea,0x0004976461f66cda,0x000d0c6ffcb589af,0x000037c6a5151c83}},
+{{0x000f013b327fbf93,0x000c99b776f6b506,0x000aad5968aefceb,0x00024a79d12b232a,0x00000267882d1760}, {0x0000c222a2007f6d,0x0009ab5bcdedbbf7,0x000b07ba07bf84b3,0x000f241537a0e12f,0x0000234fd7eec346}, {0x0000a119732ea378,0x000b1df8dd471536,0x0001a7e5332437e6,0x0007863a2ef37f89,0x0000497ba6fdaa09}},
+{{0x000b8a44d4171280,0x0000fdb7ca331dfd,0x000eec47a9ce69b2,0x00080d2112e56f16,0x00002df0ea2c5b3c}, {0x000870ec3f213df2,0x000c057efa98726f,0x000881bdd580277f,0x00016301a474c042,0x00006eaf60b2464d}, {0x0001c5877a1e1b82,0x000eda2a9bf5496a,0x000ecb1baaf02397,0x0009c939c1fdf703,0x000024bf7e3cd8ba}},
+{{0x000bcd86468ccf0b,0x000a42a9910d6040,0x0007b25192d3829b,0x0005ebf750830080,0x000043b5cd4218d0}, {0x000ecc0313cfeaa0,0x0008d189c246d24c,0x0001f2d4d08648c2,0x000e72b2dbdbdfac,0x000061e22917f12d}, {0x000a762f9bd0b516,0x0004e373fdeee5d9,0x0003d64270eb38af,0x000d842032e5a7d9,0x0000511d61210ae4}},
+{{0x000851ca553e2df3,0x000cba64878b37ec,0x000288d1e7a71284,0x0008883e6b5e4193,0x00004cf210ec5a9a}, {0x000d04a52d9021f6,0x0003375c6bf9c322,0x0002d20b09b9c19f,0x000fe61587a3a434,0x0000143b1cf8aa64}, {0x00067c7d968acaab,0x0008e270927299f8,0x000a1809755f5425,0x00026e1d0a7d34be,0x000021b546a33741}},
+{{0x000386484420de87,0x00016b592edb4081,0x0009942d258a1cf0,0x000281039fa4e272,0x000071a7fe6fe248}, {0x000676ef950e9d81,0x000cdc0d7044f92c,0x000f8f1248a54620,0x00055e3aa9b36646,0x00006d325924ddb8}, {0x000182b8a5c8c854,0x00079fe5f2a036c7,0x0003778d0c33fd14,0x000eaa972cf59188,0x00004746c4b6559e}},
+{{0x0007f9ea94c4a4b4,0x000d6601c969d9d9,0x000e6bb51f2b2875,0x000af6dce4ce556c,0x00001aa89f0535a4}, {0x000483372c26bbe0,0x000c74d8c96c2cd0,0x0006c1d22c4dd9a6,0x00001c32d84ec7e4,0x00004179ae03c673}, {0x0009e6ad449f3eff,0x000bb3315da1a6c7,0x00035ac021329ebe,0x0004804daa089517,0x00006a76f18365b8}},
+{{0x000546c864741147,0x000dd0efcc849348,0x000672a3327d35ae,0x000e6d6ff939a760,0x0000219663497db5}, {0x00077b3c6dc69a2b,0x000276f89f617d37,0x00053a16b5defab2,0x0009fb745651cf7b,0x00005c9a51de34fe}, {0x0000f1cf79f10e67,0x000a1e658515bf51,0x0000142277ffddda,0x00023bb09c3a7171,0x00004804503c6082}},
+{{0x00089966c3ef6076,0x000af495f3f843cd,0x0003cdfb5254ecba,0x00071e40f0e80bbf,0x00002c3085e1c84f}, {0x000a5e4e1a8953e7,0x000cce3f381ef7d8,0x000fbc708f27f6e4,0x000a356adc5fba6e,0x00007aa95177a3fc}, {0x000da2bab61a40e7,0x00010793d45be1b3,0x0008f785d8d90acd,0x00060cefb579e7a4,0x00000c11ce6dfee5}},
+{{0x000821d23a36d175,0x000a7e99b9e323b6,0x0000838a47bbb40a,0x0004c5e5d9e5ce42,0x0000771e098858de}, {0x00049ed02ca37fc7,0x000e3a615acabc42,0x00096e0e23a059a0,0x000696d88a96ed7c,0x0000553398a51650}, {0x0002f5d278451edf,0x0007985899ccb9a1,0x000fa595083ada5d,0x000a611477f4a2d9,0x00005a5ed1d68ff5}},
+{{0x000308188dab2f97,0x000cb58dfe71ce7e,0x000a8f67deaf96fa,0x000373dcb8382cc1,0x000068bd2db3a04d}, {0x0001cc70e3838e9e,0x000014ddbb6ae68d,0x000b323d88ec05d0,0x000f5472d11fdb28,0x000024c264dab96f}, {0x000ee8439445bb44,0x00013e31e4698f06,0x00091454c140d23c,0x0003d937a7c10162,0x0000749f6e1e3ccb}},
+{{0x0005e0c558527359,0x00019cadb9d7ebae,0x000a1cabe9392e5c,0x000dc4428653c1ed,0x0000019b60135fef}, {0x0005122afe150e83,0x000257e4b35d8119,0x000e711e20cf209a,0x00092f07387f8291,0x000044acb897d8bf}, {0x000068145e134b83,0x0004f24304c161e6,0x000c1a3ed7c4f5e6,0x0002f92506e88a8f,0x0000150c49fde6ad}},
+{{0x000a7d3104f30e5d,0x00031b6186bfa513,0x0004f31a2f7e90f9,0x00079828d33a632f,0x00006fb5bc6b411a}, {0x000a0b6ed603e585,0x000f25b6bae177e2,0x000f4e0d6c40aeaa,0x000f9904e60c16c1,0x000050e67abc4fd4}, {0x000b6eb937c63dac,0x00070765b07b191a,0x00090afbc76ded35,0x00022be88e61f274,0x00004f0498a77597}},
+{{0x0009863c9cdca868,0x000dbb8714ad0b84,0x000c36168dc83f44,0x000fbc1fe3ee3560,0x000078a6d7791e05}, {0x000bf29509471138,0x000394f75a6518e7,0x0005a708ad5d6fef,0x000992210af79c42,0x00006b2b5a075bb9}, {0x000f704b47a0b976,0x00055741748d558b,0x000542f590a601b3,0x0005d00aa2b1fb1d,0x0000725c7ffc4ad5}},
+{{0x000a3f2780814523,0x00000e1d376f1fb0,0x000765427c13097a,0x000fbf798087abf7,0x000064ceb883653c}, {0x00059437c372eef5,0x000008dd9066e28b,0x0003be6b4f7fd7ad,0x000a39c3b3a86812,0x000073ff174e7024}, {0x00070ad05a63cbe3,0x00028a7c853b9f69,0x00068469c5fdaa82,0x000cd92ec4aebb6b,0x000071215035d428}},
+{{0x00002bf71cd098c0,0x000a4ed5e6366918,0x000902994cfe416c,0x000fae7df585d714,0x00004cd54625f855}, {0x00026715d1cf99b2,0x0001102a20d34e44,0x000b12109f7352d5,0x000f3a323d1157b8,0x0000794cc9277cb1}, {0x0006c426c2ac5053,0x000ad32f672584af,0x000a311021bc9aed,0x0008e852ad032f10,0x00007008357b6fcc}},
+{{0x00020d3ad7046e2a,0x00051c4016d1e8d4,0x000bbc80e2a485e1,0x000952314ef89a2f,0x00006eacc4376634}, {0x000df8a569ed734c,0x000a7f5b01881a4d,0x000661842a353d98,0x000d2b211729e92d,0x0000779d143037ba}, {0x000be44157371551,0x000e5463096ebf03,0x000c21823ec9e093,0x0000945a78169c9a,0x00003d6b19ebd18f}},
+{{0x000b9fbb82584a34,0x00063d2b4792bd01,0x000853620247ab64,0x000d428b631639c4,0x000013a92a3669d6}, {0x0008672738773f01,0x000fa95fbccfb0b8,0x0009ad29b6b8ccc8,0x0000f6a8d2dd5a3b,0x000006ef7e9851ad}, {0x0003771cc0577de5,0x0001e5035dc5cca9,0x000802e0717540e4,0x000f86a24680f01d,0x00003c296ddf8a2a}},
+{{0x00087e588f5111ed,0x000e8e88f5c586c2,0x000e499b389a09b6,0x00059da24ccdf679,0x000035e65aa86f6f}, {0x00002c8f8054d5db,0x000079c55dfe8dc0,0x0009ecd5c0c07637,0x0002f1bbb0d5dce9,0x000032682755caea}, {0x00003be93ec09db4,0x0000884f5cfa0304,0x000922cbe88ea43c,0x0002f39ce646a7a9,0x0000688adcea4112}},
+{{0x000b4d2ebb1f2541,0x000c740adb91ffce,0x0000a1ad05b89510,0x000717bfc71a37dd,0x00000a892c700747}, {0x000d15f9d914a713,0x000f98c8ff912aea,0x000f53d730a92f7b,0x00077baaff823179,0x00007a99d393490c}, {0x0002ed2436bda3e8,0x0004157e807948f5,0x00062f9ce077a8c8,0x000f7d2a5a965632,0x0000286762d28302}},
+{{0x000ff858a2888343,0x000565313ed3ca94,0x0005bf34face0ed4,0x000b371f55c3dcfb,0x00000a653ca5c9ea}, {0x000a7a45d185218f,0x0007846049335490,0x000c31e1f69a1537,0x000e9650060ea09c,0x00007e041577f86e}, {0x0002a496ce5b67f3,0x000d8bd56979666b,0x000a592cd0ff5492,0x000acb2503cec294,0x0000566943650813}},
+{{0x00058e2bce2ef5bd,0x000b46747bc637c5,0x000bbb89b8e4986c,0x000767a154a179f3,0x00007686f2a3d6f1}, {0x000836093ce35b25,0x0001db26baa974e7,0x000bc7b83f82e118,0x0009d3a0cc192d3c,0x000032f1da046a9d}, {0x000d12a66d597c6a,0x0000304d3852baa8,0x000209b0228f1193,0x00028a63f91dc73c,0x0000561305f8a9ad}},
+{{0x0009cd9014528afa,0x0004865e1f24739a,0x000a548c0b718e3d,0x000f16bd456d2593,0x00004738c64a64cd}, {0x000584cab013dc19,0x0001a0dd5c5807e3,0x000406aae843a21b,0x00003c077927bdd0,0x00004e9eefa8e428}, {0x000609a654966eb5,0x0002c12d628ff5fa,0x000f3eb939d0228d,0x00084f13d5557fee,0x00002f6c8135a4fd}},
+{{0x0002cc28e7b0c0d5,0x000bbdb075c53672,0x0007010a61709de9,0x000cc6ccaf68da7d,0x0000030a1aef2c57}, {0x000c978dec92aed1,0x000434d6d73e5100,0x000847ba48ca43d5,0x0004d2c83131b22d,0x000000aaec53e35d}, {0x0001f773003ad2aa,0x000802b2166087bb,0x00020ed23e0b3f29,0x00054807821dc865,0x000020be9c1c2406}},
+{{0x0005e25fd12888ea,0x00008448a758a62c,0x0009215582579207,0x000ae83154390a10,0x00005106224f2863}, {0x000dcf4dbc6145f5,0x00088fa7cd5e07a7,0x000b2ad7a2e1b03b,0x000dfe095ff92201,0x000026039a92ecfc}, {0x000ed5c47734a6c7,0x00011b24031291f3,0x000184c8ab08d132,0x000950b7b8542497,0x000050efd0d3a2ca}},
+{{0x0000e44ae2025e60,0x0002fcbdcb93820e,0x00095a0d1cb03b3b,0x000e311105d639cf,0x000069764c545067}, {0x000387d8249673a6,0x0002df546e493e15,0x00036f63b55943bc,0x000c1de1c7f9a81c,0x0000750ab3361f0a}, {0x000a3283a2f81037,0x00023bd7fcbf11e8,0x000c2e25636f2eda,0x0005040b72fd15ba,0x000054f96b3fb707}},
+{{0x000e65b2ad0d40f7,0x0007c35beefb63c1,0x000258b9e43594a5,0x00078f3a5eeb1211,0x00000e387534874f}, {0x000ba9800ac586b7,0x000db39db2070078,0x0007db5ef1ede8b8,0x000639ce1bffca2b,0x000005e20123fdab}, {0x000cdf8698070265,0x000661a445c640d1,0x000cc2f8830221e3,0x000ecdb03567dc70,0x00004c57dbe9bab4}},
+{{0x000dafc616b11ecd,0x0009cfa576479177,0x0006ece78589764b,0x000dbf0b7a8a110e,0x000078e6839fbe85}, {0x000df20429669279,0x000047d7d724a0fa,0x000c5760f13adda2,0x000539e6f3d94828,0x00003d7fe9c52bb7}, {0x00032df737b8856b,0x00043041a178a703,0x0000e59e2275d05d,0x0008242320ff74aa,0x000070f268f35008}},
+{{0x000108410cf7f13a,0x000f43d7b356bb07,0x000b9e876c7935db,0x0006a00e3b13e761,0x000075ee70d768a9}, {0x000e759689d775ee,0x0009a1388b22894c,0x000c849ce98a1704,0x0007b0b8994f1fb1,0x00000e28569432e3}, {0x0000e5f3585735e8,0x000521295bc1bdb8,0x000255792f79a7d9,0x0001097623f1d9d9,0x00003709eb10f0d2}},
+{{0x0004112070dcf355,0x0007ee7fce117232,0x000552b698380cc9,0x000c4b9b31ddeed3,0x0000404e56c039b8}, {0x00064583b1805f47,0x000d160dd7c19668,0x000e4cb006f535c5,0x00089d9e9874eb71,0x00007c0d345cfad8}, {0x000f1f4b8c78338a,0x000b167e0b5e1591,0x00045f3d44a0366a,0x000c7775cbc4152b,0x000020d754762aae}},
+{{0x000a3eee82009a52,0x000aa296204acce0,0x00056347e4730b99,0x0001b303c08ece0f,0x0000647899a3b6c6}, {0x000ec7aeb0639b4a,0x000684a8451cf64a,0x00068f1178737c4e,0x0004f10e9f2f4dba,0x00001ff5732b50c2}, {0x0007f5677007a4cd,0x00086c304318330a,0x00043403bba9fabc,0x0007cf1d6bba93d3,0x000013e600cfc741}},
+{{0x0004feb135b9f543,0x000f1de8c956c9d7,0x0007138ba984b37d,0x0004ce1e9322b075,0x000038b8ada8790b}, {0x000fc36fc73bb758,0x000a5363cbb9a5e8,0x00003bc922ace543,0x000ec62a9934a7d9,0x00002b8f1e46f3ce}, {0x00004a9cdf51f95d,0x000aecb1fdeacb5c,0x00028b66da2b3952,0x00019531d106d8b3,0x0000049aeb32ceba}},
+{{0x0008ececab815d08,0x0002662f3ab7dadb,0x000a7aea73fc7761,0x0006c7958d1a4484,0x00007e29f05ecb9e}, {0x00006a6dfafd3909,0x00088d240dde2973,0x0001e08686ce5b5e,0x000d6377e630bd73,0x00003b6298c56ff4}, {0x0008b87614ac482d,0x0008a20e5e43cdfb,0x000668d40a46b7a0,0x00088d9d6bfa584e,0x00007197ec427708}},
+{{0x00067d3c63dcfe7e,0x0004897856e40d77,0x00014f7c13209c59,0x00025fcb6676861e,0x000051c665e0c8d6}, {0x00007d0b75fc7931,0x0004b7a6725d3aa5,0x00096b39300fef92,0x00074fc1d82542b3,0x0000795ee17530f6}, {0x000a5b0a52ecbd81,0x0006ee034afe7254,0x000aee4a315d411f,0x0004477e6a24d0dc,0x00006cd19bf49dc5}},
+{{0x0007ad006eb53aac,0x000150c78320aa6b,0x0003d49af5607032,0x000ecc4e818fc641,0x000072c291a8e85e}, {0x000d9b987375953b,0x000cc8515bc1619c,0x000d3e5f70e7a628,0x000416389282fcd4,0x000028873e97b2c3}, {0x0001115e6c9572eb,0x00016079d83d26b6,0x000070eab4ad1a4a,0x000145b29675fc05,0x000019aa45bcfaf4}},
+{{0x0007619052179ca3,0x000060b2c9f857e8,0x000499711e571d0a,0x000e63880a2baa88,0x00007520f3db40b2}, {0x000e612165afc386,0x00088b8d51b101ff,0x0000990baa082a2a,0x00043e776f6627e2,0x00005e01b3a7429e}, {0x00050be3d39357a1,0x000dd599e94a53db,0x000f311e6e967b6c,0x000c9861a309a64d,0x000071092c9ccef3}},
+{{0x0008db0c26620798,0x000d9606e354ab81,0x0000a8cdc75d5c31,0x000e2d40982fa4f0,0x000017e12bcd4653}, {0x0002f9eb1dabb69d,0x00035afe853fc567,0x000796d66dba70b5,0x000727547ac0f752,0x000032a535179411}, {0x000644a6df648437,0x00059880fbfddd3a,0x000d3a1aa5703b65,0x0006468cb852540a,0x00000900b3f78e4c}},
+{{0x0008523f0364918c,0x000f43fab6b1c53d,0x000681e5a4a2b404,0x0007ba7080b4a9e6,0x00000ea15b03d025}, {0x000bd8ac74051dcf,0x0000855b7aa1e856,0x0009743ceb03f6a4,0x000abde3a4ae7cbc,0x00004173a5bb7137}, {0x00056e31f0f9218a,0x0002b1afc470817c,0x0004b2f1765a696e,0x0003a67f7931668f,0x00005fc565614a4e}},
+{{0x0008e29f62da9a00,0x0000941612744de1,0x000f0fc0ca152ee5,0x00087cbfa65722ee,0x00007e1f1d9635ce}, {0x000c24aa6138e54f,0x000da9a0a2fe5b58,0x0002276d33e0f44a,0x00067ad0accd685a,0x00002b2eb586d57c}, {0x000d39bd56b25795,0x000fe890ca63b435,0x000d49685baa1931,0x000179ee9cd60b45,0x0000713a7d4df640}},
+{{0x000e570dc46d7ae5,0x000cc54f8dc8f136,0x00010dad860fd0aa,0x0004aa159549f033,0x000062711c414c45}, {0x0002e1e67790988e,0x0000f1c5cd722489,0x0005923eed01d595,0x000651be3b0819ae,0x00003214c7409d46}, {0x0009827406651770,0x000668a279436132,0x00085d223c3ba4a0,0x000833cd9b6b8ec1,0x00005bea94073ecb}},
+{{0x0006e0415571ca82,0x0005864dbd47893c,0x000900ef5d63c187,0x000413cdbd3d775f,0x00005c6735e39ad8}, {0x0008844483dcd136,0x00062d5af2cd0d59,0x00022145237efc53,0x00081236b10bb3b7,0x00006b02001f987a}, {0x000ce80ed980722d,0x00007a1c0a9e2f8b,0x000a1a2542a1e8d0,0x000c6d7833038979,0x0000278a8aeebdfe}},
+{{0x000dbf0912c89be4,0x000317d6e579c641,0x000697b065acf38b,0x0001eecabfe9e02f,0x00003aacd5c148f6}, {0x0000ce63f343d2f8,0x0008f0543e8f1b47,0x0002117b6f0067ba,0x000bd2f35da51a1a,0x00004ad0785944f1}, {0x000e3b34c3318301,0x0004707316826858,0x00039da88cdc99c0,0x000853d34085b2ed,0x00003aff0cb1d902}},
+{{0x000425b4314ddab9,0x0007677f27222e12,0x0009ac0a3bc1a100,0x000d5f94443d80ae,0x00005c950468ef69}, {0x0006b4a227c5d1e2,0x000f67f8da8c6844,0x00002ac252691c1e,0x000a008a279157e8,0x00007156014ef85d}, {0x000f494a3cf4ce13,0x00010387120f1fc7,0x000403e0161e41eb,0x000026e29638075a,0x00003b6e19d65be8}},
+{{0x0005c7eb3a20405e,0x000efedad56c987c,0x000d29d5f98ee311,0x000251d29252e48a,0x0000110e7e86f4cd}, {0x0006430bf4c53505,0x00013261f2283922,0x000fd327c668e49c,0x0009e7f09ef33788,0x00002ccf9f732bd9}, {0x0000d89ed603f5e4,0x00028f0b0200c57c,0x00002e3bb7128886,0x0003a3753172709a,0x000005c557e0b969}},
+{{0x0006585311f14ae7,0x0006378de4ab4afd,0x000f40023bd4ba9f,0x000cfebb7f7ae99d,0x00001ada4c845c9c}, {0x000e42c0077747b4,0x00087a0a4631e71a,0x0005b3aaf737cdac,0x000fddfc7f5a712d,0x000013911eb9988e}, {0x000e651a6844fb87,0x0009f275c2cf79ad,0x0001d8a4e61c0feb,0x000c4057d9591073,0x00003ba99ffb66fe}},
+{{0x0009ce311fc97e6f,0x0003011f9fdaed8f,0x000bed25dd7a3f26,0x000875ae15b7ea08,0x00006e154c178fe9}, {0x0006bbb089c20eb0,0x000f6fa0fd85cf77,0x00034421fb61f85b,0x0001205b6b93f4e6,0x0000289fef084186}, {0x00016336fed69abf,0x000e78335c94fcf6,0x00053a7fe79b16e4,0x000a319137897657,0x00006afbf642a95c}},
+{{0x0008ac7e461df756,0x000a0443700278ee,0x000145a84eb7256d,0x0004f4526c5bdbf5,0x00002949cc82649e}, {0x000007d68e073ffb,0x000c5e9892d86f61,0x000793046207fcfc,0x000a82742e7695e9,0x00007b9820e93cab}, {0x0000eda6c5a64658,0x000438a458147b84,0x0008b8f01fd75dbb,0x0005009548e0f985,0x00002078ca3f4504}},
+{{0x0008de0c62f5d2c1,0x000a4b00e7b9a7da,0x000dad70e098fc3d,0x00038c47deb6ada0,0x00000db4b851b950}, {0x00055070f913a8cc,0x0007b2b0cf5615de,0x0000ead4897d1d16,0x0001ed9da2956b69,0x000012c093cedb80}, {0x00047f9308b8190f,0x000a0a11ae310fc1,0x000ac7d7fd06969d,0x0005ce6cee75572d,0x000033aa8799c663}},
+{{0x000a865c9d6f8990,0x00080ee9e2bbfa07,0x000ddc02a6ff0d25,0x000d58c76b8733d0,0x00007d9453a51ff1}, {0x000358526e258bd8,0x0000dc5d2b208680,0x000ead33aa0a5fff,0x000f85f8b4bbe1b7,0x00001b7a6f2be29f}, {0x0008e42ce9ea5e24,0x00015803fae07356,0x000f52a3a9b5b94d,0x000ff554aa1500c1,0x00004f26706724d3}},
+{{0x000ff51ebd085cf2,0x0008967d33f1faf0,0x000060033c78f51a,0x0001a866ec2bfe15,0x0000233c6f29e8e2}, {0x0008f588fc156cb1,0x0009b1a0a6d27834,0x0007ca5ab66da2ba,0x00089a6e2262d5c8,0x0000212cd0c1c8d5}, {0x0004d5107f18c781,0x000f2527e9d28d2f,0x000d3d3341122ecd,0x0004ce3a70a862a3,0x00001db777891191}},
+{{0x00013becf4c76f50,0x000f838ecace927a,0x000dc027baa10d77,0x0004dc128a74f04c,0x000027daefdccc4f}, {0x0003d90375d77fc7,0x000b9f7ebbecd1f0,0x000ae1ef28172b02,0x000ff44e2ac399c5,0x00006bb4b1ca85b3}, {0x000a05cdac8132d8,0x00091a20d7341391,0x000b62da01702cfa,0x000dde788ea806c8,0x0000589dec25c088}},
+{{0x000352397c6bc26f,0x000cc53d50113ddf,0x000f79a3307a97e2,0x000adfc7c74f43ab,0x000031ad97ad26e2}, {0x00094769dd701ab6,0x000d419cf8da5b33,0x000d2ac852e2b8de,0x00024be15df4161f,0x00007ae2ca8a017d}, {0x000817ed0920b962,0x000cc3f19da9db7e,0x0005560a641e8518,0x0002c83e491c14f2,0x00001ed1fc53a662}},
+{{0x00051b9f679d651b,0x00061033342f20a8,0x00088b30a3e108cb,0x000d714d601f57fe,0x0000371f3acaed2d}, {0x00080fbec816ad31,0x0005bd8e6efe3ed2,0x0006c623f552d959,0x000293c0fe71772f,0x00004314030b051e}, {0x0000005efbf0bcad,0x0002ed1870c5ed56,0x000084e6a08eb70f,0x0006670201f9033d,0x00004c3a5ae1ce7b}},
+},
+{ /* slot=1 [{1,2,3,..,64} * 128^(2*1)] * G) */
+{{0x00079dade9413d77,0x000d59729e67d78e,0x00037aa7e6f257f9,0x000039c59db910ee,0x00006aa11b5bbb9e}, {0x000d53265b0fd48b,0x0003193bfa988da6,0x0001d57e28896082,0x0008143d78ac9326,0x000079f2942d3a5c}, {0x000a2f25b6c88de9,0x000eaacf2016997d,0x000f4eb4e4251ba7,0x0007da509b44f87e,0x00007d90ab1bbc6a}},
+{{0x000692f8087d8e31,0x00037d27163f7360,0x0005ea5963f4dcc6,0x00060d925a4e6206,0x0000659bf72e5ac1}, {0x000fb9b05ee38c5b,0x0004e071a13c79aa,0x000933290abf9d2d,0x00097178eee6e6de,0x00001c3bab17ae10}, {0x000ab216c7cab7b0,0x0007407bbc3cc1c9,0x00004a58d57d65d3,0x0002990527447505,0x000009f2606b131a}},
+{{0x000248bcab71e8d1,0x000cf21704d387fc,0x0002776f92808f98,0x0004752fb0a44b70,0x00005dfe1c6403d7}, {0x000360a6dee7e770,0x00092aeb8d1a1d4f,0x0004642b973f772c,0x00022e656d285c99,0x0000379ab59dd615}, {0x000bd528d7522bf5,0x0007adaecda9ee24,0x000d82b1e5728a99,0x000ca4943bf96242,0x000079dfb624bd76}},
+{{0x00087d44744346be,0x000d415b52b2540e,0x00013b603e1d48da,0x000bdf77c3a8a18a,0x00004eb728c12fcd}, {0x00034c597c6691ae,0x0003d0a85b4c87e2,0x00054afae764889d,0x0009e1ddae2c90c3,0x00000a871e070c6a}, {0x0001b5994bbc8989,0x0003a5bdd4260330,0x0009d59e3c736bae,0x000d4640d61ade21,0x00003ee7300f2685}},
+{{0x0008b28eaffd75f7,0x000645bb3ccc220b,0x000ae13825060963,0x000cc1ab9a5ead23,0x0000681aa88b2c17}, {0x000b259508cd1471,0x000e91d06bb3057b,0x0007336cec09ffba,0x000ace3084562862,0x000064685f208164}, {0x0008c9d0e5369f76,0x000b71d7b7b6dc44,0x0003aefcd3ec2007,0x0005d18ac220d41d,0x000062f3c67d5e26}},
+{{0x00070019a3aeffb9,0x000676aff58e3e75,0x00068aa025673546,0x00015fdb4a74bbab,0x0000341be6e189d3}, {0x000ea9b34e0cad1a,0x0006df8f2a75a9ce,0x0007ab028dbe8f80,0x000d785ddab5c46b,0x000016a292a96b0c}, {0x0006ae4cd6292da2,0x000670e2dae28234,0x000cdf6f9e8ce4f4,0x000bc284a3d2d94c,0x00004351147c9f75}},
+{{0x000e4c7dd435efff,0x000834da2b4432d3,0x00048ec598374529,0x000389cdce746efd,0x000057f3959e8e43}, {0x000d90d0769ab291,0x00037769d24818c4,0x000775aea2619667,0x00066e3cbd9e65c2,0x00007ac31e46169c}, {0x000317e844dbfc50,0x0007442a39d37852,0x00063d9df1e79c39,0x0004f09092c5bb98,0x00005142370ac8fd}},
+{{0x000255e49e7dd6b7,0x0005c610b1eacf5d,0x0002e187ca801611,0x00025c23c99975d9,0x0000138157629791}, {0x000a7947841e7518,0x00059639c46d743f,0x0003052b74e5c6fa,0x0009030a1065e1de,0x00007d47c6a2cfb8}, {0x000ad0148ef0d6e0,0x0009a91546f3c3fd,0x0006bb81579d3e74,0x000ec8071ec62102,0x0000148cf58d34c9}},
+{{0x000c6bae0cfe7d00,0x0009d611fa37ab46,0x000a115a6f84b976,0x000bc0d349eac56b,0x0000493332c89dac}, {0x0000a8ac69194983,0x000cd5bfdb34cbf8,0x0000f7668b9142eb,0x000eb28d4171de40,0x00006b426667fa75}, {0x0008991b3aeec906,0x0002597b023f1c87,0x0005e281ce8d47d9,0x000d4ab6be244c8f,0x00007e8895f25c06}},
+{{0x00010290d5432689,0x0005851c6d65ba57,0x0008c641a27e84f2,0x000ea09bd6a1d2a3,0x00005a4e304ec51f}, {0x0001e6ebe250e18c,0x0006870cdf04a0f3,0x00060f7758964f1f,0x0003b3e7ca600892,0x0000460a7d7446ce}, {0x000a832f069575c8,0x000f2fbf4239518d,0x0008825801125de0,0x0008437d4a55b2e3,0x00000e475c5a7327}},
+{{0x0001ce2caebdefcc,0x0009bc4e83c02247,0x000e91eab92f5e16,0x000fe30a0ec17138,0x00006b8e93a45a3b}, {0x0000d8e5a4d8e2ea,0x0004b819396d5013,0x00091fd465bbe2eb,0x000ce4fc94a5bbfa,0x0000304709a633ba}, {0x000b44fcd965bb19,0x0001b090822e6e19,0x0009d055e8bcce00,0x000dc87b9706f34a,0x000079838a3e5261}},
+{{0x000492f67934f027,0x000bef6840aa946a,0x0009611854469984,0x000bbd45ca1bc2a8,0x00003ff2fa1ebd5d}, {0x00072f7d9ae4756d,0x000bb88f3487fe25,0x000960a88d56c345,0x000a1b99fd10b6d6,0x0000278febad4eae}, {0x000a681f8c933966,0x0009c20290c98b1a,0x00019d3c528c2194,0x000677b391152912,0x00004104dd02fe9c}},
+{{0x0008c0aa25c1dc2f,0x0005bda9c8b7433c,0x0007c761372b8519,0x0000f282adb21dab,0x000036e229fd0a2d}, {0x000e8ff95ac541fc,0x000a442d1ecd586b,0x00047ae4393189bf,0x000f74eafc171f1f,0x00001b59d2d8da26}, {0x000a88b2aae9969c,0x00011759a741e806,0x0006da14b9272b1a,0x00032d5ac84faee3,0x00005fbeef69f1b4}},
+{{0x0004c91d575d7272,0x000d677c2386331d,0x0005c4ed22925f95,0x0002552a03728b22,0x00003ea422b2596c}, {0x0007382bde27d024,0x000b8d44b8f1a208,0x0007f6ec4cb9f40b,0x000fc342f662cde0,0x0000016f4677705e}, {0x0003eb9530bad915,0x000b5d1ff1af2b98,0x000a12c03001bf22,0x0008947fefb6806b,0x000021136b6fc467}},
+{{0x000ff8e4906db3ae,0x00062d1afeb7a31f,0x000488e056588582,0x00073f5ff3c0a2c2,0x0000630e49bc171a}, {0x00071f8c0ea20839,0x0006ad8a58bc50e5,0x000643a76010c6df,0x0007baf9331d326a,0x000053a4a63f7986}, {0x000dfcdfb5cf6b86,0x00024efb65cd5c23,0x000906a2410e9f52,0x000b8d0ea8e13a88,0x00003c06182104be}},
+{{0x0002bf5e1124422a,0x0003398a33ab572b,0x000a52b666a1fa0c,0x00053d594cb6101f,0x00002c863b00afaf}, {0x00014e06db096ab8,0x000c90ce44f35812,0x00009e2af521a8b6,0x000a4816524c12a4,0x00000165b5a48efc}, {0x0000a474a0846a76,0x00084cd2f7cc0f19,0x0008aa2b8f12eff9,0x000c8b8695e29065,0x0000591b67d9bffe}},
+{{0x000250b3b1a08f64,0x0002861fa19192e2,0x0003cd3c6ca26de4,0x000941f8ab3adaef,0x000045e5b6ea53c2}, {0x000807295f129c2f,0x000ed4d21b08e513,0x0000ba3f5cf04e3a,0x0000cb83520b4f41,0x00006edfd391ebaf}, {0x000ae175252980d6,0x000ce59f0408ac1c,0x000650f607e1f4a5,0x000f8c8706ea355c,0x00000e4047f8ba85}},
+{{0x000b7dbb03c365f6,0x00043c67b91c1354,0x0002b775f82dcc84,0x000ff3b97cb89f0c,0x000067cc36d95a36}, {0x000a4276fa74aa28,0x000675c1e77a5dd8,0x00064d3a6492c222,0x00069425ee438cf9,0x00007f6f2470cd08}, {0x000b04f74503f1e8,0x000d810b9ce28add,0x00054548aedf91b1,0x0006d7ae5a1bdbb9,0x000046e899b3e011}},
+{{0x0000a377354608e2,0x0009f553161aa939,0x0000f6d61876cbb2,0x000cd86ad109715d,0x000039546df1f8aa}, {0x0005d3da88a9ead1,0x0003e7167d6e8fe1,0x000e05f4c799844b,0x000254e87c0af147,0x00005746d1202d60}, {0x000ca95ca3160089,0x000bcd74315f9939,0x0007f274cc7600e5,0x000a2027dc8d55a2,0x00003e6543756e11}},
+{{0x000f0d1c80b49bfa,0x0005eabf3ec8a312,0x000ef01c88597951,0x0007bcb727033c09,0x00003de02ec7ca8f}, {0x0009b3719f18b55d,0x000faa18c641e99b,0x00029f05ede465e5,0x000128b61081136c,0x0000489b4f867030}, {0x0002102d3aeb92ef,0x000b46116a861d23,0x00090baa24e16253,0x000bebf3d7eabe71,0x000049f5fbba496c}},
+{{0x000b8a1f0c276c26,0x00067cb14cc34650,0x0009973b6032c61a,0x0009c08edefc2801,0x00000225ab52df66}, {0x00042677bc53d85f,0x0000414b179b1ab1,0x0003f3ef762a831a,0x0006acc142eef276,0x00002887d1a80c4b}, {0x000471c80ef83244,0x000fe737bc25c734,0x0003e474711aad1b,0x000f2df72491d1dc,0x00003d74b05f6b09}},
+{{0x0005c900c446a1d2,0x0004127f520008ad,0x00092c352282d8df,0x0009ef59c8bf9a57,0x0000666f461f06eb}, {0x0000aa25c90cc20e,0x0003247200e30846,0x000bddfd34a03f34,0x00061e40e5d5ce57,0x0000698896d43406}, {0x000d2b5270da7fac,0x000ae80d9f2045e0,0x000a8598b47a2ae5,0x000d670bfe8fa8e6,0x000033526d024922}},
+{{0x00041786cf728883,0x000622bd84f30943,0x0004321c1e8528e3,0x0001356cdb6504d0,0x000010b7ed439b4b}, {0x000f3828bf75a4b9,0x00035bc6aa85ca85,0x000ad0a8cb1641ee,0x00096f2a62c1d047,0x00004fcd0a811480}, {0x00084c43905c0e48,0x000b2b4f673f2bd9,0x0006bbfa92a7a5df,0x000846f7a0cf94f5,0x00000ddf382ce2fb}},
+{{0x00049a108a5bcfd4,0x00070bc6473eb309,0x00007c0d1cdc40dd,0x0006e7492c294c13,0x00005604a86dcbfa}, {0x000d628c1e9c572e,0x000acc5884741155,0x00015763eb8a4d86,0x000515b91a352f65,0x000006a1a6c28867}, {0x0008d1d47c1764b6,0x00040e0418b51728,0x0008acf6d1725411,0x00042c69f031a601,0x000020989e89fe27}},
+{{0x000572815c5fb394,0x00063a810ea702bd,0x000ad1ef4179a953,0x000bae946009f320,0x0000569df3ab9ba6}, {0x000339181be00cd4,0x000f1cb6579adaf7,0x000aececf5aaf462,0x000c231b099fb562,0x00003fcddbfe4171}, {0x0005570c11bf4768,0x000569b3d839da08,0x0007b96e0eff869b,0x000fd8d87ede29e3,0x00002e344905a3a1}},
+{{0x000e8fe2abca0a36,0x000e3599a9de0641,0x00007e053e9afa14,0x00063dc2521379ab,0x000041b270774439}, {0x000ae5d833fabdf8,0x000197fce37927b4,0x00011d8d468e7044,0x000268c3d6b751c4,0x00002a254327c06a}, {0x0008f75726ed4464,0x000ddf2ae0a73d1a,0x0005a2e08c9ee691,0x0009cd143ebe6a58,0x00007cb7bcb12b94}},
+{{0x000e8bdf64ce9d8c,0x000d40fd441d3c5f,0x000b83fdbea36b8f,0x00025543de099d6f,0x000022cbd97f7b13}, {0x00028afe45edba0b,0x0004708fcdf92d99,0x00008314bd8b5c55,0x00028001c88b6840,0x0000085d22a6ef50}, {0x000f98b3bef793ab,0x000233fe9eb2012c,0x000b34677d141504,0x0001be693761d85a,0x00000d7fb414a485}},
+{{0x000777fd3a2dcc7f,0x0002ca54fd892499,0x000207e3a032857c,0x0007e29a279d864d,0x00000403ed1d0ca6}, {0x0004278b85eaec2e,0x000077acb2bdf167,0x0001cbf45a5621dc,0x00095d3640a4c166,0x0000730b9950f705}, {0x000b2d35874ec552,0x000cf98246f8dc94,0x0006c035cec5e6c8,0x0003dccf7cb46fa1,0x00005bd745430830}},
+{{0x000ccf2263cca098,0x0003c58b18a20d12,0x0001f13fb77b7cab,0x0008100d008a7755,0x000015061a9ad1e8}, {0x000b591eaf8d83e2,0x0008f5da6d5f4543,0x000976e4e85b57c1,0x000f949ad055b05f,0x000024bd37c881d5}, {0x00048a5d9575cd51,0x000cfed48106914d,0x00038737f1780e99,0x000cc0945c802b4c,0x0000573fc206b02c}},
+{{0x000c6bd4dae40d47,0x000e2bd33f6b3ba5,0x000de8a8dfb09d87,0x000ff6ec9fdebc2a,0x0000589a69545f87}, {0x0002a73dd9b7e1ea,0x0002958186a9030b,0x00087bb08450cb8f,0x0006c5ef4c21f054,0x00000c11c8ade65a}, {0x000a6d58e1827f07,0x000a9c73a9a0de96,0x00050d3ca6ad44a8,0x000f26102042befd,0x00004e41cc9fc9a9}},
+{{0x000a54143f381e81,0x000fa5f21d47ffa0,0x00051845994461f6,0x000c1b7eecfebb94,0x00004a49d68b1deb}, {0x00028238b354a567,0x000bf7eedc658c9d,0x0004ec4d73356cdd,0x000f4490fca743b7,0x00003ae6b5c881d0}, {0x00072916c90f9041,0x000c61021d2b6070,0x000a380f896c6c21,0x000bd247a9516a16,0x00004987e58f76b6}},
+{{0x000ad19528b24cc2,0x000656335c1817f9,0x000fc072367f6b54,0x000ad8366b8b66e4,0x0000133a78007380}, {0x0004932115e7792a,0x000a2bdcdddc985c,0x000da3d762c64c89,0x000f82c9d1e3da8a,0x00005bb7db123067}, {0x0001f467c6ca62be,0x000d6211952ee096,0x000bd5477004ec21,0x000e0d2182360779,0x0000740dca6d58f0}},
+{{0x0007e23e414b14d8,0x000fdc3ad8116414,0x000254e19e158fdc,0x000303b00cdfb5e8,0x00001bf2d9948674}, {0x00059609d7cce486,0x000e3dc3cb0a25dc,0x000a403e01604680,0x000635989ba3cf36,0x00005026abc1fe2e}, {0x00039c02456161ca,0x00004691bef8ec3b,0x00016df5e7974e90,0x000266d3e97d1c77,0x000034948bf88fc2}},
+{{0x00062a4f41e52b8c,0x000484f330b04b29,0x000383a795d1de35,0x0003087bce5ca9a1,0x00007712432e7e97}, {0x0006639621828349,0x000402f6a0ca9b20,0x000c2eee54bf1af8,0x0005f3f47a2cb31c,0x00002a76c9bbf07a}, {0x00016c0d83e1ca60,0x00031fdff1939bec,0x000ccd41a8dc9526,0x0005d1337d76753f,0x0000444d032521b2}},
+{{0x00001d5caea44bcc,0x000f9b45accd4186,0x00037ca785f24db2,0x0007679e2d9b5519,0x00007aa31998fed8}, {0x0005f82410db7fdf,0x000ed4fe49cbd62b,0x000d60eb57650289,0x000e62d826672b1f,0x0000482e427f1e0d}, {0x00035ceb9473c8b2,0x000b4a933a8a3eb0,0x0009476d5a05de7a,0x0008a71690b32e57,0x00002021cc23a4ee}},
+{{0x00096048dce43aaf,0x000315a280ce6969,0x0009a663f2c76f43,0x0008fbec1b949c08,0x0000103235cc1b24}, {0x0006f336dcbab6b2,0x00012d3ddfe7d788,0x000fcad7aafa0cc6,0x0008cb8794400495,0x0000428a79c1e6dc}, {0x000c367f4a713b5b,0x0005b1aa51896cbf,0x0005445aaa2e7cdb,0x000c87762f9e05f9,0x0000715262d4127a}},
+{{0x000d760408206b18,0x000db53683870843,0x0006f3a89eedd330,0x000c78a9bdba92ac,0x0000762f495ec613}, {0x0008eab6754cdaf9,0x000c1cf551a71185,0x000e9cb1f8a90d3b,0x000719d122053e9f,0x000077d2e58062d4}, {0x00092c005235f48c,0x000677f1288f1153,0x00085187794cc315,0x00033abcd2bb5b37,0x00000107ed6df8a2}},
+{{0x000a7f06c4aec047,0x000495a404874866,0x0002595cb2e7f2cc,0x0003cdc80526b782,0x000017a3a289c823}, {0x000ceebfd0fc46c8,0x00040bdf3c2674b6,0x000c8bdf7e4b5799,0x000dfc1fbfa82495,0x000041cf9ff9d014}, {0x000d53611147f2c0,0x0001fc981763f62c,0x000e9692a16c380f,0x00065827bc80d713,0x0000047919744739}},
+{{0x00078956d415b656,0x0008bd4d39cb78b4,0x000094323879e9fc,0x0002be1d2e013bb5,0x00005ef8d5b37348}, {0x00099778ed5738f1,0x00068e583840261b,0x000a7196f8a1bec1,0x000065e479965343,0x00000abe109e5417}, {0x000020338a675606,0x00032851e63203f5,0x000b321bb6a943aa,0x0003ede1ff176d90,0x000038d081102c5e}},
+{{0x0008c92566bcfeb4,0x000f00823e66e90d,0x0002d08b4101f5d3,0x000652aaf355a573,0x0000231640de4658}, {0x000faf2a977c6a08,0x000c9776aa07957e,0x000a944187979bc3,0x0000e757cd9e4e73,0x000070287d2c82e5}, {0x00045a96aa81046b,0x000f1980dbe4260f,0x000e595f325d2184,0x0004e881704bdb85,0x000043851c16d833}},
+{{0x000ec6078e44cfc7,0x000acba6eb9c3a79,0x000d5875c145205e,0x0008a32c0fa54368,0x00004e5a3d2aa5df}, {0x000505e792f20a8e,0x0002c0a2a43525e0,0x000ba20659eaa376,0x0006f95d21186287,0x00004fb8f76ad12e}, {0x000acb682b540214,0x00057b3a368c41c5,0x000e98510f4a5c20,0x0003c555d6edeb3f,0x0000310c24cc5940}},
+{{0x000f06a257759f4f,0x0009422ac8a6b829,0x000038bb7cc004ca,0x00072bac9f5acac0,0x000011727dba8c71}, {0x00037017a1f6a53e,0x000b1506c8a28afa,0x000f76ebf5c8a6d6,0x000ae97793c31430,0x00005a0e8b88be8c}, {0x000b666ad8da3260,0x000cc24864c119c8,0x0006afe06afa372d,0x00012e13ebadd863,0x000003d244f41ac0}},
+{{0x000aec75b72a92de,0x00071afe73f022dc,0x0009f5caa8e3ec52,0x0005e0eca96adf9a,0x000012c687e7b42d}, {0x00005c20b0e952b5,0x000d9970f55102c6,0x000375ecc8d4f0bb,0x0001b15d266bad98,0x00002b02dfe08673}, {0x0004511c51d4ba93,0x000850e405157509,0x00082029ea689366,0x000bce8a535753c7,0x000024195bbf6890}},
+{{0x000dc3432b75ef7f,0x00027bde1163bbb3,0x0009be40d73761c3,0x000ea7a9771a29c6,0x0000638cfa67132e}, {0x0008e1b5e20733cf,0x000b4c2af079faba,0x00008858d809bab1,0x000fa9738ab9a022,0x00004218447a5274}, {0x00059318190df1f8,0x000af7bfa339232c,0x0009c971c7b91706,0x00045d81ad396109,0x000040b74afef2be}},
+{{0x00028893648ed1a7,0x000798ed1de11cf2,0x00029a07a48461ee,0x000e50208e850f69,0x00005a3f0e016ca5}, {0x000d682cb8d87645,0x000308f5cdc72398,0x000187b2466eef3d,0x00044f998be0c67d,0x000055ac7ff167f1}, {0x0006ce63338f71f9,0x000c916216482cfa,0x00029f696c819b5d,0x000f85eadc249e02,0x000022c81aa95e00}},
+{{0x000092e7fbaa6656,0x00004f47b40f8f88,0x000cfe9eeac41312,0x000e2393b846b238,0x000012848371f977}, {0x0006f5ab5f3a8b9c,0x000c2784eaeccf41,0x0000bf2fb4642e48,0x0001dd977b3dfd14,0x000061fe75725096}, {0x0000458ba46cc9b1,0x0004e4fbac9f5a0f,0x00095c65348ea4de,0x00097fec3afb91ff,0x000008b4c70ca9b4}},
+{{0x000051a4409282ad,0x0000b2728b893a7e,0x000c3dc4332be946,0x000970df96ba5e7a,0x000016a1e433369e}, {0x0008027d1a48c514,0x0008d9aaff108807,0x00076b1550797db9,0x00052c0e7cfcd1e1,0x000060e389da1502}, {0x00044ebb71be1237,0x000bea4f80316b66,0x00044b70080a0c30,0x0004f00246422113,0x000043518b7e1822}},
+{{0x000061e4810fed7b,0x00074cf9a4cebfca,0x000f70fd855f0d54,0x000ee960a1f08244,0x00006c62b751b795}, {0x000dd0b66735aa76,0x000dfd3531ec9836,0x000a374f38b63fff,0x000896ef4f1893b2,0x00003f591c4e0c4f}, {0x000fd9fa35f26feb,0x0007218b6505b147,0x000b7fa58f085f02,0x000601143df16387,0x0000317be8e4d691}},
+{{0x000093cc157e527f,0x0000943818ae46fb,0x00029061644baf84,0x0006aef01e7ce4ea,0x000075c5be00fd4c}, {0x0002225e3a67e165,0x0004e12eedc23de6,0x0008d4715b2ed341,0x0005c07781758c9c,0x00005346835214a6}, {0x000ad424216a25f0,0x0002f2545f37460e,0x0008ff4acc3c435c,0x000546020a5e4a33,0x00005b0b56bfe507}},
+{{0x00001b8112d58612,0x0006e365d15d2e25,0x000d4df107c1e8b9,0x0002a20b0ff4e89b,0x00002cf9e2c003ed}, {0x000c0b7c19f1ae3b,0x00036af69af9f4dd,0x00059bd1dc8208e6,0x0009618f1fbdab64,0x00004912970637a6}, {0x0002f530d4d0a50d,0x00087b0a923d6730,0x000597a339f6aada,0x000ec37754030872,0x00001d9277936c77}},
+{{0x000120a9e63a115e,0x00028ffe22158b73,0x00041f77c83d4708,0x0004357d655ca65d,0x00006b0e65b99e1c}, {0x0004a8c81a2d2c99,0x0006e54288400559,0x00045440081d89ef,0x0002584801a6151b,0x0000589eb7367ac6}, {0x0009ee96a9c190ba,0x000f33ee46376f21,0x0002e03c9384d754,0x0007f57bd7f6dbd2,0x000003f98b639053}},
+{{0x00092c7901c1c104,0x0005973dcaa1bfb0,0x0002176c5da7300b,0x0002cff0acaf312a,0x000071039a31e29e}, {0x000ca3b8b8dcb339,0x0002522c4d78636f,0x000ce8d5ff23a68b,0x000288ae7a001662,0x00004a6ff1b1aaca}, {0x000d90ed40a3c01c,0x000e7b5ca297e245,0x000272a62a0519e2,0x000922e6977c60ab,0x0000632f8aed4a84}},
+{{0x00006bb1d8e29a0e,0x000065d4bdc83b9d,0x00018ba1566051c1,0x00072728e1afdeb2,0x00003349b721ed89}, {0x0005814365786fec,0x0000b167d540c55c,0x000526504e368e66,0x00016b2285657f5d,0x000017dade25f788}, {0x00063d15f1b9f45b,0x000198b6cea7f0bb,0x000f4bd7047702f8,0x000d96ebfd7120cb,0x00002a73139ab4c3}},
+{{0x00028b001c60a77d,0x00073ed1b8d2d7aa,0x0002135631892512,0x0002e95c36e16ddd,0x00006c4bb10554a9}, {0x000f35cf1bc12198,0x00032e5ce7356c1b,0x000cc0c08228dbee,0x0008b05874197021,0x0000175e1d5c8919}, {0x000687fae22a0b32,0x0000a7b5087658c8,0x000a5c2adf3059d7,0x000d005950e013de,0x00005bcca07f3c13}},
+{{0x000e61553370d006,0x0007bf61fed7e944,0x000c61b648acbdad,0x000211a3b31055eb,0x00001bfc187993d5}, {0x00017bee27d2cb01,0x0007cb392a45c430,0x00061945770f0963,0x000a1962da72238c,0x00007f7b1baecc45}, {0x0002e7c96b257128,0x000288a05c598f0d,0x000611ef3c7e6a40,0x000d1221d7f54d43,0x000036f696c54be6}},
+{{0x0006436f86ee10ee,0x000cfa8d7288416b,0x0008bc9fd7cdad16,0x00099732a80f857b,0x00005daa1454ed41}, {0x000b745f056baa18,0x000749ab9614dd82,0x00086a5474fe347f,0x0001f8971817efe0,0x000036731694b87e}, {0x0007b7398104cf17,0x0002d4ea2dca4080,0x000fa43bd6de6a5e,0x000af9989f32abf2,0x00003e11a7903ae5}},
+{{0x00047cf0acd1f84d,0x0003f77518554632,0x0002e5a74ace1d21,0x00053d92193531ef,0x0000439563c7f4b6}, {0x00016675a3702e48,0x0005a554a3bc42b1,0x000b2ae44e64912a,0x0003c0045743a37e,0x000040fd9d335ec8}, {0x0004bfbb5427dc7c,0x000601601911e891,0x000f7982a08a869d,0x000a7c82f7c4d4b8,0x00002d00ce56de23}},
+{{0x00090f2fa6d92102,0x0008dc37d0ff442b,0x000fc7e88bcf83ce,0x00063f57b5b9976a,0x00000f04b0327c88}, {0x000ace871a619d72,0x00077f978a096e76,0x000a07c87a8339d6,0x000cccc371fab92d,0x00006c67f72c6a16}, {0x0008a65fd73964e4,0x000ad6f3dc3b487a,0x00043d7695397018,0x000e463b17c0d9e2,0x00007343291fe9f3}},
+{{0x000910ce4956401b,0x000f79b0db97b049,0x000bf182a3271507,0x000f011acaf7ba32,0x000029653de76772}, {0x000ade87f6cb4395,0x0006788a21038984,0x000fa27c2e76a6f1,0x0001e634e334fa19,0x00004ec114f0b4fa}, {0x0000882a2c6b1356,0x000cadd1fa122ff8,0x000aaefd0bd14783,0x0007341b3d15abd9,0x0000793daf6a27da}},
+{{0x0000b15640790ae7,0x000328181585899e,0x00017bdf117386fc,0x000c2f8e15997850,0x00002034c0a6aab8}, {0x000e0b01223457fc,0x0004e7890a48bb20,0x00084f39e85b7ca1,0x000d0229ffb4a580,0x0000577d0f10b46c}, {0x0005a369e1324158,0x000b1f6f644e5051,0x00046420c6a08104,0x000d0ba64145e78c,0x00004980e4cde591}},
+{{0x0005776b2cca4197,0x000970acd9728a4c,0x000a6b67bf23eb9a,0x00052cc21f21d1b2,0x000053226b7a49a4}, {0x0006fdd12fc1a1fd,0x0000035c5ed12032,0x0007a3756d90c80c,0x000fd0634ad2f6ba,0x000016b6726a12ca}, {0x0002b3e81ef8ed32,0x00011e81836be596,0x00049dc8ec1e520d,0x000f3868481fc0a4,0x0000550398bcb4fd}},
+{{0x000d262c1e0e364a,0x00099f0e7a5fbfd6,0x000f4ac55ae71e81,0x000e40f7dcb45b00,0x0000126d0a8c98b6}, {0x0007a749ead8f72f,0x0004bac3fc3eb0f0,0x0008e229013a1e65,0x000fba8cc083a437,0x000075380c7f91f3}, {0x000a37579ddb312e,0x0008cf2b7887805c,0x00002bc35f0c6a66,0x000d4fecc4abd6e6,0x0000314a583b77fb}},
+{{0x000edfd3a5be9567,0x00076d707c99b8cc,0x000af424e73b2c9f,0x0000592c2482d0cf,0x0000259314176842}, {0x000bb351eab5c0a8,0x000f8f89bdb4cf22,0x0003f8ee493ca22c,0x000d5f24ad548e40,0x000002b3bf8d7492}, {0x00056a8ebc926f7c,0x000f023fdb147b98,0x000d0f5ac99dd63a,0x0008869f22162b87,0x000031d49a4941ed}},
+{{0x00070bf5d3f0af0b,0x0008ae32e71f750b,0x00055bbd344feaf4,0x000d1ed60e84ed3a,0x000000ed489b3f50}, {0x0006c72aed261ae5,0x000d988e100f7390,0x00033601979ab68f,0x0006d47f5e9059af,0x00000e53dc78bf2b}, {0x000829bf7971877a,0x000636d17e631b90,0x00082768935e4444,0x0004af54d05c52e1,0x000027632d9a5a4a}},
+},
+{ /* slot=2 [{1,2,3,..,64} * 128^(2*2)] * G) */
+{{0x0003d7beec2a4c38,0x000830acc20edd83,0x0002df75812c9162,0x0004a81e93a47aa9,0x0000702d67a3333c}, {0x000a369a2f89c8a1,0x0001d7c8de80d3a4,0x0008eda01563137a,0x000b03fbcac008a7,0x00002cb8b3a5b483}, {0x000417cbcb1b90a1,0x000aa7f11794e36e,0x00085bc60733b3dd,0x000020d3f5108088,0x000024141dc0e6a8}},
+{{0x00073c773fefee9d,0x00089c1cf989d59f,0x00002e545fb3f1ef,0x000b47ce35dfb42e,0x00005766120b47a1}, {0x00025dccbd83157d,0x0005322cc8094919,0x000f90d6e43ca120,0x000767b28e57f183,0x00001a4714cede2e}, {0x0000ba0fb8b6b7ff,0x000b677511fa1db2,0x0009f02d89b732c3,0x000a5f1a92b51c09,0x00004f3875ad489c}},
+{{0x000c762f4932ab22,0x000f72f4c3c1bc7f,0x000aa895e87ac0ed,0x00000815f6b55aa9,0x00003680274dad0a}, {0x000d13f6ee73eec0,0x0006d69110bb179e,0x000603860ca5c652,0x00059f5e48928c38,0x0000722a1446fd70}, {0x00059fe9a8cf8819,0x000508475a99cd09,0x0000b09cc5d0a995,0x00010956eac17332,0x0000628ecf04331b}},
+{{0x000cb118a9d0ddbc,0x0003408b4802b98b,0x0008a6b104ee449e,0x000915d87089226b,0x0000685f349a45c7}, {0x0001acf85c74ccf1,0x00081082652519b4,0x0001adb147b67331,0x000b40f99c92aed1,0x00007a47d70d34ec}, {0x0000c4cbcc43a4f5,0x000ca3677bea960a,0x000ff8f5ed775c66,0x000fdc0a17aa1752,0x000011ded9020e01}},
+{{0x000e7809caefe704,0x0006de30e8c6c890,0x0002aeb1c9872829,0x000531f4c5cd2a39,0x0000194263d15771}, {0x000f95b03bea93b7,0x000d43313abd3471,0x00017e3f7b0552d7,0x0005becbd9370e2e,0x00007b120f1db20e}, {0x0002fb3d86502d7a,0x0004450a6935217d,0x00060ed75db564d8,0x00036aa7da962c8a,0x000000d0f85b3187}},
+{{0x000b142e777c84fd,0x0004705a8c062978,0x0007e612c7f40264,0x0006a33a67ad51be,0x00002f7b459698dd}, {0x00053c1efd7621c1,0x000a7445671f5a67,0x0005b23c1169c0b4,0x000c7cd971f52740,0x0000387bc74851a8}, {0x00094b4d4a52a9a8,0x00012f6b8832f818,0x00061bd638add93e,0x000f6cd184d8548b,0x00003f1c62dbd6c9}},
+{{0x000f1f0091910c1f,0x000e0bff2e12c2e8,0x000e927438a4df4f,0x000c8fa60c6560ae,0x00006338283facef}, {0x000d3e40148f693d,0x000e194eb9a723fa,0x00084f4e2f052656,0x000e18b2f4dcbfd1,0x0000406f8db1c482}, {0x00030d2c7f191ee4,0x00001bc3ff6709e6,0x000afb73c44fbf83,0x0008fa5787d8e4e7,0x000050d83d5be8f5}},
+{{0x00083916c11a1897,0x000efe506d008856,0x000664bd012d69a4,0x00017c639af1378f,0x0000659421313615}, {0x000ccf90b4d3b66d,0x000e561732e60c0a,0x0000c6b0baa7059d,0x00046e4033d1f787,0x0000584161cd26d9}, {0x0002b1a072d27ca2,0x00059fbdec704bbf,0x000262b81ebf393c,0x000b589e98dbbcee,0x000002eebd0b3029}},
+{{0x000fb073ae3d086d,0x0008434568e0ca6d,0x000967a9bff856ea,0x0005fb5429ed3f6a,0x000057467f4986db}, {0x000b18302f01c5ce,0x000a0cddb4c130d7,0x0004d71f18d99f75,0x0007fba8812abb6c,0x0000094e6c5b3a6c}, {0x000ec029470eb49a,0x0001068651f7a17d,0x0005c144cba317c7,0x000d29cd90ce1181,0x0000373c08363537}},
+{{0x0004389b4ddb283d,0x000b030d49d32906,0x000954e6e993824b,0x00014ca4b5eb27fc,0x0000644b402003f0}, {0x000499bfa04b014e,0x00074d7cdd77b195,0x000a82937470e3f7,0x000d34fa49a39673,0x0000474ce2ac366c}, {0x000ca75b8b029d89,0x0002857c2c710e80,0x0004f2935b835d43,0x0003dbbc7c1465af,0x0000434a6317be46}},
+{{0x0007897ccdb98c1d,0x000ab5dbfa325597,0x000e16d363cbe44e,0x00073bf1633d95cd,0x0000491f53157f5e}, {0x000942ac9a07b881,0x00054281520947fb,0x000aa7aee1be06d5,0x00031664729680b8,0x00000ae8ac0e08a0}, {0x000821f3112fc11f,0x000480e6f9d757ad,0x000a5079a0093c55,0x0002bb0c30be88b6,0x000049a231850f5b}},
+{{0x0005107a4d935737,0x000d89be48321204,0x00003107e4678360,0x000fefeb9a0d6dee,0x000045028fe917dd}, {0x00017689a0711a50,0x0003bda1e1b2026c,0x000f5f17a7faeca8,0x000f98056bf1ed0d,0x00001f88bd9fd43b}, {0x000f3c0373726586,0x000b4f2aed50b3a8,0x000fe2a1360455e7,0x000c30a3634e2a2d,0x0000109075126d95}},
+{{0x0003044dd014d647,0x000b5ed2274d3833,0x00052383afd16dcc,0x00051c226934f6ea,0x00003c84268f69fa}, {0x00008751c61c37ee,0x000d8057b758eb42,0x0005854aae9d6c6a,0x000baca7b8d35c39,0x00007486b74f1f2a}, {0x00066a3b8dee941b,0x000ba03dd260bc0b,0x0008c1826361f76e,0x000eaa465cedd687,0x00004fef52df3d58}},
+{{0x000ab0d938802819,0x000098581dc45a5f,0x0002c42959642443,0x000d367017032462,0x000043e58acb2eba}, {0x00050f5e783173c8,0x00051f5734076b85,0x000c3921f3c78303,0x0007ba844ba2a954,0x00002a9f19c71b4d}, {0x0009a5e97b6ef8f4,0x00098380f274fece,0x0001f0f3455c076f,0x000367fdd80f2219,0x00001371bc2e007c}},
+{{0x000d6112248721b2,0x000f42847ea5c3bb,0x0001fb9e4943a417,0x000b7573c039d657,0x00001d26ce478de1}, {0x0003a9812f8df865,0x0007bfd83556717c,0x000741c9404b4610,0x0000528df4229ba5,0x000070ae13ac03d0}, {0x000fbf5ed7e53de3,0x000f35b4ca403d6d,0x0000082fc464c3ba,0x000f22796391cfc3,0x00000acee51c1dc9}},
+{{0x00068756a60dac5f,0x0006aebabdc57613,0x000cce0f7d17e02f,0x000dcf07f193f2d4,0x000020234a7789ec}, {0x0005b69f7b85c5e8,0x0008bd168bab2876,0x000d330f9b6ff067,0x0008e7c3a70e77c1,0x00003a5f6d51b0af}, {0x00020db67178b252,0x000f9d51ed16076d,0x0003e41170071c34,0x000e366f62a4a20b,0x00007cd682353cff}},
+{{0x0006ba819c117a08,0x0001b084d19270c1,0x000c0c16c9a01719,0x0003642957778c82,0x00006f4ba78fa27c}, {0x000dc2438aad2c5e,0x000bc264b2ace9e2,0x0007009685f021af,0x000c7cb30b8192ca,0x000042e6bfa4b5c2}, {0x00031f3b745bc2b7,0x0001a18d7388ecd9,0x000471fe92db50ff,0x000f5850bf9be6b8,0x00007ba57ab2173b}},
+{{0x0000ceb08285fd26,0x000e12dd18366560,0x000ea82c02021423,0x000ce2eb956a35b1,0x00002ec42d609cc9}, {0x000ed798c364e459,0x000067e765db00c5,0x000ddc269a4b30e5,0x000fc18cff983107,0x000010dfa8d1368c}, {0x0001a9ce54e237d8,0x000aa18831a7d4e7,0x000f5dce23e3cb1e,0x00009bdf64cf3a5b,0x00003fe6fb978bb9}},
+{{0x000088969a68e59d,0x00067fc12472c955,0x000a894a1a5ceb9a,0x000189bdf910763e,0x0000511c2ac83172}, {0x0005fea0fb098d39,0x0004c116a70f2501,0x000f9a1ab04ccef8,0x000267886974709f,0x00000739edc41fe4}, {0x000d7fda6a765ef1,0x000f1638a8be9957,0x000ae86de59a144f,0x000e9a8e49ca35a0,0x00000af7bc0b5cb4}},
+{{0x000b429185b56004,0x000b8de859e71d0f,0x00020f3f88c59bd0,0x000b1eaebb63de27,0x00002d23b7368082}, {0x0009babddffd31d0,0x000778e9e3b5c59f,0x0006884099db5cf0,0x000956f5d869571a,0x00003fa02b627b17}, {0x000de55970620108,0x00020ff54343713c,0x000e1a580f088cc2,0x0007520db795c58b,0x00001f7882bce218}},
+{{0x000735e4cf5efbf3,0x0006f68774121b89,0x00006222a3ddf214,0x0004a9dc67100860,0x00007148a8be2670}, {0x000b4ab52e772361,0x0002909f28f0f561,0x000970b02615b070,0x00090dec3a3962ad,0x000016dfdcbcb0e1}, {0x0005c5b5e5f54db1,0x0008ca2492e27824,0x000747ff6c7ca7e5,0x0008b682b7bdc029,0x000060030624d795}},
+{{0x000c136b06dcd4b7,0x000d492890d05f77,0x000196778ecbdfa3,0x000f4293338b6b22,0x00005aad733705b6}, {0x000b36534ec3ab21,0x0000fbdf5a3b78d4,0x000c72748ecd883a,0x0000e318146b2c90,0x0000193270a77532}, {0x00064b4718be72c6,0x000cff05a3911420,0x000600249f333ea1,0x00080f187804ae72,0x00001f76e114671c}},
+{{0x000a4d99d9e4cca6,0x0002663ecb62adb3,0x0009dfa89d151ded,0x0008c8bdeed865b4,0x00007ffc16b466f9}, {0x00036c42afd8f5ab,0x0009bfb5f2efc3f2,0x00057375e97a1857,0x000ef8b61ff17536,0x000046fb801aef33}, {0x000f5df232dbbc43,0x0009fbd893f07c1f,0x000b3d6f14fa0d86,0x000344f66c787d09,0x0000413a966eab34}},
+{{0x000b7a1f73ae6a31,0x00092cd09778acf2,0x0006d20c0ab55997,0x000b30525eb0f50f,0x000041fede25c6fb}, {0x0000ca7f8b5cb1ee,0x000235dc7b18b9fd,0x000c3b2a5ac1246b,0x00025556d64dce5e,0x0000508b0de7473e}, {0x000f4a753566b61c,0x0002f7a0bd6fdba3,0x00073665cbb4e968,0x000e24848f39f12c,0x00005c4ec39194a8}},
+{{0x000547cdf3fc9a3d,0x0000fb76659b8281,0x0001af3b7cfda507,0x000dacb187c2acaf,0x0000199a8b6a3b74}, {0x000cd5831bcf7ccd,0x000e1f01413a24ad,0x0009557f58b233d6,0x000c6e8502828314,0x00002814663e226b}, {0x0000f41df0707a52,0x0008d2ee69d33916,0x0004cdbfa7af8c05,0x00023534c39f1ec4,0x000044c407e190ab}},
+{{0x0007b6ca45e9058b,0x000c2ead4cd21e00,0x00039409b91496a5,0x000ff090de2e601a,0x00006f6c9aeee935}, {0x0006e2f8e59e9430,0x000ba09bc27a8c68,0x0000f00c62484f71,0x000595a1084c2060,0x0000292800dad75c}, {0x00002e52fa594277,0x000821092e6dfd6f,0x0004a72e482bb866,0x000832fa190447f5,0x000047ed754212da}},
+{{0x00002103527b6ce3,0x000618fb6f708264,0x000dbedac53202c9,0x000373c13f8b3855,0x00006f4d1fdd7143}, {0x000001ae69336ffa,0x000d4323e8eaa1e7,0x00013ec97b81f3ff,0x000e05b81a32250c,0x0000599cbfd40f07}, {0x00007d3e67eba758,0x00002d028b5011fc,0x0008ef1134e79103,0x000c262d161699c8,0x000077808c6204b2}},
+{{0x0007c57870c7c84b,0x000ac8fe2be138c7,0x000552d4a3474acc,0x00088bc0a857fbfb,0x00005c8fbd2471ad}, {0x0002b91d56eb287b,0x000454835efd14a0,0x000e8d95c22bc4cc,0x00099eda46bfbb68,0x00004fca003af91e}, {0x0005ec8a729ab797,0x000e9ae5ef55c972,0x0003c4c8cb1e9741,0x000d91f56612c070,0x0000360fb6166884}},
+{{0x000f1d0e59ddbcb3,0x000837cce783236a,0x0008c5304dbdbece,0x000a7e60b3b1d0a8,0x0000341cca6f4a0b}, {0x00000908b6696245,0x000d1a85acb94b35,0x000d1ee6b856bc30,0x000e34c66ef363f2,0x0000185b69e8ff6c}, {0x000053a60bb8f9b1,0x000cd45dc91bf59d,0x000d194950b4beb0,0x00093d445ac7cfcc,0x00004e13521d5114}},
+{{0x000e63c29f08110c,0x0008e943abf0d501,0x0004a409e9bdcb09,0x0007eb0622b93438,0x000054d722348c39}, {0x000b75707eb029cd,0x0002bc18210f7dfa,0x0005fb27419a3fc2,0x000c511956bf8461,0x0000286e0d778a66}, {0x00047b14af301385,0x000cd96d8a4ceb02,0x0009e25b0b1810dc,0x000f80dd411ceb79,0x000007daeda58ef7}},
+{{0x000f5ed6085d7f0e,0x0002ede36cf039fc,0x0005ea6f2da95092,0x0005198ff6d9ae67,0x00003c3aeb4fe211}, {0x000f733258769aa9,0x0006bdc9f3c94760,0x000acca156bc98f6,0x000261904860d591,0x00001cb7bb4821a8}, {0x00048cbe922a4c48,0x000766c694e39b2a,0x00094ca2835aeb57,0x0007c202393cef63,0x000050ada2d287c0}},
+{{0x0001a45bd887fab6,0x00032ba403b6e0be,0x00096e60002a846a,0x0000943d9921012e,0x00002838c8863bdc}, {0x0005cd6068acf4f3,0x000183cd7e3d3a66,0x00036025d942d92d,0x000d8ff5759389d3,0x00003ef0253b2b2c}, {0x000bb0cf4a465030,0x0004115c577abd16,0x0004ab419dfa496b,0x000281282cfae8af,0x000021dcb8a606a8}},
+{{0x0009ca88d6efd0a9,0x000f9e2fa216599b,0x000ee7b4fa73694b,0x0006a254f8aeb87d,0x000040424f213d48}, {0x0009644ce02dc648,0x0004e7f53e632142,0x000b8419e1c7a93a,0x0004c890b4f79148,0x00006a9aacc09b19}, {0x00018899b0725c70,0x0004be95c9afbdb2,0x000168f464892f7d,0x00050de9bd8f881a,0x00002450e0488d0f}},
+{{0x000741db7b49e529,0x0001c0aa01df447d,0x00055ea07d6054af,0x0009c83d05b587b3,0x000075de85c451d8}, {0x000a3ef03e16eb93,0x000cf30d9c1bcd7b,0x0007ebff075c4479,0x000b976d29e20b8f,0x00002dd6f02c2a58}, {0x00078be62ee693a3,0x000bf5ac2edf5848,0x00072e4db363f06f,0x00018fd1b5c92a7f,0x0000756eb101ce5b}},
+{{0x0005acb79ad3de13,0x0002cb3d1158ac9f,0x0006bd57caa995dd,0x00092a08b2bb7619,0x0000774f76165ddb}, {0x0002ccc1cd4ceb6f,0x000667ba3aee9f05,0x0004c739a63f2f80,0x00065160326e8f78,0x00004a864b4579c9}, {0x0004316b622cd024,0x0001ce63855fdc3b,0x000f4c3739647069,0x000595d7988330a7,0x0000422058981c2f}},
+{{0x0008a15f2dd73890,0x000101f418e11e06,0x000a54e11baa3ab7,0x0004568775983151,0x000074afc5120afd}, {0x000c308f404c00ae,0x0003caecba2dabe8,0x00012a13e94b48d7,0x000a7613f4aba0c2,0x00004f750eb9a880}, {0x00012b6a472952db,0x000cf33df186c8aa,0x000300778f4e1613,0x000588b617cb5b3c,0x00007a5adc23a580}},
+{{0x0008e475afd0f7fa,0x0001b23a1f02adee,0x000c81d4ea0ab458,0x0004522b5aed1930,0x00004abcf6485376}, {0x0002cb16cc63d680,0x00027d72ab4f430d,0x00050b2868e091be,0x0004ec6ece4b0abe,0x00004cdc2e14be2e}, {0x0006cdb70e59e7c3,0x000b9a866ac3996f,0x0005c944d4a0be28,0x000faf58ed92a4ea,0x00003b382e7bfc64}},
+{{0x0009a3916d7379e3,0x0005420afbe5d16a,0x000a3b3bb9d0bb2f,0x000d1d3862449144,0x0000319813149d06}, {0x00097d89aa3d4261,0x000a5f1e7e83c21e,0x000834e8d74e1711,0x0009805596b15806,0x000040fe3bddc970}, {0x00082230b6396ecf,0x0005126d0c47fede,0x0006dd1c0604f6ac,0x000fbbf908095675,0x00003defaad0f2bf}},
+{{0x0009fa7b3300d56f,0x0001e9385079831c,0x0006177437ea1465,0x000715c2eee38d30,0x00000338b3d43d32}, {0x0009c99954aa056f,0x000a8e983fff3ffc,0x000367778d6d83d5,0x00072f84357ade43,0x00005a90afeb03fb}, {0x0008e97fb310c295,0x000cef77df7cb1a6,0x00053fcad16e69f5,0x000a3d7aa2ef4efe,0x000036d6c9984baf}},
+{{0x000aa7d93ee5f2c9,0x000db1ee159d1c7a,0x0008788d5b51272b,0x000c99cbae8f9e16,0x00004d44c4645da6}, {0x000f77f3f4d50063,0x000b4440d1ad08f9,0x000439359c3a740d,0x0008211389156635,0x00006913f1449e77}, {0x000aa675d4b609c4,0x000be08acb744c45,0x000cd3556683743a,0x0003db4b662bbc9b,0x0000006057d83912}},
+{{0x000e30357c70c8c6,0x000dd53b14895d6c,0x0003ed1deb0c657e,0x000a279d5dfe9e9a,0x000066b55c4ff815}, {0x000d2548e684bbc7,0x0003bad9740da47a,0x0006b698bf7de5a9,0x00029df70821a054,0x000021d04fb70f04}, {0x000c8e0eef5552b5,0x0001232cb6ae9eab,0x000fd8240ea895af,0x000c6de25671128f,0x000053fd0fe8e647}},
+{{0x000a7d0efa1d4ce8,0x000caecadf839361,0x0006d111156a9010,0x0007cc47ef378ce6,0x00005866052bf26a}, {0x0001259e4b9e2fe0,0x000f871b62e0f591,0x0005d3f176b6ed3c,0x0004acbfb774c8ce,0x000047337bedd7c6}, {0x00035ac47a2291bf,0x000fc695456c2481,0x00036166e3feef1f,0x0009fa65c14ef50b,0x00004693786f6c75}},
+{{0x00025bc79253df1d,0x00066aa7a2d0b8fb,0x000e31d35a60c5a6,0x00091010bc7240cc,0x00001d40e0405c14}, {0x000a165901332986,0x000cd764089fedb0,0x0006d1e7a2022ee5,0x000da7313d28b050,0x0000550d16c006f4}, {0x0008c5ed0286f1c0,0x0000538f22ef2b7e,0x0004df5a007ef8be,0x000d4e3360601617,0x0000550048900910}},
+{{0x000831526ea463f7,0x000ec026a56f3e8f,0x000d55bd8e4cb13c,0x00019d43222c93e0,0x000077381f0a45e9}, {0x000c8071b3fd3d24,0x0008476e70cd6c7b,0x0003465389ccde1d,0x000525f6549ddf74,0x00007a9e0d016ae3}, {0x000e8aee6bf3784b,0x000ca499d8df4dc9,0x000d17d49da46531,0x0003d4d39e41acf6,0x00006657d71f8802}},
+{{0x0001d25e5ee6fbd1,0x0009b40e47e1a979,0x00099eca4e190c0e,0x000705ae538c6e0e,0x00002a76d19f80a7}, {0x000e8adba3b6c684,0x000d7df81f767e2d,0x0003e2afe0a263ef,0x0008196eb9b838c6,0x00003388ce3a79f9}, {0x00035c55a89962e3,0x000d87244356fd02,0x0000ad7ddccfe7b8,0x00095c9413bfff95,0x00003030dce318c8}},
+{{0x0006b0f24362826c,0x0008688729ea97fc,0x000db8d04314c95f,0x000b7a62200ea4b0,0x00005c4acab72335}, {0x000c52307df795da,0x000859cf5db330ce,0x000a0fe29ce9a1ca,0x000b2c0f3d4b592c,0x00003912f1356988}, {0x0004dd189150d88c,0x0001dfb6dd7baa2c,0x000a5d3d4e4f2402,0x0007007521a9321d,0x0000437d0ac67cb9}},
+{{0x0006c6ca34983a0a,0x00071c9e6180314b,0x00071e59b80a8e0c,0x0005a5b25cb7766a,0x00005e354c250983}, {0x000a007cf8dc60ab,0x000c325e38b709a3,0x00084f59adef9aa2,0x0004b878ba298e78,0x00004676d44e1d69}, {0x00018682ad0ddfe0,0x000bddd81e6a7365,0x000f6e4e448c9012,0x0007ad95b85c8ebf,0x000029c83400dd7e}},
+{{0x000004468c9d9fc8,0x0006ed42aa3cb5c6,0x0002ee2f9c254009,0x0001dab125b4d4c1,0x00000bc3d08194a3}, {0x000d00fabe7731ba,0x0007e629e18899a8,0x0003f3d97f820360,0x000678bb2cc02374,0x00005d840dbf6c6f}, {0x000e380d309fe18b,0x000a6b9e165c7706,0x000dae20ab6eb02d,0x00096dd57bbba997,0x00003a4276232ac1}},
+{{0x00087d388dcf701e,0x000cd0b632982b05,0x000b78e129c8f345,0x0009c1b84261e65e,0x00007b370f3415e3}, {0x00022818af064c32,0x0007b2e7151f2ea3,0x0005f7a2a0563de7,0x000b5c8d5889287c,0x000060ea6b4df4b8}, {0x000d238cd2800ccd,0x000a3bc44d73b6a1,0x000bf5505d099d59,0x0001835dfc0e5e4e,0x000002e6cc8f011a}},
+{{0x000d97b6bf993b8e,0x000e47321b548fd9,0x000774e852fbc643,0x0000b33fc5f021db,0x000063280e40aa4e}, {0x00034a8e5c763c68,0x0005d4c02060a615,0x000f102bfb5f6d4c,0x00047786c3984bdf,0x000032a67f30fe32}, {0x00046b4fae5f4ae4,0x0003d55ecc9d7452,0x000ac5a5998985e2,0x000eb479781a6fd4,0x00002d0a8cc7c7ec}},
+{{0x000dcd51e3cd9cb3,0x00050409e68cc27b,0x000a6adb20589667,0x000e1af0759fc76f,0x000067cebafd1152}, {0x00065047fa0720a9,0x000ba50759fd31ce,0x0001c545f65236bb,0x00099cbcda18e1c4,0x0000729c7dac5d4b}, {0x0009ad03abe2c744,0x000b719d2177c63b,0x0007645d78a91115,0x000c51c8d9ea17bb,0x000012c3618ef217}},
+{{0x000545a295a2ab8f,0x000b049e3e0d85ae,0x0002d75981e30237,0x000717b47e1eafd9,0x00003224f6f6e0ba}, {0x000e3ce7646adaf9,0x0005c1443661b3a0,0x0001d12f9492434b,0x000a43c6bc21cc95,0x0000218fac425bf0}, {0x000a617a53cba588,0x0007644203491086,0x000a244ada5bf314,0x00032df14d8bd4ec,0x000039ef737626f3}},
+{{0x000426d57c8b9766,0x00052c5b6fc7858a,0x000eee0d4380272e,0x0002137cb37c2b47,0x0000063e200e111a}, {0x0004d21bd242bb9e,0x000b393ab85b780f,0x000336f6eeed13c7,0x00094a0fdc3bfe04,0x000000608778ffe8}, {0x000c89375e6d9fab,0x00006076afcadaf8,0x000ac3577a454708,0x000d8e82c8eb7f28,0x00007f5bf47abd11}},
+{{0x00032890399d9f07,0x000dbe73df42c115,0x000a5c36375a77e5,0x000a5210422b0c34,0x000078d7454d2b33}, {0x000fa3b9e842a599,0x000498d3f60212ec,0x000295085486116f,0x0005349b8eb274a2,0x000001f6c379696e}, {0x000b82368849015e,0x000c007c8b7a13ed,0x000f85c62e1d26f2,0x00000dc43c78eacb,0x0000508c3a840187}},
+{{0x00078685bbbb2a49,0x000e8836f654a81d,0x0003c2a647da52a0,0x00075c751b3c0ef2,0x0000098855ce5298}, {0x0004c68105372b1b,0x0008c9c4ebace65c,0x000cbf7c8511d7a3,0x000252ce1843d15e,0x000047398c9e969e}, {0x000a8c3c5ef17b08,0x0004e8eec4251f20,0x0000d73ca924fae4,0x00045bf3d7abc11e,0x0000430b43a0552f}},
+{{0x000aa76ae434ad5b,0x000096eb69f861b4,0x00062b9e1b04977d,0x000ed310ad19fa8a,0x00006f6359310dcf}, {0x0001a4540a083187,0x0003824c3256d034,0x000fd05910c1a6e0,0x0007ff6635871eec,0x000028f53f8d1260}, {0x000798cc33c06bb2,0x000fab4f44acbc9e,0x00014bb0d16ea566,0x00098b2b47938c97,0x000023d2ad95c944}},
+{{0x000fcce961c75f08,0x00062cc112b0b24f,0x000f415b082d3f02,0x000cd4293f3d11de,0x00002865c1207763}, {0x000cb3efb5675a5f,0x00021d534d70d62f,0x0002acd9663f1e8c,0x00044d3948b75a78,0x00001443cd82be4e}, {0x00039107b46f1ce1,0x000c438a19e515ca,0x0006090bca4b4f79,0x000d08aeba5da281,0x0000473201488896}},
+{{0x000868cb09119a63,0x0009d8b8356242d3,0x000faed1a5f4818f,0x000ce38cd50d8d9a,0x00004155ba925045}, {0x0009e962caeceab5,0x000c923190c13f6c,0x000199642853a5aa,0x000c4b2199bde7c6,0x0000661485a92aae}, {0x00071eaa8da9d281,0x0003bca361ce6d27,0x0008e363e4bb4597,0x000a832891058c57,0x000050059256984a}},
+{{0x000473654c51eeb3,0x000c0483e680c2a7,0x000909135d7d7020,0x000f115485082b21,0x00006d76d92eed4e}, {0x0006f14b580124ac,0x00010231b57c7619,0x000f0ca2ca7c575f,0x000d312aa0fe9af3,0x00000b15f4b621db}, {0x0006362e64fd5a26,0x00029b638f1c8bc8,0x0000b47244517af0,0x0000c358167f9cce,0x00006984ab0ab743}},
+{{0x000e2258b5dd92d2,0x0008e3a509c0d38e,0x000f965055044469,0x000e96fb0e2bef8f,0x0000561fc3190493}, {0x00086d2207eadf66,0x0006558218f9bb7c,0x0005188ef7df4427,0x000485641203c6fd,0x00003c160f77d611}, {0x000300a1aa4cd92c,0x0004f8689c21697e,0x0002ef78db5cd4c4,0x0007b59e1ecba806,0x00004b1d88c88b3f}},
+{{0x000a6d3348c05651,0x000f8b0b6353d013,0x000062c708e3095f,0x000e1a6ecc735e58,0x00004d33bc5c3404}, {0x00079a73494b8279,0x00073f4e57080415,0x000354abe4e95813,0x0001a60b194c7084,0x00003bc0ef41a504}, {0x0005708029ff2db5,0x0009a6a8dd7277d1,0x000ed452c13352cb,0x0009612bab7fd5e9,0x0000650d5cb08ad9}},
+{{0x00069e1b716947b6,0x0004efe3f984e1cb,0x0004b8d95c760843,0x000e836880452355,0x000074d0fba1c2f5}, {0x000e40dc7c88e483,0x0002610cfaff6b4b,0x000fd21aa59f6330,0x00087bec408a9856,0x00000bd19924cbf3}, {0x0001816ed0a4c928,0x000947054d42132c,0x000775041a636c49,0x0005d3d461cb274d,0x00000e6e566879d6}},
+{{0x0007517fd9d6e4f1,0x000ec36b0a53262b,0x000dca8934f8fc39,0x000888617d88e6a5,0x0000141d5510a0c7}, {0x000027b1fff6e0e8,0x0001d7489d39b4c9,0x000cc0b4df47b8b5,0x000fbe4bb73f4065,0x00005b456aa3e72b}, {0x000ee0b9959867af,0x0009af126edd1751,0x000bffed9560d4ae,0x000fb790e6e3e33a,0x00003044a36c588d}},
+{{0x0002432c8a7084fa,0x000e3dfb9e5454b4,0x000c58e45d898a19,0x000ebd1be9f00219,0x00001ff177cea16d}, {0x0008c172db447ecb,0x0001fc6282dbd3bf,0x0005aa15fe5fcfc4,0x000a9f980acffc07,0x00000770c9e824e1}, {0x0001d99a45b5b5fd,0x000e91b3a7924cf6,0x00003e3e89860984,0x0000b1ee73009193,0x000039f264fd4150}},
+},
+{ /* slot=3 [{1,2,3,..,64} * 128^(2*3)] * G) */
+{{0x00038d28435ed413,0x000603278ccc942c,0x0009da03efbd50f3,0x0003355bb07ab1a7,0x0000269597aebe8c}, {0x00010e4c0a702453,0x00066d57d1bdeb9a,0x000d27daf70fa258,0x00033fdffb9d9b5c,0x0000572c2945492c}, {0x000fc745d6cd30be,0x000d3e3baaefbc77,0x000a5dda0ce4dfe8,0x000ca80a22c8830a,0x00007f985498c05b}},
+{{0x000a3bd617b28c85,0x000b739773bead30,0x000e6a5cbfc5d377,0x000b7c4c6c6e78c1,0x00000d61b8f78b2a}, {0x000c03580dd94500,0x000a46fbbec9329f,0x0002e2a7f8ecd27a,0x000a1d5130a155fc,0x0000416b151ab706}, {0x0008d7efe9c136b0,0x000cd58e44b2056a,0x000b57e0abbd07e5,0x000e8d2afe62fda1,0x0000191a2af74277}},
+{{0x000f9399287a03bb,0x000c8f2cb27e0cfd,0x000dccce88ca3378,0x000988ffadc628fe,0x000073ca56bce0be}, {0x000fcb30cacc8521,0x000406572971a0be,0x000c7d02adf4445b,0x000bb2e8181678d4,0x00007e168be4c930}, {0x0000728374645878,0x00059d27f5b4ae84,0x000639cc2eec091c,0x0001d162f4d72e47,0x000067d9b63dd451}},
+{{0x0000095bab6f4985,0x0005b4fbfaf1ad55,0x000a0c754004f4cd,0x00022869d8e2ed12,0x00002bc24e04b221}, {0x0004b60b2fe09a14,0x000afdbb1747e09d,0x0008b5fd6ec384f0,0x0009b0a58e2ea897,0x0000519ef577b5e0}, {0x0003d7d91124cca9,0x00045b88a708e186,0x00057031f57ac081,0x000fae52bcd73098,0x000062337a6e8ab8}},
+{{0x0001b6885402fa73,0x000d32d92f4e8df7,0x000961c0dd60c07d,0x000f2f442b2ed364,0x000003f42cbc027b}, {0x0008521e9d4c4be7,0x00001e1bccfc9154,0x0006b76bf66fc103,0x000ec2ea01f92992,0x0000048f47129ed5}, {0x0001ff93178945b4,0x000655aa397bf4bb,0x0000189b74c39a1b,0x0006dfad90514936,0x00006732736c0a95}},
+{{0x000576badbb1786d,0x000b3f6d51f09be5,0x00013fc975af60e7,0x000ba71516313214,0x0000156b0979ba4d}, {0x00091633658feb1a,0x0005230aff19bcfd,0x0008521c7cf94a65,0x000e39630affec16,0x00005a0d7dee71e3}, {0x00052be09c516f34,0x000539c8fbb9e5e3,0x0005b9dce4a7e21b,0x000cfbba45fc21e8,0x0000587c9a4d88ab}},
+{{0x000ce97af860d6c4,0x000cc6393d463680,0x000b8d8412d914bc,0x000360f89a30cb11,0x00006e16e6f3c464}, {0x00022bf334b4c858,0x000175e411094a96,0x0003a1b4f57cdda2,0x0009ff31856bedd3,0x00005257e2813e4a}, {0x000178f457b4785d,0x000cdecc716bac71,0x000ac49634bf4139,0x00096782a7524e18,0x0000649e81f935fe}},
+{{0x000ef17f06ffca16,0x000db692ae16a4bc,0x00014f42b0de06e1,0x00012d00753702d6,0x00005f6041b45b92}, {0x000b324e1b3a1273,0x000f181055340d1a,0x00098c196e18947c,0x0001e683b5d9567a,0x00007fa00425802e}, {0x00031574028c2705,0x00069db0d75fe7d5,0x000f8c8ddd80317d,0x000e99830fface8e,0x00007e9de97bb6c3}},
+{{0x000b2959064c889d,0x000b6d3e38b68995,0x000299a4efb480fb,0x0009a4195370ce1a,0x0000776a6310ae59}, {0x0005821d34bf356e,0x0006701e9dfd0458,0x0004488c1699c90c,0x000e09e3812b13e5,0x0000470b533deb29}, {0x0005dc9d9aa5bf1e,0x0009b00dacafc595,0x0006fb37796cd101,0x000af433e8f9639c,0x000079ee30e204e3}},
+{{0x0007883afdf0a92a,0x000f4049ae78674e,0x000d8f7b118c061e,0x000ceb53e5478b3e,0x00007fab904a200a}, {0x0001ac4d453c624b,0x0004d4f14ac444b2,0x0001b2adb960e024,0x000a023f3858bcb7,0x000015f37fbdba08}, {0x00008aa1a5873b3d,0x0006f25a128baef3,0x0007c1023429c98e,0x0004a138cc7ef68e,0x00003af0456b9882}},
+{{0x000b8282a1a2cf1f,0x000d0ce38de08be7,0x00032912e0327b7e,0x0005f043876f6cac,0x000000331b04bfee}, {0x0003b5a87cc85552,0x00020fb0cbef4dff,0x0007e5aa26a95297,0x000bb95460fa84c7,0x0000556e51307ab4}, {0x0007e7f306285e48,0x0007ed01a16722be,0x0000cf8e082163f2,0x000337c3bf6d28c5,0x000053f7e058de95}},
+{{0x0008967b9e6585a3,0x000e098e98b92155,0x000eb3adad97c99c,0x0008cfa10af149b6,0x000042181fe8f4d3}, {0x0004be62a24d40dd,0x000910452d41ff00,0x0002a44234ba0659,0x00066ef81c45ee16,0x00004cb829d8a222}, {0x000caa8407b86681,0x0001e8b26753b1db,0x0004048e81081f00,0x000f22c3cd7ce6a8,0x000078af11633f25}},
+{{0x000c1528543d1ce8,0x0001da173f98ee21,0x00013f09c1a19a2a,0x000472a048f8ca65,0x000057f41ea08dc5}, {0x0002810340377bec,0x000580faf0f781ec,0x0009a2bd9dbac5f3,0x000c06a943ab3824,0x00000e47a470febd}, {0x000a523a639c030e,0x00036b907a05635b,0x000b3b6f36fa799d,0x000a9bc3c58c6e64,0x00000cf3e25a9a8e}},
+{{0x000ea75b738afd3e,0x000f72746af6cee6,0x0001df6261e1987f,0x000e707852d470a5,0x00005371ab84cbc6}, {0x00089a96253123ec,0x000f7a99d29145b4,0x000dbb91ea2c71af,0x000afc1ff65d197d,0x00006deece75f7fe}, {0x000ca0be9b94ba04,0x000bd5fc6a4d0186,0x00052f8b2438e70a,0x00057dfb75836075,0x0000167c27241226}},
+{{0x000830ed52f4d864,0x0007cb0df5c5e32c,0x00045268702aeee6,0x000dc02c535fabbd,0x000066ca975e90c0}, {0x0008d45a5e58c649,0x0001aa56ea11f0d5,0x000115b7bbf5aa4c,0x00078e2ab9ace0b2,0x000078f0cb036a12}, {0x0008d63849b11e9f,0x000a62d568dfa824,0x0006a50daf0f50e6,0x0000234f687af42e,0x000054d717275c68}},
+{{0x0006ebd40b50babc,0x0002628208bee841,0x0009c1c36d150872,0x0007d5da3148fafb,0x00000d07daacd32d}, {0x0001c00e7d65318c,0x000dcd0e86de7324,0x000bc08c26e6bee5,0x0003dc3118b2dc2f,0x0000680d04a7fc60}, {0x0002414a695aa3eb,0x0004c05a68f21f9c,0x000f93963edaa42c,0x00054e37c6c23987,0x0000210e8cd30c39}},
+{{0x00017ff3b62b5150,0x0006e59988b08bf0,0x0006da651aa868bf,0x000031e1af37d071,0x0000627a66284af4}, {0x000d4de4d57d343c,0x000a9f2200bdcd3f,0x000d5b5620c37601,0x000d1b7fa1fd680b,0x000032b7bc8af5d3}, {0x0004a342f973ab6a,0x0009a0ace36b5336,0x000134c8dc651274,0x000f41f7628e182f,0x000024e9dd285734}},
+{{0x000254751ef89bf5,0x000a440bbac104aa,0x0004031f66d8bd0d,0x000199be4b385c07,0x000058913c5ac5a9}, {0x000ba93656c8fc88,0x000c0807f89780c1,0x00094a7a3cf8323b,0x000c07c897e5e3d1,0x00001bcb0daba97e}, {0x000203bd741992d7,0x00007618cff8e8ac,0x00044001f6951846,0x0001b6b3d18bc48e,0x000078c83cd410e5}},
+{{0x000ace23dbfb015b,0x000b00011684e880,0x00020aaa6c174dd7,0x00025c2f188b0719,0x000000a0bb8b6059}, {0x000bb00b69dfbfdb,0x00090ab592fb9d9a,0x0006a87ea8839dc4,0x0003f9b22dec47e9,0x000036806ce8220d}, {0x000ba9894156416e,0x000677e9404a62ee,0x00038a9d473c0ef9,0x00076d5e6114c907,0x000043399525e79f}},
+{{0x000201f210a71c06,0x000aef3bfb021ac4,0x00093632f76a65e0,0x0000742bc42c35c3,0x000056ea8db1865f}, {0x0000f16137fe6c26,0x000d856e404d82b5,0x000c561f6be102bc,0x000ec9112b0f1414,0x000051b17bc8d028}, {0x0005fb4bcf535119,0x00079df1108a0fff,0x000a3ba325f4989d,0x000a6f2bdfcea659,0x000018a11f1174d1}},
+{{0x000f870f13185235,0x000fe533e0ff063e,0x000427b2e4146ed0,0x000a5a4a125c1252,0x000008db985892f2}, {0x000b025f1a0634c1,0x000926d2ebfe4b2d,0x0009f27de6288f10,0x000bd15f017e45d9,0x00001354b4daf3db}, {0x0008b2af6574625a,0x000a2d758f8249ab,0x0003120cd0547b39,0x000d2817566d8205,0x00000258f102ed74}},
+{{0x000d28792d62cffe,0x000b5c2fa9427866,0x0007926f095aafb5,0x000f73819a06e324,0x00001e18b7a99bef}, {0x0008c935d45844f0,0x000e2404ccf001cc,0x0007e7ad105668ce,0x0004839ce4720059,0x00002d5d7ba0728c}, {0x00003f3a2c603e0d,0x000dc5fcbf827d0a,0x000b6405976d481c,0x000f402ed7eadb1c,0x0000593b0b48db1f}},
+{{0x0001789e2a74e5aa,0x000a768e2b6133f0,0x00034c282f38635b,0x000ec09f6d656a10,0x0000160174eb7266}, {0x000bfcd5f0a19f9e,0x0009051409cb7da7,0x000999bdfba77c26,0x0008ec4903a569f5,0x0000154fd69686cf}, {0x000eacff26d03e1d,0x000952248eb5973c,0x000fdba48106f926,0x000e9be02bbc1ec1,0x00007c8be1bfe786}},
+{{0x000375ab3f6bba29,0x000d8991e482e407,0x00055f92e99ec3b6,0x0000ae199c80e82e,0x0000307c13b6fb0c}, {0x00063cdad27a5f2c,0x000bc8aa106d7fbd,0x000e64a430f00fc4,0x0002e8553fb5c1a8,0x000004eaabe50c1a}, {0x00051021cb8ab5e7,0x000495c5010eb247,0x000e5610a1fc2344,0x0000cd55f1e717b4,0x000044da5f18c271}},
+{{0x0001adff6e8fc85f,0x000a3bce2c01d802,0x00004ed9f3c57213,0x000d89f51cd59264,0x0000295ba1e36c7c}, {0x00089a02d58e67a9,0x000b1bd0d7e0b52b,0x000bfe4676dec202,0x000554befb52b830,0x000025878a174488}, {0x00028d0e52f53d3b,0x00069803abf14dee,0x000664c70fda5486,0x000264c46639ae6e,0x0000156c9e92db16}},
+{{0x0001e37f73208204,0x000cc15aeeb69aa8,0x000d24685ed8fdf6,0x000611c4aa2149af,0x0000590a2f65fe6b}, {0x000dbaa8a739d1e9,0x00094315a165ec57,0x000c4ef6681f14b9,0x0005b04280c14936,0x00001b1dd89d8fe1}, {0x000424b4c5a29cad,0x000a81ebe34fa931,0x000d256dd40de691,0x00099bae59cb009e,0x00001e77740bb104}},
+{{0x0001a7729b2d70d6,0x000a49d131a10bf5,0x000c11ba3f582fec,0x000b39d49c25a228,0x000037fcf256ddd9}, {0x000e2d67d97fe1ec,0x0007c9b0b29306b1,0x000e21610b9b17a6,0x000201a64271b828,0x000038658a115035}, {0x00068baf014b72ab,0x000be1da5b2b5400,0x0001a4ce191627ce,0x000dbd232611311f,0x00002fb832e82289}},
+{{0x000cc55ff1b82eb5,0x0006d411cae52033,0x000ffbacd3b15ae3,0x000861fba40b6198,0x0000768edce1532e}, {0x0006fe6b89d8eacc,0x00051e23126a1915,0x000944eb4ee6b794,0x00003aebd7463d93,0x0000726373f67672}, {0x0005ca72eb7ef68a,0x0001f70eadb23e30,0x0004c45b68662cf3,0x000ecbd18f026fdb,0x0000513b5384b5d2}},
+{{0x000140c51745ae6d,0x00028765527da529,0x0008e5c733ad8e18,0x000ada7be5feb288,0x00005b3377fcad76}, {0x000b922b31d3e01c,0x000807cde94aca70,0x000bbf3292bd10cd,0x00045e6dc71b0965,0x000077c46dde9542}, {0x0006d1f90f13472e,0x0005c6cadef78fa4,0x00055b7f1ceec2aa,0x000ac550c5c33ed3,0x00004f4d450c16e7}},
+{{0x00009c6524623242,0x00048387f51ad78c,0x0008324c21e56ccf,0x0008404ec944b4ca,0x00001cc2dc48c6fa}, {0x00014b75c34e2286,0x000121505592e3cd,0x0007ad8a44a381cb,0x000465433b7074be,0x00000c0a71f20b5c}, {0x000d890cec3c94c0,0x00097c2415e431c4,0x000167a2db4600e1,0x0007beaa796da1cf,0x00000e93bc0f53f7}},
+{{0x0008bd6fd55cf718,0x000773f885549e58,0x00035d656aa1a072,0x0000d3ada437ab88,0x00004904add8e805}, {0x000a03a4228e6bff,0x00009c1dd5b3cb59,0x0002cab31a146fed,0x0002c004dd2a90f0,0x000034d15caeba7f}, {0x0006d44828bb5e0a,0x0006e8687197ba3c,0x0005f062c7b41689,0x000e08ebff00905d,0x000012487ce2cc82}},
+{{0x00046280c729989e,0x000d05368a5dd46d,0x0001765a894b93fb,0x000a22363df3f81d,0x000034cebd64b9a0}, {0x000702878af34ceb,0x00009b946d6ae5e2,0x000abd8512900b04,0x0008f816512ebf7d,0x000061d9b7698825}, {0x0005a71349b7d94b,0x0005823eb9446a6c,0x0007484834a3f3d1,0x000812f0416fbd27,0x000069d45e6f2c70}},
+{{0x0000492ef66250ba,0x000fd8f5dba57a50,0x00005a206c062a22,0x000c6f733b1b24df,0x00002455c3bed4ca}, {0x00010f3340d13640,0x0000ad9c65efa1af,0x0009ed00bf7faa32,0x000523e2be61f41d,0x000038073859c462}, {0x0006d2e89673ffa0,0x0002cc44d42f6c3c,0x000ed494aa540801,0x000673f87d306a26,0x00001e513f5377e3}},
+{{0x000d63ebe54242c8,0x00047da2b75608d9,0x000e3b9668b4a8e9,0x000539b473f621a9,0x00001fa2f6aeaaa6}, {0x000a5e400464b312,0x0008dce6ae303dbc,0x0000073a134621dc,0x00046e7e76c3f280,0x00005ca707b77842}, {0x0004d3e2c5163c14,0x000a57adffd19f2e,0x0008264dac8da98c,0x0006f967626a9a89,0x000053d930e303c8}},
+{{0x0004daa84ecc95a0,0x0009ecce2efeda54,0x000181a97c84487c,0x000d65b2004a1eee,0x000015f18747bdc2}, {0x000fd875a2fec4e3,0x0005e08f6c1ad0ec,0x0002a216ba1ec6c1,0x0003c0971431cb03,0x000006f6c21e2b31}, {0x0001119edd65e649,0x00039e23126f0ce4,0x000d236e534cb285,0x00063c49453f21d0,0x00001daae7629464}},
+{{0x00045b9c9ba426de,0x0001f0e3f7a174b6,0x000dba06df2b4ac9,0x0005ce9f3f48c054,0x0000012cf267f65c}, {0x0006fec72f949fa7,0x0003773365622ce9,0x00044d6c2c6f5daf,0x0009b197a36f24db,0x000014f7a34573f9}, {0x000353fb84674dbb,0x0002947f3afc7d8a,0x00032a81c860331d,0x000fd1df2eadaf6b,0x00001e347e89990b}},
+{{0x000e9ebbf37ef7ef,0x0000a1f3a22dbd1c,0x000adc0f6a7db44e,0x000e273355ec40e5,0x00003bc6ecf4d322}, {0x000730e4027bec1a,0x0000a5656903ec58,0x000099f350ce3241,0x00073b141926d324,0x0000771a30b1ac0c}, {0x000910e1c73c3f1d,0x0005a8b60507b5e4,0x000e81b4b3b459d2,0x000134a11de93a98,0x00003bf5f7376a8b}},
+{{0x000a2e0e3a6124ee,0x0006c2b54e5dbe6e,0x0004dfb2467f5ddd,0x000ac9a38b0f0645,0x00005956dc9ccc5d}, {0x000f8215ae3b7ae9,0x0009f8a41d830752,0x0003a3124256431f,0x000e60624ecd884a,0x00006e876be207f7}, {0x000a7f8470e27c41,0x000304ee0cbfd54f,0x0001fe8a0ec87c2d,0x000fbc9fe6984383,0x00002e2e611403f9}},
+{{0x000886e80ba560b3,0x0006865698e50b90,0x000c1c13ad9b0460,0x000ff607bb864c86,0x000055cb01ca8b10}, {0x0008f6e8db804d2c,0x000b95c1b590ec41,0x000f94c2e9734262,0x000313a88d63c73d,0x00007c7b9e6a5070}, {0x000fda8f18e6c6e3,0x0006c65156f2ceed,0x0000832271954560,0x000091ebb8041c82,0x0000350b190b6779}},
+{{0x000bb7a4d8bed6a0,0x000e1910b362e01c,0x000d10446d587005,0x000158ac57eadb56,0x00001485505a2112}, {0x000e28e65d086ef3,0x000537264a976390,0x000b69b5ae44336c,0x000867af04e186ec,0x00001827f2a30897}, {0x000cafb644bca39d,0x000d66140cc77802,0x00016baef202a9aa,0x0007dec1709a619e,0x000055a49839dbe5}},
+{{0x000eae066c3cd44f,0x000c861ffb216442,0x0000fd8fc17a3421,0x000b186a9c51cf44,0x000059b97303ce69}, {0x0001e46127096271,0x000fe9c6011be250,0x000f7e10dc2d06b1,0x000b6ac8f2059691,0x00006f88da48d293}, {0x000f6f611d403026,0x0006a197e30ff11c,0x00063172485ef41b,0x00064befdec1819e,0x000054b2fc835d1f}},
+{{0x000c63246e618324,0x000a50f265907247,0x000bc612bbd7ad99,0x0007317ea3963d0c,0x00005ddcd481412f}, {0x0009fe068f366741,0x000c0730eb95e97f,0x0004b7f42c9b0746,0x000335c4120644b0,0x00002030965efed2}, {0x000965db26b1f9f1,0x000effa36b561c6d,0x00074a0fbaffac84,0x000c295a1120391a,0x00004cb844162c17}},
+{{0x000ff4611ed3330f,0x00054bfb46010897,0x000165a011a21d4e,0x0003357d2d328d2a,0x0000417a47f87970}, {0x00038847c8f92044,0x000e893f116ae90e,0x000704c8c5d0c5c3,0x0000483d3a7692c4,0x0000068acc00922f}, {0x0005fd75466d72df,0x0004a6b94eb0bcd7,0x000ed32ed824a14b,0x000c75c775ee0182,0x0000206b00d3149d}},
+{{0x000704aa5da7052d,0x000c1473471d9a65,0x0007ce71503579a2,0x000baa70f60891c9,0x000068fdf3bcbd3b}, {0x000e27ac7948612f,0x00075097de7d09f2,0x000a8103eb6862e0,0x000d5d8edbfc091b,0x00001dbbed7d2420}, {0x00028c587c90feb8,0x000f4d485c8534a8,0x00047d4ce93790da,0x000a10fc2fa175e5,0x000077b139a6278d}},
+{{0x000a262fb4da3e60,0x00097329844c509e,0x000a0a60f833d35b,0x00053c6fc8c6a780,0x000040a12f77950b}, {0x000083b450e85394,0x000c8b0b983d98ef,0x0006ccd39b40b73d,0x000f3d0c8447005c,0x0000708a915b4af2}, {0x0007094fc60f14e9,0x0001611668bdbc48,0x0001e9c818c4a92c,0x000d89c93339e5ef,0x00005c65618f0a25}},
+{{0x000d4b84ea252b76,0x000fa2b0a1d92d37,0x00060769dbdd42cf,0x00055172b54187c1,0x0000109f66412c28}, {0x000e95519457e53b,0x0005bf0b9671d4d9,0x000bd6dc45f044b4,0x0004d9ac157ef95a,0x00001e61532edba6}, {0x000682a0b6fde9fd,0x000ea1a9bd2c91fd,0x000f4c0d117bb16b,0x0005e64ae89fe27b,0x00005ba322f7a4ed}},
+{{0x0007be685ffd9e9d,0x000fb922f7ccfd2d,0x000a3ec813505ce3,0x000b20132bcd6d1e,0x000014e66d0446d6}, {0x000b3c1f3e674c3e,0x0006808f7f2bbbba,0x000cbdff92c763d2,0x0004d54ecd71b2b8,0x00007e2cdd17b986}, {0x000fccfa4fea3426,0x000770cb1a6a5646,0x0005f71fe9bc1dd5,0x0008d58dee279722,0x000043b4e8666f58}},
+{{0x0005c17cbf1a22ed,0x00046ff76959502f,0x0000c26551de0086,0x0005d38e45be6981,0x00006b2f525a265b}, {0x000c014138415a70,0x0006215ce856c1dc,0x00091be3e7006982,0x0002d4685f829265,0x00003420dd4e5ba5}, {0x00001757928c323a,0x000ae454a8e5da96,0x0007476a1f81298b,0x000adf0c7811a206,0x00000a611fdfb7f9}},
+{{0x000617c2f1b9d053,0x000765cb8002dc55,0x000520aef3867c25,0x00080d324cbed1f1,0x0000091bf610cff9}, {0x0009aa681737596e,0x00040eae82a9565c,0x0006cd4945179f75,0x0009fe0616fef0b8,0x000054246bab617d}, {0x0009353e00d9bcc4,0x0000c5664ce39e00,0x0008d60a665853e6,0x00037251b8bab77b,0x000019ce66d16d35}},
+{{0x0001d87cc65ea0d0,0x000a5f3d6ee358c6,0x000d156c72a452d7,0x00095d1ae4223a43,0x0000730ceb8b5e0d}, {0x000c807c8a328b47,0x000a67e7d2ece3cb,0x0007e712f24155aa,0x000da12639e70e85,0x00003028a1b5445e}, {0x0002a3d6ed6c755c,0x0002ac40db3d49ca,0x0003579dc511390b,0x000dc22646939056,0x00003ecb39abed3b}},
+{{0x0004f963e01f7304,0x0004ddf0879f78df,0x00076666bae7eb75,0x0000cae06991946a,0x0000381c56be481c}, {0x000cb20c4578ba58,0x0000ec4251cc1677,0x000e0ff9f1481561,0x000a51b90cc9b7ee,0x000012a582b5d434}, {0x000d86f2b3271b5d,0x00062ffafceed66d,0x0009bfd6d906396a,0x0002e6ae79ad1c35,0x00004f68fd801206}},
+{{0x0006d8d95d2eff65,0x00060845b629ef27,0x0004e89d5f653338,0x0005eb0a0702861f,0x00005ba6c193cfb6}, {0x000e2df6c20c6735,0x0009873dc904f13b,0x000cb0ae1822f2f5,0x0003a4af7bd49f93,0x0000091dec8b8f10}, {0x000b76e3393c98e1,0x000577470612df39,0x000a7523cc8eee96,0x00048616edc3f189,0x000078169631c612}},
+{{0x000178768f0bdbbc,0x0004bd7d4063719f,0x000ea4e3b763d6bf,0x0001bf0e00c34828,0x00002f3dcf8e6def}, {0x00026bf34d0ceb67,0x000271d397ec8624,0x000eef11f4032577,0x000591b9f47e4ada,0x000003a971a6e94f}, {0x00048f0b8cec14fa,0x000ab6356c182360,0x0004eeda0c5e4b80,0x0002af7c1fb76ae9,0x000056bf4cf621fa}},
+{{0x0009d2501d2d15d8,0x000d872863f7a7f7,0x0001378c9c52437a,0x0002b5b1e3e05da3,0x00003b4354795dd2}, {0x000e82f343a46b63,0x000203ecda2f8fe2,0x000c6e76cbfd9918,0x000a071331117c0d,0x0000742a629e5352}, {0x0007977b02341d4f,0x00045b6b36664936,0x0009708d3cc9b662,0x000403d4187e08a3,0x000028015e08d798}},
+{{0x000b55d4019e8c58,0x000ecabf0dbb9fc8,0x000853494acb3326,0x000982d4910e656f,0x000064df81b77469}, {0x000527956c0b6272,0x00053ad974c17b7e,0x0007848c35164259,0x000945d8aff20d4e,0x00002590078980d4}, {0x0002b12d3d5e44ce,0x0004ae66fe680f17,0x0002eb01bd57ef0c,0x000e7fe2139a282e,0x00001919849a292a}},
+{{0x00099410777d2d92,0x0008b4bb6a5f8371,0x000dedda1e659c63,0x000131cd70a56fd6,0x0000315de5ca7b38}, {0x0002a56403e37f02,0x0008cc448baa16be,0x000df3a76bcf06f9,0x0008670be7fde2be,0x000019ce95f14ff8}, {0x000057fb6b9d8cbf,0x000eb99a48e633f5,0x0008801491000ce0,0x00012e59baf11edd,0x0000678fb5856c3a}},
+{{0x0004b1336e70f88d,0x00011f4aa5bd6171,0x000b262abb91eda5,0x0003324119598f81,0x00005d009a05d118}, {0x000830a105a9b322,0x000991621ed6d708,0x000420af1a3e99a8,0x000d2db7c19f7674,0x00003969d79e8750}, {0x0002e69232643306,0x000a4633f608c8ee,0x000e853c4eb42fa8,0x000e972901b6cb18,0x00007f344a3b8e49}},
+{{0x0004017d77b40668,0x00088a7d10296ff2,0x000779ea6ab766ef,0x000ca525c5a99500,0x00002b70100457ea}, {0x000b105c69e1ee6f,0x0009444dacc6e062,0x00011687c0d250b4,0x000e3a8014a95101,0x000037c02de39664}, {0x00075343141a1e75,0x0008a5fc21e7858d,0x00084967c489bd70,0x0003f9649bef2425,0x00003a57fe8133b0}},
+{{0x0007bc357d975997,0x000cbbc20d5bca73,0x0006c1600e5cf794,0x0003d371b8ec17c5,0x00006a0685c2da8a}, {0x000016c62030b6fe,0x0001681d4e115814,0x0005e90ea58e987e,0x000651a8c9c5e1b6,0x00002009724d6c3f}, {0x0001b3f88f14c064,0x00086815f014360d,0x000f48d2276fa1e9,0x000ff19caa18bb63,0x00006ea747d53841}},
+{{0x0009f07e6f97db6a,0x0006badffdd948d3,0x0008fd88c53d7093,0x000c3f6f95a7b8f3,0x00005a1e3f2d7854}, {0x00016de139aaadbf,0x0009199532e1c4ea,0x00098c3de9bdfa72,0x000e68cececf1c54,0x00006a4c650c362b}, {0x0005d13f365b252a,0x00029d71d6efece8,0x0008a8ab1b3491d2,0x000a8e6f9bdda2cd,0x00001813ae162219}},
+{{0x00067328afd8dd1c,0x00053be54d24c37f,0x00030b9bc0dcaf47,0x0000c163f7f6c43e,0x000066b8ae9b1f27}, {0x000e448804d6d234,0x0008a3b6ad48d33f,0x000da781bb1df665,0x000e98fbb58ffbb0,0x0000238ffcff0b60}, {0x000db3a784e3936f,0x000bb19832c1d2f4,0x000aa5dc309d0a1f,0x000220416de47941,0x00007af746f2aad8}},
+{{0x0005597fa8641246,0x000c04623e3b68e7,0x00060ef985d87aff,0x0000c910231d4bd8,0x00007afb868aa136}, {0x00045179c3f1e81e,0x000de79b5941cb0f,0x0000bb9ef8ec0537,0x00063c812100eef1,0x00001f34e651b7f5}, {0x000781fc6c3d6b9e,0x0001fc36abf61531,0x000e8c49b920d7be,0x000f0bf96ac4982d,0x00006534d3baa97d}},
+{{0x0007f5e7bbcf92af,0x0007e617b59977a1,0x00059919e188d946,0x000db7f73cdf7d25,0x000025e6e1e29607}, {0x0002f3aa341bb0ee,0x0002ad2ac98b2a0e,0x00086bb054303f60,0x000a2692a502388b,0x000042b39aaa629f}, {0x00063a2d9492fb57,0x000310f1c5b6b5ec,0x0005499c08d11bad,0x0001c2965461c1f2,0x00000a13384673b6}},
+{{0x0006f74bc53c1431,0x000ce2072eddece1,0x0005b23ee72b9725,0x000c908b8b9c36fb,0x00007e2e0e450b5c}, {0x00062b434f460efb,0x000d4a63607d69fe,0x0007a0da24ded303,0x0005b93f052210eb,0x0000237e7dbe0054}, {0x000575ed6701b430,0x000e69f0bfd10013,0x0003e47f22231094,0x00055e375320f158,0x000071afa699b111}},
+},
+{ /* slot=4 [{1,2,3,..,64} * 128^(2*4)] * G) */
+{{0x0009214fe194961a,0x000c70d71cd4f4e5,0x000b50f22d49be7d,0x00072329300cfd23,0x00004789d446fc91}, {0x0009852d5d7cb208,0x00070687df2e7287,0x0001687891b8dedd,0x000aa35dc0bffab2,0x00002b44c043677d}, {0x000c87ab074eb78e,0x0008e99daf4671a1,0x00084f9067fac6d1,0x000a4e43eacbbcd4,0x000060c52eef2bb9}},
+{{0x000d89bc3bfd8bf1,0x00037c9f3551a0b5,0x00053028f5b06b92,0x000caab0e4c16b0d,0x000010bc9c312ccf}, {0x000bc5c27cae6d11,0x0009b54a48cab702,0x000a492eb244c769,0x000676defbc4056b,0x000070d77248d9b6}, {0x000ae84b3ec2a05b,0x000f4ed1781e0aa8,0x00008e85d198699e,0x000f413794513e47,0x000063755bd3a976}},
+{{0x000fa03e2ad10853,0x000909ee63569b55,0x000e69b890356f75,0x0006f849ff9f1fdb,0x00000d8cc1c48bc1}, {0x0007101897f1acb7,0x0005ec165bbd83dc,0x000fa1020f5dda7d,0x0002a56508e5b9c0,0x00002763751737c5}, {0x000402d36eb419a9,0x0007e77b460a5029,0x00043c4956f0b44e,0x00066e7cfa86230d,0x000070c2dd8a7ad1}},
+{{0x000194509f6fec0e,0x000a946c6518d656,0x0007e09b5cee2e7e,0x00084959733c1f36,0x00002e0fac636394}, {0x0004967db8ed7e13,0x0000ad776817a91d,0x000d85256474252f,0x0003ce5e40982e00,0x000032b8613816a5}, {0x0007f7bee448cd64,0x00067087886d079e,0x0000e4db2e6ac83a,0x0004f41f89fd4d9a,0x00004179215c735a}},
+{{0x000094e7d7dced2a,0x000c347d39c708c7,0x000906d90297fb8a,0x0009d76e13be033a,0x0000700344a30cd9}, {0x000e33b9286bcd34,0x000b6559dd6dce4a,0x0003d38e1fb7ef7e,0x000c286278b141fb,0x000031fa85662241}, {0x00026c422e3622f4,0x000879833502daf8,0x000b389123c12029,0x00024899bc1b7e12,0x000024bb2312a995}},
+{{0x0008ed1732de67c3,0x00018461b4948b1a,0x0006cfbcd23cb494,0x00080088ebd43437,0x00000fee3e871e18}, {0x00080c2af5f85c6b,0x000c304fa679441f,0x0003ba1bad687284,0x0005d168945df99a,0x00000d1d2af9ffeb}, {0x000a8aa132621edf,0x000a159226579a9d,0x00079ac19330b822,0x0001d764004197ba,0x000016acd7971853}},
+{{0x000f72af2d9b1d3d,0x00036a432245a72d,0x0006b3963763462a,0x00023093ecea0791,0x0000123e0ef6b930}, {0x0009c6c57887b6ad,0x000ad5f90febac95,0x000342f50494e19e,0x000170016e24e62a,0x0000164ed34b1816}, {0x000ed94c192fe69a,0x000ea3a911513487,0x0009a4de2761ae2c,0x000f3eb877bf6d3b,0x000078da0fc61073}},
+{{0x00015d28e52bc66a,0x0001870f01a8e5bf,0x0006c28bdd2c47e3,0x000173a2419afbc0,0x00002d25deeb256b}, {0x000f80f1680c3a94,0x000151ae9e7e6a29,0x000801797371f77e,0x0008ddd1100f1584,0x0000054aa4b316b3}, {0x0008468d19267cb8,0x0009c66e54dafdfc,0x00066eec170b2878,0x000a7602aeb1d2a6,0x0000134610a6ab7d}},
+{{0x000bf6999e93a7e3,0x00073f5b560824b9,0x00077d1575532363,0x0000a283c0d56479,0x000035f3fa6da52b}, {0x000fc9817587e154,0x0008f19759e3783c,0x0006b3241a15f46f,0x00059a937a8e8ffc,0x000033be36fd5d3a}, {0x000594c307e707b1,0x0005391d7ccd34c3,0x000b731ad7c8b35b,0x0003e97cb5dab788,0x00002676d4d7d644}},
+{{0x00026a1f3de08c28,0x000f61d66d7a893f,0x0002416bc0191e6b,0x0005fc5ee635d476,0x000044ac6764c979}, {0x000b651f1a8b1175,0x0009a982276b1286,0x0002a5f89c493328,0x0002b42ecfba3736,0x000009dd56d8e16d}, {0x000906270720cd3a,0x0007d2fa717ebc36,0x000624e818b2e57b,0x00028ee917086cb2,0x000017f0689523b8}},
+{{0x00099de8c6e9274e,0x0009b92cc0127c4d,0x000480d4636fd5c1,0x000d9c03097401f4,0x00005ade11c35d20}, {0x000a4847bd271c2a,0x0009a262b0c4f17e,0x000381713f911811,0x000c59ac9f0d64fe,0x00003f1d991ffdd7}, {0x0003b49593bedcf5,0x0007271246033374,0x000469aaa7cbcb58,0x0004a69285e243b4,0x00004e9cd70d76d8}},
+{{0x000db54a77020028,0x000bd58b821637b7,0x000513c01023b9da,0x0008b4c31208a8e4,0x000037f3160c1dba}, {0x000be06df9d845e8,0x000f8ecd0d194391,0x0000e0dff993aaff,0x00008b8d40b7405e,0x00000d9723671810}, {0x000799b76682f2ac,0x000c5145c7469954,0x00068786cb51a957,0x00064bbdb0093086,0x000023d903401ebc}},
+{{0x0009c00d0d636d9c,0x0007e3b0f7d57e7d,0x000b6fc013678349,0x000be957be9b0295,0x00002f79b1839edc}, {0x0008803ab10e972b,0x0009718de5051550,0x00096bb66d5a7f8c,0x00001869cf38e8e8,0x000051a919f26886}, {0x0000769631a5330d,0x000f29433c9b8bc7,0x00025ee8bb48edbb,0x0008516abbb83c93,0x000008cd5c836af9}},
+{{0x000fc8bcba00e8cc,0x0004e0a8d39a5a69,0x0006b333856ee694,0x00070544fa15ff9b,0x00007d54cc38d503}, {0x0009c1ce5e8a007d,0x0008185981a74a68,0x000c90223a9f1bea,0x000ed1502d90e2eb,0x0000254d62cf9e9e}, {0x000d2c44d9c9afcc,0x000c3e7ad39b43e4,0x0009e6c720e384f1,0x0003bad1107912e1,0x0000269e6a1367ed}},
+{{0x0005f1ef58df0e19,0x000acb93aff3a470,0x000c99d334e02c16,0x000a6227f030d9ba,0x00007ca04b5062c8}, {0x000055d855127990,0x000dcd2052cff507,0x000fd6943cb78c02,0x0008b1494e1e4d79,0x000052c6eece5108}, {0x00072378474e929c,0x00029b9a39b3e9a2,0x0007bfd1ff3fb5b3,0x000f5e06855d9a18,0x000005f2213003b2}},
+{{0x00055ec27c59b23f,0x0003e154d04f2caf,0x00014141f499aeed,0x000a0a268441d72e,0x0000140345133932}, {0x000430e0dc028c3c,0x000a85217c771d91,0x000c99a1fa0eb955,0x000743c4b09e1ed2,0x000042881af2bd6a}, {0x000ec69aab5cad3d,0x000d34cb2cfad7bf,0x000b37d6a2c23e8c,0x0007a18685dd14bf,0x00000ad6d6441567}},
+{{0x000e30b0d243799c,0x0006de429748d60c,0x000e9f3b7898eab7,0x0000c79f848322b0,0x0000666695fb9e14}, {0x000adae21385551d,0x0008eb2f4522c080,0x000c45522b0b6945,0x000b0c7c4ae840b9,0x00006db1b5bded22}, {0x00044cd82f8853dc,0x000b332145e80df4,0x00012389a03a8367,0x0009b6a1ee2d61a0,0x00000a0025abeb47}},
+{{0x00059737073ac048,0x000546bf3108e251,0x0001b5cf89ba438e,0x0005f59c4bd9a6e7,0x00004dac374571aa}, {0x0009607418dc69e4,0x000d3ce1b47f0d2c,0x000fe6ec81f6f640,0x00044b5acafda8d2,0x00000bd5d107024e}, {0x0001d80452432846,0x000b7e797562ecb6,0x000a7224440dffe9,0x000225da77a2b5a5,0x00007e2f8cda810e}},
+{{0x000725a15848139c,0x000bb5e36e0c8660,0x000352437cfcdf26,0x000d520e3e486129,0x000041337a97013e}, {0x000904cf9b3c38ef,0x0002657539752901,0x00081d3e7f944ee2,0x000072213bde5e13,0x00004f0d886a7a63}, {0x000806e681fce8bf,0x000924e88bd57d88,0x0007b882639ad828,0x0009ff0b0a77519e,0x0000236ee9b91378}},
+{{0x000c82c995a9fc11,0x0001f12c261dbd5e,0x00015b27236f6f10,0x000cf9a7a85562a0,0x0000594b779b79a6}, {0x0006bc20fdfe184a,0x000704376c3d832f,0x0003669813b89144,0x0000f4145c403769,0x00000bc39bf1e552}, {0x00040a5b4e520712,0x000ebf2d74f9830d,0x0005e6ce4d8fcb02,0x0007b69bd0caf0a7,0x0000690dd9962368}},
+{{0x0001a8b538cafe2b,0x000aab115a0745f2,0x00095ab2e60cd477,0x000f9d7c2ddce2c3,0x0000625061782e91}, {0x000241aa52e28903,0x000db64cd2d4b7d6,0x000066f41ce40166,0x000753509ed996dc,0x0000104521cab75e}, {0x00037efc9fbc7fc8,0x00011051084bcb05,0x0006a2b725460f41,0x000d0e39cbdb4bae,0x00004f5905611a7a}},
+{{0x00010ce5cc6ac3f5,0x0003c2ccb62cffc6,0x000e05d17b3d7c91,0x00084efd5207e19b,0x000001a174f37b66}, {0x000a29190e93a5db,0x000877a6e3cb542d,0x0008249f1a10f1bc,0x00054dc88d6413ae,0x00007aaa23a3cec1}, {0x00017cf32a32864c,0x000210c59b577854,0x000be5849c52d9f3,0x0007a270ab6b97a3,0x00003658642a7671}},
+{{0x000249c0879ea129,0x000fa240593aad50,0x000a2feb80825651,0x0000dd201b2e095e,0x0000717677cb2e1e}, {0x00037e4b3d5d0381,0x0007c75bb9cee95c,0x00074d4150791abe,0x000d16b04a01e3ec,0x00004006bec1d91f}, {0x000916cc1f0f78c0,0x0003669c4078fc35,0x000fb4735133c11d,0x000bcbf96a60c4b6,0x00002d2d9fa11e01}},
+{{0x0001de49ea6dd3e7,0x000ec3eab1b7a6bf,0x0005b3cc68fa0ef2,0x000a7a694d31a43e,0x000077f0639a49ea}, {0x000442d5f14658ff,0x0009d1b5bfdc2be2,0x000e6590c1d7e801,0x00084ea0e1352a3c,0x0000023829a8769d}, {0x000ffdecabf56e60,0x000aa5f5feba6bb6,0x000b61e3dbd2daf4,0x000450bd9a2142cc,0x000062b3edad6501}},
+{{0x000f062189279d16,0x0001fe20cc3363a7,0x000774716769a946,0x00087834c7e07c2a,0x000037698921dc34}, {0x0002c70c7180ca32,0x0004a9c8060099ac,0x0000a5d3aeb78c08,0x00056e04dcbc8cbf,0x00004f1fddfdc601}, {0x000a38447e52b98c,0x000e22fab7e73ed7,0x000106c184584763,0x000310299a485a9f,0x00001e228c9e353c}},
+{{0x0007053cfd93bb9f,0x00053be70f521b51,0x00075850edf7b533,0x000ee5631b41ee37,0x0000368ed42bdada}, {0x000f68f825f17e4a,0x0006432cac431130,0x0007b824a52c3dd0,0x0005082b215a7885,0x0000767c53c51c39}, {0x000ca3f3b9994705,0x000d0cf1b9c3152a,0x0000c86a00156382,0x000eb018d53a44b1,0x00002a6ab51f98e5}},
+{{0x000d1562208ac95c,0x00042bf473ef17df,0x000cfcef8639ad3f,0x0003f67426e84c43,0x000014ff298a4319}, {0x0000cdc31e6590a2,0x000a8955cb5fa894,0x000dcaa29a313ae8,0x00009f6b5e0e5e6f,0x0000343c442dc077}, {0x000578100f32be57,0x00056288c38df0ee,0x00095ebd2e322b4c,0x00008bc8b9b2c407,0x00000088afc2d0ae}},
+{{0x0004f7dd91949808,0x000d3fa639aa3b11,0x0002017cb44b7b30,0x0002479c5ba55110,0x000066500f1ef42e}, {0x00059e6551b6ab6c,0x0004d011d09759fe,0x0004ffdf02b9d183,0x000a20f9ca5f06ad,0x00007e09685e4d98}, {0x0001ff90327096cd,0x0006188dc5636387,0x0004d6f874204d38,0x00083ad623206365,0x0000574c6b452837}},
+{{0x0008a5023381bb16,0x000297ccd8661600,0x00030c1f38abd96e,0x000f1a8aecfa7b29,0x0000646b67b192db}, {0x0008594e5352e8ca,0x00042d7bae9c2f26,0x000072c73330cab9,0x000bb58cc28eeab9,0x0000106f174e2c5a}, {0x000945fdf995f55f,0x000142b33ec0a4ad,0x000ea5f9a7826a05,0x0006fa0beaf65df9,0x000012416d7d0634}},
+{{0x000b2a5eec8b9221,0x000703a1fbe88a8f,0x00017cc494448b0f,0x00090ec8b91d57cc,0x000067c91638cc7a}, {0x00083c2cf252f2ad,0x000d4b9dd4936b74,0x00030372c1f790f1,0x000a868c72a8ad1f,0x00002c8d31f623dc}, {0x0006a7beb5ee0b4f,0x0002837ed96f091e,0x000f583174b422d5,0x000693e1488d07c3,0x0000053c54556ba0}},
+{{0x000d0fe1bb44c07f,0x00085887df5e9cb5,0x000aa407448bddcc,0x000153c96870a999,0x000065785be9322a}, {0x00023f369115bf70,0x000f0c50c4797da7,0x000af539ffdb7907,0x000c6db34a32dead,0x00005ff5f008ef1f}, {0x000d98f52c5803d5,0x0008dd7659d43517,0x000def63135c9bc8,0x000672f1631adeae,0x00005b1f43d73405}},
+{{0x000a439e417becb5,0x0008cd10e0266781,0x000692ac244ac593,0x00012335da385110,0x000011b065a2ade3}, {0x0004892847927e9f,0x000ef370aa877791,0x000112270333dad6,0x00095921f8f24fa1,0x00005265ac2f2adf}, {0x000fdd309afcb346,0x0004428e63f54405,0x000f65aaaed9723d,0x000080994c01df05,0x000043e4dc3ae14c}},
+{{0x0003d94d919865b6,0x000f715bf9c122c4,0x000b733d29a61c0f,0x00036097c46f079d,0x00003c94dbe2bfde}, {0x0002fabd8d87cfb2,0x000ed878ba8a1d4b,0x00065bc51c8a5ec1,0x0003a3101e688190,0x00002025e609591e}, {0x00024a95a5a1edbe,0x0000083943699969,0x000e59d87f4d3eba,0x000052192edb9c69,0x00001105024d9e48}},
+{{0x00025908c537ef4e,0x0004d4374f9bfdf9,0x000a30af283794f4,0x0007c616745024fe,0x000078854e56915d}, {0x00014cc5702c5534,0x00027d9186884c57,0x0009e57e69375d23,0x000d5a667e66da17,0x00006b4b81ad62ec}, {0x0006f8970f0302b6,0x00023ba3dba607da,0x0003f3e73bc821f8,0x000ef2a5dc284d11,0x00005a60923f0829}},
+{{0x000a51f60f0c1e28,0x0000a5b545256713,0x000a75250cf92c42,0x000d05516a1c8a59,0x000068a82eaaacbd}, {0x00072e6b5975293b,0x0006a192c7299b52,0x000059ca53c5308c,0x000d590ccab0cfd8,0x00001459e6377945}, {0x00068716dc470cf7,0x000edb23e8815eac,0x0002c591a07540c2,0x00050563ad5149c4,0x00006d5839072859}},
+{{0x00060c67d4653ea1,0x000730bc7f20387b,0x000b41765797b871,0x000bf2d22aae0fd8,0x00000c2e8b637f73}, {0x000713494c2319e6,0x000c0a100ec3052c,0x000f309e6c079913,0x000255ddd9170049,0x0000087d8cdc73d1}, {0x000d23aba81f95cf,0x000003e046bda153,0x0002503f2764a968,0x000bc291cdd33ded,0x00000aad45bdcd22}},
+{{0x00013fa4d23b5f32,0x000971a717818d9c,0x0003525403298ebb,0x00038ecd20a920b2,0x0000042fd804b126}, {0x000bfda047a4918e,0x000551238e15b33c,0x0000b9ce9c45578c,0x000e980acc861a17,0x00007c58f4cdda2b}, {0x000cb74ded19afef,0x0001b11fbbe29d6c,0x000722fa238f3d67,0x00082015d0428eee,0x0000276c2690d9f4}},
+{{0x000e8b4c5f4a26e7,0x000f64a7fa8ae99f,0x000a08d303341f44,0x0002bc8a8acf5221,0x0000548f5e7cae81}, {0x0009951f17c7b9cb,0x000fdf28eb273a4f,0x000a6858a20dfe57,0x0000514891d239b3,0x000012d853fb974c}, {0x00018a36c64fbe90,0x000f64ddacc88db6,0x0007835ddcd03b2f,0x000d89d895d90379,0x00007f0c5637aa66}},
+{{0x00044ed173413b57,0x000108a522992a26,0x00037b34da9f1a95,0x0007e06ba8116389,0x000015037d97434c}, {0x000be00313602081,0x00070fe43709dcfa,0x0009cd4e8cfe8444,0x000af969e927fee1,0x00002e96bd09cdad}, {0x000aa9a839535fd1,0x000cfdbfe6e7577f,0x00057ddb65d9b39e,0x0001542989b85dd2,0x0000079a7451da34}},
+{{0x0008c26177943758,0x0004cb76b2a228b9,0x000c51bb5ea4b6cb,0x000d7111012f25db,0x000047da9fce1bf8}, {0x000e8fd4d16e3601,0x0002ce84eaa23d55,0x000879e0b1449ddc,0x0008cc3bc8e353a1,0x000019cbcdf4931e}, {0x0002a268bca4b84f,0x000dbc23568730e8,0x00007bec398b33a8,0x000098ac97b6db13,0x00001696bc6a974b}},
+{{0x000f670b336800fb,0x0005fbc68f561796,0x000adbc974dd8301,0x000b2beed24e935a,0x000026051ef8f7da}, {0x00064a737d633937,0x000c025d282849d9,0x00091e91430286c6,0x0003e6462d1841e3,0x000013610de57c56}, {0x00021356ca6a7858,0x0006a4b2d644f6a4,0x0008990b6c766c9a,0x0002d3ea9f643e68,0x0000084881d9e74f}},
+{{0x0000ca36fcd104ed,0x0008c4d00f584c7c,0x000a8d2d2c3f4263,0x000cea6cef3c8435,0x00002a111af98b4f}, {0x000c43e2431ede28,0x000468f2818139a0,0x000ca4cfcc703fad,0x000b6b9e9922288c,0x00002d0fbaa08cf2}, {0x000a4dd8542f8e86,0x00074b5aa4f6703c,0x00064cb93101cc7a,0x000c12a777b52e6a,0x000037c439684730}},
+{{0x000948888f9788db,0x00055a1e7b44d0e7,0x00027b387653d4bc,0x000b44ef1f483a63,0x000060c4820810b6}, {0x000cc72621f17365,0x000d6d48f07fbb52,0x0000ca54cadab8c4,0x000a6fbaf72060eb,0x00005956545ee838}, {0x000ec2ed5f879e87,0x0003219732d59d92,0x00022a80e6ae4ad8,0x000208a744eb7776,0x000024fb280c051a}},
+{{0x000febb8daf1aeb8,0x000a95e805c10b42,0x000089238c594175,0x0005b58ccde7ab5c,0x000060e1562a96a8}, {0x00097fd39bd5ada0,0x000f17672b0796bb,0x0005bd0b853645c5,0x0000ad5522700511,0x0000460d921f1964}, {0x0001b6d8ebb24639,0x0002709b2878266e,0x0008091432c93a95,0x000e7e74e22539a5,0x00005057fe819f42}},
+{{0x0002c43fac75264b,0x000db13eeecf6019,0x000a7cd305b31d41,0x0002be86508f807e,0x00001cbc6bba0a09}, {0x000896a357105e92,0x0008b0448e548bf0,0x000e75f3c61f83bf,0x000d116815e3a1d2,0x0000503ac071609c}, {0x0005416928ed5210,0x000ae90f321f3bec,0x00081954395ab6cc,0x0006b60a2db52774,0x000017b8a6414d21}},
+{{0x000374d182a66342,0x000a64279f6929da,0x000764f785f4ecfc,0x00012ce1709f94dc,0x000029993431e89d}, {0x000658326ba4c518,0x000eed5f364b77c5,0x000cd8429c742613,0x000272a897cd9e58,0x00001f872fe056cd}, {0x000f28f45043e141,0x000d880bfc3b8942,0x000ac2bd130e8c07,0x000ec6cdb6d06723,0x0000032428a98b4f}},
+{{0x000d305dcbaa80ad,0x000d6dc364f4fe04,0x000f9fc56e71e2cf,0x000c31524cc921a0,0x00006b38ce02a721}, {0x000f5e2f024c8aab,0x00037a5aa9506fe7,0x000bc6f8f738a0b6,0x000b8688a559603d,0x00003ffed26cb938}, {0x00026d3d9b5c51ed,0x0008c00fe4eb14ea,0x000c03daa23985e0,0x0006359c401ad3cc,0x00003d27a6394b9c}},
+{{0x0002c7f1a938a517,0x000ab3180b2e1bc1,0x000bcd254a473028,0x000f90f3f78571ef,0x000074e534426ff6}, {0x000f7ac3adc2c6a3,0x000f6e9717c94ea6,0x000645eaf5d0e928,0x000fbbee2d379ead,0x000046dd8785c51f}, {0x000801be375c8898,0x000b5e3fd8348709,0x00072307144b06da,0x0004c4275880ced2,0x00002b09468fdd2f}},
+{{0x00040ef4803c9769,0x000745cc387acaca,0x000d8cb870de2330,0x0008846d7f976e9e,0x00003ca8fc1c5ece}, {0x0001d94d858c7f5e,0x000d3c4095bb388c,0x000f27ab19211676,0x000e799580befd0a,0x000049fc7478800f}, {0x0006180b31360485,0x0000eb88e1d80866,0x000fbfd3e840f392,0x000f5632fcb605eb,0x00007c46af155b6f}},
+{{0x000f36f482787916,0x00086e7ccbb6446f,0x000f6efb02de2e58,0x000474fe7f8cc0cb,0x000059d6e10c8c3c}, {0x000c5dd0cd2f2e9b,0x000ce84ab345c29f,0x0002777c58a873e7,0x000f47ee1b8d77e1,0x0000428a9fbe047e}, {0x000b340857b40204,0x000e2ce898b7d41d,0x0003ee7e8e408181,0x0001c5301008333c,0x000035c27e070115}},
+{{0x000d54aea94ea61b,0x00034ba8d1550236,0x0000d585ef3032d4,0x000421c825cfc695,0x00004ab927fc31f1}, {0x0003c4233888b74f,0x00057207cf0305c3,0x00032403f22e43b3,0x00083ae2c8baa1ec,0x000073389ee05bd6}, {0x000132b30ea11468,0x0001461cfdd94212,0x00061a50f398d78a,0x000fd4b4030e9987,0x00002908a6b592fe}},
+{{0x000e41fc3b48227d,0x0006b5ebd9750b60,0x000d001e3309171f,0x000937888a4123e3,0x00003ea1883c6d4a}, {0x00006650398fe9dd,0x00056a5e867d3efb,0x000165caac350846,0x00072f12f2261a2c,0x000034a094c17f52}, {0x000c981d84201022,0x00085f9873226b9b,0x000aea71ad18f4b2,0x000a4f31b88379e6,0x000055682644c00d}},
+{{0x00040178feae01d6,0x0000592041e3db3b,0x000d756538be2d6c,0x0003841e6779ecfc,0x000063cf89fc2360}, {0x000109199d4d424f,0x00037b3d123b0115,0x000eb16188e5d2b5,0x000358eb0f6e8380,0x000026400d12d1e1}, {0x000097c484308eec,0x0002c8a8664bfb16,0x000b295b7a81d46b,0x000de669cd09dc24,0x00007dd288ed0c25}},
+{{0x000862df7ba5f7e6,0x0001fd697fd3ce38,0x000d23b95d00da5c,0x0004ab5ecd4a9b15,0x00006b9f1d9d6d94}, {0x0002e96863cec1ae,0x0001ebed1a1679d1,0x000ceedfc3ac7523,0x000607ae789288df,0x000021309605f856}, {0x00096c9c4c9b94ee,0x00076f5590a83d0c,0x0008bb25f2b8f6ce,0x0003496b15eaab37,0x000070f72c4834ab}},
+{{0x000972485651abff,0x000f5d5750fade73,0x000939ab9cf0dadc,0x0006129125029700,0x00006d9ecec67194}, {0x0007c0f06c4f80fb,0x000efc2da8286c53,0x000f4f629ff034ab,0x000601861206a9cc,0x00004ef68eb1860f}, {0x0003c06ded017a8e,0x000d4540a7df78f2,0x0005002fc63c7970,0x000f0eea623691f4,0x00000a2deb80b9fc}},
+{{0x00043c924115d093,0x000568a8ad2ad459,0x000fb50502889d79,0x0006c667af1fc6c8,0x000070b50d7bdd25}, {0x00080273355566ef,0x000f0108d192fcf8,0x00016af1e1e2e578,0x0001173ee1264906,0x00001a71881429c7}, {0x000b00954913b391,0x000af81a4c310cac,0x000404ea0bd26f90,0x0008099ca97b7487,0x000020e8323bdaeb}},
+{{0x0000cfc09b31f429,0x000ec1316eed586c,0x00000e3c15c59418,0x00032c7bfec75f36,0x0000582e3c2c4be3}, {0x00029474afaeb8fa,0x00078c8a0c86c367,0x000fc0fc7ba9a04e,0x000a7e78993ba373,0x00007df0010cfcce}, {0x000afd30e2135a02,0x000103d1968456bf,0x000cc035c9a04aaa,0x000d2ded99ced430,0x000073ba24f45fd8}},
+{{0x000b60538b643ee1,0x0008062ea141f783,0x000394b58d4d4f48,0x000b3d786d9bd74f,0x000019d43dbc2c14}, {0x000c0ce3fdd0a753,0x0006bd74d3c7a312,0x0007a9a2e810af7c,0x00037d6d7073b24b,0x00004694bf9932a3}, {0x000d7a4b4b813cce,0x000e0c3801f66225,0x000756edb48a3df9,0x0000248220ba220c,0x00002acbc6d302aa}},
+{{0x000e68bc1b59c1fa,0x0002d356c8bfef8c,0x0009ff6a48bdaded,0x0005f3d8c9c2986a,0x0000607f7299bab4}, {0x0005aaac922ffc5e,0x0000d9505a7c691d,0x00099b16f86dcf5a,0x0006a5c7c7755cf3,0x0000039cd5959b34}, {0x000186bfda5385f8,0x0007fee4aba40976,0x000531821928c529,0x000934abe7ceaf01,0x00001ad047c585aa}},
+{{0x000e7bfb4ba39c7a,0x000c8e8bb2334f9f,0x0006f0c3bbba6080,0x0001170f3b2ce7af,0x000014c95dd55488}, {0x000a5e2f2b7759f1,0x0002d21ea10fb795,0x000a789eebfd38bb,0x000f08afa59e7c0c,0x00003e0f75dad57a}, {0x000b295bd14a21f7,0x000e441c116e7ba4,0x000ff21c40c8b170,0x00029117e640a6ef,0x0000786ffb4408a7}},
+{{0x000a1e83fe5bf6d7,0x0007d7514a53c743,0x000ccb6cef626a99,0x00026982c7641bbe,0x000014887c93ff6a}, {0x000a1298a5756aac,0x00095c7b219ecab2,0x000629bffbb8681b,0x000489724dd043f8,0x0000760a83295b39}, {0x000ea4e71c282454,0x000afbaab82b9df4,0x000c8f787a69e080,0x000c59acb35c6564,0x0000024a6422534a}},
+{{0x00085c7f0111177b,0x0009766394c76877,0x000929d3bf0df954,0x0008ff3eeab6be8b,0x0000783d311cc08d}, {0x00050691411a9d58,0x000124835eac89d9,0x00027b1e61fd1cd8,0x000419ca7b93958f,0x0000555628d904ba}, {0x0008ee75b69023f3,0x0005f431a15f78f2,0x0004a8d7d61ac39c,0x000cfb093e4c3c5b,0x000040c8f1e146f3}},
+{{0x000d2c011febd5b0,0x000e1d76e6ccbf6c,0x000587316f4d1955,0x0001605c65a9eff9,0x000065cf6e497169}, {0x0006109aca77a5dd,0x000306cf79e85d94,0x00075ba02739c083,0x0005e00912d623e9,0x000067ceb0d60035}, {0x000412ead510d3da,0x000aac63311b9213,0x00055b98f620ef43,0x000cd140337d3175,0x0000374452691ad8}},
+{{0x000749eeb701cb96,0x000d4b6a369c397c,0x000a402cd983f438,0x000df7b62962b8b9,0x00006976c7509888}, {0x0007946582ffa02a,0x00051fea8f5495b9,0x000f77af9bda096a,0x0001e76a06351375,0x00001bcfde61201d}, {0x000a5490246a59a2,0x000dee87fdd904a4,0x000d2371fad63ebd,0x0008ed6d9437c670,0x000069e87308d30f}},
+},
+{ /* slot=5 [{1,2,3,..,64} * 128^(2*5)] * G) */
+{{0x0006b79ebf8469ad,0x00004e2663135e1f,0x000f74181b158010,0x000673c9a498330a,0x00003ba2504f049b}, {0x000ce876760321fd,0x000109eb63ad89a6,0x000ac805927fe2b5,0x000723a00e7d4ae8,0x000073d86b7abb6f}, {0x0002b5606dba5ab6,0x0000fbbb1edab0b5,0x000b04a635a9134f,0x000e5db30a9520d9,0x00006813b8f37973}},
+{{0x000ae701c5738dd3,0x00035b26f1beedbd,0x0002f15ef4f9c6f6,0x000a4d861e96a804,0x00003aa1d11faf60}, {0x000d6dfa726ccc74,0x000fe2f53b96514f,0x0002a2c8b43b084c,0x000166af33ae4f55,0x000059aab07a0d40}, {0x000cec4c925eac25,0x000846013773877b,0x000ea9f451184871,0x000aa465b374337f,0x00001865e78ec8e6}},
+{{0x000157e62914a03c,0x000d7797b4f24edc,0x0007773ec21906e8,0x000144ed2dd866c8,0x000063d223c83e81}, {0x000fd1dad6a1b645,0x000478d49d876833,0x000861bd2e706b8f,0x0001e66ac0cbd408,0x000058d4f3c210c3}, {0x000735da96155e15,0x00096b0a8e850373,0x0002dae858505c0d,0x0003a3dd8c0b9d6c,0x000021ddebb6b92d}},
+{{0x0004b7c7b66e1f7a,0x00025f50c2f7eccc,0x00013eaf1c44157e,0x00063f73ef06dfc7,0x0000582f446752da}, {0x000c54e91c529ccb,0x0009264c635fb967,0x000812196530f626,0x0006f5c2747aff47,0x000017038418eaf6}, {0x00017bd320324ce4,0x000e8a4488bc4c63,0x000e5a1364a81042,0x0008dc9b21ef18b4,0x00000c2a1c4bcda2}},
+{{0x000bcb2dfe982283,0x000d3e216a584e3b,0x0001ff0b7d892ff2,0x0009f2d79bbce234,0x00000fbbe90fefff}, {0x00002fa9b507ecfe,0x00003b0a18a6a900,0x000324cae4951e24,0x000c5aa47f4d3bac,0x000007bba53eefa8}, {0x000f6d4c516a4b61,0x00031674e50830b6,0x000214611032ba14,0x00052595106d3d06,0x000055cb5ee4032a}},
+{{0x000b08008c5de967,0x0002bce935138f66,0x000a95cf1ce1bc2a,0x0003a35737d9b83f,0x000066a130afaa0b}, {0x0002b29b7caa19b7,0x000f84d3e41998e6,0x000ce503749c142a,0x0000d7ab743dc46d,0x00004ababfdbc85d}, {0x000ae4425cdcfde0,0x000bad77a001aad9,0x000aff8313ee2f18,0x000e0e4a67d448c7,0x00005d3758babfd4}},
+{{0x00098c0dddbb6ef5,0x000fe2a76281a2f4,0x00012c5de08a8d34,0x000ead38699dd9a3,0x00001252d1c82742}, {0x000258aece8a047d,0x00035ffa09813c98,0x000df7723692105f,0x000c33f453280d2c,0x000025ada8e98fe3}, {0x000c0b833e348d2c,0x000e0ba8811e2fa9,0x000c5dfe5a602118,0x0001fd3eb14fb4ad,0x00004210c779e9df}},
+{{0x000dc7d06f1f0447,0x0003edb87c059d24,0x000bb2d28fb2269e,0x0004877d15b0272f,0x00007c558bd1c6f6}, {0x0004814869bd6945,0x0007dbe1c8d22edc,0x00055cc5ab0d6d90,0x000dc83c63bd212d,0x00005a6a9b30a314}, {0x000c1524d396463d,0x0008ac35a24f0d0e,0x000cbc5fa412bb62,0x000afc3a50c3a791,0x00000404a5ca0afb}},
+{{0x000696e65c72151d,0x00009911ee681c8e,0x0004b775227dce54,0x000f71e89448262f,0x0000206a553d12d5}, {0x0008031ab15ef51b,0x0000daa01e9e054a,0x000a132498532f4c,0x000d476b5bfd4cfd,0x00007dd29417f997}, {0x000af69c5d8aa236,0x00047b3f367af7bc,0x0005376d89bfb294,0x0007cec96e69f8dd,0x000047f8afc86cdb}},
+{{0x000d50c1087b8389,0x0009ef104944e83c,0x000a9d488ffd2984,0x00060fca7ce5a322,0x00000ed560ec4530}, {0x00050302fb35f3c4,0x000bbd2b205b1c04,0x000f1ecb1e156248,0x000b12829f18a151,0x00006f59360a7107}, {0x000bb0c06ae9cd5c,0x000e6ef47efb8036,0x0002b8e91cf9febf,0x000394c816c832e2,0x000037e7c36ac935}},
+{{0x0001b0965c664faf,0x000216897d2d180b,0x0009c5d781ecf688,0x00065eb3a197130c,0x00000a89a2c5d70d}, {0x00058abda9b5fab2,0x000974331187d5c0,0x000f7541c1b72aa8,0x0004a4889a27f38a,0x0000591cf22c4f62}, {0x0000f043e498fb98,0x000e3af4b55e5078,0x000112f9d9fb440f,0x00049aa675d5d20c,0x0000423d188feb25}},
+{{0x000f40070aa743d6,0x000cb5b265ee88c1,0x00068fd2deccbad0,0x0009633574b046b6,0x000046395bfdcadd}, {0x000c9e1b2a416fd1,0x00028e350598b62b,0x000d5d6967b5c6f7,0x000ee9804343fd83,0x000039527516e7f8}, {0x000fdb2d1a5d9a9c,0x000bcd1005c2a117,0x0004d56fea9c7745,0x000d016efd4bef15,0x000076579a29e822}},
+{{0x000fb91117f2e17b,0x00026d19c33be45a,0x0000a78ff51bd2c1,0x000e79ec0a83cd2f,0x000014af5c2521d5}, {0x000bba8cdcfd72e3,0x000cb87f879af112,0x0008bb8afa601581,0x00074f612c76f9da,0x00007f2ce474c70f}, {0x00008d91ebb35be1,0x00073128f3b2602d,0x000e32bbc6cb740d,0x000935382412f0a3,0x0000389e9fbdeb4b}},
+{{0x000d8a6b64fa2a47,0x000a371751718683,0x0000801801f2ceee,0x000a0414cb8e88bb,0x000042fd12f8710b}, {0x000b10e9bc867734,0x00051b05ed6864d7,0x000a03e1ddb2fc6f,0x0006d6da132df6ca,0x000015ac49f730ef}, {0x000fe16f76e808db,0x0007e5b3e8570f1e,0x0006fb74a389088c,0x000cc52880025857,0x00001f27856bcd7c}},
+{{0x000019cd44291356,0x000bb2628443b411,0x000e2cae46734681,0x000e07a04abbdcc3,0x00000a6656cf8c5b}, {0x0008d054e2c6a19e,0x000e55aa12109f89,0x000b3e12792b6747,0x0003024e3a2430f9,0x000061364079e948}, {0x00075ae3686595ea,0x000338dda0bad579,0x000eec49c60adc71,0x000be833f10eb4d6,0x000035a351dff7cf}},
+{{0x00068e7e49c02a17,0x000a2bca9a37f45b,0x000c224c1b23cd51,0x000bdb13ed65f11e,0x000043a384dc9e05}, {0x000cb51352b434f2,0x0004993de80e1333,0x00050d35ced83228,0x00077c1b55128877,0x000002c514bb2a27}, {0x000bd5da8bf1b645,0x0007ef6b54b53684,0x0009b0d253fb8bd3,0x0008059313916d7a,0x0000116092096154}},
+{{0x0007cac4713426e7,0x000b84edd01e0467,0x000e1517ebf40b9d,0x000a1a1efcb992bd,0x00004b730c92d01c}, {0x000d8fbec986c95c,0x000a905cce77c4ee,0x00086b46b5dbe8a7,0x000e0a869f2c0c29,0x0000250f47ad291b}, {0x0009a5ad160557e6,0x000f3881048e186b,0x000b6d5b9a50242f,0x00041abc01122fe7,0x00000ef04f44eeff}},
+{{0x000f6cfbee05d4f2,0x0001ef651d79719e,0x000719baa27d144e,0x000dd15c5e5d2b09,0x00004eb3f148a778}, {0x000358f4cbafe227,0x0009a03512a0acf6,0x000fc7dbbfac438b,0x0007ae31510463eb,0x00003c06d4b474cf}, {0x0004652ad58fa9e0,0x0008e4afdc7b2182,0x000038c7c6bd6768,0x000d97775b6139b8,0x00001bce4cd246b8}},
+{{0x000f423846d10526,0x0005d170346f38a3,0x0002c78946008b58,0x000228bab00f40bc,0x000013ac8d097831}, {0x000b4293a4638243,0x000d634b26ea611f,0x00072193d7b4b49a,0x0003dfa57b95f5f1,0x0000026d71686815}, {0x0000ab1489cd9f97,0x000b3899c2eaf256,0x000f8d0391e4123b,0x0009f7341b411d89,0x00005b05fa9763f1}},
+{{0x000d166929dacfaa,0x0004c8413598fb44,0x00053d5559da529f,0x0008e0be9ef63ca4,0x0000351e125bc569}, {0x00085616369b4dcd,0x000a7655c35637a3,0x0004f1802175c02c,0x000e0427dc21bf9d,0x00002f637d7491e6}, {0x00049b461af67bbe,0x0007ac8ab8961d4b,0x0009a699fbd60303,0x0002a9a71dee19ff,0x00007f182d06e7ce}},
+{{0x000afc5359f4bfeb,0x000317db7f52c1f4,0x0000564e89629b85,0x00087bc15c2c06da,0x00000a34047b19b1}, {0x000b44888198024c,0x000952129e6e9199,0x00041e4d007d9ba3,0x0009f8c1f2de4bf1,0x00006dd9d6e32f30}, {0x0002caaed4d86ab1,0x00039b4b4d8bda28,0x00074080cb7b24ee,0x00078c56c4919a08,0x00003b1eda7fdbdc}},
+{{0x00010cccc2d17a2b,0x000e4b797b31752a,0x000e1e0b78d7fe0f,0x000ba0bb9bbe682c,0x0000461623f9a9ff}, {0x000b358194ef084e,0x0002405602e7b6f6,0x0004fdb83ae17c3c,0x000cd7907b8fc6ec,0x00004a686c43bf12}, {0x000732ac932a738f,0x0002970b73fe64f3,0x0000d99b6203de1b,0x0006dae8191cb0ca,0x000062fc0ff6a186}},
+{{0x0004001e0ff18d6a,0x000a7d197af68285,0x000cd1c16b5cbd3d,0x000ef968c3863d26,0x000072ee6a2b5a04}, {0x000c96f136be7793,0x000fd2e3dce5fe4f,0x00081cb315d576c0,0x000ff6211db5d592,0x000051e3fa711732}, {0x0002bb3463160379,0x000580cceb60635b,0x000867479daff2cb,0x0004f157fff88789,0x00001c27cac04c03}},
+{{0x000c8e64ab0168ec,0x0005515edc5437a7,0x0007cd0edacb5a4a,0x00093b0095519d34,0x000067d4ac8c343e}, {0x00054b728e217522,0x000f4d484b8d8094,0x000f46903caa58e8,0x0005217d358254d7,0x000044acc043241c}, {0x000d6bbb4f7a5777,0x000d4918313e11c7,0x00096b46848b35fe,0x00071bd4adca1c6c,0x0000556d1c8312ad}},
+{{0x000d9c88fadb4484,0x000029d533f8a330,0x00056e573427e644,0x0000764f942e552c,0x0000223b482dc424}, {0x00002d5e66f5f21b,0x000f939cb2b73d45,0x000d47c9808206a7,0x000d78adcb12ad79,0x00006e687626895d}, {0x000eff996e7aff99,0x0005fff70b5ab3bb,0x000f568f9e8026e8,0x000114a6fc5b7ae4,0x00003a61b532d6ca}},
+{{0x000ebfc83fb5edff,0x000a36f09d8f4bdb,0x00014e284c16a92f,0x0005eec0dc39c094,0x00007065423b5620}, {0x000b628892d086ed,0x000051d0bbd73e80,0x0002798550958748,0x0002476246c235e2,0x00006be98ebecc90}, {0x00025d5a6b786974,0x0002d1e852b866a4,0x00067bcc5eda9871,0x000f5a93242112b0,0x00003bdd95491423}},
+{{0x00024806e79fe94c,0x000756e24e4eb0f9,0x000c2cae00ea8e9e,0x0000fd1c91b0c1f2,0x000016def17bc5ca}, {0x0001a26c6253cf4e,0x0000ae0e6e6ae50b,0x00056d0cd92446c2,0x00097e98c84d9f17,0x00000e96e8fe8da9}, {0x00092d3b5d0246cf,0x000750a702c98c2e,0x000c9ea4cd0e1df2,0x000e95aa5b819405,0x00004b473fb058e1}},
+{{0x000f40e30c8d3982,0x0003e15a3fa3417e,0x000773646e31f707,0x0004eff4f21f3cb0,0x0000746c6c6d1d82}, {0x00006756b11be821,0x0002310a3f3dd81f,0x000a99465d0faff8,0x0007f05f8b2d0556,0x0000097abe38cc8c}, {0x0009c9877ea52da4,0x000559bdc1d430c4,0x0007ccebd24c4369,0x00084bd022c3809f,0x0000577e14a34bee}},
+{{0x000add34b5ab52f4,0x0000b7e1047b1db7,0x000270f64c6068bf,0x000c9964f8f2ddea,0x00005a7c569f725f}, {0x000953da6219309b,0x000cc174a2272eaf,0x000a145272076367,0x000b37ad48c4d50d,0x00001dac51c4d728}, {0x00029a74cdda37bc,0x000a083ffbd4c5e6,0x00023788617c0ffb,0x00020b1f870c2899,0x0000092df3b49a98}},
+{{0x00027937c78e872d,0x0007b15ea0451a84,0x00025446f887a3ed,0x000cfdd3642e1417,0x000072eb3a0f09d4}, {0x000bd3f84740c39c,0x00010b6e9bf6dcd6,0x000106cd5633c360,0x000366c3b4bcdbf2,0x0000594a7917ee1a}, {0x0001d1f48a161568,0x000531262f138c5c,0x0004ae5f6defd5f3,0x0003c1dc2a9d00d7,0x000057cac8ba1b2f}},
+{{0x000144c212afa137,0x000d9f068ff94137,0x0003332b57dd2dde,0x0004939bc1c18caa,0x00007a07ed00329d}, {0x0002dd3d21277ea5,0x00084fae25f84e3b,0x000f9e93ca95b3c7,0x00007b3fdaab9d38,0x00000e9ab174a260}, {0x0007571c3ec4ba00,0x0000b41882ace7ff,0x000c1db6a8a1699f,0x000c1cc21671c2ff,0x00005096d0b442ac}},
+{{0x000268ac61a73b0a,0x000103791a5f5f0e,0x000b6d00e9f2fafa,0x0008f42c1e13e826,0x000060fa7ee96fd7}, {0x000ecebebd4dd72b,0x000da060f221194f,0x0000c8d1fff46a4f,0x0009295124a5977c,0x0000705304b8fb00}, {0x000d1d354d296ec6,0x0003e5fad31d8b63,0x0004bd42ecf3c305,0x00053fd670b958cb,0x000021398e0ca163}},
+{{0x00061111e67cac3a,0x000b4dc22f502697,0x000b00b06a04b1cd,0x00000c6f04bc6a15,0x00007b0cebffb8b4}, {0x000bd4d5753fbcaa,0x000a977e65a059fa,0x000202a625dbe00b,0x000cd0676a6ab685,0x000033ebeeee1f70}, {0x0009fcee1072673e,0x00000d704ba5a480,0x00056c00e5608534,0x0006006b36471b3d,0x00006fb791b6b093}},
+{{0x000ce8911194432a,0x000cb6f2d44f94a7,0x0008594cb258d705,0x000eecedefa8c082,0x00005b7d9c3bb92b}, {0x000f8470c6b9932e,0x0008c4c73579f879,0x000bed2ce8f3355a,0x0007b3095a3af846,0x00002805c73065f5}, {0x0008ef7827fd7fd8,0x000557a3ada8094d,0x000e9962b5344ef5,0x0005e96a294bc0b4,0x0000061fa1ee6805}},
+{{0x00017915195ed370,0x000219e2ee23d11e,0x000df1554b44bb69,0x0008324cdf1ac0b2,0x00007ab77fdbe72e}, {0x000c8a33c2042d75,0x0008c7a726ae401e,0x000f5298efe8991c,0x000b1d777728b256,0x00004c29e70f7c21}, {0x0009f959c27571d1,0x0004376f3f81b7e6,0x000d83c898cf0826,0x0008c0845fb90ef8,0x00004f51267579fa}},
+{{0x0006982f71033891,0x000cb3fd4aa1ae41,0x000c98adb7be0de8,0x000c8eff5e627f24,0x0000180284ce7860}, {0x000c07518ade616f,0x000ce3411335ec44,0x0005763f981eba39,0x000700ecaf5d21ba,0x00000817fa483f96}, {0x0007db7c0ef507ef,0x000f6788e4ea2e60,0x000bf899a04b89c8,0x00007fb3a1868696,0x0000756efc48e627}},
+{{0x00048be04eedd008,0x0003f269c37da801,0x0009350c547c0717,0x000acfc5cba8b78c,0x00000d9f41f3c319}, {0x000a566c49e9c452,0x000fef90621efd74,0x000ce01fbe223f2c,0x0003ddb9a9896d48,0x00000f9f3aa75f67}, {0x000ea3147cae1281,0x00039856de11a9ea,0x00007853e17a23a9,0x0001fa255706392e,0x00007e94c87b0d60}},
+{{0x000793bde85af6b3,0x0001f6ec9dc30471,0x0001b0ccd0d5c597,0x0003bc34f3db3d3d,0x000011163fdffcf0}, {0x000c79eeaf15f6ce,0x0002546fc73a224f,0x000387bbcc043b9f,0x0006896c77719792,0x000030fde7412222}, {0x000130c2c752f173,0x000387020eb38150,0x000f4d2da3143a42,0x00071a0b7731b577,0x0000499db7fea1ce}},
+{{0x0006b8135e11ebed,0x000ab152f93b6cb9,0x000ef1a3fa099b76,0x00023f2fb56b7022,0x0000635ddc8c0d98}, {0x000a915fee0926eb,0x0005368a6485d53a,0x000e42e2ebd2e87f,0x0003d22ef0049aa2,0x0000227058b0b82a}, {0x000185336f9a58b4,0x000482f9d7bc7b9b,0x0003f2570fa7512e,0x0004678aef769ae3,0x00003b0c636dab88}},
+{{0x00027468d6069569,0x000047e31c50cbe6,0x00084f7c4b245d74,0x0004c4f83633fe14,0x0000563eda16d88b}, {0x00010ce84af07ed3,0x0002d78bd3497f0f,0x000591df187523b9,0x000665b9d1c3a6d8,0x00000ad92ce8908e}, {0x0003a2a87ee5a9cb,0x000dc9ddbf18fcc3,0x000deb170274b3df,0x0009ae9c5861924c,0x00002efac9a32ca7}},
+{{0x000a1508af9f0ab7,0x00076b5c3adb11bd,0x00000d35d05cf64d,0x0007fc261d8f64d1,0x00007361a4fe491b}, {0x00052f9ee2424104,0x00060d4cf308f307,0x0008ab36c78e790e,0x000bebdb59408097,0x0000155b0a7c10dc}, {0x000003f3d75ad8d0,0x000b0e890bd380d6,0x000375240c2b4717,0x00009604f2762f7c,0x000056afbdd49781}},
+{{0x000f1db7be5c669b,0x000f1298caccb181,0x000147d3eacbfa10,0x00007cde8fab138c,0x00003d5387ac5d55}, {0x000550be36b797c8,0x000aead42777589c,0x0005f96dff9d163f,0x000bbd10a9058995,0x00004b8d9785b4bd}, {0x000d3a5c621d66a5,0x000c5bfb921df5d9,0x0008c6965e6b770f,0x000cdea38820f0e4,0x00000d2362be77ff}},
+{{0x0002532f3cbfd1f9,0x00002ef51cf86a7b,0x000fa633aaef5230,0x0003c34795c6e65b,0x00003374a3d52a7e}, {0x000bd4e54098becc,0x000a2e1efe964153,0x0000b6304e445a25,0x000d7d9d81b639f9,0x00003badad6f4577}, {0x0004046444c3e366,0x000d2d546e8de30a,0x000d18647cf9caf6,0x0001781c65dcd673,0x0000137df72a23f8}},
+{{0x00065e5eb4066b1f,0x0000819bfd9b0603,0x000c5f556924d774,0x000300353cb22338,0x000038fd7bd72c4b}, {0x00023c43b7599f46,0x000093006b68eb36,0x00021ffe84605f01,0x000c30b4a0c02920,0x0000769c701aa554}, {0x00039789596d5760,0x0006ca29c182ffb8,0x000a5ad6f0ab2300,0x00047600890e59e0,0x000010abf924042a}},
+{{0x0007ab052a6b0585,0x000b96d9fea0ff29,0x00018dbb0a8cc3f9,0x000c12957838fdcb,0x000077a26afd73e6}, {0x00065a06e5f84a9b,0x000c734bf7314cc6,0x00054ac1e2fa2e51,0x00052110880dca65,0x00006235e7cfaf02}, {0x0000b3d09dd4a460,0x00028b155ee09255,0x0009e07fc0d31dd8,0x000c3567481d32af,0x00007cb144753bc0}},
+{{0x000ea4b2157c7c60,0x000fe72734cb1477,0x0004dd5bd155d949,0x00019c441dbf8c70,0x00007e1fa7ec6f8f}, {0x0001e037fde7e2b1,0x0001bb50c22f929c,0x000b1d5c2b5bb892,0x000c63a5299f5d09,0x000029e1171ca910}, {0x00007cefbb37ad0d,0x000baa9f971cbb1a,0x000f5d530dfbfaaf,0x000d8c80a474d811,0x000049c1364b8976}},
+{{0x00080cb6bea9530f,0x000963ce3521580a,0x0007061a9e357b6a,0x000f6af5fa2a920d,0x00005309c2fe40c0}, {0x000a55b5c21dda64,0x0000a75ba62c2d78,0x0004647760b426b5,0x0002e8559f1e681e,0x00005a1ffb357c19}, {0x0000e620d3bd8d60,0x0008fee3cfa04948,0x000d8ce556a50a3f,0x000648fe7d9bd4de,0x0000135df6e8f8bb}},
+{{0x000defaca2b3fe9d,0x000f66c7ec7de005,0x00041e7c71135e8b,0x000c2d39b2b62745,0x000037d8127af782}, {0x000dd64141e2b45c,0x00097c979ab77839,0x000f8f2180586bea,0x0000855c7a9d27da,0x00001758d03d158f}, {0x00074630213c0408,0x000a37fd1da9e4e3,0x0002505a8beca028,0x0007cf7595d014d6,0x00006ed8797c4ff1}},
+{{0x000e4f137eb9168e,0x00037c9d7dd934e2,0x0000c5582da5e711,0x0007d036bc0e9e98,0x0000237276681672}, {0x000ed22edd14759c,0x00001d70fb019d70,0x000a2609dd204319,0x0000c7a6b4060931,0x0000448943b8ea9b}, {0x0008741123c9689c,0x000733885fe700e3,0x000e921bbc5a4086,0x000ba76b03a5b231,0x00005b068e7e9146}},
+{{0x0007d20fae1c9511,0x0000c15226e07857,0x0009504d54f1a819,0x00090260ce3b07cd,0x00000f3f75b2c983}, {0x0003faaf2feeaa44,0x000701291e873c4d,0x00052b42c1d6a81f,0x0005311f4b3d8e73,0x00002d391c67bed5}, {0x000eca9e41307a2c,0x00026c6384fc97c7,0x0005d4e7a6dc2887,0x0000f515237c0de9,0x000031de4c2d7d6e}},
+{{0x000c4479cd256048,0x000de39c20ff0745,0x000490132dd7206b,0x0008772e37c3748f,0x00001370d0e894df}, {0x000423714dae953e,0x0003b809b123d5a4,0x000efc55baaf92f6,0x0002728ba53b260c,0x00001a081df3261d}, {0x000cf81f32e1226f,0x0007c9093a3bae2d,0x0004aaee3f3d00b7,0x0005c4e2154c910d,0x00005c1fce85f1b5}},
+{{0x000e9f3319c736e8,0x000d9413ffa3e067,0x000e28e08f20356d,0x0000f72ce44f8a07,0x00003c71cc12b2b4}, {0x00007041ab34a678,0x0008027c7aab307a,0x0006f052eaf7d57c,0x000a4355e1e4bf21,0x00004ed25641c32b}, {0x000c7280322c7bbc,0x000b263731f39e46,0x0008d9282b3619c5,0x00098c1877acca09,0x0000168bd21df528}},
+{{0x000d6d098d5512f2,0x00027c94a2d0e119,0x000487a8f6e110c9,0x0001be38915a5cce,0x00002e078b2547b3}, {0x00002fc2bcf58fde,0x000e736031a797b9,0x000c2f48bb731bcc,0x000f1e1219e6c95d,0x0000300bea0dfcb9}, {0x000769475c77b615,0x0009fd481d5b4b76,0x0001d4e9f17576b7,0x0008873663202284,0x00003e3d00d8c40d}},
+{{0x00000c960bc3f6b3,0x000f8555ce2fc819,0x000c398b20fac0e6,0x000c5dd6b77b6532,0x0000662b5f6707f9}, {0x0009845ad590a191,0x000bbb2f5b2ad1eb,0x00032329376722ff,0x0004a911eb1fc769,0x000047108aa3f203}, {0x0006cd53c1652647,0x000607d53e7b2dd9,0x00048d507290dfb2,0x0001e4b259d8422b,0x000066776a239f36}},
+{{0x0000fb5b63307c25,0x000c6b04c477890d,0x000a30c720deccb5,0x00093107b859f09d,0x0000688415fefdf9}, {0x000faf4966ffc9ba,0x000c5f1028913c29,0x0008fd808b694e70,0x000d7ec2478a9acb,0x000076b90f942cf3}, {0x000c12fbe7c52753,0x000fea6d432edfb3,0x000c385b110a14df,0x0008e3f3f5ffcd00,0x00003a090a556cf1}},
+{{0x000300d01c79beff,0x000d13ec362cbe81,0x000c12a951f73ffb,0x0005f344338bc129,0x000003075741b755}, {0x0008fe52c01aa385,0x000f87e63ff2ce29,0x000c33c15b972440,0x000a72ef06138aa8,0x00004c3a62cc0c79}, {0x00084b86164a5c61,0x000cc06bcf0d580b,0x00050d020262beb4,0x000912cb91af69dc,0x00004c338160ba22}},
+{{0x0008884bde982d89,0x0002e500e0bf4c79,0x000676f4ba08ce8b,0x000ddb379937f60a,0x00004090f74e9140}, {0x0007e72f933e40d1,0x0001d025544c4ff8,0x00094ae47842a0c6,0x000b79fc3b9f42f6,0x00002ed5b238f2ab}, {0x00061ac3f6f830f6,0x000d08ecdfdbffa7,0x000b31ae52224dcd,0x000d5ac8a92a2b0a,0x000002bde6f124ac}},
+{{0x0003b7f644a39160,0x000987c51a2252f9,0x000df15822f92956,0x000b54d3a31f59aa,0x0000417a8122aaa5}, {0x000613f1b703f182,0x0007caab927338ec,0x000734bdb258e765,0x00057ecf26c38c6d,0x00004ad3921bef72}, {0x000cb4df533ccdff,0x000f5fc42c867b53,0x000d84e021db5e2b,0x000b35fe05725fe2,0x00000908a33e404e}},
+{{0x0006614a89fd5dac,0x0003d9e6f1543bbd,0x0001cbc3fd863bdc,0x00055e90057b7b41,0x00001c5e7eb2cd0d}, {0x000bb0ad826cb95f,0x00098010f95aee59,0x000066eb6698e19c,0x000a54d883328479,0x00003bdaf5de0adb}, {0x000aea4bbcc8c84b,0x000ddce3a4bad88b,0x0006c5eb9814251c,0x0009d34ec2229bd7,0x000017122d8bcdae}},
+{{0x000886393ecc0b56,0x000062ecebc79dd7,0x0009e7d26b195fcf,0x0007b21b6ada91e4,0x00006caf423fe696}, {0x000f0159e59d2828,0x000b23651d05a58a,0x000a4408b8755ecd,0x00069fd14abbd013,0x0000474257a650c3}, {0x000ae5204c8ae852,0x000781a9b4599af9,0x000ea29d96fdc5d5,0x00068cfc7f271cb9,0x000005ba24e3a7df}},
+{{0x00038922f839e828,0x0006e8a39b6b9c7f,0x000d313cf5d15588,0x0003a71f3ca3c706,0x00000eb9257ad7d7}, {0x000bdacbe69e2eeb,0x0009a82d569cf77d,0x000c40abc6eaf20c,0x0002bf7891d48d9d,0x00000869daa0077a}, {0x0004b122df5ea7aa,0x0006d454cd47df81,0x0002ef5875fa9095,0x00010814467fb9d7,0x00007019359aa760}},
+{{0x000f032d742f50f3,0x000ccb7139861065,0x0008b0229fde4813,0x000effc3d16ac7d5,0x0000263582d6582c}, {0x00009668794329e8,0x000e14e3ce6f3870,0x000d466c8d21f818,0x000def7c59da1b6e,0x000053dde33f7abd}, {0x000bd97a88a6c7d7,0x00091097caa1338f,0x0002a6f02032a5c4,0x000915f9a69af855,0x00000d5759b6cba0}},
+{{0x000cd4b3f2161bec,0x000ecb3922649e8e,0x000d172060013544,0x0007e7221aa85148,0x000045c05522cb93}, {0x000eb1fe6b639bfe,0x0003ad86b1f040e0,0x000649cc032f7a4c,0x0006fdac32c8a974,0x00005df604c6ed40}, {0x000972f81b5b1be9,0x000a346dc2bd15e7,0x000bb8b317548ecf,0x000c345be5db33b4,0x00007cb213e02340}},
+{{0x000ab2ca8da7d2ef,0x000dd99f42827216,0x000fdd3c75366ad9,0x0009e62ae64b9004,0x0000403a395b5390}, {0x0005fc16861b7e9a,0x000476a27c45186c,0x0001e93597f6a330,0x000dfeb01667267a,0x000005ffb9cd6082}, {0x0007fa9ff53f6139,0x000e513e66cb6a61,0x0003448aa460f2b5,0x000a192d7a8beefb,0x00007a2932856f5e}},
+},
+{ /* slot=6 [{1,2,3,..,64} * 128^(2*6)] * G) */
+{{0x0006123a6b6c6609,0x0008580ab5938b49,0x0007c27a5fa750fe,0x000193cf471bf39b,0x0000507903ce77ac}, {0x0001a66a90166220,0x000ae5bf1e009ff9,0x000f90df7cf22552,0x0006fb97dff85d87,0x00004f620ffe0c73}, {0x00090d65dfde3e34,0x00092b9fa5fad62f,0x0006164510cf28c5,0x0006c8499c86ef9c,0x000025d448044a25}},
+{{0x0008230ec7e9b16f,0x000c1c1c5795dbd6,0x0005b6b1ff0eb1b9,0x000cf5e7943c8c49,0x00002f9faf620bba}, {0x000c4415c9022b55,0x00041812eb1fe2c7,0x0007b65e0d56a0d2,0x0003b26f02ea1c9d,0x00004180512fd532}, {0x000f3e698a48a5db,0x00006bd95403ba4f,0x0007d5b65dba6a38,0x000d2fb9f7ce1af4,0x000015e087e55939}},
+{{0x00007543745c1496,0x000fdda38610c122,0x000c71c34fdaff3c,0x000ede9e4e797272,0x000039c07b1934bd}, {0x0004186efb963f38,0x00080dc639bd5889,0x00096c1c9948a00e,0x0003661a4e8092be,0x00005a097d54ca57}, {0x0005892b17c9e755,0x0007289308df82d4,0x00025b8bd9d033fd,0x000c0796c2fe9d95,0x00002edbecf1c11c}},
+{{0x0006a4e3c715a0d2,0x000b0f8341d4d161,0x0007e899cb53623c,0x000baa696ef5329c,0x00003d4e8dbba668}, {0x000f0fddd087a25f,0x000555c3e34eeee0,0x000fab3ab59c7531,0x000d3b2660c572e8,0x00000854fc44544c}, {0x000ba0c555edad19,0x000fef0a83de661e,0x0003baa5f824b533,0x0007e8d3b7704288,0x0000678f82b898a4}},
+{{0x00091d0bd6900c54,0x0002c9d132636b14,0x000b362bc9353972,0x00069df4db928920,0x00004d7cd1fea68b}, {0x0009d94057775696,0x0005c3cd951db1e0,0x0000bce16feed126,0x00089f4fa9dac2b2,0x00000f7f76e0e8d0}, {0x0009ebc5d485b00c,0x00092e4adb36536d,0x0002119ccda25964,0x0000d5fc1659480c,0x000045306349186e}},
+{{0x000dd0c1a6cdff1d,0x00015e84213ae94d,0x00092fcf6a55f6f1,0x000f16f6c935f859,0x0000067ee0f54a37}, {0x000414ec2b072491,0x0008127a7b65b96a,0x000e8a4af01bb221,0x000765f6d2849596,0x000065f3b08ccd27}, {0x00029fff199801f7,0x0001fa2a0f72fecb,0x0005fd2f499d361d,0x0000fe225f11d237,0x0000124cefe80fe1}},
+{{0x00026cf9d18df255,0x000e9147a63b64c1,0x0003c93b5fc1d471,0x00086a22c6d3c73f,0x00006be3a6a2e3ff}, {0x0008e85b31b16489,0x000b7db710bfb151,0x00014ae2398faadc,0x00020c139b0bdf4a,0x000005f4cbea503d}, {0x00040e9ec04145bc,0x000e208f6834cce0,0x000b8847a3c71ff4,0x000aba5bd546e8da,0x000064666aa0a4d2}},
+{{0x0001435a7c06d912,0x00021bb3f830b684,0x0001cbe278ca123c,0x0005046d4b37b27b,0x00001d753b84c76f}, {0x00053bf73337e94c,0x0007e11e14f15b0c,0x000930c7507cb569,0x00004684b84abac1,0x000028dd4abfe064}, {0x0000b64c44cb9f44,0x000ace3925dbf7dc,0x000d0457c418a3e1,0x000892e7a3034862,0x00004c498bf78a0c}},
+{{0x0002e90b7aadd808,0x000a54ee51c0648b,0x000630832b8282ec,0x000197b79bf5292b,0x00001463e6b9bb9d}, {0x0007d68ea08a7d76,0x00092ac4bb6e3d2f,0x0009ed52b9f652a9,0x000035b2afb26eee,0x0000164e0a1ef3c6}, {0x000b238058bd0515,0x000ed88be433cf46,0x0008aebfa4cfc2b9,0x0008865f1f410ea1,0x00006619461fa446}},
+{{0x000bdd408ed6bb19,0x000d2b266831ce06,0x0009d37f8dbd6a32,0x000404dab187eecb,0x00006e26c676b92e}, {0x000fc105a03b9d8c,0x0005a5662c8852a4,0x00087a8f69bbc856,0x00011f87e4b35499,0x0000361758a6af14}, {0x0000aa98694aeefd,0x0006250bd0bfd7e2,0x00097c01c0375511,0x00060e8f1cbb73c6,0x00003e64792a813b}},
+{{0x00053e19fc6a63d5,0x00092f23ef160539,0x000d8d7160ba9a68,0x0008cbc9cf131559,0x00004de5b29f1baa}, {0x0006981c62974d10,0x0001c1dc4b523029,0x0005fb970ea50538,0x000d3d2d94bb50ce,0x000002da246fddfb}, {0x000b1c4fa5e477d4,0x0003e9a8be3f6275,0x000bb3cdb02e4146,0x0003b93002d172b5,0x000077a6ba07bc4d}},
+{{0x0000d542761dae58,0x00051bb3853d7e1f,0x000fa0384e0626b6,0x00085e27217d3069,0x000007eca458ba5b}, {0x000e83bd9633a6f3,0x00044521e2a4f8e3,0x000afa471f48462b,0x000a52fddce596ce,0x000008f1cf564dc9}, {0x0002ec7078b2da10,0x0001cfbdbfd68b38,0x000363a4b3115587,0x00038a7b96b04704,0x000039a5804ca2db}},
+{{0x000ef67e01313c90,0x000d583cd3526277,0x0009a84642dcbe63,0x00048f0268aca07a,0x000018f20c02bc3d}, {0x0007efbf1a9fb0b3,0x0009c583ef38a71d,0x000c6280f515edfd,0x000d1df5b0699414,0x00001e0e659bb67d}, {0x000bfa2fbbed3371,0x000d9a9449d496ee,0x00057edad87b1c61,0x000e0b492f9846a1,0x00003b5283ab2860}},
+{{0x000157667579d008,0x00066501629f1355,0x0008c96b540149bc,0x000909e2425f4271,0x000050dfb55de41f}, {0x0009643543ce6179,0x000275e9e548f2a1,0x000b2c7be0b2af40,0x000c225f85e3653d,0x0000154802e8d378}, {0x0003b391d1a3ae79,0x0007888759cbd3c1,0x0008cf0be600e90a,0x000513a07c216671,0x000036805672d2d4}},
+{{0x000e933728f865af,0x0006bf9c8b323d40,0x000cbe78ed0f7039,0x000a5179b19f13c2,0x0000186e2b93f4f6}, {0x00097d563505dad1,0x000d740aac09a7b8,0x000b6f3c40ad386c,0x000a4528b219692b,0x00003cfd636f871d}, {0x000ff4dc3a7dc716,0x0002c997ed505614,0x00083d769b631f29,0x00094bbdb19f1be8,0x00000f7fbb6982a0}},
+{{0x000653fb1aa73196,0x000303fd7641837d,0x000b3a17b20f9495,0x000613ead200b09f,0x0000544d49292fc8}, {0x0002aff530976b86,0x00006c2d2460422d,0x000de5bae58d90b8,0x0000c17dca1896c4,0x000028005fe6c834}, {0x000fba9f34528688,0x0009425107da16ae,0x0006d94b365c1bff,0x0006dfaf75bbbcd6,0x000072e472930f31}},
+{{0x00032c51b2bc1f64,0x000db6a69b8f192d,0x00091fbfa6192126,0x0004964d0bb1ccec,0x000045226c60ce05}, {0x000233d47015baa6,0x000cd6b3d56eab45,0x0009203a212f9029,0x000aa1fdd51f1632,0x00000af8c8aac00c}, {0x000a6b1237055479,0x00007373fbfcb202,0x000285fe3f0099bf,0x0006e224249d5f54,0x000049bb92103620}},
+{{0x00030cefcd71fec9,0x000325f1ad933053,0x000cafad8b708093,0x000b6a6911ef5d0a,0x000040b548533a9f}, {0x000daaf7c057f81f,0x00017931f7240dab,0x000dc1bb84f248bc,0x0005756ddc4ba270,0x00002ba3a29a0d27}, {0x0006a9bdb837d0ba,0x000a6d38ca813263,0x000b3bb38962339b,0x000e928a4bdf8190,0x000054ef7ceca01a}},
+{{0x00019eec66ea5129,0x0003893216f7db75,0x00009c9cfacd1257,0x00040df213100386,0x000051663fdb06c4}, {0x00007f8876a5b63f,0x0001e32788314887,0x000f925d36b5da36,0x0000cbf0280adba8,0x00000503e2361719}, {0x000b629bf543012a,0x000480a67939b3de,0x000ca1e4f6c2810f,0x000f855d78cb0a22,0x00001d1929c3a1d1}},
+{{0x0004e8cf181016b5,0x0006125a6b5f25a5,0x000438e1740e4c1f,0x000cd47b529e5af2,0x000022a6ac6d603a}, {0x000df83b3df5edaa,0x0006bbe3264713d0,0x000d873d3107ee51,0x00024c68cff70e18,0x00006bf09d8b29d1}, {0x000c298eab1e97de,0x0008185acb022b40,0x000e73f11968631b,0x000105b800f24855,0x000006a581c37dc8}},
+{{0x000a7cdb1140308e,0x000512f824d0834a,0x00074e34a5d7d338,0x000745ead83b7fa1,0x00005431e5a8cf97}, {0x000bad204e65c2e6,0x000ccf084818e858,0x000b840a86b3d96f,0x0003523ac00f43a9,0x000013687cbef97d}, {0x000d6d07c8b8c498,0x0002ce5c7b9aeee3,0x0008232859914ccb,0x000b147f80bf1940,0x00003fa6f8003899}},
+{{0x000e78c37b9ef111,0x0000100ba2188994,0x000a50200c6bff3c,0x0004d08ac134dc03,0x00004bc3014b2020}, {0x000198787ba68cdb,0x000d0e2c96612a4f,0x0007a20eb0b5a2be,0x000081c730a2cd01,0x0000065b2517b0b7}, {0x000dec2feabc580d,0x0003ac02e795a21b,0x00067c34378b0484,0x0007cb2c3683e08e,0x00001f68f10e9923}},
+{{0x0000cb5836da90bb,0x000917018b2d4507,0x000cdbb06c83579f,0x00054cdde74d77e3,0x000015717c73f181}, {0x0002a3912b7abe65,0x000c6a6627189602,0x0008b2f1315572e0,0x000061219b8bbd83,0x00003079fdb80ec6}, {0x000ae82b97ab2fc5,0x00066ec040b565ee,0x000786fac272e735,0x00009c31093e06cd,0x00002b012926127d}},
+{{0x000136cddf306cd3,0x000e008a341436e1,0x00026ab424a4de02,0x000ce4a224ec6454,0x000074d660210d77}, {0x0004ee9c02699304,0x0004e32f3c84f4ff,0x0004e80fe2f49bbd,0x000814c0f0686e3d,0x00001953cf2b85a2}, {0x0001460a039a6846,0x000a02f9b8061663,0x00062fc0d6a04820,0x0002e149d355ca00,0x0000581e05489183}},
+{{0x00026197b5c89250,0x000ba332a163bf9a,0x00044cac98465042,0x0005e3f6cf3d3457,0x0000220d614b753c}, {0x00088ca764937b1a,0x0001562332241203,0x000222da6370756e,0x0000027bc33848cb,0x00006554d96518aa}, {0x0007898e025c7612,0x00093781a99753c7,0x000f54d176db8202,0x0009693e3c0453ca,0x000048d4db9c2e88}},
+{{0x000551a6fe5f7281,0x000627c7f3fbee45,0x00037072e494fe05,0x0002abfcf5c6d382,0x00006d13e8dedb98}, {0x000b2d9b9ad1076b,0x000a337fc3e494ac,0x0007ceed602dca0b,0x000439d1461e3613,0x000061a76b971fee}, {0x000e428a04cca531,0x000e7a2121d12b49,0x000f16e43d5c17ff,0x000f81bcc44ce50a,0x0000040021fed596}},
+{{0x0009e01187ca7e5c,0x000acb33fc4d128a,0x000be8b189718b5d,0x000e33b29ad5c91a,0x000008ff0201b13f}, {0x00080b05bfede1fa,0x000270950c9ba971,0x0003d183b3425bb7,0x00090d77a3d7928e,0x0000326c2d92c434}, {0x0008d9c1d83c1861,0x00026f80670e061f,0x00073a3232f39292,0x000f699c7b8e9ad2,0x00001be70da43216}},
+{{0x000145574aab866b,0x00082e8177fcd1d0,0x000c3c878b51d878,0x000f699cc366dfde,0x0000716b7b7dd86f}, {0x000811b98044ccc4,0x00004d2b9b46e104,0x00023f6e202ff1ec,0x000de1f5e4c0e05d,0x00003bb4f49d8d4a}, {0x000ad848bfb46081,0x000dbe10a9c636f3,0x0002ea9e6a9cc9c2,0x00023689df90959c,0x00003372ecd5beda}},
+{{0x000e1a18526ed91a,0x00057d4c78cb6b7f,0x00097abc48b9add5,0x000048dee29f0bbd,0x000019b08abbb914}, {0x000aceebc161340b,0x0007461f67afea84,0x0000fc73e2f3da0d,0x0004b8bcf07710ee,0x000019800fc86d9b}, {0x000c64b973096d2a,0x000fe86e41f72efe,0x000ee8a04bd90c5a,0x000d7fc7ffe2a672,0x00005bfa63cdd511}},
+{{0x0006d7b7870e0f3b,0x0003f9f5fd0661d0,0x0003434accd33a44,0x0007f862233b5a8b,0x0000161fd5d14145}, {0x000bd820518187dc,0x0007c1426220342c,0x000703a04a3ef5d1,0x0001ac943cb78a06,0x0000199ae12a9a90}, {0x000479c8458af959,0x00038c7a92140169,0x000b11ac8bc3c249,0x0004c43f6a77e2e5,0x00007020bd198dcc}},
+{{0x000fda3599c6c516,0x0008c0413ed6dd1c,0x0009e742b35cd280,0x0001c3925511844e,0x000011a52bce8e37}, {0x0007317db7c6aae4,0x00027af585ee66e7,0x0005b9ca211e28f5,0x000d934790a84ba6,0x000072ad2d2cb609}, {0x00046efad61217ca,0x000c6659bfbcbc1b,0x0002d3e0722a77f4,0x000f9cbba4050655,0x00000406cf012859}},
+{{0x0005208c9781084f,0x0000b23450ee1269,0x0003efde02b1502a,0x000a34cfd9daea60,0x00005a9d2e8c2733}, {0x0003f635d32a7627,0x000865f6566f007f,0x0008d044507aaa4d,0x00064383c85e7972,0x00001fee7f000fe0}, {0x000305da03dbf7e5,0x000491434cdbd765,0x00024a88eca4daf2,0x00005437b4ad5cdd,0x000000f94051ee04}},
+{{0x000b7d960d90a6c7,0x0007b7f5d3070340,0x00018e3e00ba2c18,0x0006cc2e69b97cdc,0x00004500deac0921}, {0x0008eba58a308b3a,0x0003fa4271f84099,0x0009a82cb236bf19,0x0003e1297bd2350f,0x0000753f04681717}, {0x00073af8ba2184c3,0x00017e4929097ac9,0x000c09004817c5a8,0x000f4e01246bea08,0x0000485ff630cedb}},
+{{0x000c35f138f6a781,0x00045a91d00c0139,0x000c0bc55323ce61,0x0009c672bbe568af,0x0000101201bcbfd8}, {0x00089a18c373c545,0x00001ea97f86f25a,0x000e9d327e90e8a2,0x0009a0173e18a2b8,0x00000c43cc0c8c0e}, {0x000a69927edb2a6a,0x00080d77898a83a6,0x0001f8cb1fb59fd1,0x0003ab63ca1b43c2,0x0000484adaacff73}},
+{{0x00039cda579b4e12,0x000a8b8c99ff2116,0x000d8493e6cd9b5c,0x000dc283b731ac6b,0x0000182ea3044b83}, {0x000b1bd3b6540dee,0x0000940035c68968,0x000e171bd0588075,0x000d9b660b8ad4f8,0x00007014437a3df0}, {0x000281520a517b1e,0x000c4b7af201b04b,0x000caaa04d80fb77,0x00096d3807406f74,0x0000346721713823}},
+{{0x000d340f585a7082,0x0006829b3a797f93,0x00016015783e375c,0x000cda9dc3c38bf9,0x0000410e7b1558ff}, {0x00008a2a1d28e8b3,0x000ede94cc3e3819,0x00062d73c716a38f,0x0007c64ca3a81214,0x000046723a34bf6c}, {0x0006a670380c9e5c,0x000b35881e456d38,0x0005670941b36756,0x000c2dd70b96e115,0x00003b393f7714c5}},
+{{0x0000671c2c0a4338,0x00072a7337e381bd,0x000d89dbc5014d14,0x00024e94a2d8cbf6,0x00003aa210508c04}, {0x0008613d3d029ce4,0x000c064807cf563f,0x0000d637355dd659,0x000c4c95915d95af,0x000057d856945931}, {0x00076232f181e251,0x000e8a11b088867e,0x0003a74b3c8789f6,0x000a8a174dd8812a,0x000052c0c4f106d1}},
+{{0x000598f9d877b5db,0x0006e3d327b2e80b,0x000cd9280b5630c7,0x0008d0799dee0ead,0x00007821c69e442a}, {0x000c4d63554d61d5,0x00072e345b17b666,0x0009acce410971d9,0x00096d51607226f4,0x0000718e28286bf0}, {0x00027cb918fe31af,0x000b5ca9fb12ddb1,0x00038c599ff8c04b,0x000cf4c263eabe5f,0x000018025fc9379b}},
+{{0x000d9b6da4d11b09,0x000dcb70ac43041b,0x0009bb8c0034fde7,0x0000091c2d165b45,0x0000314825247ec1}, {0x00028e21cb5073fd,0x000579f901e3b4c3,0x000780e7fc5fef1c,0x000fffb23e593b00,0x00001a7e914897ec}, {0x000dc0ec231dede4,0x000d82399abfed4a,0x00006dc28e006724,0x00006ec205639e22,0x00001caa2e1382eb}},
+{{0x000e1581982b0c45,0x000c4603e5b3cded,0x0007204ff3804dcc,0x00016005a394d762,0x00006a336da3388c}, {0x00091cccadac2136,0x0003274910b09aca,0x000bacaec55d9d1a,0x000c1ec61ae7a23f,0x00006f26d42b4f96}, {0x00003cb5549dfe0f,0x0009bcaff6965dac,0x00025caff069b07d,0x000ab10066abfc98,0x000012d78f986ecf}},
+{{0x000fe9125f017cf9,0x000b8ed57710bf7d,0x000b4bb4df8c3fc2,0x000f20257908658c,0x0000752d9ab13231}, {0x00095ea8ae78d423,0x00043dc034ee3f3b,0x00014dd021d134b3,0x000e6577196a7e96,0x00002a4b680c64fc}, {0x0002453d819b3598,0x00070cf458e8f2fc,0x000e1783348809a3,0x00025fae9f1c91ad,0x0000107be9ce60c4}},
+{{0x000316b5830f1d17,0x000e70c74c5ce967,0x000e677cedc07cdf,0x0001d384e925f597,0x000076bbffb02ef5}, {0x000c608e966648e9,0x000c6502e46ee0e1,0x0002cb57b54145e1,0x0003e08eaf25f615,0x00004e7b26450617}, {0x0009fe59703b887a,0x000eb1948472c434,0x00033d0d35f4c4db,0x00018b21eccc8587,0x000008a090f2a15c}},
+{{0x0004f1a35b0dc033,0x000e416326d4768b,0x000b4bcc4dbf4f00,0x000824f3068a201b,0x000048a8dc933f4e}, {0x0001feb88f89c050,0x0006685bae6d920a,0x00018b0db2a338dd,0x000b830f620026da,0x0000062cae154c35}, {0x000e82ec8dda555a,0x00045b0468fb62c0,0x0008c4d9b803bc06,0x000ba8a9e4585947,0x00004ac21556ae09}},
+{{0x00087bad3597da28,0x000df7bdcc469a0f,0x0008f726a1577b98,0x0001dbf34ba52735,0x0000460e05c5ef97}, {0x000b69c417da5a43,0x000c897045a28039,0x00066f618192edc7,0x0007d2b400f0eb49,0x000063a12d9486dd}, {0x0006ad7c2f6b4a27,0x0007531357661a65,0x000c5f2b835abceb,0x00099662b3416f74,0x00003d4e2f72a7b0}},
+{{0x0004c9c392f6716d,0x0000555644e9ab31,0x0005f382addcff9a,0x000bdc92e1d86029,0x00005a71c38ae637}, {0x000f0c3fcb959feb,0x000c037085248ab0,0x000eb54fa798f917,0x00065fa153e0ada9,0x00003769435bb6c8}, {0x000cfe86a60cc062,0x000a5ff9e9a26670,0x000d182c07dfc838,0x00025f1e937d0fda,0x00006cbaaa1a3df0}},
+{{0x000443f0b0200989,0x00036b75a0d81b4f,0x000d5ccaaecbaf89,0x0000cb1f1553db25,0x00001caddbd362f2}, {0x0003a66b01e15b6d,0x000b9a5e7fdd771a,0x0005afc3a1c72b78,0x000a937ad45150b3,0x00000f36f4ed6dc1}, {0x000277851854f57e,0x000c7caa7119a5c8,0x00076f393f913159,0x000bc64556f4b6be,0x00006971c7823072}},
+{{0x000cb770e620e8e2,0x000046cd9e19bff7,0x0006579704b2a0e7,0x0006778b2fbf6ed4,0x0000409e20370bbe}, {0x0001ddb535017ae1,0x00071df557fcb213,0x000782b271377956,0x000f5f50ddc05ab1,0x000024b00fd44fde}, {0x0001acf5dbfc8860,0x000a50f4d608d311,0x0001266d056d3422,0x000f5b42a5226e48,0x0000293089ec4feb}},
+{{0x00056b23c3d330b2,0x0009bb0471b068d3,0x000e42b83cf21c8b,0x000b10db36c316c6,0x000007d79c7e8bea}, {0x000f93bb07af9753,0x000cf3db766a7d7e,0x000e0b1ec5583ed0,0x0000452ce6998bf6,0x000047b7ffd25dd4}, {0x000bfb9cbc08dd12,0x0003ae1eec29b87f,0x000b1fc1bf8a066b,0x0004bb60d57242bd,0x00001c3520a35ea6}},
+{{0x000f23174398b3de,0x000a8883dcd608e7,0x0006ecbd1a097777,0x0009788553950b13,0x0000761fcef26258}, {0x00014bb8ab813961,0x000ff671e7cf3e5e,0x000a447b50abbcf5,0x000babe54e3b3d10,0x00002d0ee1d1683f}, {0x00052c9e2b8fb08e,0x00084e2a92839163,0x0003530275e4257d,0x000b610e3fa844a1,0x0000515ad849340a}},
+{{0x000bda45da177dc3,0x000d40a2882f7917,0x00095a131aef5881,0x000ee2db694830c2,0x00003d9f6c357fbc}, {0x000c81afe79520c2,0x0007549cceac5b9c,0x000ec4cef3391297,0x000207926682c4ed,0x00001796d912c44c}, {0x0005ceb484566cd4,0x000bbf7214f1409c,0x000d99b795976d61,0x000ab490fa0c68c2,0x0000436ca77c40af}},
+{{0x0001a5501d6fe4db,0x000b1fe21cadcbb8,0x000f66ceeaeec278,0x000cd49ab656c1e7,0x00000cdfe3f77ad7}, {0x000d8780971c2541,0x00023d222d96903f,0x0005ffa4a45daef5,0x00050baf31524fc0,0x0000070b4467a7d1}, {0x000437fe25c615dc,0x00063c64db1e7259,0x000aa9682d54662b,0x00076693a76f0ad2,0x000015f681bb8be1}},
+{{0x0002071f701aa1b7,0x000eeb6f15aa320a,0x000aa9a67e368881,0x000669909cd9c864,0x0000558341b0c2e5}, {0x0009a4b3205cf540,0x0009a7d0791aa82e,0x000e5fe765d7d82a,0x000111c8a65b23fa,0x000016933c770a03}, {0x0000f5cafb28e8bf,0x000b6ccc72e3d48c,0x000d882decdfb25a,0x0005fa31fae598d5,0x00004e8cbe5be250}},
+{{0x00000597ec45c983,0x000c173be1071a1c,0x00079eed2eda27be,0x00035755b2ee947b,0x00003ca0a78001af}, {0x000f967160328ea8,0x0006e3d2e4d90cd6,0x00023f80ea4bad01,0x0006ec3301456f27,0x0000424980bb5d32}, {0x00082cc41cc12414,0x000f3c87658107a2,0x0005b0ec59fbb8c7,0x000047dd6bf2bd75,0x00005e3f04250ffa}},
+{{0x000d02caa00d0e60,0x0002de695128aea3,0x000e4e9357fa0dc9,0x00021fcb9a8f6762,0x000025bdcc8c0f5e}, {0x000722d26f390688,0x000e7f6a6f462923,0x000d299d5c63b68a,0x000355f049ab0032,0x00000d4b2e28bcec}, {0x00015f255cd7cadc,0x00070a03c19a7402,0x000916d61df8a140,0x000557d8e078ed46,0x00007f2dcd58fe81}},
+{{0x000df726033dd58d,0x000b8f2a9855f053,0x000f24f3d6f9b300,0x000d584ead2bd479,0x00003ea844967b29}, {0x000c969ef025e0d0,0x0005314a8f14d51d,0x0003d79b98cb0b37,0x00064e979e475d81,0x00004f98d6d32735}, {0x00013049a3be503b,0x0009cfd450b78df6,0x000697d2b27e18be,0x000c4fbe15ade1b8,0x00005744e8df6428}},
+{{0x0002cc1a3b0b7a06,0x0006a41bbf7056a5,0x0001c7a07ff9a61f,0x000ee9e193eb04fc,0x000031cfcb45d327}, {0x0003cc435e6c3c98,0x00072b81e76db866,0x000bbd6630cbcb64,0x000f547ee5d31fd5,0x00005e5c5c5700bb}, {0x0004230eb7be821b,0x00064bed5ea8bbef,0x0000a513cac8cdc9,0x00001d205fb0c59f,0x0000203d3d7f1d3d}},
+{{0x00093b44553d2357,0x000f7a9f73482e62,0x0004a6897990a850,0x00083da36364c88a,0x00007cbe1b53a3e5}, {0x000c243ade463d5f,0x000ef70b60931d0d,0x000f120bff16b914,0x000f4b3c48d462b5,0x000039a190a8def6}, {0x000b52f600951478,0x0005703ed84eb391,0x00028d6d4bddcc71,0x000149ab57f465d8,0x000034e9d34e59dd}},
+{{0x000661cff6ad5371,0x000ef493ae3b4e7f,0x0001b0a0155857e6,0x000e16bcd7527e41,0x00001381055129a4}, {0x0005679f21b0ed5e,0x0003fd48e3e9796a,0x0001bd1160dcc7f4,0x0001ff74ed34ac8b,0x00005040db1e4bda}, {0x000f523b011adf68,0x0000b94321424b5a,0x0005501173349859,0x000fd8d821a9f03d,0x00001c09596e2248}},
+{{0x000e5830025fe22c,0x0005fad485f28672,0x000a9b841af43950,0x00026043b6b79963,0x00000b139151691a}, {0x000c91f188ce028c,0x000a3370baaf0c0f,0x000b2ccd255f836b,0x000ff4f88f3fd111,0x000008d43b11cda3}, {0x00072bf19cb146ca,0x0006e5e3685e1714,0x0003f10fe6765d94,0x0008a5e5fe725c01,0x00007165a28bdb26}},
+{{0x0008d0803ade2f6a,0x000e8ec628fa8369,0x000950bd8c2261cc,0x000fac5112f6ba7c,0x00004610d22fda46}, {0x000dbb5a42dcfcef,0x000f08ce8668d4c5,0x0009b74f65dab3f9,0x0008415947e4bcbf,0x00005bfdf6eed6ba}, {0x000d34efa97f5cdd,0x000caaea6852d872,0x000782f805da7f68,0x0004908ac4551fad,0x00002f8609bb9f93}},
+{{0x000542aa66a322a4,0x000c90f4bcf5d44f,0x0007e9e0a4e4edd6,0x000b16389087e2b4,0x00007f3421975b5d}, {0x000bba10e08d3d43,0x0009ecf2290a2e8a,0x000c452bcdd3b80c,0x000a45317809b0f1,0x00002439912dfe80}, {0x000c747fb46db5bf,0x0001808433e63b19,0x000e9d7343bc9cf0,0x00094a11b030cd8f,0x000036242953d758}},
+{{0x0002bab03602711a,0x000f02ff1e43889a,0x0005e43936ff75a6,0x000076927068efba,0x00006577b6f0f0c1}, {0x00070c2d9a3ff324,0x000df629efc9ade7,0x000b46d5d862dc98,0x000c89546980634d,0x00001261508e59a8}, {0x000f486e63b1c74e,0x0006b8a854174f7a,0x000f00f794284f59,0x0004b4a3a9afec11,0x000022cce4e98edb}},
+{{0x00081b3e130a6cca,0x000da6ed7c34a42d,0x000705607b8f5370,0x000490ca1dded3ab,0x000056c1c36e4d81}, {0x000169fd3f750194,0x000ccf3581d27023,0x000ef1e561b333d0,0x000c957676e4e876,0x00007d6d6cbfb983}, {0x000287eba9b8f8ba,0x000c4045b9278af1,0x00001c177085db7a,0x00029f21185928af,0x0000740d3073559f}},
+{{0x000253a6bccba34a,0x000a13838219b80d,0x000882e3963e61c3,0x000e66f90c3b6019,0x00001c3d05775d0e}, {0x00086f40216bc059,0x0001d12bcd87ecda,0x0007c709901fbb23,0x0002e55b4956a9e1,0x000038750c3b66d1}, {0x000ef1409422e51a,0x0003c2b5df671692,0x00044ce029cbc0c7,0x000487c21014fe77,0x00000621e2c7d330}},
+},
+{ /* slot=7 [{1,2,3,..,64} * 128^(2*7)] * G) */
+{{0x000ab9e3f53533eb,0x000d56eb93d40362,0x000d5a5572338568,0x00013189e0e14521,0x00001d24a86d8374}, {0x0000d36cc19d3bb2,0x000b7622386b9131,0x0007a14f5c062a6b,0x00057547c9b8591d,0x000003aa31507e1e}, {0x000c7648ffd4ce1f,0x000f054ac8c1cf4e,0x000d09357ce045ea,0x000485988d225821,0x000043b261dc9aeb}},
+{{0x000525ed9ec4e5f9,0x0000116903303426,0x000be5cadc0e5eda,0x0005f4072b1a7f2c,0x000029387bcd14eb}, {0x000c6ea7f1498140,0x000f8392b4854213,0x000629ceba7c1e7e,0x000c5bb2488c38c5,0x00001065aae50d8c}, {0x000c4525df200d57,0x000d6bfca674a1c2,0x00018340305c3b2d,0x000e7160a07e7b1e,0x000069a198e64f1c}},
+{{0x000b39c7426f6b96,0x0008508bea681f79,0x00051eaf5571b23e,0x0002a08b2c7f676d,0x00004ba27608710b}, {0x000f35dd318ad089,0x0000f634c643afa7,0x000247348573bff4,0x00006631cdc10c7a,0x000019705014a499}, {0x0001d3068afd2af5,0x00097c6c9f86d5cf,0x000612ac760ab1d4,0x000ab4e6a5fe5887,0x000029448a53ec33}},
+{{0x000cd613efa9d697,0x000a41c0679597af,0x0001fada960cc45a,0x0000365a56fe104c,0x00003a73b70472e4}, {0x0006e56b9e2d4734,0x0002b81c616757b2,0x000c9cde7fc4c713,0x00043adef5c9525e,0x000039c80b16e717}, {0x00096e0d1b826c68,0x000e24960e3db0f1,0x0003b7436cf71ff0,0x0007282611316702,0x00000cf0ea5877da}},
+{{0x0007bf61a0c14aa7,0x0005a2bcb2eb53d9,0x0006cd902f47bcf2,0x000da4acf07d5244,0x0000626885038a32}, {0x0009a6bd2bc7ec5b,0x00056b7ee961d317,0x0004f63db82cf19b,0x0003d934b2930c8f,0x00007370b8f2032a}, {0x0001c99e83ea1dca,0x00016af5919b899c,0x0005a376b8ef4c61,0x000dbf6d76f41c4f,0x0000235443d642ab}},
+{{0x0003da3f4d16b4ef,0x000f8e257f899143,0x000f5cac487c3d53,0x000745c2fc9f50e6,0x00007b8215e42847}, {0x00077b2954969414,0x000546004f42fb48,0x000a8e00ac7d3413,0x000215fc6ef138e4,0x00006df35cacee4a}, {0x00027b5aeff0b8b2,0x0006ef35929b86e1,0x000d421c550dae66,0x000127c502cf5bc6,0x00006766bbb0d845}},
+{{0x0006431c33bcdec6,0x0007113a6b69c758,0x00071fb83d106205,0x0007e485abb69ca0,0x00003f0a16fe8a37}, {0x0005b1ee815409d5,0x0001bc1594c3b3e2,0x000178d38c21a5a8,0x0007341e8e846460,0x000019719715164e}, {0x000f5c7d00d821b6,0x000bca475f71d98b,0x000c5f516ba027e6,0x000775397d2361bf,0x00006d9df6755d54}},
+{{0x000c80a4ddd4ccbd,0x0005d95f2dd9d196,0x0000d6c71b22e6f5,0x000042fc75e33c74,0x00007bb51279cb3c}, {0x0002ced43ba6945a,0x00061e881c05de33,0x000e67ed3bde0b13,0x0003d5d1ad40f095,0x00005da8acdab8c6}, {0x0006664a3a70159f,0x0000f0a904e14c4b,0x0004096c1376194f,0x000eceda5614c39a,0x00006cd0ff50979f}},
+{{0x0007619d3e501911,0x000ecf87ad35ce95,0x000ef2360f424a2f,0x000b74a1881d9ed2,0x00001723c95cd84d}, {0x0008b511d4b48716,0x000a1b872b6b5061,0x0008480aa507a950,0x0008f0bd5d5df681,0x0000229f2bde1ac7}, {0x00015f507766b359,0x000d7af092028b27,0x0003081a775301ac,0x000e00e2dd6a5b59,0x000071bdc340283b}},
+{{0x000e0ff13e61b4b2,0x0000579d686c60fa,0x000050b0ffc49cf8,0x0004298ae21980e0,0x00002289e110bf73}, {0x000f65100a91abeb,0x0002113f6c704694,0x00040effedfd4116,0x000c9c30c93e30e9,0x00005fec846ba2ec}, {0x000ba4f00b9cf9aa,0x000e97aa05c8d9b9,0x0008c0b4cf11d353,0x00048726ef0842c0,0x0000681bd5afcc27}},
+{{0x0005632df80c7e57,0x000d40b95f41cfa7,0x0002a369921a8945,0x000ccc378b28b99a,0x000079f08edcfc06}, {0x0006a658fcc9147f,0x000bccbd96e08459,0x00065994c79cd158,0x000e6d27cbb62845,0x000073f61df41659}, {0x000ea4f70e22248d,0x000ebfb449366090,0x000ce0ad63c8d397,0x000870c4f89bb22e,0x00003da56af4eb1d}},
+{{0x000067e78f4428ac,0x000b0a61135e3c0e,0x000806293514835a,0x000849cf21d14f33,0x00006390a4c8df04}, {0x000cfabdb04ba18e,0x000fc3bddbcf77fe,0x00057a131cd0fc7b,0x0003a61a41d486e0,0x0000641a4391f222}, {0x0006b95aa606a8db,0x0009eb06825f1c5c,0x0004fc9eff914b7f,0x0005cfc2a731f6b4,0x000030ddf3856270}},
+{{0x000ddce8ff10196b,0x000df3c190c8d146,0x000d500e9315751b,0x0003aca4535e52a3,0x00007ec9eabdab29}, {0x000ce3331c966315,0x000ee6146185d4e0,0x00060cf9e4011476,0x000d95e7087f611a,0x00006b69cf23bce3}, {0x00013311df994611,0x0000e26f3535ef5f,0x000519e124035bfe,0x000ddd461018934e,0x00006494d01203f6}},
+{{0x00080087c7daa2e3,0x000091ff0ef2a296,0x000bb39f08b29a02,0x0007b9137f607d31,0x000058bef5e580c7}, {0x000ad42fbf2289d4,0x00093173a3aca992,0x000378083fc8030c,0x0006aabc9193ac28,0x00001f20976cc806}, {0x00053d1177c3112e,0x000d6acd6b8961e9,0x00010d90b00ef374,0x00036a7a755231bc,0x000031eb9f4667d5}},
+{{0x0000ed494693dc8e,0x00004541fef1894c,0x00065644f17c310e,0x00001274b0f384cd,0x00004c9fce2bad84}, {0x00051151c6ac4f9a,0x000cdb7fe34ed0dd,0x000722aff3c90846,0x000e8e62c320580e,0x000010dd3179aea3}, {0x000924d260235978,0x000b571897e67751,0x000541380aba2991,0x000dbc8da49e0a38,0x000001e775d0fc9b}},
+{{0x000dcbdad1bff7f9,0x00082206457174e3,0x000f189d56c9118e,0x0007668bacccebc0,0x00001b4822e9d446}, {0x000ef2bd68bcd52c,0x000b069482ef233b,0x0001cb1aeec649db,0x000a7e5b5b6ee0c4,0x00005c294d270212}, {0x00060a7f25563781,0x0008a480f7958ab3,0x000114b4e3251222,0x000fe2ac75d05276,0x0000222d9625d976}},
+{{0x000580bad462c814,0x00081fa568c4fa88,0x00098327c31f67af,0x00095a99f9b9ad32,0x00003a3f74e82e7a}, {0x00034d5ea9ac811c,0x000dbad3788b4147,0x000df9fd66383a28,0x00090688d361464a,0x00007cebfc452ed0}, {0x000e7af9ff83da77,0x0008d6ab6f3ce7aa,0x000e19716793a83e,0x0001c00bca6cca92,0x000022a2da76adb4}},
+{{0x0006e562dc8c303c,0x000f3d1aab818cb0,0x000b6e90c236fcb2,0x00015fbc936b705f,0x000065d43ccad429}, {0x0005a83c946ded0b,0x000216af610e393e,0x00029a2d65f5a7b6,0x000c1978c71bc509,0x0000544e6066e49f}, {0x000e97ad4369a122,0x000907d71d201215,0x000dcbd11fb2dec2,0x0008089ac0de2768,0x00006d9fd2f66439}},
+{{0x00067a9cec58ef2d,0x0009625b0fbd93bb,0x000e4290699cd3cb,0x0003a427497c4a81,0x0000307242548172}, {0x000073c77ae30f31,0x0003beee1bd67ddf,0x000823edc8adf750,0x0000c54294902352,0x0000252995ca15c3}, {0x0002fa9a7276d0fd,0x000af450943dd5f1,0x000b443714184d32,0x000a3484e921f37a,0x00001b50d63412fe}},
+{{0x00017f85b372ace1,0x000694638bf181c7,0x000bc08b5881930e,0x000fff4239cad056,0x00000b34271c87f8}, {0x0004be7e0a344f85,0x0008c87f22c380f9,0x000ee16f0feb2faa,0x0008dea9ce1e75e4,0x000043e64e5418a0}, {0x0005e2521a35ce63,0x0004df912028e815,0x00057ddcecbe100d,0x000c6e4bff80bf8a,0x000057342dc96d6b}},
+{{0x000d183347131960,0x000d0671fe019252,0x000733a4b4aebd34,0x0000d6c5948d468f,0x000018f649273db7}, {0x000dc08b20e6a619,0x000f759d829999a3,0x000982ee3b4d3023,0x000897fcc6ed0329,0x000069dfd2ac7e85}, {0x00036682d7b851d5,0x00045c84a765128f,0x0000c8aad7cf9f85,0x000099378d9d4f8c,0x000042ab3f87f4c0}},
+{{0x0003b0ddda3a36fd,0x000ed28f136348ab,0x000a17ed8a711a3e,0x0009796e26159fd9,0x00007f79dc409b45}, {0x0002d787ae0c0781,0x00052e41b07f6576,0x0000b85f5297ee2c,0x0008c8708b9e7c69,0x000061f987760a0d}, {0x000059627f024814,0x00012f61cfbf40b4,0x000a691e0b60bd93,0x0006ed00e67399c3,0x000019511e5bd758}},
+{{0x000986745c779118,0x000ddf7e7ab9ced2,0x0006ecc64c4a1145,0x000fdb812105ec26,0x000066e0bc4edcb0}, {0x000f047c1928c188,0x000448ab41358866,0x000da35055f0f01b,0x000bfeee5a9b6eee,0x00002779dc2b764e}, {0x000d65c783bf38ed,0x000b8cf68439af50,0x0006810362607754,0x000dfec5f522d0b8,0x00007360331382f6}},
+{{0x000ef065c8ce5998,0x00010b5cbeaa2efe,0x0000b7c458bf0295,0x00048558c64a1062,0x000035134fb231c2}, {0x0003bcb71e707bf6,0x0008c7291a762f3c,0x000ad69a33351d9b,0x000807f00502e6ed,0x0000522f521f1ec8}, {0x000c1f46f9a3902b,0x000b799657bcc272,0x000f8a1c0ec91ba3,0x000017bae614b304,0x00007afcaad70b99}},
+{{0x000ce705276ef103,0x0006db73a87d88fe,0x000bdfbc23eaca40,0x00017eb09b3613a5,0x00000e1645296c50}, {0x0001ccba010cf56f,0x000088413f67c489,0x0009afeb7628855b,0x00055a95f57b01db,0x00007699d6600ca3}, {0x000b8a6800840ab9,0x000cbc552e542bde,0x0007ff6504b310c2,0x000333cdb7ae141e,0x0000571c13fb8dc5}},
+{{0x000ae6194a427b09,0x000bd061fca85af0,0x000d6bd4a93bf0ee,0x000624864affdb5e,0x00005610e813c7a5}, {0x00081a3fc7cdac97,0x0004fa7438a46f98,0x00044ba7a2827e9a,0x00016a3d2f88470b,0x00000e375f0e6e5a}, {0x000b0b60a51eca74,0x0000d3ba40474805,0x0008c818c94df4a0,0x0004f6d63781d729,0x00001e455f19d352}},
+{{0x00030e14118d0a8c,0x000f47b20ccb4165,0x00050c59a205285c,0x00077c339b7c6552,0x000038fb8f8d99a6}, {0x000e1cc22418231d,0x0002753def60db95,0x0008d214c59c0342,0x000ea7eb65176b74,0x00006c16e2c379a9}, {0x00094ea40f38f715,0x000e957335779d41,0x000efa2da0d3c8b2,0x000032c367eed3d3,0x000078e54fddb19b}},
+{{0x000ded54a4b8be41,0x000e11bb0e2ddc25,0x000de82ab2902d13,0x000e7cb41f43233c,0x00001085faa5c3aa}, {0x000141ecef842b6b,0x0004797abe6c5a88,0x0003784ffe55e7b1,0x00000b78c748f970,0x00005b50a1f7afcd}, {0x00040f66f1361315,0x00042701003e99b8,0x0004a25080184622,0x000732065ed45fae,0x00000a2862393fda}},
+{{0x000d1c692568d21c,0x0000d15ca76f6c56,0x0002c9c7b95f138e,0x000c5f3509445821,0x00005a9976cfa16e}, {0x0008543c2a9638e5,0x000e7056d64061cd,0x000958697a87a91b,0x0003f10303274312,0x000009b5764af6e9}, {0x0005d45ead90c1b7,0x0007b02e7c79b9a7,0x0005cb18903cbe5e,0x0006ae0be508742f,0x00000f54622adfd8}},
+{{0x00076b4627b188c6,0x0005a462d46c57ff,0x000ccaba126f738b,0x0006174e124df6e3,0x00005d37ea374842}, {0x000af7dfc36c1243,0x000e57d0351c7cc9,0x000b57242db5bba2,0x000fdd3055439ec0,0x00006ca23c54b3e3}, {0x000baa57f342a06f,0x0005929320707bf9,0x000f845c24447979,0x00084d9e027b40e0,0x000011120dd9b9dc}},
+{{0x00096a942b32b53c,0x000d98d0a0380ef5,0x000cd1879c8e8364,0x000b21428418724a,0x000068d9b54b584e}, {0x000cd928852ad9bb,0x0007d3a8d71bd8a5,0x0006a283ed102c86,0x000a03a8741967ab,0x00007fa2ec96c4de}, {0x000554d597648bc4,0x000c68ae726556da,0x000c14f1150bc831,0x000a83c28dbd6c85,0x00005bc250974d04}},
+{{0x000b13c8347cbc9d,0x000d499c1238346a,0x0007d64ac93849e8,0x0009ee74cea31408,0x00001f354134b1a2}, {0x000e737b6ecb9d17,0x00048d67ceae1960,0x00055e1b89faf249,0x00059eb37e7a9b4d,0x00005cb7173cb46c}, {0x0009e68b82b7abf0,0x000279ba6b7b94a8,0x00018d876ff41cd9,0x00009c616e6c210e,0x00007cacdb0f7f1b}},
+{{0x000c851df85268bf,0x0003686153e9dc48,0x0007d882b436c60b,0x000e17a946c9db3f,0x00005b3cf3748aba}, {0x00066844a418d2c2,0x0009f672748a295f,0x0004c4cfc790a880,0x000b1878f75cd0ee,0x00007d2a4dac1804}, {0x0002726ceb442dbe,0x0009f4732ad8c38d,0x000fdb8c348b4a39,0x000dba4b71cf047f,0x0000630f9cb727fd}},
+{{0x000592132123a27a,0x000e6070e3b7142a,0x0007558d4af8b595,0x000f01ce176a99f1,0x00001ee2272c5fa3}, {0x0003a6b936200621,0x0008d4ffd04c027f,0x0001e83e3b858787,0x000883dcb9823e6f,0x00006947ceb0e417}, {0x0008f46de59925a9,0x00089e602975fea0,0x000d10a8e2562874,0x0005a5cab45951d7,0x00002cc99f74550c}},
+{{0x000fa6fac537845e,0x00039448aa7ef79f,0x0006ed8e862c3c05,0x0003976c9d1b8f11,0x000045c793143833}, {0x000842ff70772817,0x0002eafac725b3bb,0x00099abdffe7db2e,0x0002ad56820c641c,0x000077f6a50cae61}, {0x0005a17df550b458,0x000cc06314b7ed23,0x0007318f5ea474ad,0x00077ca5ddfd65b0,0x00007b2ec32f1f64}},
+{{0x00077fae780c1c7a,0x0001ec84f7cc852c,0x0005298384ed2487,0x0002000c9ef1b003,0x0000520d4226f15e}, {0x000b19771a094304,0x0009cec284fcdd58,0x000ffc840e93bd3f,0x000ae624852d9523,0x000024c6dbc6ea80}, {0x0004679cbfe90581,0x000f14d0ee9385d5,0x000f75d3fa651537,0x00025f5f9229ff4a,0x00007b1216f5eb60}},
+{{0x000c98eeba01c663,0x000c3cf59d973216,0x0000789cb6a9fc07,0x000e15dcf49a1999,0x000016a7664a3b73}, {0x000fc6f6a439a537,0x000e3af8b2d89bf9,0x000b3308c7ec1be5,0x0008976f6dc15e43,0x000028863ad1ec2a}, {0x000b0e03a918d6db,0x000032649211bd52,0x0006469d2f2f30a4,0x000af54bf1347a3b,0x000001092f38d694}},
+{{0x00006b5ea5d19ab6,0x00011fd59a266f03,0x0002df2c66231c97,0x00002dec05c51112,0x00002c6c1f59ce98}, {0x00067c2d522a407e,0x000d39933cb8a4cb,0x00033535b7a84b5c,0x00046bb204dbd5eb,0x000053343de942ce}, {0x000124fe349f4cac,0x00090f3da55812fe,0x000f56d4552f2282,0x000d00382bf67c9e,0x0000030d65f00aee}},
+{{0x00006c30c5f14dc5,0x000e6973a877d042,0x000c7afc1aca94f7,0x000770bdebe529d4,0x00000a7d166bc778}, {0x00069248975f91e7,0x000b50525d3bc00a,0x000efb979867a8f7,0x00047d3ae8de5292,0x0000204ba2fe029b}, {0x0006fdb9b23c3ff4,0x0001beac018c15bb,0x000911f903ffa3a2,0x0009af610ce1a554,0x0000011d502adaba}},
+{{0x0000c483602bd648,0x0004ccec93bd4f6d,0x000906c6d7c423de,0x000fb091120b11b7,0x000067eda79a93aa}, {0x000968de4331ee65,0x000a8e66d27fda98,0x0007d9872caed850,0x000e23925551c4af,0x00004c8a726ec39d}, {0x00070806a7d02c75,0x0001466b14e90b09,0x000bde6598be72ad,0x000ab17abbb2bea7,0x00007a9e35523b1c}},
+{{0x0005e486e069e635,0x0007472a2c873f9b,0x00094b29a6af3f3f,0x000fb7a690efd777,0x00002a8e3e60468c}, {0x000e77e4c7c1cb7e,0x000b92e9d14f4a84,0x000a7b0bbd67f099,0x000599bdd5970b0f,0x000068702d582bb3}, {0x000f74f12e55a23a,0x000dbfaef19dec64,0x000354651858f07f,0x000bb9ea5700d1f8,0x0000023e3b110822}},
+{{0x000ccb85b293f273,0x000ee9da125a3908,0x000231e7f49d4b11,0x000503c1e09c8594,0x000029a2b3809c2a}, {0x00013cca24cdc2f8,0x000b350f68cbff34,0x00039c040bd2a64d,0x000f71900cef6bdd,0x00005ad232030df7}, {0x0009360917a95ad4,0x0003f6e55c37ea4f,0x0002872109eb23e7,0x00047f7f13a70ae5,0x0000592774f4e752}},
+{{0x0005f9f4471577cd,0x000a7b6072cf6bad,0x000ba3a3f0b039e3,0x000a73154ba38e3e,0x00005d36dd0c12cb}, {0x00087b69ae398a3b,0x000205ec280fa25f,0x000d1796ba29fc70,0x000ff96f5b0a83df,0x00004724a6610866}, {0x000caede879a3617,0x000fc6c0213cb1a2,0x000f4b5376481b9d,0x00000035e17d7b00,0x00003d4151e20628}},
+{{0x0006d71e46f59597,0x0001a5f3faa6c64a,0x000a5cf37e0a0e65,0x000d852cb09df547,0x000058e7a1a3e7b5}, {0x000e6d0abf8b8af4,0x0004e18e68269b65,0x000d6a5245b8f865,0x0004dabe3d0c0705,0x000000bdf11e6e67}, {0x0006473ff43cc476,0x00097c05856ffba7,0x00062dd6752ddd31,0x0001e116e77247cb,0x00005203a80ccce2}},
+{{0x0005e2da99dbaeb4,0x000f16b52325ad8c,0x000286f4a3f80f24,0x000b746cdd9743d9,0x0000089029d767d2}, {0x000ae77301081648,0x000a712d75c4a8b8,0x000aa6e471bfb3ae,0x0000510ab38e8f5d,0x000052dfd3dae46e}, {0x000eeed6f833b3f2,0x00043fb83586097f,0x0005de71e7ec53fb,0x000260de9d3b024b,0x000065aa9cb9ed47}},
+{{0x0008c0429835bfcd,0x0009eda158eaef9f,0x00090bc06e2cc8b9,0x0005eb3a20ce6b1c,0x000029d4f454ad99}, {0x0004a133d6a8b3e5,0x00012ebac205162e,0x000b290f03303478,0x000b0f09db567284,0x000011ae54ef2d36}, {0x000b57ce171a41f4,0x000ed8086f7b7768,0x0000908c07e0cf7d,0x0003a5ab1e883c6c,0x000044d729bc4403}},
+{{0x000ead367b2fc954,0x00024895eea57b14,0x0008edf731193701,0x0004de38d5ffec97,0x00001b9bcce3a4f7}, {0x000a071f6395032a,0x000c22448d9b222f,0x0000022feeaa66d1,0x0008e34f981a3b5c,0x000070a2174e501b}, {0x000bb78142bb0a03,0x000d528f8ae05460,0x0004f06b64a3c2c4,0x0004945f949b2a03,0x0000508b0f7f85c7}},
+{{0x000faa3b3d3bf8cb,0x0007b85ce3ef93c9,0x0007128a1d92bda3,0x000e27d022436fd9,0x00007e05b83ce996}, {0x0000752e4ea74da6,0x00075f493ec22551,0x000ae489f408586c,0x000fc8fa2f9c5109,0x0000132cec56efe6}, {0x0003d3bb526f3702,0x000114341c4c8139,0x000f51c300a36d27,0x000b7a1ec6fd4057,0x00003a2761e52a63}},
+{{0x0004b8b236df0e27,0x000eaf91a4f94874,0x000b8527de513933,0x0008265dd6509222,0x000033951b2fb7e3}, {0x000bd2f30df440d4,0x0005ff067b9c2629,0x0002c6ecaea7189c,0x0009df279b377aad,0x00002a360cf43813}, {0x000b920b16fcd242,0x000237f9b5c2fa00,0x00056cf6d2929662,0x000eb56c4c4ad133,0x000073d505c928af}},
+{{0x0002c918f91058be,0x0002030048d10f4f,0x000f5b949cf48068,0x000d56cd953b65ef,0x0000555839badb43}, {0x00011617029be37f,0x000cee74864f2288,0x000bd50f1aef06a7,0x00059a6c04e5eab3,0x0000297de931049d}, {0x000a95b69d32c952,0x0007fe159eff4237,0x0004e5503c4b6261,0x00052bf9676318cf,0x0000481784ff36d0}},
+{{0x0008e7cfddf1a71d,0x00076939d46ce03e,0x0008d0737cf4ecaa,0x000b91ce282f9d93,0x00007a87d546b09a}, {0x000d68d0cc97ee56,0x0003ae1874abe17f,0x000c2be67b62e7f3,0x000077f36e5f61a8,0x00004c2151495625}, {0x00006e3fcf7a5b4a,0x000353f2d7aad83c,0x0008a01a84483b13,0x00088b1992278ac9,0x00005befdd13b493}},
+{{0x000c9f4184807894,0x0000f77c7a7bf830,0x000a73602418527b,0x0004973845a30a69,0x0000221aac4ec38a}, {0x0000dbb277cb64af,0x00086088bc380ffe,0x0007b7894cfc3f4c,0x0000d5c52b9b20ad,0x00000971548537da}, {0x0004902dc4190ea1,0x000b8fcf93525a89,0x000c342e4de68f23,0x0000bac2e30dd7e3,0x00005ac25a7e59b9}},
+{{0x000da21650276f4d,0x000b6c1cf46e26a0,0x000b28b5933f4603,0x00099c0730274240,0x00007856255a60a1}, {0x00024e47b2a97ecb,0x0006f88b9f386a05,0x000d8aed39b85180,0x00023dbfc3463dc5,0x00001a2c47559f34}, {0x000fbcb5df2f205e,0x0004242807cb69e5,0x0008cec2ad4f3409,0x000687b6c7943201,0x00003acc1ff5064a}},
+{{0x000e5f2794c036ee,0x00017cff517bb143,0x0007980dbb4e69a5,0x000d34fbe27cfe9f,0x000065f8d87d7fde}, {0x00011344248391aa,0x0005ebe20f03a2a8,0x000b70d7d7ec6922,0x000b74eb9545e990,0x00001aad3b0a8554}, {0x000acb2911bd2048,0x000b8bb35f7e778b,0x000f113c2c25529e,0x000df8444353028f,0x0000363ac4fa0776}},
+{{0x000ec60a4af6e3ef,0x0002dec3c0b0c127,0x000b9a7933c16f74,0x000ecba0940b5076,0x00007d3c08447d8e}, {0x0003912c59fd411d,0x00004ced9dd5475d,0x000440c796d6498b,0x00070c83e89f9d80,0x00004d72a6271021}, {0x000210bbc16215fb,0x000a95463f3874ae,0x00071c2eff310825,0x000a6d75cdbdc35b,0x00007bce1e90847f}},
+{{0x000fe92c63308134,0x000d11f03deff66c,0x000bd35ab41af35f,0x00034b13f7542ea9,0x00007c86a4f6dbc5}, {0x000c66c0fcbfcac0,0x0008d643bc1adbfa,0x0007adb834389f65,0x000f2a9e13eb79e8,0x000052ae510d0308}, {0x000b7a59cdfdd59d,0x000adc695ae8f80b,0x000deb21bdf924a7,0x0002fcb8eda2c888,0x000049602bd3b7c3}},
+{{0x000355d20f220157,0x00046ce8ba67c6bc,0x000a7e3489c41c2d,0x0008972187deabb8,0x000036b9e7fef2ad}, {0x000887ffd5a0c6ae,0x0000b04b65230d5d,0x000aae8508b7a3e7,0x000ae9a5bf3db571,0x0000459d340f1b92}, {0x000ff530fd42f27f,0x000ab399b5639463,0x000d6ee409f63829,0x0005715ddf515871,0x000056d9b19e25bd}},
+{{0x000073a23d65f788,0x00031ef1e682294d,0x0000e71428035f82,0x0009c879d0bf048e,0x00005989d872a6d4}, {0x000a1a61495664f3,0x000f3883ffbff018,0x000bc7be76d86c28,0x00069f1e4b090dc9,0x0000083773419db0}, {0x0007c316fb2e2fdd,0x00064f8e56ca52c1,0x000167ff9074441e,0x0000ab40c7ffe81b,0x000028f72c247d68}},
+{{0x0003c55522b2621f,0x000687cb727e17b6,0x000254a29e457b3d,0x0006dcf54e67cb36,0x00000d65fa43a7b6}, {0x0001040470af44e3,0x00032b6044c3b848,0x000e90a6214eda6c,0x00014849a9690132,0x00003ac55d5c6a29}, {0x000ad062c31a2f51,0x0002ce736548fc9a,0x00050fec7e2478ab,0x00039287cb38cae3,0x00000f5df00bd35d}},
+{{0x00070a401b3a3936,0x0000749e9e19d9c7,0x00010995a7dbae94,0x00019435934c19df,0x0000742b9faf0bdc}, {0x000324325464995d,0x000dad2ea59b4768,0x000819a0045947c4,0x00006f3aed56916d,0x000076b1c324be42}, {0x000922d087f905a3,0x0003b1078d30aa58,0x00033a29c28c7f60,0x0006f2c5095ec422,0x00004533c94ce3c8}},
+{{0x000a7de4b5679582,0x0007f59c78960db5,0x00096d8186ff768a,0x00074b114c3f3990,0x0000599f50cd6c88}, {0x000e206e0ec62472,0x000fcd3faebbe34f,0x000ac0dc48bf6e2c,0x00018232dec78f8f,0x000047b56e1f9799}, {0x00099d4415d14f38,0x0000c13f258c450d,0x00089ee58fd8b131,0x0001428a8c969399,0x000046ac4b1ad9c8}},
+{{0x000a1c0edebdb2ab,0x000c9a430f13c217,0x000408481f580e43,0x0007e16a83e929a5,0x00007e49898529d5}, {0x00029f3ed7a4029d,0x000bd04513b8ceec,0x000f2699eab856d5,0x00079e2279adc53e,0x0000607867c24369}, {0x00001697ae8e4f8d,0x000a83c92f498994,0x00027ed9b7719b07,0x000760f6cdb07b86,0x00005db0e68a94b6}},
+{{0x00069ab3d2122149,0x000dc34daa235b18,0x000289477b78fbef,0x0001d41c4aa63506,0x000041f5cc0784b4}, {0x000a7fd08dda276e,0x0002990b9c092e9f,0x000f74121f47ff05,0x0004a351019e1261,0x0000610352a4bfd6}, {0x0009ab4b128b7ac2,0x0008ffe020ff7232,0x00054ce7f56dc801,0x000bbdf1066ceb1c,0x000003d55011e388}},
+{{0x0002b2e0d91a78bc,0x0009cc8509667906,0x00005070b847c988,0x000a1bf9df54a664,0x00007369e6a92493}, {0x00014434dcc5caed,0x000963c84fb33e10,0x000d86a0e747ed5d,0x000f9e470019576e,0x000025b2697bd267}, {0x00073ffb13986864,0x000d9415dc7b89d6,0x000f273b5e3ca5fb,0x0004cd2e04ecc3bd,0x00001420683db54e}},
+},
+{ /* slot=8 [{1,2,3,..,64} * 128^(2*8)] * G) */
+{{0x000c2b256768d593,0x000574422ca13da7,0x000a0ace1d98c1c0,0x000a690f1a80bd5c,0x000029cdd1adc088}, {0x000fd1ef5fddc09c,0x000fdf7575dced6c,0x00001634c2e82b3e,0x0002b9b25d56b5d2,0x00003041c6bb04ed}, {0x0002f2f9d956e148,0x000759f356b2e0ff,0x000f6c025cade797,0x0009a7b1a4698bb5,0x0000104bbd681404}},
+{{0x0000fd3168f1ed67,0x000cdd86f3bc251f,0x0004d2f2de2c811d,0x000714944dc5c430,0x00005be8cc57092a}, {0x000d9a5fd67ff163,0x0009d4cc75681a95,0x000e20f257e92be6,0x0002df5b7f8024cd,0x0000204f2a20fb07}, {0x00043b3d30ebb079,0x0005abd652e30c81,0x000f6d5c31758915,0x000161f653c3c318,0x00002570fb17c279}},
+{{0x000a367f2cb61575,0x000761cd6026c3ef,0x0005b52562f5f96f,0x0000acde8c7142a6,0x00003dcb65ea5303}, {0x000ea9550bb8245a,0x000a88f9050d1192,0x0008a4c935c8e6fb,0x00086687986ea2d8,0x0000241c5f91de01}, {0x0008172940de6caa,0x000f022d9733a28d,0x00035b01d18fbf2c,0x000f0e516d7fcdd2,0x000008420edd5fcd}},
+{{0x000f20ab8362fa4a,0x000d4e21a3e6ecdf,0x000c39e62b57e118,0x00069fde3179617f,0x00000d9a53efbc17}, {0x0008c34e04f410ce,0x0005a276e0685035,0x000bb91521b6135b,0x000889c5d9670c7e,0x000004d654f321db}, {0x000dc116ddbdb5d5,0x000b68da5dd2d5e7,0x000334a2922954de,0x0001ad71cb608173,0x00004a7a4f261899}},
+{{0x000718025fb15f95,0x000346b5c1b8ff4a,0x0000e011123df65f,0x0001848cdfcf0850,0x000011b50c4cddd3}, {0x0003b291af372a4b,0x00070718147f224c,0x0006899ef293da82,0x000ee33dd8485648,0x00004a96314223e0}, {0x0008274408a4ffd6,0x0007e9c1576d9a6e,0x000d02b3f2738e17,0x000cc51773348b63,0x00004f4bce4dce6b}},
+{{0x000fce5ae2242584,0x0005692f58a9ea71,0x000cea3cf426ea72,0x00001e6d21a09d71,0x000073fcdd14b71c}, {0x0002616ec49d0b6f,0x0008fcaec231730e,0x00026b4fa6e45671,0x0005f3748eb409bf,0x00003042cee56159}, {0x000e7079449bac41,0x0006dbce2310a427,0x000f841a7c855ae3,0x000e1d64cae76215,0x0000389e740c9a9c}},
+{{0x000cb3ae34dcb9ce,0x00023e348d0ad64f,0x0002c6381b975003,0x000678845b3f07d6,0x000061545379465a}, {0x000d78f6570eac28,0x0003227919ce1c9b,0x00019b91ede55b0b,0x000369065fc3eaba,0x000025c425e5d626}, {0x000e06a6f1d7de6e,0x000278e0623083f3,0x000e8a6c773ef976,0x00047598c14f6264,0x00006539a0891548}},
+{{0x00021f74c3d2f773,0x0004125c46845e9d,0x0009b99e33c15054,0x000186c624e5ce8f,0x000011c5e4aac5cd}, {0x0004dbd414bb4a19,0x0003c98424f8eddc,0x0006ca716919b2bc,0x000bd9048a89fd73,0x00000f65320ef019}, {0x0006d1b1cafde0c6,0x000e3163b5181d48,0x000af2939a4f3fe6,0x000072a59a8af0df,0x00004cabc7bdec33}},
+{{0x0006ae5772632467,0x00031db5b1aa8ca5,0x0006f04a6a395cf6,0x000ba3cb5b978d20,0x000060ec0f45f326}, {0x000be5b0bd9a2774,0x000ac756a171a25d,0x000d1caaa33bc5e1,0x00028aa72263c080,0x00003d540cf73784}, {0x00036034432cb2d5,0x000633e795b9e703,0x000709ceb758eaaa,0x000ea1db03ca3c7c,0x000004f112a59ff9}},
+{{0x0008e5c09877656e,0x0009cf67053bd7d4,0x000b6e5739793e9b,0x0005e9eed1dfac4d,0x000044c457ead57c}, {0x000188812b4e52a6,0x00029ca767724de2,0x000ca4f7eed99489,0x000573f5a54d59e7,0x0000457b66d2ba6d}, {0x0008b66ef6fb1f85,0x00059793b47893ef,0x000f04fd0602f5a3,0x000c4c8ff1cb4b42,0x00001f338f41ec15}},
+{{0x00049cbc5e34d177,0x000c988204d24491,0x000e272c9cc9fc32,0x00056d38f9d90ae9,0x00000ee46185ce4c}, {0x000cfe9f7c8a0fdd,0x000d4feeefa3318a,0x00065ad7c89cdbd0,0x00036b4ba534b9d1,0x00006f55a52c5bec}, {0x000055cf7f9dfaa7,0x000c8b51fc5bab96,0x00078ff54247d13d,0x000fe6cbfca7e0b9,0x0000483bd5b8be7b}},
+{{0x00028b0ba80e9de2,0x000fc95118906eda,0x00017bd33c601005,0x0002523a63c719f4,0x0000632276d896c3}, {0x000e3a73ae2a66b9,0x000dfbcd01682e33,0x000b8f3fb3b06826,0x000d873f8c37a7f4,0x000024d23ef9b4ad}, {0x00071faf5f960d08,0x0006ad874e20521c,0x000d45436f095638,0x000d0ef833f405eb,0x000025a2ba720b19}},
+{{0x0001c2cdbd38e68f,0x0000e5152dbb7a99,0x0006813f303bcc73,0x000512f21242df75,0x00004283f2d87da4}, {0x0001a84c778edc41,0x000184df9c2d95d5,0x00079266cfbce5f0,0x000286fd691d0f1a,0x000043c5aa20b344}, {0x000aa844f478fbfc,0x00079e83c43a07a1,0x00080b4c90092868,0x000ae3bce14277c9,0x00007ecaf2c6cb50}},
+{{0x0008de4450370df2,0x000463f6b944845b,0x000e1c58f056558c,0x000db477dc1703a4,0x0000279ae58a330b}, {0x000d0fa50937798d,0x00049f2f54349806,0x000d75b1da5de480,0x00095d1cad6a2163,0x00003e392e20c7dd}, {0x00072e17657140ec,0x00097df8153460bf,0x0001d8f4be478bd8,0x000991dc1784979e,0x000011cc4af655b1}},
+{{0x0002ce401df9f2de,0x000ae78db6386d55,0x0000c8a3b57bfcb7,0x000bfe9d67086faa,0x000062be7e83b3d1}, {0x000796d035557bc3,0x0005444455267011,0x0001bbae894c7e54,0x0003aca0c8c306ba,0x000067bacb1d6666}, {0x0007d41a15b03851,0x0007c8cd4aeffdc2,0x000a316184550d0b,0x000c11736232ca15,0x00006b2519b3d034}},
+{{0x000aa8fb532f7428,0x000a046a4e27216f,0x000b9ea480dbd42e,0x0003f035337653b8,0x0000406594722397}, {0x0000a19c1a54a044,0x0002477bd9fbbf7c,0x000af229724a1c5e,0x0009e0da6e3ca115,0x00001819bb953f2e}, {0x000fbb795e042e84,0x0009a7698b714498,0x0007fe62957d0dd8,0x00005248bfb0ba42,0x000036ba82e72120}},
+{{0x000c04818934e3f2,0x0004ac68b19cf2f0,0x000b6c1a59ea6a57,0x0007ea0cd8cadc47,0x00006e1e0737ec39}, {0x000c5cd2c2f35bdf,0x000a817b7c2dafa5,0x0005b361c795db4f,0x0000af9dad1dec3a,0x000032a99568e5c5}, {0x000a10c3619f82f4,0x0006f19ee3a55ee4,0x00055e716d48d91e,0x000f6617b4dc2ad1,0x0000322c593c34b9}},
+{{0x00058244b85f0463,0x0005bb71ee020325,0x000de66d5801e248,0x0006484a9bcafeec,0x000044c30aa11da2}, {0x00017fb784176149,0x00078c4aa8b8c3b8,0x0005340152a40b5b,0x0009517b79483e9f,0x00002393ab1f7dc2}, {0x0003bf2722f70bde,0x000132cd3a91197c,0x000da44e6151730c,0x000b5cf6823f78e0,0x00000833b9f7bf1b}},
+{{0x000182aef8f5b952,0x000ddcd2f4aa68c4,0x0002a58778d16895,0x000db00c64a62daa,0x00002b9d9aca36e1}, {0x00089fec640b60ce,0x000c455bf693aee2,0x000590ce20f21732,0x0008d16f6cfea24b,0x00000b60c7c64c0b}, {0x000747f53d53cc1e,0x000221e5ab5290c7,0x0007ad082244e3e2,0x0002cb356ed957b2,0x0000594c90120394}},
+{{0x0005473ef1883b9f,0x0009f49ffd5d19f1,0x000e588f2ddaa9ab,0x000563be314416cb,0x0000007b182c2ceb}, {0x000fc8922f1d829a,0x00079c71d1597c62,0x000eaef5e689cece,0x0003e9e8b08b52ae,0x00004d6111ce8519}, {0x000dede73e9bd5d9,0x000cb0652cf08eb4,0x000de838e5c2652f,0x000789ba26efe8f8,0x000040097eafbc4b}},
+{{0x000f244cb001e650,0x0009e9d170746d64,0x0001c4dd7f3ee5f6,0x0000049e2c012a2d,0x00000c007472f0f6}, {0x00000b4e5f2abcbf,0x000c2ee95ea2d4b9,0x000794ff3eaccb89,0x00029893a68d20dc,0x00005549c2d0f3ef}, {0x000dceb31cf054b1,0x00029e818a171051,0x000cedcd3180cbfe,0x000ae57a17a921be,0x00005ba2c712417d}},
+{{0x000e09ed4bc5ce80,0x0003990d8e1c3279,0x0001290f514b9818,0x000a0a7c12a4dec4,0x00004e62ce273789}, {0x0000e20563658fda,0x0004d2baad8fc11a,0x000f57a9ee1ae1f4,0x0008473563ef8641,0x000067bc6cc7ea15}, {0x0008393a01b69903,0x000ed1fc729449e7,0x000bbe6589e60c1d,0x0001035ac46260e4,0x00006f724d16525f}},
+{{0x000d888461e0abb3,0x000d16f5851bf565,0x000c4704c4d1d9e2,0x000b776275515245,0x00001c635adb4518}, {0x00095133d5e69f6f,0x000945fe7bd43a49,0x000c3a2bb2331291,0x000afe916ca3f317,0x00007fb35352575f}, {0x000ea46b65536328,0x0007c84043938bc7,0x000ca50726046291,0x000f8c117ded3de5,0x00002786432e57af}},
+{{0x000afaafcf4aa586,0x000e2503f46b946e,0x000211feb3f29bb7,0x00047c2ad48b8f7d,0x00002a1bf229c55d}, {0x0000032d45b16986,0x000de1ecc1c6894f,0x0009e2c8a3116854,0x00033a542355abec,0x0000153eec06efa0}, {0x000060a4c077b968,0x000747e4b8e475f8,0x000bd3dfffb3a2ea,0x00079ab816305949,0x000079866201a1f7}},
+{{0x000f15a7e96192b1,0x0008afab6adf8303,0x000c3dceeae58b6c,0x0008a5ea06437b9f,0x00002280463ae7b8}, {0x00082f0e4a217642,0x0007f0b9f2ffc79e,0x0009ea9a22514135,0x000bda9afb80b5c5,0x00003e4df03a93c2}, {0x0007547d7896b4e3,0x000400ec3c8d3131,0x00077b5aab22697e,0x0006eb2a59a700dc,0x000014256d3a4457}},
+{{0x00085d4f2990bf73,0x00029d51064cb9a1,0x000580dad8883366,0x000cefb9806a459e,0x00006f1ff8d60e5a}, {0x000e4763428af62b,0x000d781bbdee47e8,0x0004fe429e44055c,0x000bc069cf68ee63,0x0000316753e7d438}, {0x000258e651bd2e05,0x000cb9b82847addb,0x00067084eb93fb65,0x0006cbed3e653c5e,0x0000355d4fd1daad}},
+{{0x0005ade8d7076cde,0x00041da5bef6947a,0x000a3cbaaf0cb15f,0x0007f869052126cb,0x00003d606ddd47f8}, {0x0009c508f3a7861d,0x0003c0701f7a4c7e,0x000317c05db4ea10,0x000cd7ed60d857a5,0x000039a66dcf9c5e}, {0x00075d8b661f1711,0x0005481071b8ae34,0x000c9d74513a213f,0x000cceb47a3dfeef,0x00003454e7cd9031}},
+{{0x000728238d1ccca1,0x00053cfce641b602,0x0004ce3811fb25f4,0x000227aa71a050a9,0x000036cf971d65c3}, {0x0004c05cf4648112,0x0003a9ef04252d67,0x000a3872838b6faf,0x000445bbdfbb0b85,0x00006a87dac6f24d}, {0x000ed164487687e0,0x00067c0f67cbbfe2,0x000208ee5c44ed91,0x0000412994f11152,0x00002d4ef4d841fe}},
+{{0x000cb72b94cbfdc1,0x000141d2126c47d0,0x000e60a6ea6e92c5,0x000465e3dd53c694,0x00003199c526ae7e}, {0x000cf3b1b0248f55,0x000bfeab900d9a6c,0x000f5fdf7abec154,0x0009cecf87cbced4,0x000072c48da23e25}, {0x000206925ef9706a,0x0009f85fb83ef71a,0x000c64e64dc78731,0x0003d7e09da820e6,0x000006807c9e5576}},
+{{0x00010dd2d3466870,0x0003e57ed1a8903e,0x0003227d3285c04b,0x00009c837844a6a5,0x000025a728794cea}, {0x000f2a8498bcdd73,0x000095c8869203f2,0x00012d285b956a73,0x0000e46592af8f0a,0x0000440b42be32c1}, {0x00097b213225d369,0x000648c322378ba3,0x0006785ceca52eae,0x00045d08702fbd07,0x000010f5894bc036}},
+{{0x0006681fa66e6738,0x0005c5714e972319,0x000af131ad976281,0x000fd73bf20fadc2,0x00001ea1ee6e5f6c}, {0x00012d704d6eea9f,0x000dc6a4233a2658,0x0007a94bd0ab3749,0x0003d979eddfcfae,0x00001fd3ff1f27cf}, {0x00001aaf795600db,0x00024b99af102f13,0x000677e921ef331f,0x000b2abcdf85aec9,0x00000dcd6282f0a0}},
+{{0x000ecbb74245ec41,0x0009e34348716d60,0x00042284defd9be8,0x0001db4c9240afee,0x00004472f648d053}, {0x00069d0a57274ed5,0x0003260804b17c8d,0x000255dfac45ba80,0x000b339df3cda102,0x000077d221232709}, {0x000a6d7064ad94d8,0x000fd9af62263498,0x0005c141f4a5b5c8,0x000358c8ca8ed054,0x00002c63bec3662d}},
+{{0x000e5e93f433b724,0x000b8230891daa91,0x000d4f080e12d308,0x0008a5c3522c2df6,0x00003a7eafde2f4f}, {0x000db301ab46e6dd,0x00060c7766c732b8,0x000cbdf2908bac9e,0x0003706b11af4c8b,0x0000522335bb44ff}, {0x000fd19b08035433,0x00076fa567a118f2,0x0008cb4fc51311b2,0x000aaad34f752f11,0x000027d61b3f6b69}},
+{{0x000280d5f0ebfe9a,0x000a0c2ea08898dc,0x0008eff6c61c88c7,0x000e8c05acf3b808,0x000019f322d3bab0}, {0x00028c9a6092c416,0x00012a54b94bd964,0x0002f7f6b3c30802,0x000e85f2ad7bb04a,0x00005572e7fd7160}, {0x000eea4bd0380204,0x00065b1de9585dcb,0x000bce2ce4fdee2e,0x0007d06e0aeb4eba,0x000022bff6e3862b}},
+{{0x0004a460b0cf2482,0x0001c80ee6dcb783,0x0009803024d89063,0x0000c5721cecfe0b,0x00004f8edfc164c4}, {0x000374ad72eb0a3e,0x0001fadaffad4e19,0x000ad67ff643981e,0x00020b1ded3dbbcf,0x00000822102a09e2}, {0x0002de931c8b9bd8,0x000ee94cb96c23ae,0x000d1826840a4c9e,0x00052154f13a5cb9,0x00003cdb728bd296}},
+{{0x0009489e3f306ad6,0x0000549d93428278,0x0008cc68315394db,0x00075b06bf679d4e,0x00004acc67c5133e}, {0x0005b1a5c76779d9,0x000be9e74d352493,0x0008da39c1bf4c1b,0x000c80358171f225,0x00004c0ba1bad1aa}, {0x00057821c83b187c,0x00022744da8d5d87,0x0008f4f9f2188d88,0x000278c8ac0469b9,0x000001a74df35e8a}},
+{{0x000bf51d6099eba2,0x000dcadeaa921ec4,0x000be5b76684bbc3,0x00030f1438c7ea1a,0x00001bd2ebca376d}, {0x000e9b5e7aaf2bfb,0x00002ef334855e57,0x000d16c6ea182a9d,0x0009f52e39fe85db,0x000071df528a80a8}, {0x0003e0728fff532d,0x00060a1501dec314,0x000bf627b9629edd,0x000b8b61f524b130,0x00006100a98c42ec}},
+{{0x000eb7cd7a391855,0x000ade9e1fb12ae5,0x000e4c2342ce5295,0x000ddae94bd42edd,0x0000695ba97b294b}, {0x0008c36cbebfa81b,0x000b49f3bf05f0e1,0x00049b5374759037,0x0000ab44a131a322,0x000033320da0b581}, {0x00040f44f53e3103,0x000bfddb65934729,0x000be4c5d69c4a99,0x000e327c10b19a59,0x00005a6227c332a7}},
+{{0x0001737319724ee2,0x000f2f9ca56f3dab,0x000a73835bb9a062,0x000b55a1229da833,0x000025f57ba1e0c3}, {0x0007509aeb5702f6,0x0009b79dc0e816c7,0x000b8106c3b4fc21,0x0005839c1d8691ed,0x0000694d365f7206}, {0x000154872d976551,0x000eb00190f5b5ca,0x00043d2b00497ef8,0x0001ae386587ca15,0x000036b1cfca021b}},
+{{0x00059546c76c79e7,0x0004b10d656c8ed9,0x00006ad4286ccc38,0x000b8c901dd78d1e,0x000032ac73cba643}, {0x0002b759ecd0b60f,0x00081cb5bfe7bc92,0x00077e1ca56a25f6,0x00076605cc659bb8,0x00005471455e00c8}, {0x000deda8aba0f13a,0x000dd046d71bd66c,0x0003e095e2efa6a0,0x000ec9b81900cf31,0x000072742767a857}},
+{{0x000fa859148968ae,0x000ec41d42e2b176,0x0001f6322ad952e5,0x0003e6a96f0cc8ff,0x000011caa916259d}, {0x0001dfd1a8e2ed90,0x000afcd13668ca13,0x000dd3810be5579b,0x000ba08afa0e187b,0x00002f7a5e2cf31f}, {0x000750efa2fed688,0x000792e80274b619,0x0004f33023fae85c,0x000c790830879f93,0x000018728ba827a9}},
+{{0x0007ae455f685c23,0x0002e654075bece0,0x000f3f6194a74a87,0x000c3ca9c00319bb,0x000070766c54b12f}, {0x000fe72a1aa25628,0x00016cefa31e4fa6,0x000272ec3efdea42,0x000ff57286f810b0,0x00003059738f277b}, {0x000059c16fc9e14b,0x000f880ad034cd9c,0x00047c6164e7866f,0x000e278a4344564d,0x0000265771b985e4}},
+{{0x0007c0ba3485b1af,0x000c2cb6dc6148f9,0x00001353232ba3e9,0x000f1e82e632eea1,0x000079991dd5a542}, {0x000b1f7d6a8ca4dd,0x000b3c824aa55ff3,0x000009882d920cda,0x000157687d377d6d,0x000058e6fb22564d}, {0x000fc866d47ea4be,0x00035aae1c45da4a,0x00026d2f64761bb8,0x0003d839499c470d,0x00006ef2dcfc7efa}},
+{{0x00086d4147b7a953,0x000633f698997fd4,0x000ff4ef5ed81986,0x000e721c2675359e,0x00004c29beef2a6e}, {0x0005b1f439d3541e,0x000d0a154cc7cba7,0x000e621f7a6614e0,0x0006b542922a4bea,0x00000c91a447c035}, {0x0009784d915c2f3b,0x000763531891117a,0x00062ad1d350d311,0x000bb03770ddcf30,0x00004f3ae995d438}},
+{{0x0008b60e10c9c78f,0x000b2c80002cd8c8,0x000a7cc21b8aa0ac,0x000445911cf1fe14,0x00001bfb23cdf6d6}, {0x00096f08fe99c36f,0x00088d99218a7ec6,0x0001c94669b79413,0x000e431a9caf1549,0x0000477c03c9c49e}, {0x00062a0e033681f5,0x0000b47f8b7e99c1,0x0001c6c98a301dc2,0x000a6fc6da221104,0x000052663edadb71}},
+{{0x000fdad41782139f,0x00047def9a6ba758,0x00023c7b5661e521,0x00015b8c57be7afa,0x00007f6642bd8b23}, {0x00067f356a7a5170,0x0003f49fdfadddc6,0x000a1c7b4801dd8e,0x000a5d1567009fd2,0x00000c9fa50329c1}, {0x0007cfaaabfb6fd6,0x0001c6020d6c8901,0x000e50e5783d040c,0x000d7ea64f194fa9,0x0000548f249911e0}},
+{{0x000c8317bd0ef28a,0x0005f59e75069c42,0x000660fd25f1ffb4,0x00069b560d1f474d,0x00002c38fa727386}, {0x00035f2d1a43eca6,0x000b86a1bc556966,0x00069c7588519c43,0x0009c1abc15a0bfa,0x000051133fb0eeae}, {0x000755cd9248c715,0x000645965a52a5a0,0x0003621cbb7b24f4,0x000aebd2a0d90477,0x00007c230dce2e3d}},
+{{0x00060d8bea787955,0x0007eb5f401b77fe,0x0009355cceb9dc11,0x000bedf91c7c09a1,0x000022692ef59442}, {0x00018b3a8586f8bf,0x000f6cbb196f09a5,0x0002385cf29ee71a,0x000c8d1aa0625e6a,0x00001deb2176ddd7}, {0x0003d19a2066cf6c,0x0008c4dcc7cd7856,0x000d0d8f62401bfd,0x000b05ed976a6bec,0x000067cfd773a278}},
+{{0x00055f142eeff3cc,0x000ccb6c54d3bb2a,0x000db7eb896bca42,0x000dad615f331e97,0x00005c6f55453b5a}, {0x000a2dcd9b94323e,0x0007f5b9288cef39,0x00079f01e8072ca7,0x000f26a67f164806,0x00007b7e48443240}, {0x0004a0fc8d0f57ed,0x00097f49e895bf44,0x000a0c26a78a5ade,0x000cc07b51b1ea57,0x00003bde12dec8ea}},
+{{0x00020549ac7c693d,0x0009b7703786ef9e,0x00020c7467953c63,0x0000d1c9dc5051b5,0x00001571370a9088}, {0x000970ca32e94784,0x0009a3533926ce6e,0x0006be97e58adbea,0x000589e8d356e985,0x0000351369291d93}, {0x0009935b78cc0974,0x000d5baf00f370f3,0x000adcfce16468be,0x000e5065b6f4c724,0x0000615a48305f7b}},
+{{0x000cf07300739c23,0x000539ff981b93e3,0x000480f46a965346,0x000865203b699ffe,0x00007a1202500d56}, {0x0009ce2142203a34,0x000ef45a21edcc54,0x00012459c8767673,0x0008268e7a9e515d,0x00005c7a8b4a0676}, {0x0006895e608f135e,0x00025e9f98574320,0x00060b517071cd91,0x0003d2bf4dec25e5,0x000023063189cebf}},
+{{0x000e6f2321a461e7,0x00073c28822856ca,0x0003371ca354c466,0x000a456c6fd542dd,0x00000a08321f92fe}, {0x000cbb23eb70a08a,0x000269ad2da05576,0x000ea676c4a116b7,0x0001b2041179df92,0x00004a943ce58d6e}, {0x000facf16047dff7,0x000dc385f2ead0b6,0x0007b068408febc3,0x000584e2184388c0,0x00004b9c747f36b9}},
+{{0x000844013b2c190c,0x0001010b3435a327,0x0006a5fbc399c3fa,0x0002b0aac38cf105,0x000048fda0c63287}, {0x0000b1580cb1579c,0x0009a2734d1aa151,0x000cb3d6d24f9745,0x00014673812f27fe,0x000030ceea637973}, {0x000c297f7a9395f2,0x000a2d735c8de0de,0x000a9e1b3909ff88,0x0005352d8b1e2cf6,0x000045b8fd10bcb9}},
+{{0x000e3c16f164963f,0x0007c11bba4aeddf,0x000520d321f4a1cd,0x0008412d8720da00,0x0000630254b00a8a}, {0x0009f35e48f06cea,0x0003c27e017a2aef,0x000381c599fd6026,0x0001720b8b8cd115,0x000062260752a08c}, {0x000d5ecbcd4eb25b,0x00023ded4b965ca9,0x000024d18417f7dd,0x0002246f0afc411d,0x00005c92ab0ac7ae}},
+{{0x000a10329cfc4fad,0x0007dc70b3d3b809,0x000fd9599439ac64,0x000d84b38fecb34f,0x000069a4be2923d6}, {0x0007589d64daca71,0x000b9ee62a31b494,0x00046d97aaaa886d,0x0008fda9d0832170,0x00001c2df8693b8d}, {0x000ffe8792adfcff,0x0003d1be20b4acdf,0x000052dba19863c7,0x000486ab89fcaf6b,0x0000242113e3b08e}},
+{{0x00083e109af87bfb,0x000aafe058de90cb,0x000168624fbd22db,0x000fe50377ca9ded,0x00005513994ff0d7}, {0x000739ba856a60e5,0x000fe22676dd6647,0x000d5314c8efbf2c,0x000144316fbe35af,0x0000625287e0c247}, {0x000152c1ff15b542,0x000bf229715b9405,0x000ce731775a2530,0x000b59a63f28509f,0x000043f062895f21}},
+{{0x0006c044b2870b62,0x000fdab6a55a0213,0x000ef97f6ce77f8f,0x000adb1de8ad5fa5,0x0000384c4241dd40}, {0x00090f2860275ea6,0x0008eb0faf095a22,0x0002f352e5f63383,0x000b17d4b55f68fa,0x00003f137bf054ac}, {0x0003a319d84071d1,0x0007e5ff78ce33f0,0x000f7a49058ae489,0x0004f3d10f86e30c,0x00001b34c68d64b8}},
+{{0x00009278c8363e59,0x0005081c6577504d,0x000692dcaa371152,0x0008ba8a9e79fd74,0x0000135d02a9bf34}, {0x000280fefce2ee55,0x0006034d22536725,0x000468eb5d9b95eb,0x000f2f921181fb8b,0x00002ac5f66693f4}, {0x00099c4ef281b71f,0x000a3955053c4e4a,0x00039bf3041e27f4,0x000558cade313404,0x000015418cf89947}},
+{{0x0003277a94ea29a5,0x0000c85a45d5065f,0x000af16b40848f5b,0x000f8518e0292f6d,0x000041b9b2cf2531}, {0x000471f814858d0e,0x000e521535943b5c,0x000d085ba1b8afb5,0x000ac2ec66512419,0x00004a4dc752c3b7}, {0x000f7de239c26fb3,0x000aeaaf2d1e1e81,0x000a8c36ca0f18f5,0x0006d382c6e7f440,0x0000744d565046b1}},
+{{0x000fb2987a41e30f,0x0003fc976177ef35,0x000c4944e7192281,0x000abd47c6c3e77c,0x00002615a6d9c37b}, {0x0006901cbdf44cdb,0x000cdf901ca873ee,0x000915ae6924374d,0x0000606997641b13,0x00000bb22196fef9}, {0x0009955211d3ac6e,0x0005bacee443254e,0x00002a865a84972e,0x0001ef8537e3c143,0x000028ae3d20ba5f}},
+{{0x000fd743e2d6d53a,0x000ee3fb2e3ea6c3,0x00031ccff7cf40ec,0x000ed19a3af35514,0x00005a4dba85f07a}, {0x0000f567fecaa09b,0x0009f9f7ef953400,0x00025e5da24cde38,0x00043b08ed7a8773,0x00004627d2b5c08c}, {0x000aa373bcc36d78,0x000a00655f95fb89,0x0005d1c1affb83d8,0x00075fb5f00276d0,0x00003258e4e05d3e}},
+{{0x0007f1a6a998fc12,0x000ac20c459beae8,0x0007d8efad25d53a,0x00034e10f17ac580,0x000006a29f4a3004}, {0x0009d36a1a82adc2,0x00075f7b0e4feb75,0x00072959ce129d5c,0x00004853f93e2564,0x000008ec9bf177f4}, {0x00024cc1a2d708ea,0x000e25d064995d44,0x0006616dfae4fc87,0x000654454de40251,0x000003f21f45fa54}},
+{{0x000f5abb77a4224b,0x0004758d89802da9,0x0007de18eb411cd4,0x000f4e25afea81a7,0x000050e88e7e5ba8}, {0x000aa3190d1ede06,0x000773f367d7c54a,0x000f718045b980c9,0x00000f5df3203484,0x00007dbd2a115420}, {0x00072fa762e88ed6,0x000b30b636162a7b,0x0002d015f8167ef9,0x000fad234a2abdaa,0x000021a2747bcfcc}},
+{{0x000c31faef3ee475,0x0008a9e22fd928de,0x000e26cab199dbff,0x00010b9512d11594,0x00000cde561eec43}, {0x000fa9855a4e586a,0x000a449beab7e2d5,0x00021d33d365f8f7,0x0009deeaa074dddf,0x0000185cba721bcb}, {0x00069da3f4e3cb41,0x000f540f7977e938,0x0000463b83bf0392,0x0006eed026204fcd,0x00003ec91a769eec}},
+},
+{ /* slot=9 [{1,2,3,..,64} * 128^(2*9)] * G) */
+{{0x000fd60613037524,0x000f6b0fbc26a535,0x0003e990aee210ad,0x000dbf9ac8d0a9b2,0x000047204d08d72f}, {0x00042eb30d4b497f,0x00006b9bccc87072,0x0008116f451ef963,0x0005b0437950934d,0x000005468d620140}, {0x000565a9f93267de,0x0008dc0d58e8a00f,0x000318e28ececfd7,0x0003352a215e2dcf,0x00004599ee919b63}},
+{{0x000072e95c8c2ace,0x00096651e9c4ba2b,0x0002e7b42b69cffc,0x000deb344328ef84,0x00005dd996c122aa}, {0x00023c425ef83207,0x000d3c9a934b5b4f,0x0009fd87f7abf894,0x0006130d0708c133,0x0000187678911716}, {0x000b5ef0670c507c,0x00042b93c33bf925,0x0000dd003f819bc8,0x000dc7410792e9a7,0x000059ad4b7a6e28}},
+{{0x0003e91d6a54c980,0x00025f510d98fa41,0x000a0f6246554a77,0x00025bf6ac286ac5,0x0000105ba38985c8}, {0x000f016a267dad09,0x000c9a2b7d363348,0x000e0722132f58d6,0x000a6509775ba594,0x0000759d087ff9e6}, {0x000b80dd9d8a5ddb,0x00059905824c7bfa,0x0002ab64b816ef62,0x000ebfb63fe716a3,0x00005461548ae00a}},
+{{0x000a7562eb3dbe47,0x000548ebda0b85f3,0x0005747299f7ea38,0x000d55100c3e5314,0x00001304e9e71627}, {0x000b04bfacad8ea2,0x000e8148be884583,0x000810c5db29b743,0x000bbaa2b1e583b0,0x00002b5449e58eb3}, {0x000814d26adc9cfe,0x0003f8b48dd0b789,0x000979c60a3c1bab,0x000d693da0fe1fff,0x00004468de2d7c2d}},
+{{0x000e9de9527493ab,0x000d1c21ff4f4d36,0x000730750cde3352,0x0001f7cc7b4ad917,0x000010bef1d8a696}, {0x00087f5d47d18c38,0x000bbd8e3da47877,0x000d52054353546a,0x00050e2a8c660982,0x0000476fc511210d}, {0x0008d28d62a1b8c1,0x000fa6b1f969260e,0x000282b49e92359a,0x000dc7eec7713680,0x00005e9c111f1bbd}},
+{{0x000a4f857eb38ec0,0x0006999006db8daa,0x000fee148cc8efb5,0x0008b84b703ea491,0x0000769a8d04973b}, {0x00068cca99f0ae2d,0x000ce5e861a1fc0b,0x00018ecb64ed3e34,0x00016436944cb457,0x000051905f83ab93}, {0x0005c098a7bbcbae,0x000104c8ba9e035a,0x000d311f48a94da8,0x00011cd6132607fa,0x000032d74dae2f79}},
+{{0x000b17abc651ecc4,0x00062dadcd52b952,0x000f22203ece3ffc,0x00084418d70f0636,0x0000212ff1fa0449}, {0x00090b75a08d0c28,0x000128f5df84528e,0x000224b74beba046,0x00098b735992f09a,0x0000489ad71d1851}, {0x000995799f52209f,0x0005679f25d9f063,0x000d06f1e33ca2a8,0x000b64e85940d15b,0x000057df53c1085a}},
+{{0x000b355e9419469e,0x0004c23ddc75451b,0x00047f996233e6dc,0x000bd6393a5b6d64,0x00006cce7c6ffb44}, {0x000ad8c6f86307ce,0x00031435d0c284b9,0x00057a772c211135,0x0007352d4a866c56,0x00005da6427e6324}, {0x0004c688deac22ca,0x000f7bbae1ff81a9,0x000d59580fb9066e,0x0002ca888ad8c388,0x000058f29abfe79f}},
+{{0x000afb343143df91,0x00017155d89c373a,0x000a647255e5859f,0x000bfe574fc88694,0x0000526642f7b8b9}, {0x00076f0a4835ea15,0x00058e4f9270afa7,0x000378e53347d27a,0x00082dc79fd9cb6e,0x00003cf0ec6da741}, {0x0004c6ea23d63436,0x000151817387da5f,0x000f4f1074618f91,0x000107f025249149,0x00004e9b5b1c1b00}},
+{{0x000f2862d0b62b4c,0x000b4cea108874cf,0x00074f7420b39fc5,0x0000fc5cecfd0aa4,0x00007b0c886a4283}, {0x00048de53541d5c1,0x000fa076646d602b,0x0008805932c9a046,0x00063e3d466924d2,0x000073db3902663d}, {0x0005e94ea7c2d51b,0x00083968a040e51d,0x0001f9937b80b914,0x000929d5b4b2cf6b,0x00001b37fa9bcd5d}},
+{{0x00027aca52792fdc,0x00033bb457f0a082,0x00078f44b970f8f7,0x000fd26ac21d7fe5,0x000077781e77abe0}, {0x0003072292c284bf,0x000bc5dc020475fc,0x0001f47787fa2300,0x000778ba5935f972,0x000055162f70acd5}, {0x0006e29b5d6c8a2e,0x0003a5ac9305cde9,0x000ad8e7859b0737,0x000a61895a48e016,0x00000c15656b2383}},
+{{0x000ecfab8de73e68,0x0009f377e76a5e90,0x000e01598254036f,0x0001e36f0495b0bb,0x0000577629c4a7f4}, {0x000a64bf710ecdf6,0x00038462c293c4b5,0x00050b3ab9b14ce5,0x00048703643d056d,0x00006af93724185b}, {0x0000024509c6a888,0x000134b558973322,0x000c33289fd2e036,0x000c18f83e236233,0x0000701f25bb0cae}},
+{{0x00098f2ede49bb66,0x000c5103d8f09e53,0x00079c466c6d2eba,0x000237daa7b2e8c2,0x00005612e6ff2d20}, {0x0009adb8c2ab09b0,0x000b6baabba96ada,0x0005e13d52301866,0x000aa902eb195bf5,0x00005a5a0fa21d62}, {0x0007be5c45379ca1,0x000fd233e282d1d9,0x000c561d97a9e1aa,0x0000277014034679,0x000016c56fb9e6b6}},
+{{0x00031593ce5e02aa,0x00064763d3b806cf,0x000614980c9b8785,0x000bed902e486c27,0x000076500bf2ea40}, {0x00018b7e226e4ce7,0x000a526f9207959b,0x00029b8e7dcb2b51,0x00063b0849728919,0x0000595261ab309c}, {0x0008c39881dada7c,0x0007a0b286050e90,0x00016209cf77e211,0x0006ff04dfb81d94,0x000051c0a83ae1f2}},
+{{0x000961e9086365cd,0x000cc1583e7826f5,0x000bdf0e9e899aa8,0x0000f6067133c948,0x0000241d6697a0c1}, {0x00027e63f3be17be,0x000bf7a5f9dc45f6,0x000d5e9fc9422c51,0x000639223baca002,0x000060f451fcab5b}, {0x00094cf1a7efff7b,0x000814d8d4b44f61,0x0003eca363b98cd6,0x000201330d10fb22,0x00004bd0b8881a48}},
+{{0x0008b0f8e4616ced,0x0000e9e25a87dc3a,0x0004bca59cf70066,0x0000be961e3061ff,0x00002e0c92bfbdc4}, {0x0008f6d97cbec113,0x000e674bfdbe49d1,0x000c4e60d6844a06,0x0005e5120f5b522a,0x0000720a5bc05095}, {0x000f09439b805a35,0x000376242abfc0c3,0x000c229346e84e8b,0x000f0ec691417f35,0x00000e9b9cbb144e}},
+{{0x0006dfa4449a9164,0x00008fa8609505ee,0x000b0eeae1cf9779,0x0007cb022b5056b7,0x0000382c794f610b}, {0x000693039b778df1,0x000d6ca5eb2d7a29,0x000ac26c15428af1,0x000cf5bc5361cccf,0x00001d6b2f9986fd}, {0x000e6dfbf2263b59,0x0007ad741ff0ed09,0x000bd8c8e2cf1d46,0x0007e133141bb90a,0x00002a8dbf093198}},
+{{0x0003539f2bdfedf9,0x0002a290ee4e7d61,0x00058b9e33f12b66,0x00065fc498e60fa2,0x00003d9e22f6eb42}, {0x000496b42e9a2faa,0x0002f82de50606f5,0x000b63db70833cb6,0x00030e1292e21f77,0x00007fad8b9e7548}, {0x0005dd456d641fd3,0x000d1112a11cec43,0x000560a2bc0e71d9,0x00032a5dcb7401d3,0x000047bb8af38a26}},
+{{0x000bd68616f7433c,0x000d0662a613c136,0x000934a4b21f06c3,0x0002ccd313a9e470,0x00004f9e0c986450}, {0x000fa5498bea9a69,0x000fcfa1cba0722a,0x0000282bea1e2645,0x0000fccd4a1795b2,0x00005923d05ff17c}, {0x000444d2573f0ee9,0x000aabd07309b319,0x0005d9c3e033206f,0x00037bd4aa028acd,0x00004eaf009ad261}},
+{{0x000ad48ffb5720ad,0x0006bdbf90d0efbb,0x00035543bfee8191,0x0007bd8d48131526,0x0000221104eb3f33}, {0x000e9bd55db1beee,0x000370a723fb98de,0x000c68d791c9c3ab,0x0003cde44a8f1bf1,0x0000366d44191cfd}, {0x000c1743f2bc8c14,0x000fcb5856c3b9e3,0x0008a7fb972eda26,0x0003244ccb82f0e6,0x00004167a4e6bc59}},
+{{0x000701b2085f0eef,0x000c263ffb36ba6b,0x000c5626026f615e,0x0006397b729253c3,0x0000626a05d50d4e}, {0x000fca37420e18c0,0x0006824cda0f0f2d,0x0008d2ed1a8355b7,0x0005e46c2312dfa9,0x00005b43e6275b9f}, {0x000a3e730e6fc24f,0x00064011fa43f056,0x00036c28de52ab57,0x000b1d37ca875abd,0x000071288f1b8759}},
+{{0x0006e3c97e269127,0x0002ed87811d93a0,0x0006482759c0f1c1,0x0005e887949ccaa1,0x00003d6adfd2f813}, {0x0005b2fe46064846,0x0000891ecb79a762,0x00071f3fe1cf987d,0x000adfe55d1d3980,0x0000551bb42c24c1}, {0x000420ea00bcec72,0x00063a87530dee54,0x0006fdb73444627e,0x0002c968bad717b7,0x000039c0e86c5a8d}},
+{{0x00003a2c0d3e47b0,0x000c85ccfc0969e3,0x000a51378d0105b8,0x000bb8eee4654212,0x00006ec17664ba6b}, {0x000ba5eb9692e387,0x000ecc98905b3160,0x000558c20edf2c5f,0x000ea66d623ab04d,0x00002c9254222b62}, {0x000607207d1bef26,0x0008b0a791fad1ed,0x000b96bf954ee424,0x000dbe539eef6894,0x0000712b8e3986ac}},
+{{0x000b9d2876f62700,0x000400e7668eb643,0x0001fc06845d1d9d,0x000246a1b4b43032,0x00007938bb7e2255}, {0x000e2665f8ce8fee,0x00014e880d62cc2b,0x000f364eeee967ff,0x000d2f6f12e6e7e2,0x000034b33370cb7e}, {0x000591ee8681d6cc,0x0009ced85a753cdc,0x0008808883ce0210,0x00065e4ed7485c15,0x00001176fc6e2dfe}},
+{{0x000d2b3cd8a711fc,0x000165e0af1ca1a0,0x000740af42fb951e,0x000f112ac6a55a86,0x0000356dd9e4ae62}, {0x000b2db0ca1b92db,0x0004b2e7e961b4ca,0x0008a5f9f2df2329,0x000275e94cdb1365,0x00006348575c2567}, {0x000241c2ef612f4f,0x000951e0c72f28a7,0x00036e4ea402dc8f,0x00045fd01c5bf14b,0x00007124b72e418a}},
+{{0x000e45136a384887,0x0003fed36b4df5d5,0x000103018ab8829a,0x000a78d59b4ea358,0x0000371e512f7f99}, {0x000048a7e4ec4e3e,0x000f3fd11c29d9cd,0x0007b68c1cddcde2,0x00019a4665642dbf,0x00000d4b54f4e5a0}, {0x000b5a48635fe21a,0x000fef518378dc48,0x000639b1471f0b4d,0x0006d70632096b6e,0x00007e720d143b77}},
+{{0x000217e9928db2f7,0x0000e81337f83932,0x0008e356b757c5fa,0x0004202d8c9b6756,0x00004a5b586a1ddc}, {0x000712f87fd2ccf4,0x000b2f9f5f5476eb,0x00051a2ca73e4804,0x000038710ef4b8cc,0x000074a03e7701f3}, {0x000b3aa637f2d184,0x0000392599949421,0x0007b341695b3cce,0x000cd7368496fca1,0x0000607dc2e9a157}},
+{{0x000f6cd05b9c619b,0x000f4b2a58480b4a,0x000be94dc42ddfc9,0x0005f343d4fa502e,0x000008fc3a4c677d}, {0x0000e28949770eb8,0x0002aacf440a3db9,0x000ed7879b98fbcc,0x00006b621354ffed,0x00001f6a3e54f269}, {0x0004c199d30734ea,0x000b631165cd660a,0x000759829540c085,0x00000d1e2333e23f,0x00004f2fad0116b9}},
+{{0x000e3d77d0c4ee14,0x000e3c1c9c4451b8,0x00052c49a115eae2,0x000746d703795d27,0x00000564a1c113a9}, {0x000e59e007d81be4,0x0009dcb5977f0a10,0x000ed34ee69cc352,0x0004c371af06a222,0x000066f057533615}, {0x000b88dcf109d53e,0x0000aad6a556d430,0x000bf2f2bf2574fb,0x000f6cdb12b25e2f,0x000011585acec385}},
+{{0x00046767ccbc706f,0x000c96ce0762d5b7,0x0005be6c7e47830b,0x000f5b7fef165aef,0x00003dd97e982271}, {0x00079fe9272e0265,0x0005bea388937252,0x0005f8c52b36bce1,0x0002baa2e5505636,0x00006d058356afec}, {0x000e9eba9f4f798e,0x0006be786df321ae,0x000ac36fd1a7a89a,0x000611c49be74563,0x00005b79fe0a9df3}},
+{{0x0001f19f78c044db,0x000db40355363c0a,0x00016aad1406a0f4,0x0004fef1d40fdba5,0x00000e19c01cc155}, {0x0002d01e6cef9d4e,0x00027c48c030aa4a,0x000b05bd5bfdcfd9,0x000b5800fa4f2b2c,0x0000333c2319a1cd}, {0x000235ae2f695126,0x000df5ec33455be7,0x0007fa00e48e0d17,0x0000f2cdc7e390f8,0x00006ed7c6cd428b}},
+{{0x000eb24194ae4e54,0x000511857ef6c44b,0x00068d04985f541c,0x000f7aba61e6b2d3,0x0000445484a4972e}, {0x000cd91db73bb638,0x000aafc129c08962,0x0003b61689e60577,0x000ee816f619b39f,0x00003451995f2944}, {0x0002fcd09fea7d7c,0x00094b0935cf6915,0x0007285c404a816c,0x00093b7258e9aaa4,0x000010b89ca60428}},
+{{0x0007caaf2802991b,0x000d939a86540f96,0x000d2dd79ee97dc2,0x0002abdba3dd2688,0x000027677fa3055f}, {0x00035f61f09b366e,0x000f4d087d539b50,0x000f2b11f1030a25,0x0001db33c3942de1,0x00005a5c9bca68cd}, {0x0005ad9a8b9ad766,0x00073f6318d7ca90,0x000b6492a2a09ec6,0x0009650fb8550583,0x000057e763e2e93a}},
+{{0x000fc1c99da04ff8,0x000b6eedf2ec75ea,0x000dfbf9be02c82c,0x000282d289b85a1a,0x0000308f1175fd1e}, {0x00091e5bce4a3384,0x0006c04b783d9090,0x0006b885baf044f6,0x000d191db8a261bf,0x000030ca45192238}, {0x00099d56900dbded,0x00015128fd5a3097,0x0002da1e03e39bdc,0x0008df2c3aa48b3e,0x00004b9d5d2eb45b}},
+{{0x000e440add4bc8ab,0x00015c84f0392a27,0x0002d715148406a7,0x000f79396229ed99,0x000043dc66163e30}, {0x000b9f6d612eb4d0,0x000e07327a66d031,0x000ffade560f8e2f,0x000588cfda7c99bb,0x000016b1400b9d9c}, {0x000dcf10e4020b7c,0x000bd6f2fdca7086,0x000d45b0bca38ac7,0x0006393b1fb91d02,0x00005968804e0893}},
+{{0x000bc5db45dc2c78,0x00042806e07a3afc,0x00011d105e2d66ab,0x0000a002a520c994,0x00003fd86de2aebd}, {0x00027ef70e37c8cb,0x00011b971fa7947c,0x00070bd336c972aa,0x000b07367da92c78,0x00003bc6a10aa583}, {0x00043d82f773aecb,0x000661fa8c695023,0x0001a65a0ccc30c4,0x000342c5bce16df2,0x00005326ccb69408}},
+{{0x000e3cbf6e40f5a6,0x000b9e540593845b,0x000ef880e83c839d,0x000632c7f4459827,0x00000b936019169e}, {0x000c9d308ef60c17,0x000596f4afc1a6d0,0x000a662c2c8a45ce,0x000affb0c03f4b7b,0x00007258c5e68b5b}, {0x0009531cf5138d59,0x0007083e1f94b899,0x00069bf502a3e2ee,0x0002cbeb992c1953,0x000055c1d4a3351f}},
+{{0x00041e4b4d7bd6e9,0x000b5c6c1fe91d13,0x0008b11040104ff2,0x000db122031ab41e,0x00002822c3a21292}, {0x00018407da32c72c,0x000ddc22c26ae6ce,0x00051b07eacf36f4,0x000263f7e7a88e42,0x00004261ecbc2d51}, {0x0005ca44ffbc6046,0x000cdfd1388afed3,0x000e7519dbf76ebc,0x0002f16a3b578e9f,0x00007b73924bf8df}},
+{{0x0009f0d8da83fe1b,0x000567f2006d68dd,0x00044423390299d7,0x000fb84f64d4181a,0x000053b5625b6820}, {0x000d54db2e2d20fa,0x00096ff6f61bd573,0x000aedb2bfa6b7c0,0x000441c602227227,0x00000d6a94758392}, {0x000ce930171834f7,0x000b03db454a7560,0x000b7382a02ab602,0x00043af1e8c645b8,0x00006044faf707b7}},
+{{0x0001e121611d91d4,0x0009dee2bc3030ec,0x000e1ecb334d5565,0x000021fca6dc566d,0x000008ff965e7154}, {0x00037cdbf04bff34,0x000bf58df5af3583,0x00030fc4ddceeefa,0x000ddefa5d6ad9ac,0x00001af07b3608cf}, {0x00089032b49c7257,0x000735a94007b754,0x0009ad680927f181,0x00048c59b2c22e26,0x00002af93f3c0e56}},
+{{0x0008904c4750a99d,0x000682f33b948553,0x0008ce17d21b80a8,0x0000f3a4404b0416,0x000042659d40d327}, {0x0000baf461600752,0x0000e368ed175675,0x0002e0ac3cc47435,0x000a52d6cde203d3,0x000016ce2a475bd5}, {0x000569521c20fa07,0x000d3f6740d1c2ee,0x000e928aa786ee8b,0x000de4386f850c3c,0x000055066e8d2d80}},
+{{0x000bd4f596a0d319,0x0003b41ea8d9335c,0x0006212bc287d65e,0x000974676c0f7d91,0x00000005b2048eb9}, {0x000cc35c993d233a,0x0006ff6a6cb11a11,0x000f4af5c44a0e73,0x000b562737c252e2,0x000022238460f064}, {0x0005ee4b04f26ef3,0x000efa98ba0d6289,0x000ae8e8b747715d,0x000aa7818a9a4466,0x00003f7c7d664352}},
+{{0x0003323e7b9c269d,0x0006212b9a6a742f,0x0001b2faa785b7f3,0x0005cd9bea2a0a24,0x0000518b5023bf33}, {0x00013889e8cab503,0x000002fe27519f07,0x000febfbbc99c825,0x00030b6e36cac2e1,0x000047c62feef0e2}, {0x000d38b15b00d1bc,0x000f7fca8c71f51f,0x000b24eaa84add1e,0x0007ff9a0edfd046,0x000060683c3e63bd}},
+{{0x00021df92dcc5416,0x00027e13e83da9f5,0x00021d62c4bb1ad7,0x000a8fd5b146093d,0x0000336d296b4cdc}, {0x0007f192a0d2da41,0x000746ed81d6ec22,0x0001c7b08df65a5d,0x000e339b0d4e4ecc,0x00004d4ec054daef}, {0x0006fc516536cb46,0x0002358d0fb2cc4d,0x000317bc29176f72,0x000fcb8e4f2bc4f8,0x000015e397726486}},
+{{0x000996c2846a0574,0x0008909788b80e53,0x0007d7443c655d0b,0x000957094d5d2580,0x000000512861f11d}, {0x000f621dd41d8fd8,0x000a3b4451e39589,0x000074a91df6dc8d,0x0003fd19caff06bd,0x00001277ac6f337f}, {0x0006d666646682d4,0x0001c432267dfdee,0x00061e6f15a702a3,0x000d282d5cf40414,0x00000d7683c6e01c}},
+{{0x0003a98ce42dd840,0x000b24f520bdfd00,0x00055fb41ff7773d,0x000c8754fe5af18c,0x00004e578aa1f3e3}, {0x000e913c8e90fe90,0x0001ee97d33d4754,0x00097c2995cef93c,0x000c1bc7a069bfa5,0x00000737db25289a}, {0x000070f6c1f0772e,0x00048227d848f97b,0x00008148b8726525,0x000d44df959ac2b6,0x00004a3172e65255}},
+{{0x00021334f8ebdfe0,0x000ed6b3095f429a,0x0009b7a1be6e5254,0x0000c4a2cfa168a5,0x0000638a96f58850}, {0x000c22d17e5d0176,0x00032963345ba163,0x0003e872ebaadcad,0x000d37755be7775c,0x000054300374a5e1}, {0x000374cf693957a1,0x00074e0dbe5645b7,0x000dad696861bec6,0x0006ba470e089607,0x0000340db2ba2ea9}},
+{{0x000a2120bf310f6e,0x000182154ef4e532,0x0001c7710ce6e815,0x0009d9b80da4db2a,0x00000ac2129186a4}, {0x000adfbe60e27cd7,0x0004f3b9ff9aea9e,0x00007f8bda481c5d,0x000961797d27cfec,0x0000346f01acd286}, {0x000700075cb01065,0x00075a28106b2d88,0x000fe2336c423079,0x000fd694768ac983,0x00000970c3f002e3}},
+{{0x000fb4ffa8b7c8bf,0x000fee153ca4ed75,0x0007de79eee49acb,0x00070421559ea1bf,0x000027292ced9b81}, {0x000306e805f3f6c7,0x00087472804f54d6,0x0006da4971b60944,0x00039c81f1599002,0x0000329c9d10a904}, {0x00059805ce47a565,0x00044eda69357588,0x000f79a0e94fd5ab,0x000522f5cd6f3ab5,0x0000390a93b3622c}},
+{{0x00006003436f9423,0x0007de74677e5dc9,0x0006836ef6dec88b,0x0002fec8f6064173,0x00006119a2bd8508}, {0x000b776db93db0e1,0x0008a87003374791,0x000d6ddc04a91362,0x000cc90ceff53069,0x00007bcf863297d8}, {0x000dbd965859f45a,0x0009f3159dae5f4e,0x0008a65f8d15c78c,0x00060f208052ddb2,0x0000529f489e0d28}},
+{{0x000650a504820d54,0x00076121907f3c29,0x000f310f1b3297c4,0x0001356b0ff0eed1,0x00000a597ed6425c}, {0x000beac3c00a848d,0x000ff063bce14320,0x00072a61f12cc3cc,0x0001c2927d51dee3,0x00004400ffc9e28e}, {0x000c33e40b727304,0x0008ad28ebc29c33,0x000f19fdc55d8fe2,0x00089b983acc2ff1,0x000034a1898faadc}},
+{{0x000ab749181b45c7,0x000183103a2ce964,0x000321404ce5e24f,0x000bf102a75a7b63,0x0000306cf6d5c4b1}, {0x000d3e4ea7c67900,0x000931add3b95914,0x000c4e0fabad1f81,0x0001f2ac46ad91bf,0x000022751f67f4f5}, {0x000366fa22060ed4,0x000eb416be258ac3,0x000f524dee6602d9,0x0008c2fd802d0d1c,0x000071bd6e525438}},
+{{0x0009cdb3f141949e,0x0008b7c9e5e31551,0x000eabf2d2ce31bb,0x000eddd332482c5d,0x000027619519526f}, {0x000f52e0533be6d8,0x00068ac98d44d536,0x00085cb8796309ee,0x000f0822e2cc1ed9,0x00006d8a6d74898d}, {0x0009afbb604976a8,0x000a003b751e40cd,0x000435dae3e6707a,0x000a83663ed1f889,0x0000040116617167}},
+{{0x0001854421bb0460,0x00012dfbe182f89f,0x000a9f9a7d71a848,0x00098e6f6cf39bd1,0x00004cad84a77780}, {0x000ea910291f499b,0x00009ec380c37154,0x0008eb7509efa982,0x000cd646a68209ed,0x00005c2ded2819a3}, {0x000deab1b8283b95,0x000c94952f4943f9,0x0000d7cf95a8d27a,0x0007040a86bb7f1c,0x000032f128b3ad10}},
+{{0x0005080d234ee25c,0x000e370ebceccb81,0x000febe414666bda,0x0009470b75b7c74a,0x000062772d2affd0}, {0x0000c4f4fc794eb8,0x0008c81d478ddd90,0x00095e7621966833,0x0000b8d97e097431,0x00007e2d5cb6049e}, {0x00017116425389a7,0x000d288ef30d39f3,0x000149fed96e1df3,0x00070a089aae133c,0x00004ecf62ab8fb4}},
+{{0x00044cec0f08abe3,0x000bd25cf6b8f26f,0x0002af54711fbf7e,0x000d324fbc7718d0,0x00005ac07c870d64}, {0x000152b1a2458dd6,0x0007d6a39201639c,0x0006e187ade436f6,0x0006339e32de2d3f,0x000003254a9c67cb}, {0x0000d2e607e08acd,0x000d26e089ccf60d,0x000337d750042fb2,0x000415fbe7714715,0x000077c433c1d023}},
+{{0x000064bbcb80e261,0x000d76216e276ac6,0x00035c474f3c8460,0x000f92d04d8482d9,0x000012e8463c36df}, {0x0001c8736a531682,0x000292c995a3bd67,0x000ef00fcab7049a,0x0005bf55aeba1bbf,0x000019d994c40784}, {0x00096da604a9839c,0x000ed0ec0f4271e8,0x0008b0edd3f943bf,0x00085711bdf9d803,0x0000570271f677c3}},
+{{0x00073c18d94daeda,0x0001c9a377958b35,0x0004f2c45d0f4f5e,0x0007fa94492a1e9a,0x000013f029926b7b}, {0x000a2bae4b85ae3e,0x00054cf55322f73b,0x000d973b4173c644,0x000d566e406c856d,0x0000788a766f95b8}, {0x0004a7d0f7f6c1c0,0x00064a6e95702552,0x000ae63d98f86528,0x0003bfedc6a7de5e,0x00002024d0ef7f70}},
+{{0x0005dc5a6eecbe50,0x000264b64bedb2fa,0x0009881e6ff264e2,0x000036e0dd5a42f3,0x00004fb180f4af23}, {0x0005a7a4e013d531,0x0008474b983b864b,0x000edb29f9409f96,0x0001d4333cca49b2,0x000030a43d672f7d}, {0x0008abe1152a5ebf,0x000a0c486e85092b,0x0009e4763f502248,0x000b81c6a8b1ddea,0x00005354e47ac0f8}},
+{{0x00088e93d9457638,0x00043ae9689d80a7,0x0003ee4103d8bbb3,0x0000dba6841d3402,0x00000ff6d3f43392}, {0x000832923fa62600,0x0009925947f83847,0x000f4803d45f65a7,0x0003ddcb340d20b7,0x000063585a3c041f}, {0x00034ee871911c90,0x00018cd4173f04f2,0x000306af3f1adc7a,0x000b98d84cd1f0e6,0x0000311875e37124}},
+{{0x000290854a246e5d,0x0000ab5c9706619d,0x000d1b08ebb1eba0,0x00039e170d85adb7,0x00005b80e635e888}, {0x00048b301987243c,0x00089ba11cd68126,0x00057ee3d92bc96a,0x000290c6fa44d6fc,0x00002a16b0718326}, {0x0005176b03972c7f,0x00020602a6fe5163,0x000e401045615b54,0x0005b1866dc9befe,0x00000afcba6e89af}},
+{{0x000a7013d1c83d89,0x000b155f16e58e8d,0x000afb1e2c3caccb,0x0004670b06e012b9,0x0000685032aae8e3}, {0x0009dbe520365a6d,0x000399115c88a3b0,0x00087cc841ccfe69,0x000a9c441f098ebb,0x00000e738bc71e8a}, {0x00095e6b561febc6,0x0008c130d963b66c,0x00061c8844b11f26,0x0000187cbbd94b32,0x00005dd294061236}},
+{{0x00053ccd3bf9092f,0x0006c5eaf2044330,0x00008c51850f6c5d,0x0003f6cea6c3aab2,0x00000e8644d95fb2}, {0x000dc0e23dde23d2,0x000d8a96eccf85c1,0x000eaa6ce9c1cfc6,0x000cc80a86d12c4b,0x0000388a8e62af42}, {0x000de7a5f60f452b,0x00016de998025d3a,0x00030595e5f62a27,0x0001616dca4e5485,0x000079f06033f05a}},
+{{0x000a426e3b646025,0x00090385ce4cf9b2,0x000d6dea45321271,0x000de75a25cffc2d,0x000006409010bea8}, {0x000cded679d34aa0,0x000c0cc4db39fd67,0x00035d190fcc0b9e,0x0006fefa535a456e,0x00002e05d9eaf61f}, {0x0007901ad61beb59,0x000bce5dc880ac44,0x0007ca6827661f19,0x0007f2624685482b,0x0000293c778cefe0}},
+},
+{ /* slot=10 [{1,2,3,..,64} * 128^(2*10)] * G) */
+{{0x000c5303f7957be4,0x00020e085c1450c9,0x0000850050a3c31a,0x000f2dab0721d71d,0x00000aba390eab0b}, {0x000fdffe638c7bf3,0x00060388b4995529,0x000bad0249df2b9e,0x00074ede027b34f1,0x00007bc92fc9b9fa}, {0x0007ef2e801ad9f9,0x0005479afda3a9f9,0x000d596b5083697d,0x000b8e0e906b3ffb,0x000002672b37dd3f}},
+{{0x0002ca8b260885e4,0x000ec82b34c1c48b,0x0007f58f74a4286b,0x000a2a5937e1a261,0x0000741d1fcbab2c}, {0x000ba729398ca7f5,0x000257a4849dbee9,0x000ec544e1eb9ca6,0x000e2c829eb29ce7,0x0000232ca21ef736}, {0x0001423d253fcb17,0x000eafa39eb14bf6,0x000851c7af08803c,0x000414bf18602df9,0x00000400f3a049e3}},
+{{0x000e0476ba61c55b,0x000d7c4d39716abc,0x0008d82d0936a3d6,0x00056fb6eb259d5e,0x00000c9176e984d7}, {0x000ba412a06e7b06,0x000452c8d25602ef,0x00067a91c7146785,0x000adf3df9713ebd,0x000032830ac7157e}, {0x00082a7ab73769e8,0x0007875b18e2c0e7,0x000bcceae104a05d,0x000a82029525226e,0x00000d794f8383eb}},
+{{0x0005f5cb9e1516f4,0x000cf648aae45ff3,0x00093a9ef3ee805b,0x000a6c2f0d73c2bb,0x0000097b0bf22092}, {0x00044ce7a7a2e1ac,0x0003efad1b8b77be,0x000d5f7c9b411fd9,0x000db161734a1d70,0x00000d6592233127}, {0x000bab1521a9d733,0x000ead61abb25c48,0x0006cb4305a6c2ea,0x0003a67625c6c1cc,0x00007fc90fea93eb}},
+{{0x0008f1fe1f5c5926,0x0005e3b258bf4040,0x000dc716691a8f2f,0x000577e40a951a2f,0x00006598ee93c98b}, {0x0007deb59c7cb23d,0x000695328404ec52,0x000ccf2c7a955391,0x000fa11d64392817,0x00006ce97dabf7d8}, {0x0005a8e50ef7c48f,0x000116f2ce53225b,0x00053de537eb6034,0x000bb03c5e75173e,0x000073119fa08c12}},
+{{0x0000129453f1a4cb,0x000c9c8f53787ed3,0x0008bee7b9bce621,0x000428cfacb2b133,0x00003025798a9ea8}, {0x0005b94d21f4774d,0x0006c7897b727784,0x000c56522bbf62f1,0x0001212671857c03,0x00003cd6a8529562}, {0x000cde923aeca999,0x0000062e8c12f3fe,0x0006988adebdaa5b,0x000103667b99dfc9,0x00003f52c0285266}},
+{{0x000aa48e2a1351c6,0x00054fa7f53d7ffe,0x000582ddf1286247,0x000ac590b5ba9e57,0x000060c0104ba696}, {0x0008bf99eec416c6,0x00017a9d2f671925,0x0006dea4abac8a50,0x0001569629549ab1,0x000005d0e85c9909}, {0x000de020de9cbe97,0x00056b50bcf74051,0x000f11df65fa07fc,0x000de4d378cec9f0,0x000036853c69ab96}},
+{{0x0009b8de78f39b2d,0x00071a847b9ec36d,0x0009bd3fde7f42ed,0x000ce6b241cd1d67,0x00006a704fec92fb}, {0x0003c0b0fac5e7be,0x000854c08dcbe443,0x0006978f9b724bae,0x0005fc8f1f24cc44,0x00004a0aff6d6282}, {0x0007fb9e61095301,0x0009402a092f8e91,0x000a66190bc102df,0x000fe37bf09e2f5f,0x0000681109bee0dc}},
+{{0x000355e70b74b679,0x0007f12f42af467e,0x000e750d4616d8e7,0x000fa92b388e4bdf,0x0000718b2ad721d0}, {0x0002d8060bddda5b,0x0008004e4733d576,0x000029722be71bc2,0x000c2fdca2f140eb,0x000013f50b4a919b}, {0x000f9e9135c3d1f0,0x0000f6ddc2c4ea75,0x000106a42d8f9bc5,0x00049fb31a4cc78e,0x00000da8bc68cc47}},
+{{0x000a31de887c6285,0x000c9630e685ad23,0x000b93e68c2b1a00,0x000474028ed2d72b,0x0000622a9d7da8ee}, {0x000ca4fd803dd355,0x000564b241559f5e,0x000d8740dcde0ab6,0x000cd960e1dab442,0x000073187fa7c5c7}, {0x0000142b04a84201,0x000caaa7ec4c584c,0x000713560b7d7880,0x000ad8637cb4544d,0x0000397cb12559ea}},
+{{0x00090c2f01527611,0x000effb39e82fe7d,0x000d86300278d54d,0x000c761147ae873d,0x00002e062d9265cc}, {0x0002a76344d19b8a,0x000ba7d73bc00efb,0x000093499b9b21d7,0x000facb636bae223,0x000068b58e920d0f}, {0x000b2b75614714a8,0x0007570c4b340e82,0x0001a84fa05ee658,0x000a41ab9a55923c,0x0000090e311660e2}},
+{{0x0000589d9f497147,0x000a4d32023c7c52,0x000f220420f45467,0x000cdf95bbed49d6,0x00001ffc4ff2e1ba}, {0x000b148c43e25292,0x000a840e48ea7bd8,0x000f34eb63b45d07,0x0006c8a549e9762a,0x00005727b3f2462e}, {0x000afd4bf58d3e7a,0x0000e7da81adde18,0x000447d659072250,0x000354b3d9a36649,0x00004aeb1db9a870}},
+{{0x000a84c356188f25,0x00065ca2fcc1b2a8,0x000c39bf5d9338f7,0x0001ab4011bf863d,0x00000c9cbbc1818d}, {0x0007dfdf45ea9b0c,0x0003584f56946992,0x000728ca36ba5145,0x00001277fc03e5f8,0x00002ba53aa49e88}, {0x000e5c21133879f7,0x000a3fda18551dce,0x0000d20f92b52b9c,0x000be84e05aaad20,0x0000294a103e01bd}},
+{{0x000154cca7eef00d,0x0007804e08ffdf64,0x0008f343120f9218,0x00028348f2f67c73,0x00000d9da8044fc8}, {0x0003b8d294494827,0x000dce55915aa722,0x0003f5af0d4770c8,0x0009bfefa28d6cf3,0x00005ed0b58417d7}, {0x000e50c4dc3a414f,0x0000a74b9ffb905f,0x000501f8c4aa6fc2,0x0008125661966be7,0x0000311e7bc49372}},
+{{0x0000f2dea24ede0a,0x000183e4058bb558,0x0005bc0487698cf0,0x000955143f194e17,0x00000635fe385b3d}, {0x000c4a64e03842ea,0x000a155baa602d60,0x0001daadac30db1a,0x00049a96cbf3141e,0x00007e8b773078c6}, {0x0008a3acb0928174,0x00028c804ffcf5fe,0x0001572ce40ab92b,0x000334dd7c86cc80,0x00005b56664e2bb5}},
+{{0x000a0cc9782a0dde,0x000b2ea718385559,0x0001ef238c551dcd,0x000613d7f62865b3,0x0000504aa7767973}, {0x0008fcfa36048d13,0x000b373899ddd9c1,0x000f92d0aa29159d,0x00019d4dc9f350b9,0x000026f57eee878a}, {0x000b2cd55687efb1,0x00062247af17b0ca,0x000f5a24675180d1,0x000306985c15a344,0x00004041943d9dba}},
+{{0x000f56f75f63c181,0x00012e45c8dc5352,0x000b8696d1c6110c,0x000b0829929338ba,0x00007875dde47758}, {0x00093713de98f588,0x0007991d21200356,0x0001224c9151587d,0x0004a064721e7387,0x0000794a1b51a836}, {0x000b1b1303d31df4,0x00041abf5986948d,0x00072d4d231b50a7,0x000d24eac5ba8a3f,0x0000176fb863f169}},
+{{0x000ed686cb47019f,0x000bcf3988b5e532,0x0003a6c7e4f8f598,0x000eb4fde9830ac3,0x00006f89bd376d8b}, {0x000656022605603c,0x000d0c1cbc4efa86,0x0000a1b171d2ac7c,0x000665eb22cb7505,0x00001640e072b3f5}, {0x0002d49c005c5fca,0x00084bb43dd707c9,0x000fb056de1c390d,0x000d9d9805d63bc6,0x000066893f77e109}},
+{{0x00016a6a102e87a3,0x0004d9da8d8e1112,0x000a16ea0af2de61,0x0002dfe3ae62e9b0,0x0000306abbab8703}, {0x000a2e150b221876,0x000b6dc21625cc77,0x000e57026643ca90,0x000de31a62099caf,0x000021cb901e719d}, {0x000b4931a10bf930,0x0001eaf5c9baf4b8,0x00055c418bfa4be7,0x0001eb75f309ae27,0x00002f820b238831}},
+{{0x0002f4db3c2ec8fb,0x000989ff7563dd18,0x0005d6dda6d78287,0x000a347f62c1c2bb,0x000045b9aedbcbda}, {0x000dccff808d1dd3,0x000b3164d86fe0cd,0x0001d45a72bed571,0x000b6a23388aba85,0x00003ad73a35b309}, {0x00057580f11fcebe,0x000431eb8d5818e4,0x0005b63e39326a26,0x000442f42c00a0a9,0x000057f18586bdc0}},
+{{0x0006f2f38d76d121,0x000a57c8a5e00260,0x0009e2ea1dc9fb00,0x00013b19336b7ca6,0x00000fe7b4202425}, {0x000a2d0ae7871561,0x000c78d164a622c0,0x000d43a154ad2893,0x0007239a766d704c,0x00001b2a13b11b65}, {0x000116e3956ce5f6,0x000ab91f915d4bbc,0x000f97fae1a1823e,0x0001e51353aca6c3,0x000030a72f7bd083}},
+{{0x0009cee939506c67,0x0009bc1f918f10ea,0x00027efe4f8e4003,0x000694b2ee110c87,0x00000aa920ed94db}, {0x00032826fbbe3260,0x000923f8cfa662d6,0x00062ce2f0cb3cce,0x000e70821b8adb23,0x00002680051a101b}, {0x000feca46a6b6618,0x00012bfb4951ff1c,0x0004ef4d7e2c6610,0x000719352755c809,0x000032cb3dc8110f}},
+{{0x0006dcaffc84f928,0x000c86b9d0c66092,0x000219a5a0151df2,0x000bbc8b676d91ab,0x00002e9ca6db625b}, {0x00068ec38164f7b6,0x000ff2c7a1324ad4,0x00065f47494436c3,0x0003faa83bb1c67b,0x0000626ff4335ffd}, {0x0006943fe2a22544,0x0000c7c2014d9c85,0x000f8722eee4ac2a,0x00038e0d47219dc7,0x00001e95b3434775}},
+{{0x000f54582eed7ff5,0x0001aa01cfb4d28b,0x00037ad605f84ee5,0x0004dabcdc367c19,0x000073ccb7309fc5}, {0x000186436f93e483,0x000bdbcb59bb0b00,0x000f79555a5dc3ee,0x0004e45200a6e301,0x00005764a277555b}, {0x000e7d744b8ce16c,0x0007ac5d92fc69a2,0x00064bfc052a0f5d,0x00063e532a368da7,0x00001dea6dd55a5a}},
+{{0x00009c8363e14563,0x000dd3918a29608b,0x00061b4a5aa98457,0x0008a76c5a85e94e,0x00005b685bd8a508}, {0x0002010bf38ac125,0x000e058e99411276,0x00084a92ca514668,0x000ee0ce970f3718,0x000006da5f7058c8}, {0x00017f8ccdbff3d6,0x000a21b7054400e0,0x000d1cc8d5e808f9,0x0007ba2fd237ece3,0x00000f721b368b1b}},
+{{0x000fae258d8bac54,0x000322a0629c7e54,0x000296f285cf42d4,0x0006894038c52270,0x00002af0ec6fec5c}, {0x000e12a9cdfdfb33,0x000bf66354093daa,0x0008be38f515c01a,0x000104af0b266719,0x00001fc7fbd2adaa}, {0x0000ae6a800a93e1,0x00052547e04ff731,0x0008af69fb3efdfe,0x000f513953ad60e6,0x00005c336f0a516c}},
+{{0x000b0365bec52f0b,0x00033538051847cd,0x0008b2a4b981fa14,0x00026386db3eb805,0x000022e8360eca8d}, {0x000bd58408879fb3,0x000fc9d6f182ce1d,0x000c9daf0f654c18,0x00012eeb471f599d,0x000012a760ea2263}, {0x000acf9da134b70e,0x0007f6b889149640,0x000cff26111fde78,0x000185ff0604dc82,0x0000244721baf1c4}},
+{{0x000e6c35bdaf4b73,0x0000c659038fc8f7,0x000ce473538b3d04,0x0008b10c9ddca3ae,0x000078f6de81884c}, {0x000116e5c567acee,0x000bd0da243e7cad,0x00094fc705a270e8,0x000056bd2604b35b,0x000064efb05895e1}, {0x000a87b7604634e3,0x00064c08c660a88b,0x000ca75c150b736f,0x000108406daab473,0x00006bead2f6c8b1}},
+{{0x0009c5b69fe471d1,0x000953a9ccf0ab66,0x000d5a4c43f3a8b4,0x00064124bae8dc06,0x0000341f417d50ea}, {0x0009b290069a4093,0x0001ca47ded8eae3,0x000ee45bba4ecc99,0x00093e4582b831d3,0x000043d034940e71}, {0x000ad2619e1e44bf,0x000bd091707dd483,0x000f94ce882b4c1c,0x000f42a840ad7ebe,0x000043e8b6ea7320}},
+{{0x000e0f7ce85e87c3,0x000ebe0047cc88cd,0x0002f4b95dcf7d2c,0x0001d1fbfd8c4a27,0x000001ec70ec5e97}, {0x0006d205318ca514,0x0003446389c2fcb8,0x0006209584bca864,0x000b921861acfb03,0x00007aa9b90fe09d}, {0x000c85813d70ad9f,0x00007d2fbc28944a,0x000546bf530f5c20,0x000fa06d6a7e2d12,0x000057e8738e58dd}},
+{{0x000215301a29b181,0x000ba0d7133efbd4,0x0008f2ee6e21cb02,0x000f7cd31658c21d,0x00004a6b6e621637}, {0x000cea45aab72f8e,0x000a9ba98e0ad4e3,0x000cf535dd005d03,0x00099e0d9a171d59,0x000054a0fd6b5312}, {0x00029bc18cea74c7,0x0001b46d25c9c4f2,0x0003ce39f6ffa3c8,0x000243958139f398,0x00001ad444cce63f}},
+{{0x0000eeba43ebcc96,0x0009c26ea9cafc3c,0x000c77ccc68d749c,0x000340fd9fa95ee1,0x00001420a1d97684}, {0x00017743a26caadd,0x00024648ab7ce4b2,0x0003fbc9e347a6b4,0x000d019cb1d4f7a0,0x000012d931429800}, {0x00067799d337594f,0x00040b23aa47b00c,0x00035ff3955e3c51,0x000a01244182854e,0x00001b4f92314359}},
+{{0x000f1fbb19a06e8d,0x000eb6c49eb96150,0x0002964a6732f144,0x0003cf7222426a1c,0x000000862dd3a369}, {0x0007cc7164aeda0b,0x000f29273aa98a0c,0x000648cc83bc19d5,0x000d8638d2b260a7,0x00000deac656f3db}, {0x000af20aad3775c5,0x000bb2b0dc2e56d0,0x000f631fc1136d01,0x000fd2c066190979,0x000075d976f6c8ca}},
+{{0x000590b71e6f4623,0x00026fc2cf652e70,0x0000d5d20e65a4db,0x0004b8c6493106e3,0x00006c5844dea374}, {0x0007388d23f346ab,0x00031e5700beafc4,0x000c273a5f9e7f24,0x000bb683e671853b,0x000030787d89e7e3}, {0x0006ea89d0387fce,0x0008ba44b6b43f22,0x000bca8c168ded40,0x0008dc38ea246650,0x00004c2631a80a59}},
+{{0x0006239277309580,0x000204fa9cf36b2c,0x0006a911bf616e80,0x000e16f6f751c121,0x00002483522c633c}, {0x000a8b744af60cb3,0x0006abe7256a6ff9,0x0004474356a2531e,0x000a7ad308f474e8,0x0000524ce99a876f}, {0x0003a5f6c91ce972,0x000dd36fd2e1649b,0x000358cf9fefec5f,0x0005cf690a72a487,0x00001b3915874d0b}},
+{{0x000c88b802be62d5,0x000ac8f02b3cb2d6,0x000f2f6408300772,0x0007bb4eaad17a7a,0x000032d09c40f9d1}, {0x00076bfc2977e5ce,0x00049dce24f6896e,0x000dcf3f901acde9,0x000583a0a98282e8,0x000051809c6eccc9}, {0x000788b24507629c,0x000e704fec461c7d,0x00037f33350ddefd,0x000315ca8ad951a2,0x000014eddfd12bed}},
+{{0x0005bea5384a33b7,0x000bea1b7d737441,0x000fee4b80ff761b,0x00093dd1b6456873,0x00005c1438c7b3f8}, {0x0007437386787ac5,0x0005138fcb980954,0x00026fc9f3134b47,0x0006beeabd2599aa,0x0000010dc16ffd71}, {0x00039f53926bfa55,0x000847b91a94c29e,0x000b83810781a1b0,0x000ba6a17e539e22,0x000034e2663f7c58}},
+{{0x000f234aba9d828c,0x00074a35804a0f72,0x00018db7b3c9370c,0x000b03b281e546a9,0x00000c63a2a99390}, {0x000dffb9f8f8a007,0x000eccc011a7d6c9,0x0006b0c708e9b833,0x000e43d6f0b28a87,0x00002bb01093ad7f}, {0x000e358ebefe1459,0x00088f5027648ed9,0x00007b8bcbe54e3f,0x0003c8ddd75ff53c,0x00001c7db1a13f1a}},
+{{0x000c40f4ac3382d7,0x0004de4c7cc6f863,0x000383d8fbae9a00,0x000b4392ed206446,0x00004b1f31892586}, {0x000bcb6d1ed751b1,0x000fea7e404db136,0x000de6476a5008ba,0x000c57e098197f30,0x000050a9bd250cbb}, {0x0004277a537d3060,0x000e7fa779b901a3,0x00042891a0b63501,0x0009d1bdc9e1a7f7,0x00002cfa9dc08797}},
+{{0x00018d0bcde79803,0x00084fb5560f6d44,0x00096e497993abcf,0x00032828d5861c5d,0x000065a96dbd60b5}, {0x00091263ee7fc97d,0x000e1298af684bb5,0x000871c121370b9c,0x000575e462ed34d0,0x00002ec6b52e82eb}, {0x000e7c4f0af2de16,0x0008e9f1f59d6d1f,0x0005474d9cdd6906,0x00070285dddb2c8c,0x000073c9417a9320}},
+{{0x000de6b776bd1690,0x000bdafee58e2549,0x000bbcb153f204f2,0x00006f3371da0ab5,0x00001e6df479a1c7}, {0x0003035543fe25d8,0x0002aa67629644cb,0x000dd5d5101d956e,0x000691dd5d8f1079,0x00005001a0bd19b8}, {0x00028016810d2bc0,0x000152edd588a96d,0x000036ef292097c3,0x000f3b308037d050,0x00005fa03d6ac1e4}},
+{{0x00006f1c40adb40f,0x000f035e1eee70e0,0x000f6096cabf2eb7,0x000b49b41e0d4e2c,0x000073c60f077ac5}, {0x000d1a9218e20776,0x000885de9a980b68,0x00054a0d5469fe4a,0x000e4caef19bed90,0x000051a8427bbf0a}, {0x000449ad4b849924,0x0002d5ecd4496fab,0x000c6b206c708320,0x0000d5ca902685c8,0x0000303e037b9815}},
+{{0x000e62e0e92fa702,0x000ed331f3fc4b86,0x00048a91aaacfe1a,0x000dc4f2659e3607,0x000058d8316669da}, {0x00038a3795dbeb18,0x000f29f9d79bd007,0x000bded4fcbe62b6,0x00059359a392e376,0x000056e748a52751}, {0x00080e3e56faa547,0x0007d859eed09c40,0x0001aa4dffaa9dc1,0x000ba1a735ccfbc2,0x0000696d5b11087f}},
+{{0x0007bade5c9cc9b8,0x000cfa0553619168,0x0005238a92be0490,0x0002caafcbff1f05,0x00004a69b019b150}, {0x000ab4a0975b8b9b,0x0005e3796b23752d,0x00043d6d52114e36,0x000d79ade6e64751,0x000041f2bee828c6}, {0x00030e55df4b2df2,0x000f632f1ec19f9b,0x0000501472ac3ce7,0x000893cb650a0eed,0x000068a8c5a7dc7c}},
+{{0x0001b620f838a520,0x000e258079f88950,0x0000c92e2e725c07,0x000e42eb97136d09,0x000020513435badb}, {0x0004b00fe067cda3,0x0006390d95a97a40,0x000a0ab0bebce268,0x000c453223c03835,0x00001515b436bf3e}, {0x000513271f29223f,0x000bb9c158dcf56d,0x000abb46f8e1fc9d,0x00030a476b857999,0x00005eabb5256503}},
+{{0x000c2de0fe8fc97c,0x0005af4c0b4966e2,0x000a19b0aa9a1712,0x000d21edc88bb877,0x000064fae010e8a4}, {0x000b7eab3dd248ce,0x000c7495a0d87f50,0x000d6ba36486ab68,0x0002b483b160b62a,0x00006e85ee6f9997}, {0x000fa81884b58d6c,0x00099cd43f782bd2,0x000a6e3f9bf86590,0x000a9082a4694aeb,0x0000347f8eb9eb29}},
+{{0x000b31c186166d62,0x0007d2dbd2279ccd,0x000325d9eaeb572f,0x0000abad0d0d7e79,0x0000534bb227fa00}, {0x0007fa2db351f2bb,0x000387f617ac7f21,0x0006b3879666c359,0x000da28d6ea65654,0x00007bac4fe03a4c}, {0x0003c3a59183f776,0x0002a5455d123f13,0x000c7ab911491078,0x0007975698a0c68a,0x000046c529010662}},
+{{0x000c109d89150951,0x000912de9696a3e5,0x00075f302039cefa,0x0002dae20eae43f9,0x0000239b572a7f13}, {0x000f3030a49866b1,0x000d2215f485933c,0x0001def4f6251f73,0x00023f6ab82aa405,0x00005ff191d56f9a}, {0x000ed433ac2d9068,0x000795fc98523819,0x000593eb3d2883ab,0x00036cbef4572805,0x0000020c526a758f}},
+{{0x00003c0b990d85f8,0x000ec9921e50efbb,0x0007ae9c324e908b,0x000101f342e8290b,0x00007f44259fcc59}, {0x000bdcbfb1edd436,0x000628e561af47ac,0x000d2109877314a7,0x00073993971d436b,0x000075bbac24b402}, {0x0007925b311f0469,0x0002f8faf420573e,0x000575346d342352,0x0009026026c5e27f,0x00004375db274959}},
+{{0x000103b8914bfb5a,0x000c5f38efa19c85,0x00078dc71fd27f9b,0x00097cb108ccbe8b,0x00007a4f51d0474e}, {0x000ac2abbb605143,0x00081aef92529599,0x00075bdd5116e9f7,0x00000039a27ac971,0x00004374cccc5505}, {0x000df3871e102ef4,0x00031a16a7672fc5,0x000f41303acf2bd7,0x000256b37090684b,0x00002b8c39c188de}},
+{{0x000108bb418448ad,0x000212c0e1c3e7fd,0x0004a6248409cd64,0x00032b3e4ac96cb4,0x00004c4341d814e1}, {0x0008e4ce7746dbfe,0x00045e6aa0b43337,0x0003107e5a901b2a,0x000a1d944cd5829a,0x000026831dfe2fd8}, {0x000426e6d0eefc8a,0x00030f7204670327,0x000e0f72c6a2e7fb,0x000ed4f9804ef8e1,0x00002cc99b4c1bec}},
+{{0x00028e233775951b,0x000cc33165285547,0x0003eb0a22f7fcd8,0x0006d701dd9ba096,0x00006f3fe3a7b81c}, {0x0007025aca8a699d,0x0003e6373a66401f,0x000df3d6a1dcaed5,0x000e7cfad6f0f15f,0x00002e28d581062c}, {0x0003b0bbea340493,0x0005a6bdf4b41183,0x000b2a67023e7b87,0x00059981b097e562,0x00001744b41f0635}},
+{{0x00037813173ea6a6,0x00023749a9a65492,0x000a4478a6ffb42c,0x0005019ba42c37fe,0x00002200f9436237}, {0x000fdb68cefe5ba9,0x000dd53eea906947,0x000bc5cc73712950,0x00040e2f20544dfc,0x00003c96f73285f3}, {0x000d500003116f1b,0x000ca38f64fe72ca,0x0006ed7579042c84,0x00090b9746486de5,0x00001c5eca0dc3c8}},
+{{0x000764d151f46fb1,0x0001a822b5629c4e,0x000423d2fe2ab2c1,0x000a7f9005291927,0x00007f48a7c4197d}, {0x00089ec983e4a41d,0x000f02601faa0d34,0x0009db7a953979e0,0x0009be8969adc295,0x00003d1c383002fe}, {0x000969e0496a54f8,0x000e26856a91e32b,0x000c0411867e9cf0,0x000fbbef00d76392,0x00000cbd8811d767}},
+{{0x0009ea117f7bcd7b,0x0002623e7704b9fb,0x0000e0026e942f62,0x0005766bf68345e6,0x00005d42ab18dfac}, {0x000cb5bc79502f9a,0x00038706e806d04e,0x000ce10b5b3b2ffd,0x000fac3719c6d97d,0x00007ec874c051ba}, {0x000a9048e1604769,0x000d5fc8ee1a4df3,0x000743dbb484cfa0,0x00097c2c847cc1b9,0x00004e2b94865777}},
+{{0x0006add9b1206703,0x000a22a9f0573b8a,0x000609c25f0f742f,0x000df76298a587e8,0x00005ad24c0fff77}, {0x0005edd16f1416b1,0x000a0499cf9ee6ac,0x000a2399df041d60,0x000cc24bc48ece2e,0x00003146831a600f}, {0x0006f59a58e8616d,0x000bebdd34fb0e16,0x0007acc7c23241cf,0x0003e6304eef0a5b,0x000004af1c4314d3}},
+{{0x0008c1c35e62d3d4,0x0008b7c2885ec4f2,0x000dd67b4ef0168b,0x000efd7658a2666f,0x00004a6e7cf88e04}, {0x000e054c2405dc11,0x0007fe465907847b,0x000c734182b8a566,0x00084f832e75b3c8,0x00005ad8c361cd4f}, {0x000f1da4eb68a36b,0x000a38fc69033133,0x000b154e2e7bd619,0x0002e04bca4d1c38,0x000079f57ccf7e40}},
+{{0x000ce59b6c63a1fd,0x000cb994e523a0cd,0x000481b9fb421e19,0x0005a65c0bfec8e3,0x00006c5c0c397967}, {0x0001ab2356dcc142,0x000115e6fbc7853a,0x000ca733db1ccc3d,0x0004d9c2c8e0d54b,0x00002a18384db066}, {0x000027614514eb73,0x0001fcb902ce759b,0x000664052faea3a7,0x0002e1aeb324943e,0x00003c09b499df2a}},
+{{0x0000748701211cea,0x0006bd230e92740c,0x000a35939b03028b,0x000f3bdc42ebeb54,0x00004285af180ed5}, {0x000b1d5f8c7e946e,0x0003de65ee3b50b1,0x000507cd52f58798,0x00077e153dc103ca,0x00007fe090c14d83}, {0x0000d9c0bfe17083,0x0008c8faef38ce55,0x000a268273e1c64e,0x0003ab8f91c79f41,0x00007a9bea0c338d}},
+{{0x0008d41cec2da330,0x000533861f64a04a,0x000c4c8c9966d308,0x00004079ad44e6df,0x000014ef4a73621c}, {0x000bc08ebc158775,0x00057195f13563d7,0x00050b0618416a50,0x000f75a4e2464b23,0x00001a171964e5a7}, {0x000dbbc24867f4bb,0x00072e10293e5a4e,0x00058c06c884b953,0x00011d90bbf4530c,0x000022fa8d86489a}},
+{{0x0001a96110286c28,0x000951b756fa008c,0x0005dc9cd5a039bb,0x000377dfc1fa73a0,0x00003b4b4ca3d07f}, {0x000580b1701e491e,0x000fe2566c76da31,0x000aa5f964530cfd,0x000d2006c970c6b6,0x000065f6a18bd21e}, {0x00083f8e7e675fd5,0x000ddd9c67196d64,0x00072e83ceb8b557,0x00047de47abde357,0x00005e7feeb37dcb}},
+{{0x000d0cbfc1bd9334,0x000f213d81a5dda6,0x000fab6d3fab5ecb,0x00030b036f8a33db,0x000069e1e4f7a803}, {0x000eecb6815eae20,0x00074a3f93b516dd,0x00067a4ff292db85,0x00021112b843a19d,0x000007bfe9580612}, {0x000894f1a76bd68d,0x000c799bde66c278,0x000d7872ac937e8c,0x0002cea9d0000673,0x00007106d23a242e}},
+{{0x000548f94aecf42f,0x000cfda8938ce291,0x0006c2ddcc6b222e,0x000aaa5a061fb2c5,0x0000142565593f54}, {0x000dc875cc56ffa0,0x000562daef6f8561,0x00006709861a33be,0x0006ecf27c58b59c,0x00004586c4f89312}, {0x0000d0bc23ca6893,0x0009581126ecb91c,0x000892b7c372f6ea,0x0008d07b5220d88f,0x000035e671386255}},
+{{0x000834f89ed8dbbc,0x000f9dc7ca46c779,0x0003e1b074c8f2aa,0x0003877a9524cdca,0x000002aacc461531}, {0x0001ef59f042cc89,0x0009d8e124bb6e93,0x000ec759972c589c,0x000c50cadc8e18aa,0x0000452cfe0a5602}, {0x0000f7a0647877df,0x000270e607c9f86a,0x0001fb11c9bbc464,0x000877bab17ea25f,0x00004cfb7d7b304b}},
+},
+{ /* slot=11 [{1,2,3,..,64} * 128^(2*11)] * G) */
+{{0x000031bc3c5d62a4,0x0003ecff07a6040f,0x00030fb54519fc8b,0x00013cd98183da21,0x00005631deddae8f}, {0x00088eb69ecc01bf,0x000ada644896f9c6,0x000f7a9fe2f0bc83,0x0008241ca2d955f5,0x00004ea8b4038df2}, {0x000d460af1cad202,0x00005a48cee832ae,0x0009f11a5f463053,0x000a463912177454,0x000024ce0930542c}},
+{{0x0006259a3b24b8a2,0x000cc45afa0b85ce,0x000ba07037b8577a,0x00009bfcccbe6e88,0x00003d143c511278}, {0x00086162f1cf795f,0x0001926ee57f2f5c,0x000c063578118c86,0x0007fcf172124851,0x000036d12b5dec06}, {0x000d279179154557,0x0005cfc783a0a126,0x000f179bacd5e48f,0x000285936bdb6e8d,0x00002ef517885ba8}},
+{{0x0003927e2c906363,0x000f46ff9bc5b8b8,0x0001fc5c8bc6504e,0x00079c22a00baf21,0x000056cb67f9bd45}, {0x00026d76512375ad,0x000f164c127dfa70,0x000cefc7d9cbe75d,0x00000defe21f8f22,0x00006bc788a399b1}, {0x000c7c16d446ac12,0x0005d88b0e0272b1,0x000ed0913bc6b36e,0x0006db9acb57d891,0x000015fef723657c}},
+{{0x000d438cd11e0d4a,0x0000d43ccf30888b,0x0001937bcc30cb61,0x000720ce09a0e379,0x00004559135b25b1}, {0x000436837c6da1e9,0x000af1fb9bdbe1ea,0x000e5dd155f9c189,0x000be52303001fcc,0x000028a7c99ebc57}, {0x000d9399e8d19e9d,0x000cb962423ffb8f,0x0007c742a3908191,0x00044c4b2b948d74,0x000037f33226d7fb}},
+{{0x00049ea537ae3e7e,0x0008b2344581acac,0x000a3cb5d60b07a9,0x0008752f51ad60c6,0x00006a2d354a4575}, {0x0007f617ea748f5c,0x00050fee3e167e9b,0x000896eef0e4496b,0x000db6471e7c849f,0x00005655898c632c}, {0x0004374b132a697e,0x000866691c05fb0f,0x000d6d752343553e,0x000734e3a811057e,0x00003c61b131e55f}},
+{{0x00072e8b3a1b4894,0x00044cf2af094a8a,0x000b3d79bdf1e4e0,0x000e9746f183b4f1,0x000017c3f1ebcb96}, {0x0005970c5216b2e9,0x0001e02dc2ce0e1e,0x000cb540f6ffac85,0x000d0ef6f64cdc54,0x000075003c40436b}, {0x0006318fc95c3172,0x000367cd2fc08219,0x000118386b85d4e6,0x000925bb22466680,0x000041c650c34a59}},
+{{0x0005a7762e0d2c61,0x000d3177678831f6,0x0008a835e8adbfcc,0x0005c5c84694e536,0x00000d1c13b1a594}, {0x000b293e4c274a73,0x0003a5ffa9da2283,0x00065a6e9313e91d,0x00004c47fd1db979,0x00005d3dd65c8fd9}, {0x000f2b5f120fc114,0x000ed5bcd76f1fbe,0x000acd264e99b295,0x0001669b01bbf010,0x000001a23d098922}},
+{{0x000e8767b55f6e08,0x000b35b203a020da,0x0000af8c794a43b3,0x000a7a3e3725a6e8,0x00000f7a7fd1705f}, {0x00012553c821b11d,0x000c241e301df339,0x00004222fd66ed42,0x000168f066fcc111,0x0000307a3b41c192}, {0x000b5d076eb55ce0,0x000bfaa0d925a8ee,0x000cb6c6e82fc536,0x000af52be81830fd,0x0000556c7045827b}},
+{{0x000c18dc8bb62f3f,0x00088e604c9a119b,0x000324c08f70904a,0x0003d55f080c936a,0x00007b7de050c6f8}, {0x000ae48912d02792,0x0009c464eaad99b7,0x00057039edd68cc5,0x000f41938ff996e3,0x000034e51292b9bc}, {0x000d8a5f6821f460,0x000f8398b13bfe11,0x0009ecd0f49ca7d3,0x0000f6c2287d60c2,0x0000324f314fcf32}},
+{{0x000121c3e4045ccf,0x0007d3d251e33ffd,0x000f5e8540527bbd,0x00018d2950639d51,0x00005d1a6770ec5a}, {0x000818d6da980e9f,0x0005fda95dcfc6c0,0x0003d800d34f59c1,0x00091e30c882c2c2,0x00005c0348224927}, {0x0003fb21f7659f18,0x000ff589b68b8d83,0x0004aa0034592481,0x0003c71130eb3853,0x00001e8da0dc2a54}},
+{{0x0000e9fc57e5329e,0x000c117a2ad9dc7e,0x000a04106b1c234b,0x000fc01f1284e88f,0x00003876c9eec9ea}, {0x00076ee3f1d9dab1,0x0009d0c8c2750092,0x000a9977f1728e01,0x00041ba83bf829c2,0x000052125210a09d}, {0x00077cae1d66c3bc,0x000e5568e0dbb7da,0x00045a13c2075ff2,0x000d7d437aa4f512,0x00006a1c9a62c342}},
+{{0x000b517302e9d8b7,0x00069248714e88e2,0x000ca960b5e3e522,0x000ada9bd4fbd774,0x00006f4b4199c5ec}, {0x000b90022bf44406,0x0007eff90b534b94,0x000af86d3aabd423,0x0002ee37600a960f,0x00002f45abdac232}, {0x000f4912c8ef8a6a,0x000fe43fb6e5e61a,0x000fd427cfe58fa4,0x00011ebb5afcc5d6,0x00006a5393281e1e}},
+{{0x00070d74fec24e05,0x000b2844be10aeed,0x000433d27df56bca,0x000421375091258e,0x000039727a2c4e1e}, {0x000971902433e0a5,0x00018a14ba940651,0x00057f319bc91a02,0x0000c4fde59d3696,0x000068184086b754}, {0x000bec650767b079,0x00097db280c56cf3,0x000cd49edfa12794,0x000d74637b6058aa,0x0000162f6fa6fa87}},
+{{0x00041c6cff77338e,0x000bb15513011749,0x0004294c73d575b2,0x0000def0521f6eb1,0x000009ed20ac5518}, {0x000c0fd7787555b2,0x000fa749c3cc75d7,0x000575d3cf7af214,0x0008a763c59e8bd5,0x00003f9cae08b371}, {0x00002b64772334a5,0x000a70d95e1093b9,0x000e7ebd0c99d69a,0x0005baeee03dc167,0x000060ec69955f18}},
+{{0x000933e2c22ace25,0x0002c97c8fd2dda1,0x00005f1906abaaac,0x0008ee79863bad5f,0x0000081a5bbf9f36}, {0x000ba76751655156,0x000a243ccec67168,0x00003ea4d3d7b2bf,0x0006165c27773dbc,0x00002ca7e2421bb9}, {0x00072d96643fa686,0x000378fdab3e39ac,0x0003413069fc19ac,0x000f79456a2bcf99,0x0000520b74fa1750}},
+{{0x000a5139a5d1ee89,0x0007cff936988f3d,0x0000e188c4814545,0x0005a3d3f622fed0,0x00000f513815db8b}, {0x000f04fe149443cf,0x000d9865cddd70ff,0x00031ed1b753cac6,0x000039d31385b035,0x00005846a27cacd1}, {0x0005cdac1eb08717,0x0009590f2e9bc4ff,0x00037afa9967e8b2,0x000b8b244093b5e2,0x00000d414bed8708}},
+{{0x00078623d029b49b,0x00043cc82e255e9f,0x0006f4672a18b684,0x00038e0103411a2c,0x000073175d79a1d1}, {0x00019929500f9239,0x000cc80bc404eff4,0x0003e50569ccfda7,0x000d5667d29d702a,0x0000164ca20e699b}, {0x00049b41df773bc1,0x000e3f2c042ba4b2,0x00053f21e6631571,0x000612dde4576ef0,0x0000300a4f531288}},
+{{0x000e27140f680910,0x000d9d73f03e61b9,0x000840b0450ebf26,0x00080aef9866e7c4,0x0000734f8200e192}, {0x000b620c0edee307,0x0002c37fb9c54b83,0x000422507ab4e05a,0x0000c8e8b47b9e21,0x00003a4225092e89}, {0x0007c0b66f376896,0x00051560d06ec4a1,0x000358b3cd856f20,0x00062b6c56fa61a4,0x00003b710df26871}},
+{{0x000ccbdaf15db346,0x000812648fb93793,0x000f6a3a5c44e5b8,0x000323292c234870,0x00002ce1c5d143bd}, {0x00049a65e3126df7,0x000e34622ffee417,0x0001a3e60a0fa7bf,0x0007d48a9a5afe48,0x00003253ddcd34db}, {0x0009c18c89ba8010,0x0002e5f509df6692,0x00032cbaf875c995,0x00082ac6f2ce8e70,0x00003f03143bacf1}},
+{{0x00068265fd0e75f6,0x00028bb90e707cfb,0x000ff92c7ae45b3e,0x00002dd7242a8de9,0x0000685b32019332}, {0x00086a92294ac9e8,0x00045d55547be818,0x000371598323162b,0x000c40194cfbc440,0x000050eb8fdb134b}, {0x00073ec6d6b330cd,0x00007132faff1c0b,0x0004a5dee184e448,0x000d2d2732b7352c,0x00005d7c7cf1aa7c}},
+{{0x000eeb1120f8cf76,0x000f4206ff5fa623,0x0005768097705bf2,0x0004e8c71bf6fb70,0x000068ed43567865}, {0x0006e0a3c666e6f3,0x000d96b31b8fffc2,0x00059a7c88592261,0x000cc0b4b64c409a,0x000063bf79394624}, {0x0000e1f6655951b7,0x000aab797ea66279,0x000d04845a6739dd,0x0002415ddb19c26d,0x0000108e77a4d816}},
+{{0x0004fa8cf156dcc9,0x000cbd236e1abf5f,0x000c961f0633081c,0x000cd940381d7855,0x00007bbd4cab383d}, {0x000cb13ebb499ace,0x000448a0f3cd8f50,0x0005d139dc76f363,0x000f8a5b82081cf3,0x00003fb265a05bc6}, {0x000f4be4455c70c2,0x000db846fc05e054,0x0006ec8d5a165bc2,0x000ff711bd4dd907,0x00006b1289361e30}},
+{{0x000d909116147f50,0x000b28f26c50c25d,0x00002b34b806e55b,0x0003b146b082eb94,0x0000129ba79d0068}, {0x000364ee5200a266,0x0008b27fab887bc3,0x00041fcb0539bd30,0x00096c923d90ca67,0x00003d5fab236c6f}, {0x00077a75fb0d868d,0x000aeb639e00b5a1,0x0000c07d039cd0a2,0x0001d83f4e97baea,0x00001ffed6714214}},
+{{0x000b46bf7a4aafa2,0x000ec4d40d411af3,0x000a7c15e3b78705,0x0009d4d114f0c6ac,0x00003f364faaa948}, {0x0001013e9b73a562,0x0005748ec26e133d,0x000d468058925cef,0x000a438a7fce614d,0x000078b0fad41e9a}, {0x0006a431ed05b488,0x0006c9c495c7ebf5,0x0007f3651aa533e6,0x0006c33e8652baf8,0x00000241800059d6}},
+{{0x000460777c0f8019,0x000f6e4d80c21d61,0x000255800d76b6d3,0x0001ebb668b19480,0x0000317db855c3b9}, {0x0008c88f0b0779da,0x0004d9409042e957,0x00010c720af5f05a,0x0001fca4b243f958,0x00001c2a04117799}, {0x000e9b1efb18498d,0x00016c23ee31c347,0x00011164691bfe89,0x000676126ff04f0a,0x00002189578b214e}},
+{{0x0006a308dfa01f24,0x0006583883149d29,0x000b32ecf4d4577e,0x0004f87cb8fe2a26,0x0000326ea4103184}, {0x000b53a4abea03e5,0x00020167bcf8c83e,0x000ee5d1d57c3e05,0x000a756e0579ab52,0x000021c8bb461d64}, {0x000534da205898f9,0x00094e2bb6f03690,0x0007b8e67c4ed20a,0x00000f7158379491,0x00007f3e9c396c22}},
+{{0x00078a93e1d6deca,0x0002ad19a7cb8965,0x000dcca4b7b842b4,0x0000da02072d9603,0x00000e18aa3d4503}, {0x000e75f2eb036298,0x000cec7e118902e1,0x000a590d72f2b80a,0x000552417fdeace8,0x00004857bb156c78}, {0x0002ddb20085c5b5,0x000f09a8752913ce,0x000f08d5bb609033,0x000c9f06ad69d03c,0x00002e71d4eaf697}},
+{{0x000077fea37a5be4,0x00002e5a5eeb7ceb,0x00071270b8db642f,0x000529cc2e6d0c54,0x00004771b65538e4}, {0x00050c7dcf38ea01,0x000c0b2917ab6283,0x00057082f77c6cdb,0x000a1e0ace7cfbe8,0x00004d2845aba2d9}, {0x00037fe0447070de,0x000436dd557dfbb5,0x000600dbcbcba744,0x000d7f8d3b5a3473,0x00004aeabbe6f9ff}},
+{{0x000b7322b723bbb8,0x0005c0b8103b2ffb,0x0009cf6734abc066,0x000da73bf49ce808,0x0000288e677c6b52}, {0x0007ba7768362d52,0x000ffb3b803130b1,0x000ec206f627f7ff,0x0007f53c8a1545ce,0x00006808bb61312d}, {0x00012c1078f632d0,0x0009781aa5025eae,0x00055082ebbbd9c0,0x0007eaa33cb79880,0x00006a7c366ff35e}},
+{{0x0008230b3545a38c,0x00063cc77b83e729,0x000b63f38b030e4f,0x000d2adad39b8d28,0x00003a5e27b74601}, {0x0003d1b46df8d799,0x0000bf8f17c70006,0x000aca555b356e26,0x000bb9312ad07c37,0x000009653499e9cb}, {0x000211a1d8769634,0x0009978028ab38a6,0x0000a8d9238867ea,0x0005e9706066abe0,0x00007d8db6653312}},
+{{0x00004c976a6e86a1,0x0007f2ca399d9fdb,0x0007d5b2b3ac21e4,0x0003e6d55dfb8ddc,0x00002f643e3449c6}, {0x0009094da610a3c3,0x0004591e78f2152d,0x000ae0a25c2d2677,0x000c88aef05f0747,0x00006afaecc8507a}, {0x000c5ef76c6df796,0x000ecfe04e1b0b55,0x0001b019db0e688d,0x0008821d56bcdb8e,0x00003868256440ff}},
+{{0x0000119e40d8f78c,0x000c53c710e11463,0x000910dd79a01a9b,0x00024e5486d2b258,0x00001e6c47b3db03}, {0x000134bcc4a9c8f2,0x0001c8ace2e376a2,0x000911a0bafbf8fd,0x0009b9e000ae3049,0x0000046e3a616bc8}, {0x00065442f03906be,0x00054e362be2a14e,0x000dc230c74a019d,0x000861c68ccdfec8,0x00007cfb7e3faf6b}},
+{{0x000a574c28a61e01,0x000b3e8dbc7b7234,0x0008f168798a7ee7,0x00088b034f8cf0b0,0x00002b3666e7c0c6}, {0x000b751ef55c49b3,0x000705e7bcfc26e4,0x0006ab9b3279fe6a,0x000c146fd77b188c,0x0000118efadab67a}, {0x000d28c88d77d774,0x0002137d93c2da8c,0x0001b8ca1c707536,0x000171c51769f519,0x00002158f229f221}},
+{{0x000e9e125732e246,0x0002c2f3f6333e36,0x0005fa6e7f2687df,0x000fa4bbbb46171c,0x00004ebdd42a24b9}, {0x00026b0aac4f233d,0x0006572bde6386b7,0x0006f31b6de8699c,0x0006615f32c2efcc,0x0000688b4ff25739}, {0x000def263bda5af5,0x00059420062b838d,0x00004d13d03759f1,0x00058f534fd281e5,0x00000bc11709c20f}},
+{{0x000e0e0ea4212889,0x0003045685ee781e,0x000dc38b1ce3176f,0x00092bdcb5ec6504,0x00005e2cc9649410}, {0x000d2b4a90ce5d97,0x000b120ddf15eceb,0x00006838a6205533,0x00017ac602a2c03a,0x000022e413812ec9}, {0x0001a56223cf0520,0x0004c0a8f5f4d613,0x00030a0f3d90893c,0x000bb709f4ad92ba,0x00000dc2cebc97c2}},
+{{0x0000c6786bac8112,0x0005c602f7593087,0x000aace887c608c1,0x0005a949bc60b82e,0x000044f42cab0c96}, {0x000e77c3d5b74a0f,0x000613b6a29eb07b,0x0003c86a801867f3,0x000120e160be0ff1,0x00002aff12a714f0}, {0x000620f188e61911,0x0004cca1d5144466,0x00001d4ac1b677e4,0x000f4c89e66c969d,0x00002abcf3c81daf}},
+{{0x0005b0c3c4441e3e,0x000a029eb18f04d3,0x0003d4daded5de3c,0x000bf3103bee451e,0x00004611449a0def}, {0x000c6ff22cc6991a,0x00074a2799b33c8f,0x0003056b66f1184b,0x000523a75c1f2d64,0x0000588b3fc4d461}, {0x0006c764c1666d05,0x000ea7d9f90fcd9b,0x000e1e6ac460f2da,0x00091b13f0e14546,0x000022fff8ad49e3}},
+{{0x00081304f0b819eb,0x0007eab5d320b04f,0x0000fe17ddd5b8b4,0x000e509432a29b60,0x000043d1b06325aa}, {0x0008670a1317924f,0x000e21b457681af4,0x00012eb73f87d805,0x000f3639fb620857,0x000053f366b6c5d5}, {0x000fa5d36dfe108f,0x00016652a2043479,0x000c2727e8593316,0x00039975dbc49cdb,0x00004694282e0b9c}},
+{{0x00041f23278c899d,0x00031e14717e6e22,0x0008463e068b89e2,0x00044927625bcd7b,0x00007bbb7e4070e9}, {0x000d344a5c301db7,0x000bd780fdf59719,0x000b9de5d5f251dc,0x000348c4879da9f7,0x0000251fc669d261}, {0x000a37038cfa0cb5,0x000f4d6e4bcb6945,0x000571afc016495a,0x0001c08b2f6cdee1,0x000044298e8fad79}},
+{{0x000c44850a3e4545,0x000711540a45c911,0x000f6afb54948b09,0x000fe2c1cea6e720,0x00002e8881b4aa14}, {0x00092e73de0517e5,0x0000f3b632932cb2,0x0009be02e0070bec,0x0003493e71795eb9,0x0000724ad40e5382}, {0x000c1b730877c7f3,0x0004dafc65a4b0ec,0x000edbff8d752a31,0x0007bebacb7c618e,0x00003392751462a1}},
+{{0x000cf94408b328e0,0x000c4cf476cf64de,0x000ca6905447485f,0x000ebe1a2d3f5066,0x00007d6a35537b4e}, {0x000b06180e758d48,0x00051c17576333a8,0x0008df531d229c40,0x00042d51fbb282c2,0x00003efe2805193e}, {0x000da4e0b62ccc53,0x000779570eaa9756,0x000088f0a3ba36b9,0x000e9b4d59d78046,0x00007f6e4161ed22}},
+{{0x000d5bdb6a6956e6,0x000289636ee0c3d2,0x00006390c3ba13b7,0x0003ff447d0564db,0x0000663ee8ad0727}, {0x0001984da3255378,0x0007fbb0c2264ff8,0x0001e8bc77819512,0x00007d19bccdd7fe,0x00000df5ab45aea5}, {0x00036c30ef5daa86,0x000b14ef207e3931,0x0004558c735df802,0x000f26b862408c6e,0x000039251771f6ae}},
+{{0x00094f03fe0071b4,0x000c2265c3f52d6a,0x0003279775ac3a02,0x0002a55d8c0f6e3d,0x000073984eb08a1e}, {0x0003a36d70cb1e89,0x00031c06dac0429a,0x0000e483be70fd54,0x0008d8bf34705e3b,0x0000781187bae706}, {0x000ed6e1b3269fa6,0x000c56b602f5709c,0x000cb1d16b515b31,0x0003d88942a0c8a8,0x000040a5a4fea167}},
+{{0x000764bf505de2e7,0x000544574c6e1d0c,0x0008f8cfe6085a40,0x0009f282d2dcd150,0x00003fe32267db37}, {0x0005cc04fd37c214,0x0007cb926c3fb257,0x000c297876fef390,0x000a30cac349ee25,0x0000761c34547928}, {0x0005e45c9f9d6421,0x0006da1d0ed1890e,0x000336af307d943e,0x000a88146472f9aa,0x00004106fa9caf38}},
+{{0x000b4a91567de5eb,0x00042b0199a4f0f1,0x0003b4781023ab92,0x0003e4c38d44cbe4,0x000030faa24965ab}, {0x00048005211ec48f,0x00027b973368b609,0x000683e3aea18dc3,0x0008edf9c650092c,0x000075d1aeac90b5}, {0x0007ee0d4a44f939,0x000eb53595a84464,0x00050da4ead6b5ed,0x000eea90f78b9a0b,0x0000046acc8e00de}},
+{{0x000c790a13eb003e,0x00050a3fb9ec674a,0x000c0e1a20d61f00,0x000d6255082ab630,0x00001f4501860931}, {0x00097534414e7dac,0x000a15169bb74cff,0x00092f03822f4123,0x000ac9828ac859dc,0x0000476c66626708}, {0x000df39522a78fcf,0x000e5b30508d66c0,0x0006c7c4d151f666,0x000f0c0bb5805d90,0x00007046bd680dc6}},
+{{0x000e7f8d4b8e62a1,0x000f0758631f3000,0x000af136e3c9bbf7,0x000267245ff875cf,0x000032faaf082158}, {0x000303ff13bf8173,0x00004561b8be65e0,0x000c4326b08c28aa,0x0000cfc5d66163bd,0x00003acf98164bb6}, {0x00060e1fc1127f3a,0x000c5fc126d7b065,0x000cf5f6ecf38275,0x00018ae9b63e2301,0x0000137250c7632d}},
+{{0x00032fed6b46ea69,0x0008b53b80d7c3f6,0x000a926edbdc016a,0x000de48e6eba1898,0x0000508c9980cdab}, {0x000c97aafb2feb6b,0x00033acfabf83fa6,0x00078cf93b97ab72,0x0005df5f742577ef,0x00006b98a85b957a}, {0x000a5d04caf3fe7e,0x000d19a112f33e5d,0x0008ff4badaa057a,0x000ae48558714538,0x000015b124144c89}},
+{{0x000df9576bd8c0a6,0x0005fee9d1651872,0x000ee920c90c79a7,0x00014071a6ec4048,0x00006acf0289d9cc}, {0x000fdf1a92814f71,0x000679d0f20c2f41,0x00042d901f920d86,0x00074edb20fc4eb3,0x0000281cf3d1ee8c}, {0x000ae23b05f7c1c1,0x000ab7598dbdefc3,0x0000f00c57bc6abb,0x0007e53116ddb528,0x0000668930640434}},
+{{0x000d6141dcc5028d,0x00049b04a1ac4cd3,0x000d85e9e7f9287c,0x000b1bf229e007eb,0x000007d6b62833f9}, {0x00094464b17eaf63,0x000884940b89a040,0x000ca447982cec97,0x000e7c35f99de53d,0x00003415454fffea}, {0x0009105487dbbbcc,0x000dae2119117c24,0x0000c83f06296436,0x000aad3444300ab0,0x000077184804ce51}},
+{{0x0009e4b8dd3a45e5,0x000c80a1d45a42ff,0x00000bf6efb188ae,0x000a12dfe6ec6610,0x000072c8471ad65e}, {0x0003ce3bd8b2b9a5,0x000816e04ce28576,0x00067f7089ae3142,0x0003f31b553865b5,0x00000fe9da939ef7}, {0x0008c0881925c03c,0x0005b4eaf6b6e2bc,0x000515b442d59543,0x00071b129860c16c,0x00003f07eb192fed}},
+{{0x00035b58cd14178f,0x00068ba63df31ea4,0x0004b2e5d07a725c,0x00030918adebdc73,0x000072b154a7bd9e}, {0x000dbc71999a6616,0x0002e263a6e9b53e,0x000e3e12ef5fbb66,0x00061bd0fedddcb2,0x00006e020a6ffbb5}, {0x0003e1975702dba8,0x000baa532d76ac76,0x0004e3e812c43fa6,0x00042c87825e7a23,0x0000613bee8fe143}},
+{{0x000639dfac161154,0x000d423f34253e13,0x000436e6f0b6c036,0x000b44cee01d1e63,0x00006ad11d6d060c}, {0x000997f51b234422,0x000925a4a854da07,0x000ff3e67adf0d86,0x000e5a2d6f562b00,0x00003a9ac90ba504}, {0x0002b3e4bf35d4f9,0x000985f3862ef6b3,0x000826bb3a9ecc39,0x0000222847560eac,0x000006f2d2122696}},
+{{0x00065f7d38cb7f50,0x0003fdc48b638864,0x0000e701fa101d58,0x000c87c2d6cb2b6e,0x00007c2dfeb15671}, {0x00023256aec2fc4c,0x000a2b9b3f67a466,0x0005f462582feb3d,0x000700f5219f95d7,0x00005c16ac55f44b}, {0x00080b5ffb2e64b2,0x000b315035245788,0x000b52ff9c419d78,0x000d28b3ff672379,0x00007661f170e0d8}},
+{{0x0005f52dcb8027aa,0x00014eaa3793fe89,0x00031eb22f4b8f65,0x000600588c3c5398,0x00007cbe25259fb0}, {0x000724ce5b4168b4,0x0009c64404ecee86,0x0006be4f1a44ceb0,0x000636bb77b31d71,0x000046dd3702d36a}, {0x000f8903100e902e,0x0000faea8957d156,0x0002bb806393fbe3,0x000b824e95e5963d,0x0000572b81c6a66e}},
+{{0x000e76327c810f3a,0x0009742aab366846,0x00005b2db2703290,0x0000a0e1ef2a7b61,0x00003774b60646ad}, {0x0001e71866fb354e,0x000f16591a597106,0x00009f6d9a2fdbe6,0x000dc51dd90b5651,0x00007956bf34bdd7}, {0x000a27f74c1135a0,0x0007c85539321c80,0x0005827b65f6d07d,0x00063c14c2405b5e,0x00000480c57fa85f}},
+{{0x000ac6bde0097fd6,0x0008ff76e96192a0,0x000e59568f608162,0x0005406c7df4ae14,0x0000399dd2bfc3ad}, {0x000157e9f1c4cab2,0x0005bc35a1c1f768,0x00036f74bda9c085,0x000f93623f62b826,0x000057a9804c475a}, {0x000f2d76e9cee1a6,0x00017fe0597ea425,0x00064bcc1365ad5a,0x000e30501649c6b1,0x000070ab214e6e8e}},
+{{0x000c48b2aeabd3e3,0x0003cb097f66864c,0x000cdb58e1ce9fd1,0x0004aab3ef7c5814,0x00000fffa4dd16d4}, {0x000661129dda33ec,0x0008f32a4e36e36b,0x00050cc597a97832,0x0006ec481b904035,0x000053fbda2df6c6}, {0x00023a9555fcdefa,0x000eb2cdab53741c,0x000c0ef3b0f2318f,0x0007f507661b74eb,0x000009f2452add67}},
+{{0x000f293414f3d989,0x000df8f9a1e7e9e7,0x00059017fa580330,0x00062c2e77474275,0x00005a91b7a68c36}, {0x00009705dcec289d,0x000f34e9aeac4e0f,0x00032a11615d6aca,0x0002c8d19b59541d,0x000011b106979031}, {0x00003698004d925d,0x000705cdd3720a83,0x000ff1b59d106ef3,0x0003e34b3b835b97,0x0000642fa4b68b47}},
+{{0x000a4a6723ba62b9,0x0006c1cfc9ba7499,0x000b50a89c0efb75,0x000e5b9512740e64,0x00001ab7dcc2e3dd}, {0x000a4090217b5ea0,0x000074d8b1b605cc,0x000733fe2e5448ca,0x000f1846062f4cba,0x000067f38c058fd5}, {0x000ccba56e6a60f7,0x00075bc5c15eb317,0x000ec193b7d92daf,0x0004fd31f7998646,0x00003a3ac023f28f}},
+{{0x000280e96ddc203e,0x00088352d7407a54,0x000f42f9291cc46c,0x0005a89a204241b9,0x00006ba48e5a5a39}, {0x0003179deac05186,0x000db35cce4b4440,0x00062e829b5a9082,0x000bae00e6b4f4e8,0x000020684a08f5f2}, {0x000cf7235b7686b0,0x0002740586447c22,0x000aef51d7aca172,0x0000a99d3fde849b,0x000008d193847271}},
+{{0x000fc9bff4dbb75d,0x00085ec2e4095b30,0x000c73ce6cd4e38d,0x0008d235b4c253ba,0x000038488e3b0db9}, {0x000c8d1980a53843,0x0005c356ebf432c8,0x0002556e2c01ccb9,0x000bc6a53ee71e49,0x0000465693ec6c3d}, {0x000d7cdff52a4875,0x0000281590f8a45a,0x000ebaedd9f003a6,0x000523688a76c15b,0x000029fbdd6d0edd}},
+{{0x000830b6d4bb552d,0x0009ae5732abfaeb,0x000f28f8690e197d,0x0000eb5e8ff14d41,0x000009dbe4b1f1f5}, {0x00082fc9bbbac2e3,0x000b4236546d79f9,0x00012be85cf3287f,0x0001aa0b2b1fc26c,0x00005439c093d1d3}, {0x000d6d4fddbc3e0b,0x0007630145e7c48a,0x0006b4153303a7bf,0x0001c289a10793d0,0x000023955c6b8bf3}},
+{{0x0007974e8c58aedc,0x000fbabf041a4463,0x000980718ab9ef22,0x000a8a6e185d956e,0x00002f1b78fab143}, {0x000ebffb305b2f51,0x000ad889596b896e,0x0006d5dd25d3f938,0x0000095f0f52dc74,0x000057968290bb3a}, {0x000ab8430a20e101,0x0008d24f0ec47f71,0x000ee2eed1f39365,0x000a3e1cf7509a86,0x00007dc43e35dc2a}},
+},
+{ /* slot=12 [{1,2,3,..,64} * 128^(2*12)] * G) */
+{{0x0003c1a2bca4283d,0x00091a1863dd9781,0x000268fa86ed62f0,0x000ae4caec7bcb8c,0x000010e5d3b76f1c}, {0x000c6fb6e4e0f177,0x00029a4bd6a932db,0x00087af6e804e1bf,0x000d0605e1966d47,0x00000edc5f5eb426}, {0x0003bfd653da8e67,0x000ec24a9f641545,0x0003578a23e9dc1e,0x000ba72bf87263b0,0x000045b46c51361c}},
+{{0x00002abf314f7fa1,0x000dc8e8cf450a94,0x0003a8be84e257f1,0x000713b1dbbd54b2,0x00002177bfa36dcb}, {0x000d4ddd8a7fe3e4,0x0005676620e30ce9,0x00030e9958ab1364,0x00029df4b594f7bb,0x00005c1c0aef3212}, {0x00081bbcfa79db8f,0x0001ec25f59b3370,0x000c832487604881,0x000b5bb087a76659,0x00004ae619387d8a}},
+{{0x000bf6aa5344a32e,0x000b4b41b40788dd,0x000a130d607d88ea,0x0003e035eb0eb974,0x00001a00d91b17bf}, {0x00017e44985bfb83,0x0002a71963136611,0x000425904bfce046,0x0003d6483ac3448d,0x000075685abe5ba4}, {0x00060933eb61f2b2,0x000a8c9ff49526e9,0x000af66569543d0f,0x000e6aadf7275107,0x0000135529b623b0}},
+{{0x0000dbd7add1d518,0x00088cfc11f1118f,0x000114759b979f78,0x0003a018732e1f07,0x000079b5b81a65ca}, {0x000716bce22e83fe,0x00019e80985c1f5c,0x0004254aaeb42beb,0x000a613ec9da6371,0x00005972ea051590}, {0x0004ac20dc8f7811,0x00094ac4d4fa80fd,0x00033604349a9ad2,0x0003bdbc01b2d64b,0x00004f7e9c95905f}},
+{{0x00074bbc5781302e,0x0003989addc0f626,0x0003fbd9c6d8520f,0x0008e4c8c2999ae5,0x000031993ad92e63}, {0x0008443d355299fe,0x0001cdbebead771c,0x0001a494668bcd3b,0x000adc88092499ef,0x00001942eec4a144}, {0x000c5319ae234992,0x000910cea3e927da,0x00053c11222c1b3d,0x000ca75553ce4942,0x00002a0a65314ef9}},
+{{0x0007937ff7f927c2,0x0000617d0a6352db,0x000155af76db741f,0x0002ded5982f3a21,0x00004cf6e218647c}, {0x00061acd3c1c793a,0x000ac5a35bc3bcf3,0x0008cda6ab2f9ebc,0x0001a1360e860e9a,0x0000055dc39b6dea}, {0x0009227cc28d5bb6,0x000bc774dffabb11,0x0004a32c8907e24e,0x00024b6a83c78cee,0x0000121a307710aa}},
+{{0x000b5d5e9f034a97,0x000093034bc2de4d,0x000551d3b1e153fc,0x000e52d460546919,0x0000333fc76c7a40}, {0x0009713ec77483c9,0x00077b82b96afd65,0x000097bcd388bfe0,0x0003a9b289e28231,0x0000527bb94a6ced}, {0x000d992a995b482e,0x0007c6e383801563,0x000f64d8e53405d0,0x000a9f7485035de2,0x00006b89069b20a7}},
+{{0x000aa0416270220d,0x000faf9245b4e812,0x000072ef05995a89,0x000eb73ffadc4ce5,0x000023bc2103aa73}, {0x0002fa8cb5c7db77,0x000f8c734c155408,0x0006e7a57e068686,0x0009bcf29e6c8d9f,0x00000473d308a763}, {0x000e792603589e05,0x0001246dcc492cae,0x000601a94f2b4b42,0x000341a02a1ef74e,0x0000102f73bfde04}},
+{{0x0005593d553df3d5,0x000b5f2482069a99,0x0009808d1da01d7d,0x000739b8f096fdbf,0x00006efba66f963b}, {0x000ab809660078f6,0x00077c67dd5f338b,0x0006e4ef4f69c7ab,0x00073f3960111bba,0x00001d680f3fc38d}, {0x00035dbfcd04e0d9,0x000eabacb06f9568,0x000ebe1e6a4f0675,0x0000e63e41ab47b9,0x0000559c02f0ac92}},
+{{0x000e2ab4bf8467b1,0x000f7d9a83a10c56,0x00081764baa1528d,0x0000c996fa5fbd41,0x000048126b174c50}, {0x0002ce6131c554aa,0x000a2ab18bf3b4c5,0x000f04eba0b96ef6,0x0007a299a99a4b41,0x000000b0a50c42e3}, {0x0000f8352a5be441,0x00010a0d959a6d48,0x000a5520f88278f1,0x000b770f4543ce03,0x00001a85b2b3f938}},
+{{0x000808d3e592dc72,0x000698b9699be621,0x00053962d07b6072,0x000336c50e2ed0d4,0x00004cc7b3d8eaeb}, {0x0000d845f792604d,0x000d188530b963f5,0x000a5b484e6d4668,0x000d5876d81b8755,0x0000249f252da35a}, {0x00003dd083197e17,0x000a06b6158f8728,0x000f45fa3c00a177,0x0002d8d9255fe2f5,0x00003965be6b7db6}},
+{{0x00088bfeb5fbf396,0x000722bab6fae620,0x000878256323244c,0x000fdd1862717dd8,0x000003237aa33c2a}, {0x000356ea2096bada,0x000af413dbf558c7,0x00036b53dca7d363,0x000e5ccfec73d8f1,0x00007790288af7a9}, {0x000059999f6e34eb,0x000387a053d1bbce,0x000618f8b2edcbf8,0x00041c588cea08ce,0x00003163fa98d0cf}},
+{{0x00002ba12e6fb61d,0x000c8c01c7a8d10a,0x0009409f5212633e,0x00084523afec98f9,0x000056a0de118e80}, {0x000f1b05c369e585,0x0006b6a59ebe7111,0x00074201a4f40759,0x000e280b12331701,0x00001cf79771a39a}, {0x000dd6258ee90b22,0x0003022db8596bc4,0x00027baafba21ccb,0x0008735d2278b6e5,0x000071bd6a4a2a8f}},
+{{0x000bf45a386cb214,0x000b41b9c063dc08,0x0006c29ad7055f36,0x0004d9dd96f4b299,0x000052b7bdbcae03}, {0x0002d2a6af827b1b,0x000dd627450e17fc,0x000f45c2ceeb69b8,0x00094047472d8bbd,0x000054810835ed45}, {0x000ef2f8e990635b,0x0007c6363579bd05,0x000da929ecb53eff,0x0000ca4c157578b9,0x00007ffc5cf37baa}},
+{{0x000332654bbac18c,0x0007baddea6f31da,0x000ff375df45886d,0x0007ddf118773c3c,0x00003cb3dc9a52ee}, {0x000413d0b392a36f,0x000fe103fe8a1138,0x000b5188cc21dc27,0x000f8b1503591812,0x00005e2de8347dac}, {0x0003873a0f4536c8,0x000814bbb50c2dc1,0x000f163dd1810d6c,0x0003db8b0123ec96,0x00004fc005162dc4}},
+{{0x0002d50c7ec20d3e,0x0006ea0c97263b5a,0x0001ff734dc64bdd,0x000faba56e89052c,0x00004929c6f72b2f}, {0x000ecba293a36247,0x00062b268fd65358,0x0008a01c89af8f98,0x0004524412f7e996,0x00005786f312cd75}, {0x000788ffca14032c,0x00028447f1ee3337,0x00031bccadf39210,0x00047838b14071f2,0x00004c817b4bf234}},
+{{0x000dd9a7ea2bb416,0x0001d1ba1909a28c,0x000719ed8e331076,0x00064bc293f4992d,0x000060abc5b3194f}, {0x0007140c4ff8cb4b,0x000206ecfb035ced,0x000f25635a1933f2,0x0005850dc50cdf27,0x00003b6437eec375}, {0x00084286590f032f,0x0009c1ae04f25fdf,0x000e54854c9f9399,0x000663474f44cec6,0x00005e5935749e0e}},
+{{0x000bfac21ae390e3,0x000f2582ee0948c5,0x00001659e6255b0b,0x00008843f004ad9c,0x00004bb71f82b796}, {0x000600926ac9f32c,0x000428f8adfef9dd,0x000873ac470d558d,0x000e19723b4acc79,0x000045c237189f34}, {0x0001d78b2dec06a4,0x000e4f20fef72fa4,0x000681b32a26849f,0x0006691e87a5a243,0x00007973667a390c}},
+{{0x000e448eadef2476,0x0003b1f30d78a306,0x0002771ab6434cab,0x00050ec66ada0faf,0x000064c33dd7500c}, {0x000e7e3823ced76e,0x00078e0856661495,0x000ecc71294c3915,0x000710c2bee4d328,0x0000677569121e02}, {0x0003b2ab2c6b0c1a,0x0009f5bb9134cbab,0x000f22e53aa86174,0x0008b7ee1c9b4ebe,0x00002ff5cba9ab2e}},
+{{0x000634c709324e2a,0x000d380135df8a1b,0x0009d08c1b9ee4e9,0x000a6e782b7d7de2,0x000005ee0540cc55}, {0x0000e71f5469a9f9,0x0002b95ae6f926e0,0x000a908b298ed8d6,0x000481f89e6d6238,0x0000795a20df8375}, {0x000b076211194906,0x000b26b1e7eefd76,0x000619339eca4093,0x0005fdb71e914304,0x000013d7e950472d}},
+{{0x000afae1561d67a0,0x000c06cb64712ff8,0x00084b721908a921,0x000058a07184aadd,0x00001993c62d9cdb}, {0x000046cebb5c2484,0x0002a25761352641,0x000a95262105dc0d,0x000df39338dbce7f,0x00007d5cb2570cbf}, {0x000d4a5ffc824eaa,0x000e049ee92a52cc,0x0008808082633e73,0x0007a1a17f79b9c9,0x0000186625b853f2}},
+{{0x00087e634bff79d2,0x0009c70e08d24376,0x000e3d4e886b2bf0,0x0000c9b8f3e4a613,0x00001b5cc060c719}, {0x000a08ddb9503a12,0x000b7adb13df5777,0x0005b89143c502a6,0x000144860dbc5185,0x000042c1e9bd2e84}, {0x0009908b455c2f42,0x0004eae7b2779052,0x000923c7038d7fb4,0x0000a40a0eeb53a6,0x00001b1ccd090a49}},
+{{0x00046a07e40eade2,0x0003c8d062e798a3,0x0002115c3493a3b0,0x000acb0307d99ee7,0x000051315b5fcd77}, {0x0004a1de98c7b4ff,0x000bded909e07503,0x0003ae853be0a1cb,0x000947c4198fe02d,0x0000307cfd354285}, {0x00098bb9386ecb47,0x00089b16d7eeef0d,0x000d213bc4feb8dc,0x000eee448a430fc5,0x0000664d5464c0e3}},
+{{0x0002cd2b37386683,0x0009ce4694fb6278,0x000ae11d7c08ac60,0x0001963665b49b25,0x0000301f5f7cb503}, {0x0002d21e57196c45,0x00079747b796bcad,0x000f89de69392d76,0x000793150a3516f0,0x00002f2430fabcc5}, {0x0000648c9a834429,0x00053ed56ac0b135,0x0000d782cd76b3cc,0x0005727dfe89804f,0x00007c4d328a72a9}},
+{{0x0006dc0b06bc55e7,0x0009f3777d686821,0x000d57e315e692c7,0x0006c43798abfb90,0x000035cba6d8b877}, {0x000bfba138ae82bc,0x0009a5be694f284b,0x000b4daa7e1f236e,0x000368bb5572aa23,0x00001fcf530fe364}, {0x0006073da9186af8,0x000090659e3b5db3,0x000205c719d96705,0x0005ed1f0f0c5bfd,0x000060f50e8fd26b}},
+{{0x000ceb1fcc5ecafd,0x00009f0bdefac109,0x000a4399e9d39a60,0x00055d144ff5b2c7,0x00003e4851b40e7f}, {0x000d3361a83b70eb,0x0006a87a10ec9f0f,0x000edfa7ee45e6ba,0x000c8a88fb4dfc0a,0x00004d8eef0ae790}, {0x000e1f75e6789140,0x000e1c970d90b842,0x000e03e394fab7e8,0x000d4c21256e0979,0x00006670c1f9d1e3}},
+{{0x00087d840e4e4f71,0x00003308e91a0f25,0x000fc891c5f098f8,0x0002a50d6413fbcf,0x0000032ea8130fdd}, {0x000ef1747a44fa11,0x0007eafc28f2e540,0x000e7fc398cd1b0a,0x000b688e79c7f544,0x00007e4a35595e82}, {0x000bc79c464ed11a,0x0001ee78c405a6f9,0x0002a1e3c326e2ca,0x0001df56853b516e,0x000027ce113be711}},
+{{0x00055e79db8b98c1,0x00063529c219232e,0x000ed6007fc88813,0x000f6084c9f4cd9d,0x000064a3cda34a69}, {0x0002d88c45668fc7,0x000f7138a60c0f15,0x0004ccec1a27889c,0x0008db678ed9edfb,0x000017582fa5b44b}, {0x000e3bd46639b89a,0x0007d3c119a1c0c6,0x0003c9630538baa0,0x0009dff54f70fc6f,0x00005235d0af34d9}},
+{{0x000db8ec899cf03a,0x0003ad3d2c19a029,0x000385fdc5e4bbb7,0x000a3741d03fa898,0x00007a5dc3cd1890}, {0x0005a3dba26aa0ee,0x000c9d868c2c5931,0x0008ece49e118833,0x00072c069c20dc50,0x000041273efe18ff}, {0x000ec623d2407132,0x0008181b75fefc18,0x000e85d620d8ceaa,0x000411384f5dd2ed,0x0000719807c5b769}},
+{{0x0006d0d8dc118efb,0x00039a3648fcaad7,0x000311b0a6f65f3d,0x0002eeac94e15dee,0x0000415693e308cc}, {0x00073fc09f114c42,0x000d1d2a489cc1e9,0x000fcbf7505e630e,0x00051b718ab8b6b7,0x0000264de442de86}, {0x000934e6a8421178,0x000ef8779b2b5635,0x000d56de27b01b6d,0x000076179810ccd3,0x0000781ae16baa3c}},
+{{0x000fef81dc5edd71,0x00056f956825ad1a,0x000658d67982ed6d,0x0005626d5fa69c3e,0x00005ba543accc2a}, {0x000eb177f81f4e33,0x000fe6fd6cba39b5,0x000d830c50a6991d,0x000d89c6db266e85,0x000055ac20978c22}, {0x00072130830474c4,0x0004f0c28b63ab00,0x000d28cabea843d6,0x000644be65780b1f,0x00002ffd768b3b8b}},
+{{0x000853852871b96e,0x000ab60c3f1bb0ff,0x0005344402e13e9f,0x000744beefd59532,0x00000a37c37075b7}, {0x000ba057a40b4484,0x0001a4f5f6a43413,0x000ee1d61cba4c2e,0x000dc53614ba0a5a,0x000078a1531a8b05}, {0x000df1703ad0562b,0x00030c92521a36cb,0x000d8424e78ecf48,0x000c56fdaebd303f,0x000072ad82a42e5e}},
+{{0x000055fa55a814f4,0x00038a48d0f2eda0,0x00006736f31e79b4,0x000fb9f4a67f00e8,0x000054e3d62f6a11}, {0x000678c4d79f10df,0x00093f800385e504,0x0001a77672d2d45c,0x00052663ab35911d,0x00004fc9437e86c6}, {0x000edae8ffbd9731,0x000da3a82ff11c96,0x000cdcd3a0579c0c,0x000fce3fa4129efe,0x0000604d578859c4}},
+{{0x0000d49714d6bbda,0x000431a58a511500,0x00020324251cd1af,0x000df3918078f5b0,0x000034740cd04aaf}, {0x000311f6367f2ef2,0x000ea023a7233436,0x0001d9ab156b918b,0x0009cb15c4ae0aca,0x00007e64669c8858}, {0x00070e6b68f5235e,0x000d114a4d920f74,0x000cf63301733a84,0x000c3409809f352a,0x000017e3b935acdb}},
+{{0x000c07f04912f6c8,0x000fb325a24c99b4,0x00033008b1d5b177,0x0007356c6a5f4328,0x000052d70ca9ad16}, {0x0008b3237f6dcdf1,0x000ca14b5bf3c326,0x000992302b4c24da,0x000c249c3f2214b7,0x00003b8285069ea1}, {0x0001cc83dfde7d2a,0x00077a3220d4fb06,0x0008483163d41cbd,0x000e4a8a89946845,0x00004cf7af44f34f}},
+{{0x00021b16443306fc,0x0008107d6f70489d,0x00044457ad93bfdc,0x00087cb73793da6a,0x0000437c9e4a6eb9}, {0x0002b02532d8cc87,0x000389ab405e4137,0x00073845e6a9c36b,0x0001bd5efde7d424,0x00006fe0d1844064}, {0x000c03ac8e09965e,0x0000347ba73543bb,0x000b75a5fd530cc0,0x000b7840f54d972e,0x000045180463b582}},
+{{0x0006581d7f0043cd,0x000f3a20fa1c01fe,0x00011c8634ac48c9,0x000cecaffa68c240,0x000075be8cfade62}, {0x000af7c9fced7314,0x000136352b49261c,0x000df412c27985d6,0x0003531d71621c9d,0x0000531ba7790def}, {0x0008bd592790cbda,0x00014dd0f35875ae,0x0005aeaba0659ac2,0x000deaf757ecfce6,0x000022db53109add}},
+{{0x00096cb2cbce3b89,0x000c5d1f91f8f458,0x0000a8c96a530d97,0x00006a9084813ee9,0x0000492b45526687}, {0x000df64166d35fcb,0x00036be025ad9a04,0x0002ced363a5210e,0x00088b32bee19661,0x00004705c10b3c80}, {0x000ef28955fd173a,0x000bec42ffcc9161,0x000ce92bfb5d4b9b,0x000b1c3dd5ef53f1,0x00004bcd8017d086}},
+{{0x000af9720077b32d,0x000c779cb9fa4c55,0x000a61d2a4bdb2d6,0x00020fc9ad0301ba,0x00000e9bebc2d0e0}, {0x000afa4b444155fd,0x000f06ab163adfaf,0x00062e3bd4c9f64e,0x000f4c82860c6eea,0x0000663a704b1901}, {0x000ae3287ce2d484,0x0003dc8a64bc2bab,0x000851dc7cccaf35,0x0008b54e82711872,0x00002b9b4727ca3c}},
+{{0x0009ce067d1426db,0x000fe07a2870613b,0x00021b5e314feef1,0x000b13f367abaa3d,0x0000247a60a5863b}, {0x00037a89fafb0f48,0x000d6352de2bc855,0x000dd29ec9ab2189,0x000347385e907b2c,0x0000524091d862d9}, {0x000461f1322f4867,0x0001b7adc599f436,0x0000f08e4cc4b29e,0x00056dff6baf7943,0x0000503faebb1a47}},
+{{0x00091e394fb228c1,0x000911963e6070f7,0x000673c66328acfa,0x000394e7bf52d54e,0x00003e37a16c0b8f}, {0x000d7638875923c7,0x0007df8670ec4241,0x0007af392fb964be,0x000ce8581160eafe,0x0000528a38250384}, {0x00094c3a088377c3,0x000347dbd7f632fc,0x000b3426a64ce748,0x00012c87194da6a6,0x0000682f4a19d26e}},
+{{0x0006d2e7c7703460,0x0009964ab37064be,0x00094172eb928ebb,0x00077f0074e2e4ef,0x00007eadc0a43c41}, {0x00082a9b89850eca,0x000823b02b1c923d,0x0006d679f57992e7,0x000beafd88331205,0x00007f1ebe32e9f8}, {0x000d19a3bf2ce5b7,0x000d1bd801b7464e,0x000eaea635a53a35,0x000508c634526264,0x000032d1812c7782}},
+{{0x000cdeb4952b8f40,0x000b3e166f2a10d1,0x000b7668e16d0fb6,0x00019e38802b5113,0x000058c1e1b77a9a}, {0x0008801d92ca912e,0x00017715ec1f3a4a,0x000a87f0ea0ed388,0x000445f0e38019c6,0x00004259f61fd3cc}, {0x000983dc716cce1c,0x0009aa90e5bab973,0x0000daa9b9a5cb2d,0x00056c447bca96af,0x00007f4a6dbff082}},
+{{0x000c3a71e0cf3bac,0x0007effd051271f6,0x000e44ff066bc17a,0x000b2effcd1ade7b,0x00007c1ea80190e6}, {0x00063e9e98838920,0x0005373ee8ff95a9,0x00012581cd1b09ba,0x000792e6a3e6d574,0x0000181e8925884f}, {0x00067ac41941ab5f,0x0004361aaacd56ec,0x0003c6139b2915a0,0x000ea94212215a80,0x0000718a012af501}},
+{{0x000799fc4cbc4e7c,0x000e02adbdc01f5e,0x00085a81aa256129,0x00069067ad724942,0x00007e3b2e58766b}, {0x000448afb132864d,0x0005fc25d225068f,0x000efa38cf4d8d83,0x0006acd75591dc65,0x00000d520115766a}, {0x0003d0a385c4fcee,0x000e20078ec03487,0x000f6e0b47208c62,0x000d033c69a20d46,0x000037284b6586df}},
+{{0x000e45757be9a40c,0x000e5afeb34d027d,0x0007755ba91721cb,0x0001b7ceeb95ab50,0x0000651d8f61556d}, {0x000a40e46cb086ce,0x0004877f7b73b146,0x000f3ddcb6edfb9f,0x000b71bddafaca7a,0x00000d5d814401c5}, {0x000c6ae47ee73b8f,0x0006a602bb06ee93,0x000161a574808af7,0x0001d6145a8bbcaf,0x00004e885f349aa1}},
+{{0x0006fe50360bb601,0x000bfc03cbfbc965,0x000e519dd671d30f,0x00064eae897e0c18,0x00002f490862a5cb}, {0x000f0ef3544f4f4c,0x00076fd5ff729c07,0x000e12ca9af076e8,0x0007111dc8b31ba7,0x0000156a2ebe95cc}, {0x000bc23706be6143,0x000068ca04d7645d,0x00083f1fed12834d,0x000022d5e3c1feea,0x00003fd3c3049751}},
+{{0x000e8e35bafb65f6,0x000c8f27293a13f9,0x000cf6a3d039d69e,0x000ae6d6cb8cd958,0x00001734778173ad}, {0x0008939167024bc3,0x0006d49502fdac36,0x00045f4b298e69d1,0x000cbc4fcf2ec3ce,0x0000065f669ea3b4}, {0x0000aec75532db4d,0x000e443e31bb18a0,0x0003a7f515b869a4,0x0007c084a0f8552d,0x000019adeb7c303d}},
+{{0x0000324faa1fbbf5,0x000eb3dccd6d227d,0x00086d586ea01dcd,0x0008b222b1654c74,0x0000187a1a089998}, {0x0005cb0cf8472b12,0x0009d749de17ee0b,0x00005cb990fb90f4,0x000538a36b9577b8,0x00004e29d5e03ffc}, {0x0004323134686e62,0x00008106c84f2667,0x00067ed4f2caad9f,0x00062ffcb96ada5b,0x00006b180d870fae}},
+{{0x000e9e310927a295,0x00073c3717432f81,0x00017471a4426d19,0x000c575dcf43e480,0x0000655b0574c1d3}, {0x00094d06b2621c93,0x0007b7d3fbf61bec,0x0006613f1808f72c,0x000572a0614278ad,0x00003d548cecd558}, {0x000885156f07ced9,0x000ccaeed9337117,0x0008df1b25206514,0x0008ed33ff440dd1,0x00001c19f41e142b}},
+{{0x000966926e5965c2,0x00059ee468c134ca,0x000c752b4842fc8d,0x0004a9008ee733ea,0x000014d5f5d3ce89}, {0x000779d4a3c7f28d,0x000526529f2d32e0,0x000c8d01807c3f89,0x000203db8814a7ed,0x000047d10fb64c33}, {0x000b0459674cceb9,0x0000d28346611527,0x0008609514c09b17,0x00074148e332f230,0x00005ce958127dd9}},
+{{0x00098b24e5b9ca38,0x00007bd7d5048559,0x000e77ac74fea772,0x000e6efeeb53fd08,0x000029d472d4b890}, {0x000edfd1a4faef4b,0x0004b08f74d31b77,0x000b289ae6902da3,0x0000addf78d46a33,0x0000552bb35dc938}, {0x0001bac9f8348cca,0x0000784c364dd0cf,0x00059e498edaf3ea,0x00021b0fa88fd2d2,0x00005f63aeddc982}},
+{{0x00058609ca5b79cb,0x000e9bffb8ff6261,0x00031b5d92bf0729,0x0004e0c5b4c8ac0b,0x00004380b99d21d5}, {0x000062b927cbf74c,0x00074467798c11b2,0x000ba986a53ab5c5,0x0008f6caed1acafe,0x0000694f4e76cd3f}, {0x0000d45b71051807,0x000996bd723e70c9,0x000c3983baa40449,0x000f77951a76f1d8,0x00000452794585c6}},
+{{0x0004e16593c6c08a,0x000a98f2d513ba45,0x000c97a60af43bf6,0x000413eeffa9fa6f,0x00005afa27927a78}, {0x000834b4d9de8820,0x00057fe5678371dc,0x000f0661ce754d88,0x00048e1ee843a910,0x00004f8a19fd5b77}, {0x000248019c6587cc,0x00012deae0dd4c38,0x0006f5a578228216,0x000e884e3f19f287,0x00006ce11bde8aad}},
+{{0x0008c0b2577a58ba,0x00057a74f85261a1,0x000b5401ef62098f,0x0006255961e3ea39,0x00003dff205ba0a4}, {0x0003bce3ffc38dd1,0x00045afe9d79db6c,0x000c550d2a3faaed,0x000d0eb596ff8bc2,0x00004aa372557ec0}, {0x0008a50d7b9496f8,0x000e2495e2a6664d,0x000855e54ff4532d,0x00079aefba22ea11,0x0000100367c18278}},
+{{0x00046ce3a63ff1cc,0x0009dfe3b7e0fdcb,0x0001fe7cf90ebe0f,0x00031255512b6ed8,0x00003dff10e54446}, {0x000fae74735962a5,0x0002fa1fa8d863dd,0x0008634a3bf1cf1f,0x000425d40101c75f,0x000059337b0d843e}, {0x0001a0abd3f73907,0x0009ab62962896c1,0x000dffabd70b07db,0x00053158f305c3a2,0x00001340dd1dcb08}},
+{{0x000d80b004b2696a,0x0000675f1ef466af,0x0007bb2b499c1e13,0x000ca7dcaa51e341,0x000006d3cc7603f8}, {0x0004ef4970add87d,0x0001e553de0fb996,0x0002b7a7eddf5c52,0x0009793681d3f865,0x00004eff604cd40a}, {0x000081af8ee2b2e2,0x00051c429243a7e6,0x0000d0eb4d564116,0x000092ee5766adc1,0x0000060cfedb68d3}},
+{{0x000486edfa46e5d3,0x0000c67d16046bd4,0x0002393ea1f22676,0x000f63e2ed8501c6,0x0000679d37f1a69d}, {0x000cdd5c005bf3bb,0x000a5b21f8f00702,0x000a7b6f6883cfc4,0x000c6c73789888d1,0x0000031e331d3e06}, {0x0001d6af5097da41,0x000025f3db6cac85,0x00052bfb59f18d46,0x00075652da3103e9,0x0000676dc3b54686}},
+{{0x000b9b255b1ddb68,0x000d74f708fc83ee,0x00087bae875c5832,0x00066bb374706159,0x00003f234dfb3b3b}, {0x00047eb06580adad,0x000d9d71cbd45597,0x0006de3959bdea7b,0x000ce6145d1062d7,0x00002fb7b8166f46}, {0x0000eb59e2e2d1be,0x00091b28e099cd36,0x000d63ef8378f0c2,0x0000099e80aabe1e,0x00002f5b77f8ef5f}},
+{{0x000bed212869fd19,0x0007bf273e709db4,0x0003f7e078868917,0x000cd7c6747a04c1,0x00005abe0ed72a1b}, {0x000f4df01490b336,0x000ae2f388e6ca33,0x00031b3a07920935,0x000f18322f3c2d79,0x00006fae7b34c346}, {0x000a694c2d7ff4af,0x00081a4605a1eb6e,0x0003b5d54849df3b,0x00089b72766b7c44,0x0000495a3c5a0c15}},
+{{0x0001829fc3e5b25c,0x000cde932fec3dbd,0x00048b8d4dcbeb06,0x0002ec95ee343a2b,0x00007848dc2d1dd8}, {0x000ee65dc837c8b5,0x000adcddc166fc64,0x00025dcc0b86acb0,0x00007a67549dabdf,0x0000576a5908df3f}, {0x0009ba528eaf43d2,0x0009abc91f72787a,0x000cd9caade63467,0x0002392f3343b557,0x00002b0e85e7ce15}},
+{{0x000749ad764e8286,0x00073f204130cb4b,0x00044a6fcf843de8,0x000f911def8e867b,0x000035cd41ae3d3a}, {0x00075d28ba24388c,0x0006a606e0ea8d66,0x00060e1304e93df4,0x000e694f3898fbdb,0x00003325d1b25aea}, {0x000cfc93795ccbde,0x0005c9128317a58d,0x000ad56480cec5bb,0x000e808c1f5d4b0b,0x000045c0432c0d8c}},
+{{0x000373dcc7f2a4a7,0x0008720000181b16,0x000ccf33cbfcc053,0x0005ad254c54b811,0x000003b508e1bd3b}, {0x000396487dd2fa60,0x000a241ee96d14de,0x00030c436d3c1bb7,0x00055ba63d2166ea,0x00000b00aab2d010}, {0x0003bfcb8ea630c6,0x00065d5747b4afaa,0x0001919d0a6d2c82,0x0009c758a2e17158,0x000071a38be6885c}},
+{{0x0000cb6153ead9a3,0x0007f512b636ec72,0x00040290b155b2c9,0x0000ee2b1e35b5fd,0x00002fd9ccf13b53}, {0x0005ba7d43c31794,0x000ff933225269d0,0x00061974382470c8,0x0009b538323dec81,0x0000285270988156}, {0x000d475b47f796b8,0x00013542c8f5407b,0x000b24f87ed2c7b0,0x00001d62dbd23f43,0x00006551afd77b09}},
+},
+{ /* slot=13 [{1,2,3,..,64} * 128^(2*13)] * G) */
+{{0x00024edd12e0c9ef,0x0008df2420297963,0x0004f573be468b87,0x000e92a199a3776a,0x00001e7fbcf18e91}, {0x00016b630817e7a6,0x000233c351026b5f,0x0004cef201808c69,0x0005345324a983b5,0x000053c092084a48}, {0x00041481f1cbafbf,0x000b6716174e5d2d,0x0002a55c98231d2d,0x00095f60b7d7656e,0x00003e955cd82aa4}},
+{{0x00093d36101b95eb,0x000794f6f448673f,0x000f15e562faef33,0x0000da15651735f8,0x00007fa3f19058b4}, {0x000fc862059d699e,0x000a19a619e69a03,0x000f823deb2370cf,0x000844ec4fe3b122,0x00001d1b056fa7f0}, {0x00064631e56bf61f,0x000106e5382a31bc,0x000540168dd379ab,0x000d8e44d58c57e0,0x0000566256628442}},
+{{0x00001f08dcd6ec77,0x0003d40ce356cc0a,0x0004377df1057b52,0x000a0d5af5e15c88,0x000008aded3748b9}, {0x000b689a03641c46,0x000d2755172d6489,0x00008fe43a6d63bc,0x00036e23f61f8f9e,0x00005feaae4db6d9}, {0x00021e84893e747e,0x000281eb609e6eaa,0x000e48ce6dbbca1f,0x000cc1b3f73a7d10,0x00002cf88a206992}},
+{{0x000499def6267ff6,0x0007b742c0843b9e,0x0009a4f2b17772ca,0x000500623a0153fe,0x00002cdfdfecd5d0}, {0x00099cd61ff38640,0x000c3063625a0dd4,0x000dd73dc329cd9b,0x000923151e2d8023,0x00004a25707a203b}, {0x0007668a53f6ed6a,0x000581dd170a12ab,0x000ae20161304242,0x00049fc4000144c3,0x00005721896d248e}},
+{{0x000aefd52e9b5805,0x000009485e2d45ba,0x00053649591d70af,0x00060c82b7a32c47,0x00001216a2862de5}, {0x000ae7b077bc5547,0x0008d0de43a5675d,0x0005f3c725051e01,0x0002c33dcc2bd007,0x000050e99aa09be7}, {0x000f89b2fe68d895,0x000242dc9388108f,0x000fbe70d89684b1,0x000ba69e4cb655b2,0x0000069bfdadb3b5}},
+{{0x000d07093c842496,0x00042a9121a0a66d,0x000b2462fdc7ac6e,0x000acd355bb3238f,0x0000595b63664da7}, {0x0006dc5c177a921d,0x000b6aa360f948b0,0x000cf667ab60dfa5,0x0009e5c6e87b2863,0x000019633236b4b3}, {0x00096a6f761207ed,0x0004dc534e0eb3bf,0x00088c1420d19fa2,0x0005b596f913c336,0x000069bcfdc8ce29}},
+{{0x000cc81db7f271a1,0x0005afdff5d69418,0x000e4b616f640e8a,0x0003c195e05e4d9f,0x00003bf73c36b849}, {0x0003db2c1e257f49,0x000fef3847662576,0x0007364b6ee17154,0x0004642ede89b725,0x0000677a3dabdf86}, {0x000b94475fccd9d7,0x000836bd4db3065b,0x000adc4a56773538,0x000aa015b1fcd2a2,0x000045aa3e879a6b}},
+{{0x000e5517fd181bae,0x0009f2bb963b40b6,0x0002064625902262,0x00013da5509bce93,0x0000578edd74f63c}, {0x000d5091a1d0da4e,0x000a7b5fe3e08285,0x00019393b34baa6f,0x00030fd63e5177ce,0x000003c935afc4b0}, {0x000276c6492b0c3d,0x000c4dfe205fc997,0x000d623a3c47ccc2,0x000c7a2dcd29b84d,0x00003ec2ab590288}},
+{{0x0002cb4727cf6183,0x0007129f6e286e85,0x000aecc0c6c3277a,0x0004fb278b535161,0x00001f05e7474b30}, {0x000bafa270e61c52,0x000ef2cf202bff7f,0x000bc7eaac69076d,0x00016f788a0f7790,0x000014a54b9c0c14}, {0x000a7938d0d0cae7,0x0008c3c6046da660,0x00073b869ec48ea9,0x000078296e1040e1,0x00001837b6d4c6fe}},
+{{0x000c8a72b273bc57,0x000cb55e61a8a94b,0x0006f2a861ad4c3d,0x0008502bcdb0333e,0x0000584c0303e101}, {0x000d2d7db9b0864b,0x000787bd1738ef92,0x0000ae0ce55bc2ff,0x0008902879bac397,0x00004e4fe7ce6f2e}, {0x000060cfe8761df1,0x00094823a2f6f020,0x0000c244dca1aa60,0x00034325f746c810,0x000018fdb8da7eee}},
+{{0x0005f2d6a83ac863,0x000739e85cc08b6f,0x000ada79de80b5c9,0x0006b30b7a28e2e1,0x0000214bbf2884a5}, {0x0000324782892953,0x00088ab5e8cd683e,0x00038907ee41d416,0x0002ed037d8ea3e2,0x0000442fce0657ea}, {0x000f51c52d7bfac0,0x00032a5b369dd300,0x000196cc61f0925e,0x000da4233a7279a9,0x0000028bf000dcc2}},
+{{0x0000d27be4d87bb9,0x000eb61391aeda1a,0x0003cb9b83a98b4d,0x000cace99a0ddd07,0x00002dd5c25a200f}, {0x00013a09ae32d1cb,0x000df40f5c2d5a72,0x00081eab290f2b87,0x000ac5e0baea4c6e,0x00000e1bf66c6adb}, {0x000bd5e9792c887e,0x00018cb926d5de2a,0x000aae5f1e1a0200,0x0008f5fbfba69cdb,0x0000730548b35ae8}},
+{{0x0000db075a7b62d3,0x000a9873e1bb78cd,0x000300bcd738a312,0x000d75c73e469499,0x0000486238a8a0c9}, {0x000113b549eda6a3,0x000d89f2ab90cdf8,0x000e560bafb77305,0x000a4d1bb84407fd,0x00003b620c7b80a6}, {0x000bde16fade149e,0x00019cdea02487af,0x000df5cb656c4dfe,0x0004ed8916d664aa,0x000068368aced96b}},
+{{0x000e302bcd5ab66e,0x000efb85dcb6bde9,0x00076f98e38e9a71,0x00003cded7ee0981,0x00007e8176829180}, {0x000810d43ce6c319,0x000e1255b1d2651d,0x0008708a573f8779,0x000a01d932838816,0x0000361bb9acd61a}, {0x000f13cb1b910ac9,0x0001ac38ac8827ad,0x00070dd4e83c1f5c,0x0009ad2dcb85eacc,0x00002fcfbd4f5615}},
+{{0x0003668ad24fa0ca,0x000a7179b9ff43ce,0x000112b9d658e646,0x0005b96c19961819,0x000010fdd8845102}, {0x000c3ef814b56f33,0x000c4bbaa82190f6,0x00002ee59535fe02,0x000fe05a6d33f501,0x00004762c6427887}, {0x0008aca1f5b903e5,0x000f08d39e2018ff,0x00047119e3b6918b,0x000cb8a036f0f071,0x00001a78a3636a94}},
+{{0x000551a3cba8b8ee,0x0001db2115f16c43,0x000b8c385065a26f,0x000b8ca760f4f52a,0x00003043443b411d}, {0x000b094ba1d6e334,0x0007709353f19805,0x000622702bbf3ef1,0x00045dd423f06cb0,0x0000585a2277d878}, {0x000a5f8233d48962,0x000b5ec78257fa18,0x00073e41ff6698c4,0x000981fa78e6fa53,0x00007656278950ef}},
+{{0x0000e446a67c5c65,0x00027023f231945f,0x000cf454b426fe0a,0x000ad74321494c25,0x0000127c84fa8a9b}, {0x000557b5f101381c,0x000830c127865741,0x00019b06be7b4670,0x000ca69ceac950dc,0x000032a29702bf2c}, {0x000ebcbbcb5d7f24,0x00084977f34fd315,0x0008f7f0fe9658cd,0x000e960b1c94554b,0x00000c6769089f44}},
+{{0x000eab1b908135d5,0x0007ec930b5b96c1,0x000ac18f5191083b,0x000a8a0505cd438b,0x00006eb466a9476f}, {0x000db7a86c1a4f31,0x000cc43c9ea88189,0x000c6de8a43f9f3f,0x0001f09db555892f,0x00000f3b21b9fd45}, {0x000aa9fb69bfc37b,0x000f810edba8f505,0x0003ee43636eed73,0x000c0a0262b4522c,0x0000279f55790c00}},
+{{0x000b0ebc8680fcbb,0x000bc6bb274b657a,0x000f5748b0e5cd39,0x000333904424b002,0x00007b62f337a409}, {0x000dc7f1d269b737,0x0002eaa50db42d18,0x00027e770ce4cfb0,0x000a5b0461161409,0x0000623d7f69afe1}, {0x0002dccea1605d96,0x000694f2d1db4a0e,0x00051b501dec6949,0x00014c465a11266b,0x00001f3e4974b5bd}},
+{{0x0003cf59d51fc8c0,0x000fd0506b6f238c,0x000b570e8f9bedd2,0x00046a626bf109fa,0x00003f4160a8c1b8}, {0x000073a3ea86cf9d,0x000b707155fdce17,0x0001838a8e3a8cfb,0x000f6164853e7fc3,0x000028bbf484b613}, {0x00012f5c6f136c7c,0x00007f6dd11bef26,0x0003de6f33afead1,0x000f75d527e9ad21,0x00001e79cb358188}},
+{{0x00047da776c69632,0x000b6c9201f82f1b,0x0003cd4be948e8f0,0x00062c4366b4d4f5,0x00007c70bacf480a}, {0x000c5313308211e9,0x00032fc232380279,0x000c7304ed9c5021,0x000fc100b709951f,0x00007c28a2502ed7}, {0x00085e26f5bb79bd,0x000896f412d7c832,0x000f67ca17f2c1be,0x0004946841b6cd75,0x000045b717d595d4}},
+{{0x000fb403a40079c0,0x000e41aacce8b0fc,0x00066878b35ae611,0x000c336cd2f06dfc,0x000045789f5e32c3}, {0x000d84865375376d,0x0008f75738dab961,0x000ef521bd6b8256,0x0003bb257d738533,0x000049447fba0619}, {0x000fe6e468eccd2b,0x0008877cd6e2c71c,0x0005de59d0e62232,0x000bca16363f7fe2,0x00003deb2aa6a88f}},
+{{0x0009c93034db19dd,0x000c2389bd3fe88e,0x0002e71e2ef51698,0x000464b40f9479df,0x000068b420305b37}, {0x0001e0a08f18f587,0x000f109238e5e7f3,0x000385df7cbb713a,0x0000333d31710b4d,0x0000248dff812c48}, {0x0004bdeb7902d669,0x0002877fa9b1fca2,0x000eae50f9714265,0x000a96ea5c9a69d5,0x000059184b4650a8}},
+{{0x000436c3eef7e3f1,0x0007ffe9e10f8013,0x000cf9defc828b6a,0x00038317ff908e5b,0x000065d7951b3a3b}, {0x000953d8f5e08181,0x00044299dded977e,0x00064525e584a50c,0x000f2f4dc6c2d0c8,0x0000478ab52d39d1}, {0x0006a4d39252d159,0x000bc871ac80766a,0x0006c1c96fe5dde1,0x0002214b82c6b40a,0x000016d87a411a21}},
+{{0x000382f8146abdc9,0x000aa42f0e77e206,0x00061f68e40b9721,0x000748cb4323674a,0x00000f4dc2754833}, {0x000179602f18c0af,0x0003336bfc7bea5a,0x000effe2f27f8e6a,0x000e85cb206ae990,0x00004031ef8cf687}, {0x0001dc28f533529a,0x000033b59de01536,0x000358b801eb47c7,0x0001a203a3793067,0x0000333690ddec76}},
+{{0x00008a6421740f69,0x000d2c31f5f2cea8,0x000202dcf0682683,0x000fc460405924b6,0x0000356f3ca3f0d3}, {0x00067e21ee5b2654,0x000b3bfb65d86bbb,0x000fb606bde21555,0x0009bbe28adfcdbf,0x0000739b2fe54c44}, {0x0004c6b013d65526,0x00023ca04ea0bf65,0x00024ebf18b3d8f3,0x000e2a6d75c4e419,0x0000665a0314547b}},
+{{0x0004a97fe980a784,0x000174fcf8120000,0x00096b47bfd09783,0x000f23a4184ceab8,0x0000775330ecc436}, {0x00088aecd17ed470,0x00066d8bb805bfb2,0x000c597bef779835,0x0001d0a295602f91,0x00007552e45ddd20}, {0x000a75946440bdda,0x000e32abcea05976,0x000c8be6ddadd581,0x000516f47302cb66,0x000027c7905027a3}},
+{{0x000d7e5a42066215,0x000cd0c5a24c1b3b,0x0006f994b7879be3,0x0008ca657c05db1d,0x000028f87c8165f3}, {0x0004d5e2d54e0583,0x000d72ebd99fafba,0x000ee9778fe21faf,0x0006dde497ac2736,0x00001f990b577a5a}, {0x00044ead1be8f7d6,0x000ebacea798fa33,0x00020de0527d1e50,0x0006d3e77c6569e5,0x000045882fe1534d}},
+{{0x0002d783c7cc9a83,0x000ffca22bfa4d92,0x0006f1cde52b5fc1,0x00036723cd9e7772,0x000007c5f102186f}, {0x000b119cd8a4edc4,0x0001fbbc8ff94cfa,0x000ffcba2170db00,0x0005961ff6abdb23,0x000049353853d5f5}, {0x000cb101da1687a1,0x000773c9255c9b51,0x000a554563f125eb,0x0009dafab1e7edac,0x00005c7a6a1c1567}},
+{{0x000a540f716661a2,0x000754f1e24f2a57,0x000816bb97b3ac71,0x000255dabee27465,0x00001ebc385a788a}, {0x000223f39c6b76ac,0x000769496ef59dbf,0x00028e117babe502,0x0007e88894d895d1,0x000018e606c23b2b}, {0x00088fc969c9fb4e,0x000e9d91a162acdb,0x000b7817362f28a7,0x00060026302ac35f,0x000069971d5bcad0}},
+{{0x00094ef10349908a,0x000bcdf27011de32,0x000a1f7fcc7ef850,0x000ef3771e95acd6,0x0000415cc5bde7e3}, {0x000235e4d2de3310,0x000d1b8f04c53c3b,0x0006cc14d06fba59,0x000a22221d02cb24,0x000013aaf34c892a}, {0x0008629f27572aec,0x000fa989ae58404e,0x000913580c42daa6,0x000cca585cb61e4f,0x00005ddaf857f525}},
+{{0x0009345d757983d6,0x0001117aa11a6666,0x00085e128f62b6ed,0x000f6dd7ddd18579,0x0000688fe5b8f626}, {0x000c9929943c6fe4,0x00061a38392a2d8a,0x000ec89af3b5f9f1,0x000f0742699db13b,0x00007dcf843ce405}, {0x0000d6484a4732c0,0x000fdca5632996c9,0x00015dc6e1d52143,0x000191bb3be28c39,0x00006739687e7327}},
+{{0x00005cbb5691fb54,0x000c6b538c79f9f0,0x00003f9f80cc1b2d,0x0005acfe5dea185b,0x000031a289b9b678}, {0x000b3881815daf07,0x000e2d2929978e9e,0x0008164bed52b2fa,0x0006ee0fadeb8a01,0x000029e28d35d756}, {0x000bb2ef4371cc6d,0x0006858837e6de0a,0x000908823dea8fc1,0x000f76870ec1c29c,0x0000487a75477756}},
+{{0x0000d9cab0ef7f60,0x000dbab836c81592,0x0007508ac8237333,0x000f34a98b9fc04d,0x0000133e3278e19c}, {0x00031c49bdf3885c,0x000e0c0300eac092,0x000a0c5198f8fbbe,0x000cf9379539b9be,0x00005fa9826117a3}, {0x0001fc5a6de16317,0x0008bfc4e2e499e7,0x0004c3877b163746,0x000cf16685977d68,0x00000fd2debd704d}},
+{{0x000ea88254ed3269,0x000620b017347829,0x0001a144b687d02b,0x00055a5023d4c11d,0x00002b01b053e87a}, {0x000e4b24cce10817,0x000c57c6a54cb0d6,0x0002aec5f467a838,0x000146ed3281610e,0x000033b2eb38ff0a}, {0x0006084f7c1fea3d,0x00020b2e052b2867,0x0009dd5bab731bed,0x000017d22118a986,0x00003700a00960e4}},
+{{0x000e532fcec6887e,0x000c100bd675cb56,0x0000aee69d44fe72,0x00091b017e914dc8,0x00005211fdbe8bd1}, {0x0000462010a1ee6f,0x0004ae476f6317ad,0x0008c6b812d6a706,0x000784bb3edb92ef,0x000067687f4778ae}, {0x000b9ba7a67c0bec,0x0000a68f9f1c224f,0x000a8a2d8b4d0be1,0x000682de7ad2a578,0x00003e16c1888675}},
+{{0x0001a6bef5430499,0x00081658b18e4930,0x00087af2c64ee19b,0x000895584190f91c,0x00007166bb157303}, {0x00078a8ca6d4205c,0x000d5c7136994320,0x000cf665f2bb3415,0x00069be898a66515,0x0000770f14063721}, {0x0002336b2cb9ce8c,0x0002947bc9a19da6,0x000c31b8b2e886ce,0x000dee0edbb731cf,0x000006d2ad651c51}},
+{{0x0009da61822d5abe,0x000f30d990acd806,0x0008cc8c533fdb38,0x000c82a12d242bf1,0x00005d634ff2eafb}, {0x000096602459cbd5,0x000554fd4d1f09c7,0x000682544f01e2f7,0x0003d2f91bce615c,0x00001160fa2ef7b7}, {0x0001f47142b4c4d7,0x0006fa176d2e2aba,0x0008d8c7e344df97,0x000f4f4924307018,0x0000504de65d38dd}},
+{{0x000a6102b8a7a2ff,0x00093ef787e24f1c,0x00071c742b375a08,0x0002acced70482d1,0x0000075c335ffce4}, {0x0000122731a6313a,0x000308f5f6de0a5d,0x00063f16d9af1fa1,0x000161f0e59e0fb1,0x00006352e307b753}, {0x00024b605e1ee667,0x000998b1609af2c6,0x000a38665e799502,0x0009652ce4eaa3d9,0x000019e9e5d59575}},
+{{0x000880748761f16a,0x000f6df97bd3f899,0x000d0bacd509a945,0x0006586bee692169,0x0000645b8fad987b}, {0x000a294dabc64511,0x0002b2b87f053cda,0x000a35a63d3c7cfe,0x0006a0207d9d4934,0x000046a75132b04e}, {0x000a92f029ddc17a,0x0003893e0b214ecb,0x000918b2287afe11,0x00055854d63052ce,0x0000677058c18a39}},
+{{0x000b61cf1eea0361,0x0008e6977fde3d9e,0x0000a6b7952d5164,0x000a57e8a6f8da74,0x00003f9df8f2e728}, {0x000a4bee7d4142cf,0x0004ae064bdbb095,0x000a5fbf5fc22a59,0x0006b87a00cc0d05,0x00003188820e8876}, {0x00081673daef2c41,0x0005fcf6f5856c5b,0x0005756d4a7ba79e,0x000eb635170be2c0,0x00001925cb98b670}},
+{{0x000fac82c30f2414,0x000166c98e2a0007,0x0004330a1160c145,0x000f2bff5464e644,0x000079884db60cb2}, {0x000683864e8db173,0x00091d5355ecc19d,0x000fdd59844b7703,0x000bb8240c203e43,0x00000291f34b2501}, {0x00010ebce5763cc8,0x0006f094277043df,0x0009f4e2824eac30,0x00013b14ecd8f6ed,0x00001dc219a4ec96}},
+{{0x0003d901a4812959,0x0006d0ef9c6b7a76,0x0001cc2c967aae7e,0x000d1eb4c05532e8,0x00005520a1884975}, {0x0005b88b0586f679,0x00015c4ca08cec67,0x000b5ab2cf6b04b2,0x0003c4cc8227f7fe,0x00005fa38e129853}, {0x000426467f2953d2,0x0006512d240603a4,0x000e3195282f9ca1,0x00050875b720007d,0x00004b21fe3bf85d}},
+{{0x000e4ce85e8f4dc3,0x0004f2bd98b8f160,0x000b866dc73d92d1,0x0007d2fd73cd563c,0x00003abb3150e883}, {0x0004dbd02339acbe,0x000791dcc2425898,0x00045cfc29008e83,0x000b2f12ef54c42c,0x00003f730f6320d3}, {0x000c4833fabada51,0x0006e973af4907bd,0x000cfaf96e21cc61,0x0003aef5a2d736fc,0x00002f2c7c26c4cf}},
+{{0x00011254c2241caf,0x000b522395bc0fc5,0x000d8bb936a35ab1,0x00033aa60637379d,0x000071b575c1f7f4}, {0x000fe9eab6b6ce85,0x000809fcf8935644,0x000877cb11b99c54,0x0003d4dafa1647a1,0x00000e9871f94f8c}, {0x00094469d191c629,0x0001217a91b5d206,0x00012205936be697,0x0008871613888f63,0x000031c1347e771c}},
+{{0x00065e819513da2c,0x000a96401777f015,0x0004f38eab7511a2,0x0001a46c545b8c29,0x00004f4ca15eea74}, {0x00084eeca36c6c15,0x000b6691e083b636,0x000649e25e5c0989,0x0007af14e0960c88,0x0000185a66f7482a}, {0x0001e46c26bf925b,0x00022488b2b95682,0x00056d386be94cc1,0x00071f781902b7af,0x000076a13f7c28b6}},
+{{0x00094e76ccd489b3,0x0002e224418286d3,0x000642ff0d49297e,0x00058876a8ad1769,0x000039f0ef806da6}, {0x000ba31dd22648a0,0x000bea88018e2cab,0x0000dda95018e5d3,0x000245bed7f5fad1,0x00006ecf88c101c3}, {0x00052e611eec4ed1,0x000ba1d2d1040334,0x000c2007c6948c45,0x0008f24813c67ff1,0x0000144ad05f9ace}},
+{{0x000107b757166482,0x0002e5577d2d0295,0x0005bc9daafe04ab,0x000558620104fa1d,0x0000699b0a70ae92}, {0x000ba8dd2241c7ab,0x00076f1612bbc4bb,0x0004169b82ca6a31,0x0009e71a8be332ae,0x0000100fbf7b5b86}, {0x00033b6ab7af20b4,0x00096513917c61cf,0x000f30595e06d018,0x00075dfec14e3690,0x0000746d131a459a}},
+{{0x00065e262c0b40b5,0x000beeb28001b1d4,0x000482db0249ae41,0x0009ad9cdeabf6cb,0x0000707dc97f4cf3}, {0x000d4280aa43153e,0x00095fc9da8a6c15,0x000059f727cc471a,0x0009a2b88cbe6b3c,0x000063df183f063e}, {0x000f29dc9ee366b5,0x000d8b31c313cd41,0x000c2bf8161e5f8f,0x000c5f601d848789,0x00006d88726dbd0c}},
+{{0x000a2a17a57fc619,0x0001b144fc6dc4d4,0x000145dffa37e60a,0x000214416e9fe7a3,0x00004f6ffaa52b92}, {0x0008451a93a4d74a,0x00002858355dd19c,0x000513811cff1f0f,0x000f76acb5513acb,0x000015c7778756d6}, {0x0004017a441185ef,0x000b4df6832cdca5,0x000bc09bb7d35b84,0x00095fc654177d6f,0x00002aa88d608858}},
+{{0x000c87269a5d733d,0x00049e457977dfc1,0x0007771b0aa2f475,0x000208ab73c9e85d,0x0000257e8d6d53d3}, {0x0006e5b8c0cde1f2,0x000fc68269a9a619,0x00029fd9435dd64b,0x000a05a9514207cd,0x00004ea7fd9f18ed}, {0x00012192adeb67e6,0x000fc780ff583639,0x000e8463039945e3,0x000e9450137dbd92,0x000019b2e2743893}},
+{{0x000b2ee6144aade2,0x000ad69844d364ff,0x000506d9c623e3cb,0x0008ddad430536d0,0x00005d6a7c405e57}, {0x000b9bc32a475227,0x0007dc592f293d7b,0x000bcad65701d9ed,0x0001552579ed40d8,0x000023d7267a64b7}, {0x000776ea978ff37a,0x000b8e0f5bac4dc2,0x0004b645aedb5919,0x000dacc50854bc60,0x000021d024f7363f}},
+{{0x0008afc9a4ec570b,0x00012eaef0921684,0x00019adc921453f6,0x000578f783b25963,0x00005c4369ec2216}, {0x00066b5dfbc49f91,0x00054384cd8f6ef6,0x00079b892aa6a7e1,0x0002d72975aad512,0x00002a1e11923795}, {0x0000767372bdbeb0,0x00058970bdadab5f,0x000de2c10ea0f318,0x00034c3a20ebf976,0x000018b0518ad95c}},
+{{0x000c656f0b1f0a7c,0x0000fdcfca97bf21,0x0009e3ba84153081,0x000c50583605f3e6,0x000061809abac8d4}, {0x00042933b5dd12ec,0x00042a4ed5504cda,0x00013104f48bcb91,0x000e03f33fa8766e,0x000048411e11bbdb}, {0x0002d4e0d1518800,0x00094bd4fe0c48cb,0x000ff6be66728ab6,0x000d116098dd9612,0x0000359d87ed63d2}},
+{{0x000b496bfd326ea6,0x000dfb03bc642c4f,0x000e0e23e579645c,0x0002adfd8863736b,0x000017489395dae5}, {0x00023a1e4badcad6,0x000c217aaed00f34,0x000c4f3137d2fa01,0x00064ee25a82fc23,0x00006d504b6d5fd8}, {0x0000ffb21c786e28,0x00015a5dc4c1f8a6,0x00014d995384f273,0x0005e14db8c55ff0,0x000032a761fe129f}},
+{{0x0009265a7f80eb43,0x00045c33575cf671,0x00033855831b7e9c,0x0000a0c6071c4438,0x00003168a862c7ba}, {0x000d2971725c489f,0x00062286a75cb102,0x000a11d5d467d000,0x00074a8ed90dcd56,0x0000759df717aeb4}, {0x0002a6486cc91e7b,0x0005a0d9d0cca63e,0x00075d208fdb1361,0x000e97bebbdbe14a,0x00004db231bd5333}},
+{{0x00023da8dbcfc332,0x0004c1bb3966e3a8,0x0002f964831bc666,0x00051b6e825ba861,0x00000474e9681781}, {0x000a4a751658a381,0x000b70219c03fee2,0x0006bb9a734311dd,0x000590d2247a35f4,0x00006eb17adda29b}, {0x000723141d5ee790,0x00092ed52da1d826,0x000a799ce74724c4,0x00068289486ca19d,0x000013f0ccf9f778}},
+{{0x0003d09847cf8714,0x000f7909fcb97bbf,0x000ba6248e90f42a,0x000d729455d41242,0x000078ab097fcfb5}, {0x000bf9814325a878,0x0001fa793fa712aa,0x000f5644d0241ddf,0x00088a498d91b746,0x00003044f39da9b8}, {0x0001856aec78a6a2,0x0004cc4a69ef5d21,0x0009971a75587eff,0x00016b9170ec470f,0x000031ff7450b1ca}},
+{{0x000f720ffc9f37e6,0x000cfba9741c1d39,0x000f939b1224650d,0x00029348a8bb0204,0x0000406e0c98bb21}, {0x0009ba2da47527d0,0x000b5c214e8aa25a,0x0004e92f6ec7b44b,0x000af3346b3c6f6a,0x0000480cd699f72e}, {0x0008dc8b8189a46b,0x000b9d12837f124a,0x000746a6bf0d4635,0x0009836280f6ff84,0x0000311eb74f2393}},
+{{0x000ed6100b27761e,0x00078def209b7726,0x00093015709f4678,0x0002ad49e3631416,0x00001b6ff4675a9e}, {0x0003e1b1dfcaf1c5,0x00022363fcc5aa37,0x000804500fda1580,0x000a17734eb45e6b,0x00000ae7c09ba893}, {0x000921f152649bcf,0x00005452feef7ea3,0x00092484d97ca54f,0x00074ac8fea1ac99,0x0000024f69310fab}},
+{{0x0008e39ac33d21f6,0x000c8665d549a414,0x000759b0f2e911dc,0x0004753c4c06480a,0x0000367b406e1a08}, {0x0007d55d0ea54553,0x0005a01031675a3a,0x0004a2c7428b6f87,0x000b91a3b15c0882,0x00002919aabcba30}, {0x0003a34136966929,0x000fac25d8e843d4,0x000599111632e605,0x00026a8e36836f50,0x00005ed462e693b0}},
+{{0x0006691802f7d9d3,0x0001b08b6912ec3c,0x000a4219bdb323c6,0x000c0a614c51fbc5,0x00006c5155b48339}, {0x0008e6532a451012,0x000d807c64b0faf8,0x0005eec77fff0654,0x000c7296d1927b7e,0x000066ac1af9d7db}, {0x00030de84bff62f6,0x000da1ca47e9fb71,0x000c06b8408846c4,0x0004c5c8ef251422,0x00001e9cd25afd01}},
+{{0x000181e2469401e2,0x000691f85888b7e1,0x000513e9d9b926e3,0x00003bd9c42439de,0x000049c7797eb7ff}, {0x000fd7c537a24472,0x000249f835eee0d9,0x00097f908a3d98dd,0x000f9431999f0ddd,0x000014792784b99a}, {0x000ecf4294af8d45,0x000cf2f3090bcf85,0x00007ce1eaec116a,0x000bfd077a474321,0x00001ba42bc92ad9}},
+{{0x0005c5ea200814cf,0x000e169a317409f6,0x0005c8b4ad840536,0x000361d8b0ed1392,0x00000080dbafe936}, {0x0005aad0c9cb971f,0x000a99fd54a298ce,0x0005af9b781156aa,0x00049aa41f724701,0x00001fe8cca8420f}, {0x0001848f3c0cc82a,0x000c2877c9e5472a,0x000e55414038c560,0x0009d715004e228c,0x0000042418a10342}},
+},
+{ /* slot=14 [{1,2,3,..,64} * 128^(2*14)] * G) */
+{{0x0006ee72f7bd2e6b,0x000d6109abf4e790,0x000941a8a405d270,0x00042878d5cfe45b,0x000044c218671c97}, {0x000f9d56296bc318,0x000d4d8152e65745,0x000839e9ce993580,0x00021c0b0e5b13f5,0x000051fc2b28d439}, {0x000fd11795e2a98c,0x000e12b6b62911b8,0x000424b5721c4e5e,0x0004ac65b30e7107,0x00006e6b9de84c4f}},
+{{0x00025fce4b1de151,0x000c7e11c4025dff,0x0004749c87d841c0,0x0000df92554b3c85,0x00002d292459908e}, {0x000c5f10f80cb088,0x000dc56e421516b7,0x0006ef99c4736b54,0x0006f42c2b620a5c,0x00005f4c802cc3a0}, {0x0005c8f17d0752da,0x00038c77ee8009b6,0x000b62f9e3881ce3,0x0000d48c3b514f05,0x000066ed5dd5bec1}},
+{{0x0008a1c20bb2089d,0x000e196ccd4127d3,0x000c97d313808334,0x0007f20c4a70b8c6,0x00002eacf8bc0300}, {0x000df3c9cbca047d,0x000cbf4552f6bf0a,0x0004735f9381c3b2,0x000048ccfda112d4,0x00001f23a0c77e20}, {0x0005467be5bc1570,0x000020dbab38cf23,0x000cf9e09e03d2d9,0x000bc5027529aa2f,0x00000840bef29d34}},
+{{0x000dfb35dc10b287,0x000cd5c7ff29d796,0x0007b2490527176b,0x00042767f3d43e8c,0x00000304f5a191c5}, {0x0004e06b7f37e4eb,0x00087f5e96ccacd5,0x0003597dce8cc15f,0x000400cb8248bb0d,0x0000246affa06074}, {0x00088e68fbe45321,0x00048c0d7503237d,0x00094a0d35860975,0x000d3254e9b13ef8,0x000025a83cac5753}},
+{{0x00022f48eed8165e,0x000234b8bcf3a102,0x000221e8f0623fc1,0x00026301e145c09c,0x00007ccfa59fca78}, {0x000f66293952b6e2,0x0000e0934267b9f0,0x000609fedc33db5e,0x000e0c9ff45252bd,0x000006be10f5c506}, {0x000615a9b62a345f,0x000564a52fecc1a9,0x0008bc0dfe22050c,0x000e71da7a278852,0x00005e82770a1a1e}},
+{{0x00025183ad896a5c,0x000fbe78d52f6354,0x0002a35f64e8673a,0x000b1022c66f25f9,0x000009d04f3b3b86}, {0x0002e80a42339c74,0x00066a7fffae5e80,0x000c408cae341751,0x000c5ee34865d1f1,0x00002cca982c605b}, {0x000d5d35197dbe6e,0x000ea8be4ffa3fd2,0x00025ae918207c2e,0x0001d3e2613d8db3,0x00007a325d172774}},
+{{0x0006b9bbd16dfde2,0x00057c497a829d03,0x0007f12667a20557,0x000c1808e6cc966a,0x00004d3b1a791239}, {0x00027d017e2a076a,0x0009f1636495eecd,0x00019233e5d78868,0x000ae6452a61af09,0x00002a479df17bb1}, {0x000eee8e33db2710,0x000ded6c43ca59e5,0x0002718138189854,0x0005e9ba41c22c59,0x000027ad5538a43a}},
+{{0x0006dd4b15350d61,0x000c8ee9521b7274,0x00038672cad03fcb,0x00089e2e86e365a1,0x0000510e987f7e7d}, {0x000a7d638e47077c,0x0006120a1c059cb5,0x000bedfdcc8db753,0x000179d549e1e4d8,0x0000080153b7503b}, {0x00069d930a3ed3e3,0x000f1cd60a722dda,0x000daa4ee63d386e,0x000372ac817ad58b,0x000023be8d554fe7}},
+{{0x0006c8b96ed6b420,0x00000309fc52816f,0x000e47543924e402,0x0004bb8b91fb4e17,0x00004ae2465e35cb}, {0x0000811cb5a90fe1,0x0005318892c4e56d,0x00050fdfa2747d4c,0x0008b61cb6ec9fbd,0x000024da2a50bf0e}, {0x0008f72464b7793b,0x000d2583f7726491,0x00054725b469a87f,0x000f5a16d213f276,0x000035de0fb70d0e}},
+{{0x000bb6b4a8a4f8e6,0x0007a9604c729733,0x0001b1ab28f104e5,0x0008bc1cd93a9f4f,0x00000b5b937c0fa2}, {0x0000c544bbaf2a14,0x000f638fc0cc5f04,0x000d75aefb703095,0x00040d82288a7059,0x000014d186b02406}, {0x0006b81201a13bc5,0x0003e89733dd8c83,0x00053be472dfde1c,0x00079200e47451bc,0x000072ca16b4a807}},
+{{0x000f7e32e53dd37b,0x000b962a0ae7b699,0x0003506758a9c014,0x000b930115da689a,0x00002658c1d350e1}, {0x000f967539fe02fb,0x0005fe80afd012da,0x0004d1fd45f75eaa,0x0005453cc78b7f50,0x00006d48db6363e4}, {0x0000dc86b890208a,0x0004fe9b82ad6d94,0x000dd7360c2e1fa4,0x000f7c31c6de852d,0x000055c5a96e4125}},
+{{0x0004dce55a784e9b,0x0003d4f0e0b4a134,0x0009be7bd29b6c4d,0x000fee9665825b83,0x000074a8ee91ff8a}, {0x000ab79027dc4f5f,0x000a17fdbce65edd,0x00082ab1cdb65476,0x00056d0796ede045,0x000056a3bcdbe770}, {0x00026b87d05e325a,0x00038b73521a813b,0x00098d626777684d,0x00000b6745c7fde4,0x00006be914d19891}},
+{{0x000b20649ccf80ed,0x00014d39fe4ddec0,0x000c75d7bea9e7c7,0x000b2938c77d17a7,0x00003b0a0c583853}, {0x00053a6754438a30,0x0001b7c43a56a01e,0x000b6097ea64f92f,0x000cc74529e839c0,0x00007316120a0427}, {0x0003f13a966f91fe,0x000bbcaaec22885d,0x0007d759dbac1743,0x000d2a09b6930357,0x00002e72d6baa94e}},
+{{0x000c02da42126fc8,0x00078b6dfd2d4f64,0x0003908f4dbb4238,0x0005237e913ccc98,0x000072a5771e9ac4}, {0x000fc4dd7afdf7a8,0x00076e984c4f7362,0x000060e81cb41a01,0x00004787c7e20a94,0x000069d8138e8f38}, {0x00051f5918e6363e,0x000c49a7894ccfbd,0x000c20b4cd860e8b,0x000935513f755239,0x00004fc9971623fe}},
+{{0x0007dce890198cc2,0x000d720e21a47b69,0x000ca6c1de56a2c4,0x000a9a65370dc361,0x000044f0c796d87d}, {0x000ff3db4dbf03a0,0x0001868bbb8ffaa9,0x000deba6149249ef,0x000807be50f2a8be,0x000001e34b9df22c}, {0x000012031030b985,0x000afef925515d94,0x000a91f6dbb02b2c,0x000bae76f172f355,0x000072e2fa3f4240}},
+{{0x000e919a74ef4fad,0x000ecf6a308a295f,0x0009a47b013a827b,0x000c797964e01d30,0x000071c43c4f5ba3}, {0x000ef4bd567ae7a9,0x000b2d64498bdbc1,0x000c1f4ec83f624c,0x0004001e41064d22,0x00002ef9c5a5ba38}, {0x000d6df6fa9e74cd,0x000bce4af267ab6f,0x0001ef990ef18278,0x000f2938255b3d0f,0x00005a758ca390c5}},
+{{0x000c6a3bf58c2086,0x000682faa83a15e1,0x00042444c4153f5c,0x000461c4047fe368,0x00000f97bcaa3b2a}, {0x0003600e0335454e,0x0000d0323761a882,0x0004ac760b397034,0x0008bd8c1c5fe018,0x00004239e5f5ae54}, {0x0003e86e109a8a5d,0x00059ce6e1070ef4,0x0002b814b57f0cc4,0x000000b7506db91b,0x00001b082578b4b9}},
+{{0x000c60b2eb82429e,0x000253ccd0e4b340,0x00088a567cab7031,0x000c7032041c2208,0x00001b7b48d768b7}, {0x000e16df3c4bd5fd,0x000f5d2a8b99abbb,0x0007f0f794a3a07e,0x00099bb9612c0a67,0x000005c127639e48}, {0x000e0eb51926aba5,0x00028b21d2c48a3c,0x000cc1c1c84a86ea,0x0005a875c00d2c14,0x0000164198627feb}},
+{{0x00034030ada095f3,0x00063927eea0cf76,0x000e12730fa8fe99,0x0003fd3885055289,0x000013f81a8ba58f}, {0x00012d3cde669522,0x000bb9d7e59c026a,0x00019bb7c6cc0ec6,0x000b9e477875b023,0x0000390c462c1ffc}, {0x0007c7ca88d427cd,0x000920699f19811b,0x0001adf9da67d8b5,0x000407ca6a53b8e2,0x000059c746c5fcff}},
+{{0x0005916a4d402c66,0x000a4aaaf8dd0c0f,0x0006720b499f7a1a,0x00060295131362a0,0x0000288d2390f673}, {0x000acb5d1420a9c1,0x000f8925bc59bc42,0x000b2056c6f57899,0x000b67133cb239c1,0x00002f29c29c370a}, {0x00088a5075edacc5,0x000835a8ccb00394,0x0002d9f4576cdacd,0x00002a4fb353e558,0x0000242febf109dc}},
+{{0x0002dd5663f56a3c,0x00056101316e17ba,0x000f98672c434dab,0x0007a83d184ddd33,0x00006e34b1895b75}, {0x0009378471216a11,0x000e1a9f56526bb0,0x00058cdf41233911,0x000323569704d1dc,0x00000caf955f6f49}, {0x000c1541501daeb3,0x0004edc9d11ee98c,0x00097ea576ed45d3,0x0000bfb02074b2e8,0x0000478fde2bf3f8}},
+{{0x0002e4e5269534e6,0x00050acc7dc7233e,0x00062100235a37fc,0x0000cc922d47563f,0x00003f08f2f024fc}, {0x000afb0b2f139f61,0x000689712450c9ff,0x000009f968b2d623,0x00008be9cf45d2e9,0x00002529b4a74e54}, {0x000e767b13b2b286,0x0004b665695b4726,0x000332b1316d3b07,0x00095719499c7959,0x00003464c646d7eb}},
+{{0x00035092deefa9f6,0x0006adff5dcda747,0x0002c0ae9ac6c3b8,0x00043fbd1e2b53ea,0x0000078ea0f54690}, {0x000f20a5e8ce6254,0x000ad777565e4c2e,0x000b363af1f66cfd,0x000b0f41ded41ac3,0x00002253a8116966}, {0x0008d49e71e9faa4,0x000083e724372ab9,0x000555c121966947,0x000244655041d3b8,0x000044fa08b82d11}},
+{{0x000d5edc328fb01e,0x000205d026f4b57c,0x0002ab99d4a8f561,0x000df9cdfec25321,0x00003af0a948c796}, {0x000a5304005acdc4,0x0008dff23d5cd95c,0x000776f2ff5a1464,0x000a3aa239a5a5d9,0x0000019ed2c81cd6}, {0x000d92ad03c9b133,0x000e22887a3b1557,0x00069bd2c85cdaf2,0x000526a20a019a00,0x0000132a3cddbb5f}},
+{{0x000f1ba81d637b77,0x0007c8b1990ecb77,0x0008cc687abcaa22,0x0002fd2ec571bbd1,0x000007684fa3ba1f}, {0x0005ea526c311a30,0x000cb897239a96ee,0x000cb8437c6eb1c9,0x0005e8a7d3be203b,0x00007c27c20e540c}, {0x00071d4db9c35ba1,0x0005a55a5c36d860,0x000a7227d780765a,0x000afd2c61df04e0,0x00006e0b4bd54352}},
+{{0x0008042ec6ee4510,0x00080ce1f63798aa,0x000d558f8fc101c5,0x0008d84cd3527f08,0x0000590d1ca004fa}, {0x0003f69de507b844,0x000224429f132eac,0x000899bdfe491cd6,0x000a594b5dca4631,0x0000745cd798bcaa}, {0x00051f6b3978cc55,0x0008896d3b128dfd,0x000fb948afc69fe8,0x000fafaf8188a6bd,0x0000110b90339e49}},
+{{0x000814de6c4a98fd,0x000e47a8ca5ebb04,0x0005e50fe5a5f763,0x0003d8259b38270d,0x0000652bcbd86055}, {0x000d755d7c04d918,0x000a49f9f8f0fd8e,0x0006f13f477ab889,0x000be687b74bfa77,0x000033eb47b32bc4}, {0x000dd9e34523d39f,0x000b9df8be12d8c6,0x00032f5d2951abd0,0x0001d35fdbf158a9,0x00003599044e5153}},
+{{0x00087299ddb610fe,0x0008db8696c9336d,0x000ed56c8dec98d2,0x000023e3a910d85c,0x000007e35062d076}, {0x000ee3024ad805a1,0x00063a754be7dfdd,0x0006db3b5508e34a,0x0006e62618665ce6,0x000059954e020d03}, {0x000f71817eeacbae,0x000f34bc69a6d98c,0x0003fc156531ef97,0x000dda7c379da14c,0x000003a24118e592}},
+{{0x0007760f751cf4c3,0x00086ac560d9820e,0x00079bf3425d5480,0x0008c5ba01e868e2,0x00007f58b4b7b4c4}, {0x000ddfe1ecb71a55,0x0007099364650e02,0x000b5a107280694a,0x000694c9f90d7b57,0x0000699c0660a1ad}, {0x000d339b20120680,0x0003b5728260157a,0x000944ac36e652a5,0x000073a6b18a14af,0x0000101f454bec33}},
+{{0x0006571aa9519ae0,0x000709a43535db1b,0x000ae5c2afaf74e1,0x00074716e2b077d6,0x0000076538282669}, {0x0003e7f50fa4e65f,0x00094ba8e472ea79,0x0008ad080777042c,0x000edf5c99a11ca4,0x00006a39d69998c4}, {0x000c7b0813bfdbb7,0x00013b7dd2f40b6d,0x000aeebafbae12d3,0x0009269dc1ecff3b,0x00005c88ecd7bcd3}},
+{{0x000bb0bd106ec341,0x000e8e47c9760084,0x000b2c5e4ea285ed,0x000b5fbbf8fdc1db,0x00001bd07ea1d99b}, {0x000e8e860532fd34,0x0002071a177925e6,0x000f5c04917d8c55,0x0008f52033dc70f2,0x0000357f8cd4f9e5}, {0x000cfd713dac7e63,0x000ddd0b9136da19,0x0004da5b463efd7c,0x000c813bd6acbfdc,0x00002de90b049703}},
+{{0x00072710d9462495,0x000d2d57d5003a2b,0x0000b487ca3aa8c6,0x00072ece3d400bfa,0x00002dbae244b3eb}, {0x0000918b1d61dc94,0x000469a8130668ce,0x000fe8aad38ded36,0x000d43fd4e6a829a,0x00000a738027f639}, {0x000f4a2f57ffe1cc,0x0000de1839843980,0x0009fb15fd00670d,0x000a69c105c3f4a4,0x00002698ca635126}},
+{{0x000ce0365db62ef7,0x0003b382dbf84c84,0x000cd6506881a3e6,0x0002aaa74010bf39,0x00000f2d8f62ea92}, {0x0000acc375d88db7,0x000bb7ed3730c58a,0x000cd151d3e483c9,0x00094f76a0414df9,0x00005110120b5ea0}, {0x00013b6c6a76b36b,0x00083b5e550c2c12,0x000986d9f498d083,0x0008478f8d68a60b,0x000056ee448d2e49}},
+{{0x0000d1c67b92e35a,0x000ee2f786104066,0x000f23fe1307be5b,0x000769a837660c14,0x0000112ee60a4c51}, {0x0008fc58cd3b7216,0x0006ed405c0e70a3,0x0006097d86532dff,0x000d09e95b7bb392,0x00000b8a223293b1}, {0x0002eb6028410330,0x00055cf39dcbd547,0x00037b24b0e42e4e,0x00015ef985e0fca2,0x000031d7fe7dc3b3}},
+{{0x000192e77f19e463,0x0004cd4f77c54af5,0x000c5968652c8339,0x000b26ba16697885,0x0000792893ad92c3}, {0x00093be64934ae6d,0x000c0a96935c9749,0x0006a9e53d362e38,0x00003a7f9d57d4ca,0x00007c580b83d42b}, {0x0006ad904214b4af,0x000dee147b38df49,0x00089fe9e3e34983,0x0006aaf40baaa663,0x00007e6df82a5b17}},
+{{0x00009428abd1c54a,0x000e49ba349400b2,0x00072cf377da2c11,0x0007cbe6ca1a0b43,0x00000320d56fb98d}, {0x0007731b07bcb737,0x00043dfa95a27732,0x000a23a8bb9a1e67,0x0008e555ceba1491,0x0000345d8bbf4f36}, {0x000b4d490dfbaea8,0x000536ba4c89878b,0x00060300d4691020,0x000e1c3aa9b3f80c,0x00006353d388e78b}},
+{{0x000e50eb48dcfb0c,0x00037eedd36f3dcd,0x000b0ae54ec0bbd7,0x00009a01547d1782,0x00006bd27f273333}, {0x0007fc9a20169cbd,0x0008920818a57de4,0x0002d146a6032a5c,0x000536253af4cbdd,0x00002fccaea52b20}, {0x0002a57767504939,0x000c9b1716f07c64,0x0006b2f2449cde34,0x0003eda7ca957558,0x000076bddc7b9a8d}},
+{{0x0000fcd25bc0c47d,0x000006b0e825a372,0x000d5310a9583ee3,0x000d2a8a7b92318f,0x0000307b6ce8f996}, {0x0004ba8c9dc3c640,0x00076488a0686c69,0x0003408ab2057703,0x000b01986024690c,0x000050cd1f471872}, {0x000a7c95f55f5914,0x00046b64808a4d15,0x000cf8b95b4fda72,0x000c76431845727c,0x00001e3e1b2dbcc8}},
+{{0x0004e7ebfc38b3a0,0x0009d92ed282caac,0x00064d4abec5e7ce,0x0003070702d5d2a5,0x0000599ebbd10eeb}, {0x000d856e9d349201,0x0006697e314c4d46,0x0005b89930ff1f0c,0x0008d7d41e295859,0x00002b56c56e908e}, {0x00057174d3f1c8c6,0x000e3fc5f81be1e7,0x00037a162901b7db,0x000c55050962ea7d,0x000042cd471ae191}},
+{{0x0007563fbde123e9,0x0005a620564f74bc,0x000028344ca9bc1a,0x0000a53a8d083c89,0x000073efe5d7308e}, {0x00026c3581214360,0x00086732a6fe8fc5,0x000cb4399e8f3210,0x000aa8509afd7f15,0x000061c3e39eb438}, {0x000913f716abc23a,0x000293a8cba6db0d,0x0005609b16e5c54a,0x00023bcdc90ce3db,0x000000d2adec71ac}},
+{{0x00009b3cffe9000b,0x0009db52bd2b74f2,0x000170fefdc710c8,0x00053a29af68b00c,0x000011329ccc5885}, {0x0007d0e870e22e19,0x000e745427abd221,0x000ed805aab96347,0x00091316c7d2b346,0x000062f755db9af3}, {0x000814163232faf9,0x0008911a2efbbc71,0x000fc95e72cd4845,0x0000837862338ea5,0x000020eb21277350}},
+{{0x00030bb6d906390f,0x0009912af2f58879,0x0006ed8c1a440e73,0x000f595d194f363a,0x00000771664b72b3}, {0x000d881b556baf9e,0x0003f8a8f56dcdd2,0x0008ae7f92eb2984,0x0007ccb57c8de81a,0x000065074c38a85d}, {0x000641d1ea4c7821,0x000ef949f7a96391,0x00025ccc522fce38,0x00077521970bbcf8,0x000069bc92396e90}},
+{{0x000f922eac17aee8,0x0007bbade6b7c232,0x000c6c851446ab06,0x0003faa4912d4811,0x0000126851f08a67}, {0x000d67bdd4b27def,0x000872113c200617,0x000ef153620ac97b,0x0005a08791028549,0x000067a6f3b1bea9}, {0x00097c0b5188e7f7,0x000ef57e3a60b0d0,0x00037734d584f8f9,0x000bcd0b7a462837,0x00001e34baa79a3d}},
+{{0x000ecd7697179be7,0x00092af0b8d998cf,0x000c2e07552d6c73,0x000b4c36e74e0505,0x00002538c307e857}, {0x000814932c7c58cf,0x000bba8e39924d6a,0x000e709d5346c87e,0x000d6cf2f1d3a39f,0x0000149badbec8f9}, {0x000d59873be0acf7,0x00027a72f1fa7be2,0x0007ae82c9030114,0x000ce807987c8f01,0x00005279df008f49}},
+{{0x000045fd08454a99,0x00051a13324123a6,0x000c50d58aa169e4,0x0008a0a1fec7e78e,0x000075c43de7c93b}, {0x000612960704edc1,0x00072974a8249a79,0x00028a11302d063b,0x0009d088f51c1167,0x000016c46f995a76}, {0x000bc88c1deec5f4,0x000a9acb2b56ecec,0x000fdd89ff5038f8,0x00088e1ee4cc8960,0x0000227c39612c1e}},
+{{0x000ce7f4f8de3b79,0x000e4cc5664b2719,0x00092f020300cb80,0x000cd2a33fb09b72,0x00002155e6803ec1}, {0x000c08d6dbe8045c,0x00090059487a208f,0x0001369f6102acab,0x0001056519d15efb,0x000077db188db27f}, {0x000f43144cbdc883,0x000198800e24dfc5,0x000c65a9131d175b,0x000d64657d9afffe,0x00002dd421f442ae}},
+{{0x000144289f42513e,0x0002308f6aa27ebe,0x000cb6dd94cfce22,0x000acf736ccf78b7,0x00000efa8b3b8019}, {0x000bb56ccdca6441,0x000e652074dfafdb,0x000085c44cd6d41c,0x0000f228837d0930,0x00002eea961c5519}, {0x000095f2a2f102e2,0x0006ad82bec425fd,0x0003010833644bd0,0x000ac5ff1f050520,0x000070b6356b108a}},
+{{0x0005318832b0ba78,0x000f7925cff8be76,0x0000291fcc381831,0x000eb0708a81b91a,0x00001fb43dcc49ca}, {0x000d702f5e3dd90e,0x00018e4d253862e3,0x00024da96a9e3f09,0x00033325e773ef60,0x00003c004b0c4afa}, {0x000946ac06f4b82b,0x000a5a806c4f39aa,0x0006cd47871ca284,0x000d2173ed3265fc,0x00006b43fd01cd1f}},
+{{0x000bb0155800433b,0x00077b6560ea8a4b,0x000f58fff178394a,0x0008478b06e661f8,0x0000533b0cb628af}, {0x0008fbf08d27d902,0x0004dc9b102a6ce8,0x000d4943986cb177,0x000fa3fd8f97f7e1,0x00003a20cbe171ca}, {0x0006e99c1c459486,0x0007517c40f9c6fc,0x00018b402f405932,0x000a01623ac8d054,0x00005212b0070b0e}},
+{{0x00060c5bebdf9ba6,0x000f6cfea8e669dd,0x000f22a244cc3364,0x000521bd4694cbfa,0x00007f76f71950c6}, {0x00032521c8ec18b2,0x000f9b53959e5503,0x000df526b12d6c45,0x000c235c32131028,0x000021131f6e5c92}, {0x000a1a9a01a0f11f,0x00087d1165969337,0x000065b55d776530,0x000dad920cc06964,0x000004a968cac9f7}},
+{{0x0009ed854cf6bcd4,0x000f539922a595cf,0x00011e8e41ae22cf,0x0001dbd73855dbe9,0x00001770e55bff8c}, {0x0002ce224728067f,0x000dccacf4a4c481,0x0002814482a4fe71,0x000c1ee486c18b17,0x000056c49f7f9570}, {0x00021a4e3d570c72,0x00083fe7bfd05a20,0x000779f670f3a776,0x0004d8c13fc3a28d,0x00001c7fa1943c35}},
+{{0x000cb334700bd181,0x000b9862a6db2130,0x00017dfc918e69fe,0x0003780e55300f38,0x0000738c9e62b069}, {0x0002a2f0ee1af5d0,0x00056335a12a2377,0x000108993be90256,0x0001569a6afac62a,0x00004527cde1b71e}, {0x0000f4465ba5a684,0x00016f84cd07dce4,0x0003ba69683b505e,0x00037590bbb71f24,0x00000d74418812cf}},
+{{0x000a5729b8b7bb4c,0x0006c5df095c4187,0x0001c3824cb5e2b4,0x000d5c1363d281a5,0x000037130eb5b055}, {0x00020d28d67e3282,0x000b166e0aaf785e,0x000f1f3612fc3c5f,0x0006d2e37a4842d0,0x0000428897f5b952}, {0x000d7e68707a6e4b,0x000a45d004bec734,0x000ba911d58d9e58,0x000235f63c2d964e,0x0000754aa5d4238b}},
+{{0x000f231e3090cc07,0x000c876135ac5557,0x0002277f5e52de55,0x0000c5ddeece53c6,0x0000791b1e82ace6}, {0x0002c9a7e4a27653,0x000d29b82f9e7471,0x0005efb2ffdbed12,0x000864dd64320e66,0x00007b5cf9ac1b5c}, {0x000b0b6218145891,0x0006fd882649eea2,0x000834730f2cf13a,0x000bd41065323884,0x00001a4a88c6fddd}},
+{{0x000e8d27b967a840,0x000c6dd7dee033c3,0x0009e4fdf9cfa58d,0x000b7d76eaccdd0c,0x000075f8660238f9}, {0x00016a43c268821c,0x0001db5a64026801,0x000138c10d7b1e70,0x000d3c63dbd5b55d,0x0000298437e6cc1c}, {0x00068cda9e241fd3,0x0004058828202223,0x000ed22e55243225,0x0004b204a755b950,0x000067a0b9a0be97}},
+{{0x000185bce5aa66c3,0x0006315584acf625,0x00052d4f6af41a2e,0x000437b1224f80dd,0x000038f93abf814e}, {0x00008ed51a7a261f,0x0003a52e8693ddd1,0x000b541be3668354,0x0006f95c0390437c,0x0000537ede485d32}, {0x00083a02466cf3f7,0x00042c8704fce14b,0x0009eae26281ffbc,0x00011aa510c35ea6,0x000058fff26f14e7}},
+{{0x000026dc76b2a4bd,0x0005f84c589eed1a,0x00015d34769594ad,0x000d063765066705,0x00002ccaf709c500}, {0x000dbac4e0269128,0x000dbc8a75331d9f,0x000b9d923eda847a,0x00082cb97971045c,0x0000399ef77f21f7}, {0x000b97f331df2c1f,0x0006801ec31c8b57,0x000a8b0509f6b77e,0x000da8cccafa65ed,0x00007fb16f322a88}},
+{{0x000dcdbf642566b5,0x000ee16284637658,0x000a6e5b4e33315e,0x0003c5561542366b,0x00004be5079da093}, {0x000d7322591b4ba7,0x000592ca7f1af749,0x0003ae11ecc02079,0x000f81b1f48dc4d8,0x00004701895b7d02}, {0x00036cc8de72bd5e,0x000654c95a871a22,0x000923f5fc09ce45,0x000bc12d0fe87e62,0x000013831f0001d8}},
+{{0x000a1dd2f0e393a5,0x000101812d14b87d,0x0007ea2123b083a5,0x000c830cd964bf68,0x00004f58bd94cb23}, {0x000a7dec9dc006da,0x0008b3648c1fa4f6,0x000c80e301cd8814,0x000d367fbcd81b1e,0x000044cbb8a13ae2}, {0x0007d748b58b4816,0x0009ead110e00e88,0x000a8346ad6bc218,0x0005c09b703383c5,0x00004e494180b020}},
+{{0x000ef23f4ba9ecfd,0x000d44e3d7fd7b5a,0x000bad7b794506ed,0x000faa999e4902dc,0x00001c05eccce89a}, {0x00058bab22ac96f8,0x000ec04815a1b2c6,0x000df1e1d11b3e5d,0x0002a983b1448340,0x00001d16f5148661}, {0x000b0a430a641db3,0x000c1e94afecbdbe,0x0000290baad41003,0x000f493595a5d04c,0x00000a7d02e88f25}},
+{{0x0006dd4bbe3e9d61,0x000158a625d60850,0x0005e1d8b38d9337,0x000aa096acb3fb0f,0x00006d777e4688bb}, {0x000429cfe0bd7f7c,0x0001d68416b5d1a6,0x000028de0e3ed2fb,0x000ee638c2bb4774,0x00007a5668a6c9af}, {0x000608377c4ba503,0x0007bd2e66dfc95d,0x0003cb0625ff5e68,0x00071ae7bfc5f1e3,0x00003df595b6f62a}},
+{{0x00028c54442a7c06,0x00079b779c590642,0x000436cacce883fd,0x000426731758d036,0x00002ecbf6474beb}, {0x0005b6ce51df4768,0x000093bfb71a2532,0x000013757e22d068,0x000fb3ad217ecbe4,0x00003f9df99c32c0}, {0x00014e8e623bfca6,0x000cc8042710eeb4,0x000b33aa7e2728ea,0x00013fbdfe248fc8,0x0000337666cdf348}},
+{{0x000ecf23eb4aff72,0x0005a775ac9e4ce8,0x0004e0aedbcc0bb5,0x00025d2feb2bc417,0x00002b73ae73e672}, {0x000c53920ba845bb,0x0003fcccda8effa8,0x000741c47fa02ce4,0x00058667bd984d47,0x00000d6fb8a523c8}, {0x000fdafba6af3cb6,0x000b434565e14cce,0x00097cec0f676962,0x000ff0f88cb42f5a,0x00007ad568ead860}},
+{{0x00075d4b4697c544,0x00048df0fffbfc7a,0x000a46785a15fdf8,0x000f7142868b9eba,0x00005a68d7105b52}, {0x000742583e760ef3,0x000b9ee0ab990b5c,0x00072b923f75dc52,0x000d9f0bf1427c20,0x000073420b2d6ff0}, {0x000cf6cb9e851e06,0x00013c62238c4af2,0x0009fbf3738f5939,0x000bc9eda8ab8969,0x00003db5632fea34}},
+},
+{ /* slot=15 [{1,2,3,..,64} * 128^(2*15)] * G) */
+{{0x000b8a7559230a93,0x0006960e6f45d18f,0x0004a93cb51d168f,0x000d0fd3a85a9451,0x000038dc083705ac}, {0x0005dfa56de66fde,0x000002c40483ac84,0x0007b4f632e152a5,0x0001b65e9d2e163c,0x000030f4452edcbc}, {0x000d2782c5759740,0x00069f99cbecc856,0x0000ea4e71fa1345,0x00024698844fc73c,0x0000632d9a1a593f}},
+{{0x000c62f587e593fb,0x000deca5d3e71b16,0x0004cc3e6d4999ed,0x000dba8b491c1e01,0x000008f5114789a8}, {0x0004fb0e63066222,0x0008987acba3f330,0x000c1061a3fb3506,0x0008620bd1924778,0x00003058ad43d183}, {0x000c0ffde57663d0,0x00038a22ea610323,0x000c994f9a05c3df,0x000dc99bdc78abda,0x000026549fa4efe3}},
+{{0x0004d462de864067,0x0008e861404886bd,0x000d18f4f516156e,0x000a0dcfcefe07cf,0x00002aab4cdeb6af}, {0x00068d5ffebb50a7,0x0006b54ce640c698,0x000b9f9fd4f0743e,0x0008c83815a098bb,0x000016e05886620c}, {0x000fb012ea8a685a,0x000b37060b971b25,0x000116deea6ea0cd,0x000e00bf294d389f,0x0000121d162bda6f}},
+{{0x000b38d787ce8f89,0x000e24179a88d738,0x000151316db62658,0x00075c930738c9cf,0x000049128c7f7272}, {0x000bbc17f75396b9,0x000d7d2f8674604d,0x00053eabc669e6a2,0x00025d2c6409d99f,0x0000606175f6332e}, {0x0001370ef540e7dd,0x000f5a1f1d0a5402,0x000b06b8070910d6,0x000f2354634aacd5,0x00006a39e6356944}},
+{{0x0005c27b7db5f6c1,0x0000d76a447a670e,0x000019e9c1f75411,0x000fe68e7476fb8a,0x000012fff160ab3e}, {0x00074401de1f0b8b,0x0005a64352758865,0x00038e4ac86bd121,0x000d1bb509895efd,0x00006078628121b4}, {0x00083bac36dd6b3c,0x00074dc02529037f,0x000de378833e40cb,0x000dc0f6ecf90aba,0x000078da471a8077}},
+{{0x000d81adf1b88c86,0x000a831dd5817f80,0x00060b380c9456ed,0x0002d8dfe5dddb1e,0x000074b9962ff12a}, {0x000f90407ff40aac,0x0006f4feb12d294a,0x0004bc1863d5ff66,0x00051ffd34f46754,0x0000792e6ee065d7}, {0x0000531002d9d83b,0x00026588406fb064,0x00092c2a776d5747,0x0004eb7284b1acc6,0x00003e761555f0f1}},
+{{0x00095187577c6496,0x0005b3c2030bc06e,0x000b969f4390c154,0x0000e7e45340014e,0x00002318291c4bd4}, {0x000b093b01e8fb26,0x0001a1a0864f199c,0x0006c83066982799,0x000a259124ace20f,0x000070dd0d5c3332}, {0x000cff53fbfa638e,0x000dd5b5f906fbbb,0x00031391a1d563fb,0x000d5912c29dd45a,0x0000476a1b78de28}},
+{{0x000d5640df90f3e7,0x0000edbfa25ea96c,0x0009e33cc46c3a76,0x0002e5824f3ef095,0x000042889e7e530d}, {0x0001965774049e9d,0x000a198fe352b1da,0x000c5236a6fbcd6e,0x00046e2b1cbcd50c,0x00001f5ec83d3f98}, {0x000b23c3328ccb75,0x00007dd876ee98ef,0x000dfae796af42a2,0x0009f5120fbdadc5,0x0000241e246b06bf}},
+{{0x000279a3bfba8c75,0x0008dd4da31efb4f,0x0003999df952b59c,0x0004181de08c09eb,0x000014919d286131}, {0x000b342234c38720,0x0004f39dfb0b23fd,0x000234d58f14a081,0x000286f93a03ca2a,0x000068fa0077621a}, {0x000af3bc8bc6fcbd,0x00025992cbe3fbf4,0x000c392f08a93b0d,0x000a2428654d1d2b,0x00007e5772f65bfe}},
+{{0x00098a2f6555415b,0x000e2f9498020a44,0x0007b170ce3e197c,0x0009a6c07ece7606,0x0000344801b82b25}, {0x0004ce7012053bed,0x0000a3f38891df8b,0x0005079bdf1684b6,0x00020e35d8d83a97,0x000057333db8a78b}, {0x000d73be3680dfad,0x000a818ae391ba33,0x000c5f18de9e41c8,0x000dd7a218a8dc30,0x000067e4405b048a}},
+{{0x000b2178b9df8abf,0x00094a2759d67729,0x00075e4a5e2dff89,0x00028afb0e6a1149,0x00002da07d7a9b41}, {0x000918becdab4c20,0x000fe471a5789cbd,0x0007fece233dcce2,0x000cc7698c79dd0a,0x00007a97eda3a1c7}, {0x000df7aa601d2989,0x00066fbc27e77fb7,0x000e1f79683f01c6,0x0009a7e0f470b3f6,0x00004e225ed2835b}},
+{{0x00068e57ad6e98f6,0x000c80b46206529e,0x00051ebb4b4c9260,0x00090973f00862ea,0x00005bc2c77fb38d}, {0x000afc9a6280bbb8,0x00012f403d8097ea,0x000bfc8d2022a70f,0x00053ee31ce40bb1,0x00002bc65635e8bd}, {0x0005dc9fa96bad93,0x0007dde1947dce8d,0x0005185fa3e58fb1,0x0007830681532ea6,0x00001fdd6c3b034a}},
+{{0x000b1c9932a678c6,0x000c3d5b6cdd5fef,0x000499a4f0c44048,0x0003a5faddda6884,0x000063f1730c5ee0}, {0x00072295e5af3331,0x000c0176e94070d7,0x000bfa7c9eebca9f,0x000e65b1f8492223,0x0000086ba5215b57}, {0x0004fd5372cea6de,0x000052e9134a8d63,0x0008574cf502d0c5,0x000498fb0ddc5463,0x000009209d93fd84}},
+{{0x0008300997ecb7d5,0x0001e6e8243c66e6,0x0006ea7685fd235d,0x000dd13f896ba2f1,0x0000474fb8e1047a}, {0x000ebce89bb1cb45,0x000bde6cc2d39743,0x000a9c7d96dea084,0x00058434ff493b0a,0x0000354d55bea1ad}, {0x0008a2c01800d98b,0x0003c9b9b6851927,0x000f19907e067fa6,0x0004016c58c8cd71,0x00005cfbba3d0b56}},
+{{0x000be18267e9a0f7,0x0008c2ca7d7a3a87,0x000b7ee198b2ccd2,0x000b996536cefff6,0x00004c7ea6db6f4b}, {0x0006a35abfec5336,0x0004d93c84b28ea5,0x000c38721fd060af,0x000e5c0786b77bbe,0x0000094056fa8ece}, {0x000969fee6948af3,0x000a82c5d34be772,0x000c372588d88ca5,0x0006719a1a39cc7c,0x0000757eaa99d8ef}},
+{{0x0004e28c55dc18fe,0x000993399ebdd0a6,0x0000e2e652e3df9e,0x000cc0e79ac43237,0x000035ff7fc33ae4}, {0x0003a6a52dd8f7a9,0x0008c3efdcabf9c1,0x000e08f7b52dbb1f,0x000c9e5961e32405,0x000048c8a121bbe6}, {0x00015a7c59646445,0x000d7c128b615fc4,0x0005fbb912d224b2,0x0009fab6035c9c90,0x000042d7a9127442}},
+{{0x000bf077036725e3,0x000447c611bcfac5,0x0008d46505775d80,0x00035b975a1992ae,0x00000ff0746ae0e4}, {0x000f71abfe2c1b55,0x0007865a99452e80,0x000f9f026b131d5e,0x0001dfb1c769eaae,0x000050fcdb7d449a}, {0x00066d1fc0cb8469,0x000f54c6277165eb,0x00076cc436509a1e,0x0003a35233e0948d,0x00002a396d9b1cd2}},
+{{0x00087fd90aa04eec,0x00075445b74f7a2d,0x0008466c62fc1507,0x00060f074361d7f3,0x000038bccadc2de1}, {0x0002a033e9a105f4,0x000a8327dee6af7e,0x0007ae48b9530571,0x000c2098397c8497,0x000055510a09468e}, {0x000e7c932fd4b4a5,0x0007ed563ba65d8f,0x00045811cc897517,0x00047a0a16c5de06,0x000021e0322d8a2d}},
+{{0x000e21c350b84a93,0x000d8c8dc924a9d4,0x000acf0eb820a400,0x0000ed637a41023c,0x000012d1bbca6f44}, {0x0004b645220df4cb,0x000f1c4543222e01,0x0003f74dab8bd146,0x000a56431e198291,0x00002eba13aa9a93}, {0x000e6d3658da3480,0x000b9376fed2d60b,0x000cd7c7dc3535a5,0x000bc14227eaa195,0x000067cef3e12615}},
+{{0x000213e3eaf72ed3,0x0001a43acd4e74e6,0x000eb508cb679498,0x000b532ff547cde6,0x00006fed19dd10fc}, {0x00048947933da5bc,0x0000ec2e979eca9a,0x0003e5ac4c4a5892,0x000b14796d880001,0x0000453692d74b48}, {0x00075d99a8559c6f,0x00040df003e24dd7,0x000a928a66f42a21,0x000f22c5223e229d,0x0000063f46ba6d38}},
+{{0x00090fc37df0d93a,0x000a9718411d15d0,0x000689019b583a18,0x00014d8b7d058cd6,0x00007e56026eb040}, {0x000ca573fd94967a,0x000fd21c52c38e19,0x00061a290955e7a5,0x00077a25c9d4544d,0x00003a47eecd117d}, {0x000d3c44ecc195ed,0x000940dcf83f5b04,0x0007d0c7d714840e,0x000d36085aef2129,0x0000365ac0a7b299}},
+{{0x0003c8d1273f726c,0x000e4c0f831eb1eb,0x00024a22094f8474,0x000db8810587aa88,0x000026bc44bcf3d1}, {0x000f2e477cc1083d,0x0005f99eaa0b135e,0x000138b303c6d639,0x000c632339343c8d,0x0000130f919d5599}, {0x00040663b9859c1c,0x000bca924cd35e3e,0x000a08cacab9033a,0x0008fd92f447d4e9,0x000004739ea6eeaf}},
+{{0x000aa383f44ee580,0x0007e21e17566722,0x0004c76b4a8e371d,0x00099929d440541f,0x00007d85add1a89d}, {0x00087d3f6cc7cdc5,0x000c7e086416db91,0x000a9913eb693141,0x000bf8543431dcd4,0x0000657fe1f007fa}, {0x00072c1966ccad40,0x00009537c477d8eb,0x0005b5a512e9ede0,0x000f9d244ad8eea9,0x00000696d08cc8a6}},
+{{0x000242895f536694,0x000c542939b2cd2d,0x0007ddb95cca33a2,0x0002d5d986fada6c,0x00005a152c042f71}, {0x00043cb737346921,0x0000738c89447398,0x000245307ea747fb,0x000f068cb8d8031a,0x000067810f8e6d82}, {0x000b8fbcd2287db4,0x000a301a03e933ee,0x000d98265a72c7d3,0x000b4035473e88cb,0x00007324aa515921}},
+{{0x00021adac86e06e5,0x00050be09e6070cf,0x000289ac65be81fb,0x000e290f80fd7406,0x00001a6ef9aa6402}, {0x000f393f40463816,0x000ddced72d64161,0x000d3c839d2aac15,0x000a0326409a37d9,0x00000771fd997bc2}, {0x00026f793bdd366d,0x0007be64218ac780,0x0008e36ba4147531,0x0000d32d033c1be3,0x00000c03c7684090}},
+{{0x00089540450e1ac2,0x000fe79c3ac5d950,0x0003e7276c87af3d,0x000d0657695c4348,0x000024666664797b}, {0x0009bae72e9ab884,0x000135a8672a479e,0x000d04f307ba0922,0x0003921fb4b929e5,0x00000bf0c3c884d1}, {0x00038cc3a6562e7f,0x0002f49b3a794bde,0x0003bfa47134f8e4,0x000c9f2927e931fd,0x000070f98a08aff8}},
+{{0x0009c635c4194b06,0x0007c68489293f35,0x0004a2f19249b88a,0x000be686488563fe,0x00002d117fe51bc5}, {0x0009240d1e7ba1e4,0x0000f46562a26acb,0x0000ce327cf621eb,0x00034e428b4054ae,0x00000c7dfdbde35b}, {0x0001eb39daba0217,0x000ec36da33c4049,0x00039526d868d44e,0x000b4b37cebb24aa,0x000004979a03a9d5}},
+{{0x000942f46c3cbe8e,0x000b14730c046857,0x00023c41bfa1d364,0x000d5d21c8ed914d,0x00000838e161eef6}, {0x0003f6dae82354cb,0x0002ab6571a6dad2,0x00038e37d1696250,0x000312f9b651636e,0x00005cac5005d1a3}, {0x000154cce9e39904,0x0000b84de68468cc,0x0001be5d6e5b3a04,0x0001f02c4d8a61cb,0x000040fb897bd886}},
+{{0x000d263c32601135,0x000a8f2fef05b788,0x000ef7ac9ab3f83b,0x0004b59c166fd594,0x000030dac3ed2802}, {0x00022ab778a1589e,0x000e0970c8e642a8,0x0000a4e80ebc4005,0x00086097bd68df24,0x0000203e3708e824}, {0x0006cc31b76201d1,0x0003325c95e3fb82,0x0006d97640c4bb05,0x000a33192c61575b,0x000048af234055f7}},
+{{0x000586d9c540c079,0x00060e2420884242,0x000e2927ecfdf968,0x000d38bb05ec0659,0x00002f60c3b3008a}, {0x00063e6cccfdc88a,0x000b854178af6e1a,0x000b34452a7f5d9c,0x0005bd83ddae4d0d,0x000039162f2a4e16}, {0x000587bd97f31da8,0x00051954e797f308,0x00004e3951d56791,0x000c701eab08543d,0x00003a9a828ea460}},
+{{0x000a9454205f0a41,0x0009600fbf6ccc17,0x0005b22ad28f8bad,0x000634f1ce4ffcfe,0x00001868c660578a}, {0x00073578327e65f8,0x0009b89e552455c0,0x0001a58307bafc9f,0x000f4e2fc710e4bd,0x000053e62e3202cd}, {0x000502c149635a65,0x000f93820491f566,0x000bc364b19eaa2a,0x000d8e8b3daf50c1,0x0000054a91ac5496}},
+{{0x0005aa9062de37a1,0x000000d1d96e184c,0x000a9242d9421da5,0x00010da788286306,0x00003c5e464a690d}, {0x000ed8475ab10761,0x000206fd13746e57,0x000d02563271435e,0x0001e7b342f824ec,0x00004b16281ea879}, {0x000101d50b813381,0x0001176ee6828d1c,0x00083f6409dee60f,0x000484a0cb688933,0x00006183c565f6ff}},
+{{0x00040efc7c7dc2e3,0x000e119f9af93565,0x0008032093852396,0x000b915eaba8c0e9,0x000073ae687843ac}, {0x000e7f7ed06a1a83,0x00035729d4a69f67,0x000d05055b329bea,0x00004d58386fa2f2,0x00000bfda893dda8}, {0x000202ace702566d,0x000c4b17af305fa6,0x00026628132183af,0x000f0a84011c3b39,0x00000318337b4f23}},
+{{0x0000c98f0719abe2,0x000c39d4875c3e31,0x00063431f94cd961,0x000f448952a71c75,0x0000028647469438}, {0x00004adff17647b7,0x0007686b21c85f02,0x000ca3b935358f7c,0x0001794154b032ae,0x00004012aaa730dd}, {0x000c22a415b80aa3,0x000edbed4a73cecf,0x00086e2e58bb8298,0x0004a89bec43ab9d,0x000015f690f1e8e7}},
+{{0x00010fbe7f0b4fce,0x0004e71c0d932b4d,0x000a8f062dd18795,0x000cd8ea5dab8a34,0x00007a84e92ba6a7}, {0x000bb0b1bc61478f,0x000ef086601a2eeb,0x0005a0e8c7b49888,0x0009ddd7291518af,0x000021765a8f555f}, {0x000b97eb1f861f93,0x000d0f53ef6fe050,0x000b87f60a99cbe8,0x000fa49c05583373,0x000052dca0aae4a7}},
+{{0x000730c7a27fea92,0x0006dbe809793280,0x0003f78218393ed1,0x0002a0b7f9f5cda7,0x000066b899168393}, {0x0005c1489bde303b,0x000b226b684e85ae,0x000e90a4324e1da6,0x000dff1be380b2d5,0x0000318f51c2603a}, {0x00077e8cd2ede91f,0x00096969fafab24c,0x000035d0eee4b80f,0x000daaf2d0681d05,0x00007a16df4ffbe9}},
+{{0x00024ad8134b3ed9,0x0007df1193f885f5,0x0000bd5d494eda8c,0x00087524f507b8e8,0x00001e7892ae75ea}, {0x000a129e77b970a4,0x000f50a43049ceff,0x000377ae4fc599af,0x0003ebc07d2b42cc,0x000007b4293e8991}, {0x000b915a1e0ef293,0x000d00c6497993c1,0x0001d21f6b989f1c,0x0002235cd9ddae6a,0x000011a8b4034deb}},
+{{0x000fb69c13b844bf,0x000f091abc7b03f6,0x000275338b544d10,0x000606c20b0cbd52,0x0000529d177424e2}, {0x000c6663272dbd70,0x000d00639edc71f2,0x0004556786147eb2,0x000dbbbeb24905f6,0x000055d59d9ae387}, {0x000248040da90906,0x000533c957dd7d2f,0x000052f4cc9a41e3,0x0009f9df09698b7d,0x000051629a16ace8}},
+{{0x000a7832d3733014,0x000360ce448c3caa,0x00054699f0daf9af,0x000b63bc3caa511d,0x00003e87ce061eee}, {0x000d56c84f17621b,0x0004f7be0b76f014,0x00032c49c1943e5b,0x000b6d5b04d8595f,0x00007d2cf7656fa5}, {0x000f17a348764726,0x000f328055cf2a4d,0x00043bbd9782c844,0x00036288a651a85d,0x0000087468b0206e}},
+{{0x0005b05ad181c846,0x000631330ebd5934,0x000bbfa67b573307,0x0001c8b77886346c,0x0000551fe8ff9f8d}, {0x0009830e44efa768,0x00061b6485baebc9,0x000543e207f6ce61,0x000b8ecdb48c93d1,0x000062a6629750b3}, {0x0006e2ab64ec9ed2,0x000b214d47ef7314,0x000763d67c499d55,0x000c9c7789847032,0x00000e1966bf415e}},
+{{0x00074793d156226f,0x00074de1beb9c03e,0x00048031835cd434,0x000181bcdf1d3f42,0x00004f4d717508f0}, {0x000d48a89700b44f,0x000e0a8ef9754cb3,0x0008ad67ca16c769,0x000a01dfe192055c,0x000032accbe8176d}, {0x000b3e3445d48261,0x0004ed7327fe5ea9,0x00049dbd37f15a26,0x000f9ff0226d2fbb,0x00006a3a40baffad}},
+{{0x000c6513e7d8359a,0x0001a57b98e1dab6,0x00003ecc7c74985a,0x00007341343aadf4,0x000077294ff2c99e}, {0x0006ad42351c0258,0x00048ac449aa1ccc,0x0001edc3b6a19f12,0x000e9fa65c464f98,0x00007cb9b58f3281}, {0x00059ae330060fe1,0x00074d1bc1ed3a14,0x000c7ccc88a5e722,0x00041448e0dbbb79,0x000074db3fb9beb0}},
+{{0x000f278febf652ac,0x00007b55394412d1,0x000e19bf39a91dad,0x0003254709d9c69b,0x000018d092195828}, {0x00039537626e25ef,0x00028adcdde846c1,0x0005cec24634d549,0x000a7f996f163bff,0x0000310d536dbcc5}, {0x00049af564032fe8,0x000eb0c54336f432,0x000d29d208e6828e,0x0007288dd6aac6ee,0x00006bf18a8bc95e}},
+{{0x000d6c285e2dcaee,0x0004b92dee186606,0x00069024ffcf3fb7,0x000b36a90a4b7134,0x0000519a5232ba02}, {0x000541a4b634469e,0x000013373071bce2,0x000d4eedbf596da4,0x0001bc10dfa7b4db,0x00002b9cd121f88c}, {0x0006a7de4c1e99c0,0x000870da87e773b3,0x0002cd7745cdc96a,0x0009ed5f2a9c0c11,0x00001f25948b5898}},
+{{0x00010faf625e779d,0x00035b4f932cf3f2,0x000851a5517e5296,0x00009c62ac48db5c,0x000064d2c76eea4a}, {0x000a91ee52297c63,0x000729bae6a906d3,0x00090a9c21eae1d9,0x00088720e91192b0,0x00006d19ecbffd69}, {0x0009404a2c119e96,0x000f980371c15cb7,0x000de4dbd13ea986,0x000719ddffcef3dd,0x0000139fb4964d66}},
+{{0x000d14d337019938,0x000a195a9d2e3d63,0x0002c531a6bc7a32,0x00054205803458f5,0x00000ba4ff53a507}, {0x000612d576fdc57a,0x0003a0ba06efc095,0x000ebb9a844cf016,0x0001ce6d0589c59b,0x000068adf1a16631}, {0x00042af2ea8f4e9b,0x000e652f124065d1,0x000cc527b0015ab1,0x00043048dac772a2,0x00002931c702aa7b}},
+{{0x0003201588cd8b22,0x00070b19df0e03ea,0x00087e85a2e1d477,0x0008ba4116c74f73,0x00004d03cb02ea36}, {0x0008531fd38074c3,0x0007493ea6f2713a,0x0003d0fc8cae2d9a,0x000a38389460e1ec,0x00005f8d70e8de48}, {0x00053a5db5589909,0x000bf65a7a1eaa2d,0x0008aada174aeeac,0x00022fbf24f11d6f,0x00002a3723dcc0e0}},
+{{0x0008c95d41105475,0x000ba0e05f3af5da,0x000314c9f2816f1e,0x000a868bac0c126d,0x00004206956bc69a}, {0x000d05712d55de24,0x00040017fafb05c5,0x00094b87ea1c9857,0x0000be09a64f5f9e,0x00006628361fd05d}, {0x0001dbeabafa6647,0x00049c1e329cebff,0x000ed522e976ce2c,0x000d973a7dd45913,0x00007ee50fc4955d}},
+{{0x00095c7d92ac6acc,0x0008efe34625f56b,0x0005207e8e3db0df,0x0003f869b31119fb,0x00001dff2b1db9b4}, {0x000f5143fad1f23a,0x000ee5aa9f7e2d5c,0x00022d732d7c881d,0x00090ef416a8740d,0x00001104ff078aef}, {0x0009bdf82138c17b,0x000a1746791f7c06,0x00036bb4b468dbad,0x000b45644eca28a7,0x0000621eba2c4947}},
+{{0x0004f4a49671b42f,0x000fe973e99e86d5,0x000d78b19aff3b54,0x0006929d614f62fd,0x000034622f359963}, {0x000e8470fefd4ac9,0x0008c9d7742df6c7,0x000bfd5248ad17fe,0x000eaaff2eb45640,0x00003a9ff4e1b122}, {0x00014988f2b9175b,0x0007d9f7ead95290,0x000f29a3e7da89dc,0x0007a316d6d62d95,0x00006af152b912b3}},
+{{0x000dc65afcfd0c61,0x0004bf1076c186c8,0x000df6b6c05ef018,0x000f3c2aed77ce13,0x000057fdf0ca4b35}, {0x000a4869c22816f9,0x00020ad09e509c02,0x00050cb8a33b7dee,0x000d2115da2fd409,0x00006368e14252c2}, {0x00023f3f180520e1,0x000703eab5e53b78,0x000ec2bc22d1b399,0x000ba53378a1fdb1,0x000052b9dd019ded}},
+{{0x0004ae7877a37d47,0x0007741530ebb811,0x000c8b16ec06ede9,0x000aef675fe47285,0x0000610a22ea5ef0}, {0x0000846b2380ecaa,0x00023e3aa38aedf1,0x00064352d6560bfb,0x000d07ed9c09a1a0,0x000072e313d0bb3e}, {0x000080a0ea6acdaa,0x0002c7cc09a17e1d,0x0007f1976607550f,0x0005ca7b8610fe43,0x00002b645463c09c}},
+{{0x0008f454adef88b0,0x000552e102036ab7,0x00031efe57871bfe,0x000ca04a6667a8bb,0x00002dd25ae38981}, {0x00079fb0c11748f0,0x0002efafea925b92,0x00012e9a1d1cfa3a,0x00065c2368028ee0,0x0000491ad2ace164}, {0x000b6f6e1a31b8b9,0x00005d7e0d747630,0x0003fb17ba52bd09,0x000b718dbcea6ab4,0x0000030d9faa4400}},
+{{0x0004a5a7f5665e8f,0x000af7de4a8da056,0x0000f0816f723fcf,0x00001ef0d502c3ed,0x000006040a9fe0d4}, {0x000ed917e95139f6,0x0002f98b4afd2f64,0x00068979c457f2df,0x0000ab3aeba899e8,0x00004fb39e515244}, {0x0006e3cea320c04f,0x000771556fab879e,0x00014aaf37286171,0x000d015a4f592afe,0x00004f69969e88b8}},
+{{0x000d3403d52f4858,0x0001eb1ead78d582,0x0001ab31df0d46fe,0x0009df7272755718,0x00007f164368cc82}, {0x000ac2b2b17e0c26,0x0000d18509abadda,0x000e280646139b87,0x0007b6aafc5bf1cc,0x000011ece6b217ca}, {0x000a135202e7ecfd,0x000af6cc7fd1dde7,0x0005472bef076b6f,0x000c0d4b13d04863,0x000046cf8434533d}},
+{{0x0005e13c69f4d959,0x000a0b4bb86e1bbe,0x0006e3afc7b03c0c,0x0004d32e9d429d78,0x0000250a6d581cbe}, {0x000a8fc03a4f505c,0x00050f0055d1df9d,0x0004b705187ee6c7,0x00071022521e81fe,0x0000451a51e1346f}, {0x0008923f3ce13212,0x000cf340f84cffd4,0x00094d25851698ae,0x000c0f1d557f41ab,0x000042dfaf503c71}},
+{{0x00046b89875ba470,0x00034227215e866d,0x000b5406b6efb0fc,0x00013ea34b2cc913,0x00001230a29a41d8}, {0x000ea8cc057c5adf,0x0003453a78294390,0x0007d3f1f578f9a2,0x00029d28be775473,0x0000439bd5e44e5b}, {0x00052c6a1efaa275,0x000acc7754607489,0x00002db080469e89,0x000e8b3c8e737399,0x00001eab7a7327b3}},
+{{0x000fc1e5ed5a680f,0x0003ce5fe2ff052c,0x0000278371ad425c,0x000d6e4810eef814,0x0000194ce8e693d2}, {0x000c381fe9541ba2,0x000e1bb3a72ff9f7,0x0001fd6e1c037e8c,0x0003900124832eab,0x000021a773b7281f}, {0x000809181d2c3d93,0x000021a27cfcb8a7,0x000f54fab099d759,0x000d1d50b1fa0d23,0x000073b3c47f0125}},
+{{0x000241491f3fd0ee,0x0002b8748558c906,0x0007843a18cbcc13,0x0009e1bbc4563986,0x0000199475ce6f4b}, {0x0005f655d4b5992f,0x0000870c1a3d2b24,0x0002e12ff7dc50a7,0x000e138347aeaeaa,0x000040d9f806d07c}, {0x00025e72365ddd63,0x000e763f442e3d5c,0x0002a0004c4f6432,0x000924e5a6c835f6,0x000027e90a89e39a}},
+{{0x0004331aae7b72e5,0x0002831587cb79b5,0x0002c43beef13d25,0x000262337039624e,0x0000109e3c3ffa6a}, {0x000ec25173c389b8,0x000e22f2d57f5cb8,0x00044760da9f3a8c,0x000757bab1d6731c,0x00002dea78f3062b}, {0x000ee04f0a8a9d4f,0x0009f56636d63814,0x000177882db174fd,0x0002773ea4c7f2b1,0x00005f542fcbb550}},
+{{0x00098d353c8452ab,0x00030b34b2d38d32,0x000b411ab466387e,0x00030b719a203de6,0x0000239744285796}, {0x00095d7f4711e99b,0x000224fc231b9e8a,0x0008acd9c8c9c6b7,0x000f0079f5f91dac,0x000032a06a4c63c9}, {0x000234870fd7f711,0x000e4808347ff929,0x000df5bab2d4c523,0x000f04d17dd2b1f5,0x000005cae23cf18e}},
+{{0x000cb92e917b4d1d,0x00015b29fdd466cf,0x000fcbe1218e3ebe,0x000dc54d081c1cc9,0x000078b3827aade6}, {0x000451ceb94940cb,0x0001c1ff0d73a2d1,0x000be02100909af1,0x0004603215ce9c47,0x00001ae8d081b511}, {0x0000898534f60f0b,0x0005ce83d2c2eb92,0x000ef1be62b72c9e,0x0006f8166a48e180,0x000071e3d12cab4a}},
+{{0x0006525c9b7b21c5,0x00050e3f323c2c3d,0x000d1c01f365ee67,0x00033603182237bb,0x000012485f9e0597}, {0x000b8c30eb510532,0x0002e4d62515594d,0x0002336c5c4ff6d6,0x0004adcc0534f150,0x00002584230e4f1b}, {0x00056920dd9071d7,0x000d6d3ee4332ae8,0x0004a4115d55dda4,0x00002ac7a6f3c1c3,0x000026e49ee92820}},
+{{0x000d5a461e6bf9d6,0x000fc7777a581741,0x000474d3d92305b3,0x000e0ffd45574a26,0x00001926e1dc6401}, {0x00068549af3f666e,0x00004f14a0ea5db4,0x0004ba0c47d77fcf,0x0003c853df23ff7a,0x00003a10dfe132ce}, {0x000f4e8aea17cea0,0x000463a1fc1fde07,0x0001f2c0f12fd515,0x0005d15175322fd3,0x00001fa1d01d861e}},
+},
+{ /* slot=16 [{1,2,3,..,64} * 128^(2*16)] * G) */
+{{0x000d8845832fcedb,0x000c9ae6bf863739,0x00074ffef7fa38d6,0x000e45e32bc0dcab,0x000073937e8814bc}, {0x000e00c9193b877f,0x00090e0dc506bbb2,0x0006de649fece3a8,0x0009e1aecf3b7c03,0x00005f46040898de}, {0x00037116297bf48d,0x00022d4f06834b90,0x000696bdc6a9d13b,0x000e835e19715574,0x00002cf8a4e891d5}},
+{{0x0003fd8707110f67,0x000d37c38b5496d9,0x0002736a86dd4c09,0x0002a097cb16a4cc,0x00002049bd6e5825}, {0x0005487e17d06ba2,0x0001c3950196b2cb,0x0005978a3024d238,0x000a4f6d7659c818,0x00007a6f7f2891d6}, {0x0009fd8d6a9aef49,0x000be5b3db90b7d0,0x00019ebfd4f0ee60,0x000941d4c21b52c5,0x00006011aadfc545}},
+{{0x0007926dcf95f83c,0x00061712890715f6,0x00098f7a5b7c7e85,0x000f9e0d6a1e7f39,0x00006fc5cc1b0b62}, {0x000ed0c802cbf890,0x000ca0dff6aaa63d,0x0009b6ed99fbd098,0x0000b1e624d0afdb,0x000069ce18b77934}, {0x000f5528b29879cb,0x0003cd47e9092d1e,0x00089f2352dd1aae,0x00001f1127e04421,0x000015596b3ae571}},
+{{0x000739d23f9179a2,0x0003197d6ddcf462,0x0003f2148aff8312,0x0004dda1307deb55,0x00000d2237687b5f}, {0x000f31167e5124ca,0x0008bd9c745df09f,0x000ef556e50be415,0x000d138292b7d227,0x00003aa4e241afb6}, {0x000138bf2a3305f5,0x0008fa2e926c32cc,0x000549d2eb48583f,0x000a36c083ab1a25,0x000032fcaa6e4687}},
+{{0x00056e8dc57d9af5,0x000ed9df0bdf27bc,0x0002efe4a33e0bd2,0x0006a5caac014de2,0x00004627e9cefebd}, {0x0007a4732787ccdf,0x00008f213e3f8320,0x00060d964e17e319,0x0000be9d5b2ecd7f,0x0000746f6336c260}, {0x000af345ab6c971c,0x000729943731f3f4,0x000344186de288eb,0x000629333596a8a0,0x00007b4917007ed6}},
+{{0x0005fb5cab84b064,0x000d289f3bc142d8,0x000b15ce0c497810,0x000fd7b476adc447,0x0000122ba376f844}, {0x00041b28dd53a2dd,0x0005bdf42fc3f543,0x000dd2f8f4aa1790,0x000d37d0ff592d94,0x00001d03620fe08c}, {0x000232cda2b4e554,0x00042115d187fc20,0x000dd479d99ed0fd,0x000ec4c2eabb4be7,0x000002c70bf52b68}},
+{{0x0007ec4b5d0b2fbb,0x00090074882caa28,0x0001d0815c415c57,0x000f5e0e044a61ec,0x000026334f0a409e}, {0x000532bf458d72e1,0x000e07cb73cb5ace,0x000e8bbde75be768,0x0003a0356cf7d94e,0x00006b0697e3feb4}, {0x0008f04adf62a3c0,0x000ef076da45db6c,0x0009f0d2a93ef000,0x0002fae9c9cb9584,0x00001cc37f43441b}},
+{{0x000f565a5cc7324f,0x000c0e506a922508,0x000c45ac19d061c4,0x000314afb18abdb5,0x00006c6809c10380}, {0x000656f1c9ceaeb9,0x000f818e5656ad76,0x00044c23341c5b15,0x000683826e728328,0x00003a346f772f19}, {0x00055112e2da6ac8,0x00031b1e851edd2d,0x000ec67262e9bd03,0x000c5d0960746dd8,0x000005911b9f6ef7}},
+{{0x000dadbe5c067b31,0x000e9f0920e2b45b,0x000b5f6fc744c40b,0x000be814f36efca1,0x000000b7c294893f}, {0x000746c73c3002b9,0x0003d84c7afe761f,0x0005c3d20580d28a,0x000ba4df0c336c13,0x000046f5fb3408df}, {0x000d648a107d1a26,0x000a78655736a3e7,0x000e6d5dbc29cdcd,0x000634bcafb2bff7,0x00005912c4c51417}},
+{{0x0006f282b45756d4,0x000be2bb50bf1e20,0x0001be5774da2519,0x0004b7710fba057e,0x000060a4d0755464}, {0x0001583bfce4b850,0x000fa4df8e0c8373,0x0005e61999db3a49,0x000b45badae0965f,0x00007c203d2443cb}, {0x0008e43ce377cea3,0x000bbede7a9720ae,0x0009a683419fad85,0x000014f8b9b97569,0x00004d3ac9024d2c}},
+{{0x0009092d91c31ae4,0x000651748a38c0ad,0x000bf4522d969793,0x0005cdf3107468ea,0x000077ad86d75867}, {0x000cd7c9aac4f6c4,0x000b9665c6439838,0x000c9504d5544bc7,0x000342285209be10,0x0000051fd653ad27}, {0x000e51f9ab1f4810,0x000e5c2e741dc193,0x000d089fa9b39fad,0x000a73e2207394cd,0x00002f33e9d7d305}},
+{{0x000d1ae799dd139a,0x00081a481158b2f9,0x00031b6b76628c0a,0x000afd124d87c3a8,0x00005f87c486c741}, {0x00032a6537dbdaca,0x0008e2d26ce93a69,0x0004afe297cae728,0x00054a2cc29126c0,0x000040f9e4812b8f}, {0x000b3ea0370902be,0x00049e0a4553970c,0x000a16a5d5296b9b,0x000fa513cf06bdd5,0x00007dc3ec667ff9}},
+{{0x000ae4d49e68193d,0x0008cf369ce0f289,0x00031d0e0d4f8566,0x000878abeaaac241,0x000036b369dd1d1c}, {0x0008ab8175bbbcdc,0x000f14e028bd0b47,0x0002336fca4b41fe,0x000e58630284eb8e,0x00004b3325566afb}, {0x000479b18e86875d,0x000d6dfb989cdf39,0x000fe83eb4b7a96a,0x00061ca9fa61f206,0x00007fb772e4e909}},
+{{0x00005aaaa4e8c601,0x000f98451bab0c94,0x000a0cd1805d1083,0x000f5d970694983b,0x000015b4f930a890}, {0x000230ad3a72b96c,0x0008b1ac6431a9d2,0x00072f75471371bf,0x000fe6c3df694341,0x00001ff13cf867be}, {0x000ca507dbfb2197,0x0009e466c746fd88,0x00098215580f8296,0x0004ee3dacb956ef,0x0000272919bfb49a}},
+{{0x0006a294d3a84204,0x0005310d377107f0,0x000fda3f2f5c5727,0x000f8af6a079b535,0x0000396971efe3f9}, {0x000580aedabd2ade,0x0006aef84400e83c,0x00000c1a5bb68fb7,0x00047f62466c5d61,0x00001c13e998218b}, {0x0003686046ac9a8c,0x000b69192701e329,0x0000f2ca4cffdc8d,0x000560c7688bba23,0x00007bf8f7d051d4}},
+{{0x000cd756b637ff2d,0x0008fc987f0c4e9d,0x0003fbc7b7ec4c34,0x000ea87ced59285f,0x00003305354793e1}, {0x00018980c5fe9f94,0x00069716fd5c801c,0x000195a086cd6567,0x0007982816045c3d,0x00006e2b7f3266cc}, {0x00002468f7c3568f,0x0008219974cb3cc8,0x0005b813609de9ba,0x000ba62abb7229cb,0x000044e2017a6fbe}},
+{{0x0003a6a7db3bbada,0x000611c718c60a18,0x0000c388058bedc9,0x000e73fb08ac499e,0x00002938463ac7e6}, {0x0004f98ca144774b,0x000cac0647912b06,0x000181252686f4c6,0x000a757fa43e94a5,0x00006743f59813ee}, {0x000358f4d9f70106,0x000dd3e68f8095e4,0x0003c0a313158817,0x000013a0079bcff6,0x0000120e071d115e}},
+{{0x0005459740411415,0x000a98c6c19079d7,0x000427938bba1d4b,0x000c3b6d32275192,0x000042311597a222}, {0x000b0a92d337ee4f,0x000d1c77e64d4cdb,0x0003bb2b151ccd03,0x0009ec808dfaaf6b,0x0000665c085526b9}, {0x000e4f726169e4a7,0x0001bbbac92fe34d,0x00052f6f25c419f0,0x0004a0693e58a69a,0x0000328ba3000a17}},
+{{0x00056519c35c419f,0x000d08685572c2bf,0x00081bd9d663e3d4,0x000e538ba3f2ae8d,0x000068adb9f68b6d}, {0x00029036f18311eb,0x000360874905cae9,0x000b41e765ec1249,0x000bf20017b2ce1f,0x0000607db09377cd}, {0x0008b51140addcec,0x0009f3f6be8fa6a5,0x000c2160f299aa5c,0x000c7a75ec7e2098,0x00003eb19d226ab6}},
+{{0x000d06762d7986c0,0x0002dc6bc08ef0d7,0x000077cd5c153ae5,0x000bc8bd7c3f691d,0x00000c8fd9d57cb0}, {0x000c348d901126c1,0x00080ce230b8ca7a,0x00031e01afce028e,0x0008daef870be040,0x000044668af8c416}, {0x0008c434920c945a,0x000a6acd215a3bc2,0x0003e9017e13950b,0x00043ed32cb9e695,0x000069e8c9b04ad8}},
+{{0x000e9641a66728e3,0x00079c0fbd429ad9,0x00047d323fb6ba54,0x000750b2cd3e884a,0x00006f369b48b695}, {0x000d26cf4cc6ea2e,0x00076025206c29b3,0x0002a07082a28fa8,0x0007f2b55144479a,0x00001006f99ba510}, {0x000d581e1f83f7e7,0x000e2504147232ab,0x000bf68d56b3ec50,0x00087e8b80fc4eba,0x00005c3f9d3ba8a2}},
+{{0x0009e281809461d3,0x000ba4da21ff5e47,0x0002c11979a3ca89,0x00099988ab3103c5,0x000020401a18ad8d}, {0x00020a4c0e45685b,0x000c6e65e0624c91,0x000c102af3631089,0x000a07d34ce093dd,0x0000583f7122b1f1}, {0x0004f2effe815ef9,0x000d5088b31edc7b,0x0009842b5a7c7aed,0x0005cd719d70aad9,0x0000433b9bf5b75a}},
+{{0x000ab60647a9f507,0x000f87b22fc774e0,0x000ba26ac4fddc2b,0x000550c4cfad35b9,0x00001d7933687d9f}, {0x000aec83f6e26a4c,0x00021cfc021de3f6,0x000a97bf769f6981,0x00044b6911965a4d,0x0000249d046e81e5}, {0x000a45e81c9a8c0f,0x0003e4ba31386238,0x00071a0f454cf38c,0x0006c8f486256281,0x000029b62fbc4d42}},
+{{0x000eb8861b7b4c26,0x000400dd559160f4,0x000d070b5dfbecfd,0x000cdaf93fe9990f,0x000067e10a615cdd}, {0x00045331f255c3bc,0x00022f46b3a3076c,0x0000ce41f330cf25,0x0008a57995527d19,0x000030e028773e84}, {0x000d494b28efa40d,0x000c7a7bb5b8b54d,0x00071def715cce12,0x000e0009f977c7a4,0x0000775371138697}},
+{{0x000b968689edbcf8,0x0007e6425918acda,0x00093e65bd2364b5,0x000b34cb9b960935,0x0000101f1a769c65}, {0x000a4fd25fe6c945,0x000bf165a330f7f4,0x000338db4f5671f5,0x000749f45d8dcd67,0x000007eaa12c017e}, {0x0000e739f84a4488,0x000bf25b0b2886fa,0x000a973165081ec8,0x00006a1e1157684d,0x00000b204ec85bf6}},
+{{0x000f25971ad33a39,0x000812c4d96e0bb9,0x0008b9f5fa3841b9,0x0007b9c462c9ff5f,0x00003afd11b70e1e}, {0x0001a45ef7e4e5a7,0x0003cadb9f968d21,0x0001ad4ac6d3d06d,0x000432b113481543,0x0000695b3bce2dde}, {0x0007ba1e7afdbf2d,0x0007a70c4b2098c0,0x000d0453f13005bd,0x00000b73e2cee1c7,0x00001f7170b32529}},
+{{0x000c4be4f6b58c55,0x00080e1587ca643d,0x000ab50513049b91,0x000e92648a55cb2f,0x0000745e8524b930}, {0x0006f1ecd1659ba1,0x00027fad80c634d4,0x0009b07d3da47d3e,0x00035e7dd90802b1,0x00006284275e9930}, {0x00002c91e1e28aa4,0x000ce2916a55ae01,0x000711de2a983a4c,0x00000765e22d0166,0x0000111a33c442a7}},
+{{0x0002c69c4c28e79a,0x000f8513057f2876,0x000e4d8b31ad0aaf,0x000a77d51f034e3e,0x000011f642fa9d91}, {0x0005cf7317f041b5,0x00045cff59b1de53,0x000e5d8d65d65116,0x000d9f81ad4e6e6d,0x0000388c7ddc66f3}, {0x000694dc81b0afe7,0x000781403d2ed067,0x0009e531b8eb5361,0x000637523dbc0ceb,0x0000097c7f33ed10}},
+{{0x000653f51f5822d2,0x000b0d47483a502f,0x0001cd9dccee7714,0x00053a02fdacf5b3,0x0000115899d9b509}, {0x0001cb5551780165,0x000fa2ea6aa06b19,0x00054377cf298c5b,0x0001eecfaa56cd13,0x00003b53cd9951ba}, {0x00005602c8c65685,0x000fb1af169eddc2,0x000372c6e9b9d0ac,0x0007667fce958e25,0x000035f00a7f677e}},
+{{0x000e85e1f47c9488,0x000064f7d3a0240c,0x000429c10f7abf84,0x00069ff1d3a0b03c,0x00007557ade881d8}, {0x000ae656bd31fd16,0x000c8870924328b0,0x00004f837860bc54,0x0002b1b8f6677cd1,0x00007ff86e5bbca0}, {0x000a626b35ff41fc,0x000f6cdb7e1b8e20,0x00050f6965748c2e,0x00037afb201d86b9,0x0000440f7a6bb885}},
+{{0x000ebf7b8f3f0688,0x0007ccb3652ff6d0,0x00029a4e214b120c,0x000ded5822b7450b,0x00005ba8e6118c76}, {0x000eee31f24fe03b,0x0005d2af0775b2b1,0x0005e7fa6a058c9f,0x0007acd7f87c76b1,0x000073894948e8d1}, {0x000a1701a1f90a7e,0x000db67905decc87,0x000350fcfb2f7946,0x000e83d9e6b5977d,0x00004cbde0c565ad}},
+{{0x0002a74354dab774,0x0003c4eaf031ac4c,0x0002838f178e5d4c,0x000e4eab76c23d24,0x0000749a098f68dc}, {0x00082cf3b6ca6ecd,0x0003e18f4a0c287f,0x000604e557580f89,0x0009c1d058930072,0x00006cab6ac256d1}, {0x000fe0a02cc1de60,0x000ff51c5575bdcd,0x00073abeeb032665,0x00086062c0c32f10,0x00006a882014cd7b}},
+{{0x000adf28658e3202,0x00062437e9bc0139,0x00072d24e0da741c,0x00004e6d14916f32,0x000038cbfadbd9b2}, {0x00028f11496638ef,0x000a90c06bd26e61,0x00080586446733a3,0x000e3b8a72600986,0x00007e6c6d0995f7}, {0x000209b4b21c6655,0x000ebaee3114437f,0x0001a99c56f66636,0x0009a33287da9b58,0x00006bfce25b6206}},
+{{0x0003d809437ee823,0x00092b62a4421a1c,0x000bc6970b52fd79,0x0004dba41314a907,0x000036a6ce9c7084}, {0x000f1aa4133b3720,0x000f00d9a65f1e95,0x000d1da1b04b51a1,0x0006bc73f07983bd,0x000009b98eaa14f4}, {0x0009310b573cfe28,0x0000d6bae1f6e0bd,0x000c58fbc9a0b783,0x000625958f0d9e32,0x000007451f157f8a}},
+{{0x0006500f3af0c940,0x0004ff11b81c8b73,0x0000c42249456901,0x000bd5d465433e4a,0x000065e02bc76087}, {0x000aa07a7777a095,0x0006c1d91fcdc079,0x000d1fe6866148f5,0x00022b0428c693d3,0x0000547063e50fcb}, {0x00008ade044bc1a7,0x000a9db4945fb84f,0x00027c39e3a0a836,0x000ac2efe9f729d5,0x00005588e2a695c2}},
+{{0x000bcf1f1e361338,0x0003018c0e4337bb,0x00089328cadb0208,0x000c68630d5cd1db,0x00005880dd9484ec}, {0x000b284377abe4ee,0x0004fdc645eef968,0x000b54d70ab0748d,0x0002ffb500f2ee6a,0x00002ebd93f5232d}, {0x00000836b0631b38,0x000c4f982fa90590,0x0004c0b3e8595cd8,0x00003365f3da0381,0x00000bd3ba677546}},
+{{0x000152cda73d5aeb,0x00014dfe748c9f20,0x00063a24a4f380f9,0x000b7ca5c6d9e35d,0x000013bb1d88b3f5}, {0x0009a240e99bbeb9,0x0003db2331b7000f,0x000eb2d5ebef1b13,0x0005fa81ed8dce1a,0x00001dcb6605f05d}, {0x000c233173aa302a,0x000d697a5fd8ec36,0x0003bb4bc98aecbb,0x0004ea49cf96e572,0x00005dd74ce686a0}},
+{{0x000fa0576589eadd,0x0003057b1dc5eb88,0x000eeed606486cdd,0x000c16484f9c4a46,0x0000473159cd37e2}, {0x00025749f6b4dfae,0x000ed5781a5c541a,0x000c325896e56a26,0x000a3ec790b9b59b,0x000045f7d2fa4181}, {0x00014318f7b2bc83,0x00025576fa3ba8aa,0x00097b0b9a51c384,0x00015ced7fe2e982,0x00002b6b6fb29fec}},
+{{0x0009b6f65aac1d21,0x000a55037b8ac73a,0x0006b6f6b8da19c7,0x0000316691257caa,0x0000253af6e71598}, {0x00000200f5539f0d,0x000cdb2b83a4c684,0x00083a76dd2d695e,0x000d2e72c51678ff,0x000053a6fad82e2d}, {0x0006f5425cc4d7ab,0x000aacf7a3d0e11e,0x000e34c1f7b2cf5d,0x0000f4f2cee2f4c1,0x00004f2b24d74433}},
+{{0x00096c4e649af993,0x000a95af374a422a,0x000bc22c26b39809,0x000e5bdd96d0d4ec,0x000037f64cb15156}, {0x00090fb95d022d73,0x000fa27bc3056b89,0x0006c76485eb4f37,0x000ac1a69c695967,0x00005234d813e43f}, {0x000dfc4204443050,0x0001c0f8f241c260,0x000c4486af8e267e,0x000dd3e993558e28,0x000047b1a81642f2}},
+{{0x000aa77ce192d046,0x00044efa47927f3e,0x000d721c31f1a728,0x000fda401b137926,0x0000574b1e9f979e}, {0x000cdd7c964ae6e5,0x000e2ddfac0dfc03,0x000888e28b6b808a,0x000b6b1c557d92a2,0x000069ff7e3aa980}, {0x000ad6ad127c4a25,0x000336a241dafa7c,0x000caeec7d70b866,0x000113c804047de6,0x00005dcb40b60e8b}},
+{{0x0001cdb41a3b1700,0x000c9abbb3a53252,0x00054e9cf7c0fe07,0x0005c7614d0afe60,0x0000388428dbae59}, {0x0000c6ebf48ed3fc,0x000c861402951dd5,0x0007be0a84198c3b,0x0009ea4f45273bd6,0x000019840043d01c}, {0x00001e6fcce7894c,0x000bca3be0bc775e,0x0001a723e2b8a034,0x00031c13cf8bca37,0x00003dd1a27ef8eb}},
+{{0x0007ae44c5162125,0x00075690fe65f99e,0x000b24453ea8a6da,0x000fb5896ecc5125,0x0000478cc1af637c}, {0x00091d4c9c56b04a,0x0007a5f90f0c6f3d,0x00012f288d1d2468,0x000f1660f5de6ef8,0x000042fc3ee0fb72}, {0x0009349948e86496,0x000c90ad7e49f9d0,0x000b61a20ce213a6,0x00076dd3b3375713,0x000046a69f17edc6}},
+{{0x0001b40e3e81f13b,0x000eafa3d4857693,0x000524f2c3b50c34,0x000627153213e454,0x00001c27bd4227d4}, {0x0001add0254761a3,0x000458c312310d5c,0x00093961aa63a543,0x00040daf7c718fff,0x000036ecdc750014}, {0x0001146b6be00817,0x0001759ebcc0ad15,0x000d5a29c643391a,0x000cf6ab28d3a60b,0x000036e475859e7a}},
+{{0x000547af0c62632a,0x000f1c53db003456,0x0007b9adbc16c32e,0x000ff86158dfcd32,0x00005ea64be1156c}, {0x000d61ab2db45586,0x000cd34684af211b,0x00011e12958fec48,0x0008eb0cb14d1e9f,0x000072ff8adf89fe}, {0x00039d025c7b7a49,0x00091ebf45159976,0x000fba42dcfde8f1,0x000d48cd6fce51af,0x000022536263c197}},
+{{0x000ba8e3a3ac42bc,0x00061e352080ce1e,0x0000c4e1374a6987,0x000aab1f0e41a282,0x00003d6be0635a36}, {0x0003f59719803200,0x00070ece6054ee7c,0x000562117f3977b6,0x0004a6d27954e205,0x0000372d82ef54a7}, {0x00054a39af7c0f47,0x0008a6168eee9227,0x00029ab040f0db44,0x0007132c059e25a6,0x0000337b0756b614}},
+{{0x000bea0c0546526c,0x000cf41c52f5e5dc,0x0001e3a1fc7989a8,0x0002e46093c5b96c,0x00001dbcf4e69c24}, {0x000a7783812cccf1,0x0001528d06b0a400,0x000e885a3182a3db,0x000daad7c86ea4dc,0x0000792c0e41e9de}, {0x000ef57b7c5e4829,0x000b7de3e6a2ee84,0x00026283abb24972,0x00074823b1f0c777,0x000049967e924a82}},
+{{0x000a92fea4747fb5,0x000491fa5ab89a52,0x000847a4cedc12a4,0x000cc4ed82da94bb,0x00004d77edce9512}, {0x0001d17caf4feb6e,0x00042b33aa4a3d11,0x000eb46c30050bba,0x0007d7517514c3ce,0x000054bedb8b1bc2}, {0x0008e14577e2189c,0x0006aff99c44577c,0x000d335343a3e46f,0x00016a93144dfc86,0x00003a96559e7c42}},
+{{0x0008c9e4d56a880e,0x000370583fc417b4,0x00001d1090fb1401,0x00016aaf0416d1a1,0x000044145758ddee}, {0x0004a1b248b6ff97,0x0005326ce91cdc85,0x000fff1a19a27004,0x000c6a3899a9bec1,0x000060e6419f195f}, {0x0000505e3a6ad4de,0x0000a8a227da32de,0x0000d7639934e1e9,0x000b7d2372233e84,0x000018e2de19984c}},
+{{0x000710b46be7eb6b,0x000f775571337b72,0x0000df8d7fd62b8a,0x0003d15cd6a72e29,0x00007954582a44a5}, {0x0003f6466f8d9f96,0x000413aa48d9625a,0x0007991300d331bd,0x000b158020d366a5,0x000075f7e27dda33}, {0x0002d21938efe9fd,0x000a642a49cc2024,0x000ac05335382427,0x000b13164cf36bd0,0x00004e51f35fb479}},
+{{0x000acfccbfd4ca0b,0x0000c96d8cec4cf3,0x00067f458d4ab44c,0x0009094547dad6ee,0x0000285ec6a61dc9}, {0x0008987f5eab8aa5,0x000632bd4bd34cd5,0x0006856c79ecba70,0x0004683e7e45eda0,0x0000096f59fe0f82}, {0x000f51c90111182e,0x000d16fc19037672,0x000be34636f5ba1e,0x000b936af2d750d6,0x000043b7aaca260d}},
+{{0x000f55f900c0db80,0x0003de070db6e04e,0x00033df26a9b9944,0x000e8812831b9231,0x000000ae6356042c}, {0x000431edd8672f4c,0x000dbda4f5557b00,0x000c803ece07fea1,0x000317a02b1c3cbf,0x00006a20ffe866fd}, {0x0009dc4ff3b173a6,0x0008ba5cb2b3c085,0x000e881005e8b1d8,0x0005c577eeb30bff,0x000073cea5fed022}},
+{{0x000ab5663931ccea,0x0001166809443eb8,0x0007d2a80b57d69d,0x0002027a4fbb1107,0x00004dd43aa3d5b2}, {0x000e0f9cfd1b173d,0x0002a7c5e28224f1,0x00095e98dcb8175f,0x000af2b40698a428,0x00007a258b82c735}, {0x0009cb57827ad5d9,0x0006df3b4d81e083,0x0002f463300402f7,0x0007cfcfaeb01525,0x00005ab0be61987e}},
+{{0x000125379919b1d9,0x000c96173ce56a8c,0x000cfdf5b49483b2,0x000ae6f074d54a61,0x00003f11a205872f}, {0x000963b6faff69a4,0x000d0cf5d1e248c2,0x0007b29c8fd174c6,0x0003140b354899f6,0x000017f8ec071d7f}, {0x000fa5c3c87504bd,0x0002bfbb5626fa88,0x00006e30ae669612,0x000baf002f4ce830,0x00000cfdc595d2ec}},
+{{0x00055d6c443791e0,0x0000932048702326,0x0001c8654d6e507b,0x0008545a50c9b490,0x000022905859a752}, {0x000decaa53f27050,0x0007df44cb9bef72,0x000dd866eaa10820,0x0004331a6e4b280a,0x0000159f14a1e6ef}, {0x00075ebe6fbf7dc3,0x000820f0382cc366,0x000b49a71eb4a965,0x000d34c1ec87e541,0x00003a2578c559ae}},
+{{0x000c191f504e7d9f,0x0007320b3f24ee55,0x00058cf8c071d922,0x00098c98145a46d8,0x00001b7897b0579f}, {0x00017abed804803f,0x000e8bb8106ca5c0,0x000d7a674100fe6b,0x000cc9ae7731c9d6,0x00003d5c5a3e74c4}, {0x000b23eb77b91b7f,0x000d5374ae02a32f,0x00015667d484a00f,0x000e98329552f23b,0x00004a6929b5ea26}},
+{{0x000db6733d469887,0x0008685c926a75ab,0x000acc618efbe473,0x00057e2dba10e3aa,0x000025568963a5c8}, {0x0005738947354c74,0x000c1220e428d1d4,0x000af8ab8683e8dc,0x000e41bc0194deec,0x00004a8bf581c2e9}, {0x00004fb081ed64cb,0x00031fefc1d4c16d,0x0002823343a9cbfc,0x0000b7cc57a72299,0x0000436071166fa6}},
+{{0x000f16a1fdb6cbf4,0x000aea30d9c41ac8,0x0009489af08da8ec,0x000e61735defce0d,0x00004e522051fbbe}, {0x00039533b017db9f,0x000b2d835ecb7b6f,0x000bba63ae844030,0x000ead4f2985b0cc,0x0000650d4bc939be}, {0x000ae6c8b85aa67d,0x000ac497f46034b7,0x000413b47b214cba,0x000260ffdcd19138,0x00002d0a20ade52c}},
+{{0x000a1c92edd76c39,0x000b3eeb774aa444,0x000a742ee25ae0a4,0x000f5850ee06333a,0x00001f9ecf4b31a9}, {0x000c1601adef4959,0x0008c69cca7d01a9,0x000614b20f8e8bf1,0x000781b52762419f,0x0000357b130a707d}, {0x000da5a6426e8c55,0x000d609070da5a63,0x000a32742fd9b0c2,0x000f0e7159c1efe0,0x0000220c85959d2d}},
+{{0x000be5f335a4f65b,0x00002e3456c192a1,0x000939ee5c849560,0x0001a42854eed359,0x000000a078533c73}, {0x000a85fadd9d766f,0x00056219f759a5e1,0x000083b31895bbe7,0x000a7962eb939ef6,0x00005f9d67df0466}, {0x0001f529c0404218,0x00083fc8483de183,0x0001fc045d2db056,0x0008a520855be248,0x000046c691c13805}},
+{{0x000d2a14890b46e9,0x000e5af0641dc0b6,0x0007a4800ea30378,0x000e00829a34390a,0x000012c7cc9159eb}, {0x0003451fa2b4596a,0x000ec24b994cd09c,0x000c534aec375161,0x000b1115f7f6f5ad,0x00001c4017e6c4e4}, {0x000e2d815d8560af,0x0006612247f279e7,0x000e229fdce15c19,0x000e930f637aaa10,0x00000d61c20ccc41}},
+{{0x000b3ae88d07d775,0x00095ae21800ac0a,0x0005bf276cf19cce,0x000e96c282b2b886,0x00004ba6a11d10de}, {0x0008e540b74c3391,0x00033d51c7b2d733,0x000965db99327f96,0x000e47fce317b009,0x0000450d4a408182}, {0x00099d6d4b9819d9,0x000244fe03190987,0x000e679b0538d4bc,0x0005aac142800b39,0x0000039928a3aa02}},
+{{0x000c561f5751c314,0x000a059f3b9be8d4,0x00008a322d6ecb74,0x0001e4715bfe3080,0x000015ec5878f2bf}, {0x000d613db3d87540,0x00037974e00042db,0x000fa4bbf97d2f7c,0x000e67c3c41adbe1,0x00002d4dea5d4e5e}, {0x000bce0ff9ad1eb3,0x00052adf0ea0231e,0x0006a6275626bc45,0x000edd8f51a8d3fd,0x00002d73bbc866b3}},
+{{0x00050d37f42ad2ee,0x0000498a1fbf5125,0x0003894cb28b78e0,0x0008d0c5d5307823,0x000002c84e4e3e49}, {0x0003896880baaa52,0x000c4f285940e449,0x00045448b64c98af,0x000ae7fef4aa79ba,0x00005278c510a57a}, {0x000dd074294c0b94,0x000b8df18ffb6a54,0x000dae8366f55d46,0x000d165f06fecc58,0x0000588657668190}},
+},
+{ /* slot=17 [{1,2,3,..,64} * 128^(2*17)] * G) */
+{{0x0004e13f201839a0,0x000e23e3df161bfd,0x000b5d1fe3aeefff,0x000fbc0b65b04f06,0x000052e085fb2b62}, {0x000d43f89e92ed1a,0x000eafe4719c6185,0x0006f03f4fb04a1e,0x0009bdd499fbe88a,0x00005d8b0d2f3c85}, {0x000079eaa54cf2ba,0x000eb001b26e7124,0x00097af7fdd72465,0x000cd026843bcfdc,0x00000524b42b55ea}},
+{{0x000c84debfd3c856,0x00048b35ff244cba,0x000d9cad071624c3,0x000ebe8b7f88dca5,0x00003b0e574da2c2}, {0x00022591a5313084,0x000aed62708721d0,0x000f0bfd20ca2d4a,0x000a74886a12b852,0x000056e6c439ad7d}, {0x0004ff4942bdbae6,0x000e2b2de1f79c70,0x000652fad85e21ad,0x000ebc1e95db3f35,0x00000822b5378f08}},
+{{0x00065de66045d92d,0x0007f3e94e85168e,0x000b97d80f5ff626,0x000a7dd5f4f0c6e1,0x00002c7377aa767a}, {0x00076e584e550800,0x000f7006d70006fd,0x000b484cef0b3876,0x000695f0f3a08371,0x0000321eca56a554}, {0x000f4f83a27d4488,0x0003c642518905f6,0x000febac40cb4219,0x000c3a3e450257e9,0x000075d570693b62}},
+{{0x000048478f387475,0x000f49cbecb3c51f,0x00099f2055b25dbc,0x000a5d69aab1244d,0x00002c709e6c1c10}, {0x0007f29362730383,0x000ffebca8a2ce1b,0x000fd413144b5279,0x000610fdafc778ab,0x00007deb10149c72}, {0x0002af6a8766ee7a,0x000045553cd0ecb6,0x000f0be4b566cbec,0x000e2ea588001380,0x000008e68e9ff62c}},
+{{0x0009cc228db57860,0x000b8b2f55091392,0x0008950db5f61925,0x0000035d5f5ccf44,0x000063520c2aa2ca}, {0x000261bf9c050156,0x00001cce4d6b7a1c,0x000f8a0a193e5502,0x000833f714a208e9,0x00000d85fb5a5bc2}, {0x000b0c2436bf333c,0x0003f0975cbfc9cc,0x000bf7a8ba86efde,0x0008a2eaf1d101fb,0x000028a941e663ad}},
+{{0x000c83664e739fc4,0x000ae9cfdc3a5f61,0x000762796fc31a8a,0x000016ab39e1448c,0x00002ec2d73cdf6d}, {0x0004dd322ee8cfc4,0x0002752e58646a89,0x000ec2d62ccfc6c9,0x000fb117eb4e254f,0x000071cc8a9f362d}, {0x0008b443c74e492f,0x000f0bb4d9acec3e,0x000e6c2b591ee261,0x000600f25e9a6465,0x000078e6adb6afbc}},
+{{0x000126d5bf03a80d,0x0004d6e77d593486,0x000890bc025dfa7d,0x000f6f6ff2cab899,0x00006ea225c7be4d}, {0x0002319c6769ddb0,0x000476333585e4dc,0x0000dd5cbb71bc0f,0x0006a9196e01f96a,0x000048160397d2bb}, {0x0007ec900d3bbe4d,0x00073f842aa00744,0x00018f2a75b9e9a4,0x000c6c29451d9845,0x00002356ae9b30ef}},
+{{0x000d500a4bc130ad,0x000493d0bd49c34a,0x00000a89be8d38db,0x0003b09a25c3d985,0x00002f1f3f87eeba}, {0x000d09d50ab8f2f9,0x0008dc55923df2f2,0x0003766cb9acb921,0x00019f54a8f34267,0x00004cb13bd738f7}, {0x00048c75e515b64a,0x000badb4a9038f78,0x000f751b50a59501,0x0002ee8c20d313f3,0x000019a1e353c0ae}},
+{{0x0005b2d561dbdf8b,0x0005b7faebe9efa3,0x000ba492e7509a28,0x00054931e0acc87d,0x00000c7c1cad69c8}, {0x000ecaf2a1e28526,0x0005b068ea1e05bc,0x0007ca14659423af,0x0002fcda3f3e629c,0x000061f95a898be5}, {0x000db3ae7e7f6160,0x0008847e1b12bb82,0x000708292f2194f2,0x00077858571b45e9,0x0000657ef6bddc96}},
+{{0x000cea1f07b98969,0x00051b9ff16025df,0x0009f720028b9d45,0x0000840c63524382,0x00007ea6b41c18a1}, {0x000b07b21704646b,0x000b0ee478989c89,0x000bc5313fbccd1c,0x00034179106e1057,0x0000557bd45f9679}, {0x00095c929938afbc,0x000d54eec3a6a39c,0x0009ebb2d9251f53,0x000c6d927837eb1b,0x00001c82cfcd1f38}},
+{{0x0009da8c1e3cad14,0x000cba595a5e581f,0x0002e3b2e4f26b28,0x000758a8773843d6,0x00006605cdb3c3e3}, {0x000535eb3dca495e,0x000fc81590000df4,0x00098d810bb22054,0x00054878450023fd,0x0000312a773b34e1}, {0x000618c513586bf4,0x000a8b917e3e135e,0x0006f0e57611e1f1,0x0007b46cea9852e0,0x00004304d496d413}},
+{{0x000c7560bafa05c3,0x000a0c6e55e617d1,0x0000d66473b3e1a0,0x0003486e3529718c,0x000041546b11c20c}, {0x000172cdd596bdbd,0x0004398eefc40b42,0x00044109b593e045,0x000ae349fb15347b,0x0000736bd3990266}, {0x00032d509334b3b4,0x0004b60816573855,0x00025c837546fd11,0x000ab5ccc5f5f304,0x0000412295a2b87f}},
+{{0x000c066ff81211d0,0x0007530457762b76,0x0009b76fb0064b54,0x000e9888e768004e,0x000050df82853d0d}, {0x000e6cdc0893bf7d,0x000c680c45fdd329,0x000b1feb28415ff6,0x000b2d65b7fece05,0x000028948bbf53da}, {0x00007331b6b36832,0x0005d4540f4f7214,0x000de54f5b431f82,0x000c0e966e03bd2b,0x000070b280868257}},
+{{0x000d9e9a6f840e21,0x000989ab7fe751a2,0x000690b2f45c9ead,0x000ad7ee54aee414,0x0000521fd88c20d1}, {0x000c792cf46d11e1,0x0005080afd882ab9,0x0005fd8e1134ccef,0x000521a315884ac0,0x00005ad7b76b3775}, {0x00077e0022788bf9,0x0002e5512e515f61,0x00073881890a814e,0x000d3d669412ff39,0x0000523ae0f61492}},
+{{0x000d2bc0c3632540,0x00080821850b7209,0x00047e0291292ecf,0x0005c06d20f348a5,0x000051ce18c04c4c}, {0x0002c323ca1fb8db,0x0006f3624a6fecbf,0x0003fa15d5f52a6a,0x0009805dc0b98739,0x00001ae973237635}, {0x0004be849f95783d,0x000a2b531e276e7f,0x000fcfede7cb7203,0x0002b7cccefcb19b,0x000074e86d48bd69}},
+{{0x00099b88f57ed6e9,0x000266df8c82519c,0x00030ad2735393cb,0x0002e345cee3213b,0x000014e153ebb52d}, {0x00055261e293eac6,0x000032133acdb2e6,0x000900996b845a92,0x000dd80460975cb7,0x00000760bb8d195a}, {0x000e1a17cde6818a,0x000a9ed69a084413,0x0006caccb157156d,0x000c5f22cbf268f4,0x00006b34be9bc33a}},
+{{0x000c01691c58347c,0x000a84e0ebe84681,0x000d232649ef733a,0x000db1da4fc7c422,0x00001e6de2cffe2c}, {0x000c648e9cd33068,0x000975622afbe2cf,0x000c0911b14754df,0x000d8d5d56bea9f5,0x000049854dcf296e}, {0x000d7fb96f75a115,0x000e0394ffa7d950,0x000be28099c1ddd5,0x000db7325036d25f,0x000046383c6628b3}},
+{{0x000a8f3eecee741c,0x0008b760290ce3fd,0x0007c05f22569691,0x000e55d0db2bc161,0x000045f6bd4eec9b}, {0x0004d9613a169877,0x000f8656aa7a613b,0x000a41f1bd315baa,0x0007802da9187bdc,0x000002417ab8065f}, {0x00073cd18b191e99,0x000f827b988f69ba,0x000a96fc3bca8edc,0x000cc6b757fb943d,0x0000329fa40f2f00}},
+{{0x000553d622222042,0x000e52dab9f8f12d,0x0003e82c4fafde29,0x000afb93d7909edd,0x000074c264c5457c}, {0x00018b218fba257f,0x000b80db964b1fdc,0x000a81351cecefb6,0x000c36c374167abc,0x000075bda8a7a042}, {0x0008af642a7a94bf,0x000ce5aa03918d0a,0x0004e9138a142b06,0x0000470bc8831b36,0x0000434ebaab764a}},
+{{0x000f2f643a78c0b2,0x0001ef22e027cf3d,0x0009c1b5a34c3e97,0x000dd2dec7d1c5e4,0x00002012c18f0922}, {0x000c69656571f2d3,0x00045530e737a11f,0x0004fe5035c6c9e8,0x000d30be33ae7a2d,0x000001b9c7b62e6d}, {0x000b55e55ac89d29,0x0001f45a0a763880,0x0002e76c1f148324,0x000ade83d36efdfc,0x000008af5b784e4b}},
+{{0x000930d5debeba64,0x000f6cb7d640ac39,0x000c0263ed3f8475,0x000eac49069deb18,0x000012e29019ca52}, {0x00061acc920922a9,0x00091a22d1c0f0a3,0x000cd62d290705fe,0x00001857c5059f14,0x000038bfd74b12ef}, {0x000ebe1b79cfe2f9,0x000a7313b1cc67ba,0x0007767952aae46c,0x000a1e1682e7165d,0x000054dae268d440}},
+{{0x000263cb6746542d,0x00001a3d9f8a5c26,0x0005ec7360de3f0e,0x00010e1aee478e4f,0x00000d24ac3d8952}, {0x000b2947f4aee1f6,0x000c1085c65ef177,0x000bb93af1059e9b,0x000b5695b3259eb5,0x00000fa08bf47211}, {0x0002d066182723c2,0x000856ffd8f7693e,0x0001c51090968929,0x00012d1f80360830,0x00001eeb91f22bcd}},
+{{0x0007ea24b3877b3a,0x000fba4ab7d91b7e,0x000aa3c244c3f620,0x000dfb6b2b2ae1ec,0x00002ac226e5fc46}, {0x0004846a031fcfdf,0x000347aeeba6ff41,0x0003a591b3ef3d7e,0x0004603f2a294cbc,0x0000199f5ae6764a}, {0x0009d110200da749,0x000c833ce5f6bf65,0x00097b2378d32559,0x000f3a218fe51882,0x00004b39c3434b03}},
+{{0x000499dc881f2533,0x000da779323b6283,0x00073441f49d0525,0x000168d897addfb6,0x000032b79d71163a}, {0x000314d289cc2c4b,0x00011a287178de27,0x000a3364ce4be4bd,0x000826e18d528d6f,0x00006423c1d5afd9}, {0x0005f8d9edfcb36a,0x0008f3746e5f9cc8,0x0009e5d3cd22bcc2,0x0002dcce49de338f,0x0000480a5efbc13e}},
+{{0x0007621195191ff5,0x000d0fcd669131a0,0x0001f755f6a37037,0x00067a6fd4f0b5e4,0x00007a4ed997049c}, {0x000d03bda33cf978,0x000da76b6a88b64a,0x0002519d6eaaaf58,0x000a56594ff15a4f,0x00000ca49c984dee}, {0x00035267e050e0bb,0x000eebd4ca1802b2,0x000139530a8dcfcd,0x0005a3933f29f6f2,0x00003a73d408c9ab}},
+{{0x000bfb5e2771840d,0x0003b07caf1fa5b3,0x0002b263829e5452,0x00060126d8832e4f,0x000033f90fef32f3}, {0x000161f555f9fa27,0x000c419462d6f50d,0x0002be83a8c9c79d,0x00033c622abd2975,0x00006b70a9b35517}, {0x000cb18d6120e7a6,0x0000c71c8a7ab4ab,0x000b6140170ff13d,0x0003165ac375f3ff,0x0000701d8706d0fc}},
+{{0x000e8e081bc750dd,0x000251339c2c6e4d,0x0008cceebfa547d5,0x00088762015cd1a9,0x00005f8d8c899548}, {0x0005a8100870b36b,0x000ba3ff3bbb2524,0x0005397a57126e0f,0x000ceef6f19c24a2,0x00003a3dfdff5413}, {0x0005600717964384,0x000e04c64d21d9fe,0x0007321002cb103c,0x00010e73c6cc01ae,0x00001547d867fa3b}},
+{{0x0001e70b01622071,0x000cf8b1dafc50b5,0x000f5aabcd06b505,0x000bf312c6bb061e,0x000047aa27600cb7}, {0x00014ce442ce221f,0x000cc4c053928b66,0x000c1cbe036e199d,0x0008e06663fb4a4d,0x000024b31d47691c}, {0x00041eedc015f8c3,0x0007e7c693f7c2a5,0x000ea278d611a4fe,0x000a094f0af66134,0x0000545b585d14dd}},
+{{0x000cd3a7f6fd8565,0x000edccc8078892b,0x0008c9be210169b5,0x00077b12acb730e3,0x00004a340414a3f8}, {0x0006d2258b5d9525,0x000816048e205830,0x0003934639601778,0x000878b209cd5cc9,0x0000057c31bba95a}, {0x00030ce0f9dcd046,0x000be03361169e6b,0x0005ad364e8602c6,0x000055374ceb6c9d,0x000066f4a15f1d35}},
+{{0x00080bdfb44ad530,0x000632f5f9c8e1bc,0x000e7d5bee3cd3e0,0x0004da93b437a4f1,0x000033c7e118ac69}, {0x000a1fed9a9c4858,0x000d76718df5b660,0x0000dc98541148d8,0x0003174a08e4382c,0x0000734fdb8ac38b}, {0x000c6da69b76e012,0x000fbe0685edfbd5,0x0006090a9da8b692,0x0005cf8195ca2ab4,0x000005009cd7c0c7}},
+{{0x000a106589345512,0x000255789a156fa1,0x00094f71c7fe9243,0x00016e6c4f83c642,0x00000ad6f7d571b6}, {0x000333289d692431,0x000148a8544033b6,0x00063f5c75e2b53a,0x00005b83e6633c6c,0x00006ad773a75070}, {0x000cef246c200af7,0x000d8d0c78194b2f,0x000c9cadccedd169,0x0004542638a95abb,0x00005209bad89faf}},
+{{0x000f275ea0d43a0f,0x00034089beebe67b,0x000479e72eade68e,0x00054544289134cd,0x00000f62f9c332ba}, {0x0004e4d0e3b321e1,0x0007a28ff1e95620,0x000b99bd9e3baa63,0x000d0710b0ccffd5,0x00004d22dc3e64c8}, {0x00046589d63b5f39,0x0003f57cbcf61fcb,0x00053afa055cae6a,0x0001436febac2d29,0x00001c0fa01a3637}},
+{{0x00051c80ecae40fc,0x0006854ceaa5b9cc,0x000e79c828bd9d70,0x00001ad60ea8357e,0x0000331e8b47fb73}, {0x00008e6fd19b3565,0x0008b30d76b15b0e,0x00059f06e819becf,0x0007192b93abf84a,0x00003434f21cb906}, {0x000f57667be31c77,0x00029b9c4cd541d3,0x00021764625ed6fc,0x0003d5f2bc195609,0x000026ae4463583c}},
+{{0x0005468bdd1865dd,0x0005a9528a633376,0x0007c9e9577822ee,0x000beef0657b9f0b,0x00002b8a65420931}, {0x000c61c0390eb9bc,0x000e07eef3ea3cc6,0x0002278d7de6afc7,0x00083feeb4173e82,0x000042c7389dd8be}, {0x000c8fb99089780b,0x000a723b443c9610,0x000bf6c5d8145dd2,0x000d62f425697427,0x000037f3427f2648}},
+{{0x0002a28cb881f223,0x000de6d56a94a3f1,0x000fa681c017e795,0x0000bdec59b2aff0,0x000072d97b9433d2}, {0x000343c07fd25be4,0x000e66ad22cbab28,0x000d20c3fe712587,0x000d7a0ab6411a99,0x0000203c0781a1fa}, {0x000da01505bfb882,0x00066968933195ea,0x000ec6f37c1e3b7a,0x00024744f75693bc,0x000030e7f72baf81}},
+{{0x0007c0785d132cb1,0x00069c65cc1a5f18,0x000870ac1276d0c0,0x000232d43032ac34,0x00002877f9a0e442}, {0x000525cc3814ec1f,0x000b9635d7ed4d66,0x0000bee3f3ccc8a3,0x000e6c765f536bc7,0x0000227098525cc4}, {0x00073765d745ef15,0x000dae4a9801c3a5,0x000f4b6e4ee197e8,0x00028b08946bd073,0x00005b875f2667ba}},
+{{0x0000099b0c3822af,0x0007eec8d4bdf1e1,0x000262758a0152aa,0x000e9dc02de213b8,0x00006fc895c2caae}, {0x0009f66e5c3db0ec,0x0004200e58bc4525,0x000a2428b2e84321,0x0001986be4147938,0x00001a33b5a394cf}, {0x00035d6b9d4e3b21,0x000e4cd2192f097a,0x00005f4c2528d54c,0x0007f51df5ef4284,0x00006810fb1c0dc1}},
+{{0x0002e01f987ab205,0x0004394c47bc2b23,0x00012378474e3645,0x0003c7762d3157d1,0x000015798c2bae02}, {0x000b2985a4c61033,0x000a94f11bf67e86,0x000aceb96ff7cf2c,0x0004c08b1a846453,0x00007a5b2c9bdb31}, {0x00036fd2b61dd006,0x000639c02049592b,0x00068e84b1f09f80,0x0003d8e14beb4e13,0x000032a0a979ae51}},
+{{0x00050a87a2f5feff,0x000162ae38709ef3,0x0000bd04d5c361b1,0x0001bd8b816e50f8,0x0000651d81e024f2}, {0x0004aa8891e8eb62,0x0009dab198024c1e,0x00007ffeef7cde98,0x0002d5abf7937ffb,0x00002d65f26dedd5}, {0x0001c2c32d16ae25,0x000cb3bc3adab959,0x000271beedb59535,0x000b7a4fa6e2d0b8,0x00003a450e4fbc7d}},
+{{0x000ec995f8ac8311,0x00086eea43e541dd,0x0002d063818f6121,0x000253dcda4cb09b,0x00000871258a9aee}, {0x000d312b48b972a3,0x000308d26be89731,0x000347b00169d74f,0x0008f31ad4484bc5,0x00007d8e4a358801}, {0x0002a3ea284b370e,0x00062641860856d2,0x000f2757b5eacb98,0x0004fee0badc9058,0x00001224c304f633}},
+{{0x0003eee8e1e2392b,0x0002cccd72eb4c18,0x0002fc700a0c58ef,0x00041efbd834c314,0x00001999ee3b3100}, {0x000698ef0b1ccf22,0x00021094d7101e28,0x000198c7322ccc27,0x000e7d44a2290db5,0x0000742c37ab5155}, {0x000c07a4b924360f,0x000a02efeca44a64,0x000196f0e210ed05,0x0005150ca79bb8f8,0x00006b282f3bf922}},
+{{0x0008c6de781da586,0x000e6be9d4904e82,0x000a5ffba6e48c2b,0x000092bb1d1a59b3,0x000022a5b9dc3827}, {0x000929995a986742,0x00082a46d075767d,0x0005a6c2c34c7257,0x0006e2d1206c2130,0x00003424727dd2ec}, {0x00070c29bab4e51a,0x000feb77fc55a136,0x000312513f3784d0,0x000be16d1905a906,0x00004ceed79d23a3}},
+{{0x000bc7fee035a75b,0x0003f1fdd611a239,0x0001348e3467a1e6,0x0009a31d499bdeb4,0x0000677f55f505eb}, {0x000b73812b0695a2,0x0004b880447e7e41,0x000d23e8f33ab872,0x0002f3b3775b3bd9,0x0000533f4ee1b440}, {0x000fd11669e0bf61,0x000d067849502f76,0x000823812afe3115,0x000445b2224eee71,0x00005be122e970bb}},
+{{0x0000c0b2ceccb06f,0x000888143f398cc2,0x000f62ce022673a9,0x000d586b34e55ec8,0x00005b951b54e5ad}, {0x000064010c450bd9,0x0006f6a552bef5b5,0x00099314521e1897,0x0009f8d45b84c985,0x0000701d31686b1f}, {0x0007e787a513025b,0x0000d0bd3b909fc7,0x000cc217fe644ecf,0x000c04d9a36a530b,0x00005132d1e91054}},
+{{0x0007ce4cdb2c3b86,0x000f83fcf0acc2cb,0x0002d53ad5cd87b5,0x000fe90286817570,0x00006d87a3c915b5}, {0x0002c51185cf8b10,0x000070f2c09cd9ea,0x00064ac0d6e7a18e,0x0005b145fe543847,0x00002bcab5b01221}, {0x000c9c44fb4dca6b,0x000bf05fb2250b74,0x000ec4a858fd6be1,0x000f8ac7f28879e8,0x000017b5a6441ffa}},
+{{0x00098fcda19435e3,0x00077802f2f159df,0x00090a43456c881c,0x00079244852c6083,0x00006ad28554aaa6}, {0x000551becf38d2fb,0x0007087f9a6e2f6e,0x0003daf99898e76d,0x000cc2467019d414,0x00001ec6a50edc86}, {0x0007dcff123bcba7,0x000ff2d5f5a2b4cb,0x00050dbfe4347361,0x00004a17408e4c02,0x00001e9fb4ad5e12}},
+{{0x00070f5d17be02ba,0x000481ec3ded6c15,0x000effc0f7dda093,0x0006e11c6915d399,0x00004e923037d363}, {0x0000504dcf57c964,0x00065dcbd80a89f1,0x000fcab931c49b53,0x0001a1038066cd1c,0x00000446a5f86064}, {0x00027da5ff27e786,0x00040fe3b01fdbb7,0x0008b3a109e9b332,0x0006b20a09d3ed06,0x00001c716cd8e4a7}},
+{{0x000ce10ba7db2ca3,0x000dbda20fff66bb,0x000cf7a1c05c459c,0x00021b032ae4fe69,0x00003891c02063d1}, {0x000eb57d88ac5d88,0x0001c44fb4042ba7,0x000fd1dc480ab26a,0x000c2f90b237dde8,0x00007b9906e88fec}, {0x0006a0949e185020,0x000d1d56d16f81ec,0x00042136dba2bbb2,0x0009c117e56177e9,0x00007281471bb483}},
+{{0x000659f5b7fb8d1e,0x000d5e27286badff,0x0001d0f719f96e9a,0x000139f352326169,0x00005c3cd268b467}, {0x0004e9a5ad4f772d,0x0007b40d10bcadbb,0x000bb57777ac4e71,0x000fc6acdb3a6451,0x0000546afd28f5c2}, {0x00090942bd67de11,0x0002546855957ae3,0x000543dd27ec5119,0x000e4f0665a55efe,0x000035fb1b9a350c}},
+{{0x0007b963acd64414,0x0009304a2e771d3c,0x000462c637dd3dde,0x000cea7be6b1cfe6,0x00001b3b9b7c5d9d}, {0x000f685c8ffca0a5,0x000459ab6db32536,0x0006a8ec2f2cfa44,0x00073c0ca9ec06eb,0x00001062908b0040}, {0x00015863bb003d68,0x0002e584c4daa3cd,0x00064e642de9a41f,0x000ddc26031cbf83,0x0000697b849939d7}},
+{{0x000bda14e7041705,0x000955fed937dc29,0x000debc7c492a190,0x0004fa968d3776b0,0x00002d17d795b66a}, {0x000901a972f63609,0x00072f74bd9f3995,0x000cdb27e1c449f1,0x000b52d5ef5ef41c,0x00001ad4f0944a7f}, {0x000b59449f954e5e,0x00092a71dde444fa,0x000c427be4bb7fe7,0x00098f96dd02568d,0x000029e8ddc1c1cf}},
+{{0x000bdceb0c24a9ac,0x000e99afd70fd3bc,0x00005cb87b7dbe29,0x0005ddbc8dcd584c,0x00003d13a782285c}, {0x00097ceff2238316,0x0008b5e1e4c300d2,0x0002078dac0a6e36,0x0000fd45bbff89c8,0x00005338333f2b2a}, {0x00066afa6c14eadd,0x000cf5032da8eb9b,0x000c74a2f7a97735,0x0008dd1cf9f881a9,0x00003cd13f5c9646}},
+{{0x0004b6c809c3d37b,0x000d76aa6e17a232,0x00005dc7903b771b,0x00025a22d648c767,0x00006265975e499c}, {0x000809d3f20d323d,0x0005141b3764474e,0x0001864b8e690b4e,0x0007aa1fc8ed5f40,0x000017695219b2cc}, {0x000fc49c6636228b,0x00045b0210782826,0x00042cee7c0f1914,0x0007678941e85a8a,0x0000557e52f09713}},
+{{0x00086874f346bc9d,0x000082303ef91697,0x000f3ca92f6ac2bf,0x0001eb25a452df74,0x000042c38594c55c}, {0x000da53dd0d4c2f5,0x00041209c7b04c16,0x000f8b1a43af17b3,0x000c61d89ad63492,0x00004b4b41b16422}, {0x00014af131cf8ba2,0x000c82214ea38e1c,0x000775bfee3545f5,0x0006542cb9ad80de,0x000043c9928a0ba8}},
+{{0x000ba9b3452873fa,0x000e7601883757f0,0x00064121df3697e4,0x0000374f667b5e61,0x000026e00e6211f8}, {0x0006b29d0651644c,0x00095085a64a14c4,0x000a1616c6321dd6,0x00081d6b9aea1dec,0x000005968283c279}, {0x000e574b764d040c,0x000cffab16695b8c,0x00002ee7ab1baf70,0x00042347b4e45ba5,0x00007f987a4c9350}},
+{{0x00095c4c7a4a71aa,0x0000a1d9c2905b65,0x00066095eb2ecafc,0x000bf88ebee2be88,0x0000501363db6764}, {0x0009372c3fceb682,0x000447b291d1062e,0x0003d80f4966b222,0x0003f74d9dd74100,0x00006add899bdc50}, {0x0009725af0892aeb,0x000fb5b94e32e319,0x0001e02e3ab06085,0x0008b973739e087e,0x00003d170bc4477a}},
+{{0x000df55e75c8ad3f,0x00051948cbf1b9e8,0x000e1fa489cde5fc,0x00094770e5228350,0x000055e714155369}, {0x0007643cc099c5e4,0x000f6ec136e73226,0x000a6e1b37a86c45,0x000615b6789a20a5,0x00004e256fa3118e}, {0x000ce226bb707aa9,0x000677ea774712e6,0x000b01a9fa04397c,0x0002d4c1f75d68ff,0x00001be081a6243b}},
+{{0x000ee3b1bc1a5a57,0x000ddb0c774fffad,0x000539e82b2ae5fc,0x00048c417008d9a5,0x0000323422856ff6}, {0x00054db3337555be,0x0005c4baa60c0e91,0x00016877a1168bed,0x00024d63ad1bd044,0x000062b77b412f7f}, {0x000433e0bdfe2ddc,0x00028ce7930223b8,0x000a4fa397fd0c21,0x000b6ab184ea0e00,0x000030270eeee47e}},
+{{0x0007632740022f5a,0x000fe1e34dec3fdd,0x000486080578938d,0x0008d714585f4291,0x0000365a897fd435}, {0x0004a70a45f6bbd8,0x00040ebd7a623d49,0x000001ea0f3e6d9f,0x000f118517945465,0x00007b0f66addda1}, {0x00071539d76498c7,0x000ec7a6b8777a24,0x000a7304cbf46218,0x00044e31a0c73229,0x000046a0b34f47eb}},
+{{0x00078f4e25942853,0x00075e2a6f54a123,0x00015e2089651b21,0x0007b38571917403,0x000037b9d0188c87}, {0x0009c8ee652e4e4e,0x0003bfaf914b88b9,0x00063f2dfbc6df82,0x00013a996086f2d9,0x0000051d4cbb6f2d}, {0x000d7f0144ec87c3,0x00011806a25d4837,0x00066e66969ab8de,0x0005ac857caf805f,0x00001a031e6df801}},
+{{0x000a27707b8619cd,0x000589870ffd7b53,0x000cad61dd47cb43,0x0001fdfb7522e768,0x00000eb342f4f4b8}, {0x000dce301ddf26ba,0x000a5af7296ac93c,0x0006cb11779b0f0d,0x000f8172e66d117f,0x00001c6b665c4d3d}, {0x0007d79a06fcf239,0x00068c46e00e4566,0x0005256a20c93e4e,0x0003653004e6dc7f,0x000056c947389451}},
+{{0x0005a4cc395681cc,0x0000ed4befe60343,0x00034287960cf112,0x000dd53f8acb980d,0x000047fc9e133b63}, {0x000e48e2fa23540a,0x000903c02ebdbf03,0x000e07a75eb4fbfb,0x000dc9b7760c4300,0x000070835d0ad41b}, {0x0002aef6e5b5c184,0x0005639a5ec72630,0x00070ba30cba2071,0x000ab0c77ec18f23,0x00003d4b08808107}},
+{{0x0008f5848d7a9733,0x0003421d41de6d86,0x0001e2405f8d766f,0x00074478939d76cd,0x00006af64c8ee871}, {0x00032020d880fed9,0x0004ada2436e4be7,0x000a3d8134fbd5dd,0x0000dbd844d91b11,0x0000412466897a55}, {0x00088938ecc47ea5,0x000c6b816aa040df,0x000de9f59e8fba3f,0x000c2d90961b7746,0x00007cae96a10395}},
+{{0x00047449bc7cd692,0x000aae6f73ddfe75,0x0000837e290f9abe,0x000c1834af01ca70,0x000063ab1b5d3f1b}, {0x000ee5e854c53fae,0x000c12b4f3ff4c11,0x0000b67a726a0b06,0x000e3ef33540f80e,0x000015f18fc3cd07}, {0x00050763b028f48c,0x00040556a065f327,0x0003495b58060207,0x000508dd53bd812c,0x000008706c9b865f}},
+},
+{ /* slot=18 [{1,2,3,..,64} * 128^(2*18)] * G) */
+{{0x00007ca1ab1c6eb9,0x0003e16b687b3b15,0x000c7a91abbd448f,0x000dec13455fb7f2,0x00007579229e2f2a}, {0x0005dcb85b1c16b7,0x000e83c7b27a56ab,0x00035517be94c0fc,0x000afaaa4b11c1a7,0x0000499238d0ba0e}, {0x00046e527aba8b57,0x000478bd1647becf,0x000f706fef15a08c,0x00030d57af1c6a65,0x00006345fa78f03a}},
+{{0x0002f95f1015e7a1,0x0001da9b40263df0,0x0003ea1107790ec4,0x000f8c94d3a0ea13,0x000054f70be7e33a}, {0x0003cbe9bdd8f0a4,0x0001bfd17730293d,0x000f17a875db152c,0x0006efe7dbddc6d7,0x00003e1a71cc8f42}, {0x000ca3e390babd62,0x000670291c833c83,0x00037900c480ede3,0x0001fa1c88038ccd,0x00002c5fc0231ec3}},
+{{0x000a911717038b4f,0x00021c9deef81feb,0x000d0d8834e51237,0x0003bc61c97e4e75,0x000068afae7a23dc}, {0x0002e4d102456e65,0x000c1cad47b91c42,0x0002b6ffdd87414a,0x000100f1592e2bba,0x000075d9d2bff5c2}, {0x0009b4763626e81c,0x00036bca02edd5bd,0x0001f077b3899669,0x00054710a41193d6,0x00003097a24200ce}},
+{{0x00027734c7f8b84c,0x0003e01b270e9574,0x0004e564a6f141a1,0x000bd4802d1adfeb,0x00004bb23d92ce83}, {0x0002e7246695c486,0x0003435a89607a16,0x0000d12a37131d63,0x000b36330521561a,0x000056704bada6af}, {0x000c4aa752f912b9,0x0006cd86770c8af6,0x0003c8cd585e665f,0x0008a7e4c35ac83a,0x00002b7a29c010a5}},
+{{0x00007f77d0c1cec3,0x000b6bac492f8c40,0x000e69daaf8d1020,0x000fce032ec29d57,0x0000599408759d95}, {0x00010a23bf00086e,0x0005ee736ff7c338,0x00024922d4afce92,0x000061b3d60e670e,0x000011ce9e714f96}, {0x000ef713d815bac1,0x0005d485be25c219,0x000e513c51f14146,0x00043936d5447cc4,0x0000174926be5ef4}},
+{{0x000eb2f9fc5bd5bb,0x0002ae1d810e1b5d,0x00072a1c5992daa7,0x0002a24afc4cfdcb,0x0000497d78813fc2}, {0x0005d41593ea022e,0x000a20ed0eed63ef,0x0007382c8c5cbcc1,0x000e1ad8fd24ecf0,0x00006fa42ead06d8}, {0x0006824a1f73371f,0x0001c4f5b6736e27,0x0004fa46e77f7cf0,0x0008c967e201fe30,0x0000785a36a35780}},
+{{0x000fbdfd63014d2b,0x0009c6ca7578b825,0x000c0b5df0c85236,0x0008c8f5b2fcd285,0x000012ab214c5804}, {0x000442985d517bc3,0x000c7ae653678070,0x00085a77636acd56,0x000662b00a279839,0x00005167effae512}, {0x000ea9e10f53c4b6,0x0005f8ac91a14bd4,0x000acc1aba1673dc,0x0002a25a8f81a4e2,0x000033a92a792433}},
+{{0x0001f49927996c02,0x00058e04d17529dd,0x000fd02c3e0cb3b0,0x0003eb11f7e88967,0x00002f964268cb8b}, {0x00095ba0218f2ada,0x00087330fb9ca7ba,0x0006c6d907cff422,0x000ee54dada496d5,0x00005380c296f4be}, {0x000f270466898d0a,0x000990aff3f7a9d4,0x0007daba453d0987,0x000669cd09ef3626,0x00007761455e7b1c}},
+{{0x000e8d50a45c8f4c,0x00004de764c235cc,0x000e21a75fa8272c,0x000911c093248617,0x000067e690cb60f7}, {0x000250974b220084,0x00047eae43674adb,0x0004c6a8ad78aa3d,0x0007dc2e9acbe63a,0x000064e6b5aaf0fa}, {0x0003e338fbd2ae14,0x00064c8d9d74e4b6,0x000ef7d865d3a8f2,0x000bc87e98571607,0x0000515db7babc04}},
+{{0x0004f7b75ebe86b2,0x0008ccbf0af34082,0x0004a488e31d7f15,0x000c8498756d8ce7,0x0000430e7af36238}, {0x0007b7a93d37ecba,0x000c8d00c11a0937,0x000b46b8667eb1c7,0x00011ca81efeb5f3,0x00007dccbe7c3c1f}, {0x0006ee996ab57210,0x0005830b686cfbb1,0x0001a40eb6914aed,0x000f9147b72a61c8,0x000022319bbb07f9}},
+{{0x0004e70580a4e308,0x0006b1eb988e4997,0x000cb5faa55f5e0c,0x00055d65bb9c6aaf,0x00002e2470b9cc70}, {0x0003dc5c41cd0e9d,0x000d571a3c70ed93,0x0009332e193e4ab8,0x000766c1f2dd11a0,0x000032e93ccd6c7f}, {0x000feca593ed697d,0x000642cb49544939,0x0002cbd732bbe921,0x0007b0a795c5ad2a,0x000042c8165c092c}},
+{{0x0006f75d53a77ef1,0x000a3cd284dd8f13,0x0006f0af5aadb7b2,0x000975096b7524bc,0x00007f1ca117116f}, {0x00028d00fe586fdb,0x000eacb9cbddd9e6,0x000e7f9b90279f4b,0x0002a3f26c63761e,0x00001dcad910b053}, {0x00045bc962e0b7cb,0x000a8a12b5c7d43e,0x000fe1ada9277996,0x000f4577daae8de3,0x00004f32e1aabdec}},
+{{0x00010f12310d696d,0x000a6f9870b5b3b5,0x00091ba6a82d8bca,0x000dc30f0620cf6c,0x000045f6f13fe001}, {0x000f16b0548cef7a,0x00017a588951da9f,0x000ce9babc18287e,0x000e962965e153fe,0x000014e99a2dd99c}, {0x0000bef03639ede6,0x00021392a770ff73,0x000f565c6bf67134,0x000521b8441c8ac2,0x000021484b13a200}},
+{{0x000854ab15e49075,0x0001c12de893836e,0x000cb994b3adc32e,0x000d9442ca757edd,0x00001b02bcad4677}, {0x0007451dc96fbc0a,0x00009c64f498f080,0x000a4b201caa3d8e,0x000203a7b42739d6,0x000023c146182e44}, {0x000dc5f3624cf0a5,0x000ecd4937060b05,0x000f8d7c7602f077,0x0004ab7484a99302,0x00001c168c269d2a}},
+{{0x000a3c9ecd606cd2,0x00052afb705735a2,0x00046ceeadf3c37a,0x000e6efcc0052915,0x000061ea8443beaf}, {0x0001cdc2395f36f8,0x000a4c064e0dbbe8,0x000a2043d95de2f2,0x000ccb23b5572f54,0x000023a705402e5a}, {0x000954e6e6328bef,0x00016b04287dbb07,0x0008ebcf8880ac37,0x000aa988055e7ac4,0x00002cb36aaf2832}},
+{{0x0008fe097e44b439,0x0008357087dd7126,0x0001ad9b3ce34fa8,0x000ee9834cb95573,0x00006c9068c07c8d}, {0x00085c014dce6191,0x0008a491f9dfcd56,0x00020c06df69e452,0x000daaac68921298,0x000013f85b8ffc7e}, {0x00096cbad956f568,0x0000a60b1da47005,0x0007dc50cdc31719,0x000fa7989760bc78,0x000031a35ea4c1a2}},
+{{0x000412e65c69c325,0x000fb6a6b5b909b3,0x000b52b7cdf177da,0x00044ff1a41a7c07,0x00002d6a966d415b}, {0x000158ef87d02f58,0x000e0dc74141a723,0x000fd1fbd922a7a6,0x000018cd25a4d564,0x0000760f81f3b592}, {0x000b1dce50021b0d,0x000f204f8afdec9a,0x00056438fb85c0d6,0x000730c299da33da,0x00003f452cef1d22}},
+{{0x00039ae7a4c42f04,0x00076b82903109bb,0x000877bab543cd81,0x00034baad8e9039c,0x0000135fc7a69111}, {0x000ca9bc617f1f43,0x000d138e1f13fdcb,0x0005fa935e042fde,0x000d846c6a7078d0,0x000065e613ab6a8f}, {0x00083cde5b2fa359,0x00079aea8f42448b,0x000bcf7ddcfeb2ad,0x000f7d775698f9c1,0x00002c886f406165}},
+{{0x000b54d18cb13ef6,0x000a4332d81252ce,0x000a5e4a1ea66af6,0x000beef939bafad2,0x0000217d0fc1ed0f}, {0x000901c45fdba5f6,0x000e6ec2beb79c60,0x00044f4b340f62fe,0x0009e563f9b95c57,0x000054190d858ed4}, {0x0007ca12e661a26d,0x0004820f7c75c159,0x0006b19266909899,0x000ef36a08901760,0x000059c8a2894961}},
+{{0x000c2fb02bd4e895,0x00018a34863efe41,0x000dbd55fdba506b,0x0005d098fd842e3a,0x000016a86aa0df1e}, {0x000ef027c69b287b,0x00094b128f95fafd,0x0000c4e70b6bb623,0x000f736351bc5c80,0x00006d2aaed1df38}, {0x000173c419e1d140,0x000faf0471663bd0,0x0008ddf45b5f36eb,0x00032e7c8766233d,0x000039c1ec3c0ba4}},
+{{0x00070e0a40c8b09a,0x0008888af1645a34,0x0000736d1226eb47,0x0002e2c53865f103,0x00005c557446c2ce}, {0x0005285ddd1fd1ec,0x0008802aa0a87fdc,0x000f920f2e48eb8c,0x0006ff0d7ae338a6,0x00007aaafa13b53a}, {0x000b30982557a5bc,0x00076d7df0e3cff2,0x00039448fac950a7,0x0004912d292f4158,0x0000270477647161}},
+{{0x0005c8c51849d37f,0x000c783810144493,0x0005a6da2f047ca4,0x000c196ddad8d2c5,0x0000118093549240}, {0x0002732505df4420,0x0002080e950f3ab3,0x000d35a0d3ea9393,0x0009bdfd3f628a06,0x000079887a90135b}, {0x0000690c65e5a282,0x000d3bf6a88f430a,0x000d1034f8823652,0x00051bfcb247795a,0x00006f0f1797e801}},
+{{0x0007c2418f8ed4d4,0x000df922167b2ccb,0x00097ff1c478e33d,0x0001fb860699e012,0x000022a0a2105183}, {0x00032d6bd3a84088,0x000cfff291462531,0x0000e0cd9454b933,0x0008670f27d78562,0x0000312e12a2b894}, {0x00086b29b5c11b48,0x000c8bfd6025244c,0x0002989ba1c443e2,0x000e7df42313b507,0x00002f3a3075bb38}},
+{{0x000d4c49a25c9945,0x000d1e46af782178,0x0008095ee36c61c4,0x00098ab7880e84ab,0x000013be93cc523d}, {0x000db378c1d9d8c4,0x00026b2b333b10e9,0x00076e238fb83636,0x000c1bdbed728eb6,0x000015c9b5088ebc}, {0x000f3edb3e8966af,0x00076c2e32e5f13d,0x0002eea1e79cb428,0x000f03cce12fdc04,0x000046c12f6248c1}},
+{{0x000fee4f3b33750c,0x00037968f46e6199,0x000f4503ec4abf82,0x000fd42860a61729,0x00002b56b7b11eff}, {0x000f72d28d1d6dac,0x0009fea9e1e1e206,0x0009b1ba9b39d8d0,0x0001c8a5a0bc73aa,0x0000520eb9ac7da4}, {0x000e4f35891bc85c,0x0000f7de98a38be8,0x00050a89dae41261,0x00047ce887273cae,0x000063bd2f4f9589}},
+{{0x000911385786ef9a,0x000ee6f08b57ae68,0x000fc220862a195f,0x0002045dd7291313,0x00007fb86019e28c}, {0x000e6e1d01325bb6,0x0003d8bb319fe511,0x000bfb7d684ac373,0x0000dea986229d46,0x0000708660d0c69a}, {0x000bd35a70c2cbb8,0x00051b01d03bbb17,0x000282485b1420ea,0x00006dbdb0ce9f12,0x0000273cd1908ed1}},
+{{0x00020bdcc13cd7be,0x0009c32f9679312a,0x000c723d56d8cfb9,0x0001c2a4b00dea81,0x000072d5b460d900}, {0x00020dc4d1ad0617,0x0005253510170609,0x00044e5be8c41534,0x000d3df0bbbdbe94,0x00006dab6ede625e}, {0x000023f035bb7935,0x000998629b9007e9,0x000d3f4172075bbd,0x000627a3149514bf,0x000028bb763464b3}},
+{{0x000407c9922eadbe,0x0005dc71dd2e816b,0x00014f7210e2b340,0x0005f683c5c4fdf3,0x000047ba81791a29}, {0x000034c393b4ffc4,0x000f1889f68d618e,0x000a88a50e751131,0x000acc021f42e867,0x0000758f39fd14d9}, {0x00005d9075598720,0x000b698bbcf701f7,0x000652862f4ff74f,0x00076fce30dcba7a,0x000045059b2f5f56}},
+{{0x0008d0dbb99ad827,0x000ac05c48417660,0x00084e689faf0051,0x000584cc0c5f54b1,0x00003aacb8429169}, {0x000a41f4f1cbd865,0x000214df253ae849,0x000c2a845546adcb,0x000d65153db011c5,0x0000066ab26c5c3b}, {0x000a959649cf1849,0x0001225c9eadd8d4,0x000f0316cfa77ee1,0x000b3382512ec17a,0x000060cbca4790ff}},
+{{0x000a29d97d8275fb,0x000ec1f030b0987e,0x00073b5faee1ec8d,0x000199dffcc8ce09,0x00005d0af2fb28db}, {0x000170e51ca53506,0x000b1d99406522e7,0x0006d741c816604c,0x0007cb689ee471ff,0x0000341cf1fc44a8}, {0x0001870b78d58790,0x000cf7d8590aec2d,0x00032f9eaf10b9d1,0x000bf3ec604c6141,0x00007a4fba8fd377}},
+{{0x0009d1d2f459efb0,0x000005b9599883fa,0x000ed7dd183fa512,0x0003927b635ef01d,0x00004444899c2c6c}, {0x000b6a6eb658f1ec,0x000b161cf3d2771a,0x0007e3d181925828,0x0004a2c517393a63,0x00005cdd3780fb2e}, {0x000cd08c86c44f49,0x00089699838109b0,0x000054ccdb3006e8,0x0002da050093916f,0x00000431452993e4}},
+{{0x0001ff2a27e6c06b,0x0002af0bd84b1890,0x000e9ba9e5063ea6,0x000930caf225d96f,0x00007cb33327137b}, {0x0007da8fb551086a,0x000ee2de73a1f4f7,0x000c883a166a8c09,0x000ff360486ac222,0x000023bb4c073624}, {0x000a133c7a03dc75,0x0004188ab77bdc5e,0x00029fa15b2c02a1,0x0008dbdc89b01092,0x00004aad4d476d90}},
+{{0x000b0af8ed99b3e5,0x0002e124ab06615f,0x000a7aa88d1652cc,0x000ad055bcfa46c0,0x000059310e1845ef}, {0x00063fcf1cbf991d,0x000f1fa42fa1c66d,0x00012928d676183a,0x000ad66d7752038b,0x00004572e7efa1bd}, {0x000bc79d8f99b122,0x000542b6e8a07863,0x000bf81cc8b51386,0x0000190659a989c0,0x00000d7713e3fde4}},
+{{0x000a03abfcccd962,0x000ccb19479149ed,0x000170e0aef812d9,0x000bda95e2f06bd6,0x00000e08502a7703}, {0x00047041a9976c39,0x0008e55928857857,0x000152ef1cb33c49,0x00076fcdb3087203,0x00004d28ca324318}, {0x00044d58ae8e932b,0x000bb37bf0e24c67,0x000ce6fc56501430,0x000d023c4240433b,0x000016347a467e74}},
+{{0x0004510601b2e27d,0x000748b733c28d25,0x00098ae57205734e,0x00014ba011d558f1,0x00005aef7a680c98}, {0x0001cf6b79635b44,0x000c947938a35794,0x000fe66b769699e2,0x00016bdb99dfd146,0x0000638a53d0ec24}, {0x0006b8da92842991,0x0004a2f2abea4c96,0x00058de2318deed9,0x000abbf6f7975138,0x0000474da3f5177a}},
+{{0x0007413658d99aab,0x00025fc1a6a20c67,0x000e323bfc8db58a,0x0001c4f7c09b0ea9,0x000064610f2c8617}, {0x0004d8885d9283e5,0x000a3fa1ddf2db24,0x000d079be578e8fb,0x000af6570981fb4f,0x0000184663cb19e7}, {0x000d30042edfeb81,0x000e211ac01e8ada,0x000a16eb653d0848,0x000d00252f00996e,0x000043a1efd0b0f6}},
+{{0x00064607942fef7c,0x000f516910ec2fd7,0x000500ca1f945d6d,0x000c69558ea57069,0x00003d9cd7de095e}, {0x0000d7f9ccdd93f8,0x00098cf490642506,0x0002ce874f34859e,0x0001d91428c79807,0x0000019aecf6ef0a}, {0x000be099a5fff29d,0x0007f66c0124aa3d,0x0006167aaee27978,0x0006d2083aeb2986,0x0000066f18792e29}},
+{{0x0009acb30fbd7d2e,0x0000baca0c63e08b,0x000f7193db63fde0,0x000c60d8ec891115,0x00003eaeed6c5e22}, {0x0007aea2d20ab37c,0x000e5ba0d0b4e67b,0x0003595f49b557b4,0x0006c943ae149cd3,0x00002c89c3b2abb2}, {0x000dc209c53f81a3,0x0004fe37921d3974,0x0004b47b88d8912b,0x0008b6f86c30bdef,0x0000582246de97db}},
+{{0x000b571fded6c3bf,0x000e00fa55777d83,0x000d73dea1426aea,0x000513b48ed7073a,0x00002a81a5f6a846}, {0x000e8e866f7da21e,0x0007aaf5c4059b63,0x0001a2e16871d2aa,0x0004bfc659bf4c73,0x000076fe36ecfaf1}, {0x0008eebdefa8f491,0x00000e494e6daecc,0x000a2efde2e442c7,0x000c45a4336e3ccf,0x0000014e80d26e0b}},
+{{0x0009b246b80791be,0x0002dcd78faa89f2,0x00022a99ead3abc7,0x000765673a0af771,0x000045a9f43961df}, {0x0008d8b6b8c6a57d,0x00025333ef5b84d9,0x0007f19588edb069,0x000204cd09552b03,0x000011ee06d7c91f}, {0x000dd9a798b43d58,0x0000eda8a88211fc,0x0004db9a12cc9dde,0x000bca5c9a388b3f,0x0000220d461dec75}},
+{{0x0007ae132f04d6e5,0x0001d75a37ade337,0x00007c105bbcb51d,0x000e96c716d55794,0x000049577877a911}, {0x00010e3fc2791a48,0x0007904f676ff52d,0x000a99cf2698fee0,0x0008622aebc0d448,0x00000a6c4f081f9f}, {0x00074d6dbb953e85,0x0001a83ab6845a95,0x000e1c0781356460,0x000172df133800a2,0x00002886ce372dab}},
+{{0x00044a29f2452402,0x000c2af2435be6d5,0x000eddddc2665925,0x00056d9215d71b36,0x0000090893eb6376}, {0x0002852a65c170f3,0x000134b0e301db67,0x000bbce3a823e0ec,0x0001ab8d3a103588,0x00000583872fab30}, {0x000cdab7f2b56e5f,0x000ff0c15b8bd1c1,0x0007bb185d059822,0x00077e29db067230,0x0000292672f987ac}},
+{{0x0002623ae7692faa,0x000d685e115a0181,0x000653368a688fb8,0x000bd42b54e52684,0x0000396a9bd6a342}, {0x0008e5688afcc0b5,0x0005e309bc74fc92,0x000121d3fd6dd085,0x000b79676912c8c3,0x0000428101e0e8fd}, {0x00073a3786ee3c13,0x0000d568961363a8,0x0007f437f6d27de2,0x0000e11d1db54f4c,0x000044f35c6dcace}},
+{{0x000eaec0ddbbb9f2,0x000f041aa8de6c8f,0x0008881d72ba6ff4,0x000d1dd142bfe796,0x00005b2571f022f2}, {0x0002f8378c966173,0x000d6e4c3f9f6b26,0x0008666c59eea0c3,0x0001873fe4c2a02d,0x00005f35116378ad}, {0x00094a92345bae24,0x0005df1c69646891,0x00041445b52c4532,0x000c47af446ca04e,0x000023834f72b138}},
+{{0x000f95c7f0219411,0x00017ccea22021cd,0x000fe807eddf33e4,0x00058f8189a943ac,0x00005fb224d4ee55}, {0x000d9bbd63018280,0x000b2759a39f63a6,0x00047443c0fea75d,0x00091449a7bb7fa4,0x000034a9b2025f69}, {0x0009ec543bb2aa57,0x0006b0ee5e1a2b08,0x000fabd3c94bb2a6,0x00022e018a26bc84,0x0000100d0e22e6ad}},
+{{0x000eed2c494233d4,0x000596dfc6920515,0x0002742447bc03c4,0x0005e48e34f37254,0x0000183e91638aaa}, {0x000d65cc0f1a13ea,0x000eb2ec9751c922,0x0001db594cb44488,0x000ea392c3da4bf1,0x000040dc12c67fff}, {0x000265ee6b8c3588,0x000be6bff332a9bf,0x0000483504c6ee79,0x000704374fcb177a,0x000058eb23bbd295}},
+{{0x0004e0410460c0b8,0x000e00a239921b5c,0x0006a955940a8fd5,0x000a9cad79051d8b,0x0000001ac45a1e07}, {0x000b89d52305b8b0,0x0006905baf6198c6,0x000c6dfe0200da17,0x00099e01e25dae3d,0x00007bf1d71e654b}, {0x0000826266cb4dc1,0x0007849d889cd1d7,0x00009d710c22716a,0x00026215c9f2e2b0,0x0000004a0ae52909}},
+{{0x000d1fb8f402ca86,0x000060b3965efbe1,0x00011b2d7c1bad31,0x0008b416b5889db0,0x0000475754ca9713}, {0x000ab335cde14277,0x00022cf62af72b22,0x000e9db3be4514d8,0x000aa7c194deeedc,0x00006fd50e08e927}, {0x000c9e4794b98ccf,0x000e5ed5ddbbee09,0x000739455e8ae359,0x000eb990c20566c5,0x000078c7431103c0}},
+{{0x0006d7aedfd9b2db,0x000d1f61381806f2,0x0001460479fed447,0x000ce3d6bf5fd66c,0x0000238396a8cb9f}, {0x000669501a058417,0x000ce57ea841f122,0x000f26130da5479f,0x0007aee5a5485e72,0x00004fbf450b1725}, {0x00044edc9520099d,0x0001c9e658dc2979,0x00089408133a39d6,0x000285d4e12ff1ee,0x000043dc9683983c}},
+{{0x0008e97800e337dc,0x000cfcd88d2b6d7d,0x000036b3484ffcb6,0x000bb06bb742816b,0x00004dd9569496a8}, {0x000e15083c154d1c,0x00002af7e02bd08b,0x000b60f6a773ed36,0x0008e226590155d4,0x00006ab56ed353da}, {0x000747f638b335b4,0x000bb99738e90535,0x00042e609d134ac4,0x000eff18c5f2a4eb,0x000054b8e0db89af}},
+{{0x00013e4b05f06b06,0x00040693eaa0f8f9,0x0006bc0df43c3214,0x000257b7a16c4a2f,0x0000301f5e71a783}, {0x0003b3b79bdb862e,0x0003de54b7d99fd6,0x0002d554a44e659b,0x000a9f65abe20004,0x0000399d6077d4c7}, {0x000322608bf29ebe,0x0005a07632cdc457,0x000536096ea31540,0x000b04953323a275,0x00000f7d4dae1d3c}},
+{{0x000e1ddc4ccb2a14,0x0008042e3401586f,0x000388ab20e0fc87,0x000a1859bfb50b8a,0x00007df4127c8ab2}, {0x00025aaf4e79f23b,0x0007457528e972ca,0x00010303c5532f81,0x000f1588645a917c,0x00000d01cf5763f1}, {0x000d63e638a3d57e,0x0000955fa1e6c9eb,0x0007faa5f4f963f9,0x000c0f4763d4cbbd,0x00005d51209d69a8}},
+{{0x0006ab506528d236,0x000f40eb621d6ad0,0x0007e87f2f462e23,0x000d2473e896c1db,0x00007f0326d1b50f}, {0x000e8749fe6dd6b1,0x000ee99077392a91,0x00076e9228f6b2bd,0x00022271c7087198,0x00004d8ea3745151}, {0x000aa99bab35d2e8,0x000a8777b6022851,0x000b9292eba509ad,0x0002254fd53bd8e0,0x0000791056d063dc}},
+{{0x000de31790f87ba4,0x000f2a0c75e17c10,0x000e7121434f768f,0x00082538fedc015c,0x00007f848f64df0a}, {0x000183ed2d2d15fa,0x000152a2bc4ef0f1,0x0009002fe6017e56,0x000e8543c7971758,0x00004d5b715d890e}, {0x0003da623983e562,0x00075ca5d4ac8c51,0x0000f990687625a6,0x0000f7aa82a8deca,0x00001882a901bc77}},
+{{0x000e582d0df4b01e,0x0005118e6c5c4e74,0x00087e87b5b711da,0x000f0c822773291d,0x00002f8c76440743}, {0x000b6c2a38dfd4dc,0x0002904acf814e00,0x000806ab1808589b,0x00085e800bc25178,0x000058ed12a195d1}, {0x0004a4e45b282a53,0x0004ea8911893fc2,0x000f90aa536b6ed0,0x000c7c3ca9e0e384,0x000024fcab9221ec}},
+{{0x0009e97c043a674e,0x000d3a90af8412f1,0x00008cf093f0463e,0x000d3c08ef57c5c4,0x0000481525009d8f}, {0x000bd2e5b2c59c31,0x000553427b396bb0,0x0001ebacd38fccf8,0x0007f2be6487835d,0x000033a0a27f867e}, {0x00058dc57e666b0b,0x000414c71fbcbfb0,0x000bc18e8c1d06bf,0x0001416036331c7a,0x000041f7ba626d7c}},
+{{0x00065aeaa3e5e71d,0x0008155d8aefa414,0x00069e3500123fa9,0x00098611a14d9eac,0x00002ebd515a0d46}, {0x000a1189e3617e40,0x00077ee6f22d50fd,0x0005a1984aebaddd,0x0008d7b7430026d9,0x000010eda3512332}, {0x000d0ffb25cfbb9a,0x0004e8ab5da3b81b,0x000008a3207c41bc,0x0008b513e8a7b284,0x000015c9018c41b6}},
+{{0x000d53f85f00cffa,0x00035a0aad810194,0x000cd8d5e499ff06,0x000d9c475e508de9,0x0000711ac21e1abe}, {0x0009eedbd9998a1b,0x000b1b9cc20dee02,0x0007edbb9b72dd1f,0x000353c1101448cc,0x000051768ee9952b}, {0x000cb4eea3034a11,0x000fbc7759c357f4,0x000ec141e64ccebb,0x00086b2a72d1ad61,0x0000718b98dcd8fd}},
+{{0x0004f850f131e76a,0x0007cdf13c921530,0x0005778c770af5f4,0x000fa40fc2fe831c,0x00007dd4eda56604}, {0x000cb8fc1e4f898b,0x0003070251c0c238,0x00091cf8c5d689ab,0x0006c494be126fb9,0x00003b1e85015c10}, {0x00020fe37164a197,0x00096617f7897567,0x000b8561b281b2aa,0x0008d0269695d1a1,0x00006e7754727f8b}},
+{{0x000884df687e0c1d,0x0007775f19fea4f1,0x0003fa6b53f772dd,0x0002e22209837ec9,0x00005e3d95832440}, {0x000399c07faffa71,0x000af12631536cb9,0x00034d94e877b757,0x0003ebc4184832c1,0x000068634f8ea8c1}, {0x000ede0fad9ddb8b,0x000960dbe04cfaad,0x00080ec56ddf697a,0x0008619ee013b80c,0x0000304a1e8425cc}},
+{{0x000ea4d19cdbe690,0x0004c9aa2c183fea,0x000a7c7134270d41,0x000a254b7d5a7a1f,0x00002dc9ac636a65}, {0x000325dae9d28ead,0x00032e7f2e90bad1,0x00087ade012fa371,0x0006d0487813be4c,0x000028bbc5881343}, {0x000cc6e200de6954,0x0003ca7ac65ee5f8,0x000c489ddf5bdabc,0x000cb49751d7dc5f,0x000048f8ac494558}},
+{{0x000e93e669262ec2,0x00014ec1de4233d3,0x000856968c6068a7,0x000cf16d1110e4c7,0x000007a8edf6ab97}, {0x0005850f34b691f0,0x000d5246b47226d2,0x0009201ff85e02b8,0x00002c32eaaa79e7,0x00002da940fc879b}, {0x000d21d3ed86d995,0x000f5f53e3153186,0x000bba527bd25fe7,0x0008679010c9cc83,0x0000524fb78537e3}},
+{{0x00036a1ce4685dd2,0x000e40ad02e005a3,0x000ebf996134df8c,0x00026852ce0c7944,0x00007688d16f9f25}, {0x00074a0fc26784f3,0x000cf0e7fe5f735d,0x0003cea2b116fda5,0x0007a258cd867a43,0x000057dd3f0232a4}, {0x000ec1ee2d66d9a4,0x0007c1edbb0efb11,0x0005a83ff4981df2,0x000bdc9a7905ce56,0x00001abdc3cd3dc3}},
+{{0x0008574a4e545d68,0x0009d4d243189490,0x00058a034d1404af,0x0000e77e05494e1b,0x000065ed618ff02e}, {0x0009999428ff64ce,0x000e302ea9751036,0x00011212cdf9840d,0x000b2d78db27a4e6,0x00007de1c06a98fa}, {0x00099434706f90cd,0x000b01f44950a857,0x000307492dcc9d20,0x0002b92cdd97590b,0x000012bf1f7672b5}},
+},
+};
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* #define IFMA_ED25519_PRECOMP7_H */
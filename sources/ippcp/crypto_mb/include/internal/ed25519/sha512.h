@@ -173,6 +173,35 @@ void SHA512Init(SHA512State* pState);
 void SHA512Update(const int8u* pSrc, int len, SHA512State* pState);
 void SHA512Final(int8u* pMD, SHA512State* pState);
 
+/*
+// SHA512 multi-buffer (8 lanes) context
+*/
+#define SHA512_NUM_BUFFERS8  (8)
+
+/* intermediate hash, msgHash[i][n] is i-th word of the n-th lane */
+typedef int64u sha512_hash_mb8[8][SHA512_NUM_BUFFERS8];
+
+struct _cpSHA512_mb8 {
+    int             msgBuffIdx[SHA512_NUM_BUFFERS8];             /* buffer entry         */
+    int64u          msgLen[SHA512_NUM_BUFFERS8];                 /* message length       */
+    int8u           msgBuffer[SHA512_NUM_BUFFERS8][MBS_SHA512];  /* buffer               */
+    __ALIGN64
+    sha512_hash_mb8 msgHash;                                     /* intermediate hash    */
+};
+typedef struct _cpSHA512_mb8   SHA512State_mb8;
+
+/*
+// SHA512 multi-buffer internal functions
+//
+// Lanes with NULL pa_src[n] are not updated, lanes with NULL pa_md[n] are not stored.
+*/
+
+void sha512_avx512_mb8(sha512_hash_mb8 hash, const int8u* const pa_msg[8], const int len[8]);
+void SHA512Init_mb8(SHA512State_mb8* pState);
+void SHA512Update_mb8(const int8u* const pa_src[8], const int32u len[8], SHA512State_mb8* pState);
+void SHA512Final_mb8(int8u* const pa_md[8], SHA512State_mb8* pState);
+void SHA512MsgDigest_mb8(const int8u* const pa_msg[8], const int32u len[8], int8u* const pa_md[8]);
+
 #endif /* #if (_MBX>=_MBX_K1) */
 
 #endif /* SHA_512_H */
@@ -0,0 +1,81 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IFMA_ED448_H
+#define IFMA_ED448_H
+
+#include <crypto_mb/ed448.h>
+#include <internal/ed448/ifma_arith_p448.h>
+#include <internal/ed448/ifma_arith_n448.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* homogeneous: (X:Y:Z) satisfying x=X/Z, y=Y/Z, coordinates are in Montgomery domain */
+typedef struct ge448_homo_mb_t {
+   fe448_mb X;
+   fe448_mb Y;
+   fe448_mb Z;
+} ge448_homo_mb;
+
+/* bitsize of compression point */
+#define GE448_COMP_BITSIZE  (P448_BITSIZE+8)
+
+/* bitsize of scalars processed by the point multiplication */
+#define ED448_SCALAR_BITSIZE  (P448_BITSIZE)
+
+/* set GE to neutral */
+__MBX_INLINE void neutral_ge448_homo_mb(ge448_homo_mb* ge)
+{
+   MB_FUNC_NAME(zero_FE448_)(ge->X);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(ge->Y, 1);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(ge->Z, 1);
+}
+
+/* move GE under mask (conditionally): r = k? a : b */
+__MBX_INLINE void cmov_ge448_homo_mb(ge448_homo_mb* r, const ge448_homo_mb* b, __mb_mask k, const ge448_homo_mb* a)
+{
+   MB_FUNC_NAME(mask_mov_FE448_)(r->X, b->X, k, a->X);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->Y, b->Y, k, a->Y);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->Z, b->Z, k, a->Z);
+}
+
+/* private functions */
+void ge448_homo_add(ge448_homo_mb* r, const ge448_homo_mb* p, const ge448_homo_mb* q);
+void ge448_homo_dbl(ge448_homo_mb* r, const ge448_homo_mb* p);
+void ge448_homo_compress(U64 r[P448_LEN52], const ge448_homo_mb* p);
+__mb_mask ge448_homo_decompress(ge448_homo_mb* r, const U64 in[P448_LEN52]);
+
+void ifma_ed448_mul_basepoint(ge448_homo_mb* r, const U64 scalar[]);
+void ifma_ed448_mul_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalar[]);
+void ifma_ed448_prod_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalarP[], const U64 scalarG[]);
+
+mbx_status MB_FUNC_NAME(internal_avx512_ed448_public_key_)(ed448_public_key* pa_public_key[8],
+                                                           const ed448_private_key* const pa_private_key[8]);
+
+mbx_status MB_FUNC_NAME(internal_avx512_ed448_sign_)(ed448_sign_component* pa_sign_r[8],
+                                                     ed448_sign_component* pa_sign_s[8],
+                                                     const int8u* const pa_msg[8], const int32u msgLen[8],
+                                                     const ed448_private_key* const pa_private_key[8],
+                                                     const ed448_public_key* const pa_public_key[8]);
+
+mbx_status MB_FUNC_NAME(internal_avx512_ed448_verify_)(const ed448_sign_component* const pa_sign_r[8],
+                                                       const ed448_sign_component* const pa_sign_s[8],
+                                                       const int8u* const pa_msg[8], const int32u msgLen[8],
+                                                       const ed448_public_key* const pa_public_key[8]);
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* IFMA_ED448_H */
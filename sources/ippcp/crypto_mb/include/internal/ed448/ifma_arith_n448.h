@@ -0,0 +1,38 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IFMA_ARITH_N448_H
+#define IFMA_ARITH_N448_H
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* bitsize of base point order */
+#define N448_BITSIZE    (446)
+#define NE448_LEN52     NUMBER_OF_DIGITS(N448_BITSIZE, DIGIT_SIZE)
+
+/* r = a*b+c mod n, a,b,c < n */
+void ifma52_ed448n_madd(U64 r[NE448_LEN52], const U64 a[NE448_LEN52], const U64 b[NE448_LEN52], const U64 c[NE448_LEN52]);
+/* r = x mod n, x < 2^912 */
+void ifma52_ed448n_reduce(U64 r[NE448_LEN52], const U64 x[NE448_LEN52 * 2]);
+/* a < n */
+__mb_mask ifma52_ed448n_cmp_lt(const U64 a[NE448_LEN52]);
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* IFMA_ARITH_N448_H */
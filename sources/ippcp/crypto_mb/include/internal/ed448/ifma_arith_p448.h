@@ -0,0 +1,135 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#ifndef IFMA_ARITH_P448_H
+#define IFMA_ARITH_P448_H
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* underlying prime's size */
+#define P448_BITSIZE (448)
+
+/* lengths of FF elements */
+#define P448_LEN52  NUMBER_OF_DIGITS(P448_BITSIZE,DIGIT_SIZE)
+#define P448_LEN64  NUMBER_OF_DIGITS(P448_BITSIZE,64)
+
+/* mb field element */
+typedef U64 fe448_mb[P448_LEN52];
+
+/* set FE to zero */
+__MBX_INLINE void MB_FUNC_NAME(zero_FE448_)(U64 T[])
+{
+   T[0] = T[1] = T[2] = T[3] = T[4] = T[5] = T[6] = T[7] = T[8] = get_zero64();
+}
+
+/* check if FE is zero */
+__MBX_INLINE __mb_mask MB_FUNC_NAME(is_zero_FE448_)(const U64 T[])
+{
+   U64 Z = or64(or64(or64(T[0], T[1]), or64(T[2], T[3])), or64(or64(T[4], T[5]), or64(or64(T[6], T[7]), T[8])));
+   return cmpeq64_mask(Z, get_zero64());
+}
+
+/* move field element */
+__MBX_INLINE void MB_FUNC_NAME(mov_FE448_)(U64 r[], const U64 a[])
+{
+   r[0] = a[0];
+   r[1] = a[1];
+   r[2] = a[2];
+   r[3] = a[3];
+   r[4] = a[4];
+   r[5] = a[5];
+   r[6] = a[6];
+   r[7] = a[7];
+   r[8] = a[8];
+}
+
+/* move coordinate using mask: R = k? A : B */
+OPTIMIZE_OFF_VS19
+__MBX_INLINE void MB_FUNC_NAME(mask_mov_FE448_)(U64 R[], const U64 B[], __mb_mask k, const U64 A[])
+{
+   R[0] = mask_mov64(B[0], k, A[0]);
+   R[1] = mask_mov64(B[1], k, A[1]);
+   R[2] = mask_mov64(B[2], k, A[2]);
+   R[3] = mask_mov64(B[3], k, A[3]);
+   R[4] = mask_mov64(B[4], k, A[4]);
+   R[5] = mask_mov64(B[5], k, A[5]);
+   R[6] = mask_mov64(B[6], k, A[6]);
+   R[7] = mask_mov64(B[7], k, A[7]);
+   R[8] = mask_mov64(B[8], k, A[8]);
+}
+
+/* swap coordinates using mask: (A,B) = k? (B,A) : (A,B) */
+__MBX_INLINE void MB_FUNC_NAME(mask_swap_FE448_)(U64 A[], __mb_mask k, U64 B[])
+{
+   for(int i=0; i<P448_LEN52; i++) {
+      U64 t = _mm512_maskz_xor_epi64(k, A[i], B[i]);
+      A[i] = xor64(A[i], t);
+      B[i] = xor64(B[i], t);
+   }
+}
+
+__MBX_INLINE __mb_mask MB_FUNC_NAME(cmp_eq_FE448_)(const U64 A[], const U64 B[])
+{
+   U64 T[P448_LEN52];
+
+   T[0] = xor64(A[0], B[0]);
+   T[1] = xor64(A[1], B[1]);
+   T[2] = xor64(A[2], B[2]);
+   T[3] = xor64(A[3], B[3]);
+   T[4] = xor64(A[4], B[4]);
+   T[5] = xor64(A[5], B[5]);
+   T[6] = xor64(A[6], B[6]);
+   T[7] = xor64(A[7], B[7]);
+   T[8] = xor64(A[8], B[8]);
+
+   return MB_FUNC_NAME(is_zero_FE448_)(T);
+}
+
+/*
+// Specialized operations over p448 = 2^448 - 2^224 - 1
+//
+// Montgomery (R = 2^(P448_LEN52*DIGIT_SIZE)) functions accept and return
+// values less than 2*p448, ifma_reduce52_p448_() returns fully reduced value.
+*/
+EXTERN_C void MB_FUNC_NAME(ifma_tomont52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_frommont52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ams52_p448_)(U64 r[], const U64 va[]);
+EXTERN_C void MB_FUNC_NAME(ifma_amm52_p448_)(U64 r[], const U64 va[], const U64 vb[]);
+EXTERN_C void MB_FUNC_NAME(ifma_aminv52_p448_)(U64 r[], const U64 z[]);
+EXTERN_C void MB_FUNC_NAME(ifma_ampow52_p448m3div4_)(U64 r[], const U64 z[]);
+EXTERN_C void MB_FUNC_NAME(ifma_add52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_sub52_p448_)(U64 r[], const U64 a[], const U64 b[]);
+EXTERN_C void MB_FUNC_NAME(ifma_neg52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C void MB_FUNC_NAME(ifma_reduce52_p448_)(U64 r[], const U64 a[]);
+EXTERN_C __mb_mask MB_FUNC_NAME(ifma_cmp_lt_p448_)(const U64 a[]);
+
+/* Montgomery domain constants: 1 and small integers */
+EXTERN_C void MB_FUNC_NAME(ifma_set_u32_p448_)(U64 r[], int32u a);
+
+#define fe448_add   MB_FUNC_NAME(ifma_add52_p448_)
+#define fe448_sub   MB_FUNC_NAME(ifma_sub52_p448_)
+#define fe448_neg   MB_FUNC_NAME(ifma_neg52_p448_)
+#define fe448_mul   MB_FUNC_NAME(ifma_amm52_p448_)
+#define fe448_sqr   MB_FUNC_NAME(ifma_ams52_p448_)
+#define fe448_inv   MB_FUNC_NAME(ifma_aminv52_p448_)
+#define fe448_red   MB_FUNC_NAME(ifma_reduce52_p448_)
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* IFMA_ARITH_P448_H */
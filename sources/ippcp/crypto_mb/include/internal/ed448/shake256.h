@@ -0,0 +1,60 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//   Definitions that are necessary for SHAKE256 (FIPS 202) computation
+*/
+
+#ifndef SHAKE_256_H
+#define SHAKE_256_H
+
+#include <internal/common/ifma_defs.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* SHAKE256 rate (block size) in bytes */
+#define SHAKE256_RATE          (136)
+#define SHAKE256_NUM_BUFFERS8  (8)
+
+/* Keccak-f[1600] state, state[i][n] is i-th word of the n-th lane */
+typedef int64u keccak_state_mb8[25][SHAKE256_NUM_BUFFERS8];
+
+/*
+// SHAKE256 multi-buffer (8 lanes) context
+*/
+struct _cpSHAKE256_mb8 {
+    int              msgBuffIdx[SHAKE256_NUM_BUFFERS8];                /* buffer entry  */
+    int8u            msgBuffer[SHAKE256_NUM_BUFFERS8][SHAKE256_RATE];  /* buffer        */
+    __ALIGN64
+    keccak_state_mb8 state;                                            /* sponge state  */
+};
+typedef struct _cpSHAKE256_mb8   SHAKE256State_mb8;
+
+/*
+// SHAKE256 multi-buffer internal functions
+//
+// Lanes with NULL pa_src[n] are not updated, lanes with NULL pa_md[n] are not stored.
+*/
+
+void keccak_absorb_avx512_mb8(keccak_state_mb8 state, const int8u* const pa_msg[8], const int len[8]);
+void SHAKE256Init_mb8(SHAKE256State_mb8* pState);
+void SHAKE256Update_mb8(const int8u* const pa_src[8], const int32u len[8], SHAKE256State_mb8* pState);
+void SHAKE256Final_mb8(int8u* const pa_md[8], int mdLen, SHAKE256State_mb8* pState);
+void SHAKE256MsgDigest_mb8(const int8u* const pa_msg[8], const int32u len[8], int8u* const pa_md[8], int mdLen);
+
+#endif /* #if (_MBX>=_MBX_K1) */
+
+#endif /* SHAKE_256_H */
@@ -33,6 +33,8 @@ typedef int64u (*pint64u_x8) [8];   // pointer to 8-term vector of int64u each
 #define RSA_2K (2*RSA_1K)
 #define RSA_3K (3*RSA_1K)
 #define RSA_4K (4*RSA_1K)
+#define RSA_6K (6*RSA_1K)
+#define RSA_8K (8*RSA_1K)
 
 #define NUMBER_OF_DIGITS(bitsize, digsize) (((bitsize) + (digsize)-1)/(digsize))
 #define MULTIPLE_OF(x, factor)             ((x) + (((factor) -((x)%(factor))) %(factor)))
@@ -50,6 +52,8 @@ EXTERN_C void ifma_amm52x60_mb8(int64u* out_mb8, const int64u* inpA_mb8, const i
 EXTERN_C void ifma_amm52x40_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void ifma_amm52x30_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 EXTERN_C void ifma_amm52x79_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+EXTERN_C void ifma_amm52x119_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
+EXTERN_C void ifma_amm52x158_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
 
 // New functions for almost half montgomery
 EXTERN_C void ifma_ahmm52x20_mb8(int64u* out_mb8, const int64u* inpA_mb8, const int64u* inpB_mb8, const int64u* inpBx_mb8, const int64u* inpM_mb8, const int64u* k0_mb8);
@@ -88,16 +92,22 @@ EXTERN_C void ifma_modsub52x10_mb8(int64u res[][8], const int64u inpA[][8], cons
 EXTERN_C void ifma_modsub52x20_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8]);
 EXTERN_C void ifma_modsub52x30_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8]);
 EXTERN_C void ifma_modsub52x40_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8]);
+EXTERN_C void ifma_modsub52x60_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8]);
+EXTERN_C void ifma_modsub52x79_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8]);
 
 EXTERN_C void ifma_addmul52x10_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8]);
 EXTERN_C void ifma_addmul52x20_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8]);
 EXTERN_C void ifma_addmul52x30_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8]);
 EXTERN_C void ifma_addmul52x40_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8]);
+EXTERN_C void ifma_addmul52x60_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8]);
+EXTERN_C void ifma_addmul52x79_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8]);
 
 EXTERN_C void ifma_amred52x10_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8]);
 EXTERN_C void ifma_amred52x20_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8]);
 EXTERN_C void ifma_amred52x30_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8]);
 EXTERN_C void ifma_amred52x40_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8]);
+EXTERN_C void ifma_amred52x60_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8]);
+EXTERN_C void ifma_amred52x79_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8]);
 
 EXTERN_C void ifma_mreduce52x_mb8(int64u pX[][8], int nsX, int64u pM[][8], int nsM);
 EXTERN_C void ifma_montRR52x_mb8(int64u pRR[][8], int64u pM[][8], int convBitLen);
@@ -181,6 +191,20 @@ EXTERN_C void EXP52x79_pub65537_mb8(int64u out[][8],
                               const int64u  k0[8],
                               int64u work_buffer[][8]);
 
+EXTERN_C void EXP52x119_pub65537_mb8(int64u out[][8],
+                               const int64u base[][8],
+                               const int64u modulus[][8],
+                               const int64u toMont[][8],
+                               const int64u  k0[8],
+                               int64u work_buffer[][8]);
+
+EXTERN_C void EXP52x158_pub65537_mb8(int64u out[][8],
+                               const int64u base[][8],
+                               const int64u modulus[][8],
+                               const int64u toMont[][8],
+                               const int64u  k0[8],
+                               int64u work_buffer[][8]);
+
 
 mbx_status MB_FUNC_NAME(internal_avx512_x25519_)(int8u* const pa_shared_key[8], const int8u* const pa_private_key[8],
                                                         const int8u* const pa_public_key[8]);
@@ -188,6 +212,20 @@ mbx_status MB_FUNC_NAME(internal_avx512_x25519_)(int8u* const pa_shared_key[8],
 mbx_status MB_FUNC_NAME(internal_avx512_x25519_public_key_)(int8u* const pa_public_key[8],
                                                                    const int8u* const pa_private_key[8]);
 
+mbx_status MB_FUNC_NAME(internal_avx512_x448_)(int8u* const pa_shared_key[8], const int8u* const pa_private_key[8],
+                                                      const int8u* const pa_public_key[8]);
+
+mbx_status MB_FUNC_NAME(internal_avx512_x448_public_key_)(int8u* const pa_public_key[8],
+                                                                 const int8u* const pa_private_key[8]);
+
 #endif /* #if (_MBX>=_MBX_K1) */
 
+#if (_MBX==_MBX_L9)
+/* AVX2 x25519 */
+mbx_status internal_avx2_x25519_mb8(int8u* const pa_shared_key[8], const int8u* const pa_private_key[8],
+                                    const int8u* const pa_public_key[8]);
+mbx_status internal_avx2_x25519_public_key_mb8(int8u* const pa_public_key[8],
+                                               const int8u* const pa_private_key[8]);
+#endif /* #if (_MBX==_MBX_L9) */
+
 #endif /* _IFMA_INTERNAL_H_ */
@@ -48,4 +48,42 @@ EXTERN_C void ifma_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
 
 #endif /* #if (_MBX>=_MBX_K1) */
 
+#if (_MBX==_MBX_L9)
+
+#include <internal/common/avx2_arith26_mb8.h>
+
+/* scratch buffer sizes (bytes) of the AVX2 layers */
+#define AVX2_RSA_PUB_BUFF_SIZE(rsaBitlen) \
+   (64 + (1 + 4*LEN26(rsaBitlen)) * 8*sizeof(int64u))
+#define AVX2_RSA_PRV2_BUFF_SIZE(rsaBitlen) \
+   (64 + (1 + NUMBER_OF_DIGITS(rsaBitlen,64) + 3*LEN26(rsaBitlen) + MODEXP26_BUFF_ROWS(LEN26(rsaBitlen))) * 8*sizeof(int64u))
+#define AVX2_RSA_PRV5_BUFF_SIZE(rsaBitlen) \
+   (64 + (1 + NUMBER_OF_DIGITS((rsaBitlen)/2,64) + 7*LEN26((rsaBitlen)/2) + MODEXP26_BUFF_ROWS(LEN26((rsaBitlen)/2))) * 8*sizeof(int64u))
+
+EXTERN_C void avx2_cp_rsa_pub_layer_mb8(const int8u* const from_pa[8],
+                                              int8u* const to_pa[8],
+                                        const int64u* const n_pa[8],
+                                              int rsaBitlen,
+                                        const mbx_RSA_Method* m,
+                                              int8u* pBuffer);
+EXTERN_C void avx2_cp_rsa_prv2_layer_mb8(const int8u* const from_pa[8],
+                                               int8u* const to_pa[8],
+                                         const int64u* const d_pa[8],
+                                         const int64u* const n_pa[8],
+                                               int rsaBitlen,
+                                         const mbx_RSA_Method* m,
+                                               int8u* pBuffer);
+EXTERN_C void avx2_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
+                                               int8u* const to_pa[8],
+                                         const int64u* const p_pa[8],
+                                         const int64u* const q_pa[8],
+                                         const int64u* const dp_pa[8],
+                                         const int64u* const dq_pa[8],
+                                         const int64u* const iq_pa[8],
+                                               int rsaBitlen,
+                                         const mbx_RSA_Method* m,
+                                               int8u* pBuffer);
+
+#endif /* #if (_MBX==_MBX_L9) */
+
 #endif /* IFMA_CP_LAYER_H */
@@ -60,6 +60,8 @@ typedef enum {
    RSA2048 = 2048,
    RSA3072 = 3072,
    RSA4096 = 4096,
+   RSA6144 = 6144,
+   RSA8192 = 8192,
 } RSA_BITSIZE_ID;
 
 /* RSA ID */
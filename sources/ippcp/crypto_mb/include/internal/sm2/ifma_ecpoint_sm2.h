@@ -182,6 +182,23 @@ mbx_status internal_avx512_sm2_ecpublic_key_mb8(int64u* pa_pubx[8],
                                           const int64u* const pa_skey[8],
                                           int8u* pBuffer, int use_jproj_coords);
 
+mbx_status internal_avx512_sm2_encrypt_mb8(int8u* pa_out[8],
+                                     const int8u* const pa_msg[8],
+                                              const int msg_len[8],
+                                    const int64u* const pa_eph_skey[8],
+                                    const int64u* const pa_pubx[8],
+                                    const int64u* const pa_puby[8],
+                                    const int64u* const pa_pubz[8],
+                                           int8u* pBuffer, int use_jproj_coords,
+                                           mbx_status current_status);
+
+mbx_status internal_avx512_sm2_decrypt_mb8(int8u* pa_out[8],
+                                     const int8u* const pa_inp[8],
+                                              const int inp_len[8],
+                                    const int64u* const pa_skey[8],
+                                           int8u* pBuffer,
+                                           mbx_status current_status);
+
 #endif /* #if (_MBX>=_MBX_K1) */
 
 #endif /* IFMA_ECPOINT_PSM2_H */
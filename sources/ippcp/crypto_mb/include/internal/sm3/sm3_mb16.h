@@ -47,6 +47,10 @@ mbx_status16 internal_avx512_sm3_final_mb16(int8u* hash_pa[16], SM3_CTX_mb16* p_
 mbx_status16 internal_avx512_sm3_msg_digest_mb16(const int8u* const msg_pa[16], int len[16], int8u* hash_pa[16]);
 mbx_status16 internal_avx512_sm3_update_mb16(const int8u* const msg_pa[16], int len[16], SM3_CTX_mb16* p_state);
 
+mbx_status16 internal_avx512_hmac_sm3_init_mb16(const int8u* const key_pa[16], const int key_len[16], HMAC_SM3_CTX_mb16* p_state);
+mbx_status16 internal_avx512_hmac_sm3_final_mb16(int8u* mac_pa[16], HMAC_SM3_CTX_mb16* p_state);
+mbx_status16 internal_avx512_sm3_kdf_mb16(int8u* out_pa[16], const int out_len[16], const int8u* const z_pa[16], const int z_len[16]);
+
 
 #endif /* #if (_MBX>=_MBX_K1) */
 
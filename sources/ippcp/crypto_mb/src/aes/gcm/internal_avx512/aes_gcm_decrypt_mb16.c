@@ -0,0 +1,68 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// This function performs decryption of given data and updates ghash with given data.
+// Function returns mask where bit is set to 1 if length of given data for buffer is overflowed.
+*/
+
+__mmask16 aes_gcm_decrypt_mb16(int8u *pa_out[AES_LINES],
+                               const int8u *const pa_in[AES_LINES],
+                               const int in_len[AES_LINES],
+                               __mmask16 mb_mask,
+                               AES_GCM_CTX_mb16 *p_context)
+{
+   if (AES_GCM_CONTEXT_STATE(p_context) == aes_gcm_update_iv) {
+      /* Finalize IVs */
+      aes_gcm_finalize_iv_mb16(NULL, mb_mask, p_context);
+   }
+
+   /* Switch context state to decryption */
+   AES_GCM_CONTEXT_STATE(p_context) = aes_gcm_dec;
+
+   /* Local copy of pointers, it is updated by ghash kernels */
+   const int8u *loc_pa_in[AES_LINES];
+   storeu((void *)loc_pa_in, loadu(pa_in));
+   storeu((void *)(loc_pa_in + 8), loadu(pa_in + 8));
+
+   __m512i loc_in_len = _mm512_maskz_loadu_epi32(mb_mask, in_len);
+
+   /* Update TXT length, it is stored in low 64 bits of the length block of each buffer */
+   __mmask16 overflow_mask = aes_gcm_update_len_mb16(AES_GCM_CONTEXT_LEN(p_context), (int *)&loc_in_len, 0, MAX_TXT_LEN);
+
+   /* Update intermediate ghash value with full blocks of encrypted data (before decryption to support in-place operation) */
+   sm4_gcm_update_ghash_full_blocks_mb16(AES_GCM_CONTEXT_GHASH(p_context), loc_pa_in, &loc_in_len, AES_GCM_CONTEXT_HASHKEY(p_context), mb_mask);
+
+   if (cmp_epi32_mask(loc_in_len, setzero(), _MM_CMPINT_EQ) != 0xFFFF) {
+      /* Update intermediate ghash value with partial blocks of encrypted data */
+      sm4_gcm_update_ghash_partial_blocks_mb16(
+         AES_GCM_CONTEXT_GHASH(p_context), loc_pa_in, &loc_in_len, AES_GCM_CONTEXT_HASHKEY(p_context)[0], mb_mask);
+      /* Switch context state to tag computation to prevent encryption after any partial blocks are processed */
+      AES_GCM_CONTEXT_STATE(p_context) = aes_gcm_get_tag;
+   }
+
+   /* Decrypt */
+   aes_gctr_kernel_mb16(pa_out, pa_in, in_len, mb_mask, p_context);
+
+   return overflow_mask & mb_mask;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
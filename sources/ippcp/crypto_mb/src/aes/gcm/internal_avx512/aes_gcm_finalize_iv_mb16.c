@@ -0,0 +1,134 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// This function performs IV finalization (computes J0) in the follow way:
+// If bitlen(IV) == 96, then let J0 = IV || 0^31 ||1.
+// If bitlen(IV) != 96, then let s = 128 * [bitlen(IV) / 128] - bitlen(IV), and let J0 = GHASH(IV || 0^(s+64) || bitlen(IV)).
+//
+// 0^s means the bit string that consists of s '0' bits here
+// [x] means the least integer that is not less than the real number x here
+//
+// This function also stores initial counter value and encrypts J0 to use it later for tag computation
+*/
+
+void aes_gcm_finalize_iv_mb16(const int8u *const pa_iv[AES_LINES], __mmask16 mb_mask, AES_GCM_CTX_mb16 *p_context)
+{
+   MBX_UNREFERENCED_PARAMETER(mb_mask);
+
+   __m128i *ctr     = AES_GCM_CONTEXT_CTR(p_context);
+   __m128i *j0      = AES_GCM_CONTEXT_J0(p_context);
+   __m128i *hashkey = AES_GCM_CONTEXT_HASHKEY(p_context)[0];
+
+   int64u *iv_len = AES_GCM_CONTEXT_LEN(p_context);
+
+   __m512i hashkeys_4_0, hashkeys_4_1, hashkeys_4_2, hashkeys_4_3;
+   __m512i *hashkeys[] = { &hashkeys_4_0, &hashkeys_4_1, &hashkeys_4_2, &hashkeys_4_3 };
+
+   __m512i iv_blocks_4_0, iv_blocks_4_1, iv_blocks_4_2, iv_blocks_4_3;
+   __m512i *data_blocks[] = { &iv_blocks_4_0, &iv_blocks_4_1, &iv_blocks_4_2, &iv_blocks_4_3 };
+
+   __mmask8 eq_12_mask_lo = cmp_epi64_mask(loadu(iv_len), set1_epi64(12), _MM_CMPINT_EQ);
+   __mmask8 eq_12_mask_hi = cmp_epi64_mask(loadu(iv_len + 8), set1_epi64(12), _MM_CMPINT_EQ);
+
+   __mmask16 eq_12_mask = (__mmask16)(eq_12_mask_hi << 8 | eq_12_mask_lo);
+
+   /* IVs of 96 bit can be finalized only if the IV pointers are known */
+   if (pa_iv == NULL)
+      eq_12_mask = 0;
+
+   __mmask16 load_mask = (__mmask16)~eq_12_mask;
+
+   /* Finalize IVs of length != 96 bit */
+   if (load_mask) {
+      hashkeys_4_0 = loadu(hashkey + 0);
+      hashkeys_4_1 = loadu(hashkey + 4);
+      hashkeys_4_2 = loadu(hashkey + 8);
+      hashkeys_4_3 = loadu(hashkey + 12);
+
+      /*
+      // Construct last block 0^64 || bitlen(IV) for each buffer:
+      // lengths in bytes of 4 consecutive buffers are moved to the low 64-bit halves of 128-bit blocks
+      */
+      iv_blocks_4_0 = _mm512_maskz_expandloadu_epi64(0x55, (void *)(iv_len + 0));
+      iv_blocks_4_1 = _mm512_maskz_expandloadu_epi64(0x55, (void *)(iv_len + 4));
+      iv_blocks_4_2 = _mm512_maskz_expandloadu_epi64(0x55, (void *)(iv_len + 8));
+      iv_blocks_4_3 = _mm512_maskz_expandloadu_epi64(0x55, (void *)(iv_len + 12));
+
+      iv_blocks_4_0 = slli_epi64(iv_blocks_4_0, 3);
+      iv_blocks_4_1 = slli_epi64(iv_blocks_4_1, 3);
+      iv_blocks_4_2 = slli_epi64(iv_blocks_4_2, 3);
+      iv_blocks_4_3 = slli_epi64(iv_blocks_4_3, 3);
+
+      iv_blocks_4_0 = xor(iv_blocks_4_0, M512(j0 + 0));
+      iv_blocks_4_1 = xor(iv_blocks_4_1, M512(j0 + 4));
+      iv_blocks_4_2 = xor(iv_blocks_4_2, M512(j0 + 8));
+      iv_blocks_4_3 = xor(iv_blocks_4_3, M512(j0 + 12));
+
+      sm4_gcm_ghash_mul_single_block_mb16(data_blocks, hashkeys);
+
+      iv_blocks_4_0 = shuffle_epi8(iv_blocks_4_0, M512(swapEndianness));
+      iv_blocks_4_1 = shuffle_epi8(iv_blocks_4_1, M512(swapEndianness));
+      iv_blocks_4_2 = shuffle_epi8(iv_blocks_4_2, M512(swapEndianness));
+      iv_blocks_4_3 = shuffle_epi8(iv_blocks_4_3, M512(swapEndianness));
+
+      mask_storeu_epi64(j0 + 0, aes_gcm_qword_mask(load_mask, 0), iv_blocks_4_0);
+      mask_storeu_epi64(j0 + 4, aes_gcm_qword_mask(load_mask, 1), iv_blocks_4_1);
+      mask_storeu_epi64(j0 + 8, aes_gcm_qword_mask(load_mask, 2), iv_blocks_4_2);
+      mask_storeu_epi64(j0 + 12, aes_gcm_qword_mask(load_mask, 3), iv_blocks_4_3);
+   }
+
+   /* Finalize IVs of length == 96 bit */
+   for (int i = 0; i < AES_LINES; i++) {
+      if (0x1 & (eq_12_mask >> i)) {
+         __m128i iv_block = _mm_mask_loadu_epi8(M128(one_f), 0x0FFF, (void *)pa_iv[i]);
+         _mm_storeu_si128(j0 + i, iv_block);
+      }
+   }
+
+   /* Store initial counter */
+   storeu(ctr + 0, inc_block32(shuffle_epi8(loadu(j0 + 0), M512(swapEndianness)), initialInc));
+   storeu(ctr + 4, inc_block32(shuffle_epi8(loadu(j0 + 4), M512(swapEndianness)), initialInc));
+   storeu(ctr + 8, inc_block32(shuffle_epi8(loadu(j0 + 8), M512(swapEndianness)), initialInc));
+   storeu(ctr + 12, inc_block32(shuffle_epi8(loadu(j0 + 12), M512(swapEndianness)), initialInc));
+
+   /* Encrypt J0, encrypted value is XOR'ed with accumulated GHASH value in aes_gcm_get_tag_mb16() */
+   __m512i j0_blocks_4_0 = loadu(j0 + 0);
+   __m512i j0_blocks_4_1 = loadu(j0 + 4);
+   __m512i j0_blocks_4_2 = loadu(j0 + 8);
+   __m512i j0_blocks_4_3 = loadu(j0 + 12);
+
+   AES_ENCRYPT_VAES_MB16(j0_blocks_4_0, j0_blocks_4_1, j0_blocks_4_2, j0_blocks_4_3,
+                         AES_GCM_CONTEXT_KEY(p_context), AES_GCM_CONTEXT_ROUNDS(p_context));
+
+   storeu(j0 + 0, j0_blocks_4_0);
+   storeu(j0 + 4, j0_blocks_4_1);
+   storeu(j0 + 8, j0_blocks_4_2);
+   storeu(j0 + 12, j0_blocks_4_3);
+
+   /* Clear length buffer to reuse it for TXT and AAD length */
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 0));
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 1));
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 2));
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 3));
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
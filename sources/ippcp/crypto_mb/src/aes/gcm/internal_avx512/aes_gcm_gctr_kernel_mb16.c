@@ -0,0 +1,133 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+#include <internal/rsa/ifma_rsa_arith.h> /* for zero_mb8 */
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// This function performs GCTR encryption/decryption
+//
+// Each 512-bit register keeps 4 consecutive counter blocks of one buffer,
+// so 16 registers (64 blocks) are encrypted at each iteration and
+// the result is XOR'ed with input without any transposition.
+// Round keys of buffer are broadcasted to all 4 128-bit lanes of register.
+*/
+
+__MBX_INLINE __m128i IncBlock128(__m128i x, int32u increment) { return _mm_add_epi32(x, _mm_maskz_loadu_epi32(1, &increment)); }
+
+void aes_gctr_kernel_mb16(int8u *pa_out[AES_LINES],
+                          const int8u *const pa_inp[AES_LINES],
+                          const int len[AES_LINES],
+                          __mmask16 mb_mask,
+                          AES_GCM_CTX_mb16 *p_context)
+{
+   const __m128i(*key_sched)[AES_LINES] = (const __m128i(*)[AES_LINES])AES_GCM_CONTEXT_KEY(p_context);
+   const int num_rounds                 = AES_GCM_CONTEXT_ROUNDS(p_context);
+
+   const int8u *loc_inp[AES_LINES];
+   int8u *loc_out[AES_LINES];
+
+   /* Create the local copy of the input data length in bytes and set it to zero for non-valid buffers */
+   __m512i loc_len = _mm512_maskz_loadu_epi32(mb_mask, len);
+
+   /* input blocks loc_blks[] = ceil(loc_len[]/AES_BLOCK_SIZE) */
+   int32u loc_blks[AES_LINES];
+   storeu(loc_blks, srli_epi32(add_epi32(loc_len, set1_epi32(AES_BLOCK_SIZE - 1)), 4));
+
+   /* Local copies of the pointers to input and output buffers */
+   storeu((void *)loc_inp, loadu(pa_inp));
+   storeu((void *)(loc_inp + 8), loadu(pa_inp + 8));
+
+   storeu(loc_out, loadu(pa_out));
+   storeu(loc_out + 8, loadu(pa_out + 8));
+
+   /* TMP[] - temporary buffer for processing */
+   /* CTR - store CTR values                  */
+   __m512i TMP[AES_LINES];
+   __m512i CTR[AES_LINES];
+   __m128i loc_ctr[AES_LINES];
+
+   /* Load CTR value from valid buffers */
+   mb_mask = mask_cmp_epi32_mask(mb_mask, loc_len, setzero(), _MM_CMPINT_NLE);
+   for (int i = 0; i < AES_LINES; i++) {
+      if (0x1 & (mb_mask >> i)) {
+         loc_ctr[i] = _mm_loadu_si128(AES_GCM_CONTEXT_CTR(p_context) + i);
+      } else {
+         loc_ctr[i] = _mm_setzero_si128();
+      }
+
+      CTR[i] = broadcast_i64x2(loc_ctr[i]);
+   }
+
+   int8u *inc         = (int8u *)firstInc;
+   __mmask16 tmp_mask = mb_mask;
+
+   while (tmp_mask) {
+      for (int i = 0; i < AES_LINES; i++) {
+         CTR[i] = inc_block32(CTR[i], inc);
+         TMP[i] = xor(shuffle_epi8(CTR[i], M512(swapEndianness)), _mm512_broadcast_i32x4(key_sched[0][i]));
+      }
+
+      for (int rnd = 1; rnd < num_rounds; rnd++) {
+         for (int i = 0; i < AES_LINES; i++) {
+            TMP[i] = _mm512_aesenc_epi128(TMP[i], _mm512_broadcast_i32x4(key_sched[rnd][i]));
+         }
+      }
+
+      for (int i = 0; i < AES_LINES; i++) {
+         TMP[i] = _mm512_aesenclast_epi128(TMP[i], _mm512_broadcast_i32x4(key_sched[num_rounds][i]));
+      }
+
+      /* Mask for data loading */
+      __mmask64 stream_mask;
+      int *p_loc_len = (int *)&loc_len;
+
+      for (int i = 0; i < AES_LINES; i++) {
+         UPDATE_STREAM_MASK_64(stream_mask, p_loc_len)
+         mask_storeu_epi8((__m512i *)loc_out[i], stream_mask, xor(TMP[i], maskz_loadu_epi8(stream_mask, loc_inp[i])));
+      }
+
+      /* Update pointers to data */
+      M512(loc_inp)     = add_epi64(loadu(loc_inp), set1_epi64(4 * AES_BLOCK_SIZE));
+      M512(loc_inp + 8) = add_epi64(loadu(loc_inp + 8), set1_epi64(4 * AES_BLOCK_SIZE));
+
+      M512(loc_out)     = add_epi64(loadu(loc_out), set1_epi64(4 * AES_BLOCK_SIZE));
+      M512(loc_out + 8) = add_epi64(loadu(loc_out + 8), set1_epi64(4 * AES_BLOCK_SIZE));
+
+      /* Update number of blocks left and processing mask */
+      loc_len  = sub_epi32(loc_len, set1_epi32(4 * AES_BLOCK_SIZE));
+      tmp_mask = mask_cmp_epi32_mask(mb_mask, loc_len, setzero(), _MM_CMPINT_NLE);
+      inc      = (int8u *)nextInc;
+   }
+
+   /* update and store counters */
+   for (int i = 0; i < AES_LINES; i++) {
+      if (0x1 & (mb_mask >> i)) {
+         loc_ctr[i] = IncBlock128(loc_ctr[i], loc_blks[i]);
+         _mm_storeu_si128(AES_GCM_CONTEXT_CTR(p_context) + i, loc_ctr[i]);
+         loc_ctr[i] = _mm_setzero_si128();
+      }
+   }
+
+   /* clear local copy of sensitive data */
+   zero_mb8((int64u(*)[8])TMP, sizeof(TMP) / sizeof(TMP[0]));
+   zero_mb8((int64u(*)[8])CTR, sizeof(CTR) / sizeof(CTR[0]));
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
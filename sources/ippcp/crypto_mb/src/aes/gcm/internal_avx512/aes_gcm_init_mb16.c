@@ -0,0 +1,67 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+
+#if (_MBX>=_MBX_K1)
+
+mbx_status16 internal_avx512_aes_gcm_init_mb16(const int8u *const pa_key[AES_LINES],
+                                               const int key_len,
+                                               const int8u *const pa_iv[AES_LINES],
+                                               const int iv_len[AES_LINES],
+                                               AES_GCM_CTX_mb16 *p_context,
+                                               __mmask16 mb_mask_iv,
+                                               __mmask16 mb_mask)
+{
+   mbx_status16 status = 0;
+
+   /* Clear buffers */
+   SM4_GCM_CLEAR_BUFFER((SM4_GCM_CONTEXT_BUFFER_SLOT_TYPE *)AES_GCM_CONTEXT_J0(p_context));
+   SM4_GCM_CLEAR_BUFFER((SM4_GCM_CONTEXT_BUFFER_SLOT_TYPE *)AES_GCM_CONTEXT_GHASH(p_context));
+
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 0));
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 1));
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 2));
+   SM4_GCM_CLEAR_LEN(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 3));
+
+   /*
+   // Compute AES round keys
+   // initialize __m128i key_sched[AES_MAX_ROUNDS + 1][AES_LINES] buffer in context
+   */
+   AES_GCM_CONTEXT_ROUNDS(p_context) = key_len / 4 + 6;
+   aes_set_round_keys_mb16(AES_GCM_CONTEXT_KEY(p_context), pa_key, key_len, mb_mask);
+
+   /*
+   // Compute hashkeys
+   // initialize __m128i hashkey[AES_GCM_HASHKEY_PWR_NUM][AES_LINES] buffer in context
+   */
+   aes_gcm_precompute_hashkey_mb16(p_context);
+
+   /* Process IV */
+   __mmask16 overflow_mask = aes_gcm_update_iv_mb16(pa_iv, iv_len, mb_mask_iv, p_context);
+
+   /* Set bad status for buffers with overflowed lengths */
+   for (int buf_no = 0; buf_no < AES_LINES; buf_no++) {
+      if (overflow_mask >> buf_no & 1) {
+         status = MBX_SET_STS16(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+      }
+   }
+
+   return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -0,0 +1,59 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// This function process 16 buffers with additional authentication data (AAD)
+*/
+
+__mmask16 aes_gcm_update_aad_mb16(const int8u *const pa_aad[AES_LINES], const int aad_len[AES_LINES], __mmask16 mb_mask, AES_GCM_CTX_mb16 *p_context)
+{
+   if (AES_GCM_CONTEXT_STATE(p_context) == aes_gcm_update_iv) {
+      /* Finalize IVs */
+      aes_gcm_finalize_iv_mb16(NULL, mb_mask, p_context);
+
+      AES_GCM_CONTEXT_STATE(p_context) = aes_gcm_update_aad;
+   }
+
+   __m128i *ghash = AES_GCM_CONTEXT_GHASH(p_context);
+
+   /* Local copy of pointers, it is updated by ghash kernels */
+   const int8u *loc_pa_aad[AES_LINES];
+   storeu((void *)loc_pa_aad, loadu(pa_aad));
+   storeu((void *)(loc_pa_aad + 8), loadu(pa_aad + 8));
+
+   __m512i loc_aad_len = _mm512_maskz_loadu_epi32(mb_mask, aad_len);
+
+   /* Update AAD length, it is stored in high 64 bits of the length block of each buffer */
+   __mmask16 overflow_mask = aes_gcm_update_len_mb16(AES_GCM_CONTEXT_LEN(p_context), (int *)&loc_aad_len, 1, 0x1FFFFFFFFFFFFFFF /* (2^64 - 1) div 8 */);
+
+   /* Process full blocks of AADs */
+   sm4_gcm_update_ghash_full_blocks_mb16(ghash, loc_pa_aad, &loc_aad_len, AES_GCM_CONTEXT_HASHKEY(p_context), mb_mask);
+
+   if (cmp_epi32_mask(loc_aad_len, setzero(), _MM_CMPINT_EQ) != 0xFFFF) {
+      /* Process partial blocks of AADs */
+      sm4_gcm_update_ghash_partial_blocks_mb16(ghash, loc_pa_aad, &loc_aad_len, AES_GCM_CONTEXT_HASHKEY(p_context)[0], mb_mask);
+      AES_GCM_CONTEXT_STATE(p_context) = aes_gcm_start_encdec;
+   }
+
+   return overflow_mask & mb_mask;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -0,0 +1,74 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// This function process 16 buffers with initialization vector (IV) data
+*/
+__mmask16 aes_gcm_update_iv_mb16(const int8u *const pa_iv[AES_LINES], const int iv_len[AES_LINES], __mmask16 mb_mask, AES_GCM_CTX_mb16 *p_context)
+{
+   AES_GCM_CONTEXT_STATE(p_context) = aes_gcm_update_iv;
+
+   __m128i *j0 = AES_GCM_CONTEXT_J0(p_context);
+
+   /* Local copy of pointers, it is updated by ghash kernels */
+   const int8u *loc_pa_iv[AES_LINES];
+   storeu((void *)loc_pa_iv, loadu(pa_iv));
+   storeu((void *)(loc_pa_iv + 8), loadu(pa_iv + 8));
+
+   __m512i loc_iv_len = _mm512_maskz_loadu_epi32(mb_mask, iv_len);
+   __m512i max_iv_len = set1_epi64(0x1FFFFFFFFFFFFFFF); /* (2^64 - 1) div 8 */
+
+   /*
+   // Update full IV length
+   //
+   // IV length of buffer i is stored in context as 64-bit integer AES_GCM_CONTEXT_LEN(p_context)[i]
+   // Last J0 block is constructed in IV finalization
+   */
+
+   __m512i full_iv_len = maskz_expandloadu_epi32(0x5555, (void *)&loc_iv_len);
+   full_iv_len         = add_epi64(full_iv_len, loadu(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 0)));
+   storeu(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 0), full_iv_len);
+
+   __mmask8 mask_overflow_lo = cmp_epi64_mask(max_iv_len, full_iv_len, _MM_CMPINT_LT);
+
+   full_iv_len = maskz_expandloadu_epi32(0x5555, (void *)((int32u *)&loc_iv_len + 8));
+   full_iv_len = add_epi64(full_iv_len, loadu(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 1)));
+   storeu(BUFFER_REG_NUM(AES_GCM_CONTEXT_LEN(p_context), 1), full_iv_len);
+
+   __mmask8 mask_overflow_hi = cmp_epi64_mask(max_iv_len, full_iv_len, _MM_CMPINT_LT);
+
+   __mmask16 mask_overflow = mask_overflow_hi << 8 | mask_overflow_lo;
+
+   /* Process full blocks of IVs */
+   sm4_gcm_update_ghash_full_blocks_mb16(j0, loc_pa_iv, &loc_iv_len, AES_GCM_CONTEXT_HASHKEY(p_context), mb_mask);
+
+   if (cmp_epi32_mask(loc_iv_len, setzero(), _MM_CMPINT_EQ) != 0xFFFF) {
+      /* Process partial blocks of IVs and finalize IVs */
+      sm4_gcm_update_ghash_partial_blocks_mb16(j0, loc_pa_iv, &loc_iv_len, AES_GCM_CONTEXT_HASHKEY(p_context)[0], mb_mask);
+      aes_gcm_finalize_iv_mb16(pa_iv, mb_mask, p_context);
+
+      AES_GCM_CONTEXT_STATE(p_context) = aes_gcm_update_aad;
+   }
+
+   return mask_overflow & mb_mask;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
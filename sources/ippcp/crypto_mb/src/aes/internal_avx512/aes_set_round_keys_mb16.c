@@ -0,0 +1,85 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_defs.h>
+#include <internal/aes/aes_gcm_mb.h>
+#include <internal/rsa/ifma_rsa_arith.h> /* for zero_mb8 */
+
+#if (_MBX>=_MBX_K1)
+
+/* AES round constants */
+static const int32u AES_RCON[] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36 };
+
+/* SubWord(w) computed with AES-NI */
+__MBX_INLINE int32u aes_sub_word(int32u w)
+{
+   return (int32u)_mm_cvtsi128_si32(_mm_aeskeygenassist_si128(_mm_set_epi32(0, 0, (int)w, 0), 0));
+}
+
+/* RotWord(SubWord(w)) computed with AES-NI */
+__MBX_INLINE int32u aes_sub_rot_word(int32u w)
+{
+   return (int32u)_mm_extract_epi32(_mm_aeskeygenassist_si128(_mm_set_epi32(0, 0, (int)w, 0), 0), 1);
+}
+
+/*
+// This function expands AES keys of 16 buffers (FIPS-197, 5.2 Key Expansion)
+// Round keys of invalid buffers are set to zero
+//
+// Keys layout for each round:
+// key0 key1 key2 key3 key4 ... key15
+*/
+void aes_set_round_keys_mb16(__m128i key_sched[AES_MAX_ROUNDS + 1][AES_LINES],
+                             const int8u *const pa_key[AES_LINES],
+                             int key_len,
+                             __mmask16 mb_mask)
+{
+   const int nk         = key_len / 4;
+   const int num_rounds = nk + 6;
+   const int num_words  = 4 * (num_rounds + 1);
+
+   /* expanded key words, size is rounded up to a multiple of 64 bytes */
+   __ALIGN64 int32u w[4 * (AES_MAX_ROUNDS + 2)];
+
+   for (int buf_no = 0; buf_no < AES_LINES; buf_no++) {
+      if (0 == (0x1 & (mb_mask >> buf_no))) {
+         for (int rnd = 0; rnd <= num_rounds; rnd++)
+            key_sched[rnd][buf_no] = _mm_setzero_si128();
+         continue;
+      }
+
+      const int8u *p_key = pa_key[buf_no];
+      for (int i = 0; i < nk; i++)
+         w[i] = (int32u)p_key[4 * i] | (int32u)p_key[4 * i + 1] << 8 | (int32u)p_key[4 * i + 2] << 16 | (int32u)p_key[4 * i + 3] << 24;
+
+      for (int i = nk; i < num_words; i++) {
+         int32u tmp = w[i - 1];
+         if (0 == i % nk)
+            tmp = aes_sub_rot_word(tmp) ^ AES_RCON[i / nk - 1];
+         else if (nk > 6 && 4 == i % nk)
+            tmp = aes_sub_word(tmp);
+         w[i] = w[i - nk] ^ tmp;
+      }
+
+      for (int rnd = 0; rnd <= num_rounds; rnd++)
+         key_sched[rnd][buf_no] = _mm_loadu_si128((const __m128i *)(w + 4 * rnd));
+   }
+
+   /* clear local copy of sensitive data */
+   zero_mb8((int64u(*)[8])w, sizeof(w) / 64);
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
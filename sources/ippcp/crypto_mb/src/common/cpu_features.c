@@ -293,7 +293,10 @@ static const algo_width_map arr_algo_width[] = {
    { MBX_ALGO_EC_NIST_P521, MBX_WIDTH_MB8  },
    { MBX_ALGO_EC_SM2,       MBX_WIDTH_MB8  },
    { MBX_ALGO_SM3,          MBX_WIDTH_MB16 },
-   { MBX_ALGO_SM4,          MBX_WIDTH_MB16 }
+   { MBX_ALGO_SM4,          MBX_WIDTH_MB16 },
+   { MBX_ALGO_AES,          MBX_WIDTH_MB16 },
+   { MBX_ALGO_RSA_6K,       MBX_WIDTH_MB8  },
+   { MBX_ALGO_RSA_8K,       MBX_WIDTH_MB8  }
 };
 /* clang-config on */
 
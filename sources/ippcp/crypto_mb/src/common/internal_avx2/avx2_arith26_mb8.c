@@ -0,0 +1,645 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/defs.h>
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_arith26_mb8.h>
+
+#if (_MBX==_MBX_L9)
+
+#include <immintrin.h>
+
+/*
+// Each int64u[8] digit row is processed as two 4-lane halves (h = 0, 1).
+// All the kernels below work on a single half: element i of the number
+// starting at "p" is located at p + 8*i.
+*/
+#define ROW(p, i)       ((p) + 8*(i))
+#define LOAD26(p)       _mm256_loadu_si256((const __m256i*)(p))
+#define STORE26(p, v)   _mm256_storeu_si256((__m256i*)(p), (v))
+
+__MBX_INLINE __m256i lane_mask26(int8u mask, int h)
+{
+   int m = (mask >> (4*h)) & 0xF;
+   return _mm256_set_epi64x(-(long long)((m>>3)&1), -(long long)((m>>2)&1),
+                            -(long long)((m>>1)&1), -(long long)(m&1));
+}
+
+__MBX_INLINE int8u to_mask26(__m256i lo, __m256i hi)
+{
+   int mlo = _mm256_movemask_pd(_mm256_castsi256_pd(lo));
+   int mhi = _mm256_movemask_pd(_mm256_castsi256_pd(hi));
+   return (int8u)(mlo | (mhi << 4));
+}
+
+/* r[] = (acc[] + carry) normalized to radix 2^26 */
+__MBX_INLINE void normalize26_x4(int64u* pR, const __m256i* acc, int len)
+{
+   const __m256i mask = _mm256_set1_epi64x(DIGIT_MASK_26);
+   __m256i carry = _mm256_setzero_si256();
+   int j;
+   for(j=0; j<len; j++) {
+      __m256i t = _mm256_add_epi64(acc[j], carry);
+      STORE26(ROW(pR,j), _mm256_and_si256(t, mask));
+      carry = _mm256_srli_epi64(t, DIGIT_SIZE_26);
+   }
+}
+
+/*
+// almost Montgomery multiplication, 4 lanes
+// r = a*b/2^(26*len) mod m, the result is in [0, 2m)
+*/
+static void amm26_x4(int64u* pR, const int64u* pA, const int64u* pB,
+                     const int64u* pM, const int64u* pK0, int len)
+{
+   __m256i acc[MAX_LEN26];
+   const __m256i mask = _mm256_set1_epi64x(DIGIT_MASK_26);
+   const __m256i k0 = LOAD26(pK0);
+   int i, j;
+
+   for(j=0; j<len; j++)
+      acc[j] = _mm256_setzero_si256();
+
+   for(i=0; i<len; i++) {
+      __m256i ai = LOAD26(ROW(pA,i));
+
+      /* q = ((acc[0] + a[i]*b[0]) * k0) mod 2^26 */
+      __m256i t = _mm256_add_epi64(acc[0], _mm256_mul_epu32(ai, LOAD26(pB)));
+      __m256i q = _mm256_and_si256(_mm256_mul_epu32(t, k0), mask);
+      t = _mm256_add_epi64(t, _mm256_mul_epu32(q, LOAD26(pM)));
+      t = _mm256_srli_epi64(t, DIGIT_SIZE_26);
+
+      /* acc = (acc + a[i]*b + q*m) / 2^26 */
+      for(j=1; j<len; j++) {
+         __m256i s = _mm256_add_epi64(acc[j], _mm256_mul_epu32(ai, LOAD26(ROW(pB,j))));
+         acc[j-1] = _mm256_add_epi64(s, _mm256_mul_epu32(q, LOAD26(ROW(pM,j))));
+      }
+      acc[len-1] = _mm256_setzero_si256();
+      acc[0] = _mm256_add_epi64(acc[0], t);
+   }
+
+   normalize26_x4(pR, acc, len);
+}
+
+/*
+// almost Montgomery reduction of the double length value, 4 lanes
+// r = a/2^(26*len) mod m
+*/
+static void amred26_x4(int64u* pR, const int64u* pA,
+                       const int64u* pM, const int64u* pK0, int len)
+{
+   __m256i acc[MAX_LEN26];
+   const __m256i mask = _mm256_set1_epi64x(DIGIT_MASK_26);
+   const __m256i k0 = LOAD26(pK0);
+   int i, j;
+
+   for(j=0; j<len; j++)
+      acc[j] = LOAD26(ROW(pA,j));
+
+   for(i=0; i<len; i++) {
+      __m256i t = acc[0];
+      __m256i q = _mm256_and_si256(_mm256_mul_epu32(t, k0), mask);
+      t = _mm256_add_epi64(t, _mm256_mul_epu32(q, LOAD26(pM)));
+      t = _mm256_srli_epi64(t, DIGIT_SIZE_26);
+
+      for(j=1; j<len; j++)
+         acc[j-1] = _mm256_add_epi64(acc[j], _mm256_mul_epu32(q, LOAD26(ROW(pM,j))));
+      acc[len-1] = LOAD26(ROW(pA,len+i));
+      acc[0] = _mm256_add_epi64(acc[0], t);
+   }
+
+   normalize26_x4(pR, acc, len);
+}
+
+/*
+// r = a - b (if a>=b) or a (if a<b), 4 lanes
+// returns lanes mask of a<b
+//
+// AVX2 has no 64-bit arithmetic shift, so the borrow is
+// extracted from the biased difference: t = a-b-borrow+2^26
+*/
+static __m256i sub_if_ge26_x4(int64u* pR, const int64u* pA, const int64u* pB, int len)
+{
+   __m256i d[MAX_LEN26];
+   const __m256i mask = _mm256_set1_epi64x(DIGIT_MASK_26);
+   const __m256i bias = _mm256_set1_epi64x((long long)1<<DIGIT_SIZE_26);
+   const __m256i one  = _mm256_set1_epi64x(1);
+   __m256i borrow = _mm256_setzero_si256();
+   int j;
+
+   for(j=0; j<len; j++) {
+      __m256i t = _mm256_sub_epi64(LOAD26(ROW(pA,j)), LOAD26(ROW(pB,j)));
+      t = _mm256_add_epi64(t, _mm256_add_epi64(borrow, bias));
+      d[j] = _mm256_and_si256(t, mask);
+      borrow = _mm256_sub_epi64(_mm256_srli_epi64(t, DIGIT_SIZE_26), one);
+   }
+   /* borrow = 0xFF..FF if a<b */
+   for(j=0; j<len; j++)
+      STORE26(ROW(pR,j), _mm256_blendv_epi8(d[j], LOAD26(ROW(pA,j)), borrow));
+
+   return borrow;
+}
+
+/* lanes mask of a<b, 4 lanes */
+static __m256i cmp_lt26_x4(const int64u* pA, const int64u* pB, int len)
+{
+   const __m256i bias = _mm256_set1_epi64x((long long)1<<DIGIT_SIZE_26);
+   const __m256i one  = _mm256_set1_epi64x(1);
+   __m256i borrow = _mm256_setzero_si256();
+   int j;
+
+   for(j=0; j<len; j++) {
+      __m256i t = _mm256_sub_epi64(LOAD26(ROW(pA,j)), LOAD26(ROW(pB,j)));
+      t = _mm256_add_epi64(t, _mm256_add_epi64(borrow, bias));
+      borrow = _mm256_sub_epi64(_mm256_srli_epi64(t, DIGIT_SIZE_26), one);
+   }
+   return borrow;
+}
+
+/* r = (a+b) mod m, 4 lanes */
+static void add26_x4(int64u* pR, const int64u* pA, const int64u* pB, const int64u* pM, int len)
+{
+   __m256i acc[MAX_LEN26];
+   int j;
+   for(j=0; j<len; j++)
+      acc[j] = _mm256_add_epi64(LOAD26(ROW(pA,j)), LOAD26(ROW(pB,j)));
+   normalize26_x4(pR, acc, len);
+   sub_if_ge26_x4(pR, pR, pM, len);
+}
+
+/* r = (a-b) mod m, 4 lanes */
+static void sub26_x4(int64u* pR, const int64u* pA, const int64u* pB, const int64u* pM, int len)
+{
+   __m256i d[MAX_LEN26];
+   const __m256i mask = _mm256_set1_epi64x(DIGIT_MASK_26);
+   const __m256i bias = _mm256_set1_epi64x((long long)1<<DIGIT_SIZE_26);
+   const __m256i one  = _mm256_set1_epi64x(1);
+   __m256i borrow = _mm256_setzero_si256();
+   __m256i carry;
+   int j;
+
+   for(j=0; j<len; j++) {
+      __m256i t = _mm256_sub_epi64(LOAD26(ROW(pA,j)), LOAD26(ROW(pB,j)));
+      t = _mm256_add_epi64(t, _mm256_add_epi64(borrow, bias));
+      d[j] = _mm256_and_si256(t, mask);
+      borrow = _mm256_sub_epi64(_mm256_srli_epi64(t, DIGIT_SIZE_26), one);
+   }
+   /* add modulus back if a<b */
+   carry = _mm256_setzero_si256();
+   for(j=0; j<len; j++) {
+      __m256i t = _mm256_add_epi64(d[j], _mm256_and_si256(LOAD26(ROW(pM,j)), borrow));
+      t = _mm256_add_epi64(t, carry);
+      STORE26(ROW(pR,j), _mm256_and_si256(t, mask));
+      carry = _mm256_srli_epi64(t, DIGIT_SIZE_26);
+   }
+}
+
+/* r[2*len] += a[len]*b[len], 4 lanes */
+static void addmul26_x4(int64u* pR, const int64u* pA, const int64u* pB, int len)
+{
+   __m256i acc[2*MAX_LEN26];
+   int i, j;
+   for(j=0; j<2*len; j++)
+      acc[j] = LOAD26(ROW(pR,j));
+   for(i=0; i<len; i++) {
+      __m256i ai = LOAD26(ROW(pA,i));
+      for(j=0; j<len; j++)
+         acc[i+j] = _mm256_add_epi64(acc[i+j], _mm256_mul_epu32(ai, LOAD26(ROW(pB,j))));
+   }
+   normalize26_x4(pR, acc, 2*len);
+}
+
+/*
+// 8-lane wrappers
+*/
+void avx2_zero26_mb8(int64u r[][8], int len)
+{
+   int j;
+   for(j=0; j<len; j++) {
+      STORE26(r[j],   _mm256_setzero_si256());
+      STORE26(r[j]+4, _mm256_setzero_si256());
+   }
+}
+
+void avx2_copy26_mb8(int64u r[][8], const int64u a[][8], int len)
+{
+   int j;
+   for(j=0; j<len; j++) {
+      STORE26(r[j],   LOAD26(a[j]));
+      STORE26(r[j]+4, LOAD26(a[j]+4));
+   }
+}
+
+void avx2_set26_mb8(int64u r[][8], int64u val, int len)
+{
+   avx2_zero26_mb8(r, len);
+   STORE26(r[0],   _mm256_set1_epi64x((long long)val));
+   STORE26(r[0]+4, _mm256_set1_epi64x((long long)val));
+}
+
+/* r = mask? a : r */
+void avx2_mask_mov26_mb8(int64u r[][8], const int64u a[][8], int8u mask, int len)
+{
+   int h, j;
+   for(h=0; h<2; h++) {
+      __m256i k = lane_mask26(mask, h);
+      for(j=0; j<len; j++)
+         STORE26(r[j]+4*h, _mm256_blendv_epi8(LOAD26(r[j]+4*h), LOAD26(a[j]+4*h), k));
+   }
+}
+
+/* conditional swap, swap[] is all-ones or zero per lane */
+void avx2_cswap26_mb8(int64u a[][8], int64u b[][8], const int64u swap[8], int len)
+{
+   int h, j;
+   for(h=0; h<2; h++) {
+      __m256i k = LOAD26(swap+4*h);
+      for(j=0; j<len; j++) {
+         __m256i x = LOAD26(a[j]+4*h);
+         __m256i y = LOAD26(b[j]+4*h);
+         __m256i t = _mm256_and_si256(_mm256_xor_si256(x, y), k);
+         STORE26(a[j]+4*h, _mm256_xor_si256(x, t));
+         STORE26(b[j]+4*h, _mm256_xor_si256(y, t));
+      }
+   }
+}
+
+/*
+// conversions
+*/
+/* little-endian (rev==0) or big-endian (rev!=0) byte string to radix 2^26 */
+static void bytes_to_26(int64u r[][8], int n, const int8u* p, int byteLen, int rev, int len)
+{
+   int64u acc = 0;
+   int accBits = 0;
+   int i = 0, k;
+   if(NULL != p) {
+      for(k=0; k<byteLen; k++) {
+         int64u byte = rev? p[byteLen-1-k] : p[k];
+         acc |= byte << accBits;
+         accBits += 8;
+         if(accBits >= DIGIT_SIZE_26) {
+            if(i<len) r[i++][n] = acc & DIGIT_MASK_26;
+            acc >>= DIGIT_SIZE_26;
+            accBits -= DIGIT_SIZE_26;
+         }
+      }
+      if(accBits && i<len)
+         r[i++][n] = acc;
+   }
+   for(; i<len; i++)
+      r[i][n] = 0;
+}
+
+/* radix 2^26 to little-endian (rev==0) or big-endian (rev!=0) byte string */
+static void bytes_from_26(int8u* p, int byteLen, int rev, const int64u a[][8], int n)
+{
+   int64u acc = 0;
+   int accBits = 0;
+   int i = 0, k;
+   for(k=0; k<byteLen; k++) {
+      if(accBits < 8) {
+         acc |= a[i++][n] << accBits;
+         accBits += DIGIT_SIZE_26;
+      }
+      if(rev) p[byteLen-1-k] = (int8u)acc;
+      else    p[k] = (int8u)acc;
+      acc >>= 8;
+      accBits -= 8;
+   }
+}
+
+void avx2_BNU_to_mb8_26(int64u r[][8], const int64u* const pa[8], int bitLen, int len)
+{
+   int n;
+   for(n=0; n<8; n++)
+      bytes_to_26(r, n, (const int8u*)pa[n], NUMBER_OF_DIGITS(bitLen, 8), 0, len);
+}
+
+void avx2_HexStr8_to_mb8_26(int64u r[][8], const int8u* const pa[8], int bitLen, int len)
+{
+   int n;
+   for(n=0; n<8; n++)
+      bytes_to_26(r, n, pa[n], NUMBER_OF_DIGITS(bitLen, 8), 1, len);
+}
+
+void avx2_mb8_26_to_BNU(int64u* const pa[8], const int64u a[][8], int bitLen)
+{
+   int n;
+   for(n=0; n<8; n++) {
+      if(NULL != pa[n])
+         bytes_from_26((int8u*)pa[n], NUMBER_OF_DIGITS(bitLen, 64)*(int)sizeof(int64u), 0, a, n);
+   }
+}
+
+void avx2_mb8_26_to_HexStr8(int8u* const pa[8], const int64u a[][8], int bitLen)
+{
+   int n;
+   for(n=0; n<8; n++) {
+      if(NULL != pa[n])
+         bytes_from_26(pa[n], NUMBER_OF_DIGITS(bitLen, 8), 1, a, n);
+   }
+}
+
+void avx2_BNU_transpose_copy(int64u r[][8], const int64u* const pa[8], int bitLen)
+{
+   int len64 = NUMBER_OF_DIGITS(bitLen, 64);
+   int n, i;
+   for(n=0; n<8; n++) {
+      for(i=0; i<len64; i++)
+         r[i][n] = (NULL != pa[n])? pa[n][i] : 0;
+   }
+}
+
+/* broadcast constant BNU c[] to all lanes */
+void avx2_const_to_mb8_26(int64u r[][8], const int64u* c, int bitLen, int len)
+{
+   int n, i;
+   bytes_to_26(r, 0, (const int8u*)c, NUMBER_OF_DIGITS(bitLen, 8), 0, len);
+   for(i=0; i<len; i++)
+      for(n=1; n<8; n++)
+         r[i][n] = r[i][0];
+}
+
+/*
+// comparisons
+*/
+int8u avx2_is_zero26_mb8(const int64u a[][8], int len)
+{
+   __m256i lo = _mm256_setzero_si256();
+   __m256i hi = _mm256_setzero_si256();
+   int j;
+   for(j=0; j<len; j++) {
+      lo = _mm256_or_si256(lo, LOAD26(a[j]));
+      hi = _mm256_or_si256(hi, LOAD26(a[j]+4));
+   }
+   lo = _mm256_cmpeq_epi64(lo, _mm256_setzero_si256());
+   hi = _mm256_cmpeq_epi64(hi, _mm256_setzero_si256());
+   return to_mask26(lo, hi);
+}
+
+int8u avx2_cmp_eq26_mb8(const int64u a[][8], const int64u b[][8], int len)
+{
+   __m256i lo = _mm256_setzero_si256();
+   __m256i hi = _mm256_setzero_si256();
+   int j;
+   for(j=0; j<len; j++) {
+      lo = _mm256_or_si256(lo, _mm256_xor_si256(LOAD26(a[j]),   LOAD26(b[j])));
+      hi = _mm256_or_si256(hi, _mm256_xor_si256(LOAD26(a[j]+4), LOAD26(b[j]+4)));
+   }
+   lo = _mm256_cmpeq_epi64(lo, _mm256_setzero_si256());
+   hi = _mm256_cmpeq_epi64(hi, _mm256_setzero_si256());
+   return to_mask26(lo, hi);
+}
+
+int8u avx2_cmp_lt26_mb8(const int64u a[][8], const int64u b[][8], int len)
+{
+   __m256i lo = cmp_lt26_x4(a[0],   b[0],   len);
+   __m256i hi = cmp_lt26_x4(a[0]+4, b[0]+4, len);
+   return to_mask26(lo, hi);
+}
+
+/*
+// Montgomery arithmetic
+*/
+
+/* k0 = -1/m mod 2^26 */
+void avx2_montFactor26_mb8(int64u k0[8], const int64u m[][8])
+{
+   int n, k;
+   for(n=0; n<8; n++) {
+      int32u m0 = (int32u)m[0][n];
+      int32u x = m0;                   /* 3 correct bits for odd m0 */
+      for(k=0; k<4; k++)
+         x *= 2 - m0*x;                 /* Newton iteration doubles correct bits */
+      k0[n] = (int64u)(0-x) & DIGIT_MASK_26;
+   }
+}
+
+void avx2_amm26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8],
+                    const int64u m[][8], const int64u k0[8], int len)
+{
+   amm26_x4(r[0],   a[0],   b[0],   m[0],   k0,   len);
+   amm26_x4(r[0]+4, a[0]+4, b[0]+4, m[0]+4, k0+4, len);
+}
+
+void avx2_amred26_mb8(int64u r[][8], const int64u a[][8],
+                      const int64u m[][8], const int64u k0[8], int len)
+{
+   amred26_x4(r[0],   a[0],   m[0],   k0,   len);
+   amred26_x4(r[0]+4, a[0]+4, m[0]+4, k0+4, len);
+}
+
+void avx2_reduce26_mb8(int64u r[][8], const int64u a[][8], const int64u m[][8], int len)
+{
+   sub_if_ge26_x4(r[0],   a[0],   m[0],   len);
+   sub_if_ge26_x4(r[0]+4, a[0]+4, m[0]+4, len);
+}
+
+void avx2_mont_mul26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8],
+                         const int64u m[][8], const int64u k0[8], int len)
+{
+   avx2_amm26_mb8(r, a, b, m, k0, len);
+   avx2_reduce26_mb8(r, (const int64u (*)[8])r, m, len);
+}
+
+void avx2_to_mont26_mb8(int64u r[][8], const int64u a[][8], const int64u rr[][8],
+                        const int64u m[][8], const int64u k0[8], int len)
+{
+   avx2_mont_mul26_mb8(r, a, rr, m, k0, len);
+}
+
+void avx2_from_mont26_mb8(int64u r[][8], const int64u a[][8],
+                          const int64u m[][8], const int64u k0[8], int len)
+{
+   __ALIGN64 int64u one[MAX_LEN26][8];
+   avx2_set26_mb8(one, 1, len);
+   avx2_mont_mul26_mb8(r, a, (const int64u (*)[8])one, m, k0, len);
+}
+
+void avx2_add26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8], const int64u m[][8], int len)
+{
+   add26_x4(r[0],   a[0],   b[0],   m[0],   len);
+   add26_x4(r[0]+4, a[0]+4, b[0]+4, m[0]+4, len);
+}
+
+void avx2_sub26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8], const int64u m[][8], int len)
+{
+   sub26_x4(r[0],   a[0],   b[0],   m[0],   len);
+   sub26_x4(r[0]+4, a[0]+4, b[0]+4, m[0]+4, len);
+}
+
+void avx2_addmul26_mb8(int64u r[][8], const int64u a[][8], const int64u b[][8], int len)
+{
+   addmul26_x4(r[0],   a[0],   b[0],   len);
+   addmul26_x4(r[0]+4, a[0]+4, b[0]+4, len);
+}
+
+/* r = a^exp mod m (Montgomery domain), exp is public and the same for all lanes */
+void avx2_mont_pow26_mb8(int64u r[][8], const int64u a[][8], const int64u* exp, int expBitLen,
+                         const int64u m[][8], const int64u k0[8], int len)
+{
+   __ALIGN64 int64u x[MAX_LEN26][8];
+   int bit = expBitLen-1;
+
+   avx2_copy26_mb8(x, a, len);
+
+   /* skip leading zeros */
+   while(bit>0 && !((exp[bit/64] >> (bit%64)) & 1))
+      bit--;
+
+   avx2_copy26_mb8(r, (const int64u (*)[8])x, len);
+   for(bit--; bit>=0; bit--) {
+      avx2_amm26_mb8(r, (const int64u (*)[8])r, (const int64u (*)[8])r, m, k0, len);
+      if((exp[bit/64] >> (bit%64)) & 1)
+         avx2_amm26_mb8(r, (const int64u (*)[8])r, (const int64u (*)[8])x, m, k0, len);
+   }
+   avx2_reduce26_mb8(r, (const int64u (*)[8])r, m, len);
+}
+
+/*
+// rr = 2^(2*26*len) mod m
+//
+// 2^(26*len+1) mod m is computed by modular doublings starting from
+// the largest power of 2 that does not exceed any modulus of the batch,
+// and then is raised to the power 26*len in the Montgomery domain
+*/
+void avx2_montRR26_mb8(int64u rr[][8], const int64u m[][8], const int64u k0[8], int len)
+{
+   __ALIGN64 int64u x[MAX_LEN26][8];
+   int minBits = len*DIGIT_SIZE_26;
+   int n, i;
+
+   /* the shortest modulus of the batch */
+   for(n=0; n<8; n++) {
+      for(i=len-1; i>=0 && 0==m[i][n]; i--) ;
+      if(i>=0) {
+         int bits = i*DIGIT_SIZE_26;
+         int64u d = m[i][n];
+         while(d) { bits++; d >>= 1; }
+         if(bits<minBits) minBits = bits;
+      }
+   }
+
+   /* x = 2^(minBits-1) */
+   avx2_zero26_mb8(x, len);
+   minBits -= 1;
+   for(n=0; n<8; n++)
+      x[minBits/DIGIT_SIZE_26][n] = (int64u)1 << (minBits%DIGIT_SIZE_26);
+   avx2_reduce26_mb8(x, (const int64u (*)[8])x, m, len);
+
+   /* x = 2^(26*len+1) mod m, that is 2 in the Montgomery domain */
+   for(i=minBits; i<len*DIGIT_SIZE_26+1; i++)
+      avx2_add26_mb8(x, (const int64u (*)[8])x, (const int64u (*)[8])x, m, len);
+
+   /* rr = 2^(26*len) in the Montgomery domain */
+   {
+      int64u e = (int64u)(len*DIGIT_SIZE_26);
+      avx2_mont_pow26_mb8(rr, (const int64u (*)[8])x, &e, 64, m, k0, len);
+   }
+}
+
+/*
+// fixed window exponentiation
+*/
+
+/* extract exponent window at bitPos, 4 lanes */
+__MBX_INLINE __m256i get_window26_x4(const int64u* pExp, int expLen, int bitPos)
+{
+   int word = bitPos/64;
+   int shift = bitPos%64;
+   __m256i w = _mm256_srl_epi64(LOAD26(ROW(pExp,word)), _mm_cvtsi32_si128(shift));
+   if(shift > (64-EXP_WIN_SIZE_26) && (word+1)<expLen)
+      w = _mm256_or_si256(w, _mm256_sll_epi64(LOAD26(ROW(pExp,word+1)), _mm_cvtsi32_si128(64-shift)));
+   return _mm256_and_si256(w, _mm256_set1_epi64x((1<<EXP_WIN_SIZE_26)-1));
+}
+
+/* constant time table lookup, 4 lanes */
+static void select26_x4(int64u* pR, const int64u* pTbl, __m256i idx, int len)
+{
+   __m256i acc[MAX_LEN26];
+   int k, j;
+   for(j=0; j<len; j++)
+      acc[j] = _mm256_setzero_si256();
+   for(k=0; k<(1<<EXP_WIN_SIZE_26); k++) {
+      __m256i eq = _mm256_cmpeq_epi64(idx, _mm256_set1_epi64x(k));
+      const int64u* pT = pTbl + 8*len*k;
+      for(j=0; j<len; j++)
+         acc[j] = _mm256_or_si256(acc[j], _mm256_and_si256(eq, LOAD26(ROW(pT,j))));
+   }
+   for(j=0; j<len; j++)
+      STORE26(ROW(pR,j), acc[j]);
+}
+
+static void select26_mb8(int64u r[][8], const int64u tbl[][8], const int64u exp[][8], int expLen, int bitPos, int len)
+{
+   select26_x4(r[0],   tbl[0],   get_window26_x4(exp[0],   expLen, bitPos), len);
+   select26_x4(r[0]+4, tbl[0]+4, get_window26_x4(exp[0]+4, expLen, bitPos), len);
+}
+
+void avx2_modexp26_mb8(int64u r[][8], const int64u base[][8],
+                       const int64u exp[][8], int expBitLen,
+                       const int64u m[][8], const int64u rr[][8], const int64u k0[8],
+                       int len, int64u buffer[][8])
+{
+   int64u (*tbl)[8] = buffer;
+   int64u (*x)[8] = buffer + (1<<EXP_WIN_SIZE_26)*len;
+   int expLen = NUMBER_OF_DIGITS(expBitLen, 64);
+   int nWins = NUMBER_OF_DIGITS(expBitLen, EXP_WIN_SIZE_26);
+   int k, w, s;
+
+   /* tbl[k] = base^k in the Montgomery domain */
+   avx2_set26_mb8(x, 1, len);
+   avx2_mont_mul26_mb8(tbl, rr, (const int64u (*)[8])x, m, k0, len);
+   avx2_to_mont26_mb8(tbl+len, base, rr, m, k0, len);
+   for(k=2; k<(1<<EXP_WIN_SIZE_26); k++)
+      avx2_mont_mul26_mb8(tbl+k*len, (const int64u (*)[8])(tbl+(k-1)*len), (const int64u (*)[8])(tbl+len), m, k0, len);
+
+   /* the most significant window */
+   w = nWins-1;
+   select26_mb8(r, (const int64u (*)[8])tbl, exp, expLen, w*EXP_WIN_SIZE_26, len);
+
+   for(w--; w>=0; w--) {
+      for(s=0; s<EXP_WIN_SIZE_26; s++)
+         avx2_amm26_mb8(r, (const int64u (*)[8])r, (const int64u (*)[8])r, m, k0, len);
+      select26_mb8(x, (const int64u (*)[8])tbl, exp, expLen, w*EXP_WIN_SIZE_26, len);
+      avx2_amm26_mb8(r, (const int64u (*)[8])r, (const int64u (*)[8])x, m, k0, len);
+   }
+
+   /* back to the regular domain */
+   avx2_from_mont26_mb8(r, (const int64u (*)[8])r, m, k0, len);
+
+   /* clear table */
+   avx2_zero26_mb8(buffer, MODEXP26_BUFF_ROWS(len));
+}
+
+void avx2_modexp26_65537_mb8(int64u r[][8], const int64u base[][8],
+                             const int64u m[][8], const int64u rr[][8], const int64u k0[8],
+                             int len, int64u buffer[][8])
+{
+   int64u (*x)[8] = buffer;
+   int s;
+
+   avx2_to_mont26_mb8(x, base, rr, m, k0, len);
+   avx2_copy26_mb8(r, (const int64u (*)[8])x, len);
+   for(s=0; s<16; s++)
+      avx2_amm26_mb8(r, (const int64u (*)[8])r, (const int64u (*)[8])r, m, k0, len);
+   avx2_amm26_mb8(r, (const int64u (*)[8])r, (const int64u (*)[8])x, m, k0, len);
+
+   avx2_from_mont26_mb8(r, (const int64u (*)[8])r, m, k0, len);
+}
+
+#endif /* #if (_MBX==_MBX_L9) */
@@ -0,0 +1,373 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+// The job queue is CPU independent: it is compiled once and calls
+// the dispatched mbx_*_mb8 functions.
+*/
+
+#if !defined( _WIN32 ) && !defined( _WIN64 ) && !defined(_POSIX_C_SOURCE)
+   #define _POSIX_C_SOURCE 200809L /* clock_gettime() */
+#endif
+
+#include <stdlib.h>
+
+#include <internal/common/ifma_defs.h>
+#include <crypto_mb/job_queue.h>
+#include <crypto_mb/rsa.h>
+#include <crypto_mb/ec_nistp256.h>
+#include <crypto_mb/x25519.h>
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+   #include <windows.h>
+
+   typedef CRITICAL_SECTION mbx_mutex;
+   #define MUTEX_INIT(m)      InitializeCriticalSection((m))
+   #define MUTEX_DESTROY(m)   DeleteCriticalSection((m))
+   #define MUTEX_LOCK(m)      EnterCriticalSection((m))
+   #define MUTEX_UNLOCK(m)    LeaveCriticalSection((m))
+
+   #define JOB_SET_DONE(job)  InterlockedExchange((volatile LONG*)&(job)->reserved.done, 1)
+   #define JOB_IS_DONE(job)   InterlockedCompareExchange((volatile LONG*)&(job)->reserved.done, 0, 0)
+#else
+   #include <pthread.h>
+   #include <time.h>
+
+   typedef pthread_mutex_t mbx_mutex;
+   #define MUTEX_INIT(m)      pthread_mutex_init((m), NULL)
+   #define MUTEX_DESTROY(m)   pthread_mutex_destroy((m))
+   #define MUTEX_LOCK(m)      pthread_mutex_lock((m))
+   #define MUTEX_UNLOCK(m)    pthread_mutex_unlock((m))
+
+   #define JOB_SET_DONE(job)  __atomic_store_n(&(job)->reserved.done, 1, __ATOMIC_RELEASE)
+   #define JOB_IS_DONE(job)   __atomic_load_n(&(job)->reserved.done, __ATOMIC_ACQUIRE)
+#endif
+
+#define MBX_JOB_LANES   (8)
+
+/*
+// Jobs are collected into bins, each bin corresponds to a single mb8 call:
+// RSA jobs are binned by the operation and the modulus size
+*/
+enum {
+   RSA_PRV2_SIZES       = 4, /* 1k..4k */
+   RSA_PRV5_SIZES       = 6, /* 1k..4k, 6k, 8k */
+   BIN_RSA_PRIVATE      = 0,
+   BIN_RSA_PRIVATE_CRT  = BIN_RSA_PRIVATE + RSA_PRV2_SIZES,
+   BIN_NISTP256_ECDSA   = BIN_RSA_PRIVATE_CRT + RSA_PRV5_SIZES,
+   BIN_NISTP256_ECDH,
+   BIN_X25519,
+   BIN_NUM
+};
+
+typedef struct {
+   mbx_job* jobs[MBX_JOB_LANES];
+   int      count;
+} job_bin;
+
+struct _mbx_job_queue {
+   mbx_mutex lock;
+   int64u    timeoutUsec;
+   job_bin   bins[BIN_NUM];
+};
+
+static int64u time_usec(void)
+{
+#if defined( _WIN32 ) || defined( _WIN64 )
+   LARGE_INTEGER freq, cnt;
+   QueryPerformanceFrequency(&freq);
+   QueryPerformanceCounter(&cnt);
+   return (int64u)(cnt.QuadPart / freq.QuadPart) * 1000000
+        + (int64u)(cnt.QuadPart % freq.QuadPart) * 1000000 / (int64u)freq.QuadPart;
+#else
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (int64u)ts.tv_sec * 1000000 + (int64u)ts.tv_nsec / 1000;
+#endif
+}
+
+static int rsa_bin_offset(int rsaBitsize)
+{
+   switch(rsaBitsize) {
+   case 1024: return 0;
+   case 2048: return 1;
+   case 3072: return 2;
+   case 4096: return 3;
+   case 6144: return 4;
+   case 8192: return 5;
+   default:   return -1;
+   }
+}
+
+/* bin of the job or -1 for unsupported one */
+static int job_bin_index(const mbx_job* pJob)
+{
+   int offset;
+   switch(pJob->type) {
+   case MBX_JOB_RSA_PRIVATE:
+      offset = rsa_bin_offset(pJob->args.rsa_private.rsaBitsize);
+      return (offset<0 || offset>=RSA_PRV2_SIZES)? -1 : BIN_RSA_PRIVATE + offset;
+   case MBX_JOB_RSA_PRIVATE_CRT:
+      offset = rsa_bin_offset(pJob->args.rsa_private_crt.rsaBitsize);
+      return (offset<0)? -1 : BIN_RSA_PRIVATE_CRT + offset;
+   case MBX_JOB_NISTP256_ECDSA_SIGN:
+      return BIN_NISTP256_ECDSA;
+   case MBX_JOB_NISTP256_ECDH:
+      return BIN_NISTP256_ECDH;
+   case MBX_JOB_X25519:
+      return BIN_X25519;
+   default:
+      return -1;
+   }
+}
+
+/* moves jobs of the bin into batch[], returns number of jobs; called under the lock */
+static int take_batch(job_bin* pBin, mbx_job* batch[MBX_JOB_LANES])
+{
+   int n, count = pBin->count;
+   for(n=0; n<count; n++) {
+      batch[n] = pBin->jobs[n];
+      pBin->jobs[n] = NULL;
+   }
+   pBin->count = 0;
+   return count;
+}
+
+/*
+// computes the batch by single mb8 call, unused lanes are passed as NULL
+// and then updates status and completes the jobs
+*/
+static void run_batch(mbx_job* batch[MBX_JOB_LANES], int count)
+{
+   mbx_status status;
+   int n;
+
+   switch(batch[0]->type) {
+   case MBX_JOB_RSA_PRIVATE: {
+      const int8u* from[MBX_JOB_LANES] = {0};
+            int8u* to[MBX_JOB_LANES] = {0};
+      const int64u* d[MBX_JOB_LANES] = {0};
+      const int64u* n_[MBX_JOB_LANES] = {0};
+      for(n=0; n<count; n++) {
+         from[n] = batch[n]->args.rsa_private.from;
+         to[n]   = batch[n]->args.rsa_private.to;
+         d[n]    = batch[n]->args.rsa_private.d;
+         n_[n]   = batch[n]->args.rsa_private.n;
+      }
+      status = mbx_rsa_private_mb8(from, to, d, n_, batch[0]->args.rsa_private.rsaBitsize, NULL, NULL);
+      } break;
+
+   case MBX_JOB_RSA_PRIVATE_CRT: {
+      const int8u* from[MBX_JOB_LANES] = {0};
+            int8u* to[MBX_JOB_LANES] = {0};
+      const int64u* p[MBX_JOB_LANES] = {0};
+      const int64u* q[MBX_JOB_LANES] = {0};
+      const int64u* dp[MBX_JOB_LANES] = {0};
+      const int64u* dq[MBX_JOB_LANES] = {0};
+      const int64u* iq[MBX_JOB_LANES] = {0};
+      for(n=0; n<count; n++) {
+         from[n] = batch[n]->args.rsa_private_crt.from;
+         to[n]   = batch[n]->args.rsa_private_crt.to;
+         p[n]    = batch[n]->args.rsa_private_crt.p;
+         q[n]    = batch[n]->args.rsa_private_crt.q;
+         dp[n]   = batch[n]->args.rsa_private_crt.dp;
+         dq[n]   = batch[n]->args.rsa_private_crt.dq;
+         iq[n]   = batch[n]->args.rsa_private_crt.iq;
+      }
+      status = mbx_rsa_private_crt_mb8(from, to, p, q, dp, dq, iq, batch[0]->args.rsa_private_crt.rsaBitsize, NULL, NULL);
+      } break;
+
+   case MBX_JOB_NISTP256_ECDSA_SIGN: {
+            int8u* sign_r[MBX_JOB_LANES] = {0};
+            int8u* sign_s[MBX_JOB_LANES] = {0};
+      const int8u* msg[MBX_JOB_LANES] = {0};
+      const int64u* eph_skey[MBX_JOB_LANES] = {0};
+      const int64u* reg_skey[MBX_JOB_LANES] = {0};
+      for(n=0; n<count; n++) {
+         sign_r[n]   = batch[n]->args.nistp256_ecdsa_sign.sign_r;
+         sign_s[n]   = batch[n]->args.nistp256_ecdsa_sign.sign_s;
+         msg[n]      = batch[n]->args.nistp256_ecdsa_sign.msg;
+         eph_skey[n] = batch[n]->args.nistp256_ecdsa_sign.eph_skey;
+         reg_skey[n] = batch[n]->args.nistp256_ecdsa_sign.reg_skey;
+      }
+      status = mbx_nistp256_ecdsa_sign_mb8(sign_r, sign_s, msg, eph_skey, reg_skey, NULL);
+      } break;
+
+   case MBX_JOB_NISTP256_ECDH: {
+            int8u* shared_key[MBX_JOB_LANES] = {0};
+      const int64u* skey[MBX_JOB_LANES] = {0};
+      const int64u* pubx[MBX_JOB_LANES] = {0};
+      const int64u* puby[MBX_JOB_LANES] = {0};
+      for(n=0; n<count; n++) {
+         shared_key[n] = batch[n]->args.nistp256_ecdh.shared_key;
+         skey[n]       = batch[n]->args.nistp256_ecdh.skey;
+         pubx[n]       = batch[n]->args.nistp256_ecdh.pubx;
+         puby[n]       = batch[n]->args.nistp256_ecdh.puby;
+      }
+      status = mbx_nistp256_ecdh_mb8(shared_key, skey, pubx, puby, NULL, NULL);
+      } break;
+
+   case MBX_JOB_X25519: {
+            int8u* shared_key[MBX_JOB_LANES] = {0};
+      const int8u* private_key[MBX_JOB_LANES] = {0};
+      const int8u* public_key[MBX_JOB_LANES] = {0};
+      for(n=0; n<count; n++) {
+         shared_key[n]  = batch[n]->args.x25519.shared_key;
+         private_key[n] = batch[n]->args.x25519.private_key;
+         public_key[n]  = batch[n]->args.x25519.public_key;
+      }
+      status = mbx_x25519_mb8(shared_key, private_key, public_key);
+      } break;
+
+   default:
+      status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
+      break;
+   }
+
+   /* complete jobs: job may be released by the caller as soon as it is marked done */
+   for(n=0; n<count; n++) {
+      mbx_job* pJob = batch[n];
+      mbx_job_callback callback = pJob->callback;
+      void* pCallbackArg = pJob->pCallbackArg;
+
+      pJob->status = MBX_GET_STS(status, n);
+      JOB_SET_DONE(pJob);
+      if(callback)
+         callback(pJob, pCallbackArg);
+   }
+}
+
+/* computes the bins whose oldest job is expired (or all non-empty bins if force) */
+static int process_bins(mbx_job_queue* pQueue, int force)
+{
+   int completed = 0;
+   int bin;
+
+   for(bin=0; bin<BIN_NUM; bin++) {
+      mbx_job* batch[MBX_JOB_LANES];
+      int count = 0;
+
+      MUTEX_LOCK(&pQueue->lock);
+      {
+         job_bin* pBin = &pQueue->bins[bin];
+         if(pBin->count) {
+            int expired = force || (time_usec() - pBin->jobs[0]->reserved.submitTime >= pQueue->timeoutUsec);
+            if(expired)
+               count = take_batch(pBin, batch);
+         }
+      }
+      MUTEX_UNLOCK(&pQueue->lock);
+
+      if(count) {
+         run_batch(batch, count);
+         completed += count;
+      }
+   }
+   return completed;
+}
+
+DLL_PUBLIC
+mbx_job_queue* mbx_job_queue_create(int64u timeoutUsec)
+{
+#if !defined(NO_USE_MALLOC)
+   mbx_job_queue* pQueue = (mbx_job_queue*)calloc(1, sizeof(mbx_job_queue));
+   if(NULL==pQueue)
+      return NULL;
+
+   MUTEX_INIT(&pQueue->lock);
+   pQueue->timeoutUsec = timeoutUsec;
+   return pQueue;
+#else
+   MBX_UNREFERENCED_PARAMETER(timeoutUsec);
+   return NULL;
+#endif
+}
+
+DLL_PUBLIC
+void mbx_job_queue_destroy(mbx_job_queue* pQueue)
+{
+   if(NULL==pQueue)
+      return;
+
+   process_bins(pQueue, 1);
+   MUTEX_DESTROY(&pQueue->lock);
+#if !defined(NO_USE_MALLOC)
+   free(pQueue);
+#endif
+}
+
+DLL_PUBLIC
+mbx_status mbx_job_queue_submit(mbx_job_queue* pQueue, mbx_job* pJob)
+{
+   mbx_job* batch[MBX_JOB_LANES];
+   int count = 0;
+   int bin;
+
+   /* test input pointers */
+   if(NULL==pQueue || NULL==pJob)
+      return MBX_STATUS_NULL_PARAM_ERR;
+
+   /* test operation */
+   bin = job_bin_index(pJob);
+   if(bin<0)
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+   pJob->status = MBX_STATUS_OK;
+   pJob->reserved.done = 0;
+   pJob->reserved.submitTime = time_usec();
+
+   MUTEX_LOCK(&pQueue->lock);
+   {
+      job_bin* pBin = &pQueue->bins[bin];
+      pBin->jobs[pBin->count++] = pJob;
+      /* the batch is full */
+      if(MBX_JOB_LANES==pBin->count)
+         count = take_batch(pBin, batch);
+   }
+   MUTEX_UNLOCK(&pQueue->lock);
+
+   if(count)
+      run_batch(batch, count);
+
+   /* complete expired batches of the other operations */
+   process_bins(pQueue, 0);
+
+   return MBX_STATUS_OK;
+}
+
+DLL_PUBLIC
+int mbx_job_queue_poll(mbx_job_queue* pQueue)
+{
+   if(NULL==pQueue)
+      return 0;
+   return process_bins(pQueue, 0);
+}
+
+DLL_PUBLIC
+int mbx_job_queue_flush(mbx_job_queue* pQueue)
+{
+   if(NULL==pQueue)
+      return 0;
+   return process_bins(pQueue, 1);
+}
+
+DLL_PUBLIC
+int mbx_job_is_done(const mbx_job* pJob)
+{
+   if(NULL==pJob)
+      return 0;
+   return JOB_IS_DONE(pJob) != 0;
+}
@@ -131,6 +131,8 @@ mbx_status OWNAPI(mbx_nistp256_ecdh_mb8)(int8u* pa_shared_key[8],
 
 #if (_MBX>=_MBX_K1)
    status |= internal_avx512_nistp256_ecdh_mb8(pa_shared_key, pa_skey, pa_pubx, pa_puby, pa_pubz, pBuffer, use_jproj_coords);
+#elif (_MBX==_MBX_L9)
+   status |= internal_avx2_nistp256_ecdh_mb8(pa_shared_key, pa_skey, pa_pubx, pa_puby, pa_pubz, pBuffer, use_jproj_coords);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -76,6 +76,8 @@ mbx_status OWNAPI(mbx_nistp256_ecdsa_sign_setup_mb8)(int64u* pa_inv_eph_skey[8],
 
 #if (_MBX>=_MBX_K1)
    status |= internal_avx512_nistp256_ecdsa_sign_setup_mb8(pa_inv_eph_skey, pa_sign_rp, pa_eph_skey, pBuffer);
+#elif (_MBX==_MBX_L9)
+   status |= internal_avx2_nistp256_ecdsa_sign_setup_mb8(pa_inv_eph_skey, pa_sign_rp, pa_eph_skey, pBuffer);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -132,6 +134,8 @@ mbx_status OWNAPI(mbx_nistp256_ecdsa_sign_complete_mb8)(int8u* pa_sign_r[8],
 
 #if (_MBX>=_MBX_K1)
    status |= internal_avx512_nistp256_ecdsa_sign_complete_mb8(pa_sign_r, pa_sign_s,pa_msg, pa_sign_rp, pa_inv_eph_skey, pa_reg_skey, pBuffer);
+#elif (_MBX==_MBX_L9)
+   status |= internal_avx2_nistp256_ecdsa_sign_complete_mb8(pa_sign_r, pa_sign_s,pa_msg, pa_sign_rp, pa_inv_eph_skey, pa_reg_skey, pBuffer);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -180,6 +184,8 @@ mbx_status OWNAPI(mbx_nistp256_ecdsa_sign_mb8)(int8u* pa_sign_r[8],
 
 #if (_MBX>=_MBX_K1)
    status |= internal_avx512_nistp256_ecdsa_sign_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_eph_skey, pa_reg_skey, pBuffer);
+#elif (_MBX==_MBX_L9)
+   status |= internal_avx2_nistp256_ecdsa_sign_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_eph_skey, pa_reg_skey, pBuffer);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -235,6 +241,102 @@ mbx_status OWNAPI(mbx_nistp256_ecdsa_verify_mb8)(const int8u* const pa_sign_r[8]
 
 #if (_MBX>=_MBX_K1)
    status |= internal_avx512_nistp256_ecdsa_verify_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_pubx, pa_puby, pa_pubz, pBuffer, use_jproj_coords);
+#elif (_MBX==_MBX_L9)
+   status |= internal_avx2_nistp256_ecdsa_verify_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_pubx, pa_puby, pa_pubz, pBuffer, use_jproj_coords);
+#else
+   status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+   return status;
+}
+
+/*
+// Computes precomputed tables of the public keys
+// pa_table[]        array of pointers to the tables being computed
+// pa_pubx[]         array of pointers to the public keys X-coordinates
+// pa_puby[]         array of pointers to the public keys Y-coordinates
+// pa_pubz[]         array of pointers to the public keys Z-coordinates
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_nistp256_ecdsa_pubkey_precomp_mb8)(mbx_nistp256_pubkey_table* pa_table[8],
+                                                   const int64u* const pa_pubx[8],
+                                                   const int64u* const pa_puby[8],
+                                                   const int64u* const pa_pubz[8],
+                                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_table || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int64u* pubx = pa_pubx[buf_no];
+      const int64u* puby = pa_puby[buf_no];
+      const int64u* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_table[buf_no] || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+#if (_MBX>=_MBX_K1)
+   status |= internal_avx512_nistp256_ecdsa_pubkey_precomp_mb8(pa_table, pa_pubx, pa_puby, pa_pubz, pBuffer, use_jproj_coords);
+#else
+   MBX_UNREFERENCED_PARAMETER(use_jproj_coords);
+   status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+   return status;
+}
+
+/*
+// Verifies ECDSA signature using precomputed tables of the public keys
+// pa_sign_r[]       array of pointers to the computed r-components of the signatures
+// pa_sign_s[]       array of pointers to the computed s-components of the signatures
+// pa_msg[]          array of pointers to the messages are being signed
+// pa_table[]        array of pointers to the public keys tables
+// pBuffer           pointer to the scratch buffer
+*/
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_nistp256_ecdsa_verify_precomp_mb8)(const int8u* const pa_sign_r[8],
+                                                         const int8u* const pa_sign_s[8],
+                                                         const int8u* const pa_msg[8],
+                                                         const mbx_nistp256_pubkey_table* const pa_table[8],
+                                                                int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_table || NULL==pa_msg || NULL==pa_sign_r || NULL==pa_sign_s) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      /* if any of pointer NULL set error status */
+      if(NULL==pa_table[buf_no] || NULL==pa_msg[buf_no] || NULL==pa_sign_r[buf_no] || NULL==pa_sign_s[buf_no]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+      }
+   }
+
+   /* if all pointers NULL exit */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+#if (_MBX>=_MBX_K1)
+   status |= internal_avx512_nistp256_ecdsa_verify_precomp_mb8(pa_sign_r, pa_sign_s, pa_msg, pa_table, pBuffer);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -630,6 +630,176 @@ void MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(P256_POINT* r, const U64 scal
 #undef BP_WIN_SIZE
 
 
+//////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+
+/*
+// Per public key precomputed tables
+//
+// Each lane has its own table of affine (Montgomery) points
+//    tbl[k][j-1] = [j]*[2^(PK_WIN_SIZE*k)]*Q,  j = 1,..,PK_N_ENTRY
+// laid out as the base point table above, so [h]*Q costs PK_N_SLOTS affine
+// additions and no doublings.
+//
+// Note: tables are used for signature verification only, where the scalar
+// and the point are public. That is why points are gathered directly from
+// the tables instead of the constant-time scan used by extract_point_affine_().
+*/
+
+/* R = [2^PK_WIN_SIZE]*P, converted affine multiples of P stored into the tables of active lanes */
+static void MB_FUNC_NAME(precomp_point_slot_)(P256_POINT* R, const P256_POINT* P,
+                                              SINGLE_P256_POINT_AFFINE* const pa_tbl[8], int slot, __mb_mask mask)
+{
+   __ALIGN64 P256_POINT T[PK_N_ENTRY];
+   __ALIGN64 U64 acc[PK_N_ENTRY][P256_LEN52];
+   __ALIGN64 U64 invZ[P256_LEN52];
+   __ALIGN64 U64 invZn[P256_LEN52];
+   __ALIGN64 U64 x[P256_LEN52];
+   __ALIGN64 U64 y[P256_LEN52];
+
+   /* T[j-1] = [j]*P */
+   T[0] = *P;
+   MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(&T[1], P);
+   int j;
+   for(j=2; j<PK_N_ENTRY; j++)
+      MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&T[j], &T[j-1], P);
+
+   /* next slot: R = [2]*T[PK_N_ENTRY-1] */
+   MB_FUNC_NAME(ifma_ec_nistp256_dbl_point_)(R, &T[PK_N_ENTRY-1]);
+
+   /* simultaneous inversion of T[].Z */
+   MB_FUNC_NAME(mov_FE256_)(acc[0], T[0].Z);
+   for(j=1; j<PK_N_ENTRY; j++)
+      mul(acc[j], acc[j-1], T[j].Z);
+   MB_FUNC_NAME(ifma_aminv52_p256_)(invZ, acc[PK_N_ENTRY-1]);
+
+   /* table entries addresses */
+   U64 addr = loadu64(pa_tbl);
+   addr = add64(addr, set1((int64u)(slot*PK_N_ENTRY+PK_N_ENTRY-1)*sizeof(SINGLE_P256_POINT_AFFINE)));
+
+   for(j=PK_N_ENTRY-1; j>=0; j--) {
+      /* acc[j] = 1/T[j].Z */
+      if(j) {
+         mul(acc[j], invZ, acc[j-1]);
+         mul(invZ, invZ, T[j].Z);
+      }
+      else
+         MB_FUNC_NAME(mov_FE256_)(acc[0], invZ);
+
+      sqr(invZn, acc[j]);
+      mul(x, T[j].X, invZn);
+      mul(invZn, invZn, acc[j]);
+      mul(y, T[j].Y, invZn);
+
+      int n;
+      for(n=0; n<P256_LEN52; n++) {
+         _mm512_mask_i64scatter_epi64(NULL, mask, add64(addr, set1((int64u)n*sizeof(int64u))), x[n], 1);
+         _mm512_mask_i64scatter_epi64(NULL, mask, add64(addr, set1((int64u)(P256_LEN52+n)*sizeof(int64u))), y[n], 1);
+      }
+      addr = sub64(addr, set1(sizeof(SINGLE_P256_POINT_AFFINE)));
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp256_precomp_point_tbl_)(SINGLE_P256_POINT_AFFINE* const pa_tbl[8], const P256_POINT* p, __mb_mask mask)
+{
+   P256_POINT P = *p;
+   int slot;
+   for(slot=0; slot<PK_N_SLOTS; slot++)
+      MB_FUNC_NAME(precomp_point_slot_)(&P, &P, pa_tbl, slot, mask);
+}
+
+__MBX_INLINE void MB_FUNC_NAME(booth_recode_pk_)(__mb_mask* sign, U64* dvalue, U64 wvalue)
+{
+   U64 one = set1(1);
+   U64 zero = get_zero64();
+   U64 t = srli64(wvalue, PK_WIN_SIZE);
+   __mb_mask s = cmp64_mask(t, zero, _MM_CMPINT_NE);
+   U64 d = sub64( sub64(set1(1<<(PK_WIN_SIZE+1)), wvalue), one);
+   d = mask_mov64(wvalue, s, d);
+   U64 odd = and64(d, one);
+   d = add64( srli64(d, 1), odd);
+
+   *sign = s;
+   *dvalue = d;
+}
+
+/* gather affine point [dvalue]*(2^(PK_WIN_SIZE*slot))*Q from the tables, [0]*Q = (0:0) */
+__MBX_INLINE void MB_FUNC_NAME(gather_point_affine_)(P256_POINT_AFFINE* r, U64 base, int slot, U64 dvalue)
+{
+   __mb_mask nz = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+
+   U64 addr = add64(base, _mm512_mullo_epi64(sub64(dvalue, set1(1)), set1((int64u)sizeof(SINGLE_P256_POINT_AFFINE))));
+   addr = add64(addr, set1((int64u)(slot*PK_N_ENTRY)*sizeof(SINGLE_P256_POINT_AFFINE)));
+
+   int n;
+   for(n=0; n<P256_LEN52; n++) {
+      r->x[n] = _mm512_mask_i64gather_epi64(get_zero64(), nz, add64(addr, set1((int64u)n*sizeof(int64u))), NULL, 1);
+      r->y[n] = _mm512_mask_i64gather_epi64(get_zero64(), nz, add64(addr, set1((int64u)(P256_LEN52+n)*sizeof(int64u))), NULL, 1);
+   }
+}
+
+void MB_FUNC_NAME(ifma_ec_nistp256_mul_point_tbl_)(P256_POINT* r, const SINGLE_P256_POINT_AFFINE* const pa_tbl[8], const U64 scalar[])
+{
+   U64 base = loadu64(pa_tbl);
+
+   P256_POINT R;
+   P256_POINT_AFFINE A;
+   U64 Ty[P256_LEN52];
+
+   /* R = O */
+   MB_FUNC_NAME(set_point_to_infinity_)(&R);
+
+   U64  wvalue, dvalue;
+   __mb_mask dsign;
+
+   U64 idx_mask = set1( (1<<(PK_WIN_SIZE+1))-1 );
+   int bit = 0;
+   int slot = 0;
+
+   /* first window - window[0] */
+   wvalue = loadu64(&scalar[0]);
+   wvalue = and64( slli64(wvalue, 1), idx_mask);
+
+   for(;;) {
+      MB_FUNC_NAME(booth_recode_pk_)(&dsign, &dvalue, wvalue);
+      MB_FUNC_NAME(gather_point_affine_)(&A, base, slot, dvalue);
+
+      /* A = dsign? -A : A */
+      MB_FUNC_NAME(ifma_neg52_p256_)(Ty, A.y);
+      dsign &= cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+      MB_FUNC_NAME(mask_mov_FE256_)(A.y, A.y, dsign, Ty);
+
+      /* R += A */
+      MB_FUNC_NAME(ifma_ec_nistp256_add_point_affine_)(&R, &R, &A);
+
+      bit += PK_WIN_SIZE;
+      slot++;
+      if(bit>P256_BITSIZE)
+         break;
+
+      int chunk_no = (bit-1)/64;
+      int chunk_shift = (bit-1)%64;
+
+      wvalue = loadu64(&scalar[chunk_no]);
+      #if (_MSC_VER <= 1916) /* VS 2017 not supported _mm512_shrdv_epi64 */
+      {
+      __m512i t_lo_ = _mm512_srlv_epi64(wvalue, set64(chunk_shift));
+      __m512i t_hi_ = _mm512_sllv_epi64(loadu64(&scalar[chunk_no+1]), set64(64-chunk_shift));
+      wvalue = or64(t_lo_, t_hi_);
+      }
+      #else
+      wvalue = _mm512_shrdv_epi64(wvalue, loadu64(&scalar[chunk_no+1]), set1((int32u)chunk_shift));
+      #endif
+      wvalue = and64(wvalue, idx_mask);
+   }
+
+   /* r = R */
+   MB_FUNC_NAME(mov_FE256_)(r->X, R.X);
+   MB_FUNC_NAME(mov_FE256_)(r->Y, R.Y);
+   MB_FUNC_NAME(mov_FE256_)(r->Z, R.Z);
+}
+
+
 /* P256 parameters: mont(a), mont(b) */
 __ALIGN64 static const int64u mont_a_p256_mb[P256_LEN52][8] = {
    { REP8_DECL(0x000fffffffffffcf) },
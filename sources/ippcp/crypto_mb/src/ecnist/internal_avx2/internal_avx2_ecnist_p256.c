@@ -0,0 +1,772 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_arith26_mb8.h>
+#include <internal/ecnist/ifma_ecpoint_p256.h>
+
+#if (_MBX==_MBX_L9)
+
+#include <immintrin.h>
+
+#define P256_BITS      (256)
+#define P256_WORDS     (NUMBER_OF_DIGITS(P256_BITS, 64))
+#define P256_LEN26     (LEN26(P256_BITS))
+
+#define P256_WIN_SIZE  (5)
+#define P256_TBL_SIZE  (1<<P256_WIN_SIZE)
+
+/* NIST P-256 domain parameters (little-endian 64-bit words) */
+static const int64u p256_p[P256_WORDS]   = {0xFFFFFFFFFFFFFFFF, 0x00000000FFFFFFFF, 0x0000000000000000, 0xFFFFFFFF00000001};
+static const int64u p256_p_2[P256_WORDS] = {0xFFFFFFFFFFFFFFFD, 0x00000000FFFFFFFF, 0x0000000000000000, 0xFFFFFFFF00000001};
+static const int64u p256_n[P256_WORDS]   = {0xF3B9CAC2FC632551, 0xBCE6FAADA7179E84, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000000};
+static const int64u p256_n_2[P256_WORDS] = {0xF3B9CAC2FC63254F, 0xBCE6FAADA7179E84, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF00000000};
+static const int64u p256_b[P256_WORDS]   = {0x3BCE3C3E27D2604B, 0x651D06B0CC53B0F6, 0xB3EBBD55769886BC, 0x5AC635D8AA3A93E7};
+static const int64u p256_gx[P256_WORDS]  = {0xF4A13945D898C296, 0x77037D812DEB33A0, 0xF8BCE6E563A440F2, 0x6B17D1F2E12C4247};
+static const int64u p256_gy[P256_WORDS]  = {0xCBB6406837BF51F5, 0x2BCE33576B315ECE, 0x8EE7EB4A7C0F9E16, 0x4FE342E2FE1A7F9B};
+
+typedef int64u fe26_mb8[P256_LEN26][8];
+
+/* point in Jacobian projective coordinates, Montgomery domain; Z==0 is the point at infinity */
+typedef struct {
+   fe26_mb8 X;
+   fe26_mb8 Y;
+   fe26_mb8 Z;
+} P256_POINT26;
+
+/* moduli p and n, Montgomery factors and domain converters */
+typedef struct {
+   fe26_mb8 p;
+   fe26_mb8 rrp;
+   int64u   k0p[8];
+   fe26_mb8 n;
+   fe26_mb8 rrn;
+   int64u   k0n[8];
+   fe26_mb8 one;  /* 1 in Montgomery domain over p */
+} p256_ctx26;
+
+#define FE(x)  ((const int64u (*)[8])(x))
+
+#define p_mul(ctx, r, a, b)   avx2_mont_mul26_mb8((r), FE(a), FE(b), FE((ctx)->p), (ctx)->k0p, P256_LEN26)
+#define p_sqr(ctx, r, a)      avx2_mont_mul26_mb8((r), FE(a), FE(a), FE((ctx)->p), (ctx)->k0p, P256_LEN26)
+#define p_add(ctx, r, a, b)   avx2_add26_mb8((r), FE(a), FE(b), FE((ctx)->p), P256_LEN26)
+#define p_sub(ctx, r, a, b)   avx2_sub26_mb8((r), FE(a), FE(b), FE((ctx)->p), P256_LEN26)
+#define p_tomont(ctx, r, a)   avx2_to_mont26_mb8((r), FE(a), FE((ctx)->rrp), FE((ctx)->p), (ctx)->k0p, P256_LEN26)
+#define p_frommont(ctx, r, a) avx2_from_mont26_mb8((r), FE(a), FE((ctx)->p), (ctx)->k0p, P256_LEN26)
+#define p_inv(ctx, r, a)      avx2_mont_pow26_mb8((r), FE(a), p256_p_2, P256_BITS, FE((ctx)->p), (ctx)->k0p, P256_LEN26)
+
+#define n_mul(ctx, r, a, b)   avx2_mont_mul26_mb8((r), FE(a), FE(b), FE((ctx)->n), (ctx)->k0n, P256_LEN26)
+#define n_add(ctx, r, a, b)   avx2_add26_mb8((r), FE(a), FE(b), FE((ctx)->n), P256_LEN26)
+#define n_tomont(ctx, r, a)   avx2_to_mont26_mb8((r), FE(a), FE((ctx)->rrn), FE((ctx)->n), (ctx)->k0n, P256_LEN26)
+#define n_frommont(ctx, r, a) avx2_from_mont26_mb8((r), FE(a), FE((ctx)->n), (ctx)->k0n, P256_LEN26)
+#define n_inv(ctx, r, a)      avx2_mont_pow26_mb8((r), FE(a), p256_n_2, P256_BITS, FE((ctx)->n), (ctx)->k0n, P256_LEN26)
+
+#define fe_is_zero(a)         avx2_is_zero26_mb8(FE(a), P256_LEN26)
+
+static void p256_ctx_init(p256_ctx26* ctx)
+{
+   avx2_const_to_mb8_26(ctx->p, p256_p, P256_BITS, P256_LEN26);
+   avx2_montFactor26_mb8(ctx->k0p, FE(ctx->p));
+   avx2_montRR26_mb8(ctx->rrp, FE(ctx->p), ctx->k0p, P256_LEN26);
+
+   avx2_const_to_mb8_26(ctx->n, p256_n, P256_BITS, P256_LEN26);
+   avx2_montFactor26_mb8(ctx->k0n, FE(ctx->n));
+   avx2_montRR26_mb8(ctx->rrn, FE(ctx->n), ctx->k0n, P256_LEN26);
+
+   avx2_set26_mb8(ctx->one, 1, P256_LEN26);
+   p_tomont(ctx, ctx->one, ctx->one);
+}
+
+/* "one" is used as X and Y of the infinity to keep table entries well-formed */
+static void set_point_to_infinity(P256_POINT26* r, const p256_ctx26* ctx)
+{
+   avx2_copy26_mb8(r->X, FE(ctx->one), P256_LEN26);
+   avx2_copy26_mb8(r->Y, FE(ctx->one), P256_LEN26);
+   avx2_zero26_mb8(r->Z, P256_LEN26);
+}
+
+static void mask_mov_point(P256_POINT26* r, const P256_POINT26* a, int8u mask)
+{
+   avx2_mask_mov26_mb8(r->X, FE(a->X), mask, P256_LEN26);
+   avx2_mask_mov26_mb8(r->Y, FE(a->Y), mask, P256_LEN26);
+   avx2_mask_mov26_mb8(r->Z, FE(a->Z), mask, P256_LEN26);
+}
+
+/*
+// r = 2*a (dbl-2001-b, a=-3)
+*/
+static void p256_dbl_point(P256_POINT26* r, const P256_POINT26* a, const p256_ctx26* ctx)
+{
+   __ALIGN64 fe26_mb8 delta, gamma, beta, alpha, t0, t1;
+
+   p_sqr(ctx, delta, a->Z);            /* delta = Z^2 */
+   p_sqr(ctx, gamma, a->Y);            /* gamma = Y^2 */
+   p_mul(ctx, beta, a->X, gamma);      /* beta  = X*gamma */
+
+   p_sub(ctx, t0, a->X, delta);
+   p_add(ctx, t1, a->X, delta);
+   p_mul(ctx, alpha, t0, t1);
+   p_add(ctx, t0, alpha, alpha);
+   p_add(ctx, alpha, alpha, t0);       /* alpha = 3*(X-delta)*(X+delta) */
+
+   p_add(ctx, t1, a->Y, a->Z);
+   p_sqr(ctx, t1, t1);
+   p_sub(ctx, t1, t1, gamma);
+   p_sub(ctx, r->Z, t1, delta);        /* Z3 = (Y+Z)^2-gamma-delta */
+
+   p_add(ctx, beta, beta, beta);
+   p_add(ctx, beta, beta, beta);       /* beta = 4*beta */
+   p_sqr(ctx, t0, alpha);
+   p_add(ctx, t1, beta, beta);
+   p_sub(ctx, r->X, t0, t1);           /* X3 = alpha^2-8*beta */
+
+   p_sub(ctx, t0, beta, r->X);
+   p_mul(ctx, t0, alpha, t0);
+   p_sqr(ctx, gamma, gamma);
+   p_add(ctx, gamma, gamma, gamma);
+   p_add(ctx, gamma, gamma, gamma);
+   p_add(ctx, gamma, gamma, gamma);
+   p_sub(ctx, r->Y, t0, gamma);        /* Y3 = alpha*(4*beta-X3)-8*gamma^2 */
+}
+
+/*
+// r = a+b (add-2007-bl) with processing of the exceptional cases:
+// a or b at infinity and a==b
+*/
+static void p256_add_point(P256_POINT26* r, const P256_POINT26* a, const P256_POINT26* b, const p256_ctx26* ctx)
+{
+   __ALIGN64 fe26_mb8 Z1Z1, Z2Z2, U1, U2, S1, S2, H, I, J, R, V, t;
+   __ALIGN64 P256_POINT26 res;
+
+   int8u a_inf = fe_is_zero(a->Z);
+   int8u b_inf = fe_is_zero(b->Z);
+
+   p_sqr(ctx, Z1Z1, a->Z);
+   p_sqr(ctx, Z2Z2, b->Z);
+   p_mul(ctx, U1, a->X, Z2Z2);
+   p_mul(ctx, U2, b->X, Z1Z1);
+   p_mul(ctx, S1, a->Y, b->Z);
+   p_mul(ctx, S1, S1, Z2Z2);           /* S1 = Y1*Z2^3 */
+   p_mul(ctx, S2, b->Y, a->Z);
+   p_mul(ctx, S2, S2, Z1Z1);           /* S2 = Y2*Z1^3 */
+
+   p_sub(ctx, H, U2, U1);              /* H = U2-U1 */
+   p_sub(ctx, R, S2, S1);
+   p_add(ctx, R, R, R);                /* R = 2*(S2-S1) */
+
+   /* a==b (both are finite) */
+   int8u dbl_mask = fe_is_zero(H) & fe_is_zero(R) & ~a_inf & ~b_inf;
+
+   p_add(ctx, I, H, H);
+   p_sqr(ctx, I, I);                   /* I = (2*H)^2 */
+   p_mul(ctx, J, H, I);                /* J = H*I */
+   p_mul(ctx, V, U1, I);               /* V = U1*I */
+
+   p_sqr(ctx, t, R);
+   p_sub(ctx, t, t, J);
+   p_sub(ctx, t, t, V);
+   p_sub(ctx, res.X, t, V);            /* X3 = R^2-J-2*V */
+
+   p_sub(ctx, t, V, res.X);
+   p_mul(ctx, t, R, t);
+   p_mul(ctx, S1, S1, J);
+   p_add(ctx, S1, S1, S1);
+   p_sub(ctx, res.Y, t, S1);           /* Y3 = R*(V-X3)-2*S1*J */
+
+   p_add(ctx, t, a->Z, b->Z);
+   p_sqr(ctx, t, t);
+   p_sub(ctx, t, t, Z1Z1);
+   p_sub(ctx, t, t, Z2Z2);
+   p_mul(ctx, res.Z, t, H);            /* Z3 = ((Z1+Z2)^2-Z1Z1-Z2Z2)*H */
+
+   /* doubling is expected to be rare, so it is computed on demand only */
+   if(dbl_mask) {
+      __ALIGN64 P256_POINT26 d;
+      p256_dbl_point(&d, a, ctx);
+      mask_mov_point(&res, &d, dbl_mask);
+   }
+   mask_mov_point(&res, a, b_inf);
+   mask_mov_point(&res, b, a_inf);
+
+   *r = res;
+}
+
+/* constant-time r = tbl[idx[n]] for each lane */
+static void p256_select_point(P256_POINT26* r, const P256_POINT26 tbl[P256_TBL_SIZE], const int64u idx[8])
+{
+   const int rows = (int)(sizeof(P256_POINT26)/sizeof(int64u[8]));
+   __m256i idx_lo = _mm256_loadu_si256((const __m256i*)idx);
+   __m256i idx_hi = _mm256_loadu_si256((const __m256i*)(idx+4));
+   int64u (*pr)[8] = (int64u (*)[8])r;
+   int j, i;
+
+   avx2_zero26_mb8(pr, rows);
+   for(j=0; j<P256_TBL_SIZE; j++) {
+      __m256i jj = _mm256_set1_epi64x(j);
+      __m256i m_lo = _mm256_cmpeq_epi64(idx_lo, jj);
+      __m256i m_hi = _mm256_cmpeq_epi64(idx_hi, jj);
+      const int64u (*pt)[8] = (const int64u (*)[8])&tbl[j];
+      for(i=0; i<rows; i++) {
+         __m256i lo = _mm256_loadu_si256((const __m256i*)pr[i]);
+         __m256i hi = _mm256_loadu_si256((const __m256i*)(pr[i]+4));
+         lo = _mm256_or_si256(lo, _mm256_and_si256(m_lo, _mm256_loadu_si256((const __m256i*)pt[i])));
+         hi = _mm256_or_si256(hi, _mm256_and_si256(m_hi, _mm256_loadu_si256((const __m256i*)(pt[i]+4))));
+         _mm256_storeu_si256((__m256i*)pr[i], lo);
+         _mm256_storeu_si256((__m256i*)(pr[i]+4), hi);
+      }
+   }
+}
+
+/* extract window of scalar bits starting at position bit */
+static void p256_get_window(int64u idx[8], const int64u scalar[][8], int bit)
+{
+   int word = bit/64;
+   int shift = bit%64;
+   int n;
+   for(n=0; n<8; n++) {
+      int64u w = scalar[word][n] >> shift;
+      if(shift > 64-P256_WIN_SIZE)
+         w |= scalar[word+1][n] << (64-shift);
+      idx[n] = w & (P256_TBL_SIZE-1);
+   }
+}
+
+/*
+// r = [scalar]*P, fixed window, constant time
+//
+// note: scalar[] is transposed and zero expanded (P256_WORDS+1 words)
+*/
+static void p256_mul_point(P256_POINT26* r, const P256_POINT26* p, const int64u scalar[][8], const p256_ctx26* ctx)
+{
+   __ALIGN64 P256_POINT26 tbl[P256_TBL_SIZE];
+   __ALIGN64 P256_POINT26 T;
+   __ALIGN64 P256_POINT26 R;
+   __ALIGN64 int64u idx[8];
+   int i, bit;
+
+   /* tbl[i] = [i]*P */
+   set_point_to_infinity(&tbl[0], ctx);
+   tbl[1] = *p;
+   p256_dbl_point(&tbl[2], p, ctx);
+   for(i=3; i<P256_TBL_SIZE; i++)
+      p256_add_point(&tbl[i], &tbl[i-1], p, ctx);
+
+   bit = ((P256_BITS-1)/P256_WIN_SIZE)*P256_WIN_SIZE;
+   p256_get_window(idx, scalar, bit);
+   p256_select_point(&R, tbl, idx);
+
+   for(bit-=P256_WIN_SIZE; bit>=0; bit-=P256_WIN_SIZE) {
+      for(i=0; i<P256_WIN_SIZE; i++)
+         p256_dbl_point(&R, &R, ctx);
+      p256_get_window(idx, scalar, bit);
+      p256_select_point(&T, tbl, idx);
+      p256_add_point(&R, &R, &T, ctx);
+   }
+
+   *r = R;
+
+   /* clear table and window data */
+   avx2_zero26_mb8((int64u (*)[8])tbl, P256_TBL_SIZE*3*P256_LEN26);
+   avx2_zero26_mb8((int64u (*)[8])&T, (int)(sizeof(T)/sizeof(int64u[8])));
+   avx2_zero26_mb8((int64u (*)[8])&R, (int)(sizeof(R)/sizeof(int64u[8])));
+   avx2_zero26_mb8((int64u (*)[8])idx, 1);
+}
+
+/* r = [scalar]*G */
+static void p256_mul_pointbase(P256_POINT26* r, const int64u scalar[][8], const p256_ctx26* ctx)
+{
+   __ALIGN64 P256_POINT26 G;
+   avx2_const_to_mb8_26(G.X, p256_gx, P256_BITS, P256_LEN26);
+   avx2_const_to_mb8_26(G.Y, p256_gy, P256_BITS, P256_LEN26);
+   p_tomont(ctx, G.X, G.X);
+   p_tomont(ctx, G.Y, G.Y);
+   avx2_copy26_mb8(G.Z, FE(ctx->one), P256_LEN26);
+   p256_mul_point(r, &G, scalar, ctx);
+}
+
+/* affine x and y (Montgomery domain) of P; y is optional */
+static void p256_get_affine_coords(int64u x[][8], int64u y[][8], const P256_POINT26* p, const p256_ctx26* ctx)
+{
+   __ALIGN64 fe26_mb8 zinv, zinv2;
+   p_inv(ctx, zinv, p->Z);
+   p_sqr(ctx, zinv2, zinv);
+   if(y) {
+      p_mul(ctx, y, p->Y, zinv2);
+      p_mul(ctx, y, y, zinv);
+   }
+   p_mul(ctx, x, p->X, zinv2);
+}
+
+/* Y^2 == X^3 - 3*X*Z^4 + b*Z^6 */
+static int8u p256_is_on_curve(const P256_POINT26* p, const p256_ctx26* ctx)
+{
+   __ALIGN64 fe26_mb8 lhs, rhs, Z4, Z6, t, b;
+
+   p_sqr(ctx, Z6, p->Z);
+   p_sqr(ctx, Z4, Z6);
+   p_mul(ctx, Z6, Z6, Z4);
+
+   p_sqr(ctx, rhs, p->X);
+   p_mul(ctx, rhs, rhs, p->X);         /* X^3 */
+   p_mul(ctx, t, p->X, Z4);
+   p_sub(ctx, rhs, rhs, t);
+   p_sub(ctx, rhs, rhs, t);
+   p_sub(ctx, rhs, rhs, t);            /* X^3 - 3*X*Z^4 */
+   avx2_const_to_mb8_26(b, p256_b, P256_BITS, P256_LEN26);
+   p_tomont(ctx, b, b);
+   p_mul(ctx, t, b, Z6);
+   p_add(ctx, rhs, rhs, t);
+
+   p_sqr(ctx, lhs, p->Y);
+   return avx2_cmp_eq26_mb8(FE(lhs), FE(rhs), P256_LEN26);
+}
+
+/* mask of lanes out of [1, m) range */
+static int8u p256_check_range(const int64u a[][8], const int64u m[][8])
+{
+   return (int8u)(fe_is_zero(a) | ~avx2_cmp_lt26_mb8(a, m, P256_LEN26));
+}
+
+/* k = BNU keys transposed and zero expanded */
+static void p256_scalar(int64u k[P256_WORDS+1][8], const int64u* const pa_key[8])
+{
+   avx2_BNU_transpose_copy(k, pa_key, P256_BITS);
+   avx2_zero26_mb8(k+P256_WORDS, 1);
+}
+
+/* k[] = radix 2^26 value a[] as transposed and zero expanded scalar */
+static void p256_fe_to_scalar(int64u k[P256_WORDS+1][8], const int64u a[][8])
+{
+   int64u tmp[8][P256_WORDS];
+   int64u* pa_tmp[8] = {tmp[0], tmp[1], tmp[2], tmp[3], tmp[4], tmp[5], tmp[6], tmp[7]};
+
+   avx2_mb8_26_to_BNU(pa_tmp, a, P256_BITS);
+   p256_scalar(k, (const int64u* const*)pa_tmp);
+}
+
+/* r = ([scalar]*G).x mod n */
+static int8u p256_ecdsa_sign_r(int64u sign_r[][8], const int64u scalar[][8], const p256_ctx26* ctx)
+{
+   __ALIGN64 P256_POINT26 P;
+
+   p256_mul_pointbase(&P, scalar, ctx);
+   p256_get_affine_coords(sign_r, NULL, &P, ctx);
+   p_frommont(ctx, sign_r, sign_r);
+   avx2_reduce26_mb8(sign_r, FE(sign_r), FE(ctx->n), P256_LEN26);
+
+   return fe_is_zero(sign_r);
+}
+
+/* s = (inv_eph) * (msg + reg_skey*sign_r) mod n */
+static int8u p256_ecdsa_sign_s(int64u sign_s[][8],
+                               int64u msg[][8],
+                         const int64u sign_r[][8],
+                               int64u inv_eph[][8],
+                               int64u reg_skey[][8],
+                         const p256_ctx26* ctx)
+{
+   __ALIGN64 fe26_mb8 t;
+
+   n_tomont(ctx, inv_eph, inv_eph);
+   n_tomont(ctx, t, sign_r);
+   n_tomont(ctx, msg, msg);
+   n_tomont(ctx, reg_skey, reg_skey);
+
+   n_mul(ctx, sign_s, reg_skey, t);
+   n_add(ctx, sign_s, sign_s, msg);
+   n_mul(ctx, sign_s, sign_s, inv_eph);
+   n_frommont(ctx, sign_s, sign_s);
+
+   return fe_is_zero(sign_s);
+}
+
+/* inv = 1/k mod n */
+static void p256_inv_n(int64u inv[][8], const int64u k[][8], const p256_ctx26* ctx)
+{
+   n_tomont(ctx, inv, k);
+   n_inv(ctx, inv, inv);
+   n_frommont(ctx, inv, inv);
+}
+
+mbx_status internal_avx2_nistp256_ecpublic_key_mb8(int64u* pa_pubx[8],
+                                                   int64u* pa_puby[8],
+                                                   int64u* pa_pubz[8],
+                                             const int64u* const pa_skey[8],
+                                                   int8u* pBuffer, int use_jproj_coords)
+{
+   mbx_status status = 0;
+   __ALIGN64 int64u scalar[P256_WORDS+1][8];
+   __ALIGN64 P256_POINT26 P;
+   p256_ctx26 ctx;
+
+   p256_scalar(scalar, pa_skey);
+
+   status |= MBX_SET_STS_BY_MASK(status, avx2_is_zero26_mb8(FE(scalar), P256_WORDS+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* do not need to clear copy of secret keys before this return - all of them is NULL or zero */
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   p256_ctx_init(&ctx);
+
+   /* compute public keys */
+   p256_mul_pointbase(&P, (const int64u (*)[8])scalar, &ctx);
+   /* clear copy of the secret keys */
+   avx2_zero26_mb8(scalar, P256_WORDS+1);
+
+   if(!use_jproj_coords)
+      p256_get_affine_coords(P.X, P.Y, &P, &ctx);
+
+   /* convert P coordinates to regular domain */
+   p_frommont(&ctx, P.X, P.X);
+   p_frommont(&ctx, P.Y, P.Y);
+   if(use_jproj_coords)
+      p_frommont(&ctx, P.Z, P.Z);
+
+   /* store result */
+   avx2_mb8_26_to_BNU(pa_pubx, FE(P.X), P256_BITS);
+   avx2_mb8_26_to_BNU(pa_puby, FE(P.Y), P256_BITS);
+   if(use_jproj_coords)
+      avx2_mb8_26_to_BNU(pa_pubz, FE(P.Z), P256_BITS);
+   return status;
+}
+
+mbx_status internal_avx2_nistp256_ecdh_mb8(int8u* pa_shared_key[8],
+                                     const int64u* const pa_skey[8],
+                                     const int64u* const pa_pubx[8],
+                                     const int64u* const pa_puby[8],
+                                     const int64u* const pa_pubz[8],
+                                           int8u* pBuffer, int use_jproj_coords)
+{
+   mbx_status status = 0;
+   __ALIGN64 int64u secretz[P256_WORDS+1][8];
+   __ALIGN64 P256_POINT26 P;
+   __ALIGN64 P256_POINT26 R;
+   __ALIGN64 P256_POINT26 inf;
+   p256_ctx26 ctx;
+
+   p256_scalar(secretz, pa_skey);
+
+   status |= MBX_SET_STS_BY_MASK(status, avx2_is_zero26_mb8(FE(secretz), P256_WORDS+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the secret keys */
+      avx2_zero26_mb8(secretz, P256_WORDS+1);
+      return status;
+   }
+
+   p256_ctx_init(&ctx);
+
+   /* set party's public */
+   avx2_BNU_to_mb8_26(P.X, pa_pubx, P256_BITS, P256_LEN26);
+   avx2_BNU_to_mb8_26(P.Y, pa_puby, P256_BITS, P256_LEN26);
+   if(use_jproj_coords)
+      avx2_BNU_to_mb8_26(P.Z, pa_pubz, P256_BITS, P256_LEN26);
+   else
+      avx2_set26_mb8(P.Z, 1, P256_LEN26);
+   /* convert to Montgomery */
+   p_tomont(&ctx, P.X, P.X);
+   p_tomont(&ctx, P.Y, P.Y);
+   p_tomont(&ctx, P.Z, P.Z);
+
+   /* check if P does not belong to EC */
+   int8u not_on_curve_mask = (int8u)~p256_is_on_curve(&P, &ctx);
+   /* set points out of EC to infinity */
+   set_point_to_infinity(&inf, &ctx);
+   mask_mov_point(&P, &inf, not_on_curve_mask);
+   /* update status */
+   status |= MBX_SET_STS_BY_MASK(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the secret keys */
+      avx2_zero26_mb8(secretz, P256_WORDS+1);
+      return status;
+   }
+
+   /* compute R = [secretz]*P */
+   p256_mul_point(&R, &P, (const int64u (*)[8])secretz, &ctx);
+
+   /* clear copy of the secret keys */
+   avx2_zero26_mb8(secretz, P256_WORDS+1);
+
+   /* return affine R.x */
+   p256_get_affine_coords(R.X, NULL, &R, &ctx);
+   p_frommont(&ctx, R.X, R.X);
+
+   /* store result */
+   avx2_mb8_26_to_HexStr8(pa_shared_key, FE(R.X), P256_BITS);
+
+   /* clear computed shared keys */
+   avx2_zero26_mb8((int64u (*)[8])&R, (int)(sizeof(R)/sizeof(int64u[8])));
+
+   return status;
+}
+
+mbx_status internal_avx2_nistp256_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
+                                                       int64u* pa_sign_rp[8],
+                                                 const int64u* const pa_eph_skey[8],
+                                                       int8u* pBuffer)
+{
+   mbx_status status = 0;
+   __ALIGN64 fe26_mb8 T;
+   __ALIGN64 int64u scalarz[P256_WORDS+1][8];
+   p256_ctx26 ctx;
+
+   /* convert keys into FE and compute inversion */
+   avx2_BNU_to_mb8_26(T, pa_eph_skey, P256_BITS, P256_LEN26);
+
+   status |= MBX_SET_STS_BY_MASK(status, fe_is_zero(T), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear key's inversion */
+      avx2_zero26_mb8(T, P256_LEN26);
+      return status;
+   }
+
+   p256_ctx_init(&ctx);
+
+   p256_inv_n(T, FE(T), &ctx);
+   /* return results in suitable format */
+   avx2_mb8_26_to_BNU(pa_inv_eph_skey, FE(T), P256_BITS);
+
+   /* clear key's inversion */
+   avx2_zero26_mb8(T, P256_LEN26);
+
+   /* convert keys into scalars */
+   p256_scalar(scalarz, pa_eph_skey);
+   /* compute r-component of the DSA signature */
+   int8u stt_mask = p256_ecdsa_sign_r(T, FE(scalarz), &ctx);
+
+   /* clear copy of the ephemeral secret keys */
+   avx2_zero26_mb8(scalarz, P256_WORDS+1);
+
+   /* return results in suitable format */
+   avx2_mb8_26_to_BNU(pa_sign_rp, FE(T), P256_BITS);
+
+   status |= MBX_SET_STS_BY_MASK(status, stt_mask, MBX_STATUS_SIGNATURE_ERR);
+   return status;
+}
+
+mbx_status internal_avx2_nistp256_ecdsa_sign_complete_mb8(int8u* pa_sign_r[8],
+                                                          int8u* pa_sign_s[8],
+                                                    const int8u* const pa_msg[8],
+                                                    const int64u* const pa_sign_rp[8],
+                                                    const int64u* const pa_inv_eph_skey[8],
+                                                    const int64u* const pa_reg_skey[8],
+                                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   __ALIGN64 fe26_mb8 inv_eph;
+   __ALIGN64 fe26_mb8 reg_skey;
+   __ALIGN64 fe26_mb8 sign_r;
+   __ALIGN64 fe26_mb8 sign_s;
+   __ALIGN64 fe26_mb8 msg;
+   p256_ctx26 ctx;
+
+   p256_ctx_init(&ctx);
+
+   /* convert inv_eph, reg_skey, sign_r and message to mb format */
+   avx2_BNU_to_mb8_26(inv_eph, pa_inv_eph_skey, P256_BITS, P256_LEN26);
+   avx2_BNU_to_mb8_26(reg_skey, pa_reg_skey, P256_BITS, P256_LEN26);
+   avx2_BNU_to_mb8_26(sign_r, pa_sign_rp, P256_BITS, P256_LEN26);
+   avx2_HexStr8_to_mb8_26(msg, pa_msg, P256_BITS, P256_LEN26);
+
+   status |= MBX_SET_STS_BY_MASK(status, fe_is_zero(inv_eph), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, fe_is_zero(reg_skey), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, fe_is_zero(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(msg), FE(ctx.n)), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the ephemeral and regular secret keys */
+      avx2_zero26_mb8(inv_eph, P256_LEN26);
+      avx2_zero26_mb8(reg_skey, P256_LEN26);
+      return status;
+   }
+
+   /* compute s- signature component: s = (inv_eph) * (msg + prv_skey*sign_r) mod n256 */
+   p256_ecdsa_sign_s(sign_s, msg, FE(sign_r), inv_eph, reg_skey, &ctx);
+
+   /* clear copy of the ephemeral and regular secret keys */
+   avx2_zero26_mb8(inv_eph, P256_LEN26);
+   avx2_zero26_mb8(reg_skey, P256_LEN26);
+
+   /* check if sign_r!=0 and sign_s!=0 */
+   int8u stt_mask_r = fe_is_zero(sign_r);
+   int8u stt_mask_s = fe_is_zero(sign_s);
+
+   /* convert sign_r and sing_s to strings */
+   avx2_mb8_26_to_HexStr8(pa_sign_r, FE(sign_r), P256_BITS);
+   avx2_mb8_26_to_HexStr8(pa_sign_s, FE(sign_s), P256_BITS);
+
+   status |= MBX_SET_STS_BY_MASK(status, stt_mask_r, MBX_STATUS_SIGNATURE_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, stt_mask_s, MBX_STATUS_SIGNATURE_ERR);
+   return status;
+}
+
+mbx_status internal_avx2_nistp256_ecdsa_sign_mb8(int8u* pa_sign_r[8],
+                                                 int8u* pa_sign_s[8],
+                                           const int8u* const pa_msg[8],
+                                           const int64u* const pa_eph_skey[8],
+                                           const int64u* const pa_reg_skey[8],
+                                                 int8u* pBuffer)
+{
+   mbx_status status = 0;
+   __ALIGN64 fe26_mb8 inv_eph_key;
+   __ALIGN64 fe26_mb8 reg_key;
+   __ALIGN64 fe26_mb8 sign_r;
+   __ALIGN64 fe26_mb8 sign_s;
+   __ALIGN64 fe26_mb8 msg;
+   __ALIGN64 int64u scalar[P256_WORDS+1][8];
+   p256_ctx26 ctx;
+
+   p256_ctx_init(&ctx);
+
+   /* convert ephemeral keys into FE and into scalar */
+   avx2_BNU_to_mb8_26(inv_eph_key, pa_eph_skey, P256_BITS, P256_LEN26);
+   p256_scalar(scalar, pa_eph_skey);
+   /* convert reg_skey */
+   avx2_BNU_to_mb8_26(reg_key, pa_reg_skey, P256_BITS, P256_LEN26);
+   /* convert message */
+   avx2_HexStr8_to_mb8_26(msg, pa_msg, P256_BITS, P256_LEN26);
+
+   status |= MBX_SET_STS_BY_MASK(status, fe_is_zero(inv_eph_key), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, fe_is_zero(reg_key), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(msg), FE(ctx.n)), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the ephemeral and regular secret keys */
+      avx2_zero26_mb8(inv_eph_key, P256_LEN26);
+      avx2_zero26_mb8(scalar, P256_WORDS+1);
+      avx2_zero26_mb8(reg_key, P256_LEN26);
+      return status;
+   }
+
+   /* compute inversion */
+   p256_inv_n(inv_eph_key, FE(inv_eph_key), &ctx);
+   /* compute r-component */
+   p256_ecdsa_sign_r(sign_r, FE(scalar), &ctx);
+   /* compute s-component */
+   p256_ecdsa_sign_s(sign_s, msg, FE(sign_r), inv_eph_key, reg_key, &ctx);
+
+   /* clear copy of the ephemeral and regular secret keys */
+   avx2_zero26_mb8(inv_eph_key, P256_LEN26);
+   avx2_zero26_mb8(scalar, P256_WORDS+1);
+   avx2_zero26_mb8(reg_key, P256_LEN26);
+
+   /* check if sign_r!=0 and sign_s!=0 */
+   int8u stt_mask_r = fe_is_zero(sign_r);
+   int8u stt_mask_s = fe_is_zero(sign_s);
+
+   /* convert signature components to strings */
+   avx2_mb8_26_to_HexStr8(pa_sign_r, FE(sign_r), P256_BITS);
+   avx2_mb8_26_to_HexStr8(pa_sign_s, FE(sign_s), P256_BITS);
+
+   status |= MBX_SET_STS_BY_MASK(status, stt_mask_r, MBX_STATUS_SIGNATURE_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, stt_mask_s, MBX_STATUS_SIGNATURE_ERR);
+   return status;
+}
+
+mbx_status internal_avx2_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_r[8],
+                                                   const int8u* const pa_sign_s[8],
+                                                   const int8u* const pa_msg[8],
+                                                   const int64u* const pa_pubx[8],
+                                                   const int64u* const pa_puby[8],
+                                                   const int64u* const pa_pubz[8],
+                                                         int8u* pBuffer, int use_jproj_coords)
+{
+   mbx_status status = 0;
+   __ALIGN64 fe26_mb8 msg;
+   __ALIGN64 fe26_mb8 sign_r;
+   __ALIGN64 fe26_mb8 sign_s;
+   __ALIGN64 fe26_mb8 h1;
+   __ALIGN64 fe26_mb8 h2;
+   __ALIGN64 int64u scalar1[P256_WORDS+1][8];
+   __ALIGN64 int64u scalar2[P256_WORDS+1][8];
+   __ALIGN64 P256_POINT26 W;
+   __ALIGN64 P256_POINT26 P;
+   p256_ctx26 ctx;
+
+   p256_ctx_init(&ctx);
+
+   /* convert input params */
+   avx2_HexStr8_to_mb8_26(msg, pa_msg, P256_BITS, P256_LEN26);
+   avx2_HexStr8_to_mb8_26(sign_r, pa_sign_r, P256_BITS, P256_LEN26);
+   avx2_HexStr8_to_mb8_26(sign_s, pa_sign_s, P256_BITS, P256_LEN26);
+
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(msg), FE(ctx.n)), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(sign_r), FE(ctx.n)), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(sign_s), FE(ctx.n)), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   avx2_BNU_to_mb8_26(W.X, pa_pubx, P256_BITS, P256_LEN26);
+   avx2_BNU_to_mb8_26(W.Y, pa_puby, P256_BITS, P256_LEN26);
+   if(use_jproj_coords)
+      avx2_BNU_to_mb8_26(W.Z, pa_pubz, P256_BITS, P256_LEN26);
+   else
+      avx2_set26_mb8(W.Z, 1, P256_LEN26);
+
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(W.X), FE(ctx.p)), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(W.Y), FE(ctx.p)), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, p256_check_range(FE(W.Z), FE(ctx.p)), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* convert public key coords to Montgomery */
+   p_tomont(&ctx, W.X, W.X);
+   p_tomont(&ctx, W.Y, W.Y);
+   p_tomont(&ctx, W.Z, W.Z);
+
+   /* h = (sign_s)^(-1) */
+   n_tomont(&ctx, sign_s, sign_s);
+   n_inv(&ctx, sign_s, sign_s);
+   /* h1 = msg * h */
+   n_tomont(&ctx, h1, msg);
+   n_mul(&ctx, h1, h1, sign_s);
+   n_frommont(&ctx, h1, h1);
+   /* h2 = sign_r * h */
+   n_tomont(&ctx, h2, sign_r);
+   n_mul(&ctx, h2, h2, sign_s);
+   n_frommont(&ctx, h2, h2);
+
+   p256_fe_to_scalar(scalar1, FE(h1));
+   p256_fe_to_scalar(scalar2, FE(h2));
+
+   /* P = h1*G + h2*W */
+   p256_mul_point(&W, &W, FE(scalar2), &ctx);
+   p256_mul_pointbase(&P, FE(scalar1), &ctx);
+   p256_add_point(&P, &P, &W, &ctx);
+
+   /* P != 0 */
+   int8u signature_err_mask = fe_is_zero(P.Z);
+
+   /* sign_r_restored = P.X mod n */
+   p256_get_affine_coords(h1, NULL, &P, &ctx);
+   p_frommont(&ctx, h1, h1);
+   avx2_reduce26_mb8(h1, FE(h1), FE(ctx.n), P256_LEN26);
+
+   /* sign_r_restored != sign_r */
+   signature_err_mask |= (int8u)~avx2_cmp_eq26_mb8(FE(h1), FE(sign_r), P256_LEN26);
+
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+   return status;
+}
+
+#endif /* #if (_MBX==_MBX_L9) */
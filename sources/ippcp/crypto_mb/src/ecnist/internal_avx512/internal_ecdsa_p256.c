@@ -102,21 +102,19 @@ static __mb_mask nistp256_ecdsa_sign_s_mb8(U64 sign_s[],
 }
 
 /*
-// ECDSA signature verification algorithm
+// compute verification scalars
+//
+// h1 = msg/sign_s mod n256
+// h2 = sign_r/sign_s mod n256
+//
+// note: h1[] and h2[] are returned transposed and zero expanded
 */
-static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
-                                           U64 sign_s[],
-                                           U64 msg[],
-                                   P256_POINT* W)
+static void nistp256_ecdsa_verify_scalars_mb8(U64 h1[],
+                                              U64 h2[],
+                                        const U64 sign_r[],
+                                              U64 sign_s[],
+                                        const U64 msg[])
 {
-   /* convert public key coords to Montgomery */
-   MB_FUNC_NAME(ifma_tomont52_p256_)(W->X, W->X);
-   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Y, W->Y);
-   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Z, W->Z);
-
-   __ALIGN64 U64 h1[P256_LEN52];
-   __ALIGN64 U64 h2[P256_LEN52];
-
    /* h = (sign_s)^(-1) */
    MB_FUNC_NAME(ifma_tomont52_n256_)(sign_s, sign_s);
    MB_FUNC_NAME(ifma_aminv52_n256_)(sign_s, sign_s);
@@ -141,20 +139,22 @@ static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
 
    h1[P256_LEN64] = get_zero64();
    h2[P256_LEN64] = get_zero64();
+}
 
-   P256_POINT P;
-
-   // P = h1*G + h2*W
-   MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(W, W, h2);
-   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, h1);
-   MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&P, &P, W);
-
+/*
+// check P = [h1]*G + [h2]*W against r-component of the signature
+//
+// returns mask of invalid signatures
+*/
+static __mb_mask nistp256_ecdsa_verify_check_mb8(const U64 sign_r[],
+                                                 const P256_POINT* P)
+{
    // P != 0
-   __mb_mask signature_err_mask = MB_FUNC_NAME(is_zero_point_cordinate_)(P.Z);
+   __mb_mask signature_err_mask = MB_FUNC_NAME(is_zero_point_cordinate_)(P->Z);
 
    /* sign_r_restored = P.X mod n */
    __ALIGN64 U64 sign_r_restored[P256_LEN52];
-   MB_FUNC_NAME(get_nistp256_ec_affine_coords_)(sign_r_restored, NULL, &P);
+   MB_FUNC_NAME(get_nistp256_ec_affine_coords_)(sign_r_restored, NULL, P);
    MB_FUNC_NAME(ifma_frommont52_p256_)(sign_r_restored, sign_r_restored);
    MB_FUNC_NAME(ifma_fastred52_pn256_)(sign_r_restored, sign_r_restored);
 
@@ -164,6 +164,57 @@ static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
    return signature_err_mask;
 }
 
+/*
+// ECDSA signature verification algorithm
+*/
+static __mb_mask nistp256_ecdsa_verify_mb8(U64 sign_r[],
+                                           U64 sign_s[],
+                                           U64 msg[],
+                                   P256_POINT* W)
+{
+   /* convert public key coords to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W->X, W->X);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Y, W->Y);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W->Z, W->Z);
+
+   __ALIGN64 U64 h1[P256_LEN52];
+   __ALIGN64 U64 h2[P256_LEN52];
+
+   nistp256_ecdsa_verify_scalars_mb8(h1, h2, sign_r, sign_s, msg);
+
+   P256_POINT P;
+
+   // P = h1*G + h2*W
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_point_)(W, W, h2);
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, h1);
+   MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&P, &P, W);
+
+   return nistp256_ecdsa_verify_check_mb8(sign_r, &P);
+}
+
+/*
+// ECDSA signature verification algorithm (precomputed public key tables)
+*/
+static __mb_mask nistp256_ecdsa_verify_precomp_mb8(U64 sign_r[],
+                                                   U64 sign_s[],
+                                                   U64 msg[],
+                            const SINGLE_P256_POINT_AFFINE* const pa_tbl[8])
+{
+   __ALIGN64 U64 h1[P256_LEN52];
+   __ALIGN64 U64 h2[P256_LEN52];
+
+   nistp256_ecdsa_verify_scalars_mb8(h1, h2, sign_r, sign_s, msg);
+
+   P256_POINT P, W;
+
+   // P = h1*G + h2*W
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_point_tbl_)(&W, pa_tbl, h2);
+   MB_FUNC_NAME(ifma_ec_nistp256_mul_pointbase_)(&P, h1);
+   MB_FUNC_NAME(ifma_ec_nistp256_add_point_)(&P, &P, &W);
+
+   return nistp256_ecdsa_verify_check_mb8(sign_r, &P);
+}
+
 mbx_status internal_avx512_nistp256_ecdsa_sign_setup_mb8(int64u* pa_inv_eph_skey[8],
                                                               int64u* pa_sign_rp[8],
                                                  const int64u* const pa_eph_skey[8],
@@ -373,6 +424,100 @@ mbx_status internal_avx512_nistp256_ecdsa_verify_mb8(const int8u* const pa_sign_
    return status;
 }
 
+mbx_status internal_avx512_nistp256_ecdsa_verify_precomp_mb8(const int8u* const pa_sign_r[8],
+                                                             const int8u* const pa_sign_s[8],
+                                                             const int8u* const pa_msg[8],
+                                                             const mbx_nistp256_pubkey_table* const pa_table[8],
+                                                                   int8u* pBuffer)
+{
+   mbx_status status = 0;
+   __ALIGN64 U64 msg[P256_LEN52];
+   __ALIGN64 U64 sign_r[P256_LEN52];
+   __ALIGN64 U64 sign_s[P256_LEN52];
+
+   /* convert input params */
+   ifma_HexStr8_to_mb8((int64u (*)[8])msg, pa_msg, P256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_r, pa_sign_r, P256_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])sign_s, pa_sign_s, P256_BITSIZE);
+
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(msg), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(sign_r), MBX_STATUS_MISMATCH_PARAM_ERR);
+   status |= MBX_SET_STS_BY_MASK(status, MB_FUNC_NAME(ifma_check_range_n256_)(sign_s), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /* tables are read in all lanes: substitute the missing ones by any available table */
+   const SINGLE_P256_POINT_AFFINE* tbl[8];
+   const mbx_nistp256_pubkey_table* any_table = NULL;
+   __mb_mask active_mask = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8 && NULL==any_table; buf_no++)
+      any_table = pa_table[buf_no];
+   for(buf_no=0; buf_no<8; buf_no++) {
+      tbl[buf_no] = (const SINGLE_P256_POINT_AFFINE*)(pa_table[buf_no]? pa_table[buf_no] : any_table);
+      if(pa_table[buf_no] && pa_msg[buf_no] && pa_sign_r[buf_no] && pa_sign_s[buf_no])
+         active_mask |= (__mb_mask)(1<<buf_no);
+   }
+
+   __mb_mask signature_err_mask = nistp256_ecdsa_verify_precomp_mb8(sign_r, sign_s, msg, tbl);
+   signature_err_mask &= active_mask;
+   status |= MBX_SET_STS_BY_MASK(status, signature_err_mask, MBX_STATUS_SIGNATURE_ERR);
+   return status;
+}
+
+mbx_status internal_avx512_nistp256_ecdsa_pubkey_precomp_mb8(mbx_nistp256_pubkey_table* pa_table[8],
+                                                       const int64u* const pa_pubx[8],
+                                                       const int64u* const pa_puby[8],
+                                                       const int64u* const pa_pubz[8],
+                                                             int8u* pBuffer, int use_jproj_coords)
+{
+   mbx_status status = 0;
+   P256_POINT W;
+
+   ifma_BNU_to_mb8((int64u (*)[8])W.X, (const int64u* (*))pa_pubx, P256_BITSIZE);
+   ifma_BNU_to_mb8((int64u (*)[8])W.Y, (const int64u* (*))pa_puby, P256_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BNU_to_mb8((int64u (*)[8])W.Z, (const int64u* (*))pa_pubz, P256_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FE256_)(W.Z, (U64*)ones);
+
+   /* lanes with all the pointers defined */
+   __mb_mask active_mask = 0;
+   int buf_no;
+   for(buf_no=0; buf_no<8; buf_no++) {
+      if(pa_table[buf_no] && pa_pubx[buf_no] && pa_puby[buf_no] && (!use_jproj_coords || pa_pubz[buf_no]))
+         active_mask |= (__mb_mask)(1<<buf_no);
+   }
+
+   __mb_mask err_mask = MB_FUNC_NAME(ifma_check_range_p256_)(W.X)
+                      | MB_FUNC_NAME(ifma_check_range_p256_)(W.Y)
+                      | MB_FUNC_NAME(ifma_check_range_p256_)(W.Z);
+
+   /* convert public key coords to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W.X, W.X);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W.Y, W.Y);
+   MB_FUNC_NAME(ifma_tomont52_p256_)(W.Z, W.Z);
+
+   /* the point at infinity and points out of the curve are not accepted */
+   err_mask |= MB_FUNC_NAME(is_zero_point_cordinate_)(W.Z);
+   err_mask |= (__mb_mask)~MB_FUNC_NAME(ifma_is_on_curve_p256_)(&W, use_jproj_coords);
+   err_mask &= active_mask;
+
+   status |= MBX_SET_STS_BY_MASK(status, err_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   active_mask &= (__mb_mask)~err_mask;
+   if(0==active_mask)
+      return status;
+
+   SINGLE_P256_POINT_AFFINE* tbl[8];
+   for(buf_no=0; buf_no<8; buf_no++)
+      tbl[buf_no] = (SINGLE_P256_POINT_AFFINE*)pa_table[buf_no];
+
+   MB_FUNC_NAME(ifma_ec_nistp256_precomp_point_tbl_)(tbl, &W, active_mask);
+   return status;
+}
+
 
 /*
 // OpenSSL's specific implementations
@@ -16,15 +16,31 @@
 
 #include <internal/common/ifma_defs.h>
 #include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
 
 #include <internal/ed25519/ifma_arith_p25519.h>
 #include <internal/ed25519/ifma_arith_ed25519.h>
+
+/* width of the fixed-base comb window, selected at build time */
+#if !defined(MBX_25519_BP_WIN_SIZE) || (MBX_25519_BP_WIN_SIZE==4)
 #include <internal/ed25519/ifma_ed25519_precomp4.h>
+#elif (MBX_25519_BP_WIN_SIZE==5)
+#include <internal/ed25519/ifma_ed25519_precomp5.h>
+#elif (MBX_25519_BP_WIN_SIZE==6)
+#include <internal/ed25519/ifma_ed25519_precomp6.h>
+#elif (MBX_25519_BP_WIN_SIZE==7)
+#include <internal/ed25519/ifma_ed25519_precomp7.h>
+#else
+#error MBX_25519_BP_WIN_SIZE must be 4, 5, 6 or 7
+#endif
 
 #if (_MBX>=_MBX_K1)
 
 #define BP_WIN_SIZE  MUL_BASEPOINT_WIN_SIZE  /* defined in the header above */
 
+/* number of signed digits of the scalar, rounded up to even: the table holds even digit positions only */
+#define BP_N_DIGITS  (2*NUMBER_OF_DIGITS(NUMBER_OF_DIGITS(FE_LEN64*64, BP_WIN_SIZE), 2))
+
 /*
 // Twisted Edwards Curve parameters
 */
@@ -65,6 +81,11 @@ __MBX_INLINE void ge_ext_to_cached_mb(ge52_cached_mb *r, const ge52_ext_mb* p)
    fe52_mul(r->T2d, p->T, (U64*)ed25519_d2);
 }
 
+void ge52_ext_to_cached(ge52_cached_mb* r, const ge52_ext_mb* p)
+{
+   ge_ext_to_cached_mb(r, p);
+}
+
 /*
 // r = p + q
 */
@@ -227,30 +248,12 @@ static void extract_precomputed_basepoint_dual(ge52_precomp_mb* p0,
    idx0 = mask_sub64(idx0, is_neg_idx0, get_zero64(), idx0);
    idx1 = mask_sub64(idx1, is_neg_idx1, get_zero64(), idx1);
 
-   /* select p0, p1 wrt idx0, idx1 indexes */
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(1), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(1), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(2), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(2), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(3), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(3), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(4), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(4), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(5), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(5), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(6), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(6), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(7), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(7), _MM_CMPINT_EQ), tbl);
-   tbl++;
-   ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, set1(8), _MM_CMPINT_EQ), tbl);
-   ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, set1(8), _MM_CMPINT_EQ), tbl);
+   /* select p0, p1 wrt idx0, idx1 indexes, scan whole slot */
+   U64 curr_idx = set1(1);
+   for(int n=0; n<BP_N_ENTRY; n++, tbl++, curr_idx = add64(curr_idx, set1(1))) {
+      ge52_cmov1_precomp_mb(p0, p0, cmp64_mask(idx0, curr_idx, _MM_CMPINT_EQ), tbl);
+      ge52_cmov1_precomp_mb(p1, p1, cmp64_mask(idx1, curr_idx, _MM_CMPINT_EQ), tbl);
+   }
 
    /* adjust for sign */
    fe52_mb neg;
@@ -263,6 +266,16 @@ static void extract_precomputed_basepoint_dual(ge52_precomp_mb* p0,
    fe52_cmov_mb(p1->t2d, p1->t2d, is_neg_idx1, neg);
 }
 
+/* extract BP_WIN_SIZE-bit digit started at the bit position */
+__MBX_INLINE U64 get_bp_digit(const U64 scalar[], int bit)
+{
+   int chunk_no = bit/64;
+   int chunk_shift = bit%64;
+   U64 lo = _mm512_srlv_epi64(scalar[chunk_no], set1((int32u)chunk_shift));
+   U64 hi = _mm512_sllv_epi64(scalar[chunk_no+1], set1((int32u)(64-chunk_shift)));
+   return and64_const(or64(lo, hi), (1<<BP_WIN_SIZE)-1);
+}
+
 /*
 // r = [s]*G
 //
@@ -271,25 +284,15 @@ static void extract_precomputed_basepoint_dual(ge52_precomp_mb* p0,
 //
 // Preconditions:
 //   s[31] <= 127
+//
+// Fixed-base comb: s is recoded into signed digits q[i] over base b=2^BP_WIN_SIZE,
+// table slot k holds {1,2,..,b/2}*b^(2*k)*G, so that even digits are added directly
+// and odd ones are scaled by the single b multiplication at the end.
 */
-
-/* if msb set */
-__MBX_INLINE int32u isMsb_ct(int32u a)
-{ return (int32u)0 - (a >> (sizeof(a) * 8 - 1)); }
-
-/* tests if a==0 */
-__MBX_INLINE int32u isZero(int32u a)
-{ return isMsb_ct(~a & (a - 1)); }
-
-/* tests if a==b */
-__MBX_INLINE int32u isEqu(int32u a, int32u b)
-{ return isZero(a ^ b); }
-
 void ifma_ed25519_mul_basepoint(ge52_ext_mb* r, const U64 scalar[])
 {
-   /* implementation uses scalar representation over base b=16, q[i] are half-bytes */
-   __ALIGN64 ge52_ext_mb r0; /* q[0]*16^0 + q[2]*16^2 + q[4]*16^4 + ...+ q[30]*16^30 */
-   __ALIGN64 ge52_ext_mb r1; /* q[1]*16^1 + q[3]*16^3 + q[5]*16^5 + ...+ q[31]*16^31 */
+   __ALIGN64 ge52_ext_mb r0; /* q[0]*b^0 + q[2]*b^2 + q[4]*b^4 + ... */
+   __ALIGN64 ge52_ext_mb r1; /* q[1]*b^0 + q[3]*b^2 + q[5]*b^4 + ... */
 
    /* point extracted from the pre-computed table */
    __ALIGN64 ge52_precomp_mb h0;
@@ -297,68 +300,55 @@ void ifma_ed25519_mul_basepoint(ge52_ext_mb* r, const U64 scalar[])
 
    /* temporary */
    __ALIGN64 ge52_p1p1_mb t;
-   __ALIGN64 ge52_homo_mb s;
+
+   /* copy of scalar, zero extended to cover all digits */
+   __ALIGN64 U64 s[NUMBER_OF_DIGITS(BP_N_DIGITS*BP_WIN_SIZE, 64) + 1];
+   int n;
+   for(n=0; n<FE_LEN64; n++)
+      s[n] = loadu64(&scalar[n]);
+   for(; n<(int)(sizeof(s)/sizeof(U64)); n++)
+      s[n] = get_zero64();
 
    /* initial values are neutral */
    neutral_ge52_ext_mb(&r0);
    neutral_ge52_ext_mb(&r1);
 
    /* pre-computed basepoint table  */
-   ge52_precomp* tbl = &ifma_ed25519_bp_precomp[0][0];
+   const ge52_precomp* tbl = &ifma_ed25519_bp_precomp[0][0];
 
+   const U64 half = set1(1<<(BP_WIN_SIZE-1));
+   const U64 base = set1(1<<BP_WIN_SIZE);
    __mb_mask carry = 0;    /* used in conversion to signed value */
 
-   for(int n=0; n< FE_LEN64; n++) {
-      /* scalar value*/
-      U64 scalarV = loadu64(&scalar[n]);
-
-      for(int m=0; m<sizeof(int64u); m++) {
-         /* set if last byte processed */
-         __mb_mask last_byte = (__mb_mask)(isEqu((n*sizeof(int64u)+m), FE_LEN64*sizeof(int64u)-1));
+   for(n=0; n<BP_N_DIGITS; n+=2) {
+      /* extract 2 digits */
+      U64 q_even = get_bp_digit(s, n*BP_WIN_SIZE);
+      U64 q_odd  = get_bp_digit(s, (n+1)*BP_WIN_SIZE);
 
-         /* extract 2 half-bytes */
-         U64 q_even = and64_const(scalarV, 0x0f);
-         U64 q_odd  = and64_const(srli64(scalarV, 4), 0x0f);
-         /* to the next byte of scalar value */
-         scalarV = srli64(scalarV, 8);
+      /* convert digits to signed */
+      q_even = mask_add64(q_even, carry, q_even, set1(1));
+      carry = cmp64_mask(half, q_even, _MM_CMPINT_LE);
+      q_even = mask_sub64(q_even, carry, q_even, base);
 
-         /* convert half-bytes to signed */
-         q_even = mask_add64(q_even, carry, q_even, set1(1));
-         carry = cmp64_mask(set1(8), q_even, _MM_CMPINT_LE);
-         q_even = mask_sub64(q_even, carry, q_even, set1(0x10));
+      q_odd = mask_add64(q_odd, carry, q_odd, set1(1));
+      carry = cmp64_mask(half, q_odd, _MM_CMPINT_LE);
+      if(n+2 == BP_N_DIGITS) carry = 0;  /* avoid sign conversion for the last digit */
+      q_odd = mask_sub64(q_odd, carry, q_odd, base);
 
-         q_odd = mask_add64(q_odd, carry, q_odd, set1(1));
-         carry = cmp64_mask(set1(8), q_odd, _MM_CMPINT_LE);
-         carry &= ~last_byte;  /* avoid sign conversion for the last half-byte*/
-         q_odd = mask_sub64(q_odd, carry, q_odd, set1(0x10));
+      /* extract points from the pre-computed table */
+      extract_precomputed_basepoint_dual(&h0, &h1, tbl, q_even, q_odd);
+      tbl += BP_N_ENTRY;
 
-         /* extract points from the pre-computed table */
-         extract_precomputed_basepoint_dual(&h0, &h1, tbl, q_even, q_odd);
-         tbl += BP_N_ENTRY;
+      /* r0 += h0, r1 += h1 */
+      ge52_add_precomp(&t, &r0, &h0);
+      ge52_p1p1_to_ext_mb(&r0, &t);
 
-         /* r0 += h0, r1 += h1 */
-         ge52_add_precomp(&t, &r0, &h0);
-         ge52_p1p1_to_ext_mb(&r0, &t);
-
-         ge52_add_precomp(&t, &r1, &h1);
-         ge52_p1p1_to_ext_mb(&r1, &t);
-      }
+      ge52_add_precomp(&t, &r1, &h1);
+      ge52_p1p1_to_ext_mb(&r1, &t);
    }
 
-   /* r1 = [16]*r1 */
-   ge52_ext_to_homo_mb(&s, &r1);
-
-   ge_dbl(&t, &s);
-   ge52_p1p1_to_homo_mb(&s, &t);
-
-   ge_dbl(&t, &s);
-   ge52_p1p1_to_homo_mb(&s, &t);
-
-   ge_dbl(&t, &s);
-   ge52_p1p1_to_homo_mb(&s, &t);
-
-   ge_dbl(&t, &s);
-   ge52_p1p1_to_ext_mb(&r1, &t);
+   /* r1 = [b]*r1 */
+   ge52_ext_dbl_n(&r1, &r1, BP_WIN_SIZE);
 
    // r = r0 + r1
    __ALIGN64 ge52_cached_mb c;
@@ -366,6 +356,32 @@ void ifma_ed25519_mul_basepoint(ge52_ext_mb* r, const U64 scalar[])
    ge_add(&t, &r1, &c);
 
    ge52_p1p1_to_ext_mb(r, &t);
+
+   /* clear copy of the scalar */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])s, sizeof(s)/sizeof(U64));
+}
+
+/*
+// u = [s]*G in Curve25519 Montgomery form (RFC7748 birational map u = (1+y)/(1-y)),
+// the Ed25519 base point maps to the Curve25519 base point u=9.
+//
+// Preconditions:
+//   s[31] <= 127
+*/
+void ifma_ed25519_mul_basepoint_u(fe52_mb u, const U64 scalar[])
+{
+   __ALIGN64 ge52_ext_mb R;
+   ifma_ed25519_mul_basepoint(&R, scalar);
+
+   /* u = (Z+Y)/(Z-Y) */
+   fe52_mb num, den;
+   fe52_add(num, R.Z, R.Y);
+   fe52_sub(den, R.Z, R.Y);
+   fe52_inv(den, den);
+   fe52_mul(u, num, den);
+   fe52_red(u, u);
+
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
 }
 
 
@@ -540,4 +556,178 @@ void ifma_ed25519_prod_point(ge52_ext_mb* r, const ge52_ext_mb* p, const U64 sca
    ge52_p1p1_to_ext_mb(r, &t);
 }
 
+
+/*
+// Multi-scalar multiplication (bucket method)
+//
+// r = sum [scalar[i]]p[i], i=0,...,num-1
+//
+// Each lane computes the sum over its own points and buckets, the lane results
+// are added at the end, so all lanes of r contain the total sum.
+// scalar[i] are 64-bit digits (the most significant one is zero), bitsize[i]
+// is the upper bound of the scalar[i] lanes bit length. Zero scalars do not contribute.
+// buckets[] is a workspace of ED25519_MSM_MAX_BUCKETS points.
+//
+// Note: it is not a constant time function, it is intended for public data only.
+*/
+
+/* point doubling: r = [2^n]p */
+void ge52_ext_dbl_n(ge52_ext_mb* r, const ge52_ext_mb* p, int n)
+{
+   __ALIGN64 ge52_homo_mb homo;
+   __ALIGN64 ge52_p1p1_mb p1p1;
+
+   ge52_ext_to_homo_mb(&homo, p);
+   for(; n>1; n--) {
+      ge_dbl(&p1p1, &homo);
+      ge52_p1p1_to_homo_mb(&homo, &p1p1);
+   }
+   ge_dbl(&p1p1, &homo);
+   ge52_p1p1_to_ext_mb(r, &p1p1);
+}
+
+/* r = p + q */
+void ge52_ext_add(ge52_ext_mb* r, const ge52_ext_mb* p, const ge52_ext_mb* q)
+{
+   __ALIGN64 ge52_cached_mb cached;
+   __ALIGN64 ge52_p1p1_mb p1p1;
+
+   ge_ext_to_cached_mb(&cached, q);
+   ge_add(&p1p1, p, &cached);
+   ge52_p1p1_to_ext_mb(r, &p1p1);
+}
+
+/* number of U64 in the point */
+#define GE52_EXT_LEN  (int)(sizeof(ge52_ext_mb)/sizeof(U64))
+
+/* buckets[idx] += (sign? -p : p), lanes are selected by mask */
+static void bucket_add(ge52_ext_mb buckets[], U64 idx, __mb_mask sign, __mb_mask mask, const ge52_cached_mb* p)
+{
+   __ALIGN64 ge52_ext_mb b;
+   __ALIGN64 ge52_cached_mb q;
+   __ALIGN64 ge52_p1p1_mb p1p1;
+
+   /* offset of the lane item of the bucket */
+   U64 offset = add64(_mm512_mullo_epi64(idx, set1((int64u)sizeof(ge52_ext_mb))),
+                      _mm512_set_epi64(7*8, 6*8, 5*8, 4*8, 3*8, 2*8, 1*8, 0));
+
+   U64* pb = (U64*)&b;
+   const U64* pbuckets = (const U64*)buckets;
+   int n;
+   for(n=0; n<GE52_EXT_LEN; n++)
+      pb[n] = _mm512_mask_i64gather_epi64(get_zero64(), mask, offset, (const void*)(pbuckets+n), 1);
+
+   /* adjust for sign */
+   q = *p;
+   fe52_mb neg;
+   fe52_neg(neg, q.T2d);
+   fe52_cswap_mb(q.YsubX, sign, q.YaddX);
+   fe52_cmov_mb(q.T2d, q.T2d, sign, neg);
+
+   ge_add(&p1p1, &b, &q);
+   ge52_p1p1_to_ext_mb(&b, &p1p1);
+
+   for(n=0; n<GE52_EXT_LEN; n++)
+      _mm512_mask_i64scatter_epi64((void*)(pbuckets+n), mask, offset, pb[n], 1);
+}
+
+/* window size minimizing the number of point additions */
+static int msm_win_size(const int bitsize[], int num)
+{
+   int maxBits = 0;
+   int i, w, bestW = 2;
+   int64u bestCost = (int64u)(-1);
+
+   for(i=0; i<num; i++)
+      maxBits = (bitsize[i] > maxBits)? bitsize[i] : maxBits;
+
+   for(w=2; w<=ED25519_MSM_MAX_WIN; w++) {
+      int64u cost = (int64u)(maxBits/w + 1) * (int64u)(2 << (w-1)); /* buckets summation */
+      for(i=0; i<num; i++)
+         cost += (int64u)(bitsize[i]/w + 1);                        /* buckets filling */
+      if(cost < bestCost) {
+         bestCost = cost;
+         bestW = w;
+      }
+   }
+   return bestW;
+}
+
+void ifma_ed25519_multi_mul_point(ge52_ext_mb* r, const ge52_cached_mb p[], const U64 scalar[][NE_LEN64+1], const int bitsize[], int num, ge52_ext_mb buckets[])
+{
+   __ALIGN64 ge52_ext_mb acc;
+   __ALIGN64 ge52_ext_mb run;
+   __ALIGN64 ge52_ext_mb sum;
+
+   int w = msm_win_size(bitsize, num);
+   int nBuckets = 1 << (w-1);
+   U64 idx_mask = set1((1 << (w + 1)) - 1);
+
+   int maxBits = 0;
+   int i, b, win;
+   for(i=0; i<num; i++)
+      maxBits = (bitsize[i] > maxBits)? bitsize[i] : maxBits;
+
+   neutral_ge52_ext_mb(&acc);
+
+   /* windows from the most significant one, signed (booth) digits */
+   for(win=maxBits/w; win>=0; win--) {
+      int bit = win*w;
+
+      if(win != maxBits/w)
+         ge52_ext_dbl_n(&acc, &acc, w);
+
+      for(b=0; b<nBuckets; b++)
+         neutral_ge52_ext_mb(&buckets[b]);
+
+      /* fill buckets */
+      for(i=0; i<num; i++) {
+         /* window is above the scalar */
+         if(bit > bitsize[i])
+            continue;
+
+         U64 wvalue;
+         if(0==bit)
+            wvalue = slli64(loadu64(&scalar[i][0]), 1);
+         else {
+            int chunk_no = (bit - 1) / 64;
+            int chunk_shift = (bit - 1) % 64;
+            wvalue = _mm512_shrdv_epi64(loadu64(&scalar[i][chunk_no]), loadu64(&scalar[i][chunk_no + 1]), set1((int64u)chunk_shift));
+         }
+         wvalue = and64(wvalue, idx_mask);
+
+         /* booth recoding */
+         __mb_mask dsign = cmp64_mask(srli64(wvalue, w), get_zero64(), _MM_CMPINT_NE);
+         U64 dvalue = mask_sub64(wvalue, dsign, set1((int64u)(1 << (w + 1)) - 1), wvalue);
+         dvalue = add64(srli64(dvalue, 1), and64_const(dvalue, 1));
+
+         __mb_mask mask = cmp64_mask(dvalue, get_zero64(), _MM_CMPINT_NE);
+         if(mask)
+            bucket_add(buckets, sub64(dvalue, set1(1)), dsign, mask, &p[i]);
+      }
+
+      /* sum = 1*buckets[0] + 2*buckets[1] + ... */
+      neutral_ge52_ext_mb(&run);
+      neutral_ge52_ext_mb(&sum);
+      for(b=nBuckets-1; b>=0; b--) {
+         ge52_ext_add(&run, &run, &buckets[b]);
+         ge52_ext_add(&sum, &sum, &run);
+      }
+
+      ge52_ext_add(&acc, &acc, &sum);
+   }
+
+   /* add lanes together */
+   for(b=4; b>0; b/=2) {
+      U64 lane_idx = and64_const(add64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), set1((int64u)b)), 7);
+      U64* pacc = (U64*)&acc;
+      U64* psum = (U64*)&sum;
+      for(i=0; i<GE52_EXT_LEN; i++)
+         psum[i] = _mm512_permutexvar_epi64(lane_idx, pacc[i]);
+      ge52_ext_add(&acc, &acc, &sum);
+   }
+
+   *r = acc;
+}
+
 #endif /* #if (_MBX>=_MBX_K1) */
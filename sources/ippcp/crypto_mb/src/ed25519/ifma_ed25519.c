@@ -27,6 +27,10 @@
 #include <internal/ed25519/ifma_arith_n25519.h>
 #include <internal/ed25519/sha512.h>
 
+#if !defined(NO_USE_MALLOC)
+#include <stdlib.h>
+#endif
+
 /*
 // Computes public key
 // pa_public_key[]   array of pointers to the public keys X-coordinates
@@ -143,3 +147,68 @@ mbx_status OWNAPI(mbx_ed25519_verify_mb8)(const ed25519_sign_component* const pa
 #endif /* #if (_MBX>=_MBX_K1) */
    return status;
 }
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_ed25519_verify_batch)(const ed25519_sign_component* const pa_sign_r[],
+                                               const ed25519_sign_component* const pa_sign_s[],
+                                               const int8u* const pa_msg[], const int32u msgLen[],
+                                               const ed25519_public_key* const pa_public_key[],
+                                               mbx_status pa_status[], int num)
+{
+   /* test input pointers */
+   if (NULL == pa_sign_r || NULL == pa_sign_s ||
+      NULL == pa_msg || NULL == msgLen ||
+      NULL == pa_public_key)
+      return MBX_STATUS_NULL_PARAM_ERR;
+   if (num <= 0)
+      return MBX_STATUS_MISMATCH_PARAM_ERR;
+
+#if (_MBX>=_MBX_K1)
+   mbx_status status = MBX_STATUS_OK;
+   int numGroups = MIN((num + 7) / 8, ED25519_BATCH_MAX_GROUPS);
+   int8u* buffer = NULL;
+
+   #if !defined(NO_USE_MALLOC)
+   buffer = (int8u*)( malloc(ed25519_verify_batch_buffsize(numGroups)) );
+   #endif
+
+   if (buffer) {
+      status = internal_avx512_ed25519_verify_batch(pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key, pa_status, num, buffer, numGroups);
+   }
+   /* no workspace, verify signatures one by one */
+   else {
+      for (int idx = 0; idx < num; idx += 8) {
+         const ed25519_sign_component* sign_r[8] = { NULL };
+         const ed25519_sign_component* sign_s[8] = { NULL };
+         const int8u* msg[8] = { NULL };
+         int32u mlen[8] = { 0 };
+         const ed25519_public_key* public_key[8] = { NULL };
+
+         for (int n = 0; n < 8 && idx + n < num; n++) {
+            sign_r[n] = pa_sign_r[idx + n];
+            sign_s[n] = pa_sign_s[idx + n];
+            msg[n] = pa_msg[idx + n];
+            mlen[n] = msgLen[idx + n];
+            public_key[n] = pa_public_key[idx + n];
+         }
+
+         mbx_status sts = OWNAPI(mbx_ed25519_verify_mb8)(sign_r, sign_s, msg, mlen, public_key);
+         for (int n = 0; n < 8 && idx + n < num; n++) {
+            if (MBX_GET_STS(sts, n))
+               status = MBX_STATUS_SIGNATURE_ERR;
+         }
+         if (pa_status)
+            pa_status[idx / 8] = sts;
+      }
+   }
+
+   #if !defined(NO_USE_MALLOC)
+   free(buffer);
+   #endif
+
+   return status;
+#else
+   MBX_UNREFERENCED_PARAMETER(pa_status);
+   return MBX_STATUS_UNSUPPORTED_ISA_ERR;
+#endif /* #if (_MBX>=_MBX_K1) */
+}
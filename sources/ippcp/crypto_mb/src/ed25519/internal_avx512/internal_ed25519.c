@@ -35,11 +35,15 @@
 
 void ed25519_expand_key(int8u* pa_secret_expand[8], const ed25519_private_key* const pa_secret_key[8])
 {
-   /* do hash of secret keys in sequence */
+   int32u keyLen[8];
+   for (int n = 0; n < 8; n++)
+      keyLen[n] = pa_secret_key[n] ? (int32u)sizeof(ed25519_private_key) : 0;
+
+   /* do hash of secret keys in parallel */
+   SHA512MsgDigest_mb8((const int8u**)pa_secret_key, keyLen, pa_secret_expand);
+
    for (int n = 0; n < 8; n++) {
-      const ed25519_private_key* psecret = pa_secret_key[n];
-      if (psecret) {
-          SHA512MsgDigest(*psecret, sizeof(ed25519_private_key), pa_secret_expand[n]);
+      if (pa_secret_key[n]) {
          /* prune the buffer according to RFC8032 */
          pa_secret_expand[n][0]  &= 0xf8;
          pa_secret_expand[n][31] &= 0x7f;
@@ -97,41 +101,33 @@ mbx_status internal_avx512_ed25519_public_key_mb8(ed25519_public_key* pa_public_
 */
 static void ed25519_nonce(int8u* pa_nonce[8], int8u* pa_az[8], const int8u* const pa_msg[8], const int32u msgLen[8])
 {
-   SHA512State pState;
-
-   for(int n=0; n<8; n++) {
-      int8u* az = pa_az[n] + HASH_LENGTH/2;
-      const int8u* msg = pa_msg[n];
-      int32u mlen = msgLen[n];
-      
-      SHA512Init(&pState);
-      SHA512Update(az, 32, &pState);
-      if (msg)
-          SHA512Update(msg, mlen, &pState);
-      
-      SHA512Final(pa_nonce[n], &pState);
+   SHA512State_mb8 state;
+
+   const int8u* pa_az_hi[8];
+   int32u azLen[8];
+   for (int n = 0; n < 8; n++) {
+      pa_az_hi[n] = pa_az[n] + HASH_LENGTH/2;
+      azLen[n] = 32;
    }
+
+   SHA512Init_mb8(&state);
+   SHA512Update_mb8(pa_az_hi, azLen, &state);
+   SHA512Update_mb8(pa_msg, msgLen, &state);
+   SHA512Final_mb8(pa_nonce, &state);
 }
 
 static void ed25519_hash_r_pub_msg(int8u* pa_hram[8], const ed25519_sign_component* const pa_sign_r[], const ed25519_public_key* const pa_public_key[8], const int8u* const pa_msg[8], const int32u msgLen[8])
 {
-   SHA512State pState;
+   SHA512State_mb8 state;
 
-   for (int n = 0; n < 8; n++) {
-      const ed25519_sign_component* sign_r = pa_sign_r[n];
-      const ed25519_public_key* public = pa_public_key[n];
-      const int8u* msg = pa_msg[n];
-      int32u mlen = msgLen[n];
-      SHA512Init(&pState);
-
-      if(sign_r)
-          SHA512Update((const int8u*)sign_r, NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8), &pState);
-      if(public)
-          SHA512Update((const int8u*)public, sizeof(ed25519_public_key), &pState);
-      if(msg)
-          SHA512Update(msg, mlen, &pState);
-      SHA512Final(pa_hram[n], &pState);
-   }
+   const int32u signRLen[8] = { REP8_DECL(NUMBER_OF_DIGITS(GE25519_COMP_BITSIZE, 8)) };
+   const int32u publicLen[8] = { REP8_DECL(sizeof(ed25519_public_key)) };
+
+   SHA512Init_mb8(&state);
+   SHA512Update_mb8((const int8u**)pa_sign_r, signRLen, &state);
+   SHA512Update_mb8((const int8u**)pa_public_key, publicLen, &state);
+   SHA512Update_mb8(pa_msg, msgLen, &state);
+   SHA512Final_mb8(pa_hram, &state);
 }
 
 mbx_status MB_FUNC_NAME(internal_avx512_ed25519_sign_)(ed25519_sign_component* pa_sign_r[8],
@@ -303,4 +299,285 @@ mbx_status MB_FUNC_NAME(internal_avx512_ed25519_verify_)(const ed25519_sign_comp
    return status;
 }
 
+/*
+// Batch verification
+//
+// The signatures are checked all together by the single equation
+//    [8]([sum z_i*s_i]G - sum [z_i]R_i - sum [z_i*h_i]A_i) == O,
+// where h_i = SHA512(R_i || A_i || M_i) and z_i are 128-bit randomizers. z_i are derived
+// by hashing all (h_i, s_i) of the batch, so they cannot be chosen before the signatures.
+// R_i and A_i are spread over the lanes (8 signatures per group), so the multi-scalar
+// multiplication is done by the 8 lanes in parallel.
+//
+// Note: the batch equation is cofactored, a signature with R or A having small order
+// component may pass the batch although mbx_ed25519_verify_mb8() rejects it.
+*/
+int ed25519_verify_batch_buffsize(int numGroups)
+{
+   return (int)sizeof(ge52_ext_mb) * ED25519_MSM_MAX_BUCKETS
+        + numGroups * (int)(2*sizeof(ge52_cached_mb)        /* -R, -A points */
+                          + 2*sizeof(U64)*(NE_LEN64+1)       /* their scalars */
+                          + 2*sizeof(U64)*NE_LEN52           /* h, s */
+                          + 2*sizeof(int)                    /* scalars bitsize */
+                          + sizeof(mbx_status))              /* statuses */
+        + 64;                                                /* alignment */
+}
+
+/* ed25519 signature group input */
+typedef struct {
+   const ed25519_sign_component* sign_r[8];
+   const ed25519_sign_component* sign_s[8];
+   const int8u* msg[8];
+   int32u msgLen[8];
+   const ed25519_public_key* public_key[8];
+} ed25519_sign_group;
+
+/* group of signatures sign[idx, idx+8), lanes out of num and lanes with NULL parameters are reported */
+static mbx_status ed25519_get_group(ed25519_sign_group* g, int idx, int num,
+                                    const ed25519_sign_component* const pa_sign_r[],
+                                    const ed25519_sign_component* const pa_sign_s[],
+                                    const int8u* const pa_msg[], const int32u msgLen[],
+                                    const ed25519_public_key* const pa_public_key[])
+{
+   mbx_status status = 0;
+   for (int n = 0; n < 8; n++) {
+      int i = idx + n;
+      int in = (i < num);
+      g->sign_r[n]     = in ? pa_sign_r[i] : NULL;
+      g->sign_s[n]     = in ? pa_sign_s[i] : NULL;
+      g->msg[n]        = in ? pa_msg[i] : NULL;
+      g->msgLen[n]     = in ? msgLen[i] : 0;
+      g->public_key[n] = in ? pa_public_key[i] : NULL;
+
+      if (NULL == g->sign_r[n] || NULL == g->sign_s[n] || NULL == g->msg[n] || NULL == g->public_key[n])
+         status = MBX_SET_STS(status, n, MBX_STATUS_NULL_PARAM_ERR);
+   }
+   return status;
+}
+
+static int ed25519_verify_batch_chunk(const ed25519_sign_component* const pa_sign_r[],
+                                      const ed25519_sign_component* const pa_sign_s[],
+                                      const int8u* const pa_msg[], const int32u msgLen[],
+                                      const ed25519_public_key* const pa_public_key[],
+                                      mbx_status pa_status[], int num, int8u* pBuffer)
+{
+   int numGroups = (num + 7) / 8;
+   int grp, n;
+
+   /* workspace */
+   ge52_ext_mb* buckets = (ge52_ext_mb*)IFMA_ALIGNED_PTR(pBuffer, 64);
+   ge52_cached_mb* points = (ge52_cached_mb*)(buckets + ED25519_MSM_MAX_BUCKETS);
+   U64 (*scalars)[NE_LEN64+1] = (U64 (*)[NE_LEN64+1])(points + 2*numGroups);
+   U64 (*h52)[NE_LEN52] = (U64 (*)[NE_LEN52])(scalars + 2*numGroups);
+   U64 (*s52)[NE_LEN52] = h52 + numGroups;
+   int* bitsize = (int*)(s52 + numGroups);
+   mbx_status* sts = (mbx_status*)(bitsize + 2*numGroups);
+
+   const int32u hashLen[8] = { REP8_DECL(HASH_LENGTH) };
+   const int32u signLen[8] = { REP8_DECL(sizeof(ed25519_sign_component)) };
+
+   /* randomizers seed, lane n hashes (h, s) of the signatures idx%8==n */
+   __ALIGN64 SHA512State_mb8 seedState;
+   SHA512Init_mb8(&seedState);
+
+   /*
+   // decompress points, compute h_i
+   */
+   for (grp = 0; grp < numGroups; grp++) {
+      ed25519_sign_group g;
+      mbx_status status = ed25519_get_group(&g, grp*8, num, pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key);
+
+      /* h = SHA512(sign_r || public_key || msg) */
+      __ALIGN64 int8u h[8][HASH_LENGTH] = { 0 };
+      int8u* pa_h[8] = { h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7] };
+      ed25519_hash_r_pub_msg(pa_h, g.sign_r, g.public_key, g.msg, g.msgLen);
+
+      SHA512Update_mb8((const int8u**)pa_h, hashLen, &seedState);
+      SHA512Update_mb8((const int8u**)g.sign_s, signLen, &seedState);
+
+      /* reduce h %= n */
+      __ALIGN64 U64 h_mb[NUMBER_OF_DIGITS(SHA512_HASH_BITLENGTH, DIGIT_SIZE)];
+      ifma_BNU_to_mb8((int64u(*)[8])h_mb, (const int64u**)pa_h, SHA512_HASH_BITLENGTH);
+      ifma52_ed25519n_reduce(h52[grp], h_mb);
+
+      /* check that s<n */
+      __ALIGN64 U64 s_mb[NE_LEN64];
+      ifma_BNU_transpose_copy((int64u(*)[8])s_mb, (const int64u**)g.sign_s, 256);
+      U64* n_mb = (U64*)ed25519n_mb64;
+      __mb_mask k = 0;
+      for (n = NE_LEN64; n > 0; n--) {
+         k |= cmp64_mask(n_mb[n - 1], s_mb[n - 1], _MM_CMPINT_NLE);
+      }
+      status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_MISMATCH_PARAM_ERR);
+      ifma_BNU_to_mb8((int64u(*)[8])s52[grp], (const int64u**)g.sign_s, 256);
+
+      /* -A */
+      __ALIGN64 fe52_mb fe_mb;
+      __ALIGN64 ge52_ext_mb P_mb;
+      ifma_BNU_to_mb8((int64u(*)[8])fe_mb, (const int64u**)g.public_key, P25519_BITSIZE + 1);
+      k = ge52_ext_decompress(&P_mb, fe_mb);
+      status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_SIGNATURE_ERR);
+      fe52_neg(P_mb.X, P_mb.X);
+      fe52_neg(P_mb.T, P_mb.T);
+      ge52_ext_to_cached(&points[2*grp+1], &P_mb);
+
+      /* -R, r-component has to be canonical encoding of the point (as it is compared in mbx_ed25519_verify_mb8) */
+      ifma_BNU_to_mb8((int64u(*)[8])fe_mb, (const int64u**)g.sign_r, GE25519_COMP_BITSIZE);
+      k = ge52_ext_decompress(&P_mb, fe_mb);
+      {
+         __ALIGN64 fe52_mb y, t;
+         fe52_copy_mb(y, fe_mb);
+         y[FE_LEN52-1] = and64_const(y[FE_LEN52-1], PRIME25519_HI);
+         fe52_red(t, y);
+         k &= fe52_mb_is_equ(t, y);    /* y < p */
+         fe52_red(t, P_mb.X);
+         k &= ~(fe52_mb_is_zero(t) & cmp64_mask(srli64(fe_mb[FE_LEN52-1], (GE25519_COMP_BITSIZE-1) % DIGIT_SIZE), get_zero64(), _MM_CMPINT_NE));  /* not "-0" */
+      }
+      status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_SIGNATURE_ERR);
+      fe52_neg(P_mb.X, P_mb.X);
+      fe52_neg(P_mb.T, P_mb.T);
+      ge52_ext_to_cached(&points[2*grp], &P_mb);
+
+      sts[grp] = status;
+   }
+
+   /* seed = SHA512(lane digests) */
+   __ALIGN64 int8u seed[8][HASH_LENGTH];
+   int8u* pa_seed[8] = { seed[0], seed[1], seed[2], seed[3], seed[4], seed[5], seed[6], seed[7] };
+   SHA512Final_mb8(pa_seed, &seedState);
+   SHA512MsgDigest(seed[0], sizeof(seed), seed[0]);
+
+   /*
+   // scalars: z_i for -R_i and z_i*h_i for -A_i, accumulate sum z_i*s_i
+   */
+   __ALIGN64 U64 zs_mb[NE_LEN52];
+   __ALIGN64 U64 zero_mb[NE_LEN52];
+   fe52_0_mb(zs_mb);
+   fe52_0_mb(zero_mb);
+
+   for (grp = 0; grp < numGroups; grp++) {
+      /* z_i = SHA512(seed || i) mod 2^128 */
+      __ALIGN64 int8u zinp[8][HASH_LENGTH + sizeof(int32u)];
+      __ALIGN64 int8u z[8][HASH_LENGTH];
+      const int8u* pa_zinp[8] = { zinp[0], zinp[1], zinp[2], zinp[3], zinp[4], zinp[5], zinp[6], zinp[7] };
+      int8u* pa_z[8] = { z[0], z[1], z[2], z[3], z[4], z[5], z[6], z[7] };
+      const int32u zinpLen[8] = { REP8_DECL(sizeof(zinp[0])) };
+
+      for (n = 0; n < 8; n++) {
+         int32u idx = (int32u)(grp*8 + n);
+         for (int b = 0; b < HASH_LENGTH; b++)
+            zinp[n][b] = seed[0][b];
+         zinp[n][HASH_LENGTH+0] = (int8u)(idx);
+         zinp[n][HASH_LENGTH+1] = (int8u)(idx >> 8);
+         zinp[n][HASH_LENGTH+2] = (int8u)(idx >> 16);
+         zinp[n][HASH_LENGTH+3] = (int8u)(idx >> 24);
+      }
+      SHA512MsgDigest_mb8(pa_zinp, zinpLen, pa_z);
+
+      /* signatures failed the preliminary checks are excluded */
+      for (n = 0; n < 8; n++) {
+         if (MBX_GET_STS(sts[grp], n))
+            pa_z[n] = NULL;
+      }
+
+      __ALIGN64 U64 z_mb[NE_LEN52];
+      fe52_0_mb(z_mb);
+      ifma_BNU_to_mb8((int64u(*)[8])z_mb, (const int64u**)pa_z, 128);
+
+      /* scalar of -R_i */
+      ifma_BNU_transpose_copy((int64u(*)[8])scalars[2*grp], (const int64u**)pa_z, 128);
+      for (n = 2; n < NE_LEN64+1; n++)
+         scalars[2*grp][n] = get_zero64();
+      bitsize[2*grp] = 128;
+
+      /* scalar of -A_i */
+      __ALIGN64 U64 zh_mb[NE_LEN52];
+      ifma52_ed25519n_madd(zh_mb, z_mb, h52[grp], zero_mb);
+      fe52_to_fe64_mb(scalars[2*grp+1], zh_mb);
+      scalars[2*grp+1][NE_LEN64] = get_zero64();
+      bitsize[2*grp+1] = N25519_BITSIZE;
+
+      /* zs += z_i*s_i */
+      ifma52_ed25519n_madd(zs_mb, z_mb, s52[grp], zs_mb);
+   }
+
+   /*
+   // check the batch equation
+   */
+   __ALIGN64 ge52_ext_mb R_mb;
+   ifma_ed25519_multi_mul_point(&R_mb, points, (const U64 (*)[NE_LEN64+1])scalars, bitsize, 2*numGroups, buckets);
+
+   /* add lanes of zs together */
+   {
+      __ALIGN64 U64 one_mb[NE_LEN52];
+      __ALIGN64 U64 t_mb[NE_LEN52];
+      fe52_1_mb(one_mb);
+      for (int shift = 4; shift > 0; shift /= 2) {
+         U64 lane_idx = and64_const(add64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), set1((int64u)shift)), 7);
+         for (n = 0; n < NE_LEN52; n++)
+            t_mb[n] = _mm512_permutexvar_epi64(lane_idx, zs_mb[n]);
+         ifma52_ed25519n_madd(zs_mb, t_mb, one_mb, zs_mb);
+      }
+   }
+
+   /* R += [zs]G */
+   {
+      __ALIGN64 U64 zs64_mb[FE_LEN64];
+      __ALIGN64 ge52_ext_mb G_mb;
+      fe52_to_fe64_mb(zs64_mb, zs_mb);
+      ifma_ed25519_mul_basepoint(&G_mb, zs64_mb);
+      ge52_ext_add(&R_mb, &R_mb, &G_mb);
+   }
+
+   /* [8]R == O ? (all lanes are the same) */
+   ge52_ext_dbl_n(&R_mb, &R_mb, 3);
+   __ALIGN64 fe52_mb checkR_mb;
+   __ALIGN64 fe52_mb neutral_mb;
+   ge52_ext_compress(checkR_mb, &R_mb);
+   fe52_1_mb(neutral_mb);
+   int batchValid = 1 & fe52_mb_is_equ(checkR_mb, neutral_mb);
+
+   /*
+   // statuses, verify signatures one by one if the batch failed
+   */
+   int allValid = 1;
+   for (grp = 0; grp < numGroups; grp++) {
+      mbx_status status = sts[grp];
+
+      if (!batchValid && pa_status) {
+         ed25519_sign_group g;
+         status = ed25519_get_group(&g, grp*8, num, pa_sign_r, pa_sign_s, pa_msg, msgLen, pa_public_key);
+         status |= MB_FUNC_NAME(internal_avx512_ed25519_verify_)(g.sign_r, g.sign_s, g.msg, g.msgLen, g.public_key);
+      }
+
+      for (n = 0; n < 8 && (grp*8 + n) < num; n++)
+         allValid &= (MBX_STATUS_OK == MBX_GET_STS(status, n));
+
+      if (pa_status)
+         pa_status[grp] = status;
+   }
+
+   /* statuses are exact if the signatures were verified one by one */
+   return (batchValid || pa_status) ? allValid : 0;
+}
+
+mbx_status internal_avx512_ed25519_verify_batch(const ed25519_sign_component* const pa_sign_r[],
+                                                const ed25519_sign_component* const pa_sign_s[],
+                                                const int8u* const pa_msg[], const int32u msgLen[],
+                                                const ed25519_public_key* const pa_public_key[],
+                                                mbx_status pa_status[], int num,
+                                                int8u* pBuffer, int numGroups)
+{
+   int valid = 1;
+
+   /* process the batch by chunks of numGroups*8 signatures */
+   for (int idx = 0; idx < num; idx += numGroups*8) {
+      int chunkLen = MIN(num - idx, numGroups*8);
+      valid &= ed25519_verify_batch_chunk(pa_sign_r + idx, pa_sign_s + idx, pa_msg + idx, msgLen + idx, pa_public_key + idx,
+                                          pa_status ? pa_status + idx/8 : NULL, chunkLen, pBuffer);
+   }
+
+   return valid ? MBX_STATUS_OK : MBX_STATUS_SIGNATURE_ERR;
+}
+
 #endif /* #if (_MBX>=_MBX_K1) */
\ No newline at end of file
@@ -0,0 +1,260 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/ed25519/sha512.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/mem_fns.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* change endian of each 64-bit word */
+static __ALIGN64 const int8u swapBytes64[] = { 7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+                                               7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+                                               7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8,
+                                               7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8 };
+
+#define SIMD_ENDIANNESS64(x)  _mm512_shuffle_epi8((x), _mm512_load_si512(swapBytes64))
+
+/*
+// SHA512 Specific Macros (8 lanes)
+*/
+#define XOR3_MB8(x,y,z)  _mm512_ternarylogic_epi64((x),(y),(z),0x96)
+#define CH_MB8(x,y,z)    _mm512_ternarylogic_epi64((x),(y),(z),0xCA)
+#define MAJ_MB8(x,y,z)   _mm512_ternarylogic_epi64((x),(y),(z),0xE8)
+
+#define SUM0_MB8(x)   XOR3_MB8(_mm512_ror_epi64((x),28), _mm512_ror_epi64((x),34), _mm512_ror_epi64((x),39))
+#define SUM1_MB8(x)   XOR3_MB8(_mm512_ror_epi64((x),14), _mm512_ror_epi64((x),18), _mm512_ror_epi64((x),41))
+
+#define SIG0_MB8(x)   XOR3_MB8(_mm512_ror_epi64((x), 1), _mm512_ror_epi64((x), 8), _mm512_srli_epi64((x), 7))
+#define SIG1_MB8(x)   XOR3_MB8(_mm512_ror_epi64((x),19), _mm512_ror_epi64((x),61), _mm512_srli_epi64((x), 6))
+
+#define SHA512_UPDATE_MB8(i) \
+   (W[i&15] = _mm512_add_epi64(_mm512_add_epi64(W[i&15], SIG1_MB8(W[(i+14)&15])), _mm512_add_epi64(W[(i+9)&15], SIG0_MB8(W[(i+1)&15]))))
+
+#define SHA512_STEP_MB8(i,j) \
+   v[(7-i)&7] = _mm512_add_epi64(_mm512_add_epi64(v[(7-i)&7], (j ? SHA512_UPDATE_MB8(i) : W[i&15])),                \
+                                 _mm512_add_epi64(_mm512_add_epi64(_mm512_set1_epi64((long long)sha512_cnt[i+j]),     \
+                                                                   SUM1_MB8(v[(4-i)&7])),                             \
+                                                  CH_MB8(v[(4-i)&7], v[(5-i)&7], v[(6-i)&7])));                       \
+   v[(3-i)&7] = _mm512_add_epi64(v[(3-i)&7], v[(7-i)&7]);                                                             \
+   v[(7-i)&7] = _mm512_add_epi64(v[(7-i)&7], _mm512_add_epi64(SUM0_MB8(v[(0-i)&7]), MAJ_MB8(v[(0-i)&7], v[(1-i)&7], v[(2-i)&7])))
+
+/*
+// Updates hash by the 8 independent streams of blocks.
+// len[n] (a multiple of MBS_SHA512) bytes of the n-th stream are processed,
+// hash of the lanes with len[n]==0 is not changed.
+*/
+void sha512_avx512_mb8(sha512_hash_mb8 hash, const int8u* const pa_msg[8], const int len[8])
+{
+   /* data of the not processed lanes are loaded from the zero block */
+   __ALIGN64 int8u zero_block[MBS_SHA512] = { 0 };
+   __ALIGN64 const int8u* loc_data[SHA512_NUM_BUFFERS8];
+
+   __m256i loc_len = _mm256_loadu_si256((__m256i*)len);
+   __mmask8 mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+
+   _mm512_store_si512(loc_data, _mm512_mask_loadu_epi64(_mm512_set1_epi64((long long)zero_block), mb_mask, pa_msg));
+
+   __m512i H[8];
+   __m512i W[16];
+   __m512i v[8];
+   int i, j;
+
+   for (i = 0; i < 8; i++)
+      H[i] = _mm512_load_si512(hash[i]);
+
+   while (mb_mask) {
+      /* load and transpose the message block (remember about endian) */
+      for (i = 0; i < SHA512_NUM_BUFFERS8; i++) {
+         W[i]   = _mm512_loadu_si512(loc_data[i]);
+         W[i+8] = _mm512_loadu_si512(loc_data[i] + MBS_SHA512/2);
+      }
+      TRANSPOSE_8xI64x8(W[0], W[1], W[2],  W[3],  W[4],  W[5],  W[6],  W[7]);
+      TRANSPOSE_8xI64x8(W[8], W[9], W[10], W[11], W[12], W[13], W[14], W[15]);
+      for (i = 0; i < 16; i++)
+         W[i] = SIMD_ENDIANNESS64(W[i]);
+
+      for (i = 0; i < 8; i++)
+         v[i] = H[i];
+
+      /* compression function */
+      for (j = 0; j < 80; j += 16) {
+         SHA512_STEP_MB8(0, j);
+         SHA512_STEP_MB8(1, j);
+         SHA512_STEP_MB8(2, j);
+         SHA512_STEP_MB8(3, j);
+         SHA512_STEP_MB8(4, j);
+         SHA512_STEP_MB8(5, j);
+         SHA512_STEP_MB8(6, j);
+         SHA512_STEP_MB8(7, j);
+         SHA512_STEP_MB8(8, j);
+         SHA512_STEP_MB8(9, j);
+         SHA512_STEP_MB8(10, j);
+         SHA512_STEP_MB8(11, j);
+         SHA512_STEP_MB8(12, j);
+         SHA512_STEP_MB8(13, j);
+         SHA512_STEP_MB8(14, j);
+         SHA512_STEP_MB8(15, j);
+      }
+
+      /* update hash of the processed lanes */
+      for (i = 0; i < 8; i++)
+         H[i] = _mm512_mask_add_epi64(H[i], mb_mask, H[i], v[i]);
+
+      /* update pointers to data, local lengths and mask */
+      _mm512_store_si512(loc_data, _mm512_mask_add_epi64(_mm512_load_si512(loc_data), mb_mask, _mm512_load_si512(loc_data), _mm512_set1_epi64(MBS_SHA512)));
+      loc_len = _mm256_mask_sub_epi32(loc_len, mb_mask, loc_len, _mm256_set1_epi32(MBS_SHA512));
+      mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+   }
+
+   for (i = 0; i < 8; i++)
+      _mm512_store_si512(hash[i], H[i]);
+}
+
+void SHA512Init_mb8(SHA512State_mb8* pState)
+{
+   int i;
+   for (i = 0; i < SHA512_NUM_BUFFERS8; i++) {
+      /* message buffer is free, zeros message length */
+      pState->msgBuffIdx[i] = 0;
+      pState->msgLen[i] = 0;
+   }
+   /* setup initial digest */
+   for (i = 0; i < 8; i++)
+      _mm512_store_si512(pState->msgHash[i], _mm512_set1_epi64((long long)sha512_iv[i]));
+}
+
+void SHA512Update_mb8(const int8u* const pa_src[8], const int32u len[8], SHA512State_mb8* pState)
+{
+   __ALIGN64 const int8u* loc_src[SHA512_NUM_BUFFERS8];
+   __ALIGN64 const int8u* loc_buff[SHA512_NUM_BUFFERS8];
+   __ALIGN64 int loc_len[SHA512_NUM_BUFFERS8];
+   __ALIGN64 int proc_len[SHA512_NUM_BUFFERS8];
+   int bufferFull = 0;
+   int mainPart = 0;
+   int n;
+
+   for (n = 0; n < SHA512_NUM_BUFFERS8; n++) {
+      int idx = pState->msgBuffIdx[n];
+
+      loc_src[n] = pa_src[n];
+      loc_len[n] = pa_src[n] ? (int)len[n] : 0;
+      loc_buff[n] = pState->msgBuffer[n];
+      proc_len[n] = 0;
+
+      pState->msgLen[n] += (int64u)loc_len[n];
+
+      /* if non empty internal buffer filling */
+      if (idx && loc_len[n]) {
+         /* copy from input stream to the internal buffer as match as possible */
+         int procLen = MIN(loc_len[n], (MBS_SHA512 - idx));
+         CopyBlock(loc_src[n], pState->msgBuffer[n] + idx, procLen);
+
+         loc_src[n] += procLen;
+         loc_len[n] -= procLen;
+         idx += procLen;
+
+         /* update digest if buffer full */
+         if (MBS_SHA512 == idx) {
+            proc_len[n] = MBS_SHA512;
+            bufferFull = 1;
+            idx = 0;
+         }
+         pState->msgBuffIdx[n] = idx;
+      }
+   }
+
+   if (bufferFull)
+      sha512_avx512_mb8(pState->msgHash, loc_buff, proc_len);
+
+   /* main message part processing */
+   for (n = 0; n < SHA512_NUM_BUFFERS8; n++) {
+      proc_len[n] = loc_len[n] & ~(MBS_SHA512 - 1);
+      mainPart |= proc_len[n];
+   }
+
+   if (mainPart)
+      sha512_avx512_mb8(pState->msgHash, loc_src, proc_len);
+
+   /* store rest of message into the internal buffer */
+   for (n = 0; n < SHA512_NUM_BUFFERS8; n++) {
+      int restLen = loc_len[n] - proc_len[n];
+      if (restLen) {
+         CopyBlock(loc_src[n] + proc_len[n], pState->msgBuffer[n] + pState->msgBuffIdx[n], restLen);
+         pState->msgBuffIdx[n] += restLen;
+      }
+   }
+}
+
+void SHA512Final_mb8(int8u* const pa_md[8], SHA512State_mb8* pState)
+{
+   /* local buffers and their length */
+   __ALIGN64 int8u buffer[SHA512_NUM_BUFFERS8][MBS_SHA512 * 2];
+   __ALIGN64 const int8u* pa_buffer[SHA512_NUM_BUFFERS8];
+   __ALIGN64 int bufferLen[SHA512_NUM_BUFFERS8];
+   int n;
+
+   for (n = 0; n < SHA512_NUM_BUFFERS8; n++) {
+      int inpLen = pState->msgBuffIdx[n];
+      int64u lenLo = pState->msgLen[n];
+
+      bufferLen[n] = inpLen < (MBS_SHA512 - (int)MLR_SHA512) ? MBS_SHA512 : MBS_SHA512 * 2;
+      pa_buffer[n] = buffer[n];
+
+      /* copy rest of message into internal buffer */
+      CopyBlock(pState->msgBuffer[n], buffer[n], inpLen);
+
+      /* pad message */
+      buffer[n][inpLen++] = 0x80;
+      PadBlock(0, buffer[n] + inpLen, (int)(bufferLen[n] - inpLen - (int)MLR_SHA512));
+
+      /* message length representation */
+      ((int64u*)(buffer[n] + bufferLen[n]))[-2] = ENDIANNESS64(LSR64(lenLo, 64 - 3));
+      ((int64u*)(buffer[n] + bufferLen[n]))[-1] = ENDIANNESS64(LSL64(lenLo, 3));
+   }
+
+   /* copmplete hash computation */
+   sha512_avx512_mb8(pState->msgHash, pa_buffer, bufferLen);
+
+   /* convert hash into big endian and transpose it back to the lanes */
+   __m512i T[8];
+   for (n = 0; n < 8; n++)
+      T[n] = SIMD_ENDIANNESS64(_mm512_load_si512(pState->msgHash[n]));
+   TRANSPOSE_8xI64x8(T[0], T[1], T[2], T[3], T[4], T[5], T[6], T[7]);
+
+   for (n = 0; n < SHA512_NUM_BUFFERS8; n++) {
+      if (pa_md[n])
+         _mm512_storeu_si512(pa_md[n], T[n]);
+   }
+
+   /* clear the rest of message (it may contain secret data) */
+   PadBlock(0, buffer, sizeof(buffer));
+   PadBlock(0, pState->msgBuffer, sizeof(pState->msgBuffer));
+
+   /* re-init hash value */
+   SHA512Init_mb8(pState);
+}
+
+void SHA512MsgDigest_mb8(const int8u* const pa_msg[8], const int32u len[8], int8u* const pa_md[8])
+{
+   SHA512State_mb8 state;
+
+   SHA512Init_mb8(&state);
+   SHA512Update_mb8(pa_msg, len, &state);
+   SHA512Final_mb8(pa_md, &state);
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
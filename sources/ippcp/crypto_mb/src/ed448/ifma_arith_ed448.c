@@ -0,0 +1,282 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ed448/ifma_arith_ed448.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// Ed448 is untwisted Edwards curve x^2 + y^2 = 1 + d*x^2*y^2 over GF(p448),
+// the addition formulas (RFC 8032, 5.2.4) are complete, so neutral and equal
+// points need no special processing.
+*/
+
+/* d = -39081 (Montgomery domain) */
+__ALIGN64 static const int64u ed448_d_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000ffff6756fffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x0006756ffffeffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x00000000ffffffff) }
+};
+
+/* base point (Montgomery domain) */
+__ALIGN64 static const int64u ed448_gx_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000b17aa38342068) },
+   { REP8_DECL(0x0004f8fe6d35bf93) },
+   { REP8_DECL(0x000b765fab7bc291) },
+   { REP8_DECL(0x000e9b28e44cd37a) },
+   { REP8_DECL(0x00086a834f3952a7) },
+   { REP8_DECL(0x000eb444d6fb9be8) },
+   { REP8_DECL(0x000b9ee96c7295e6) },
+   { REP8_DECL(0x0006d16ef0905d88) },
+   { REP8_DECL(0x000000005f0ea883) }
+};
+__ALIGN64 static const int64u ed448_gy_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x00079a99632d81f4) },
+   { REP8_DECL(0x00023c2104ac119c) },
+   { REP8_DECL(0x000fc5486da8e9ac) },
+   { REP8_DECL(0x00098abb416ef259) },
+   { REP8_DECL(0x000325146ff4948a) },
+   { REP8_DECL(0x0004714fa9dd0122) },
+   { REP8_DECL(0x00050a1f0e6acaf9) },
+   { REP8_DECL(0x000765f7687a33ab) },
+   { REP8_DECL(0x00000000fba18417) }
+};
+
+/* r = p + q */
+void ge448_homo_add(ge448_homo_mb* r, const ge448_homo_mb* p, const ge448_homo_mb* q)
+{
+   fe448_mb A, B, C, D, E, F, G, H;
+
+   fe448_mul(A, p->Z, q->Z);        /* A = Z1*Z2 */
+   fe448_sqr(B, A);                 /* B = A^2 */
+   fe448_mul(C, p->X, q->X);        /* C = X1*X2 */
+   fe448_mul(D, p->Y, q->Y);        /* D = Y1*Y2 */
+   fe448_mul(E, C, D);
+   fe448_mul(E, E, (U64*)ed448_d_mb); /* E = d*C*D */
+   fe448_sub(F, B, E);              /* F = B-E */
+   fe448_add(G, B, E);              /* G = B+E */
+   fe448_add(H, p->X, p->Y);
+   fe448_add(B, q->X, q->Y);
+   fe448_mul(H, H, B);              /* H = (X1+Y1)*(X2+Y2) */
+
+   fe448_sub(H, H, C);
+   fe448_sub(H, H, D);
+   fe448_mul(H, H, F);
+   fe448_mul(r->X, H, A);           /* X3 = A*F*(H-C-D) */
+   fe448_sub(D, D, C);
+   fe448_mul(D, D, G);
+   fe448_mul(r->Y, D, A);           /* Y3 = A*G*(D-C) */
+   fe448_mul(r->Z, F, G);           /* Z3 = F*G */
+}
+
+/* r = 2*p */
+void ge448_homo_dbl(ge448_homo_mb* r, const ge448_homo_mb* p)
+{
+   fe448_mb B, C, D, E, H, J;
+
+   fe448_add(B, p->X, p->Y);
+   fe448_sqr(B, B);                 /* B = (X1+Y1)^2 */
+   fe448_sqr(C, p->X);              /* C = X1^2 */
+   fe448_sqr(D, p->Y);              /* D = Y1^2 */
+   fe448_add(E, C, D);              /* E = C+D */
+   fe448_sqr(H, p->Z);              /* H = Z1^2 */
+   fe448_add(H, H, H);
+   fe448_sub(J, E, H);              /* J = E-2*H */
+
+   fe448_sub(B, B, E);
+   fe448_mul(r->X, B, J);           /* X3 = (B-E)*J */
+   fe448_sub(C, C, D);
+   fe448_mul(r->Y, E, C);           /* Y3 = E*(C-D) */
+   fe448_mul(r->Z, E, J);           /* Z3 = E*J */
+}
+
+/*
+// Compression: r = y | (x&1)<<455, r is regular (not Montgomery) value
+*/
+void ge448_homo_compress(U64 r[P448_LEN52], const ge448_homo_mb* p)
+{
+   fe448_mb zinv, x;
+
+   fe448_inv(zinv, p->Z);
+   fe448_mul(x, p->X, zinv);
+   fe448_mul(r, p->Y, zinv);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(x, x);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(r, r);
+
+   /* bit 455 is bit 39 of the most significant digit */
+   r[P448_LEN52-1] = _mm512_or_si512(r[P448_LEN52-1], slli64(and64_const(x[0], 1), GE448_COMP_BITSIZE-1 - (P448_LEN52-1)*DIGIT_SIZE));
+}
+
+/*
+// Decompression (RFC 8032, 5.2.3)
+// returns mask of the lanes where the input is valid encoding of the point
+*/
+__mb_mask ge448_homo_decompress(ge448_homo_mb* r, const U64 in[P448_LEN52])
+{
+   const int signPos = GE448_COMP_BITSIZE-1 - (P448_LEN52-1)*DIGIT_SIZE;
+   fe448_mb y, u, v, x, t, t2;
+
+   /* sign of x-coordinate and y < p */
+   U64 sign = and64_const(srli64(in[P448_LEN52-1], signPos), 1);
+   MB_FUNC_NAME(mov_FE448_)(y, in);
+   y[P448_LEN52-1] = and64_const(y[P448_LEN52-1], (1ULL << signPos) - 1);
+   __mb_mask valid = MB_FUNC_NAME(ifma_cmp_lt_p448_)(y);
+
+   /* u = y^2-1, v = d*y^2-1 */
+   MB_FUNC_NAME(ifma_tomont52_p448_)(r->Y, y);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(r->Z, 1);
+   fe448_sqr(t, r->Y);
+   fe448_sub(u, t, r->Z);
+   fe448_mul(v, t, (U64*)ed448_d_mb);
+   fe448_sub(v, v, r->Z);
+
+   /* x = u^3*v * (u^5*v^3)^((p-3)/4) */
+   fe448_sqr(t, u);
+   fe448_mul(x, t, u);              /* u^3 */
+   fe448_mul(t, x, t);              /* u^5 */
+   fe448_sqr(t2, v);
+   fe448_mul(t2, t2, v);            /* v^3 */
+   fe448_mul(t, t, t2);
+   MB_FUNC_NAME(ifma_ampow52_p448m3div4_)(t, t);
+   fe448_mul(x, x, v);
+   fe448_mul(x, x, t);
+
+   /* check v*x^2 == u */
+   fe448_sqr(t, x);
+   fe448_mul(t, t, v);
+   fe448_red(t, t);
+   fe448_red(u, u);
+   valid &= MB_FUNC_NAME(cmp_eq_FE448_)(t, u);
+
+   /* x==0 and sign==1 is invalid encoding */
+   MB_FUNC_NAME(ifma_frommont52_p448_)(t, x);
+   __mb_mask isOdd = cmpeq64_mask(and64_const(t[0], 1), set1(1));
+   __mb_mask isNeg = cmpeq64_mask(sign, set1(1));
+   valid &= ~(MB_FUNC_NAME(is_zero_FE448_)(t) & isNeg);
+
+   /* choose the root with required sign */
+   fe448_neg(t, x);
+   MB_FUNC_NAME(mask_mov_FE448_)(r->X, x, isOdd ^ isNeg, t);
+
+   return valid;
+}
+
+/* extracts 4-bit window of the scalar */
+__MBX_INLINE U64 get_window4(const U64 scalar[], int w)
+{
+   const int digitsPerLimb = DIGIT_SIZE/4;
+   return and64_const(srli64(scalar[w / digitsPerLimb], (w % digitsPerLimb) * 4), 0xF);
+}
+
+/* precomputes table[i] = i*p, i=0,..,15 */
+static void ge448_precomp_table(ge448_homo_mb table[16], const ge448_homo_mb* p)
+{
+   neutral_ge448_homo_mb(&table[0]);
+   table[1] = *p;
+   for (int i = 2; i < 16; i += 2) {
+      ge448_homo_dbl(&table[i], &table[i/2]);
+      ge448_homo_add(&table[i+1], &table[i], p);
+   }
+}
+
+/* constant time table selection: r = table[idx] */
+static void ge448_extract_table(ge448_homo_mb* r, const ge448_homo_mb table[16], U64 idx)
+{
+   *r = table[0];
+   for (int i = 1; i < 16; i++) {
+      __mb_mask k = cmpeq64_mask(idx, set1((unsigned long long)i));
+      cmov_ge448_homo_mb(r, r, k, &table[i]);
+   }
+}
+
+/*
+// r = [scalar]*p
+// scalar is regular 52-bit digits value less than 2^448
+*/
+void ifma_ed448_mul_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalar[])
+{
+   __ALIGN64 ge448_homo_mb table[16];
+   ge448_homo_mb t;
+
+   ge448_precomp_table(table, p);
+
+   neutral_ge448_homo_mb(r);
+   for (int w = ED448_SCALAR_BITSIZE/4 - 1; w >= 0; w--) {
+      ge448_homo_dbl(r, r);
+      ge448_homo_dbl(r, r);
+      ge448_homo_dbl(r, r);
+      ge448_homo_dbl(r, r);
+
+      ge448_extract_table(&t, table, get_window4(scalar, w));
+      ge448_homo_add(r, r, &t);
+   }
+
+   /* clear secret data */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])table, 16 * (int)(sizeof(ge448_homo_mb)/sizeof(U64)));
+}
+
+static void ge448_base_point(ge448_homo_mb* g)
+{
+   MB_FUNC_NAME(mov_FE448_)(g->X, (U64*)ed448_gx_mb);
+   MB_FUNC_NAME(mov_FE448_)(g->Y, (U64*)ed448_gy_mb);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(g->Z, 1);
+}
+
+/* r = [scalar]*G */
+void ifma_ed448_mul_basepoint(ge448_homo_mb* r, const U64 scalar[])
+{
+   ge448_homo_mb g;
+   ge448_base_point(&g);
+   ifma_ed448_mul_point(r, &g, scalar);
+}
+
+/*
+// r = [scalarP]*p + [scalarG]*G
+// (used for verification, scalars are not secret)
+*/
+void ifma_ed448_prod_point(ge448_homo_mb* r, const ge448_homo_mb* p, const U64 scalarP[], const U64 scalarG[])
+{
+   __ALIGN64 ge448_homo_mb tableP[16];
+   __ALIGN64 ge448_homo_mb tableG[16];
+   ge448_homo_mb t;
+
+   ge448_precomp_table(tableP, p);
+   ge448_base_point(&t);
+   ge448_precomp_table(tableG, &t);
+
+   neutral_ge448_homo_mb(r);
+   for (int w = ED448_SCALAR_BITSIZE/4 - 1; w >= 0; w--) {
+      ge448_homo_dbl(r, r);
+      ge448_homo_dbl(r, r);
+      ge448_homo_dbl(r, r);
+      ge448_homo_dbl(r, r);
+
+      ge448_extract_table(&t, tableP, get_window4(scalarP, w));
+      ge448_homo_add(r, r, &t);
+      ge448_extract_table(&t, tableG, get_window4(scalarG, w));
+      ge448_homo_add(r, r, &t);
+   }
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
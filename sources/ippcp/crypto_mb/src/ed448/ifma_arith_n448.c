@@ -0,0 +1,169 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/ed448/ifma_arith_n448.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// ED448 prime base point order
+// n = 2^446 - 13818066809895115352007386748515426880336692474882178609894547503885
+// in 2^52 radix
+*/
+__ALIGN64 static const int64u ed448n_mb[NE448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x0008c292ab5844f3) },
+   { REP8_DECL(0x000728dc58f55237) },
+   { REP8_DECL(0x000ed63690216cc2) },
+   { REP8_DECL(0x00023e9c44edb49a) },
+   { REP8_DECL(0x000fffffffff7cca) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000000003fffffff) }
+};
+
+/* k0 = -(1/n mod 2^DIGIT_SIZE) */
+static const int64u ed448n_k0[sizeof(U64)/sizeof(int64u)] = {
+   REP8_DECL(0x000d440fae918bc5)
+};
+
+/* rr = 2^((NE448_LEN52*DIGIT_SIZE)*2) mod n */
+__ALIGN64 static const int64u ed448n_rr_mb[NE448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000f8a5fc2e06660) },
+   { REP8_DECL(0x000640a53916201f) },
+   { REP8_DECL(0x000e7ed923138558) },
+   { REP8_DECL(0x000c3e6932447c6e) },
+   { REP8_DECL(0x0009860faa102c17) },
+   { REP8_DECL(0x0007c44ae17cf72c) },
+   { REP8_DECL(0x000f1a9cc14ba3c4) },
+   { REP8_DECL(0x00052bcb7e4d070a) },
+   { REP8_DECL(0x0000000023b72920) }
+};
+
+static const int64u VMASK52_n448[sizeof(U64)/sizeof(int64u)] = {
+   REP8_DECL(DIGIT_MASK)
+};
+
+/* r = a<n? a : a-n, a is normalized and less than 2*n */
+static void n448_sub_cond(U64 r[], const U64 a[])
+{
+   const U64* n = (const U64*)ed448n_mb;
+   U64 vmask = loadu64(VMASK52_n448);
+   U64 t[NE448_LEN52];
+   int i;
+
+   for(i=0; i<NE448_LEN52; i++)
+      t[i] = sub64(a[i], n[i]);
+   for(i=0; i<NE448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srai64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   __mb_mask lt = cmp64_mask(t[NE448_LEN52-1], get_zero64(), _MM_CMPINT_LT);
+   for(i=0; i<NE448_LEN52; i++)
+      r[i] = mask_mov64(t[i], lt, a[i]);
+}
+
+/*
+// Montgomery reduction: r = t/2^(NE448_LEN52*DIGIT_SIZE) mod n
+// t[2*NE448_LEN52] (is destroyed) < n*2^(NE448_LEN52*DIGIT_SIZE), r < n
+*/
+static void n448_mont_reduce(U64 r[], U64 t[])
+{
+   const U64* n = (const U64*)ed448n_mb;
+   U64 k0 = loadu64(ed448n_k0);
+   U64 vmask = loadu64(VMASK52_n448);
+   int i, j;
+
+   for(i=0; i<NE448_LEN52; i++) {
+      U64 u = fma52lo(get_zero64(), t[i], k0);
+      for(j=0; j<NE448_LEN52; j++) {
+         t[i+j]   = fma52lo(t[i+j],   u, n[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], u, n[j]);
+      }
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+   }
+
+   for(i=NE448_LEN52; i<2*NE448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   n448_sub_cond(r, t + NE448_LEN52);
+}
+
+/* t[2*NE448_LEN52] = a*b, not normalized */
+static void n448_mul(U64 t[], const U64 a[], const U64 b[])
+{
+   int i, j;
+   for(i=0; i<2*NE448_LEN52; i++)
+      t[i] = get_zero64();
+   for(j=0; j<NE448_LEN52; j++) {
+      for(i=0; i<NE448_LEN52; i++) {
+         t[i+j]   = fma52lo(t[i+j],   a[i], b[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], a[i], b[j]);
+      }
+   }
+}
+
+void ifma52_ed448n_reduce(U64 r[NE448_LEN52], const U64 x[NE448_LEN52 * 2])
+{
+   __ALIGN64 U64 t[2*NE448_LEN52];
+   __ALIGN64 U64 s[NE448_LEN52];
+   int i;
+
+   /* s = x/R mod n */
+   for(i=0; i<2*NE448_LEN52; i++)
+      t[i] = x[i];
+   n448_mont_reduce(s, t);
+
+   /* r = (x/R)*R^2/R = x mod n */
+   n448_mul(t, s, (const U64*)ed448n_rr_mb);
+   n448_mont_reduce(r, t);
+}
+
+void ifma52_ed448n_madd(U64 r[NE448_LEN52], const U64 a[NE448_LEN52], const U64 b[NE448_LEN52], const U64 c[NE448_LEN52])
+{
+   __ALIGN64 U64 t[2*NE448_LEN52];
+   __ALIGN64 U64 s[NE448_LEN52];
+   int i;
+
+   /* t = a*b + c (< n^2+n) */
+   n448_mul(t, a, b);
+   for(i=0; i<NE448_LEN52; i++)
+      t[i] = add64(t[i], c[i]);
+
+   /* r = (a*b+c)/R*R^2/R */
+   n448_mont_reduce(s, t);
+   n448_mul(t, s, (const U64*)ed448n_rr_mb);
+   n448_mont_reduce(r, t);
+}
+
+__mb_mask ifma52_ed448n_cmp_lt(const U64 a[NE448_LEN52])
+{
+   const U64* n = (const U64*)ed448n_mb;
+   U64 t[NE448_LEN52];
+   int i;
+
+   for(i=0; i<NE448_LEN52; i++)
+      t[i] = sub64(a[i], n[i]);
+   for(i=0; i<NE448_LEN52-1; i++)
+      t[i+1] = add64(t[i+1], srai64(t[i], DIGIT_SIZE));
+
+   return cmp64_mask(t[NE448_LEN52-1], get_zero64(), _MM_CMPINT_LT);
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -0,0 +1,372 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/ed448/ifma_arith_p448.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* Constants */
+
+/*
+// p448 = 2^448 - 2^224 - 1
+// in 2^52 radix
+*/
+__ALIGN64 static const int64u p448_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000ffffffffeffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x00000000ffffffff) }
+};
+
+/* 2*p448 */
+__ALIGN64 static const int64u p448_x2[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x000ffffffffffffe) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000ffffffffdffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x000fffffffffffff) },
+   { REP8_DECL(0x00000001ffffffff) }
+};
+
+/*
+// Note that
+// k0 = -(1/p448 mod 2^DIGIT_SIZE)  equals 1
+// The implementation takes this fact into account
+*/
+
+/* to Montgomery conversion constant
+// rr = 2^((P448_LEN52*DIGIT_SIZE)*2) mod p448
+*/
+__ALIGN64 static const int64u p448_rr_mb[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(0x0000020000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000030) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) },
+   { REP8_DECL(0x0000000000000000) }
+};
+
+__ALIGN64 static const int64u ones448[P448_LEN52][sizeof(U64)/sizeof(int64u)] = {
+   { REP8_DECL(1) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) },
+   { REP8_DECL(0) }
+};
+
+static const int64u VMASK52_448[sizeof(U64)/sizeof(int64u)] = {
+   REP8_DECL(DIGIT_MASK)
+};
+
+
+/*=====================================================================
+
+ Specialized operations over p448:  sqr & mul
+
+=====================================================================*/
+
+/*
+// Montgomery reduction of the double length product t[2*P448_LEN52]
+// (k0 == 1, so u = t[i] mod 2^52)
+*/
+__MBX_INLINE void p448_mont_reduce(U64 r[], U64 t[])
+{
+   const U64* p = (const U64*)p448_mb;
+   U64 vmask = loadu64(VMASK52_448);
+   int i, j;
+
+   for(i=0; i<P448_LEN52; i++) {
+      U64 u = and64(t[i], vmask);
+      for(j=0; j<P448_LEN52; j++) {
+         t[i+j]   = fma52lo(t[i+j],   u, p[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], u, p[j]);
+      }
+      /* carry propagation, t[i] is zero modulo 2^52 now */
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+   }
+
+   /* normalization */
+   for(i=P448_LEN52; i<2*P448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   for(i=0; i<P448_LEN52; i++)
+      r[i] = t[P448_LEN52+i];
+}
+
+void MB_FUNC_NAME(ifma_amm52_p448_)(U64 r[], const U64 va[], const U64 vb[])
+{
+   U64 t[2*P448_LEN52];
+   int i, j;
+
+   for(i=0; i<2*P448_LEN52; i++)
+      t[i] = get_zero64();
+
+   /* full multiplication */
+   for(j=0; j<P448_LEN52; j++) {
+      for(i=0; i<P448_LEN52; i++) {
+         t[i+j]   = fma52lo(t[i+j],   va[i], vb[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], va[i], vb[j]);
+      }
+   }
+
+   p448_mont_reduce(r, t);
+}
+
+void MB_FUNC_NAME(ifma_ams52_p448_)(U64 r[], const U64 va[])
+{
+   U64 t[2*P448_LEN52];
+   int i, j;
+
+   for(i=0; i<2*P448_LEN52; i++)
+      t[i] = get_zero64();
+
+   /* cross products */
+   for(i=0; i<P448_LEN52; i++) {
+      for(j=i+1; j<P448_LEN52; j++) {
+         t[i+j]   = fma52lo(t[i+j],   va[i], va[j]);
+         t[i+j+1] = fma52hi(t[i+j+1], va[i], va[j]);
+      }
+   }
+   for(i=1; i<2*P448_LEN52; i++)
+      t[i] = add64(t[i], t[i]);
+
+   /* squares */
+   for(i=0; i<P448_LEN52; i++) {
+      t[2*i]   = fma52lo(t[2*i],   va[i], va[i]);
+      t[2*i+1] = fma52hi(t[2*i+1], va[i], va[i]);
+   }
+
+   p448_mont_reduce(r, t);
+}
+
+void MB_FUNC_NAME(ifma_tomont52_p448_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52_p448_)(r, a, (U64*)p448_rr_mb);
+}
+
+void MB_FUNC_NAME(ifma_frommont52_p448_)(U64 r[], const U64 a[])
+{
+   MB_FUNC_NAME(ifma_amm52_p448_)(r, a, (U64*)ones448);
+   MB_FUNC_NAME(ifma_reduce52_p448_)(r, r);
+}
+
+void MB_FUNC_NAME(ifma_set_u32_p448_)(U64 r[], int32u a)
+{
+   __ALIGN64 U64 t[P448_LEN52];
+   MB_FUNC_NAME(zero_FE448_)(t);
+   t[0] = set1(a);
+   MB_FUNC_NAME(ifma_tomont52_p448_)(r, t);
+}
+
+/*
+// exponentiation helpers
+//
+// note: z in in Montgomery domain (as soon mul() and sqr() below are amm-functions
+//       r in Montgomery domain too
+*/
+#define fe52_sqr  MB_FUNC_NAME(ifma_ams52_p448_)
+#define fe52_mul  MB_FUNC_NAME(ifma_amm52_p448_)
+
+/* r = base^(2^n) */
+__MBX_INLINE void fe52_sqr_pwr(U64 r[], const U64 base[], int n)
+{
+   if(r!=base)
+      MB_FUNC_NAME(mov_FE448_)(r, base);
+   for(; n>0; n--)
+      fe52_sqr(r,r);
+}
+
+/* x222 = z^(2^222-1), x223 = z^(2^223-1) */
+static void p448_pow_x222_x223(U64 x222[], U64 x223[], const U64 z[])
+{
+   __ALIGN64 U64 x3[P448_LEN52];
+   __ALIGN64 U64 x6[P448_LEN52];
+   __ALIGN64 U64 x24[P448_LEN52];
+   __ALIGN64 U64 x30[P448_LEN52];
+   __ALIGN64 U64 t[P448_LEN52];
+
+   fe52_sqr(t, z);
+   fe52_mul(t, t, z);            /* t = z^(2^2-1) */
+   fe52_sqr(t, t);
+   fe52_mul(x3, t, z);           /* x3 = z^(2^3-1) */
+   fe52_sqr_pwr(t, x3, 3);
+   fe52_mul(x6, t, x3);          /* x6 = z^(2^6-1) */
+   fe52_sqr_pwr(t, x6, 6);
+   fe52_mul(t, t, x6);           /* t = z^(2^12-1) */
+   fe52_sqr_pwr(x24, t, 12);
+   fe52_mul(x24, x24, t);        /* x24 = z^(2^24-1) */
+   fe52_sqr_pwr(x30, x24, 6);
+   fe52_mul(x30, x30, x6);       /* x30 = z^(2^30-1) */
+   fe52_sqr_pwr(t, x24, 24);
+   fe52_mul(t, t, x24);          /* t = z^(2^48-1) */
+   fe52_sqr_pwr(x222, t, 48);
+   fe52_mul(t, x222, t);         /* t = z^(2^96-1) */
+   fe52_sqr_pwr(x222, t, 96);
+   fe52_mul(t, x222, t);         /* t = z^(2^192-1) */
+   fe52_sqr_pwr(x222, t, 30);
+   fe52_mul(x222, x222, x30);    /* x222 = z^(2^222-1) */
+   fe52_sqr(x223, x222);
+   fe52_mul(x223, x223, z);      /* x223 = z^(2^223-1) */
+}
+
+/*
+// computes r = 1/z = z^(p448-2) mod p448
+// p448-2 = (2^223-1)*2^225 + (2^222-1)*2^2 + 1
+*/
+void MB_FUNC_NAME(ifma_aminv52_p448_)(U64 r[], const U64 z[])
+{
+   __ALIGN64 U64 x222[P448_LEN52];
+   __ALIGN64 U64 x223[P448_LEN52];
+
+   p448_pow_x222_x223(x222, x223, z);
+
+   fe52_sqr_pwr(x223, x223, 223);
+   fe52_mul(x223, x223, x222);
+   fe52_sqr_pwr(x223, x223, 2);
+   fe52_mul(r, x223, z);
+}
+
+/*
+// computes r = z^((p448-3)/4) mod p448 (used to compute square root)
+// (p448-3)/4 = (2^223-1)*2^223 + (2^222-1)
+*/
+void MB_FUNC_NAME(ifma_ampow52_p448m3div4_)(U64 r[], const U64 z[])
+{
+   __ALIGN64 U64 x222[P448_LEN52];
+   __ALIGN64 U64 x223[P448_LEN52];
+
+   p448_pow_x222_x223(x222, x223, z);
+
+   fe52_sqr_pwr(x223, x223, 223);
+   fe52_mul(r, x223, x222);
+}
+
+/*=====================================================================
+
+ Specialized single operations over p448:  add, sub, neg
+
+=====================================================================*/
+
+/* R = A<M? A : A-M, A is normalized */
+__MBX_INLINE void p448_sub_cond(U64 R[], const U64 A[], const U64 M[])
+{
+   U64 vmask = loadu64(VMASK52_448);
+   U64 t[P448_LEN52];
+   int i;
+
+   for(i=0; i<P448_LEN52; i++)
+      t[i] = sub64(A[i], M[i]);
+   for(i=0; i<P448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srai64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   __mb_mask lt = cmp64_mask(t[P448_LEN52-1], get_zero64(), _MM_CMPINT_LT);
+   for(i=0; i<P448_LEN52; i++)
+      R[i] = mask_mov64(t[i], lt, A[i]);
+}
+
+void MB_FUNC_NAME(ifma_add52_p448_)(U64 R[], const U64 A[], const U64 B[])
+{
+   U64 vmask = loadu64(VMASK52_448);
+   U64 t[P448_LEN52];
+   int i;
+
+   /* t = a + b */
+   for(i=0; i<P448_LEN52; i++)
+      t[i] = add64(A[i], B[i]);
+   for(i=0; i<P448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srli64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   /* r = t<2*p? t : t-2*p */
+   p448_sub_cond(R, t, (const U64*)p448_x2);
+}
+
+void MB_FUNC_NAME(ifma_sub52_p448_)(U64 R[], const U64 A[], const U64 B[])
+{
+   const U64* p2 = (const U64*)p448_x2;
+   U64 vmask = loadu64(VMASK52_448);
+   U64 t[P448_LEN52];
+   int i;
+
+   /* t = a - b */
+   for(i=0; i<P448_LEN52; i++)
+      t[i] = sub64(A[i], B[i]);
+   for(i=0; i<P448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srai64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   /* r = t<0? t+2*p : t */
+   __mb_mask lt = cmp64_mask(t[P448_LEN52-1], get_zero64(), _MM_CMPINT_LT);
+   for(i=0; i<P448_LEN52; i++)
+      t[i] = mask_add64(t[i], lt, t[i], p2[i]);
+   for(i=0; i<P448_LEN52-1; i++) {
+      t[i+1] = add64(t[i+1], srai64(t[i], DIGIT_SIZE));
+      t[i] = and64(t[i], vmask);
+   }
+
+   for(i=0; i<P448_LEN52; i++)
+      R[i] = t[i];
+}
+
+void MB_FUNC_NAME(ifma_neg52_p448_)(U64 R[], const U64 A[])
+{
+   __ALIGN64 U64 zero[P448_LEN52];
+   MB_FUNC_NAME(zero_FE448_)(zero);
+   MB_FUNC_NAME(ifma_sub52_p448_)(R, zero, A);
+}
+
+/* fully reduce the value less than 2*p448 */
+void MB_FUNC_NAME(ifma_reduce52_p448_)(U64 R[], const U64 A[])
+{
+   p448_sub_cond(R, A, (const U64*)p448_mb);
+}
+
+/* a < p448 */
+__mb_mask MB_FUNC_NAME(ifma_cmp_lt_p448_)(const U64 a[])
+{
+   U64 t[P448_LEN52];
+   int i;
+
+   for(i=0; i<P448_LEN52; i++)
+      t[i] = sub64(a[i], ((const U64*)p448_mb)[i]);
+   for(i=0; i<P448_LEN52-1; i++)
+      t[i+1] = add64(t[i+1], srai64(t[i], DIGIT_SIZE));
+
+   return cmp64_mask(t[P448_LEN52-1], get_zero64(), _MM_CMPINT_LT);
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
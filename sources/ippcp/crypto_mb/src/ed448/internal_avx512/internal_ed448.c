@@ -0,0 +1,291 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#include <crypto_mb/ed448.h>
+#include <internal/ed448/ifma_arith_ed448.h>
+#include <internal/ed448/ifma_arith_p448.h>
+#include <internal/ed448/ifma_arith_n448.h>
+#include <internal/ed448/shake256.h>
+#include <internal/common/mem_fns.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* length of SHAKE256 output in bits and bytes */
+#define ED448_HASH_BITLENGTH  (912)
+#define HASH_LENGTH           NUMBER_OF_DIGITS(ED448_HASH_BITLENGTH, 8)
+
+/* length of encoded points and scalars */
+#define ED448_COMP_LENGTH     NUMBER_OF_DIGITS(GE448_COMP_BITSIZE, 8)
+
+/* dom4(0, "") = "SigEd448" || octet(0) || octet(0) */
+static const int8u ed448_dom4[] = { 'S','i','g','E','d','4','4','8', 0x00, 0x00 };
+
+/* absorbs dom4 prefix into the all lanes */
+static void ed448_absorb_dom4(SHAKE256State_mb8* state)
+{
+   const int8u* pa_dom[8] = { REP8_DECL(ed448_dom4) };
+   const int32u domLen[8] = { REP8_DECL(sizeof(ed448_dom4)) };
+   SHAKE256Update_mb8(pa_dom, domLen, state);
+}
+
+/*
+// stores 57-byte encoded points and scalars
+// (ifma_mb8_to_BNU() stores whole 64-bit words and would overrun the output)
+*/
+static void ed448_mb8_to_encoded(int8u* const pa_out[8], const U64 in[P448_LEN52])
+{
+   __ALIGN64 int64u buffer[8][NUMBER_OF_DIGITS(GE448_COMP_BITSIZE, 64)];
+   int64u* pa_buffer[8] = { buffer[0], buffer[1], buffer[2], buffer[3], buffer[4], buffer[5], buffer[6], buffer[7] };
+
+   ifma_mb8_to_BNU(pa_buffer, (const int64u(*)[8])in, GE448_COMP_BITSIZE);
+   for (int n = 0; n < 8; n++) {
+      if (pa_out[n])
+         CopyBlock(buffer[n], pa_out[n], ED448_COMP_LENGTH);
+   }
+   PadBlock(0, buffer, sizeof(buffer));
+}
+
+static void ed448_expand_key(int8u* pa_secret_expand[8], const ed448_private_key* const pa_secret_key[8])
+{
+   int32u keyLen[8];
+   for (int n = 0; n < 8; n++)
+      keyLen[n] = pa_secret_key[n] ? (int32u)sizeof(ed448_private_key) : 0;
+
+   /* do hash of secret keys in parallel */
+   SHAKE256MsgDigest_mb8((const int8u**)pa_secret_key, keyLen, pa_secret_expand, HASH_LENGTH);
+
+   for (int n = 0; n < 8; n++) {
+      if (pa_secret_key[n]) {
+         /* prune the buffer according to RFC8032 */
+         pa_secret_expand[n][0]  &= 0xfc;
+         pa_secret_expand[n][55] |= 0x80;
+         pa_secret_expand[n][56]  = 0;
+      }
+   }
+}
+
+mbx_status MB_FUNC_NAME(internal_avx512_ed448_public_key_)(ed448_public_key* pa_public_key[8],
+                                                           const ed448_private_key* const pa_private_key[8])
+{
+   mbx_status status = 0;
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+
+      int8u h[8][HASH_LENGTH] = { 0 };
+      int8u* pa_h[8] = { h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7] };
+
+      /* expand secret keys */
+      ed448_expand_key(pa_h, pa_private_key);
+
+      /* convert into mb format */
+      U64 scalar[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])scalar, (const int64u**)pa_h, P448_BITSIZE);
+
+      /* r = [scalar]*G */
+      ge448_homo_mb r;
+      ifma_ed448_mul_basepoint(&r, scalar);
+
+      /* compress point to public */
+      U64 packed_point[P448_LEN52];
+      ge448_homo_compress(packed_point, &r);
+
+      /* return result */
+      ed448_mb8_to_encoded((int8u * const*)pa_public_key, packed_point);
+
+      /* clear memory containing potentially secret data */
+      MB_FUNC_NAME(zero_)((int64u(*)[8])scalar, sizeof(scalar)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])h, sizeof(h)/sizeof(U64));
+   }
+   return status;
+}
+
+/* r = SHAKE256(dom4 || prefix || msg, 114) */
+static void ed448_nonce(int8u* pa_nonce[8], int8u* pa_h[8], const int8u* const pa_msg[8], const int32u msgLen[8])
+{
+   SHAKE256State_mb8 state;
+
+   const int8u* pa_prefix[8];
+   int32u prefixLen[8];
+   for (int n = 0; n < 8; n++) {
+      pa_prefix[n] = pa_h[n] + ED448_COMP_LENGTH;
+      prefixLen[n] = ED448_COMP_LENGTH;
+   }
+
+   SHAKE256Init_mb8(&state);
+   ed448_absorb_dom4(&state);
+   SHAKE256Update_mb8(pa_prefix, prefixLen, &state);
+   SHAKE256Update_mb8(pa_msg, msgLen, &state);
+   SHAKE256Final_mb8(pa_nonce, HASH_LENGTH, &state);
+}
+
+/* k = SHAKE256(dom4 || R || A || msg, 114) */
+static void ed448_hash_r_pub_msg(int8u* pa_hram[8], const ed448_sign_component* const pa_sign_r[], const ed448_public_key* const pa_public_key[8], const int8u* const pa_msg[8], const int32u msgLen[8])
+{
+   SHAKE256State_mb8 state;
+
+   const int32u signRLen[8] = { REP8_DECL(sizeof(ed448_sign_component)) };
+   const int32u publicLen[8] = { REP8_DECL(sizeof(ed448_public_key)) };
+
+   SHAKE256Init_mb8(&state);
+   ed448_absorb_dom4(&state);
+   SHAKE256Update_mb8((const int8u**)pa_sign_r, signRLen, &state);
+   SHAKE256Update_mb8((const int8u**)pa_public_key, publicLen, &state);
+   SHAKE256Update_mb8(pa_msg, msgLen, &state);
+   SHAKE256Final_mb8(pa_hram, HASH_LENGTH, &state);
+}
+
+/* converts 114-byte hash into mb format and reduces it wrt n */
+static void ed448_hash_to_scalar(U64 r[NE448_LEN52], int8u* pa_hash[8])
+{
+   U64 h_mb[NE448_LEN52 * 2];
+   ifma_BNU_to_mb8((int64u(*)[8])h_mb, (const int64u**)pa_hash, ED448_HASH_BITLENGTH);
+   ifma52_ed448n_reduce(r, h_mb);
+   MB_FUNC_NAME(zero_)((int64u(*)[8])h_mb, sizeof(h_mb)/sizeof(U64));
+}
+
+mbx_status MB_FUNC_NAME(internal_avx512_ed448_sign_)(ed448_sign_component* pa_sign_r[8],
+                                                     ed448_sign_component* pa_sign_s[8],
+                                                     const int8u* const pa_msg[8], const int32u msgLen[8],
+                                                     const ed448_private_key* const pa_private_key[8],
+                                                     const ed448_public_key* const pa_public_key[8])
+{
+   mbx_status status = 0;
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+
+      /* expanded secret keys */
+      int8u h[8][HASH_LENGTH] = { 0 };
+      int8u* pa_h[8] = { h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7] };
+
+      /* nonce */
+      int8u nonce[8][HASH_LENGTH] = { 0 };
+      int8u* pa_nonce[8] = { nonce[0], nonce[1], nonce[2], nonce[3], nonce[4], nonce[5], nonce[6], nonce[7] };
+
+      /* hram */
+      int8u hram[8][HASH_LENGTH] = { 0 };
+      int8u* pa_hram[8] = { hram[0], hram[1], hram[2], hram[3], hram[4], hram[5], hram[6], hram[7] };
+
+      /* expands secret key, h = H(private_key), s = h mod n */
+      ed448_expand_key(pa_h, pa_private_key);
+      U64 mb_s[NE448_LEN52 * 2];
+      MB_FUNC_NAME(zero_)((int64u(*)[8])mb_s, sizeof(mb_s)/sizeof(U64));
+      ifma_BNU_to_mb8((int64u(*)[8])mb_s, (const int64u**)pa_h, P448_BITSIZE);
+      ifma52_ed448n_reduce(mb_s, mb_s);
+
+      /* computes nonce, nonce = H(dom4, h+57, msg) mod n */
+      /* Note: only a second half of each pa_h[n] item is used in the ed448_nonce() function */
+      ed448_nonce(pa_nonce, pa_h, pa_msg, msgLen);
+      U64 mb_nonce[NE448_LEN52];
+      ed448_hash_to_scalar(mb_nonce, pa_nonce);
+
+      /* computes r-component of the signature */
+      ge448_homo_mb R;
+      ifma_ed448_mul_basepoint(&R, mb_nonce);      /* R = [nonce]*G */
+      U64 mb_sign_r[P448_LEN52];
+      ge448_homo_compress(mb_sign_r, &R);          /* compress point to r-component */
+
+      /* store r-component of the  signature */
+      ed448_mb8_to_encoded((int8u * const*)pa_sign_r, mb_sign_r);
+
+      /* computes hram, hram = H(dom4, r_sign, public_key, msg) mod n */
+      ed448_hash_r_pub_msg(pa_hram, (const ed448_sign_component**)pa_sign_r, pa_public_key, pa_msg, msgLen);
+      U64 mb_hram[NE448_LEN52];
+      ed448_hash_to_scalar(mb_hram, pa_hram);
+
+      /* s = hram*s + nonce */
+      U64 mb_sign_s[NE448_LEN52];
+      ifma52_ed448n_madd(mb_sign_s, mb_hram, mb_s, mb_nonce);
+
+      /* store s-component of the signature */
+      ed448_mb8_to_encoded((int8u * const*)pa_sign_s, mb_sign_s);
+
+      /* clear memory containing potentially secret data */
+      MB_FUNC_NAME(zero_)((int64u(*)[8])h, sizeof(h)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])nonce, sizeof(nonce)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])mb_s, sizeof(mb_s)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u(*)[8])mb_nonce, sizeof(mb_nonce)/sizeof(U64));
+   }
+
+   return status;
+}
+
+mbx_status MB_FUNC_NAME(internal_avx512_ed448_verify_)(const ed448_sign_component* const pa_sign_r[8],
+                                                       const ed448_sign_component* const pa_sign_s[8],
+                                                       const int8u* const pa_msg[8], const int32u msgLen[8],
+                                                       const ed448_public_key* const pa_public_key[8])
+{
+   mbx_status status = 0;
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+
+      /* h = SHAKE256(dom4 || sign_r || public_key || msg) mod n */
+      __ALIGN64 int8u h[8][HASH_LENGTH] = { 0 };
+      int8u* pa_h[8] = { h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7] };
+      ed448_hash_r_pub_msg(pa_h, pa_sign_r, pa_public_key, pa_msg, msgLen);
+
+      __ALIGN64 U64 h_mb[NE448_LEN52];
+      ed448_hash_to_scalar(h_mb, pa_h);
+
+      /* input r-components to mb */
+      __ALIGN64 U64 inputR_mb[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])inputR_mb, (const int64u**)pa_sign_r, GE448_COMP_BITSIZE);
+
+      /* input s-components to mb */
+      __ALIGN64 U64 s_mb[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])s_mb, (const int64u**)pa_sign_s, GE448_COMP_BITSIZE);
+
+      /* (compressed) public key to mb */
+      __ALIGN64 U64 pub_mb[P448_LEN52];
+      ifma_BNU_to_mb8((int64u(*)[8])pub_mb, (const int64u**)pa_public_key, GE448_COMP_BITSIZE);
+
+      /* check that s<n */
+      __mb_mask k = ifma52_ed448n_cmp_lt(s_mb);
+      status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+      /* continue processing if there are correct parameters */
+      if (MBX_IS_ANY_OK_STS(status)) {
+         /* decompress public to point -A */
+         __ALIGN64 ge448_homo_mb pubA_mb;
+         k = ge448_homo_decompress(&pubA_mb, pub_mb);
+         fe448_neg(pubA_mb.X, pubA_mb.X);
+         status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_SIGNATURE_ERR);
+
+         if (MBX_IS_ANY_OK_STS(status)) {
+            /* R = [h](-A) + [s]G */
+            __ALIGN64 ge448_homo_mb R_mb;
+            ifma_ed448_prod_point(&R_mb, &pubA_mb, h_mb, s_mb);
+
+            /* recovered r-components */
+            __ALIGN64 U64 checkR_mb[P448_LEN52];
+            ge448_homo_compress(checkR_mb, &R_mb);
+
+            /* check that recovered r- and input r- components are equal each other */
+            k = MB_FUNC_NAME(cmp_eq_FE448_)(checkR_mb, inputR_mb);
+            status |= MBX_SET_STS_BY_MASK(status, ~k, MBX_STATUS_SIGNATURE_ERR);
+         }
+      }
+   }
+   return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
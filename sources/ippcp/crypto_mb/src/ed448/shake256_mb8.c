@@ -0,0 +1,269 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/ed448/shake256.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/mem_fns.h>
+
+#if (_MBX>=_MBX_K1)
+
+#ifndef MIN
+#define MIN( a, b ) ( ((a) < (b)) ? (a) : (b) )
+#endif
+
+/* Keccak-f[1600] round constants */
+static const int64u keccak_rc[24] = {
+   0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+   0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+   0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+   0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+   0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+   0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+#define XOR3_MB8(x,y,z)  _mm512_ternarylogic_epi64((x),(y),(z),0x96)
+#define CHI_MB8(x,y,z)   _mm512_ternarylogic_epi64((x),(y),(z),0xD2)   /* x ^ (~y & z) */
+#define ROL_MB8(x,n)     _mm512_rol_epi64((x),(n))
+
+/* lane A[x+5*y] moves to B[y+5*((2*x+3*y)%5)] and is rotated */
+#define RHO_PI_MB8(x, y, n)  B[(y) + 5*((2*(x) + 3*(y)) % 5)] = ROL_MB8(A[(x) + 5*(y)], (n))
+
+static void keccak_f1600_mb8(__m512i A[25])
+{
+   __m512i B[25];
+   __m512i C[5];
+   __m512i D[5];
+   int round, x, y;
+
+   for (round = 0; round < 24; round++) {
+      /* theta */
+      for (x = 0; x < 5; x++)
+         C[x] = XOR3_MB8(XOR3_MB8(A[x], A[x+5], A[x+10]), A[x+15], A[x+20]);
+      for (x = 0; x < 5; x++)
+         D[x] = _mm512_xor_si512(C[(x+4)%5], ROL_MB8(C[(x+1)%5], 1));
+      for (x = 0; x < 25; x++)
+         A[x] = _mm512_xor_si512(A[x], D[x%5]);
+
+      /* rho and pi */
+      B[0] = A[0];
+      RHO_PI_MB8(1,0, 1); RHO_PI_MB8(2,0,62); RHO_PI_MB8(3,0,28); RHO_PI_MB8(4,0,27);
+      RHO_PI_MB8(0,1,36); RHO_PI_MB8(1,1,44); RHO_PI_MB8(2,1, 6); RHO_PI_MB8(3,1,55); RHO_PI_MB8(4,1,20);
+      RHO_PI_MB8(0,2, 3); RHO_PI_MB8(1,2,10); RHO_PI_MB8(2,2,43); RHO_PI_MB8(3,2,25); RHO_PI_MB8(4,2,39);
+      RHO_PI_MB8(0,3,41); RHO_PI_MB8(1,3,45); RHO_PI_MB8(2,3,15); RHO_PI_MB8(3,3,21); RHO_PI_MB8(4,3, 8);
+      RHO_PI_MB8(0,4,18); RHO_PI_MB8(1,4, 2); RHO_PI_MB8(2,4,61); RHO_PI_MB8(3,4,56); RHO_PI_MB8(4,4,14);
+
+      /* chi */
+      for (y = 0; y < 25; y += 5) {
+         for (x = 0; x < 5; x++)
+            A[y+x] = CHI_MB8(B[y+x], B[y+(x+1)%5], B[y+(x+2)%5]);
+      }
+
+      /* iota */
+      A[0] = _mm512_xor_si512(A[0], _mm512_set1_epi64((long long)keccak_rc[round]));
+   }
+}
+
+/*
+// Absorbs the 8 independent streams of blocks.
+// len[n] (a multiple of SHAKE256_RATE) bytes of the n-th stream are processed,
+// state of the lanes with len[n]==0 is not changed.
+*/
+void keccak_absorb_avx512_mb8(keccak_state_mb8 state, const int8u* const pa_msg[8], const int len[8])
+{
+   /* data of the not processed lanes are loaded from the zero block */
+   __ALIGN64 int8u zero_block[SHAKE256_RATE + 8] = { 0 };
+   __ALIGN64 const int8u* loc_data[SHAKE256_NUM_BUFFERS8];
+
+   __m256i loc_len = _mm256_loadu_si256((__m256i*)len);
+   __mmask8 mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+
+   _mm512_store_si512(loc_data, _mm512_mask_loadu_epi64(_mm512_set1_epi64((long long)zero_block), mb_mask, pa_msg));
+
+   __m512i A[25];
+   __m512i S[25];
+   __m512i W[8];
+   int i, n;
+
+   for (i = 0; i < 25; i++)
+      S[i] = _mm512_load_si512(state[i]);
+
+   while (mb_mask) {
+      for (i = 0; i < 25; i++)
+         A[i] = S[i];
+
+      /* load, transpose and absorb 17 words of the block */
+      for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++)
+         W[n] = _mm512_loadu_si512(loc_data[n]);
+      TRANSPOSE_8xI64x8(W[0], W[1], W[2], W[3], W[4], W[5], W[6], W[7]);
+      for (i = 0; i < 8; i++)
+         A[i] = _mm512_xor_si512(A[i], W[i]);
+
+      for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++)
+         W[n] = _mm512_loadu_si512(loc_data[n] + 64);
+      TRANSPOSE_8xI64x8(W[0], W[1], W[2], W[3], W[4], W[5], W[6], W[7]);
+      for (i = 0; i < 8; i++)
+         A[i+8] = _mm512_xor_si512(A[i+8], W[i]);
+
+      A[16] = _mm512_xor_si512(A[16], _mm512_set_epi64(
+                  (long long)((const int64u*)loc_data[7])[16], (long long)((const int64u*)loc_data[6])[16],
+                  (long long)((const int64u*)loc_data[5])[16], (long long)((const int64u*)loc_data[4])[16],
+                  (long long)((const int64u*)loc_data[3])[16], (long long)((const int64u*)loc_data[2])[16],
+                  (long long)((const int64u*)loc_data[1])[16], (long long)((const int64u*)loc_data[0])[16]));
+
+      keccak_f1600_mb8(A);
+
+      /* update state of the processed lanes */
+      for (i = 0; i < 25; i++)
+         S[i] = _mm512_mask_mov_epi64(S[i], mb_mask, A[i]);
+
+      /* update pointers to data, local lengths and mask */
+      _mm512_store_si512(loc_data, _mm512_mask_add_epi64(_mm512_load_si512(loc_data), mb_mask, _mm512_load_si512(loc_data), _mm512_set1_epi64(SHAKE256_RATE)));
+      loc_len = _mm256_mask_sub_epi32(loc_len, mb_mask, loc_len, _mm256_set1_epi32(SHAKE256_RATE));
+      mb_mask = _mm256_cmp_epi32_mask(loc_len, _mm256_setzero_si256(), _MM_CMPINT_NLE);
+   }
+
+   for (i = 0; i < 25; i++)
+      _mm512_store_si512(state[i], S[i]);
+}
+
+void SHAKE256Init_mb8(SHAKE256State_mb8* pState)
+{
+   int i;
+   for (i = 0; i < SHAKE256_NUM_BUFFERS8; i++)
+      pState->msgBuffIdx[i] = 0;
+   for (i = 0; i < 25; i++)
+      _mm512_store_si512(pState->state[i], _mm512_setzero_si512());
+}
+
+void SHAKE256Update_mb8(const int8u* const pa_src[8], const int32u len[8], SHAKE256State_mb8* pState)
+{
+   __ALIGN64 const int8u* loc_src[SHAKE256_NUM_BUFFERS8];
+   __ALIGN64 const int8u* loc_buff[SHAKE256_NUM_BUFFERS8];
+   __ALIGN64 int loc_len[SHAKE256_NUM_BUFFERS8];
+   __ALIGN64 int proc_len[SHAKE256_NUM_BUFFERS8];
+   int bufferFull = 0;
+   int mainPart = 0;
+   int n;
+
+   for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++) {
+      int idx = pState->msgBuffIdx[n];
+
+      loc_src[n] = pa_src[n];
+      loc_len[n] = pa_src[n] ? (int)len[n] : 0;
+      loc_buff[n] = pState->msgBuffer[n];
+      proc_len[n] = 0;
+
+      /* if non empty internal buffer filling */
+      if (idx && loc_len[n]) {
+         /* copy from input stream to the internal buffer as match as possible */
+         int procLen = MIN(loc_len[n], (SHAKE256_RATE - idx));
+         CopyBlock(loc_src[n], pState->msgBuffer[n] + idx, procLen);
+
+         loc_src[n] += procLen;
+         loc_len[n] -= procLen;
+         idx += procLen;
+
+         /* absorb the buffer if it is full */
+         if (SHAKE256_RATE == idx) {
+            proc_len[n] = SHAKE256_RATE;
+            bufferFull = 1;
+            idx = 0;
+         }
+         pState->msgBuffIdx[n] = idx;
+      }
+   }
+
+   if (bufferFull)
+      keccak_absorb_avx512_mb8(pState->state, loc_buff, proc_len);
+
+   /* main message part processing */
+   for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++) {
+      proc_len[n] = loc_len[n] - loc_len[n] % SHAKE256_RATE;
+      mainPart |= proc_len[n];
+   }
+
+   if (mainPart)
+      keccak_absorb_avx512_mb8(pState->state, loc_src, proc_len);
+
+   /* store rest of message into the internal buffer */
+   for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++) {
+      int restLen = loc_len[n] - proc_len[n];
+      if (restLen) {
+         CopyBlock(loc_src[n] + proc_len[n], pState->msgBuffer[n] + pState->msgBuffIdx[n], restLen);
+         pState->msgBuffIdx[n] += restLen;
+      }
+   }
+}
+
+void SHAKE256Final_mb8(int8u* const pa_md[8], int mdLen, SHAKE256State_mb8* pState)
+{
+   /* local buffers */
+   __ALIGN64 int8u buffer[SHAKE256_NUM_BUFFERS8][SHAKE256_RATE + 8];
+   __ALIGN64 const int8u* pa_buffer[SHAKE256_NUM_BUFFERS8];
+   __ALIGN64 int bufferLen[SHAKE256_NUM_BUFFERS8];
+   int n, i;
+
+   for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++) {
+      int inpLen = pState->msgBuffIdx[n];
+
+      bufferLen[n] = SHAKE256_RATE;
+      pa_buffer[n] = buffer[n];
+
+      /* copy rest of message into internal buffer and pad it (SHAKE domain bits 1111, pad10*1) */
+      CopyBlock(pState->msgBuffer[n], buffer[n], inpLen);
+      PadBlock(0, buffer[n] + inpLen, SHAKE256_RATE - inpLen);
+      buffer[n][inpLen] ^= 0x1F;
+      buffer[n][SHAKE256_RATE-1] ^= 0x80;
+   }
+   keccak_absorb_avx512_mb8(pState->state, pa_buffer, bufferLen);
+
+   /* squeeze */
+   for (i = 0; i < mdLen; i += SHAKE256_RATE) {
+      int outLen = MIN(mdLen - i, SHAKE256_RATE);
+
+      if (i) {
+         /* permute the state (absorb zero block) */
+         PadBlock(0, buffer, sizeof(buffer));
+         keccak_absorb_avx512_mb8(pState->state, pa_buffer, bufferLen);
+      }
+
+      for (n = 0; n < SHAKE256_NUM_BUFFERS8; n++) {
+         if (pa_md[n]) {
+            int k;
+            for (k = 0; k < outLen; k++)
+               pa_md[n][i + k] = (int8u)(pState->state[k/8][n] >> (8*(k%8)));
+         }
+      }
+   }
+
+   /* clear the rest of message (it may contain secret data) */
+   PadBlock(0, buffer, sizeof(buffer));
+   PadBlock(0, pState->msgBuffer, sizeof(pState->msgBuffer));
+
+   /* re-init state */
+   SHAKE256Init_mb8(pState);
+}
+
+void SHAKE256MsgDigest_mb8(const int8u* const pa_msg[8], const int32u len[8], int8u* const pa_md[8], int mdLen)
+{
+   SHAKE256State_mb8 state;
+
+   SHAKE256Init_mb8(&state);
+   SHAKE256Update_mb8(pa_msg, len, &state);
+   SHAKE256Final_mb8(pa_md, mdLen, &state);
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -321,8 +321,15 @@ void EXP52x79_mb8(int64u out[][8],
    /* pre-computed table of base powers */
    arr_pint64u_x8 red_table = (arr_pint64u_x8)(expz + LEN64 + 1);
 
+   /* zero-padded copy of modulus: squaring reads LEN52+1 digits of it */
+   pint64u_x8 modulus_pad = (pint64u_x8)(red_table + (1<<EXP_WIN_SIZE));
+
    int idx;
 
+   copy_mb8(modulus_pad, modulus, LEN52);
+   _mm512_store_si512(modulus_pad[LEN52], _mm512_setzero_si512());
+   modulus = (const int64u(*)[8])modulus_pad;
+
    /*
    // compute table of powers base^i, i=0, ..., (2^EXP_WIN_SIZE) -1
    */
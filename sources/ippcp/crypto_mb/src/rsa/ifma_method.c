@@ -18,6 +18,7 @@
 #include <internal/common/ifma_defs.h>
 #include <internal/rsa/ifma_rsa_arith.h>
 #include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/ifma_rsa_layer_cp.h>
 
 
 #define EXP_WIN_SIZE (5) //(4)
@@ -47,6 +48,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA1K_pub65537_Method)(void)
    return &m;
    #undef RSA_BITLEN
    #undef LEN52
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_1K),
+      RSA_1K,
+      AVX2_RSA_PUB_BUFF_SIZE(RSA_1K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -74,6 +88,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA2K_pub65537_Method)(void)
    return &m;
 #undef RSA_BITLEN
 #undef LEN52
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_2K),
+      RSA_2K,
+      AVX2_RSA_PUB_BUFF_SIZE(RSA_2K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -101,6 +128,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA3K_pub65537_Method)(void)
    return &m;
 #undef RSA_BITLEN
 #undef LEN52
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_3K),
+      RSA_3K,
+      AVX2_RSA_PUB_BUFF_SIZE(RSA_3K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -128,6 +168,99 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA4K_pub65537_Method)(void)
    return &m;
 #undef RSA_BITLEN
 #undef LEN52
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_4K),
+      RSA_4K,
+      AVX2_RSA_PUB_BUFF_SIZE(RSA_4K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
+#else
+   return NULL;
+#endif /* #if (_MBX>=_MBX_K1) */
+}
+
+DLL_PUBLIC
+const mbx_RSA_Method* OWNAPI(mbx_RSA6K_pub65537_Method)(void)
+{
+#if (_MBX>=_MBX_K1)
+#define RSA_BITLEN (RSA_6K)
+#define LEN52      (NUMBER_OF_DIGITS(RSA_BITLEN, DIGIT_SIZE))
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
+      RSA_BITLEN,
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2) * sizeof(int64u), /* buffer */
+      //ifma_BNU_to_mb8,
+      //NULL,
+      EXP52x119_pub65537_mb8,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
+#undef RSA_BITLEN
+#undef LEN52
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_6K),
+      RSA_6K,
+      AVX2_RSA_PUB_BUFF_SIZE(RSA_6K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
+#else
+   return NULL;
+#endif /* #if (_MBX>=_MBX_K1) */
+}
+
+DLL_PUBLIC
+const mbx_RSA_Method* OWNAPI(mbx_RSA8K_pub65537_Method)(void)
+{
+#if (_MBX>=_MBX_K1)
+#define RSA_BITLEN (RSA_8K)
+#define LEN52      (NUMBER_OF_DIGITS(RSA_BITLEN, DIGIT_SIZE))
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_BITLEN),
+      RSA_BITLEN,
+      64 + (8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2) * sizeof(int64u), /* buffer */
+      //ifma_BNU_to_mb8,
+      //NULL,
+      EXP52x158_pub65537_mb8,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
+#undef RSA_BITLEN
+#undef LEN52
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PUB_KEY,RSA_8K),
+      RSA_8K,
+      AVX2_RSA_PUB_BUFF_SIZE(RSA_8K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -141,6 +274,8 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA_pub65537_Method)(int rsaBitsize)
    case RSA_2K: return mbx_RSA2K_pub65537_Method();
    case RSA_3K: return mbx_RSA3K_pub65537_Method();
    case RSA_4K: return mbx_RSA4K_pub65537_Method();
+   case RSA_6K: return mbx_RSA6K_pub65537_Method();
+   case RSA_8K: return mbx_RSA8K_pub65537_Method();
    default: return NULL;
    }
 }
@@ -173,6 +308,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA1K_private_Method)(void)
    #undef RSA_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV2_KEY,RSA_1K),
+      RSA_1K,
+      AVX2_RSA_PRV2_BUFF_SIZE(RSA_1K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -202,6 +350,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA2K_private_Method)(void)
    #undef RSA_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV2_KEY,RSA_2K),
+      RSA_2K,
+      AVX2_RSA_PRV2_BUFF_SIZE(RSA_2K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -231,6 +392,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA3K_private_Method)(void)
    #undef RSA_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV2_KEY,RSA_3K),
+      RSA_3K,
+      AVX2_RSA_PRV2_BUFF_SIZE(RSA_3K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -246,7 +420,7 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA4K_private_Method)(void)
    static mbx_RSA_Method m = {
       RSA_ID(RSA_PRV2_KEY,RSA_BITLEN),
       RSA_BITLEN,
-      64 + (8 + LEN64*8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2 + 1 + (LEN64+1)*8 + (1<<EXP_WIN_SIZE)*LEN52*8) * sizeof(int64u), /* buffer */
+      64 + (8 + LEN64*8 + LEN52*8 + LEN52*8 + MULTIPLE_OF(LEN52,10)*8 + (LEN52*8)*2 + 1 + (LEN64+1)*8 + (1<<EXP_WIN_SIZE)*LEN52*8 + (LEN52+1)*8) * sizeof(int64u), /* buffer */
       //ifma_BNU_to_mb8,
       //NULL,
       NULL,
@@ -260,6 +434,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA4K_private_Method)(void)
    #undef RSA_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV2_KEY,RSA_4K),
+      RSA_4K,
+      AVX2_RSA_PRV2_BUFF_SIZE(RSA_4K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -307,6 +494,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA1K_private_crt_Method)(void)
    #undef FACTOR_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_1K),
+      RSA_1K,
+      AVX2_RSA_PRV5_BUFF_SIZE(RSA_1K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -338,6 +538,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA2K_private_crt_Method)(void)
    #undef FACTOR_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_2K),
+      RSA_2K,
+      AVX2_RSA_PRV5_BUFF_SIZE(RSA_2K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -369,6 +582,19 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA3K_private_crt_Method)(void)
    #undef FACTOR_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_3K),
+      RSA_3K,
+      AVX2_RSA_PRV5_BUFF_SIZE(RSA_3K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -400,6 +626,107 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA4K_private_crt_Method)(void)
    #undef FACTOR_BITLEN
    #undef LEN52
    #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_4K),
+      RSA_4K,
+      AVX2_RSA_PRV5_BUFF_SIZE(RSA_4K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
+#else
+   return NULL;
+#endif /* #if (_MBX>=_MBX_K1) */
+}
+
+DLL_PUBLIC
+const mbx_RSA_Method* OWNAPI(mbx_RSA6K_private_crt_Method)(void)
+{
+#if (_MBX>=_MBX_K1)
+   #define RSA_BITLEN (RSA_6K)
+   #define FACTOR_BITLEN (RSA_BITLEN/2)
+   #define LEN52      (NUMBER_OF_DIGITS(FACTOR_BITLEN, DIGIT_SIZE))
+   #define LEN64      (NUMBER_OF_DIGITS(FACTOR_BITLEN, 64))
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_BITLEN),
+      RSA_BITLEN,
+      64 + (8 + LEN52*8 + LEN52*8 + LEN64*8 + LEN52*8 + LEN52*8 + LEN52*8 + 2*LEN52*8 + (LEN52*8)*2 + (LEN64+1)*8 + (1<<EXP_WIN_SIZE)*LEN52*8) * sizeof(int64u), /* buffer */
+      //ifma_BNU_to_mb8,
+      //NULL,
+      NULL,
+      EXP52x60_mb8,
+      ifma_amred52x60_mb8,
+      ifma_amm52x60_mb8,
+      ifma_modsub52x60_mb8,
+      ifma_addmul52x60_mb8
+   };
+   return &m;
+   #undef RSA_BITLEN
+   #undef FACTOR_BITLEN
+   #undef LEN52
+   #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_6K),
+      RSA_6K,
+      AVX2_RSA_PRV5_BUFF_SIZE(RSA_6K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
+#else
+   return NULL;
+#endif /* #if (_MBX>=_MBX_K1) */
+}
+
+DLL_PUBLIC
+const mbx_RSA_Method* OWNAPI(mbx_RSA8K_private_crt_Method)(void)
+{
+#if (_MBX>=_MBX_K1)
+   #define RSA_BITLEN (RSA_8K)
+   #define FACTOR_BITLEN (RSA_BITLEN/2)
+   #define LEN52      (NUMBER_OF_DIGITS(FACTOR_BITLEN, DIGIT_SIZE))
+   #define LEN64      (NUMBER_OF_DIGITS(FACTOR_BITLEN, 64))
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_BITLEN),
+      RSA_BITLEN,
+      64 + (8 + LEN52*8 + LEN52*8 + LEN64*8 + LEN52*8 + LEN52*8 + LEN52*8 + 2*LEN52*8 + (LEN52*8)*2 + 8 + (LEN64+1)*8 + (1<<EXP_WIN_SIZE)*LEN52*8 + (LEN52+1)*8) * sizeof(int64u), /* buffer */
+      //ifma_BNU_to_mb8,
+      //NULL,
+      NULL,
+      EXP52x79_mb8,
+      ifma_amred52x79_mb8,
+      ifma_amm52x79_mb8,
+      ifma_modsub52x79_mb8,
+      ifma_addmul52x79_mb8
+   };
+   return &m;
+   #undef RSA_BITLEN
+   #undef FACTOR_BITLEN
+   #undef LEN52
+   #undef LEN64
+#elif (_MBX==_MBX_L9)
+   static mbx_RSA_Method m = {
+      RSA_ID(RSA_PRV5_KEY,RSA_8K),
+      RSA_8K,
+      AVX2_RSA_PRV5_BUFF_SIZE(RSA_8K), /* buffer */
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL
+   };
+   return &m;
 #else
    return NULL;
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -413,6 +740,8 @@ const mbx_RSA_Method* OWNAPI(mbx_RSA_private_crt_Method)(int rsaBitsize)
    case RSA_2K: return mbx_RSA2K_private_crt_Method();
    case RSA_3K: return mbx_RSA3K_private_crt_Method();
    case RSA_4K: return mbx_RSA4K_private_crt_Method();
+   case RSA_6K: return mbx_RSA6K_private_crt_Method();
+   case RSA_8K: return mbx_RSA8K_private_crt_Method();
    default: return NULL;
    }
 }
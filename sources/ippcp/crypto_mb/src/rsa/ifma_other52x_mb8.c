@@ -291,6 +291,115 @@ void ifma_modsub52x40_mb8(int64u res[][8], const int64u inpA[][8], const int64u
 #undef MSD_MSK
 }
 
+void ifma_modsub52x60_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8])
+{
+#define BITSIZE   (RSA_6K/2)
+#define LEN52     (NUMBER_OF_DIGITS(BITSIZE,52))
+#define MSD_MSK   (MS_DIGIT_MASK(BITSIZE,52))
+
+   __m512i* pr = (__m512i*)res;
+   __m512i* pa = (__m512i*)inpA;
+   __m512i* pb = (__m512i*)inpB;
+   __m512i* pm = (__m512i*)inpM;
+
+   __m512i DIG_MASK = _mm512_set1_epi64(DIGIT_MASK);
+   __m512i MSD_MASK = _mm512_set1_epi64(MSD_MSK);
+
+   __m512i T[LEN52];
+   __m512i R, CARRY, BORROW;
+   int n;
+
+   /* T[] = a[] - b[] */
+   BORROW = _mm512_setzero_si512();
+
+   for (n = 0; n < LEN52; n++) {
+      R = _mm512_sub_epi64(pa[n], pb[n]);
+      R = _mm512_sub_epi64(R, BORROW);
+      BORROW = _mm512_srli_epi64(R, (64 - 1));
+      R = _mm512_and_epi64(R, DIG_MASK);
+      _mm512_store_si512(T + n, R);
+   }
+
+   /* correct last digit */
+   R = _mm512_and_epi64(R, MSD_MASK);
+   _mm512_store_si512(T + LEN52 - 1, R);
+
+   /* masked modulus add: r[] = T[] + BORROW? m[] : 0 */
+   CARRY = _mm512_setzero_si512();
+   BORROW = _mm512_sub_epi64(CARRY, BORROW); /* RORROW -> mask */
+
+   for (n = 0; n < LEN52; n++) {
+      R = _mm512_and_epi64(BORROW, pm[n]);
+      R = _mm512_add_epi64(R, T[n]);
+      R = _mm512_add_epi64(R, CARRY);
+      CARRY = _mm512_srli_epi64(R, DIGIT_SIZE);
+      R = _mm512_and_epi64(R, DIG_MASK);
+      _mm512_store_si512(pr + n, R);
+   }
+   /* correct last digit */
+   R = _mm512_and_epi64(R, MSD_MASK);
+   _mm512_store_si512(pr + LEN52 - 1, R);
+
+#undef BITSIZE
+#undef LEN52
+#undef MSD_MSK
+}
+
+void ifma_modsub52x79_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpB[][8], const int64u inpM[][8])
+{
+#define BITSIZE   (RSA_8K/2)
+#define LEN52     (NUMBER_OF_DIGITS(BITSIZE,52))
+#define MSD_MSK   (MS_DIGIT_MASK(BITSIZE,52))
+
+   __m512i* pr = (__m512i*)res;
+   __m512i* pa = (__m512i*)inpA;
+   __m512i* pb = (__m512i*)inpB;
+   __m512i* pm = (__m512i*)inpM;
+
+   __m512i DIG_MASK = _mm512_set1_epi64(DIGIT_MASK);
+   __m512i MSD_MASK = _mm512_set1_epi64(MSD_MSK);
+
+   __m512i T[LEN52];
+   __m512i R, CARRY, BORROW;
+   int n;
+
+   /* T[] = a[] - b[] */
+   BORROW = _mm512_setzero_si512();
+
+   for (n = 0; n < LEN52; n++) {
+      R = _mm512_sub_epi64(pa[n], pb[n]);
+      R = _mm512_sub_epi64(R, BORROW);
+      BORROW = _mm512_srli_epi64(R, (64 - 1));
+      R = _mm512_and_epi64(R, DIG_MASK);
+      _mm512_store_si512(T + n, R);
+   }
+
+   /* correct last digit */
+   R = _mm512_and_epi64(R, MSD_MASK);
+   _mm512_store_si512(T + LEN52 - 1, R);
+
+   /* masked modulus add: r[] = T[] + BORROW? m[] : 0 */
+   CARRY = _mm512_setzero_si512();
+   BORROW = _mm512_sub_epi64(CARRY, BORROW); /* RORROW -> mask */
+
+   for (n = 0; n < LEN52; n++) {
+      R = _mm512_and_epi64(BORROW, pm[n]);
+      R = _mm512_add_epi64(R, T[n]);
+      R = _mm512_add_epi64(R, CARRY);
+      CARRY = _mm512_srli_epi64(R, DIGIT_SIZE);
+      R = _mm512_and_epi64(R, DIG_MASK);
+      _mm512_store_si512(pr + n, R);
+   }
+   /* correct last digit */
+   R = _mm512_and_epi64(R, MSD_MASK);
+   _mm512_store_si512(pr + LEN52 - 1, R);
+
+#undef BITSIZE
+#undef LEN52
+#undef MSD_MSK
+}
+
+
 
 /* r += a*b */
 void ifma_addmul52x10_mb8(int64u pRes[][8], const int64u inpA[][8], const int64u inpB[][8])
@@ -1233,6 +1342,66 @@ void ifma_addmul52x40_mb8(int64u pRes[][8], const int64u inpA[][8], const int64u
    #undef MSD_MSK
 }
 
+/*
+// r += a*b of the length the accumulator does not fit the register file:
+// a loop over R[] instead of the unrolled code above
+*/
+#define MAX_LEN52_FACTOR   (NUMBER_OF_DIGITS(RSA_8K/2,52))
+
+static void addmul52x_mb8(int64u pRes[][8], const int64u inpA[][8], const int64u inpB[][8], int len)
+{
+   __m512i* pr = (__m512i*)pRes;
+   __m512i* pa = (__m512i*)inpA;
+   __m512i* pb = (__m512i*)inpB;
+
+   __m512i DIG_MASK = _mm512_set1_epi64(DIGIT_MASK);
+
+   __m512i R[MAX_LEN52_FACTOR];
+   int itr, n;
+
+   for (n = 0; n < len; n++)
+      R[n] = _mm512_load_si512(pr + n);
+
+   for (itr = 0; itr < len; itr++) {
+      __m512i Bi = _mm512_load_si512(pb);
+      __m512i nxtR = _mm512_load_si512(pr + len);
+      pb++;
+
+      for (n = 0; n < len; n++)
+         R[n] = _mm512_madd52lo_epu64(R[n], Bi, pa[n]);
+
+      _mm512_store_si512(pr, _mm512_and_epi64(R[0], DIG_MASK)); /* store normalized result */
+      pr++;
+
+      R[0] = _mm512_srli_epi64(R[0], DIGIT_SIZE);
+      R[1] = _mm512_add_epi64(R[1], R[0]);
+
+      for (n = 0; n < len - 1; n++)
+         R[n] = _mm512_madd52hi_epu64(R[n + 1], Bi, pa[n]);
+      R[len - 1] = _mm512_madd52hi_epu64(nxtR, Bi, pa[len - 1]);
+   }
+   /* normalization */
+   {
+      __m512i T = _mm512_setzero_si512();
+      for (n = 0; n < len; n++) {
+         R[n] = _mm512_add_epi64(R[n], T);
+         T = _mm512_srli_epi64(R[n], DIGIT_SIZE);
+         _mm512_store_si512(pr + n, _mm512_and_epi64(R[n], DIG_MASK));
+      }
+   }
+}
+
+void ifma_addmul52x60_mb8(int64u pRes[][8], const int64u inpA[][8], const int64u inpB[][8])
+{
+   addmul52x_mb8(pRes, inpA, inpB, NUMBER_OF_DIGITS(RSA_6K/2,52));
+}
+
+void ifma_addmul52x79_mb8(int64u pRes[][8], const int64u inpA[][8], const int64u inpB[][8])
+{
+   addmul52x_mb8(pRes, inpA, inpB, NUMBER_OF_DIGITS(RSA_8K/2,52));
+}
+
+
 
 /* r = x * (R^-1) mod q */
 void ifma_amred52x10_mb8(int64u res[][8],
@@ -2150,6 +2319,63 @@ void ifma_amred52x40_mb8(int64u res[][8],
       _mm512_store_si512(pR + 8 * 39, R39);
    }
 }
+
+/* r = x * (R^-1) mod q, loop version of the above */
+static void amred52x_mb8(int64u res[][8],
+   const int64u inpA[][8], /* int nsA == 2*nsM */
+   const int64u inpM[][8], /* int nsM == len */
+   const int64u k0[8],
+   int len)
+{
+   __m512i* pA = (__m512i*)inpA;
+   __m512i* pM = (__m512i*)inpM;
+   __m512i* pR = (__m512i*)res;
+
+   __m512i K = _mm512_load_si512(k0);     /* k0[] */
+
+   __m512i R[MAX_LEN52_FACTOR];
+   int itr, n;
+
+   for (n = 0; n < len; n++)
+      R[n] = _mm512_load_si512(pA + n); /* load A[nsM-1],...,A[0] */
+
+   for (itr = 0, pA += len; itr < len; itr++, pA++) {
+      __m512i Yi = _mm512_madd52lo_epu64(_mm512_setzero_si512(), R[0], K);
+      __m512i nxtA = _mm512_load_si512(pA);
+
+      for (n = 0; n < len; n++)
+         R[n] = _mm512_madd52lo_epu64(R[n], Yi, pM[n]);
+
+      R[0] = _mm512_srli_epi64(R[0], DIGIT_SIZE);
+      R[1] = _mm512_add_epi64(R[1], R[0]);
+
+      for (n = 0; n < len - 1; n++)
+         R[n] = _mm512_madd52hi_epu64(R[n + 1], Yi, pM[n]);
+      R[len - 1] = _mm512_madd52hi_epu64(nxtA, Yi, pM[len - 1]);
+   }
+
+   /* normalization */
+   {
+      __m512i MASK = _mm512_set1_epi64(DIGIT_MASK);
+      __m512i T = _mm512_setzero_si512();
+      for (n = 0; n < len; n++) {
+         R[n] = _mm512_add_epi64(R[n], T);
+         T = _mm512_srli_epi64(R[n], DIGIT_SIZE);
+         _mm512_store_si512(pR + n, _mm512_and_epi64(R[n], MASK));
+      }
+   }
+}
+
+void ifma_amred52x60_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8])
+{
+   amred52x_mb8(res, inpA, inpM, k0, NUMBER_OF_DIGITS(RSA_6K/2,52));
+}
+
+void ifma_amred52x79_mb8(int64u res[][8], const int64u inpA[][8], const int64u inpM[][8], const int64u k0[8])
+{
+   amred52x_mb8(res, inpA, inpM, k0, NUMBER_OF_DIGITS(RSA_8K/2,52));
+}
+
 //////////////////////////////////////////////////////////////////////
 
 /*
@@ -2374,7 +2600,7 @@ void ifma_mreduce52x_mb8(int64u pX[][8], int nsX, int64u pM[][8], int nsM)
 /* rr = 2^(2*ifmaBitLen) mod m */
 void ifma_montRR52x_mb8 (int64u pRR[][8], int64u pM[][8], int convBitLen)
 {
-   #define MAX_IFMA_MODULUS_BITLEN  BASE52_BITSIZE(RSA_4K)
+   #define MAX_IFMA_MODULUS_BITLEN  BASE52_BITSIZE(RSA_8K)
 
    /* buffer to hold 2^(2*MAX_IFMA_MODULUS_BITLEN) */
    __ALIGN64 int64u pwr2_mb8[(NUMBER_OF_DIGITS(2 * MAX_IFMA_MODULUS_BITLEN + 1, DIGIT_SIZE)) + 1][8]; /* +1 is necessary extension for ifma_mreduce52x_mb8() purpose */
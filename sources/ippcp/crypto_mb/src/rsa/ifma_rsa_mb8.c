@@ -49,7 +49,8 @@ mbx_status OWNAPI(mbx_rsa_public_mb8)(const int8u* const from_pa[8],
    }
    /* test rsa modulus size */
    if(RSA_1K != expected_rsa_bitsize && RSA_2K != expected_rsa_bitsize &&
-      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize) {
+      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize &&
+      RSA_6K != expected_rsa_bitsize && RSA_8K != expected_rsa_bitsize) {
       status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
       return status;
    }
@@ -110,6 +111,10 @@ mbx_status OWNAPI(mbx_rsa_public_mb8)(const int8u* const from_pa[8],
       ifma_cp_rsa_pub_layer_mb8(from_pa, to_pa, n_pa,
                                 expected_rsa_bitsize, meth,
                                 buffer);
+#elif (_MBX==_MBX_L9)
+      avx2_cp_rsa_pub_layer_mb8(from_pa, to_pa, n_pa,
+                                expected_rsa_bitsize, meth,
+                                buffer);
 #else
       status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -205,6 +210,10 @@ mbx_status OWNAPI(mbx_rsa_private_mb8)(const int8u* const from_pa[8],
       ifma_cp_rsa_prv2_layer_mb8(from_pa, to_pa, d_pa, n_pa,
                                 expected_rsa_bitsize, meth,
                                 buffer);
+#elif (_MBX==_MBX_L9)
+      avx2_cp_rsa_prv2_layer_mb8(from_pa, to_pa, d_pa, n_pa,
+                                 expected_rsa_bitsize, meth,
+                                 buffer);
 #else
       status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -243,7 +252,8 @@ mbx_status OWNAPI(mbx_rsa_private_crt_mb8)(const int8u* const from_pa[8],
    }
    /* test rsa modulus size */
    if(RSA_1K != expected_rsa_bitsize && RSA_2K != expected_rsa_bitsize &&
-      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize) {
+      RSA_3K != expected_rsa_bitsize && RSA_4K != expected_rsa_bitsize &&
+      RSA_6K != expected_rsa_bitsize && RSA_8K != expected_rsa_bitsize) {
       status = MBX_SET_STS_ALL(MBX_STATUS_MISMATCH_PARAM_ERR);
       return status;
    }
@@ -308,6 +318,10 @@ mbx_status OWNAPI(mbx_rsa_private_crt_mb8)(const int8u* const from_pa[8],
       ifma_cp_rsa_prv5_layer_mb8(from_pa, to_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa,
                                 expected_rsa_bitsize, meth,
                                 buffer);
+#elif (_MBX==_MBX_L9)
+      avx2_cp_rsa_prv5_layer_mb8(from_pa, to_pa, p_pa, q_pa, dp_pa, dq_pa, iq_pa,
+                                 expected_rsa_bitsize, meth,
+                                 buffer);
 #else
       status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -321,3 +335,165 @@ mbx_status OWNAPI(mbx_rsa_private_crt_mb8)(const int8u* const from_pa[8],
    return status;
 }
 
+
+/* supported modulus size of the mixed batch */
+static int is_rsa_mixed_bitsize(int rsaBitlen)
+{
+   return RSA_1K == rsaBitlen || RSA_2K == rsaBitlen || RSA_3K == rsaBitlen ||
+          RSA_4K == rsaBitlen || RSA_6K == rsaBitlen || RSA_8K == rsaBitlen;
+}
+
+/*
+// lanes of the batch having the same modulus size as the buf_no-th one
+// (and not processed yet)
+*/
+static int8u rsa_size_group(const int rsaBitlen[8], int buf_no, int8u done)
+{
+   int8u group = 0;
+   int n;
+   for(n=buf_no; n<8; n++) {
+      if(rsaBitlen[n] == rsaBitlen[buf_no])
+         group |= (int8u)(1<<n);
+   }
+   return group & (int8u)(~done);
+}
+
+/* status of the group's lanes */
+static mbx_status rsa_group_status(mbx_status status, mbx_status groupStatus, int8u group)
+{
+   int n;
+   for(n=0; n<8; n++) {
+      if((group>>n) & 1)
+         status = MBX_SET_STS(status, n, MBX_GET_STS(groupStatus, n));
+   }
+   return status;
+}
+
+/*
+// y = x^65537 mod n over the batch of different modulus sizes
+// pBuffer (if not NULL) is reused by every size group and must be of
+// mbx_RSA_Method_BufSize(mbx_RSA_pub65537_Method(maxBitlen)) size
+*/
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_rsa_public_mixed_mb8)(const int8u* const from_pa[8],
+                                          int8u* const to_pa[8],
+                                   const int64u* const n_pa[8],
+                                      const int rsaBitlen[8],
+                                          int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int8u done = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa || NULL==n_pa || NULL==rsaBitlen) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int8u* from[8] = {0};
+            int8u* to[8] = {0};
+      const int64u* n[8] = {0};
+      int8u group;
+      int lane;
+
+      if((done>>buf_no) & 1)
+         continue;
+
+      /* unsupported modulus size */
+      if(!is_rsa_mixed_bitsize(rsaBitlen[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         done |= (int8u)(1<<buf_no);
+         continue;
+      }
+
+      /* lanes of other sizes are passed as NULL */
+      group = rsa_size_group(rsaBitlen, buf_no, done);
+      for(lane=0; lane<8; lane++) {
+         if((group>>lane) & 1) {
+            from[lane] = from_pa[lane];
+            to[lane]   = to_pa[lane];
+            n[lane]    = n_pa[lane];
+         }
+      }
+
+      status = rsa_group_status(status,
+                                OWNAPI(mbx_rsa_public_mb8)(from, to, n, rsaBitlen[buf_no], NULL, pBuffer),
+                                group);
+      done |= group;
+   }
+
+   return status;
+}
+
+/*
+// x = y^d mod n (CRT) over the batch of different modulus sizes
+// pBuffer (if not NULL) is reused by every size group and must be of
+// mbx_RSA_Method_BufSize(mbx_RSA_private_crt_Method(maxBitlen)) size
+*/
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_rsa_private_crt_mixed_mb8)(const int8u* const from_pa[8],
+                                               int8u* const to_pa[8],
+                                        const int64u* const p_pa[8],
+                                        const int64u* const q_pa[8],
+                                        const int64u* const dp_pa[8],
+                                        const int64u* const dq_pa[8],
+                                        const int64u* const iq_pa[8],
+                                           const int rsaBitlen[8],
+                                               int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int8u done = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==from_pa || NULL==to_pa ||
+      NULL==p_pa || NULL==q_pa || NULL==dp_pa || NULL==dq_pa || NULL==iq_pa || NULL==rsaBitlen) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   for(buf_no=0; buf_no<8; buf_no++) {
+      const int8u* from[8] = {0};
+            int8u* to[8] = {0};
+      const int64u* p[8] = {0};
+      const int64u* q[8] = {0};
+      const int64u* dp[8] = {0};
+      const int64u* dq[8] = {0};
+      const int64u* iq[8] = {0};
+      int8u group;
+      int lane;
+
+      if((done>>buf_no) & 1)
+         continue;
+
+      /* unsupported modulus size */
+      if(!is_rsa_mixed_bitsize(rsaBitlen[buf_no])) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+         done |= (int8u)(1<<buf_no);
+         continue;
+      }
+
+      /* lanes of other sizes are passed as NULL */
+      group = rsa_size_group(rsaBitlen, buf_no, done);
+      for(lane=0; lane<8; lane++) {
+         if((group>>lane) & 1) {
+            from[lane] = from_pa[lane];
+            to[lane]   = to_pa[lane];
+            p[lane]    = p_pa[lane];
+            q[lane]    = q_pa[lane];
+            dp[lane]   = dp_pa[lane];
+            dq[lane]   = dq_pa[lane];
+            iq[lane]   = iq_pa[lane];
+         }
+      }
+
+      status = rsa_group_status(status,
+                                OWNAPI(mbx_rsa_private_crt_mb8)(from, to, p, q, dp, dq, iq, rsaBitlen[buf_no], NULL, pBuffer),
+                                group);
+      done |= group;
+   }
+
+   return status;
+}
@@ -217,8 +217,8 @@ void ifma_ssl_rsa4K_prv2_layer_mb8(const int8u* const from_pa[8],
    __ALIGN64 int64u inout_mb8[LEN52][8];
    /* MULTIPLE_OF_10 because of AMS5x52x79_diagonal_mb8() implementation specific */
    __ALIGN64 int64u   n_mb8[MULTIPLE_OF(LEN52, 10)][8];
-   /* allocate stack for red(undant) result, multiplier, for exponent X and for pre-computed table of base powers */
-   __ALIGN64 int64u work_buffer[LEN52*2 + 1 + (LEN64 + 1) + (1 << EXP_WIN_SIZE)*LEN52][8];
+   /* allocate stack for red(undant) result, multiplier, for exponent X, for pre-computed table of base powers and for zero-padded modulus */
+   __ALIGN64 int64u work_buffer[LEN52*2 + 1 + (LEN64 + 1) + (1 << EXP_WIN_SIZE)*LEN52 + (LEN52 + 1)][8];
 
    /* convert modulus to ifma fmt */
    zero_mb8(n_mb8, MULTIPLE_OF(LEN52, 10));
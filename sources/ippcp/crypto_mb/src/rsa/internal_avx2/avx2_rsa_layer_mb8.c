@@ -0,0 +1,238 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/rsa.h>
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_arith26_mb8.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/rsa/ifma_rsa_method.h>
+#include <internal/rsa/ifma_rsa_layer_cp.h>
+
+#if (_MBX==_MBX_L9)
+
+/*
+// public exponent e=65537 implied
+*/
+void avx2_cp_rsa_pub_layer_mb8(const int8u* const from_pa[8],
+                                     int8u* const to_pa[8],
+                               const int64u* const n_pa[8],
+                                     int rsaBitlen,
+                               const mbx_RSA_Method* m,
+                                     int8u* pBuffer)
+{
+   int len26 = LEN26(rsaBitlen);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 n_mb8 = k0_mb8 +1;
+   pint64u_x8 rr_mb8 = n_mb8 +len26;
+   pint64u_x8 inout_mb8 = rr_mb8 +len26;
+   pint64u_x8 work_buffer = inout_mb8 +len26;
+
+   (void)m;
+
+   /* convert modulus to radix 2^26 */
+   avx2_BNU_to_mb8_26(n_mb8, n_pa, rsaBitlen, len26);
+
+   /* compute k0[] */
+   avx2_montFactor26_mb8(k0_mb8[0], (const int64u(*)[8])n_mb8);
+
+   /* compute to_Montgomery domain converter */
+   avx2_montRR26_mb8(rr_mb8, (const int64u(*)[8])n_mb8, k0_mb8[0], len26);
+
+   /* convert input to radix 2^26 */
+   avx2_HexStr8_to_mb8_26(inout_mb8, from_pa, rsaBitlen, len26);
+
+   /* exponentiation */
+   avx2_modexp26_65537_mb8(inout_mb8,
+            (const int64u(*)[8])inout_mb8,
+            (const int64u(*)[8])n_mb8,
+            (const int64u(*)[8])rr_mb8,
+            k0_mb8[0], len26,
+            work_buffer);
+
+   /* convert result */
+   avx2_mb8_26_to_HexStr8(to_pa, (const int64u(*)[8])inout_mb8, rsaBitlen);
+}
+
+/*
+// private key
+*/
+void avx2_cp_rsa_prv2_layer_mb8(const int8u* const from_pa[8],
+                                      int8u* const to_pa[8],
+                                const int64u* const d_pa[8],
+                                const int64u* const n_pa[8],
+                                      int rsaBitlen,
+                                const mbx_RSA_Method* m,
+                                      int8u* pBuffer)
+{
+   int len26 = LEN26(rsaBitlen);
+   int len64 = NUMBER_OF_DIGITS(rsaBitlen, 64);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 d_mb8 = k0_mb8 +1;
+   pint64u_x8 n_mb8 = d_mb8 +len64;
+   pint64u_x8 rr_mb8 = n_mb8 +len26;
+   pint64u_x8 inout_mb8 = rr_mb8 +len26;
+   pint64u_x8 work_buffer = inout_mb8 +len26;
+
+   (void)m;
+
+   /* convert modulus to radix 2^26 */
+   avx2_BNU_to_mb8_26(n_mb8, n_pa, rsaBitlen, len26);
+
+   /* compute k0[] */
+   avx2_montFactor26_mb8(k0_mb8[0], (const int64u(*)[8])n_mb8);
+
+   /* compute to_Montgomery domain converter */
+   avx2_montRR26_mb8(rr_mb8, (const int64u(*)[8])n_mb8, k0_mb8[0], len26);
+
+   /* convert input to radix 2^26 */
+   avx2_HexStr8_to_mb8_26(inout_mb8, from_pa, rsaBitlen, len26);
+
+   /* re-arrange exps */
+   avx2_BNU_transpose_copy(d_mb8, d_pa, rsaBitlen);
+
+   /* exponentiation */
+   avx2_modexp26_mb8(inout_mb8,
+      (const int64u(*)[8])inout_mb8,
+      (const int64u(*)[8])d_mb8, rsaBitlen,
+      (const int64u(*)[8])n_mb8,
+      (const int64u(*)[8])rr_mb8,
+      k0_mb8[0], len26,
+      work_buffer);
+
+   /* convert result */
+   avx2_mb8_26_to_HexStr8(to_pa, (const int64u(*)[8])inout_mb8, rsaBitlen);
+
+   /* clear exponents */
+   avx2_zero26_mb8(d_mb8, len64);
+}
+
+/*
+// private key (crt)
+*/
+void avx2_cp_rsa_prv5_layer_mb8(const int8u* const from_pa[8],
+                                      int8u* const to_pa[8],
+                                const int64u* const p_pa[8],
+                                const int64u* const q_pa[8],
+                                const int64u* const dp_pa[8],
+                                const int64u* const dq_pa[8],
+                                const int64u* const iq_pa[8],
+                                      int rsaBitlen,
+                                const mbx_RSA_Method* m,
+                                      int8u* pBuffer)
+{
+   int factorBitlen = rsaBitlen/2;
+   int len26 = LEN26(factorBitlen);
+   int len64 = NUMBER_OF_DIGITS(factorBitlen, 64);
+
+   /* 64-byte aligned buffer of int64[8] */
+   pint64u_x8 pBuffer_x8 = (pint64u_x8)IFMA_ALIGNED_PTR(pBuffer,64);
+
+   /* allocate mb8 buffers */
+   pint64u_x8 k0_mb8 = pBuffer_x8;
+   pint64u_x8 p_mb8 = k0_mb8 +1;
+   pint64u_x8 q_mb8 = p_mb8 +len26;
+   pint64u_x8 d_mb8 = q_mb8 +len26;
+   pint64u_x8 rr_mb8 = d_mb8 +len64;
+   pint64u_x8 xp_mb8 = rr_mb8 +len26;
+   pint64u_x8 xq_mb8 = xp_mb8 +len26;
+   pint64u_x8 inp_mb8 = xq_mb8 +len26;
+   pint64u_x8 work_buffer = inp_mb8 +len26*2;
+
+   (void)m;
+
+   /* convert input to radix 2^26 */
+   avx2_HexStr8_to_mb8_26(inp_mb8, from_pa, rsaBitlen, len26*2);
+
+   /*
+   // q exponentiation
+   */
+   avx2_BNU_to_mb8_26(q_mb8, q_pa, factorBitlen, len26);
+   avx2_montFactor26_mb8(k0_mb8[0], (const int64u(*)[8])q_mb8);
+   avx2_montRR26_mb8(rr_mb8, (const int64u(*)[8])q_mb8, k0_mb8[0], len26);
+   /* xq = x mod q */
+   avx2_amred26_mb8(xq_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])q_mb8, k0_mb8[0], len26);
+   avx2_mont_mul26_mb8(xq_mb8, (const int64u(*)[8])xq_mb8, (const int64u(*)[8])rr_mb8, (const int64u(*)[8])q_mb8, k0_mb8[0], len26);
+   /* re-arrange exps */
+   avx2_BNU_transpose_copy(d_mb8, dq_pa, factorBitlen);
+
+   avx2_modexp26_mb8(xq_mb8,
+      (const int64u(*)[8])xq_mb8,
+      (const int64u(*)[8])d_mb8, factorBitlen,
+      (const int64u(*)[8])q_mb8,
+      (const int64u(*)[8])rr_mb8,
+      k0_mb8[0], len26,
+      work_buffer);
+
+   /*
+   // p exponentiation
+   */
+   avx2_BNU_to_mb8_26(p_mb8, p_pa, factorBitlen, len26);
+   avx2_montFactor26_mb8(k0_mb8[0], (const int64u(*)[8])p_mb8);
+   avx2_montRR26_mb8(rr_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0], len26);
+   /* xp = x mod p */
+   avx2_amred26_mb8(xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0], len26);
+   avx2_mont_mul26_mb8(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])rr_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0], len26);
+   /* re-arrange exps */
+   avx2_BNU_transpose_copy(d_mb8, dp_pa, factorBitlen);
+
+   avx2_modexp26_mb8(xp_mb8,
+      (const int64u(*)[8])xp_mb8,
+      (const int64u(*)[8])d_mb8, factorBitlen,
+      (const int64u(*)[8])p_mb8,
+      (const int64u(*)[8])rr_mb8,
+      k0_mb8[0], len26,
+      work_buffer);
+
+   /*
+   // crt recombination
+   */
+
+   /* xp = (xp-xq) mod p */
+   avx2_reduce26_mb8(inp_mb8, (const int64u(*)[8])xq_mb8, (const int64u(*)[8])p_mb8, len26); /* for specific case p<q */
+   avx2_sub26_mb8(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8, len26);
+
+   /* xp = (xp*coef) mod p */
+   avx2_BNU_to_mb8_26(inp_mb8, iq_pa, factorBitlen, len26); /* coef */
+   avx2_mont_mul26_mb8(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])rr_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0], len26);
+   avx2_mont_mul26_mb8(xp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])inp_mb8, (const int64u(*)[8])p_mb8, k0_mb8[0], len26);
+
+   /* xp = (xp*q + xq) */
+   avx2_zero26_mb8(inp_mb8, len26*2);
+   avx2_copy26_mb8(inp_mb8, (const int64u(*)[8])xq_mb8, len26);
+   avx2_addmul26_mb8(inp_mb8, (const int64u(*)[8])xp_mb8, (const int64u(*)[8])q_mb8, len26);
+
+   /* convert result */
+   avx2_mb8_26_to_HexStr8(to_pa, (const int64u(*)[8])inp_mb8, rsaBitlen);
+
+   /* clear exponents, p, q and partial results */
+   avx2_zero26_mb8(d_mb8, len64);
+   avx2_zero26_mb8(q_mb8, len26);
+   avx2_zero26_mb8(p_mb8, len26);
+   avx2_zero26_mb8(xp_mb8, len26);
+   avx2_zero26_mb8(xq_mb8, len26);
+}
+
+#endif /* #if (_MBX==_MBX_L9) */
@@ -0,0 +1,89 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <internal/common/ifma_math.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#if (_MBX>=_MBX_K1)
+
+/*
+// The accumulator does not fit the register file at these lengths,
+// so it is kept in memory and processed by the loop:
+// res = (res + Bi*A + Yi*M)/2^52 for each digit Bi of B
+//
+// The body is shared by all sizes; IFMA_AMM52xN_MB8(N) instantiates
+// ifma_amm52x<N>_mb8() with the constant length N.
+*/
+#define MAX_LEN52 (NUMBER_OF_DIGITS(RSA_8K,DIGIT_SIZE)) // 158
+
+__MBX_INLINE void amm52xN_mb8(int64u *out_mb, const int64u *inpA_mb,
+                              const int64u *inpB_mb, const int64u *inpM_mb,
+                              const int64u *k0_mb, const int len52) {
+  U64 res[MAX_LEN52];
+  U64 K = loadu64(k0_mb);
+  int itr, j;
+
+  for (j = 0; j < len52; j++)
+    res[j] = get_zero64();
+
+  for (itr = 0; itr < len52; itr++) {
+    U64 Bi = loadu64(inpB_mb + MB_WIDTH * itr);
+    U64 Aj = loadu64(inpA_mb);
+    U64 Mj = loadu64(inpM_mb);
+    U64 Yi, T;
+
+    T = fma52lo(res[0], Bi, Aj);
+    Yi = fma52lo(get_zero64(), T, K);
+    T = fma52lo(T, Yi, Mj);
+    T = srli64(T, DIGIT_SIZE);
+
+    for (j = 0; j < len52 - 1; j++) {
+      U64 Aj1 = loadu64(inpA_mb + MB_WIDTH * (j + 1));
+      U64 Mj1 = loadu64(inpM_mb + MB_WIDTH * (j + 1));
+      U64 R = fma52lo(res[j + 1], Bi, Aj1);
+      R = fma52lo(R, Yi, Mj1);
+      R = fma52hi(R, Bi, Aj);
+      res[j] = fma52hi(R, Yi, Mj);
+      Aj = Aj1;
+      Mj = Mj1;
+    }
+    res[len52 - 1] = fma52hi(fma52hi(get_zero64(), Bi, Aj), Yi, Mj);
+    res[0] = add64(res[0], T);
+  }
+
+  // Normalization
+  {
+    U64 T = get_zero64();
+    U64 MASK = set64(DIGIT_MASK);
+    for (j = 0; j < len52; j++) {
+      U64 R = add64(res[j], T);
+      T = srli64(R, DIGIT_SIZE);
+      storeu64(out_mb + MB_WIDTH * j, and64(R, MASK));
+    }
+  }
+}
+
+#define IFMA_AMM52xN_MB8(N) \
+void ifma_amm52x##N##_mb8(int64u *out_mb, const int64u *inpA_mb, \
+                          const int64u *inpB_mb, const int64u *inpM_mb, \
+                          const int64u *k0_mb) { \
+  amm52xN_mb8(out_mb, inpA_mb, inpB_mb, inpM_mb, k0_mb, N); \
+}
+
+IFMA_AMM52xN_MB8(119) // RSA_6K
+IFMA_AMM52xN_MB8(158) // RSA_8K
+
+#endif /* #if (_MBX>=_MBX_K1) */
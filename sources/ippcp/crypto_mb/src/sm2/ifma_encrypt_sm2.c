@@ -0,0 +1,129 @@
+/*************************************************************************
+* Copyright (C) 2021 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_sm2.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/sm2/ifma_ecpoint_sm2.h>
+
+/* size of C1||C3 part of the ciphertext */
+#define SM2_CIPHER_OVERHEAD   (1 + 32+32 + 32)
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_sm2_encrypt_mb8)(int8u* pa_out[8],
+                  const int8u* const pa_msg[8],
+                           const int msg_len[8],
+                 const int64u* const pa_eph_skey[8],
+                 const int64u* const pa_pubx[8],
+                 const int64u* const pa_puby[8],
+                 const int64u* const pa_pubz[8],
+                              int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* pa_pubz!=0 means the output is in Jacobian projective coordinates */
+   int use_jproj_coords = NULL!=pa_pubz;
+
+   /* test input pointers */
+   if(NULL==pa_out || NULL==pa_msg || NULL==msg_len || NULL==pa_eph_skey || NULL==pa_pubx || NULL==pa_puby) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int8u* out = pa_out[buf_no];
+      const int8u* msg = pa_msg[buf_no];
+      const int64u* eph_skey = pa_eph_skey[buf_no];
+      const int64u* pubx = pa_pubx[buf_no];
+      const int64u* puby = pa_puby[buf_no];
+      const int64u* pubz = use_jproj_coords? pa_pubz[buf_no] : NULL;
+
+      /* if any of pointer NULL set error status */
+      if(NULL==out || (NULL==msg && msg_len[buf_no]) || NULL==eph_skey || NULL==pubx || NULL==puby || (use_jproj_coords && NULL==pubz)) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      if(msg_len[buf_no] < 0) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /*
+   // processing
+   */
+
+#if (_MBX>=_MBX_K1)
+   status = internal_avx512_sm2_encrypt_mb8(pa_out, pa_msg, msg_len, pa_eph_skey, pa_pubx, pa_puby, pa_pubz,
+                                            pBuffer, use_jproj_coords, status);
+#else
+   status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+   return status;
+}
+
+DLL_PUBLIC
+mbx_status OWNAPI(mbx_sm2_decrypt_mb8)(int8u* pa_out[8],
+                  const int8u* const pa_inp[8],
+                           const int inp_len[8],
+                 const int64u* const pa_skey[8],
+                              int8u* pBuffer)
+{
+   mbx_status status = 0;
+   int buf_no;
+
+   /* test input pointers */
+   if(NULL==pa_out || NULL==pa_inp || NULL==inp_len || NULL==pa_skey) {
+      status = MBX_SET_STS_ALL(MBX_STATUS_NULL_PARAM_ERR);
+      return status;
+   }
+
+   /* check pointers and values */
+   for(buf_no=0; buf_no<8; buf_no++) {
+      int8u* out = pa_out[buf_no];
+      const int8u* inp = pa_inp[buf_no];
+      const int64u* skey = pa_skey[buf_no];
+
+      /* if any of pointer NULL set error status */
+      if(NULL==out || NULL==inp || NULL==skey) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+         continue;
+      }
+      /* C1 must be an uncompressed point followed by C3 */
+      if(inp_len[buf_no] < SM2_CIPHER_OVERHEAD || 0x04!=inp[0]) {
+         status = MBX_SET_STS(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+      }
+   }
+
+   if(!MBX_IS_ANY_OK_STS(status))
+      return status;
+
+   /*
+   // processing
+   */
+
+#if (_MBX>=_MBX_K1)
+   status = internal_avx512_sm2_decrypt_mb8(pa_out, pa_inp, inp_len, pa_skey, pBuffer, status);
+#else
+   status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+   return status;
+}
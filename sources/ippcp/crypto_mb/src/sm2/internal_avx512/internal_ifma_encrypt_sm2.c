@@ -0,0 +1,388 @@
+/*************************************************************************
+* Copyright (C) 2021 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/ec_sm2.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/sm2/ifma_ecpoint_sm2.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/sm3/sm3_mb8.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define SM3_HASH_LEN8   (SM3_SIZE_IN_BITS/8)
+
+static int len_4[8]  = {REP8_DECL( 4)};
+static int len_32[8] = {REP8_DECL(32)};
+static int len_64[8] = {REP8_DECL(64)};
+
+/* mask of buffers still being processed */
+static __mb_mask sm2_active_mask(mbx_status status)
+{
+   __mb_mask mask = 0;
+   for(int buf_no = 0; buf_no < 8; buf_no++)
+      mask |= (__mb_mask)((MBX_STATUS_OK==MBX_GET_STS(status, buf_no)) << buf_no);
+   return mask;
+}
+
+/* set error status of the buffers in mask which have no error yet */
+static mbx_status sm2_update_sts(mbx_status status, __mb_mask mask, mbx_status sttVal)
+{
+   return status | MBX_SET_STS_BY_MASK(0, mask & sm2_active_mask(status), sttVal);
+}
+
+/*
+// out = inp ^ KDF(x2||y2, len)
+//
+// KDF output is SM3(x2||y2||ct) for the 32-bit big-endian counters ct = 1,2,...
+// The x2||y2 prefix is exactly one SM3 block, so it is compressed once and
+// every counter only costs the finalization of a copy of that state.
+//
+// Returns mask of the buffers with len>0 and all-zero KDF output.
+*/
+static __mb_mask sm2_kdf_xor_mb8(int8u* const pa_out[8],
+                           const int8u* const pa_inp[8],
+                                    const int len[8],
+                           const int8u* const pa_x2y2[8],
+                                    __mb_mask active)
+{
+   SM3_CTX_mb8 x2y2_ctx;
+   sm3_init_mb8(&x2y2_ctx);
+   sm3_update_mb8(pa_x2y2, len_64, &x2y2_ctx);
+
+   int max_len = 0;
+   for(int buf_no = 0; buf_no < 8; buf_no++)
+      if(((active>>buf_no)&1) && len[buf_no] > max_len)
+         max_len = len[buf_no];
+
+   __ALIGN64 int8u t[8][SM3_HASH_LEN8];
+   int8u* pa_t[8] = {t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7]};
+
+   int8u ct_str[4];
+   const int8u* pa_ct[8] = {REP8_DECL(ct_str)};
+
+   __m256i t_acc[8];
+   for(int buf_no = 0; buf_no < 8; buf_no++)
+      t_acc[buf_no] = _mm256_setzero_si256();
+
+   int32u ct = 1;
+   for(int offset = 0; offset < max_len; offset += SM3_HASH_LEN8, ct++) {
+      ct_str[0] = (int8u)(ct>>24);
+      ct_str[1] = (int8u)(ct>>16);
+      ct_str[2] = (int8u)(ct>>8);
+      ct_str[3] = (int8u)(ct);
+
+      SM3_CTX_mb8 ctx = x2y2_ctx;
+      sm3_update_mb8(pa_ct, len_4, &ctx);
+      sm3_final_mb8(pa_t, &ctx);
+
+      for(int buf_no = 0; buf_no < 8; buf_no++) {
+         int rest = len[buf_no] - offset;
+         if(!((active>>buf_no)&1) || rest <= 0)
+            continue;
+
+         __mmask32 mask = (rest >= SM3_HASH_LEN8) ? (__mmask32)0xFFFFFFFF : (__mmask32)((1u<<rest)-1);
+         __m256i tt = _mm256_maskz_loadu_epi8(mask, t[buf_no]);
+         __m256i in = _mm256_maskz_loadu_epi8(mask, pa_inp[buf_no] + offset);
+         _mm256_mask_storeu_epi8(pa_out[buf_no] + offset, mask, _mm256_xor_si256(in, tt));
+         t_acc[buf_no] = _mm256_or_si256(t_acc[buf_no], tt);
+      }
+   }
+
+   __mb_mask zero_t_mask = 0;
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      if(((active>>buf_no)&1) && len[buf_no] > 0)
+         zero_t_mask |= (__mb_mask)(_mm256_testz_si256(t_acc[buf_no], t_acc[buf_no]) << buf_no);
+   }
+
+   /* clear key stream */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])t, sizeof(t)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&x2y2_ctx.msg_hash, sizeof(x2y2_ctx.msg_hash)/sizeof(U64));
+
+   return zero_t_mask;
+}
+
+/* hash = SM3(x2||msg||y2) */
+static void sm2_c3_mb8(int8u* pa_hash[8],
+                 const int8u* const pa_x2[8],
+                 const int8u* const pa_msg[8],
+                          const int msg_len[8],
+                 const int8u* const pa_y2[8])
+{
+   SM3_CTX_mb8 ctx;
+   sm3_init_mb8(&ctx);
+   sm3_update_mb8(pa_x2, len_32, &ctx);
+   sm3_update_mb8(pa_msg, (int*)msg_len, &ctx);
+   sm3_update_mb8(pa_y2, len_32, &ctx);
+   sm3_final_mb8(pa_hash, &ctx);
+}
+
+/* x2||y2 (big-endian) of the affine R, R!=O */
+static void sm2_point_to_x2y2(int8u x2y2[8][2*PSM2_LEN8], SM2_POINT* R)
+{
+   __ALIGN64 U64 x[PSM2_LEN52];
+   __ALIGN64 U64 y[PSM2_LEN52];
+
+   MB_FUNC_NAME(get_sm2_ec_affine_coords_)(x, y, R);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(x, x);
+   MB_FUNC_NAME(ifma_frommont52_psm2_)(y, y);
+
+   int8u* pa_x[8] = {x2y2[0], x2y2[1], x2y2[2], x2y2[3], x2y2[4], x2y2[5], x2y2[6], x2y2[7]};
+   int8u* pa_y[8] = {x2y2[0]+PSM2_LEN8, x2y2[1]+PSM2_LEN8, x2y2[2]+PSM2_LEN8, x2y2[3]+PSM2_LEN8,
+                     x2y2[4]+PSM2_LEN8, x2y2[5]+PSM2_LEN8, x2y2[6]+PSM2_LEN8, x2y2[7]+PSM2_LEN8};
+   ifma_mb8_to_HexStr8(pa_x, (const int64u (*)[8])x, PSM2_BITSIZE);
+   ifma_mb8_to_HexStr8(pa_y, (const int64u (*)[8])y, PSM2_BITSIZE);
+
+   MB_FUNC_NAME(zero_)((int64u (*)[8])x, sizeof(x)/sizeof(U64));
+   MB_FUNC_NAME(zero_)((int64u (*)[8])y, sizeof(y)/sizeof(U64));
+}
+
+mbx_status internal_avx512_sm2_encrypt_mb8(int8u* pa_out[8],
+                                     const int8u* const pa_msg[8],
+                                              const int msg_len[8],
+                                    const int64u* const pa_eph_skey[8],
+                                    const int64u* const pa_pubx[8],
+                                    const int64u* const pa_puby[8],
+                                    const int64u* const pa_pubz[8],
+                                           int8u* pBuffer, int use_jproj_coords,
+                                           mbx_status current_status)
+{
+   mbx_status status = current_status;
+
+   /* zero padded ephemeral keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])secretz, (const int64u**)pa_eph_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status = sm2_update_sts(status, is_zero(secretz, PSM2_LEN64+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   SM2_POINT P;
+
+   /* set party's public */
+   ifma_BNU_to_mb8((int64u (*)[8])P.X, (const int64u* (*))pa_pubx, PSM2_BITSIZE);
+   ifma_BNU_to_mb8((int64u (*)[8])P.Y, (const int64u* (*))pa_puby, PSM2_BITSIZE);
+   if(use_jproj_coords)
+      ifma_BNU_to_mb8((int64u (*)[8])P.Z, (const int64u* (*))pa_pubz, PSM2_BITSIZE);
+   else
+      MB_FUNC_NAME(mov_FESM2_)(P.Z, (U64*)ones);
+   /* convert to Montgomery */
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P.X, P.X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P.Y, P.Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(P.Z, P.Z);
+
+   /* check if P does not belong to EC */
+   __mb_mask not_on_curve_mask = ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(&P, use_jproj_coords);
+   /* set points out of EC to infinity */
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(&P, not_on_curve_mask);
+   /* update status */
+   status = sm2_update_sts(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the ephemeral keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+      return status;
+   }
+
+   SM2_POINT C1, R;
+
+   /* C1 = [k]*G, R = [k]*P */
+   MB_FUNC_NAME(ifma_ec_sm2_mul_pointbase_)(&C1, secretz);
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(&R, &P, secretz);
+
+   /* clear copy of the ephemeral keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   /* [k]*P = O means the ephemeral key is a multiple of the order */
+   status = sm2_update_sts(status, MB_FUNC_NAME(is_zero_point_cordinate_)(R.Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   __mb_mask active = sm2_active_mask(status);
+   if(!active) {
+      MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+      return status;
+   }
+
+   /* C1 = 04||x1||y1 */
+   __ALIGN64 int8u c1[8][2*PSM2_LEN8];
+   sm2_point_to_x2y2(c1, &C1);
+
+   /* x2||y2 */
+   __ALIGN64 int8u x2y2[8][2*PSM2_LEN8];
+   sm2_point_to_x2y2(x2y2, &R);
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+
+   const int8u* pa_x2y2[8] = {x2y2[0], x2y2[1], x2y2[2], x2y2[3], x2y2[4], x2y2[5], x2y2[6], x2y2[7]};
+   const int8u* pa_y2[8]   = {x2y2[0]+PSM2_LEN8, x2y2[1]+PSM2_LEN8, x2y2[2]+PSM2_LEN8, x2y2[3]+PSM2_LEN8,
+                              x2y2[4]+PSM2_LEN8, x2y2[5]+PSM2_LEN8, x2y2[6]+PSM2_LEN8, x2y2[7]+PSM2_LEN8};
+
+   int8u* pa_c2[8];
+   int8u* pa_c3[8];
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      int is_active = (active>>buf_no)&1;
+      pa_c3[buf_no] = is_active ? pa_out[buf_no] + 1 + 2*PSM2_LEN8 : NULL;
+      pa_c2[buf_no] = is_active ? pa_out[buf_no] + 1 + 3*PSM2_LEN8 : NULL;
+   }
+
+   /* C2 = M ^ KDF(x2||y2, msg_len) */
+   __mb_mask zero_t_mask = sm2_kdf_xor_mb8(pa_c2, pa_msg, msg_len, pa_x2y2, active);
+   status = sm2_update_sts(status, zero_t_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+   active &= ~zero_t_mask;
+
+   /* C3 = SM3(x2||M||y2) */
+   for(int buf_no = 0; buf_no < 8; buf_no++)
+      if(!((active>>buf_no)&1)) pa_c3[buf_no] = NULL;
+   sm2_c3_mb8(pa_c3, pa_x2y2, pa_msg, msg_len, pa_y2);
+
+   /* clear shared point */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])x2y2, sizeof(x2y2)/sizeof(U64));
+
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      int8u* out = pa_out[buf_no];
+      if((active>>buf_no)&1) {
+         out[0] = 0x04;
+         for(int i = 0; i < 2*PSM2_LEN8; i++)
+            out[1+i] = c1[buf_no][i];
+      }
+      else if((zero_t_mask>>buf_no)&1) {
+         /* do not leave the message masked by the weak key stream */
+         for(int i = 0; i < msg_len[buf_no]; i++)
+            pa_c2[buf_no][i] = 0;
+      }
+   }
+
+   return status;
+}
+
+mbx_status internal_avx512_sm2_decrypt_mb8(int8u* pa_out[8],
+                                     const int8u* const pa_inp[8],
+                                              const int inp_len[8],
+                                    const int64u* const pa_skey[8],
+                                           int8u* pBuffer,
+                                           mbx_status current_status)
+{
+   mbx_status status = current_status;
+
+   /* zero padded private keys */
+   U64 secretz[PSM2_LEN64+1];
+   ifma_BNU_transpose_copy((int64u (*)[8])secretz, (const int64u**)pa_skey, PSM2_BITSIZE);
+   secretz[PSM2_LEN64] = get_zero64();
+
+   status = sm2_update_sts(status, is_zero(secretz, PSM2_LEN64+1), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* C1 = 04||x1||y1 */
+   __mb_mask active = sm2_active_mask(status);
+   const int8u* pa_c1x[8];
+   const int8u* pa_c1y[8];
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      int is_active = (active>>buf_no)&1;
+      pa_c1x[buf_no] = is_active ? pa_inp[buf_no] + 1 : NULL;
+      pa_c1y[buf_no] = is_active ? pa_inp[buf_no] + 1 + PSM2_LEN8 : NULL;
+   }
+
+   SM2_POINT C1;
+   ifma_HexStr8_to_mb8((int64u (*)[8])C1.X, pa_c1x, PSM2_BITSIZE);
+   ifma_HexStr8_to_mb8((int64u (*)[8])C1.Y, pa_c1y, PSM2_BITSIZE);
+
+   __mb_mask out_of_range_mask = ~MB_FUNC_NAME(ifma_cmp_lt_psm2_)(C1.X);
+   out_of_range_mask |= ~MB_FUNC_NAME(ifma_cmp_lt_psm2_)(C1.Y);
+
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.X, C1.X);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.Y, C1.Y);
+   MB_FUNC_NAME(ifma_tomont52_psm2_)(C1.Z, (U64*)ones);
+
+   /* check if C1 does not belong to EC */
+   __mb_mask not_on_curve_mask = out_of_range_mask | ~MB_FUNC_NAME(ifma_is_on_curve_psm2_)(&C1, 0);
+   MB_FUNC_NAME(mask_set_point_to_infinity_)(&C1, not_on_curve_mask);
+   status = sm2_update_sts(status, not_on_curve_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   if(!MBX_IS_ANY_OK_STS(status)) {
+      /* clear copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+      return status;
+   }
+
+   SM2_POINT R;
+
+   /* compute R = [secretz]*C1 */
+   MB_FUNC_NAME(ifma_ec_sm2_mul_point_)(&R, &C1, secretz);
+
+   /* clear copy of the secret keys */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])secretz, sizeof(secretz)/sizeof(U64));
+
+   status = sm2_update_sts(status, MB_FUNC_NAME(is_zero_point_cordinate_)(R.Z), MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   active = sm2_active_mask(status);
+   if(!active) {
+      MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+      return status;
+   }
+
+   /* x2||y2 */
+   __ALIGN64 int8u x2y2[8][2*PSM2_LEN8];
+   sm2_point_to_x2y2(x2y2, &R);
+   MB_FUNC_NAME(zero_)((int64u (*)[8])&R, sizeof(R)/sizeof(U64));
+
+   const int8u* pa_x2y2[8] = {x2y2[0], x2y2[1], x2y2[2], x2y2[3], x2y2[4], x2y2[5], x2y2[6], x2y2[7]};
+   const int8u* pa_y2[8]   = {x2y2[0]+PSM2_LEN8, x2y2[1]+PSM2_LEN8, x2y2[2]+PSM2_LEN8, x2y2[3]+PSM2_LEN8,
+                              x2y2[4]+PSM2_LEN8, x2y2[5]+PSM2_LEN8, x2y2[6]+PSM2_LEN8, x2y2[7]+PSM2_LEN8};
+
+   int msg_len[8];
+   const int8u* pa_c2[8];
+   const int8u* pa_msg[8];
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      int is_active = (active>>buf_no)&1;
+      msg_len[buf_no] = is_active ? inp_len[buf_no] - (1 + 3*PSM2_LEN8) : 0;
+      pa_c2[buf_no]   = is_active ? pa_inp[buf_no] + 1 + 3*PSM2_LEN8 : NULL;
+      pa_msg[buf_no]  = is_active ? pa_out[buf_no] : NULL;
+   }
+
+   /* M = C2 ^ KDF(x2||y2, msg_len) */
+   __mb_mask zero_t_mask = sm2_kdf_xor_mb8(pa_out, pa_c2, msg_len, pa_x2y2, active);
+   status = sm2_update_sts(status, zero_t_mask, MBX_STATUS_MISMATCH_PARAM_ERR);
+
+   /* u = SM3(x2||M||y2) */
+   __ALIGN64 int8u u[8][SM3_HASH_LEN8];
+   int8u* pa_u[8] = {u[0], u[1], u[2], u[3], u[4], u[5], u[6], u[7]};
+   sm2_c3_mb8(pa_u, pa_x2y2, pa_msg, msg_len, pa_y2);
+
+   /* clear shared point */
+   MB_FUNC_NAME(zero_)((int64u (*)[8])x2y2, sizeof(x2y2)/sizeof(U64));
+
+   /* check u==C3 */
+   __mb_mask c3_mismatch_mask = 0;
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      if(!((active>>buf_no)&1))
+         continue;
+      __m256i c3 = _mm256_loadu_si256((const __m256i*)(pa_inp[buf_no] + 1 + 2*PSM2_LEN8));
+      __m256i uu = _mm256_load_si256((const __m256i*)u[buf_no]);
+      c3_mismatch_mask |= (__mb_mask)((_mm256_cmpneq_epi8_mask(c3, uu) != 0) << buf_no);
+   }
+   c3_mismatch_mask &= ~zero_t_mask;
+   status = sm2_update_sts(status, c3_mismatch_mask, MBX_STATUS_SIGNATURE_ERR);
+
+   /* do not release unauthenticated plaintext */
+   for(int buf_no = 0; buf_no < 8; buf_no++) {
+      if(((c3_mismatch_mask|zero_t_mask)>>buf_no)&1) {
+         for(int i = 0; i < msg_len[buf_no]; i++)
+            pa_out[buf_no][i] = 0;
+      }
+   }
+
+   return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -0,0 +1,84 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/sm3.h>
+
+#include <internal/sm3/sm3_mb16.h>
+#include <internal/common/ifma_defs.h>
+
+DLL_PUBLIC
+mbx_status16 OWNAPI(mbx_hmac_sm3_mb16)(const int8u* const msg_pa[16],
+                                                    int len[16],
+                                     const int8u* const key_pa[16],
+                                              const int key_len[16],
+                                                 int8u* mac_pa[16])
+{
+    mbx_status16 status = 0;
+    int buf_no;
+
+    /* test input pointers */
+    if(NULL==msg_pa || NULL==len || NULL==key_pa || NULL==key_len || NULL==mac_pa) {
+        status = MBX_SET_STS16_ALL(MBX_STATUS_NULL_PARAM_ERR);
+        return status;
+    }
+
+    /* check pointers and values */
+    for(buf_no=0; buf_no<SM3_NUM_BUFFERS; buf_no++) {
+        if(NULL==mac_pa[buf_no] || (NULL==msg_pa[buf_no] && len[buf_no]) || (NULL==key_pa[buf_no] && key_len[buf_no])) {
+            status = MBX_SET_STS16(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+            continue;
+        }
+        if(len[buf_no] < 0 || key_len[buf_no] < 0) {
+            status = MBX_SET_STS16(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+        }
+    }
+
+    if(!MBX_IS_ANY_OK_STS16(status))
+        return status;
+
+#if (_MBX>=_MBX_K1)
+    const int8u* loc_msg_pa[SM3_NUM_BUFFERS];
+    const int8u* loc_key_pa[SM3_NUM_BUFFERS];
+    int8u* loc_mac_pa[SM3_NUM_BUFFERS];
+    int loc_len[SM3_NUM_BUFFERS];
+    int loc_key_len[SM3_NUM_BUFFERS];
+
+    /* exclude buffers with errors */
+    for(buf_no=0; buf_no<SM3_NUM_BUFFERS; buf_no++) {
+        int is_ok = MBX_STATUS_OK==MBX_GET_STS16(status, buf_no);
+        loc_msg_pa[buf_no]  = is_ok ? msg_pa[buf_no]  : NULL;
+        loc_len[buf_no]     = is_ok ? len[buf_no]     : 0;
+        loc_key_pa[buf_no]  = is_ok ? key_pa[buf_no]  : NULL;
+        loc_key_len[buf_no] = is_ok ? key_len[buf_no] : 0;
+        loc_mac_pa[buf_no]  = is_ok ? mac_pa[buf_no]  : NULL;
+    }
+
+    HMAC_SM3_CTX_mb16 ctx;
+    status |= internal_avx512_hmac_sm3_init_mb16(loc_key_pa, loc_key_len, &ctx);
+    status |= internal_avx512_sm3_update_mb16(loc_msg_pa, loc_len, &ctx.msg_ctx);
+    status |= internal_avx512_hmac_sm3_final_mb16(loc_mac_pa, &ctx);
+
+    /* clear key pad states */
+    for(int i=0; i<SM3_SIZE_IN_WORDS; i++) {
+        _mm512_storeu_si512(ctx.ipad_hash[i], _mm512_setzero_si512());
+        _mm512_storeu_si512(ctx.opad_hash[i], _mm512_setzero_si512());
+    }
+#else
+    status = MBX_SET_STS16_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+    return status;
+}
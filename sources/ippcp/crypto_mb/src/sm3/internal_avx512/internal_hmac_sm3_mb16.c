@@ -0,0 +1,150 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/sm3.h>
+
+#include <internal/sm3/sm3_mb16.h>
+#include <internal/common/ifma_defs.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define HMAC_SM3_IPAD   (0x36)
+#define HMAC_SM3_OPAD   (0x5C)
+
+static int len_block[SM3_NUM_BUFFERS] = { SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE,
+                                          SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE,
+                                          SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE,
+                                          SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE, SM3_MSG_BLOCK_SIZE };
+
+/*
+// (re)start hash in the buffers of mb_mask from the state after one processed pad block
+*/
+static void hmac_sm3_restart_mb16(SM3_CTX_mb16* p_state, const sm3_hash_mb pad_hash, __mmask16 mb_mask)
+{
+    __mmask8 mb_mask8[2];
+    mb_mask8[0] = (__mmask8)mb_mask;
+    mb_mask8[1] = *((__mmask8*)&mb_mask + 1);
+
+    _mm512_storeu_si512(HASH_BUFFIDX(p_state), _mm512_mask_set1_epi32(_mm512_loadu_si512(HASH_BUFFIDX(p_state)), mb_mask, 0));
+    _mm512_storeu_si512(MSG_LEN(p_state), _mm512_mask_set1_epi64(_mm512_loadu_si512(MSG_LEN(p_state)), mb_mask8[0], SM3_MSG_BLOCK_SIZE));
+    _mm512_storeu_si512(MSG_LEN(p_state) + 8, _mm512_mask_set1_epi64(_mm512_loadu_si512(MSG_LEN(p_state) + 8), mb_mask8[1], SM3_MSG_BLOCK_SIZE));
+
+    for (int i = 0; i < SM3_SIZE_IN_WORDS; i++)
+        _mm512_storeu_si512(HASH_VALUE(p_state)[i], _mm512_mask_loadu_epi32(_mm512_loadu_si512(HASH_VALUE(p_state)[i]), mb_mask, pad_hash[i]));
+}
+
+mbx_status16 internal_avx512_hmac_sm3_init_mb16(const int8u* const key_pa[16], const int key_len[16], HMAC_SM3_CTX_mb16* p_state)
+{
+    mbx_status16 status = 0;
+    int i;
+
+    __ALIGN64 int8u key_block[SM3_NUM_BUFFERS][SM3_MSG_BLOCK_SIZE];
+    __ALIGN64 int8u key_pad[SM3_NUM_BUFFERS][SM3_MSG_BLOCK_SIZE];
+    const int8u* pad_pa[SM3_NUM_BUFFERS];
+
+    /* keys longer than the block are replaced by their hash */
+    const int8u* long_key_pa[SM3_NUM_BUFFERS];
+    int8u* long_key_hash_pa[SM3_NUM_BUFFERS];
+    int long_key_len[SM3_NUM_BUFFERS];
+    int n_long_keys = 0;
+
+    for (i = 0; i < SM3_NUM_BUFFERS; i++) {
+        int is_long = (NULL != key_pa[i]) && (key_len[i] > SM3_MSG_BLOCK_SIZE);
+        long_key_pa[i] = is_long ? key_pa[i] : NULL;
+        long_key_len[i] = is_long ? key_len[i] : 0;
+        long_key_hash_pa[i] = is_long ? key_block[i] : NULL;
+        n_long_keys += is_long;
+
+        _mm512_storeu_si512(key_block[i], _mm512_setzero_si512());
+        if (!is_long && NULL != key_pa[i]) {
+            __mmask64 mb_mask64 = (SM3_MSG_BLOCK_SIZE == key_len[i]) ? 0xFFFFFFFFFFFFFFFF : ~(0xFFFFFFFFFFFFFFFF << key_len[i]);
+            _mm512_storeu_si512(key_block[i], _mm512_maskz_loadu_epi8(mb_mask64, key_pa[i]));
+        }
+        pad_pa[i] = key_pad[i];
+    }
+
+    if (n_long_keys)
+        internal_avx512_sm3_msg_digest_mb16(long_key_pa, long_key_len, long_key_hash_pa);
+
+    /* hash of (key ^ ipad) and (key ^ opad) blocks */
+    for (i = 0; i < SM3_SIZE_IN_WORDS; i++) {
+        _mm512_storeu_si512(p_state->ipad_hash[i], _mm512_set1_epi32((int)sm3_iv[i]));
+        _mm512_storeu_si512(p_state->opad_hash[i], _mm512_set1_epi32((int)sm3_iv[i]));
+    }
+
+    for (i = 0; i < SM3_NUM_BUFFERS; i++)
+        _mm512_storeu_si512(key_pad[i], _mm512_xor_si512(_mm512_loadu_si512(key_block[i]), _mm512_set1_epi8(HMAC_SM3_IPAD)));
+    sm3_avx512_mb16(p_state->ipad_hash, pad_pa, len_block);
+
+    for (i = 0; i < SM3_NUM_BUFFERS; i++)
+        _mm512_storeu_si512(key_pad[i], _mm512_xor_si512(_mm512_loadu_si512(key_block[i]), _mm512_set1_epi8(HMAC_SM3_OPAD)));
+    sm3_avx512_mb16(p_state->opad_hash, pad_pa, len_block);
+
+    /* clear copies of the keys */
+    for (i = 0; i < SM3_NUM_BUFFERS; i++) {
+        _mm512_storeu_si512(key_block[i], _mm512_setzero_si512());
+        _mm512_storeu_si512(key_pad[i], _mm512_setzero_si512());
+    }
+
+    /* message hash starts after the ipad block */
+    internal_avx512_sm3_mask_init_mb16(&p_state->msg_ctx, 0xFFFF);
+    hmac_sm3_restart_mb16(&p_state->msg_ctx, (const int32u (*)[16])p_state->ipad_hash, 0xFFFF);
+
+    return status;
+}
+
+mbx_status16 internal_avx512_hmac_sm3_final_mb16(int8u* mac_pa[16], HMAC_SM3_CTX_mb16* p_state)
+{
+    mbx_status16 status = 0;
+    int i;
+
+    __ALIGN64 int8u inner[SM3_NUM_BUFFERS][SM3_SIZE_IN_BITS/8];
+    int8u* inner_pa[SM3_NUM_BUFFERS];
+    int inner_len[SM3_NUM_BUFFERS];
+
+    __m512i zero_buffer = _mm512_setzero_si512();
+    __mmask8 mb_mask8[2];
+    mb_mask8[0] = _mm512_cmp_epi64_mask(_mm512_loadu_si512(mac_pa), zero_buffer, _MM_CMPINT_NE);
+    mb_mask8[1] = _mm512_cmp_epi64_mask(_mm512_loadu_si512(mac_pa + 8), zero_buffer, _MM_CMPINT_NE);
+    __mmask16 mb_mask16 = *(__mmask16*)mb_mask8;
+
+    for (i = 0; i < SM3_NUM_BUFFERS; i++) {
+        int is_active = (mb_mask16 >> i) & 1;
+        inner_pa[i] = is_active ? inner[i] : NULL;
+        inner_len[i] = is_active ? SM3_SIZE_IN_BITS/8 : 0;
+    }
+
+    /* inner hash: SM3((key ^ ipad) || msg) */
+    internal_avx512_sm3_final_mb16(inner_pa, &p_state->msg_ctx);
+
+    /* outer hash: SM3((key ^ opad) || inner hash) */
+    SM3_CTX_mb16 outer_ctx;
+    internal_avx512_sm3_mask_init_mb16(&outer_ctx, 0xFFFF);
+    hmac_sm3_restart_mb16(&outer_ctx, (const int32u (*)[16])p_state->opad_hash, 0xFFFF);
+    internal_avx512_sm3_update_mb16((const int8u* const*)inner_pa, inner_len, &outer_ctx);
+    internal_avx512_sm3_final_mb16(mac_pa, &outer_ctx);
+
+    for (i = 0; i < SM3_NUM_BUFFERS; i++)
+        _mm256_storeu_si256((__m256i*)inner[i], _mm256_setzero_si256());
+
+    /* ready for the next message under the same keys */
+    hmac_sm3_restart_mb16(&p_state->msg_ctx, (const int32u (*)[16])p_state->ipad_hash, mb_mask16);
+
+    return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
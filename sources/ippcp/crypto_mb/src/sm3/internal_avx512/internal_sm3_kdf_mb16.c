@@ -0,0 +1,92 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/sm3.h>
+
+#include <internal/sm3/sm3_mb16.h>
+#include <internal/common/ifma_defs.h>
+
+#if (_MBX>=_MBX_K1)
+
+#define SM3_HASH_LEN8   (SM3_SIZE_IN_BITS/8)
+
+/*
+// out = SM3(Z||ct) || SM3(Z||ct+1) || ...
+//
+// The complete blocks of Z are compressed once; every counter value only costs
+// the update of a copy of that state with the rest of Z, the counter and the padding.
+*/
+mbx_status16 internal_avx512_sm3_kdf_mb16(int8u* out_pa[16], const int out_len[16], const int8u* const z_pa[16], const int z_len[16])
+{
+    mbx_status16 status = 0;
+    int i;
+
+    int max_len = 0;
+    for (i = 0; i < SM3_NUM_BUFFERS; i++)
+        if (NULL != out_pa[i] && out_len[i] > max_len)
+            max_len = out_len[i];
+
+    SM3_CTX_mb16 z_ctx;
+    internal_avx512_sm3_mask_init_mb16(&z_ctx, 0xFFFF);
+    internal_avx512_sm3_update_mb16(z_pa, (int*)z_len, &z_ctx);
+
+    __ALIGN64 int8u t[SM3_NUM_BUFFERS][SM3_HASH_LEN8];
+    int8u* t_pa[SM3_NUM_BUFFERS];
+
+    int8u ct_str[4];
+    const int8u* ct_pa[SM3_NUM_BUFFERS];
+    int ct_len[SM3_NUM_BUFFERS];
+
+    int32u ct = 1;
+    for (int offset = 0; offset < max_len; offset += SM3_HASH_LEN8, ct++) {
+        for (i = 0; i < SM3_NUM_BUFFERS; i++) {
+            int is_active = (NULL != out_pa[i]) && (out_len[i] > offset);
+            t_pa[i] = is_active ? t[i] : NULL;
+            ct_pa[i] = is_active ? ct_str : NULL;
+            ct_len[i] = is_active ? (int)sizeof(ct_str) : 0;
+        }
+
+        ct_str[0] = (int8u)(ct >> 24);
+        ct_str[1] = (int8u)(ct >> 16);
+        ct_str[2] = (int8u)(ct >> 8);
+        ct_str[3] = (int8u)(ct);
+
+        SM3_CTX_mb16 ctx = z_ctx;
+        internal_avx512_sm3_update_mb16(ct_pa, ct_len, &ctx);
+        internal_avx512_sm3_final_mb16(t_pa, &ctx);
+
+        for (i = 0; i < SM3_NUM_BUFFERS; i++) {
+            if (NULL == t_pa[i])
+                continue;
+            int rest = out_len[i] - offset;
+            __mmask32 mb_mask32 = (rest >= SM3_HASH_LEN8) ? (__mmask32)0xFFFFFFFF : (__mmask32)((1u << rest) - 1);
+            _mm256_mask_storeu_epi8(out_pa[i] + offset, mb_mask32, _mm256_loadu_si256((__m256i*)t[i]));
+        }
+    }
+
+    /* clear secret state */
+    for (i = 0; i < SM3_NUM_BUFFERS; i++) {
+        _mm256_storeu_si256((__m256i*)t[i], _mm256_setzero_si256());
+        _mm512_storeu_si512(HASH_BUFF(&z_ctx)[i], _mm512_setzero_si512());
+    }
+    for (i = 0; i < SM3_SIZE_IN_WORDS; i++)
+        _mm512_storeu_si512(HASH_VALUE(&z_ctx)[i], _mm512_setzero_si512());
+
+    return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
@@ -0,0 +1,72 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+#include <crypto_mb/sm3.h>
+
+#include <internal/sm3/sm3_mb16.h>
+#include <internal/common/ifma_defs.h>
+
+DLL_PUBLIC
+mbx_status16 OWNAPI(mbx_sm3_kdf_mb16)(int8u* out_pa[16],
+                                  const int out_len[16],
+                        const int8u* const z_pa[16],
+                                 const int z_len[16])
+{
+    mbx_status16 status = 0;
+    int buf_no;
+
+    /* test input pointers */
+    if(NULL==out_pa || NULL==out_len || NULL==z_pa || NULL==z_len) {
+        status = MBX_SET_STS16_ALL(MBX_STATUS_NULL_PARAM_ERR);
+        return status;
+    }
+
+    /* check pointers and values */
+    for(buf_no=0; buf_no<SM3_NUM_BUFFERS; buf_no++) {
+        if((NULL==out_pa[buf_no] && out_len[buf_no]) || (NULL==z_pa[buf_no] && z_len[buf_no])) {
+            status = MBX_SET_STS16(status, buf_no, MBX_STATUS_NULL_PARAM_ERR);
+            continue;
+        }
+        if(out_len[buf_no] < 0 || z_len[buf_no] < 0) {
+            status = MBX_SET_STS16(status, buf_no, MBX_STATUS_MISMATCH_PARAM_ERR);
+        }
+    }
+
+    if(!MBX_IS_ANY_OK_STS16(status))
+        return status;
+
+#if (_MBX>=_MBX_K1)
+    int8u* loc_out_pa[SM3_NUM_BUFFERS];
+    const int8u* loc_z_pa[SM3_NUM_BUFFERS];
+    int loc_out_len[SM3_NUM_BUFFERS];
+    int loc_z_len[SM3_NUM_BUFFERS];
+
+    /* exclude buffers with errors */
+    for(buf_no=0; buf_no<SM3_NUM_BUFFERS; buf_no++) {
+        int is_ok = MBX_STATUS_OK==MBX_GET_STS16(status, buf_no) && out_len[buf_no];
+        loc_out_pa[buf_no]  = is_ok ? out_pa[buf_no]  : NULL;
+        loc_out_len[buf_no] = is_ok ? out_len[buf_no] : 0;
+        loc_z_pa[buf_no]    = is_ok ? z_pa[buf_no]    : NULL;
+        loc_z_len[buf_no]   = is_ok ? z_len[buf_no]   : 0;
+    }
+
+    status |= internal_avx512_sm3_kdf_mb16(loc_out_pa, loc_out_len, loc_z_pa, loc_z_len);
+#else
+    status = MBX_SET_STS16_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
+#endif /* #if (_MBX>=_MBX_K1) */
+    return status;
+}
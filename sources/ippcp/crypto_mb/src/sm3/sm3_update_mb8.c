@@ -103,12 +103,12 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
             _mm512_storeu_si512((void*)loc_src, loc_src_m512);
 
             processed_mask = _mm256_cmp_epi32_mask(idx, _mm256_set1_epi32(SM3_MSG_BLOCK_SIZE), _MM_CMPINT_EQ);
-            proc_len = _mm256_mask_set1_epi32(proc_len, processed_mask, SM3_MSG_BLOCK_SIZE);
+            proc_len = _mm256_maskz_set1_epi32(processed_mask, SM3_MSG_BLOCK_SIZE);
 
             /* update digest if at least one buffer is full */
             if (processed_mask) {
                 sm3_avx512_mb8(HASH_VALUE(p_state), (const int8u **)p_buffer, p_proc_len);
-                idx = _mm256_mask_set1_epi32(idx, ~_mm256_cmp_epi32_mask(proc_len, _mm256_setzero_si256(), 2), _MM_CMPINT_EQ);
+                idx = _mm256_mask_set1_epi32(idx, processed_mask, 0);
             }
         }
 
@@ -129,9 +129,11 @@ mbx_status sm3_update_mb8(const int8u* const msg_pa[8], int len[8], SM3_CTX_mb8*
         /* store rest of message into the internal buffer */
         if (processed_mask) {
             for (i = 0; i < SM3_NUM_BUFFERS8; i++) {
-                /* copy from input stream to the internal buffer as match as possible */
-                __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << *(p_loc_len + i));
-                _mm512_storeu_si512(p_buffer[i], _mm512_maskz_loadu_epi8(mb_mask64, loc_src[i]));
+                /* buffers filled partially above have no rest here and must not be overwritten */
+                if ((processed_mask >> i) & 0x1) {
+                    __mmask64 mb_mask64 = ~(0xFFFFFFFFFFFFFFFF << *(p_loc_len + i));
+                    _mm512_storeu_si512(p_buffer[i], _mm512_maskz_loadu_epi8(mb_mask64, loc_src[i]));
+                }
             }
 
             idx = _mm256_maskz_add_epi32(0xFF, idx, loc_len);
@@ -50,6 +50,8 @@ mbx_status OWNAPI(mbx_x25519_mb8)(int8u* const pa_shared_key[8],
 
 #if (_MBX>=_MBX_K1)
     status |= internal_avx512_x25519_mb8(pa_shared_key, pa_private_key, pa_public_key);
+#elif (_MBX==_MBX_L9)
+    status |= internal_avx2_x25519_mb8(pa_shared_key, pa_private_key, pa_public_key);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
@@ -83,6 +85,8 @@ mbx_status OWNAPI(mbx_x25519_public_key_mb8)(int8u* const pa_public_key[8],
 
 #if (_MBX>=_MBX_K1)
     status |= internal_avx512_x25519_public_key_mb8(pa_public_key, pa_private_key);
+#elif (_MBX==_MBX_L9)
+    status |= internal_avx2_x25519_public_key_mb8(pa_public_key, pa_private_key);
 #else
    status = MBX_SET_STS_ALL(MBX_STATUS_UNSUPPORTED_ISA_ERR);
 #endif /* #if (_MBX>=_MBX_K1) */
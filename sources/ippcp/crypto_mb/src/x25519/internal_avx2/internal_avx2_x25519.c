@@ -0,0 +1,205 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/avx2_arith26_mb8.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+
+#if (_MBX==_MBX_L9)
+
+#define X25519_BITSIZE  (256)
+#define X25519_LEN64    (NUMBER_OF_DIGITS(X25519_BITSIZE, 64))
+#define X25519_LEN26    (LEN26(255))
+
+/* p = 2^255-19 and p-2 */
+static const int64u prime25519[X25519_LEN64]   = {0xFFFFFFFFFFFFFFED, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+static const int64u prime25519_2[X25519_LEN64] = {0xFFFFFFFFFFFFFFEB, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+
+typedef int64u fe26_mb8[X25519_LEN26][8];
+
+/* GF(p) context */
+typedef struct {
+   fe26_mb8 p;
+   fe26_mb8 rr;
+   int64u   k0[8];
+} x25519_gf;
+
+static void gf_init(x25519_gf* gf)
+{
+   avx2_const_to_mb8_26(gf->p, prime25519, X25519_BITSIZE, X25519_LEN26);
+   avx2_montFactor26_mb8(gf->k0, (const int64u (*)[8])gf->p);
+   avx2_montRR26_mb8(gf->rr, (const int64u (*)[8])gf->p, gf->k0, X25519_LEN26);
+}
+
+#define FE(x)  ((const int64u (*)[8])(x))
+
+#define fe_mul(gf, r, a, b)  avx2_mont_mul26_mb8((r), FE(a), FE(b), FE((gf)->p), (gf)->k0, X25519_LEN26)
+#define fe_sqr(gf, r, a)     avx2_mont_mul26_mb8((r), FE(a), FE(a), FE((gf)->p), (gf)->k0, X25519_LEN26)
+#define fe_add(gf, r, a, b)  avx2_add26_mb8((r), FE(a), FE(b), FE((gf)->p), X25519_LEN26)
+#define fe_sub(gf, r, a, b)  avx2_sub26_mb8((r), FE(a), FE(b), FE((gf)->p), X25519_LEN26)
+#define fe_to_mont(gf, r, a) avx2_to_mont26_mb8((r), FE(a), FE((gf)->rr), FE((gf)->p), (gf)->k0, X25519_LEN26)
+
+/*
+// Montgomery ladder (RFC7748), scalars are already decoded
+// out = scalar*point, the result is in the regular domain
+*/
+static void x25519_scalar_mul(fe26_mb8 out, const int64u scalar[][8], const fe26_mb8 point, const x25519_gf* gf)
+{
+   __ALIGN64 fe26_mb8 x1, x2, z2, x3, z3;
+   __ALIGN64 fe26_mb8 A, AA, B, BB, E, C, D, DA, CB, a24;
+   __ALIGN64 int64u swap[8];
+   __ALIGN64 int64u prev[8] = {0};
+   int t, n;
+
+   fe_to_mont(gf, x1, point);
+   avx2_set26_mb8(A, 1, X25519_LEN26);
+   fe_to_mont(gf, x2, A);
+   avx2_zero26_mb8(z2, X25519_LEN26);
+   avx2_copy26_mb8(x3, FE(x1), X25519_LEN26);
+   avx2_copy26_mb8(z3, FE(x2), X25519_LEN26);
+   avx2_set26_mb8(A, 121665, X25519_LEN26);
+   fe_to_mont(gf, a24, A);
+
+   for(t=254; t>=0; t--) {
+      for(n=0; n<8; n++) {
+         int64u k = (scalar[t/64][n] >> (t%64)) & 1;
+         swap[n] = 0 - (k ^ prev[n]);
+         prev[n] = k;
+      }
+      avx2_cswap26_mb8(x2, x3, swap, X25519_LEN26);
+      avx2_cswap26_mb8(z2, z3, swap, X25519_LEN26);
+
+      fe_add(gf, A, x2, z2);     /* A  = x2+z2 */
+      fe_sqr(gf, AA, A);         /* AA = A^2 */
+      fe_sub(gf, B, x2, z2);     /* B  = x2-z2 */
+      fe_sqr(gf, BB, B);         /* BB = B^2 */
+      fe_sub(gf, E, AA, BB);     /* E  = AA-BB */
+      fe_add(gf, C, x3, z3);     /* C  = x3+z3 */
+      fe_sub(gf, D, x3, z3);     /* D  = x3-z3 */
+      fe_mul(gf, DA, D, A);      /* DA = D*A */
+      fe_mul(gf, CB, C, B);      /* CB = C*B */
+
+      fe_add(gf, x3, DA, CB);
+      fe_sqr(gf, x3, x3);        /* x3 = (DA+CB)^2 */
+      fe_sub(gf, z3, DA, CB);
+      fe_sqr(gf, z3, z3);
+      fe_mul(gf, z3, z3, x1);    /* z3 = x1*(DA-CB)^2 */
+      fe_mul(gf, x2, AA, BB);    /* x2 = AA*BB */
+      fe_mul(gf, z2, a24, E);
+      fe_add(gf, z2, z2, AA);
+      fe_mul(gf, z2, z2, E);     /* z2 = E*(AA + a24*E) */
+   }
+   for(n=0; n<8; n++)
+      swap[n] = 0 - prev[n];
+   avx2_cswap26_mb8(x2, x3, swap, X25519_LEN26);
+   avx2_cswap26_mb8(z2, z3, swap, X25519_LEN26);
+
+   /* out = x2/z2 */
+   avx2_mont_pow26_mb8(z2, FE(z2), prime25519_2, X25519_BITSIZE, FE(gf->p), gf->k0, X25519_LEN26);
+   fe_mul(gf, out, x2, z2);
+   avx2_from_mont26_mb8(out, FE(out), FE(gf->p), gf->k0, X25519_LEN26);
+
+   /* clear secret data */
+   avx2_zero26_mb8(x2, X25519_LEN26);
+   avx2_zero26_mb8(z2, X25519_LEN26);
+   avx2_zero26_mb8(x3, X25519_LEN26);
+   avx2_zero26_mb8(z3, X25519_LEN26);
+   for(n=0; n<8; n++)
+      prev[n] = 0;
+}
+
+/* decode keys into scalars according to RFC7748 */
+static void x25519_decode_scalar(int64u scalar[][8], const int8u* const pa_private_key[8])
+{
+   int n;
+   avx2_BNU_transpose_copy(scalar, (const int64u* const*)pa_private_key, X25519_BITSIZE);
+   for(n=0; n<8; n++) {
+      scalar[0][n] &= 0xfffffffffffffff8;
+      scalar[3][n] &= 0x7fffffffffffffff;
+      scalar[3][n] |= 0x4000000000000000;
+   }
+}
+
+mbx_status internal_avx2_x25519_mb8(int8u* const pa_shared_key[8],
+                              const int8u* const pa_private_key[8],
+                              const int8u* const pa_public_key[8])
+{
+   mbx_status status = 0;
+
+   __ALIGN64 int64u scalar[X25519_LEN64][8];
+   __ALIGN64 fe26_mb8 point;
+   __ALIGN64 fe26_mb8 shared;
+   x25519_gf gf;
+   int n;
+
+   gf_init(&gf);
+
+   /* get scalars */
+   x25519_decode_scalar(scalar, pa_private_key);
+
+   /* get peer's public keys; the most significant bit of the final byte is masked (RFC7748) */
+   avx2_BNU_to_mb8_26(point, (const int64u* const*)pa_public_key, X25519_BITSIZE, X25519_LEN26);
+   for(n=0; n<8; n++)
+      point[X25519_LEN26-1][n] &= ((int64u)1 << (255 - (X25519_LEN26-1)*DIGIT_SIZE_26)) - 1;
+
+   /* point multiplication */
+   x25519_scalar_mul(shared, (const int64u (*)[8])scalar, (const int64u (*)[8])point, &gf);
+
+   /* all-zero output results when the input is a point of small order */
+   status |= MBX_SET_STS_BY_MASK(status, avx2_is_zero26_mb8(FE(shared), X25519_LEN26), MBX_STATUS_LOW_ORDER_ERR);
+
+   /* convert result back */
+   avx2_mb8_26_to_BNU((int64u* const*)pa_shared_key, FE(shared), X25519_BITSIZE);
+
+   /* clear computed shared keys and copy of the secret keys */
+   avx2_zero26_mb8(shared, X25519_LEN26);
+   avx2_zero26_mb8(scalar, X25519_LEN64);
+
+   return status;
+}
+
+mbx_status internal_avx2_x25519_public_key_mb8(int8u* const pa_public_key[8],
+                                         const int8u* const pa_private_key[8])
+{
+   mbx_status status = 0;
+
+   __ALIGN64 int64u scalar[X25519_LEN64][8];
+   __ALIGN64 fe26_mb8 point;
+   x25519_gf gf;
+
+   gf_init(&gf);
+
+   /* get scalars */
+   x25519_decode_scalar(scalar, pa_private_key);
+
+   /* base point u=9 */
+   avx2_set26_mb8(point, 9, X25519_LEN26);
+
+   /* point multiplication */
+   x25519_scalar_mul(point, (const int64u (*)[8])scalar, (const int64u (*)[8])point, &gf);
+
+   /* convert result back */
+   avx2_mb8_26_to_BNU((int64u* const*)pa_public_key, FE(point), X25519_BITSIZE);
+
+   /* clear copy of the secret keys */
+   avx2_zero26_mb8(scalar, X25519_LEN64);
+
+   return status;
+}
+
+#endif /* #if (_MBX==_MBX_L9) */
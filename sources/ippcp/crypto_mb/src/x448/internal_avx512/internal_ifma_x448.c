@@ -0,0 +1,159 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include <crypto_mb/status.h>
+
+#include <internal/common/ifma_defs.h>
+#include <internal/common/ifma_math.h>
+#include <internal/common/ifma_cvt52.h>
+#include <internal/rsa/ifma_rsa_arith.h>
+#include <internal/ed448/ifma_arith_p448.h>
+
+#if (_MBX>=_MBX_K1)
+
+/* X448 private keys and u-coordinates length */
+#define X448_KEY_BITSIZE  (448)
+
+/* (A-2)/4 curve448 parameter */
+#define X448_A24          (39081)
+
+/*
+// Montgomery ladder (RFC 7748, 5)
+// out = [scalar]*u, scalar and u are regular values in 52-bit digits,
+// out is regular fully reduced value
+*/
+static void x448_scalar_mul(U64 out[P448_LEN52], const U64 scalar[P448_LEN52], const U64 u[P448_LEN52])
+{
+   fe448_mb x1, x2, z2, x3, z3;
+   fe448_mb A, AA, B, BB, E, C, D, DA, CB, a24;
+
+   MB_FUNC_NAME(ifma_tomont52_p448_)(x1, u);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(x2, 1);
+   MB_FUNC_NAME(zero_FE448_)(z2);
+   MB_FUNC_NAME(mov_FE448_)(x3, x1);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(z3, 1);
+   MB_FUNC_NAME(ifma_set_u32_p448_)(a24, X448_A24);
+
+   __mb_mask swap = 0;
+   for (int t = X448_KEY_BITSIZE-1; t >= 0; t--) {
+      U64 bit = and64_const(srli64(scalar[t / DIGIT_SIZE], t % DIGIT_SIZE), 1);
+      __mb_mask kt = cmpeq64_mask(bit, set1(1));
+
+      swap ^= kt;
+      MB_FUNC_NAME(mask_swap_FE448_)(x2, swap, x3);
+      MB_FUNC_NAME(mask_swap_FE448_)(z2, swap, z3);
+      swap = kt;
+
+      fe448_add(A, x2, z2);
+      fe448_sqr(AA, A);
+      fe448_sub(B, x2, z2);
+      fe448_sqr(BB, B);
+      fe448_sub(E, AA, BB);
+      fe448_add(C, x3, z3);
+      fe448_sub(D, x3, z3);
+      fe448_mul(DA, D, A);
+      fe448_mul(CB, C, B);
+
+      fe448_add(x3, DA, CB);
+      fe448_sqr(x3, x3);             /* x3 = (DA + CB)^2 */
+      fe448_sub(z3, DA, CB);
+      fe448_sqr(z3, z3);
+      fe448_mul(z3, z3, x1);         /* z3 = x1 * (DA - CB)^2 */
+      fe448_mul(x2, AA, BB);         /* x2 = AA * BB */
+      fe448_mul(z2, a24, E);
+      fe448_add(z2, z2, AA);
+      fe448_mul(z2, z2, E);          /* z2 = E * (AA + a24 * E) */
+   }
+   MB_FUNC_NAME(mask_swap_FE448_)(x2, swap, x3);
+   MB_FUNC_NAME(mask_swap_FE448_)(z2, swap, z3);
+
+   /* out = x2 * z2^(p-2) */
+   fe448_inv(z2, z2);
+   fe448_mul(x2, x2, z2);
+   MB_FUNC_NAME(ifma_frommont52_p448_)(out, x2);
+}
+
+/* decode private keys into scalars according to RFC7748 */
+static void x448_decode_scalar(U64 scalar[P448_LEN52], const int8u* const pa_private_key[8])
+{
+   ifma_BNU_to_mb8((int64u (*)[8])scalar, (const int64u * const*)pa_private_key, X448_KEY_BITSIZE);
+   scalar[0] = and64_const(scalar[0], ~3ULL);
+   scalar[P448_LEN52-1] = or64(scalar[P448_LEN52-1], set1(1ULL << ((X448_KEY_BITSIZE-1) % DIGIT_SIZE)));
+}
+
+mbx_status MB_FUNC_NAME(internal_avx512_x448_)(int8u* const pa_shared_key[8],
+                                               const int8u* const pa_private_key[8],
+                                               const int8u* const pa_public_key[8])
+{
+   mbx_status status = 0;
+
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+      __ALIGN64 U64 scalar_mb8[P448_LEN52];
+      __ALIGN64 U64 pub_mb8[P448_LEN52];
+      __ALIGN64 U64 shared_mb8[P448_LEN52];
+
+      /* get scalars and peer's public keys and convert to MB8 */
+      x448_decode_scalar(scalar_mb8, pa_private_key);
+      ifma_BNU_to_mb8((int64u (*)[8])pub_mb8, (const int64u * const*)pa_public_key, X448_KEY_BITSIZE);
+
+      /* point multiplication */
+      x448_scalar_mul(shared_mb8, scalar_mb8, pub_mb8);
+
+      /* test shared secret before return; all-zero output results when the input is a point of small order. */
+      __mb_mask stt_mask = MB_FUNC_NAME(is_zero_FE448_)(shared_mb8);
+      status |= MBX_SET_STS_BY_MASK(status, stt_mask, MBX_STATUS_LOW_ORDER_ERR);
+
+      /* convert result back */
+      ifma_mb8_to_BNU((int64u* const *)pa_shared_key, (const int64u (*)[8])shared_mb8, X448_KEY_BITSIZE);
+
+      /* clear computed shared keys and copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])shared_mb8, sizeof(shared_mb8)/sizeof(U64));
+      MB_FUNC_NAME(zero_)((int64u (*)[8])scalar_mb8, sizeof(scalar_mb8)/sizeof(U64));
+   }
+
+   return status;
+}
+
+mbx_status MB_FUNC_NAME(internal_avx512_x448_public_key_)(int8u* const pa_public_key[8],
+                                                          const int8u* const pa_private_key[8])
+{
+   mbx_status status = 0;
+
+   /* continue processing if there are correct parameters */
+   if (MBX_IS_ANY_OK_STS(status)) {
+      __ALIGN64 U64 scalar_mb8[P448_LEN52];
+      __ALIGN64 U64 base_mb8[P448_LEN52];
+      __ALIGN64 U64 pub_mb8[P448_LEN52];
+
+      x448_decode_scalar(scalar_mb8, pa_private_key);
+
+      /* base point u = 5 */
+      MB_FUNC_NAME(zero_FE448_)(base_mb8);
+      base_mb8[0] = set1(5);
+
+      x448_scalar_mul(pub_mb8, scalar_mb8, base_mb8);
+
+      ifma_mb8_to_BNU((int64u* const *)pa_public_key, (const int64u (*)[8])pub_mb8, X448_KEY_BITSIZE);
+
+      /* clear copy of the secret keys */
+      MB_FUNC_NAME(zero_)((int64u (*)[8])scalar_mb8, sizeof(scalar_mb8)/sizeof(U64));
+   }
+
+   return status;
+}
+
+#endif /* #if (_MBX>=_MBX_K1) */
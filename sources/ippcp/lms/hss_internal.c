@@ -0,0 +1,268 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/hss.h"
+
+/*
+ * Set LMS and LMOTS parameters of all levels of HSS tree
+ *
+ * Returns:                Reason:
+ *    ippStsBadArgErr         levels < 1 or levels > CP_HSS_MAX_LEVELS
+ *                            lmsType[i] is out of range
+ *                            hash lengths of LMS and LMOTS parameters of a level are different
+ *    ippStsNoErr             no errors
+ *
+ * Input parameters:
+ *    levels        number of levels L
+ *    lmsType       L structures with LMS parameters lmotsOIDAlgo and lmsOIDAlgo
+ *
+ * Output parameters:
+ *    lmsParams     L sets of LMS parameters (h, m, hash_method)
+ *    lmotsParams   L sets of LMOTS parameters (w, p, ls, n, hash_method)
+ */
+IPP_OWN_DEFN(IppStatus, cpHSSSetParams, (Ipp32s levels, const IppsLMSAlgoType lmsType[],
+            cpLMSParams lmsParams[], cpLMOTSParams lmotsParams[])) {
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BADARG_RET(levels < 1, ippStsBadArgErr);
+    IPP_BADARG_RET(levels > CP_HSS_MAX_LEVELS, ippStsBadArgErr);
+
+    for (Ipp32s i = 0; i < levels; i++) {
+        IPP_BADARG_RET(lmsType[i].lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+        IPP_BADARG_RET(lmsType[i].lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+        IPP_BADARG_RET(lmsType[i].lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+        IPP_BADARG_RET(lmsType[i].lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+        ippcpSts = setLMOTSParams(lmsType[i].lmotsOIDAlgo, &lmotsParams[i]);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        ippcpSts = setLMSParams(lmsType[i].lmsOIDAlgo, &lmsParams[i]);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        IPP_BADARG_RET(lmotsParams[i].n != lmsParams[i].m, ippStsBadArgErr);
+    }
+
+    return ippcpSts;
+}
+
+/*
+ * Size of the temporary buffer of HSS key generation and signing
+ *
+ * The buffer keeps the LMS signature state, the LMS public key state of the generated key
+ * and the temporary buffer of ippsLMSKeyGen and ippsLMSSign. The upper levels sign the
+ * public keys of their children, the bottom level signs the message.
+ *
+ * Input parameters:
+ *    levels             number of levels L
+ *    maxMessageLength   maximum length of the message, 0 if the bottom level signs nothing
+ *    lmsParams          L sets of LMS parameters (h, m, hash_method)
+ *    lmotsParams        L sets of LMOTS parameters (w, p, ls, n, hash_method)
+ */
+IPP_OWN_DEFN(Ipp32s, cpHSSWorkBufferSize, (Ipp32s levels, Ipp32s maxMessageLength,
+            const cpLMSParams lmsParams[], const cpLMOTSParams lmotsParams[])) {
+    Ipp32s workSize = 0;
+    for (Ipp32s i = 0; i < levels; i++) {
+        workSize = IPP_MAX(workSize, cpLMSLeavesBufferSize(&lmotsParams[i]));
+
+        Ipp32s msgLen = (i == levels - 1) ? maxMessageLength : cpLMSPublicKeyByteSize(&lmsParams[i + 1]);
+        if (msgLen > 0) {
+            //           pubKey->I     ||  q  ||  D_MESG  ||          C         ||  pMsg
+            Ipp32s lenBufQ = (Ipp32s)(CP_PK_I_BYTESIZE + 4 +     2     + lmotsParams[i].n) + msgLen;
+            workSize = IPP_MAX(workSize, lenBufQ);
+        }
+    }
+
+    return CP_LMS_MB_ALIGNMENT - 1 +
+           cpHSSSignatureStateSize((Ipp32u)levels, lmsParams, lmotsParams) +
+           CP_HSS_PUBKEY_STATE_SIZE +
+           workSize;
+}
+
+/*
+ * Write the LMS public key in the standard format
+ *  | u32str(type) || u32str(otstype) ||    I     ||   T[1]    |
+ *
+ * Input parameters:
+ *    pKey          LMS public key state
+ *    lmsParams     LMS parameters (h, m, hash_method)
+ *
+ * Output parameters:
+ *    pOut          cpLMSPublicKeyByteSize() bytes of the public key
+ */
+IPP_OWN_DEFN(void, cpHSSEncodePublicKey, (Ipp8u* pOut, const IppsLMSPublicKeyState* pKey, const cpLMSParams* lmsParams)) {
+    toByte(pOut, /*type byteLen*/ 4, (Ipp32u)pKey->lmsOIDAlgo); pOut += 4;
+    toByte(pOut, /*otstype byteLen*/ 4, (Ipp32u)pKey->lmotsOIDAlgo); pOut += 4;
+    CopyBlock(pKey->I, pOut, CP_PK_I_BYTESIZE); pOut += CP_PK_I_BYTESIZE;
+    CopyBlock(pKey->T1, pOut, (cpSize)lmsParams->m);
+}
+
+/*
+ * Write the LMS signature in the standard format
+ *  | u32str(q) || u32str(otstype) || C || y[0..p-1] || u32str(type) || path[0..h-1] |
+ *
+ * Input parameters:
+ *    pSign         LMS signature state
+ *    lmsParams     LMS parameters (h, m, hash_method)
+ *    lmotsParams   LMOTS parameters (w, p, ls, n, hash_method)
+ *
+ * Output parameters:
+ *    pOut          cpLMSSignatureByteSize() bytes of the signature
+ */
+IPP_OWN_DEFN(void, cpHSSEncodeSignature, (Ipp8u* pOut, const IppsLMSSignatureState* pSign,
+            const cpLMSParams* lmsParams, const cpLMOTSParams* lmotsParams)) {
+    Ipp32u n = lmotsParams->n;
+    toByte(pOut, /*q byteLen*/ 4, pSign->_q); pOut += 4;
+    toByte(pOut, /*otstype byteLen*/ 4, (Ipp32u)pSign->_lmotsSig._lmotsOIDAlgo); pOut += 4;
+    CopyBlock(pSign->_lmotsSig.pC, pOut, (cpSize)n); pOut += n;
+    CopyBlock(pSign->_lmotsSig.pY, pOut, (cpSize)(lmotsParams->p * n)); pOut += lmotsParams->p * n;
+    toByte(pOut, /*type byteLen*/ 4, (Ipp32u)pSign->_lmsOIDAlgo); pOut += 4;
+    CopyBlock(pSign->_pAuthPath, pOut, (cpSize)(lmsParams->h * lmsParams->m));
+}
+
+/*
+ * Parse the LMS public key in the standard format. T1 of the state points to the input.
+ *
+ * Returns:
+ *    byte size of the parsed public key, 0 if the input is too short or the key types are wrong
+ *
+ * Input parameters:
+ *    pIn           input bytes
+ *    inLen         number of input bytes
+ *
+ * Output parameters:
+ *    pKey          LMS public key state
+ */
+IPP_OWN_DEFN(Ipp32s, cpHSSDecodePublicKey, (const Ipp8u* pIn, Ipp32s inLen, IppsLMSPublicKeyState* pKey)) {
+    if (inLen < 4 + 4 + CP_PK_I_BYTESIZE) {
+        return 0;
+    }
+    Ipp32u lmsType = cpHSSGetU32(pIn);
+    Ipp32u lmotsType = cpHSSGetU32(pIn + 4);
+    if (lmsType < LMS_SHA256_M32_H5 || lmsType > LMS_SHA256_M24_H25 ||
+        lmotsType < LMOTS_SHA256_N32_W1 || lmotsType > LMOTS_SHA256_N24_W8) {
+        return 0;
+    }
+    cpLMSParams lmsParams;
+    if (ippStsNoErr != setLMSParams((IppsLMSAlgo)lmsType, &lmsParams)) {
+        return 0;
+    }
+    Ipp32s keyLen = cpLMSPublicKeyByteSize(&lmsParams);
+    if (inLen < keyLen) {
+        return 0;
+    }
+
+    CP_LMS_SET_CTX_ID(pKey);
+    pKey->lmsOIDAlgo = (IppsLMSAlgo)lmsType;
+    pKey->lmotsOIDAlgo = (IppsLMOTSAlgo)lmotsType;
+    CopyBlock(pIn + 4 + 4, pKey->I, CP_PK_I_BYTESIZE);
+    pKey->T1 = (Ipp8u*)(pIn + 4 + 4 + CP_PK_I_BYTESIZE);
+
+    return keyLen;
+}
+
+/*
+ * Parse the LMS signature in the standard format. C, y and the path of the state
+ * point to the input.
+ *
+ * Returns:
+ *    byte size of the parsed signature, 0 if the input is too short or the signature types are wrong
+ *
+ * Input parameters:
+ *    pIn           input bytes
+ *    inLen         number of input bytes
+ *
+ * Output parameters:
+ *    pSign         LMS signature state
+ */
+IPP_OWN_DEFN(Ipp32s, cpHSSDecodeSignature, (const Ipp8u* pIn, Ipp32s inLen, IppsLMSSignatureState* pSign)) {
+    if (inLen < 4 + 4) {
+        return 0;
+    }
+    Ipp32u lmotsType = cpHSSGetU32(pIn + 4);
+    if (lmotsType < LMOTS_SHA256_N32_W1 || lmotsType > LMOTS_SHA256_N24_W8) {
+        return 0;
+    }
+    cpLMOTSParams lmotsParams;
+    if (ippStsNoErr != setLMOTSParams((IppsLMOTSAlgo)lmotsType, &lmotsParams)) {
+        return 0;
+    }
+    //                      q || otstype ||       C        ||           y[0..p-1]
+    Ipp32s typeOffset = (Ipp32s)(4 +   4    + lmotsParams.n + lmotsParams.p * lmotsParams.n);
+    if (inLen < typeOffset + 4) {
+        return 0;
+    }
+    Ipp32u lmsType = cpHSSGetU32(pIn + typeOffset);
+    if (lmsType < LMS_SHA256_M32_H5 || lmsType > LMS_SHA256_M24_H25) {
+        return 0;
+    }
+    cpLMSParams lmsParams;
+    if (ippStsNoErr != setLMSParams((IppsLMSAlgo)lmsType, &lmsParams) || lmotsParams.n != lmsParams.m) {
+        return 0;
+    }
+    Ipp32s signLen = cpLMSSignatureByteSize(&lmsParams, &lmotsParams);
+    if (inLen < signLen) {
+        return 0;
+    }
+
+    CP_LMS_SET_CTX_ID(pSign);
+    pSign->_q = cpHSSGetU32(pIn);
+    pSign->_lmsOIDAlgo = (IppsLMSAlgo)lmsType;
+    pSign->_lmotsSig._lmotsOIDAlgo = (IppsLMOTSAlgo)lmotsType;
+    pSign->_lmotsSig.pC = (Ipp8u*)(pIn + 4 + 4);
+    pSign->_lmotsSig.pY = pSign->_lmotsSig.pC + lmotsParams.n;
+    pSign->_pAuthPath = (Ipp8u*)(pIn + typeOffset + 4);
+
+    return signLen;
+}
+
+/*
+ * Sign the public key of the level by the key of its parent and store both in the HSS state
+ *
+ * Returns:                Reason:
+ *    ippStsNoErr             no errors
+ *    error code of ippsLMSSign
+ *
+ * Input parameters:
+ *    level         level of the child key, 1..L-1
+ *    pChildKey     LMS public key of the level
+ *    lmsParams     L sets of LMS parameters (h, m, hash_method)
+ *    lmotsParams   L sets of LMOTS parameters (w, p, ls, n, hash_method)
+ *    rndFunc       function to generate the randomizer C
+ *    pRndParam     pointer to the random generator state
+ *    pBuffer       temporary buffer of ippsLMSSign
+ *
+ * Output parameters:
+ *    pState        HSS private key state: the parent key is advanced, sig[level-1] and pub[level] are set
+ *    pSign         LMS signature state of the parent level
+ */
+IPP_OWN_DEFN(IppStatus, cpHSSSignChildKey, (IppsHSSPrivateKeyState* pState, Ipp32u level,
+            const IppsLMSPublicKeyState* pChildKey, const cpLMSParams lmsParams[],
+            const cpLMOTSParams lmotsParams[], IppsLMSSignatureState* pSign,
+            IppBitSupplier rndFunc, void* pRndParam, Ipp8u* pBuffer)) {
+    Ipp8u* pSigned = cpHSSSignedKey(pState, level, lmsParams, lmotsParams);
+    Ipp8u* pPub = pSigned + cpLMSSignatureByteSize(&lmsParams[level - 1], &lmotsParams[level - 1]);
+
+    cpHSSEncodePublicKey(pPub, pChildKey, &lmsParams[level]);
+
+    IppStatus ippcpSts = ippsLMSSign(pPub, cpLMSPublicKeyByteSize(&lmsParams[level]),
+                                     cpHSSLevelKey(pState, level - 1, lmsParams), pSign,
+                                     rndFunc, pRndParam, pBuffer);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    cpHSSEncodeSignature(pSigned, pSign, &lmsParams[level - 1], &lmotsParams[level - 1]);
+
+    return ippcpSts;
+}
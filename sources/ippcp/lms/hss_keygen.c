@@ -0,0 +1,102 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/hss.h"
+
+/*F*
+//    Name: ippsHSSKeyGen
+//
+// Purpose: HSS private and public keys generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        lmsType == NULL
+//                            pPrvKey == NULL
+//                            pPubKey == NULL
+//                            rndFunc == NULL
+//                            pBuffer == NULL
+//    ippStsBadArgErr         levels < 1 or levels > 8
+//                            lmsType[i].lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType[i].lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType[i].lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType[i].lmsOIDAlgo   < LMS_SHA256_M32_H5
+//                            hash lengths of LMS and LMOTS parameters of a level are different
+//    ippStsErr               random generator error
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    levels         number of levels L of HSS tree
+//    lmsType        L structures with LMS parameters of the levels, lmsType[0] is the top level
+//    pPrvKey        pointer to the HSS private key state of ippsHSSPrivateKeyStateGetSize() size
+//    pPubKey        pointer to the LMS public key state of the top level of
+//                   ippsLMSPublicKeyStateGetSize(lmsType[0]) size
+//    rndFunc        function to generate I, SEED and randomizers C
+//    pRndParam      pointer to the random generator state
+//    pBuffer        pointer to the temporary memory of ippsHSSKeyGenBufferGetSize() size
+//
+// Note:
+//    an LMS key is generated for every level (see ippsLMSKeyGen), the public key of the
+//    level i is signed by the key of the level i-1. The HSS public key is L || pPubKey.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSKeyGen, (Ipp32s levels, const IppsLMSAlgoType lmsType[],
+                                  IppsHSSPrivateKeyState* pPrvKey,
+                                  IppsLMSPublicKeyState* pPubKey,
+                                  IppBitSupplier rndFunc, void* pRndParam,
+                                  Ipp8u* pBuffer))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR4_RET(lmsType, pPrvKey, pPubKey, rndFunc);
+    IPP_BAD_PTR1_RET(pBuffer);
+
+    /* Set LMOTS and LMS parameters of the levels */
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams(levels, lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    IppsLMSSignatureState* pSign = (IppsLMSSignatureState*)IPP_ALIGNED_PTR(pBuffer, CP_LMS_MB_ALIGNMENT);
+    IppsLMSPublicKeyState* pChildKey = (IppsLMSPublicKeyState*)((Ipp8u*)pSign +
+                                       cpHSSSignatureStateSize((Ipp32u)levels, lmsParams, lmotsParams));
+    Ipp8u* pWork = (Ipp8u*)pChildKey + CP_HSS_PUBKEY_STATE_SIZE;
+
+    /* The context id is set when the key is complete */
+    CP_HSS_RESET_CTX_ID(pPrvKey);
+    pPrvKey->levels = (Ipp32u)levels;
+    PadBlock(0, pPrvKey->lmsType, (cpSize)sizeof(pPrvKey->lmsType));
+    CopyBlock(lmsType, pPrvKey->lmsType, levels * (cpSize)sizeof(IppsLMSAlgoType));
+
+    /* The top level key is the HSS public key */
+    ippcpSts = ippsLMSKeyGen(lmsType[0], cpHSSLevelKey(pPrvKey, 0, lmsParams), pPubKey,
+                             rndFunc, pRndParam, pWork);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    for (Ipp32u i = 1; i < (Ipp32u)levels; i++) {
+        ippcpSts = ippsLMSKeyGen(lmsType[i], cpHSSLevelKey(pPrvKey, i, lmsParams), pChildKey,
+                                 rndFunc, pRndParam, pWork);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        ippcpSts = cpHSSSignChildKey(pPrvKey, i, pChildKey, lmsParams, lmotsParams, pSign,
+                                     rndFunc, pRndParam, pWork);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    }
+
+    CP_HSS_SET_CTX_ID(pPrvKey);
+
+    return ippcpSts;
+}
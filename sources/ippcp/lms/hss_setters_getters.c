@@ -0,0 +1,341 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/hss.h"
+
+/*F*
+//    Name: ippsHSSBufferGetSize
+//
+// Purpose: Get the temporary buffer size (bytes) of the HSS verification.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsLengthErr         maxMessageLength < 1
+//                            maxMessageLength > (Ipp32s)(IPP_MAX_32S) -
+//                            - (byteSizeI + 4(q byteSize) + 2(D_MESG byteSize) + 32(C byteSize))
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize             pointer to the work buffer's byte size
+//    maxMessageLength  maximum length of the processing message
+//
+// Note:
+//    the parameters of the levels are known from the signature only, so the size
+//    is computed for the largest hash length.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength))
+{
+    IPP_BAD_PTR1_RET(pSize);
+    IPP_BADARG_RET(maxMessageLength < 1, ippStsLengthErr);
+
+    /* the upper levels verify the public keys of their children */
+    cpLMSParams lmsParams;
+    setLMSParams(LMS_SHA256_M32_H5, &lmsParams);
+    IppsLMSAlgoType lmsType = { LMOTS_SHA256_N32_W1, LMS_SHA256_M32_H5 };
+
+    return ippsLMSBufferGetSize(pSize, IPP_MAX(maxMessageLength, cpLMSPublicKeyByteSize(&lmsParams)), lmsType);
+}
+
+/*F*
+//    Name: ippsHSSPrivateKeyStateGetSize
+//
+// Purpose: Provides the HSS private key state size (bytes).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//                            lmsType == NULL
+//    ippStsBadArgErr         levels < 1 or levels > 8
+//                            lmsType[i].lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType[i].lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType[i].lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType[i].lmsOIDAlgo   < LMS_SHA256_M32_H5
+//                            hash lengths of LMS and LMOTS parameters of a level are different
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize         pointer to the size
+//    levels        number of levels L of HSS tree
+//    lmsType       L structures with LMS parameters of the levels, lmsType[0] is the top level
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSPrivateKeyStateGetSize, (Ipp32s* pSize, Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pSize, lmsType);
+
+    /* Set LMOTS and LMS parameters of the levels */
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams(levels, lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    *pSize = cpHSSPrivateKeyStateSize((Ipp32u)levels, lmsParams, lmotsParams);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsHSSSignatureGetSize
+//
+// Purpose: Provides the HSS signature size (bytes).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//                            lmsType == NULL
+//    ippStsBadArgErr         levels < 1 or levels > 8
+//                            lmsType[i].lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType[i].lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType[i].lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType[i].lmsOIDAlgo   < LMS_SHA256_M32_H5
+//                            hash lengths of LMS and LMOTS parameters of a level are different
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize         pointer to the size
+//    levels        number of levels L of HSS tree
+//    lmsType       L structures with LMS parameters of the levels, lmsType[0] is the top level
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSSignatureGetSize, (Ipp32s* pSize, Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pSize, lmsType);
+
+    /* Set LMOTS and LMS parameters of the levels */
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams(levels, lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    *pSize = cpHSSSignatureByteSize((Ipp32u)levels, lmsParams, lmotsParams);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsHSSKeyGenBufferGetSize
+//
+// Purpose: Get the temporary buffer size (bytes) of the HSS key generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//                            lmsType == NULL
+//    ippStsBadArgErr         levels < 1 or levels > 8
+//                            lmsType[i].lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType[i].lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType[i].lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType[i].lmsOIDAlgo   < LMS_SHA256_M32_H5
+//                            hash lengths of LMS and LMOTS parameters of a level are different
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize         pointer to the work buffer's byte size
+//    levels        number of levels L of HSS tree
+//    lmsType       L structures with LMS parameters of the levels, lmsType[0] is the top level
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSKeyGenBufferGetSize, (Ipp32s* pSize, Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pSize, lmsType);
+
+    /* Set LMOTS and LMS parameters of the levels */
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams(levels, lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    /* the bottom level signs nothing at the key generation */
+    *pSize = cpHSSWorkBufferSize(levels, /*maxMessageLength*/ 0, lmsParams, lmotsParams);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsHSSSignBufferGetSize
+//
+// Purpose: Get the temporary buffer size (bytes) of the HSS signature generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//                            lmsType == NULL
+//    ippStsBadArgErr         levels < 1 or levels > 8
+//                            lmsType[i].lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType[i].lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType[i].lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType[i].lmsOIDAlgo   < LMS_SHA256_M32_H5
+//                            hash lengths of LMS and LMOTS parameters of a level are different
+//    ippStsLengthErr         maxMessageLength < 1
+//                            maxMessageLength is too big for the size to fit Ipp32s
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize             pointer to the work buffer's byte size
+//    maxMessageLength  maximum length of the processing message
+//    levels            number of levels L of HSS tree
+//    lmsType           L structures with LMS parameters of the levels, lmsType[0] is the top level
+//
+// Note:
+//    the buffer is large enough to regenerate the exhausted levels (see ippsHSSSign).
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSSignBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength,
+                                             Ipp32s levels, const IppsLMSAlgoType lmsType[]))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pSize, lmsType);
+
+    /* Set LMOTS and LMS parameters of the levels */
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams(levels, lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    /* Check message length */
+    IPP_BADARG_RET(maxMessageLength < 1, ippStsLengthErr);
+    // the rest of the buffer: signature and public key states, alignment and I || q || D_MESG || C
+    Ipp32s otherSize = cpHSSWorkBufferSize(levels, /*maxMessageLength*/ 1, lmsParams, lmotsParams);
+    IPP_BADARG_RET(maxMessageLength > IPP_MAX_32S - otherSize, ippStsLengthErr);
+
+    *pSize = cpHSSWorkBufferSize(levels, maxMessageLength, lmsParams, lmotsParams);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsHSSPackPrivateKeyState
+//
+// Purpose: Copy the HSS private key state (signer state) to the buffer.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pBuffer == NULL
+//    ippStsContextMatchErr   pState context or context of its level key is invalid
+//    ippStsBadArgErr         wrong LMS or LMOTS parameters inside pState
+//    ippStsNoMemErr          bufSize is less than the state size
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pState      pointer to the HSS private key state
+//    pBuffer     pointer to the destination buffer
+//    bufSize     size of the destination buffer
+//
+// Note:
+//    the packed state contains the private keys of all levels, their indices q of the next
+//    signature and the signed public keys. It must be stored after every ippsHSSSign call,
+//    an old copy of the state must never be used.
+//
+*F*/
+IPPFUN(IppStatus, ippsHSSPackPrivateKeyState, (const IppsHSSPrivateKeyState* pState, Ipp8u* pBuffer, Ipp32s bufSize))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pState, pBuffer);
+    IPP_BADARG_RET( !CP_HSS_VALID_CTX_ID(pState), ippStsContextMatchErr );
+
+    /* Set LMOTS and LMS parameters of the levels */
+    Ipp32u levels = pState->levels;
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams((Ipp32s)levels, pState->lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    for (Ipp32u i = 0; i < levels; i++) {
+        IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(cpHSSLevelKey(pState, i, lmsParams)), ippStsContextMatchErr );
+    }
+    Ipp32s stateSize = cpHSSPrivateKeyStateSize(levels, lmsParams, lmotsParams);
+    IPP_BADARG_RET(stateSize > bufSize, ippStsNoMemErr);
+
+    CopyBlock(pState, pBuffer, stateSize);
+    IppsHSSPrivateKeyState* pCopy = (IppsHSSPrivateKeyState*)pBuffer;
+    CP_HSS_RESET_CTX_ID(pCopy);
+    for (Ipp32u i = 0; i < levels; i++) {
+        IppsLMSPrivateKeyState* pKeyCopy = cpHSSLevelKey(pCopy, i, lmsParams);
+        CP_LMS_RESET_CTX_ID(pKeyCopy);
+    }
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsHSSUnpackPrivateKeyState
+//
+// Purpose: Restore the HSS private key state (signer state) from the buffer.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pBuffer == NULL
+//                            pState == NULL
+//    ippStsContextMatchErr   pBuffer does not contain the packed HSS private key state
+//    ippStsBadArgErr         wrong number of levels inside pBuffer
+//                            wrong LMS or LMOTS parameters inside pBuffer
+//                            parameters of a level key are different from the HSS parameters
+//                            q of a level key inside pBuffer is incorrect
+//                            traversal cache of a level key inside pBuffer is inconsistent
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pBuffer     pointer to the source buffer (see ippsHSSPackPrivateKeyState)
+//    pState      pointer to the HSS private key state of ippsHSSPrivateKeyStateGetSize() size
+//
+// Note:
+//    the key of every level is checked as ippsLMSUnpackPrivateKeyState does.
+//
+*F*/
+IPPFUN(IppStatus, ippsHSSUnpackPrivateKeyState, (const Ipp8u* pBuffer, IppsHSSPrivateKeyState* pState))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pBuffer, pState);
+
+    const IppsHSSPrivateKeyState* pPacked = (const IppsHSSPrivateKeyState*)pBuffer;
+    IPP_BADARG_RET(pPacked->_idCtx != (Ipp32u)idCtxHSS, ippStsContextMatchErr);
+
+    /* Set LMOTS and LMS parameters of the levels */
+    Ipp32u levels = pPacked->levels;
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams((Ipp32s)levels, pPacked->lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    for (Ipp32u i = 0; i < levels; i++) {
+        const IppsLMSPrivateKeyState* pKey = cpHSSLevelKey(pPacked, i, lmsParams);
+        IPP_BADARG_RET(pKey->lmsOIDAlgo != pPacked->lmsType[i].lmsOIDAlgo, ippStsBadArgErr);
+        IPP_BADARG_RET(pKey->lmotsOIDAlgo != pPacked->lmsType[i].lmotsOIDAlgo, ippStsBadArgErr);
+    }
+
+    /* the level keys restore their context ids */
+    for (Ipp32u i = 0; i < levels; i++) {
+        ippcpSts = ippsLMSUnpackPrivateKeyState((const Ipp8u*)cpHSSLevelKey(pPacked, i, lmsParams),
+                                                cpHSSLevelKey(pState, i, lmsParams));
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    }
+    CopyBlock(pPacked, pState, (cpSize)sizeof(IppsHSSPrivateKeyState));
+    CopyBlock(cpHSSSignedKeys(pPacked, lmsParams), cpHSSSignedKeys(pState, lmsParams),
+              cpHSSSignedKeysByteSize(levels, lmsParams, lmotsParams));
+    CP_HSS_SET_CTX_ID(pState);
+
+    return ippcpSts;
+}
@@ -0,0 +1,134 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/hss.h"
+
+/*F*
+//    Name: ippsHSSSign
+//
+// Purpose: HSS signature generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pMsg == NULL
+//                            pPrvKey == NULL
+//                            pSign == NULL
+//                            rndFunc == NULL
+//                            pBuffer == NULL
+//    ippStsBadArgErr         wrong LMS or LMOTS parameters inside pPrvKey
+//    ippStsContextMatchErr   pPrvKey context or context of its level key is invalid
+//    ippStsLengthErr         msgLen < 1
+//    ippStsOutOfRangeErr     all signatures of the top level key were generated
+//    ippStsErr               random generator error
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pMsg           pointer to the message data buffer
+//    msgLen         message buffer length, bytes
+//    pPrvKey        pointer to the HSS private key state
+//    pSign          pointer to the HSS signature of ippsHSSSignatureGetSize() size
+//    rndFunc        function to generate the randomizers C and the keys of the regenerated levels
+//    pRndParam      pointer to the random generator state
+//    pBuffer        pointer to the temporary memory of ippsHSSSignBufferGetSize() size
+//
+// Note:
+//    the signature is written in the standard format (Section 6.2 LMS spec.):
+//       u32str(L-1) || sig[0] || pub[1] || ... || sig[L-2] || pub[L-1] || sig[L-1]
+//    where sig[L-1] is the LMS signature of the message by the bottom level key.
+//    When the key of a level is exhausted, it and all keys below it are generated again and
+//    signed by the parent level. The private key state is updated in place: store it
+//    (see ippsHSSPackPrivateKeyState) before the signature is released.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSSign, (const Ipp8u* pMsg, const Ipp32s msgLen,
+                                IppsHSSPrivateKeyState* pPrvKey,
+                                Ipp8u* pSign,
+                                IppBitSupplier rndFunc, void* pRndParam,
+                                Ipp8u* pBuffer))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    /* Check if any of input pointers are NULL */
+    IPP_BAD_PTR4_RET(pMsg, pPrvKey, pSign, rndFunc)
+    /* Check if temporary buffer is NULL */
+    IPP_BAD_PTR1_RET(pBuffer)
+    /* Check msg length */
+    IPP_BADARG_RET(msgLen < 1, ippStsLengthErr)
+    IPP_BADARG_RET( !CP_HSS_VALID_CTX_ID(pPrvKey), ippStsContextMatchErr );
+
+    /* Set LMOTS and LMS parameters of the levels */
+    Ipp32u levels = pPrvKey->levels;
+    cpLMOTSParams lmotsParams[CP_HSS_MAX_LEVELS];
+    cpLMSParams lmsParams[CP_HSS_MAX_LEVELS];
+    ippcpSts = cpHSSSetParams((Ipp32s)levels, pPrvKey->lmsType, lmsParams, lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    for (Ipp32u i = 0; i < levels; i++) {
+        IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(cpHSSLevelKey(pPrvKey, i, lmsParams)), ippStsContextMatchErr );
+    }
+
+    IppsLMSSignatureState* pLmsSign = (IppsLMSSignatureState*)IPP_ALIGNED_PTR(pBuffer, CP_LMS_MB_ALIGNMENT);
+    IppsLMSPublicKeyState* pChildKey = (IppsLMSPublicKeyState*)((Ipp8u*)pLmsSign +
+                                       cpHSSSignatureStateSize(levels, lmsParams, lmotsParams));
+    Ipp8u* pWork = (Ipp8u*)pChildKey + CP_HSS_PUBKEY_STATE_SIZE;
+
+    /*     Find the deepest level with unused leaves    */
+    /* ------------------------------------------------ */
+    Ipp32u level = levels;
+    while (level > 0) {
+        IppsLMSPrivateKeyState* pKey = cpHSSLevelKey(pPrvKey, level - 1, lmsParams);
+        if (pKey->q < (1u << lmsParams[level - 1].h)) {
+            break;
+        }
+        level--;
+    }
+    IPP_BADARG_RET(0 == level, ippStsOutOfRangeErr)
+
+    /*      Regenerate the exhausted levels below it    */
+    /* ------------------------------------------------ */
+    // the levels are retired first: a failure leaves no key with a stale signed public key
+    for (Ipp32u i = level; i < levels; i++) {
+        cpHSSLevelKey(pPrvKey, i, lmsParams)->q = 1u << lmsParams[i].h;
+    }
+    for (Ipp32u i = level; i < levels; i++) {
+        IppsLMSPrivateKeyState* pKey = cpHSSLevelKey(pPrvKey, i, lmsParams);
+        ippcpSts = ippsLMSKeyGen(pPrvKey->lmsType[i], pKey, pChildKey, rndFunc, pRndParam, pWork);
+        if (ippStsNoErr == ippcpSts) {
+            ippcpSts = cpHSSSignChildKey(pPrvKey, i, pChildKey, lmsParams, lmotsParams, pLmsSign,
+                                         rndFunc, pRndParam, pWork);
+        }
+        if (ippStsNoErr != ippcpSts) {
+            pKey->q = 1u << lmsParams[i].h;
+            return ippcpSts;
+        }
+    }
+
+    /*         Sign the message by the bottom level     */
+    /* ------------------------------------------------ */
+    ippcpSts = ippsLMSSign(pMsg, msgLen, cpHSSLevelKey(pPrvKey, levels - 1, lmsParams), pLmsSign,
+                           rndFunc, pRndParam, pWork);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    // u32str(Nspk) || signed public keys || signature of the message
+    Ipp32s signedKeysLen = cpHSSSignedKeysByteSize(levels, lmsParams, lmotsParams);
+    toByte(pSign, CP_HSS_NSPK_BYTESIZE, levels - 1);
+    CopyBlock(cpHSSSignedKeys(pPrvKey, lmsParams), pSign + CP_HSS_NSPK_BYTESIZE, signedKeysLen);
+    cpHSSEncodeSignature(pSign + CP_HSS_NSPK_BYTESIZE + signedKeysLen, pLmsSign,
+                         &lmsParams[levels - 1], &lmotsParams[levels - 1]);
+
+    return ippcpSts;
+}
@@ -0,0 +1,118 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/hss.h"
+
+/*F*
+//    Name: ippsHSSVerify
+//
+// Purpose: HSS signature verification.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pMsg == NULL
+//                            pSign == NULL
+//                            pIsSignValid == NULL
+//                            pKey == NULL
+//                            pBuffer == NULL
+//    ippStsBadArgErr         levels < 1 or levels > 8
+//                            Nspk inside pSign is not equal to levels - 1
+//                            pSign is truncated
+//                            wrong LMS or LMOTS parameters inside pSign and pKey
+//                            OR q is incorrect
+//    ippStsContextMatchErr   pKey context is invalid
+//    ippStsLengthErr         msgLen < 1
+//                            signLen < 4
+//                            signLen is greater than the parsed signature length
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pMsg           pointer to the message data buffer
+//    msgLen         message buffer length, bytes
+//    pSign          pointer to the HSS signature in the standard format
+//    signLen        HSS signature length, bytes
+//    pIsSignValid   1 if signature is valid, 0 - vice versa
+//    levels         number of levels L of the HSS public key
+//    pKey           pointer to the LMS public key state of the top level
+//    pBuffer        pointer to the temporary memory of ippsHSSBufferGetSize() size
+//
+// Note:
+//    the signed public key of every level is verified with the public key of its parent
+//    (see ippsLMSVerify), the message is verified with the public key of the bottom level.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsHSSVerify, (const Ipp8u* pMsg, const Ipp32s msgLen,
+                                  const Ipp8u* pSign, const Ipp32s signLen,
+                                  int*  pIsSignValid,
+                                  Ipp32s levels,
+                                  const IppsLMSPublicKeyState* pKey,
+                                  Ipp8u* pBuffer))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    /* Check if any of input pointers are NULL */
+    IPP_BAD_PTR4_RET(pMsg, pSign, pIsSignValid, pKey)
+    /* Check if temporary buffer is NULL */
+    IPP_BAD_PTR1_RET(pBuffer)
+    /* Check msg length */
+    IPP_BADARG_RET(msgLen < 1, ippStsLengthErr)
+    IPP_BADARG_RET(levels < 1, ippStsBadArgErr)
+    IPP_BADARG_RET(levels > CP_HSS_MAX_LEVELS, ippStsBadArgErr)
+    IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pKey), ippStsContextMatchErr );
+    *pIsSignValid = 0;
+
+    /*                    Parse Nspk                    */
+    /* ------------------------------------------------ */
+    IPP_BADARG_RET(signLen < CP_HSS_NSPK_BYTESIZE, ippStsLengthErr)
+    IPP_BADARG_RET(cpHSSGetU32(pSign) != (Ipp32u)(levels - 1), ippStsBadArgErr)
+    Ipp32s offset = CP_HSS_NSPK_BYTESIZE;
+
+    /*  Verify the chain of signed public keys and the message  */
+    /* -------------------------------------------------------- */
+    // the signatures and the public keys of the levels point to pSign
+    IppsLMSSignatureState lmsSign;
+    IppsLMSPublicKeyState lmsKey[2];
+    const IppsLMSPublicKeyState* pParentKey = pKey;
+    for (Ipp32s i = 0; i < levels; i++) {
+        Ipp32s len = cpHSSDecodeSignature(pSign + offset, signLen - offset, &lmsSign);
+        IPP_BADARG_RET(0 == len, ippStsBadArgErr)
+        offset += len;
+
+        const Ipp8u* pSigned = pMsg;
+        Ipp32s signedLen = msgLen;
+        IppsLMSPublicKeyState* pChildKey = &lmsKey[i & 1];
+        if (i < levels - 1) {
+            pSigned = pSign + offset;
+            signedLen = cpHSSDecodePublicKey(pSigned, signLen - offset, pChildKey);
+            IPP_BADARG_RET(0 == signedLen, ippStsBadArgErr)
+            offset += signedLen;
+        }
+        else {
+            IPP_BADARG_RET(offset != signLen, ippStsLengthErr)
+        }
+
+        ippcpSts = ippsLMSVerify(pSigned, signedLen, &lmsSign, pIsSignValid, pParentKey, pBuffer);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        if (!*pIsSignValid) {
+            return ippcpSts;
+        }
+        pParentKey = pChildKey;
+    }
+
+    return ippcpSts;
+}
@@ -0,0 +1,203 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/lmots.h"
+
+/*
+ * Computes Winternitz chains of numSets LMOTS signatures (Algorithms 3 and 4b LMS spec.):
+ * for each set s in [0, numSets) and chain i in [0, p)
+ *    tmp = pIn[s][i]
+ *    for j = pStart[s][i] .. pEnd[s][i]-1
+ *       tmp = H(I || u32str(q_s) || u16str(i) || u8str(j) || tmp)
+ *    pOut[s][i] = tmp
+ *
+ * The chains are independent, so they are hashed in parallel by the multi-buffer
+ * hash engine: each of CP_LMOTS_MAX_CHAIN_LANES lanes keeps one chain and takes
+ * the next one (of the same or of the next set) as soon as the current is completed.
+ * The engine dispatches to Intel(R) AVX-512 / Intel(R) AVX2 multi-lane SHA-256 code
+ * if it is available and to the single-buffer SHA-256 otherwise.
+ *
+ * Returns:                Reason:
+ *    ippStsNoErr             no errors
+ *    error code of the hash engine
+ *
+ * Input parameters:
+ *    pIn       numSets arrays of p chains start values, n bytes each
+ *    pIq       numSets values of I || u32str(q), 20 bytes each
+ *    pStart    numSets arrays of p start indices of chains
+ *    pEnd      numSets arrays of p end indices of chains, pEnd[s][i] >= pStart[s][i]
+ *    numSets   number of sets of chains
+ *    params    LMOTS parameters (w, p, ls, n, hash_method)
+ *
+ * Output parameters:
+ *    pOut      numSets arrays of p chains end values, n bytes each (pOut[s] == pIn[s] is allowed)
+ */
+IPP_OWN_DEFN(IppStatus, cpLMOTSChains, (Ipp8u* const pOut[], const Ipp8u* const pIn[], const Ipp8u* const pIq[],
+            const Ipp8u* const pStart[], const Ipp8u* const pEnd[], Ipp32s numSets,
+            const cpLMOTSParams* params)) {
+    IppStatus ippcpSts = ippStsNoErr;
+    Ipp32u nParam = params->n;
+    Ipp32u pParam = params->p;
+    int msgLen = (int)(CP_LMOTS_CHAIN_PREFIX_BYTESIZE + nParam);
+
+    // I || u32str(q) || u16str(i) || u8str(j) || tmp of every lane
+    Ipp8u msg[CP_LMOTS_MAX_CHAIN_LANES][CP_LMOTS_CHAIN_PREFIX_BYTESIZE+IPP_SHA256_DIGEST_BITSIZE/8];
+    Ipp8u md[CP_LMOTS_MAX_CHAIN_LANES][IPP_SHA256_DIGEST_BITSIZE/8];
+    const Ipp8u* pMsgs[CP_LMOTS_MAX_CHAIN_LANES];
+    Ipp8u* pMDs[CP_LMOTS_MAX_CHAIN_LANES];
+    int lens[CP_LMOTS_MAX_CHAIN_LANES];
+    Ipp32s setIdx[CP_LMOTS_MAX_CHAIN_LANES];
+    Ipp32u chainIdx[CP_LMOTS_MAX_CHAIN_LANES];
+    Ipp32s nextSet = 0;
+    Ipp32u nextChain = 0;
+    int nLanes = 0;
+
+    for (int k = 0; k < CP_LMOTS_MAX_CHAIN_LANES; k++) {
+        pMsgs[k] = msg[k];
+        pMDs[k] = md[k];
+        lens[k] = msgLen;
+    }
+
+    for (;;) {
+        // fill the free lanes by the next chains
+        while (nLanes < CP_LMOTS_MAX_CHAIN_LANES && nextSet < numSets) {
+            Ipp32s s = nextSet;
+            Ipp32u i = nextChain++;
+            if (nextChain == pParam) {
+                nextChain = 0;
+                nextSet++;
+            }
+            if (pStart[s][i] >= pEnd[s][i]) {
+                // nothing to hash
+                CopyBlock(pIn[s] + i*nParam, pOut[s] + i*nParam, (cpSize)nParam);
+                continue;
+            }
+            Ipp8u* pLane = msg[nLanes];
+            CopyBlock(pIq[s], pLane, /*I byteLen*/16 + /*q byteLen*/4);
+            toByte(pLane + /*I byteLen*/16 + /*q byteLen*/4, /*i byteLen*/2, i);
+            pLane[CP_LMOTS_CHAIN_PREFIX_BYTESIZE - 1] = pStart[s][i];
+            CopyBlock(pIn[s] + i*nParam, pLane + CP_LMOTS_CHAIN_PREFIX_BYTESIZE, (cpSize)nParam);
+            setIdx[nLanes] = s;
+            chainIdx[nLanes++] = i;
+        }
+        if (0 == nLanes) {
+            break;
+        }
+
+        // tmp = H(I || u32str(q) || u16str(i) || u8str(j) || tmp) for all lanes
+        ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, params->hash_method);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // step the chains, release lanes of the completed chains
+        for (int k = 0; k < nLanes; ) {
+            Ipp32s s = setIdx[k];
+            Ipp32u i = chainIdx[k];
+            Ipp8u j = (Ipp8u)(msg[k][CP_LMOTS_CHAIN_PREFIX_BYTESIZE - 1] + 1);
+            if (j < pEnd[s][i]) {
+                msg[k][CP_LMOTS_CHAIN_PREFIX_BYTESIZE - 1] = j;
+                CopyBlock(md[k], msg[k] + CP_LMOTS_CHAIN_PREFIX_BYTESIZE, (cpSize)nParam);
+                k++;
+            }
+            else {
+                CopyBlock(md[k], pOut[s] + i*nParam, (cpSize)nParam);
+                // move the last lane in place of the completed one
+                nLanes--;
+                if (k != nLanes) {
+                    CopyBlock(msg[nLanes], msg[k], msgLen);
+                    CopyBlock(md[nLanes], md[k], (cpSize)nParam);
+                    setIdx[k] = setIdx[nLanes];
+                    chainIdx[k] = chainIdx[nLanes];
+                }
+            }
+        }
+    }
+
+    PurgeBlock(msg, (int)sizeof(msg));
+    PurgeBlock(md, (int)sizeof(md));
+    return ippcpSts;
+}
+
+/*
+ * Computes LMOTS private keys of numSets leaves (Appendix A LMS spec.):
+ * for each set s in [0, numSets) and i in [0, p)
+ *    pX[s][i] = H(I || u32str(q_s) || u16str(i) || u8str(0xff) || SEED)
+ *
+ * The values are hashed by groups of CP_LMOTS_MAX_CHAIN_LANES with the multi-buffer hash engine.
+ *
+ * Returns:                Reason:
+ *    ippStsNoErr             no errors
+ *    error code of the hash engine
+ *
+ * Input parameters:
+ *    pIq       numSets values of I || u32str(q), 20 bytes each
+ *    pSeed     n-byte SEED of the LMS private key
+ *    numSets   number of sets
+ *    params    LMOTS parameters (w, p, ls, n, hash_method)
+ *
+ * Output parameters:
+ *    pX        numSets arrays of p private key values, n bytes each
+ */
+IPP_OWN_DEFN(IppStatus, cpLMOTSPrivateKeys, (Ipp8u* const pX[], const Ipp8u* const pIq[], const Ipp8u* pSeed,
+            Ipp32s numSets, const cpLMOTSParams* params)) {
+    IppStatus ippcpSts = ippStsNoErr;
+    Ipp32u nParam = params->n;
+    Ipp32u pParam = params->p;
+    int msgLen = (int)(CP_LMOTS_CHAIN_PREFIX_BYTESIZE + nParam);
+
+    // I || u32str(q) || u16str(i) || u8str(0xff) || SEED of every lane
+    Ipp8u msg[CP_LMOTS_MAX_CHAIN_LANES][CP_LMOTS_CHAIN_PREFIX_BYTESIZE+IPP_SHA256_DIGEST_BITSIZE/8];
+    Ipp8u md[CP_LMOTS_MAX_CHAIN_LANES][IPP_SHA256_DIGEST_BITSIZE/8];
+    const Ipp8u* pMsgs[CP_LMOTS_MAX_CHAIN_LANES];
+    Ipp8u* pMDs[CP_LMOTS_MAX_CHAIN_LANES];
+    int lens[CP_LMOTS_MAX_CHAIN_LANES];
+    Ipp8u* pDst[CP_LMOTS_MAX_CHAIN_LANES];
+
+    for (int k = 0; k < CP_LMOTS_MAX_CHAIN_LANES; k++) {
+        pMsgs[k] = msg[k];
+        pMDs[k] = md[k];
+        lens[k] = msgLen;
+        msg[k][CP_LMOTS_CHAIN_PREFIX_BYTESIZE - 1] = 0xff;
+        CopyBlock(pSeed, msg[k] + CP_LMOTS_CHAIN_PREFIX_BYTESIZE, (cpSize)nParam);
+    }
+
+    Ipp32s s = 0;
+    Ipp32u i = 0;
+    while (s < numSets) {
+        int nLanes = 0;
+        for (; nLanes < CP_LMOTS_MAX_CHAIN_LANES && s < numSets; nLanes++) {
+            CopyBlock(pIq[s], msg[nLanes], /*I byteLen*/16 + /*q byteLen*/4);
+            toByte(msg[nLanes] + /*I byteLen*/16 + /*q byteLen*/4, /*i byteLen*/2, i);
+            pDst[nLanes] = pX[s] + i*nParam;
+            if (++i == pParam) {
+                i = 0;
+                s++;
+            }
+        }
+
+        ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, params->hash_method);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        for (int k = 0; k < nLanes; k++) {
+            CopyBlock(md[k], pDst[k], (cpSize)nParam);
+        }
+    }
+
+    PurgeBlock(msg, (int)sizeof(msg));
+    PurgeBlock(md, (int)sizeof(md));
+    return ippcpSts;
+}
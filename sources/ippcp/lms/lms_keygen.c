@@ -0,0 +1,169 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/lms.h"
+
+/*F*
+//    Name: ippsLMSKeyGen
+//
+// Purpose: LMS private and public keys generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pPrvKey == NULL
+//                            pPubKey == NULL
+//                            rndFunc == NULL
+//                            pBuffer == NULL
+//    ippStsBadArgErr         lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType.lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType.lmsOIDAlgo   < LMS_SHA256_M32_H5
+//                            hash lengths of LMS and LMOTS parameters are different
+//    ippStsErr               random generator error
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    lmsType        structure with LMS parameters lmotsOIDAlgo and lmsOIDAlgo
+//    pPrvKey        pointer to the LMS private key state of ippsLMSPrivateKeyStateGetSize() size
+//    pPubKey        pointer to the LMS public key state of ippsLMSPublicKeyStateGetSize() size
+//    rndFunc        function to generate I and SEED
+//    pRndParam      pointer to the random generator state
+//    pBuffer        pointer to the temporary memory of ippsLMSKeyGenBufferGetSize() size
+//
+// Note:
+//    all 2^h leaves of the tree are computed, they are hashed by groups of
+//    IPP_HASH_MB_MAX_BUFFERS with the multi-buffer hash engine. The private key state
+//    keeps the auth path of the leaf 0 and the nodes needed to update it (see ippsLMSSign).
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSKeyGen, (const IppsLMSAlgoType lmsType,
+                                  IppsLMSPrivateKeyState* pPrvKey,
+                                  IppsLMSPublicKeyState* pPubKey,
+                                  IppBitSupplier rndFunc, void* pRndParam,
+                                  Ipp8u* pBuffer))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR4_RET(pPrvKey, pPubKey, rndFunc, pBuffer);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+    /* Set LMOTS and LMS parameters */
+    cpLMOTSParams lmotsParams;
+    ippcpSts = setLMOTSParams(lmsType.lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    cpLMSParams lmsParams;
+    ippcpSts = setLMSParams(lmsType.lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    IPP_BADARG_RET(lmotsParams.n != lmsParams.m, ippStsBadArgErr);
+    Ipp32u hParam = lmsParams.h;
+    Ipp32u mParam = lmsParams.m;
+
+    /*            Generate I and SEED            */
+    /* ----------------------------------------- */
+    Ipp32u rnd[(CP_PK_I_BYTESIZE + CP_LMS_MAX_HASH_BYTESIZE) / sizeof(Ipp32u)];
+    ippcpSts = rndFunc(rnd, (int)((CP_PK_I_BYTESIZE + mParam) * 8), pRndParam);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippStsErr)
+
+    pPrvKey->lmsOIDAlgo = lmsType.lmsOIDAlgo;
+    pPrvKey->lmotsOIDAlgo = lmsType.lmotsOIDAlgo;
+    pPrvKey->q = 0;
+    CopyBlock(rnd, pPrvKey->I, CP_PK_I_BYTESIZE);
+    CopyBlock((Ipp8u*)rnd + CP_PK_I_BYTESIZE, pPrvKey->SEED, (cpSize)mParam);
+    PurgeBlock(rnd, (int)sizeof(rnd));
+
+    /*   Compute the tree (Algorithm 5 LMS spec.)  */
+    /* ------------------------------------------- */
+    Ipp8u* pAuth = CP_LMS_AUTH_PATH(pPrvKey);
+    Ipp8u* pNodes = CP_LMS_TREEHASH_NODE(pPrvKey, hParam, mParam);
+    Ipp8u root[CP_LMS_MAX_HASH_BYTESIZE];
+
+    // the leaves are processed from left to right, a node is merged with its left sibling on the stack
+    Ipp8u stack[CP_LMS_MAX_TREE_HEIGHT][CP_LMS_MAX_HASH_BYTESIZE];
+    Ipp32u stackHeight[CP_LMS_MAX_TREE_HEIGHT];
+    Ipp32u stackSize = 0;
+
+    Ipp8u leaf[CP_LMS_MB_MAX_SIGNS][CP_LMS_MAX_HASH_BYTESIZE];
+    Ipp8u* pLeaf[CP_LMS_MB_MAX_SIGNS];
+    Ipp32u leafIdx[CP_LMS_MB_MAX_SIGNS];
+    for (int k = 0; k < CP_LMS_MB_MAX_SIGNS; k++) {
+        pLeaf[k] = leaf[k];
+    }
+
+    Ipp32u numLeaves = 1u << hParam;
+    for (Ipp32u q0 = 0; q0 < numLeaves; q0 += CP_LMS_MB_MAX_SIGNS) {
+        Ipp32s nLeaves = (Ipp32s)IPP_MIN(numLeaves - q0, CP_LMS_MB_MAX_SIGNS);
+        for (Ipp32s k = 0; k < nLeaves; k++) {
+            leafIdx[k] = q0 + (Ipp32u)k;
+        }
+        ippcpSts = cpLMSLeaves(pLeaf, leafIdx, nLeaves, pPrvKey->I, pPrvKey->SEED, &lmsParams, &lmotsParams, pBuffer);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        for (Ipp32s k = 0; k < nLeaves; k++) {
+            Ipp8u* pNode = leaf[k];
+            Ipp32u nodeHeight = 0;
+            Ipp32u nodeIdx = leafIdx[k];
+            for (;;) {
+                // the first two nodes of every height: the auth path of the leaf 0
+                // and the node replacing it at the leaf 2^height
+                if (nodeHeight < hParam && nodeIdx < 2) {
+                    CopyBlock(pNode, (nodeIdx ? pAuth : pNodes) + nodeHeight * mParam, (cpSize)mParam);
+                }
+                if (0 == stackSize || stackHeight[stackSize - 1] != nodeHeight) {
+                    break;
+                }
+                stackSize--;
+                nodeIdx >>= 1;
+                nodeHeight++;
+                ippcpSts = cpLMSInnerNode(pNode, (1u << (hParam - nodeHeight)) + nodeIdx,
+                                          stack[stackSize], pNode, pPrvKey->I, &lmsParams);
+                IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+            }
+            if (nodeHeight == hParam) {
+                CopyBlock(pNode, root, (cpSize)mParam);
+            }
+            else {
+                CopyBlock(pNode, stack[stackSize], (cpSize)mParam);
+                stackHeight[stackSize++] = nodeHeight;
+            }
+        }
+    }
+
+    // node of height i replacing the auth path is ready for the leaf 2^i
+    for (Ipp32u i = 0; i < CP_LMS_MAX_TREE_HEIGHT; i++) {
+        pPrvKey->treeHash[i].nextLeaf = (i < hParam) ? 1u << i : 0;
+        pPrvKey->treeHash[i].endLeaf = pPrvKey->treeHash[i].nextLeaf;
+        pPrvKey->treeHash[i].stackSize = 0;
+    }
+    /* Set context id when the key is complete */
+    CP_LMS_SET_CTX_ID(pPrvKey);
+
+    /*          Set the public key          */
+    /* ------------------------------------ */
+    CP_LMS_SET_CTX_ID(pPubKey);
+    pPubKey->lmsOIDAlgo = lmsType.lmsOIDAlgo;
+    pPubKey->lmotsOIDAlgo = lmsType.lmotsOIDAlgo;
+    CopyBlock(pPrvKey->I, pPubKey->I, CP_PK_I_BYTESIZE);
+    // Set pointer to T1 right to the end of the context
+    pPubKey->T1 = (Ipp8u*)pPubKey+sizeof(IppsLMSPublicKeyState);
+    CopyBlock(root, pPubKey->T1, (cpSize)mParam);
+
+    return ippcpSts;
+}
@@ -16,6 +16,7 @@
 
 #include "owndefs.h"
 #include "lms_internal/lms.h"
+#include "pcphash_mb_rmf.h"
 
 /*F*
 //    Name: ippsLMSBufferGetSize
@@ -82,6 +83,54 @@ IPPFUN(IppStatus, ippsLMSBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength,
     return ippcpSts;
 }
 
+/*F*
+//    Name: ippsLMSBufferGetSize_MB
+//
+// Purpose: Get the temporary buffer size (bytes) of the LMS verification
+//          of several signatures (ippsLMSVerify_MB).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsBadArgErr         lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType.lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType.lmsOIDAlgo   < LMS_SHA256_M32_H5
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize             pointer to the work buffer's byte size
+//    lmsType           structure with LMS parameters lmotsOIDAlgo and lmsOIDAlgo
+//
+// Note:
+//    the size does not depend on the messages lengths and number of signatures.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSBufferGetSize_MB, (Ipp32s* pSize, const IppsLMSAlgoType lmsType))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    /* Input parameters check */
+    IPP_BAD_PTR1_RET(pSize);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+    /* Set LMOTS parameters */
+    cpLMOTSParams lmotsParams;
+    ippcpSts = setLMOTSParams(lmsType.lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+                 //    pubKey->I   ||  q  ||  D_PBLC  ||          z[0..p-1]
+    Ipp32u lenBufZ = CP_PK_I_BYTESIZE +  4  +    2     + lmotsParams.p * lmotsParams.n;
+
+    *pSize = (Ipp32s)sizeof(IppsHashState_MB_rmf) + CP_LMS_MB_ALIGNMENT - 1 + /* multi-buffer hash state */
+             (Ipp32s)(CP_LMS_MB_MAX_SIGNS * lenBufZ);                          /* z of the signatures     */
+
+    return ippcpSts;
+}
+
 /*F*
 //    Name: ippsLMSSignatureStateGetSize
 //
@@ -119,10 +168,7 @@ IPPFUN(IppStatus, ippsLMSSignatureStateGetSize, (Ipp32s* pSize, const IppsLMSAlg
     ippcpSts = setLMSParams(lmsType.lmsOIDAlgo, &lmsParams);
     IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
 
-    *pSize = (Ipp32s)sizeof(IppsLMSSignatureState)  +
-             (Ipp32s)(lmotsParams.n * lmsParams.h)  + /*_pAuthPath*/
-             (Ipp32s)lmotsParams.n                  + /* C */
-             (Ipp32s)(lmotsParams.n * lmotsParams.p); /* Y */
+    *pSize = cpLMSSignatureStateSize(&lmsParams, &lmotsParams);
 
     return ippcpSts;
 }
@@ -299,3 +345,315 @@ IPPFUN(IppStatus, ippsLMSSetSignatureState, (const IppsLMSAlgoType lmsType,
 
     return ippcpSts;
 }
+
+/*F*
+//    Name: ippsLMSPrivateKeyStateGetSize
+//
+// Purpose: Get the LMS private key state size (bytes).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsBadArgErr         lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType.lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType.lmsOIDAlgo   < LMS_SHA256_M32_H5
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize         pointer to the size
+//    lmsType       structure with LMS parameters lmotsOIDAlgo and lmsOIDAlgo
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSPrivateKeyStateGetSize, (Ipp32s* pSize, const IppsLMSAlgoType lmsType))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR1_RET(pSize);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+    /* Set LMS parameters */
+    cpLMSParams lmsParams;
+    ippcpSts = setLMSParams(lmsType.lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    *pSize = cpLMSPrivateKeyStateSize(&lmsParams);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsLMSKeyGenBufferGetSize
+//
+// Purpose: Get the temporary buffer size (bytes) of the LMS key generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsBadArgErr         lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType.lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType.lmsOIDAlgo   < LMS_SHA256_M32_H5
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize             pointer to the work buffer's byte size
+//    lmsType           structure with LMS parameters lmotsOIDAlgo and lmsOIDAlgo
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSKeyGenBufferGetSize, (Ipp32s* pSize, const IppsLMSAlgoType lmsType))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR1_RET(pSize);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+    /* Set LMOTS parameters */
+    cpLMOTSParams lmotsParams;
+    ippcpSts = setLMOTSParams(lmsType.lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    *pSize = cpLMSLeavesBufferSize(&lmotsParams);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsLMSSignBufferGetSize
+//
+// Purpose: Get the temporary buffer size (bytes) of the LMS signature generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsBadArgErr         lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8
+//                            lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1
+//                            lmsType.lmsOIDAlgo   > LMS_SHA256_M24_H25
+//                            lmsType.lmsOIDAlgo   < LMS_SHA256_M32_H5
+//    ippStsLengthErr         maxMessageLength < 1
+//                            maxMessageLength > (Ipp32s)(IPP_MAX_32S) -
+//                            - (byteSizeI + 4(q byteSize) + 2(D_MESG byteSize) + n(C byteSize))
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize             pointer to the work buffer's byte size
+//    maxMessageLength  maximum length of the processing message
+//    lmsType           structure with LMS parameters lmotsOIDAlgo and lmsOIDAlgo
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSSignBufferGetSize, (Ipp32s* pSize, Ipp32s maxMessageLength, const IppsLMSAlgoType lmsType))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR1_RET(pSize);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+    IPP_BADARG_RET(lmsType.lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+    /* Set LMOTS parameters */
+    cpLMOTSParams lmotsParams;
+    ippcpSts = setLMOTSParams(lmsType.lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    /* Check message length */
+    IPP_BADARG_RET(maxMessageLength < 1, ippStsLengthErr);
+    IPP_BADARG_RET(maxMessageLength  >  (Ipp32s)((IPP_MAX_32S) - (CP_PK_I_BYTESIZE + 4 +   2    + lmotsParams.n)),
+                   ippStsLengthErr);
+
+                   //    pubKey->I   ||  q  ||  D_MESG  ||          C        ||            pMsg
+    Ipp32s lenBufQ = (Ipp32s)(CP_PK_I_BYTESIZE +  4   +     2     +    lmotsParams.n)  + maxMessageLength;
+
+    /* the buffer is used to compute Q and then to update the traversal cache */
+    *pSize = IPP_MAX(lenBufQ, cpLMSLeavesBufferSize(&lmotsParams));
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsLMSGetPublicKeyState
+//
+// Purpose: Get LMS public key.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pI == NULL
+//                            pK == NULL
+//    ippStsContextMatchErr   pState context is invalid
+//    ippStsBadArgErr         wrong LMS parameters inside pState
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pState          pointer to the LMS public key state
+//    pI              pointer to the LMS private key identifier (16 bytes)
+//    pK              pointer to the LMS public key (m bytes)
+//
+*F*/
+IPPFUN(IppStatus, ippsLMSGetPublicKeyState, (const IppsLMSPublicKeyState* pState, Ipp8u* pI, Ipp8u* pK))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR3_RET(pState, pI, pK);
+    IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pState), ippStsContextMatchErr );
+
+    /* Set LMS parameters */
+    cpLMSParams lmsParams;
+    ippcpSts = setLMSParams(pState->lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    CopyBlock(pState->I, pI, CP_PK_I_BYTESIZE);
+    CopyBlock(pState->T1, pK, (cpSize)lmsParams.m);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsLMSGetSignatureState
+//
+// Purpose: Get LMS signature.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pQ == NULL
+//                            pC == NULL
+//                            pY == NULL
+//                            pAuthPath == NULL
+//    ippStsContextMatchErr   pState context is invalid
+//    ippStsBadArgErr         wrong LMS or LMOTS parameters inside pState
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pState         pointer to the LMS signature state
+//    pQ             pointer to the index of LMS leaf
+//    pC             pointer to the C LM-OTS value (n bytes)
+//    pY             pointer to the y LM-OTS value (p * n bytes)
+//    pAuthPath      pointer to the LMS authorization path (h * m bytes)
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSGetSignatureState, (const IppsLMSSignatureState* pState,
+                                             Ipp32u* pQ,
+                                             Ipp8u* pC,
+                                             Ipp8u* pY,
+                                             Ipp8u* pAuthPath))
+{
+    IPP_BAD_PTR4_RET(pState, pQ, pC, pY);
+    IPP_BAD_PTR1_RET(pAuthPath);
+    IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pState), ippStsContextMatchErr );
+
+    IppStatus ippcpSts = ippStsNoErr;
+
+    /* Set LMOTS and LMS parameters */
+    cpLMOTSParams lmotsParams;
+    ippcpSts = setLMOTSParams(pState->_lmotsSig._lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    cpLMSParams lmsParams;
+    ippcpSts = setLMSParams(pState->_lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    *pQ = pState->_q;
+    CopyBlock(pState->_pAuthPath, pAuthPath, (cpSize)(lmsParams.h * lmotsParams.n));
+    CopyBlock(pState->_lmotsSig.pC, pC, (cpSize)lmotsParams.n);
+    CopyBlock(pState->_lmotsSig.pY, pY, (cpSize)(lmotsParams.n * lmotsParams.p));
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsLMSPackPrivateKeyState
+//
+// Purpose: Copy the LMS private key state (signer state) to the buffer.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pBuffer == NULL
+//    ippStsContextMatchErr   pState context is invalid
+//    ippStsBadArgErr         wrong LMS parameters inside pState
+//    ippStsNoMemErr          bufSize is less than the state size
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pState      pointer to the LMS private key state
+//    pBuffer     pointer to the destination buffer
+//    bufSize     size of the destination buffer
+//
+// Note:
+//    the packed state contains the private key and the index q of the next signature.
+//    It must be stored after every ippsLMSSign call, an old copy of the state must never be used.
+//
+*F*/
+IPPFUN(IppStatus, ippsLMSPackPrivateKeyState, (const IppsLMSPrivateKeyState* pState, Ipp8u* pBuffer, Ipp32s bufSize))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pState, pBuffer);
+    IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pState), ippStsContextMatchErr );
+
+    /* Set LMS parameters */
+    cpLMSParams lmsParams;
+    ippcpSts = setLMSParams(pState->lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    Ipp32s stateSize = cpLMSPrivateKeyStateSize(&lmsParams);
+    IPP_BADARG_RET(stateSize > bufSize, ippStsNoMemErr);
+
+    CopyBlock(pState, pBuffer, stateSize);
+    IppsLMSPrivateKeyState* pCopy = (IppsLMSPrivateKeyState*)pBuffer;
+    CP_LMS_RESET_CTX_ID(pCopy);
+
+    return ippcpSts;
+}
+
+/*F*
+//    Name: ippsLMSUnpackPrivateKeyState
+//
+// Purpose: Restore the LMS private key state (signer state) from the buffer.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pBuffer == NULL
+//                            pState == NULL
+//    ippStsContextMatchErr   pBuffer does not contain the packed LMS private key state
+//    ippStsBadArgErr         wrong LMS or LMOTS parameters inside pBuffer
+//                            q inside pBuffer is incorrect
+//                            traversal cache inside pBuffer is inconsistent
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pBuffer     pointer to the source buffer (see ippsLMSPackPrivateKeyState)
+//    pState      pointer to the LMS private key state of ippsLMSPrivateKeyStateGetSize() size
+//
+*F*/
+IPPFUN(IppStatus, ippsLMSUnpackPrivateKeyState, (const Ipp8u* pBuffer, IppsLMSPrivateKeyState* pState))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    IPP_BAD_PTR2_RET(pBuffer, pState);
+
+    const IppsLMSPrivateKeyState* pPacked = (const IppsLMSPrivateKeyState*)pBuffer;
+    IPP_BADARG_RET(pPacked->_idCtx != (Ipp32u)idCtxLMS, ippStsContextMatchErr);
+    IPP_BADARG_RET(pPacked->lmotsOIDAlgo > LMOTS_SHA256_N24_W8, ippStsBadArgErr);
+    IPP_BADARG_RET(pPacked->lmotsOIDAlgo < LMOTS_SHA256_N32_W1, ippStsBadArgErr);
+    IPP_BADARG_RET(pPacked->lmsOIDAlgo > LMS_SHA256_M24_H25,  ippStsBadArgErr);
+    IPP_BADARG_RET(pPacked->lmsOIDAlgo < LMS_SHA256_M32_H5,   ippStsBadArgErr);
+
+    /* Set LMOTS and LMS parameters */
+    cpLMOTSParams lmotsParams;
+    ippcpSts = setLMOTSParams(pPacked->lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    cpLMSParams lmsParams;
+    ippcpSts = setLMSParams(pPacked->lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    IPP_BADARG_RET(lmotsParams.n != lmsParams.m, ippStsBadArgErr);
+    IPP_BADARG_RET(pPacked->q > (1u << lmsParams.h), ippStsBadArgErr);
+    IPP_BADARG_RET(!cpLMSTraversalIsValid(pPacked, &lmsParams), ippStsBadArgErr);
+
+    CopyBlock(pBuffer, pState, cpLMSPrivateKeyStateSize(&lmsParams));
+    CP_LMS_SET_CTX_ID(pState);
+
+    return ippcpSts;
+}
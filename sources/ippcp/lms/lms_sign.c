@@ -0,0 +1,186 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/lms.h"
+
+/*F*
+//    Name: ippsLMSSign
+//
+// Purpose: LMS signature generation.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pMsg == NULL
+//                            pPrvKey == NULL
+//                            pSign == NULL
+//                            rndFunc == NULL
+//                            pBuffer == NULL
+//    ippStsBadArgErr         wrong LMS or LMOTS parameters inside pPrvKey
+//    ippStsContextMatchErr   pPrvKey context is invalid
+//    ippStsLengthErr         msgLen < 1
+//    ippStsOutOfRangeErr     all 2^h signatures of the key were generated
+//    ippStsErr               random generator error
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pMsg           pointer to the message data buffer
+//    msgLen         message buffer length, bytes
+//    pPrvKey        pointer to the LMS private key state
+//    pSign          pointer to the LMS signature state of ippsLMSSignatureStateGetSize() size
+//    rndFunc        function to generate the randomizer C
+//    pRndParam      pointer to the random generator state
+//    pBuffer        pointer to the temporary memory of ippsLMSSignBufferGetSize() size
+//
+// Note:
+//    The leaf q of the private key is used and pPrvKey->q is advanced before any part of
+//    the signature is produced, so a leaf is never used twice even if the function fails.
+//    Store the private key state (see ippsLMSPackPrivateKeyState) before the signature is released.
+//
+//    The auth path is taken from the traversal cache of the private key, then the cache is
+//    updated for the next leaf: at most h leaves are computed instead of the whole tree.
+//    The cache is updated on the error paths too, so the key stays usable after a failed call.
+//    If the update fails, the key is marked as exhausted.
+//
+*F*/
+
+/* moves the traversal cache to leaf q+1 after leaf q was reserved; marks the key exhausted on failure */
+static IppStatus cpLMSSignNextLeaf(IppsLMSPrivateKeyState* pPrvKey, Ipp32u q, Ipp32u qLimit,
+                                   const cpLMSParams* lmsParams, const cpLMOTSParams* lmotsParams,
+                                   Ipp8u* pBuffer)
+{
+    IppStatus ippcpSts = ippStsNoErr;
+    if (q + 1 < qLimit) {
+        ippcpSts = cpLMSTraversalUpdate(pPrvKey, lmsParams, lmotsParams, pBuffer);
+        if (ippStsNoErr != ippcpSts) {
+            // the cache may be inconsistent: the key is not used anymore
+            pPrvKey->q = qLimit;
+        }
+    }
+    return ippcpSts;
+}
+
+IPPFUN(IppStatus, ippsLMSSign, (const Ipp8u* pMsg, const Ipp32s msgLen,
+                                IppsLMSPrivateKeyState* pPrvKey,
+                                IppsLMSSignatureState* pSign,
+                                IppBitSupplier rndFunc, void* pRndParam,
+                                Ipp8u* pBuffer))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    /* Check if any of input pointers are NULL */
+    IPP_BAD_PTR4_RET(pMsg, pPrvKey, pSign, rndFunc)
+    /* Check if temporary buffer is NULL */
+    IPP_BAD_PTR1_RET(pBuffer)
+    /* Check msg length */
+    IPP_BADARG_RET(msgLen < 1, ippStsLengthErr)
+    IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pPrvKey), ippStsContextMatchErr );
+
+    // Set LMOTS and LMS parameters
+    cpLMOTSParams lmotsParams;
+    cpLMSParams lmsParams;
+    ippcpSts = setLMOTSParams(pPrvKey->lmotsOIDAlgo, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    ippcpSts = setLMSParams(pPrvKey->lmsOIDAlgo, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    IPP_BADARG_RET(lmotsParams.n != lmsParams.m, ippStsBadArgErr);
+    Ipp32u nParam = lmotsParams.n;
+    Ipp32u wParam = lmotsParams.w;
+    Ipp32u pParam = lmotsParams.p;
+    Ipp32u hParam = lmsParams.h;
+    Ipp32u mParam = lmsParams.m;
+
+    /*             Reserve the leaf q             */
+    /* ------------------------------------------ */
+    Ipp32u q = pPrvKey->q;
+    Ipp32u qLimit = 1 << hParam;
+    IPP_BADARG_RET(q >= qLimit, ippStsOutOfRangeErr)
+    pPrvKey->q = q + 1;
+
+    /*          Set the signature state           */
+    /* ------------------------------------------ */
+    CP_LMS_SET_CTX_ID(pSign);
+    pSign->_q = q;
+    pSign->_lmsOIDAlgo = pPrvKey->lmsOIDAlgo;
+    _cpLMOTSSignatureState* pLmotsSig = &(pSign->_lmotsSig);
+    pLmotsSig->_lmotsOIDAlgo = pPrvKey->lmotsOIDAlgo;
+    pSign->_pAuthPath = (Ipp8u*)pSign+sizeof(IppsLMSSignatureState);
+    pLmotsSig->pC = pSign->_pAuthPath + hParam * mParam;
+    pLmotsSig->pY = pLmotsSig->pC + nParam;
+
+    // C is random
+    Ipp32u rndC[CP_LMS_MAX_HASH_BYTESIZE / sizeof(Ipp32u)];
+    ippcpSts = rndFunc(rndC, (int)(nParam * 8), pRndParam);
+    if (ippStsNoErr != ippcpSts) {
+        cpLMSSignNextLeaf(pPrvKey, q, qLimit, &lmsParams, &lmotsParams, pBuffer);
+        return ippStsErr;
+    }
+    CopyBlock(rndC, pLmotsSig->pC, (cpSize)nParam);
+
+    /*   LMOTS signature (Algorithm 3 LMS spec.)   */
+    /* ------------------------------------------- */
+    Ipp8u* tmpQBuf = pBuffer;
+    Ipp32u total_size = 0;
+    CopyBlock(pPrvKey->I, tmpQBuf, CP_PK_I_BYTESIZE); total_size+=CP_PK_I_BYTESIZE;
+    toByte(tmpQBuf+total_size, /*q byteLen*/ 4, q); total_size += /*q byteLen*/ 4;
+    toByte(tmpQBuf+total_size, /*D_MESG byteLen*/ 2, D_MESG); total_size += /*D_MESG byteLen*/ 2;
+    CopyBlock(pLmotsSig->pC, tmpQBuf+total_size, (cpSize)nParam); total_size += nParam;
+    CopyBlock(pMsg, tmpQBuf+total_size, msgLen); total_size += (Ipp32u)msgLen;
+
+    // Q = H(I || u32str(q) || u16str(D_MESG) || C || message)
+    Ipp8u Q_CksmQ[CP_LMS_MAX_HASH_BYTESIZE+CP_CKSM_BYTESIZE];
+    ippcpSts = ippsHashMessage_rmf(tmpQBuf, (int)total_size, Q_CksmQ, lmsParams.hash_method);
+    if (ippStsNoErr != ippcpSts) {
+        cpLMSSignNextLeaf(pPrvKey, q, qLimit, &lmsParams, &lmotsParams, pBuffer);
+        return ippcpSts;
+    }
+
+    /* Calculate checksum Cksm(Q) and append it to Q */
+    Ipp32u cksmQ = cpCksm(Q_CksmQ, lmotsParams);
+    toByte(Q_CksmQ+nParam, /*cksmQ byteLen*/2, cksmQ);
+
+    // a[i] = coef(Q || Cksm(Q), i, w), chains go from 0 to a[i]
+    Ipp8u chainStart[CP_SIG_MAX_Y_WORDSIZE];
+    Ipp8u chainEnd[CP_SIG_MAX_Y_WORDSIZE];
+    for(Ipp32u i = 0; i < pParam; i++) {
+        chainStart[i] = 0;
+        chainEnd[i] = (Ipp8u)cpCoef(Q_CksmQ, i, wParam);
+    }
+    {
+        Ipp8u* pY[1] = { pLmotsSig->pY };
+        const Ipp8u* pIq[1] = { tmpQBuf };
+        const Ipp8u* pStart[1] = { chainStart };
+        const Ipp8u* pEnd[1] = { chainEnd };
+        // x_q[i] = H(I || u32str(q) || u16str(i) || u8str(0xff) || SEED)
+        ippcpSts = cpLMOTSPrivateKeys(pY, pIq, pPrvKey->SEED, /*numSets*/1, &lmotsParams);
+        // y[i] = chain of x_q[i] from 0 to a[i]
+        if (ippStsNoErr == ippcpSts) {
+            ippcpSts = cpLMOTSChains(pY, (const Ipp8u* const*)pY, pIq, pStart, pEnd, /*numSets*/1, &lmotsParams);
+        }
+        if (ippStsNoErr != ippcpSts) {
+            cpLMSSignNextLeaf(pPrvKey, q, qLimit, &lmsParams, &lmotsParams, pBuffer);
+            return ippcpSts;
+        }
+    }
+
+    /*     Auth path from the traversal cache     */
+    /* ------------------------------------------ */
+    CopyBlock(CP_LMS_AUTH_PATH(pPrvKey), pSign->_pAuthPath, (cpSize)(hParam * mParam));
+
+    /*   Prepare the cache for the next leaf   */
+    /* --------------------------------------- */
+    return cpLMSSignNextLeaf(pPrvKey, q, qLimit, &lmsParams, &lmotsParams, pBuffer);
+}
@@ -0,0 +1,331 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "lms_internal/lms.h"
+
+/*
+ * Computes numLeaves leaves of the LMS tree (Algorithms 1 and 4a LMS spec.):
+ *    K = H(I || u32str(q) || u16str(D_PBLC) || y[0] || ... || y[p-1]),
+ *        y[i] is the end of the i-th chain of the LMOTS private key x_q[i]
+ *    pLeaf = H(I || u32str(2^h + q) || u16str(D_LEAF) || K)
+ *
+ * The leaves are computed by groups of CP_LMS_MB_MAX_SIGNS: private keys, chains,
+ * public keys and leaves of the group are hashed by the multi-buffer hash engine.
+ *
+ * Returns:                Reason:
+ *    ippStsNoErr             no errors
+ *    error code of the hash engine
+ *
+ * Input parameters:
+ *    q             numLeaves indices of the leaves
+ *    numLeaves     number of leaves
+ *    pI            16-byte I of the LMS private key
+ *    pSeed         n-byte SEED of the LMS private key
+ *    lmsParams     LMS parameters (h, m, hash_method)
+ *    lmotsParams   LMOTS parameters (w, p, ls, n, hash_method)
+ *    pBuffer       temporary buffer of cpLMSLeavesBufferSize() size
+ *
+ * Output parameters:
+ *    pLeaf         numLeaves m-byte values of the leaves
+ */
+IPP_OWN_DEFN(IppStatus, cpLMSLeaves, (Ipp8u* const pLeaf[], const Ipp32u q[], Ipp32s numLeaves,
+            const Ipp8u* pI, const Ipp8u* pSeed, const cpLMSParams* lmsParams,
+            const cpLMOTSParams* lmotsParams, Ipp8u* pBuffer)) {
+    IppStatus ippcpSts = ippStsNoErr;
+    Ipp32u nParam = lmotsParams->n;
+    Ipp32u pParam = lmotsParams->p;
+    Ipp32u mParam = lmsParams->m;
+    //                 I          ||  q  ||  D_PBLC
+    Ipp32u prefixLen = CP_PK_I_BYTESIZE + 4 +    2;
+    Ipp32u lenBufZ = prefixLen + pParam * nParam;
+
+    // chains of the private keys go from 0 to 2^w - 1
+    Ipp8u chainStart[CP_SIG_MAX_Y_WORDSIZE];
+    Ipp8u chainEnd[CP_SIG_MAX_Y_WORDSIZE];
+    for (Ipp32u i = 0; i < pParam; i++) {
+        chainStart[i] = 0;
+        chainEnd[i] = (Ipp8u)((1 << lmotsParams->w) - 1);
+    }
+
+    Ipp8u leafMsg[CP_LMS_MB_MAX_SIGNS][CP_PK_I_BYTESIZE + 4 + 2 + CP_LMS_MAX_HASH_BYTESIZE];
+    Ipp8u md[CP_LMS_MB_MAX_SIGNS][IPP_SHA256_DIGEST_BITSIZE/8];
+    Ipp8u* pZ[CP_LMS_MB_MAX_SIGNS];
+    Ipp8u* pY[CP_LMS_MB_MAX_SIGNS];
+    const Ipp8u* pIq[CP_LMS_MB_MAX_SIGNS];
+    const Ipp8u* pStart[CP_LMS_MB_MAX_SIGNS];
+    const Ipp8u* pEnd[CP_LMS_MB_MAX_SIGNS];
+    const Ipp8u* pMsgs[CP_LMS_MB_MAX_SIGNS];
+    Ipp8u* pMDs[CP_LMS_MB_MAX_SIGNS];
+    int lens[CP_LMS_MB_MAX_SIGNS];
+
+    for (int k = 0; k < CP_LMS_MB_MAX_SIGNS; k++) {
+        pZ[k] = pBuffer + k * lenBufZ;
+        pY[k] = pZ[k] + prefixLen;
+        pIq[k] = pZ[k];
+        pStart[k] = chainStart;
+        pEnd[k] = chainEnd;
+        pMDs[k] = md[k];
+    }
+
+    for (Ipp32s k0 = 0; k0 < numLeaves; k0 += CP_LMS_MB_MAX_SIGNS) {
+        int nLanes = IPP_MIN(numLeaves - k0, CP_LMS_MB_MAX_SIGNS);
+
+        // I || u32str(q) || u16str(D_PBLC)
+        for (int k = 0; k < nLanes; k++) {
+            CopyBlock(pI, pZ[k], CP_PK_I_BYTESIZE);
+            toByte(pZ[k] + CP_PK_I_BYTESIZE, /*q byteLen*/4, q[k0 + k]);
+            toByte(pZ[k] + CP_PK_I_BYTESIZE + /*q byteLen*/4, /*D_PBLC byteLen*/2, D_PBLC);
+        }
+
+        // x_q[i] = H(I || u32str(q) || u16str(i) || u8str(0xff) || SEED)
+        ippcpSts = cpLMOTSPrivateKeys(pY, pIq, pSeed, nLanes, lmotsParams);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // y[i] = chain of x_q[i] from 0 to 2^w - 1 (in place)
+        ippcpSts = cpLMOTSChains(pY, (const Ipp8u* const*)pY, pIq, pStart, pEnd, nLanes, lmotsParams);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // K = H(I || u32str(q) || u16str(D_PBLC) || y[0] || ... || y[p-1])
+        for (int k = 0; k < nLanes; k++) {
+            pMsgs[k] = pZ[k];
+            lens[k] = (int)lenBufZ;
+        }
+        ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, lmsParams->hash_method);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // leaf = H(I || u32str(2^h + q) || u16str(D_LEAF) || K)
+        for (int k = 0; k < nLanes; k++) {
+            CopyBlock(pI, leafMsg[k], CP_PK_I_BYTESIZE);
+            toByte(leafMsg[k] + CP_PK_I_BYTESIZE, /*node_num byteLen*/4, (1u << lmsParams->h) + q[k0 + k]);
+            toByte(leafMsg[k] + CP_PK_I_BYTESIZE + /*node_num byteLen*/4, /*D_LEAF byteLen*/2, D_LEAF);
+            CopyBlock(md[k], leafMsg[k] + CP_PK_I_BYTESIZE + 4 + 2, (cpSize)mParam);
+            pMsgs[k] = leafMsg[k];
+            lens[k] = (int)(CP_PK_I_BYTESIZE + 4 + 2 + mParam);
+        }
+        ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, lmsParams->hash_method);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        for (int k = 0; k < nLanes; k++) {
+            CopyBlock(md[k], pLeaf[k0 + k], (cpSize)mParam);
+        }
+    }
+
+    return ippcpSts;
+}
+
+/*
+ * Computes the inner node of the LMS tree (Algorithm 1 LMS spec.):
+ *    pNode = H(I || u32str(r) || u16str(D_INTR) || pLeft || pRight)
+ *
+ * Returns:                Reason:
+ *    ippStsNoErr             no errors
+ *    error code of the hash function
+ *
+ * Input parameters:
+ *    r             node number
+ *    pLeft         m-byte left child
+ *    pRight        m-byte right child
+ *    pI            16-byte I of the LMS private key
+ *    lmsParams     LMS parameters (h, m, hash_method)
+ *
+ * Output parameters:
+ *    pNode         m-byte node value (pNode == pLeft or pNode == pRight is allowed)
+ */
+IPP_OWN_DEFN(IppStatus, cpLMSInnerNode, (Ipp8u* pNode, Ipp32u r, const Ipp8u* pLeft, const Ipp8u* pRight,
+            const Ipp8u* pI, const cpLMSParams* lmsParams)) {
+    Ipp32u mParam = lmsParams->m;
+    Ipp8u msg[CP_PK_I_BYTESIZE + 4 + 2 + 2 * CP_LMS_MAX_HASH_BYTESIZE];
+    Ipp8u md[IPP_SHA256_DIGEST_BITSIZE/8];
+
+    CopyBlock(pI, msg, CP_PK_I_BYTESIZE);
+    toByte(msg + CP_PK_I_BYTESIZE, /*node_num byteLen*/4, r);
+    toByte(msg + CP_PK_I_BYTESIZE + /*node_num byteLen*/4, /*D_INTR byteLen*/2, D_INTR);
+    CopyBlock(pLeft, msg + CP_PK_I_BYTESIZE + 4 + 2, (cpSize)mParam);
+    CopyBlock(pRight, msg + CP_PK_I_BYTESIZE + 4 + 2 + mParam, (cpSize)mParam);
+
+    IppStatus ippcpSts = ippsHashMessage_rmf(msg, (int)(CP_PK_I_BYTESIZE + 4 + 2 + 2 * mParam), md,
+                                             lmsParams->hash_method);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    CopyBlock(md, pNode, (cpSize)mParam);
+
+    return ippcpSts;
+}
+
+/*
+ * Pushes the next leaf of the treehash instance of height hgt onto its stack and merges
+ * the nodes of equal heights. The completed node of height hgt is stored as the treehash node.
+ */
+static IppStatus cpLMSTreeHashPush(IppsLMSPrivateKeyState* pState, Ipp32u hgt, const Ipp8u* pLeaf,
+                                   const cpLMSParams* lmsParams) {
+    IppStatus ippcpSts = ippStsNoErr;
+    Ipp32u h = lmsParams->h;
+    Ipp32u m = lmsParams->m;
+    cpLMSTreeHash* pTreeHash = pState->treeHash + hgt;
+    Ipp8u* pStack = CP_LMS_TREEHASH_STACK(pState, h, m) + hgt * h * m;
+
+    Ipp8u node[CP_LMS_MAX_HASH_BYTESIZE];
+    Ipp32u nodeHeight = 0;
+    Ipp32u nodeIdx = pTreeHash->nextLeaf;
+    CopyBlock(pLeaf, node, (cpSize)m);
+
+    // the left sibling of the node is on the top of the stack
+    while (pTreeHash->stackSize > 0 && pTreeHash->stackHeight[pTreeHash->stackSize - 1] == nodeHeight) {
+        pTreeHash->stackSize--;
+        nodeIdx >>= 1;
+        nodeHeight++;
+        ippcpSts = cpLMSInnerNode(node, (1u << (h - nodeHeight)) + nodeIdx,
+                                  pStack + pTreeHash->stackSize * m, node, pState->I, lmsParams);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    }
+
+    if (nodeHeight == hgt) {
+        CopyBlock(node, CP_LMS_TREEHASH_NODE(pState, h, m) + hgt * m, (cpSize)m);
+    }
+    else {
+        CopyBlock(node, pStack + pTreeHash->stackSize * m, (cpSize)m);
+        pTreeHash->stackHeight[pTreeHash->stackSize++] = (Ipp8u)nodeHeight;
+    }
+    pTreeHash->nextLeaf++;
+
+    return ippcpSts;
+}
+
+/*
+ * Updates the Merkle tree traversal cache of the private key when pState->q is advanced to the next leaf.
+ *
+ * The cache keeps the auth path of the leaf q and a treehash instance for every height i of the tree
+ * (M. Szydlo, "Merkle Tree Traversal in Log Space and Time"). The node of height i of the auth path
+ * changes every 2^i signatures; the instance computes its next value one leaf per signature, so
+ * each signature costs at most h leaves (computed together by the multi-buffer hash) instead of
+ * rebuilding the tree.
+ *
+ * Returns:                Reason:
+ *    ippStsNoErr             no errors
+ *    error code of the hash engine
+ *
+ * Input parameters:
+ *    pState        private key state with the advanced q, 0 < q < 2^h
+ *    lmsParams     LMS parameters (h, m, hash_method)
+ *    lmotsParams   LMOTS parameters (w, p, ls, n, hash_method)
+ *    pBuffer       temporary buffer of cpLMSLeavesBufferSize() size
+ *
+ * Output parameters:
+ *    pState        updated traversal cache
+ */
+IPP_OWN_DEFN(IppStatus, cpLMSTraversalUpdate, (IppsLMSPrivateKeyState* pState, const cpLMSParams* lmsParams,
+            const cpLMOTSParams* lmotsParams, Ipp8u* pBuffer)) {
+    IppStatus ippcpSts = ippStsNoErr;
+    Ipp32u h = lmsParams->h;
+    Ipp32u m = lmsParams->m;
+    Ipp32u q = pState->q;
+    Ipp8u* pAuth = CP_LMS_AUTH_PATH(pState);
+    Ipp8u* pNodes = CP_LMS_TREEHASH_NODE(pState, h, m);
+
+    Ipp8u leaf[CP_LMS_MAX_TREE_HEIGHT][CP_LMS_MAX_HASH_BYTESIZE];
+    Ipp8u* pLeaf[CP_LMS_MAX_TREE_HEIGHT];
+    Ipp32u leafIdx[CP_LMS_MAX_TREE_HEIGHT];
+    Ipp32u leafHgt[CP_LMS_MAX_TREE_HEIGHT];
+    for (Ipp32u i = 0; i < CP_LMS_MAX_TREE_HEIGHT; i++) {
+        pLeaf[i] = leaf[i];
+        leafIdx[i] = 0;
+    }
+
+    // replace the auth path nodes changed at the leaf q and restart their treehash instances
+    for (Ipp32u i = 0; i < h && 0 == (q & ((1u << i) - 1)); i++) {
+        cpLMSTreeHash* pTreeHash = pState->treeHash + i;
+
+        // the node is ready by construction, complete it anyway if the cache was not updated
+        while (pTreeHash->nextLeaf < pTreeHash->endLeaf) {
+            leafIdx[0] = pTreeHash->nextLeaf;
+            ippcpSts = cpLMSLeaves(pLeaf, leafIdx, 1, pState->I, pState->SEED, lmsParams, lmotsParams, pBuffer);
+            IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+            ippcpSts = cpLMSTreeHashPush(pState, i, leaf[0], lmsParams);
+            IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        }
+        CopyBlock(pNodes + i * m, pAuth + i * m, (cpSize)m);
+
+        // the next node of height i is the sibling of the ancestor of the leaf q + 2^i
+        Ipp32u nodeIdx = ((q >> i) + 1) ^ 1;
+        pTreeHash->stackSize = 0;
+        if (nodeIdx < (1u << (h - i))) {
+            pTreeHash->nextLeaf = nodeIdx << i;
+            pTreeHash->endLeaf = (nodeIdx + 1) << i;
+        }
+        else {
+            pTreeHash->nextLeaf = 0;
+            pTreeHash->endLeaf = 0;
+        }
+    }
+
+    // one leaf of every unfinished treehash instance
+    Ipp32s numLeaves = 0;
+    for (Ipp32u i = 0; i < h; i++) {
+        if (pState->treeHash[i].nextLeaf < pState->treeHash[i].endLeaf) {
+            leafIdx[numLeaves] = pState->treeHash[i].nextLeaf;
+            leafHgt[numLeaves++] = i;
+        }
+    }
+    ippcpSts = cpLMSLeaves(pLeaf, leafIdx, numLeaves, pState->I, pState->SEED, lmsParams, lmotsParams, pBuffer);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+    for (Ipp32s k = 0; k < numLeaves; k++) {
+        ippcpSts = cpLMSTreeHashPush(pState, leafHgt[k], leaf[k], lmsParams);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    }
+
+    return ippcpSts;
+}
+
+/*
+ * Checks the treehash instances of the private key state restored from the external buffer:
+ * the instance of height i computes a node of 2^i leaves [nextLeaf, endLeaf) of the tree and keeps
+ * at most i nodes of strictly decreasing heights below i on its stack (see cpLMSTreeHashPush).
+ *
+ * Returns:
+ *    1 if the instances are consistent with the tree of height h, 0 otherwise
+ *
+ * Input parameters:
+ *    pState        private key state
+ *    lmsParams     LMS parameters (h, m, hash_method)
+ */
+IPP_OWN_DEFN(int, cpLMSTraversalIsValid, (const IppsLMSPrivateKeyState* pState, const cpLMSParams* lmsParams)) {
+    Ipp32u h = lmsParams->h;
+
+    for (Ipp32u i = 0; i < h; i++) {
+        const cpLMSTreeHash* pTreeHash = pState->treeHash + i;
+
+        if (pTreeHash->endLeaf > (1u << h) || pTreeHash->nextLeaf > pTreeHash->endLeaf) {
+            return 0;
+        }
+        if (pTreeHash->endLeaf - pTreeHash->nextLeaf > (1u << i)) {
+            return 0;
+        }
+        if (pTreeHash->stackSize > i) {
+            return 0;
+        }
+        for (Ipp32u k = 0; k < pTreeHash->stackSize; k++) {
+            if (pTreeHash->stackHeight[k] >= i) {
+                return 0;
+            }
+            if (k > 0 && pTreeHash->stackHeight[k] >= pTreeHash->stackHeight[k - 1]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
@@ -117,31 +117,25 @@ IPPFUN(IppStatus, ippsLMSVerify, (const Ipp8u* pMsg, const Ipp32s msgLen,
     Ipp8u z[CP_SIG_MAX_Y_WORDSIZE+1][CP_LMS_MAX_HASH_BYTESIZE];
     Ipp8u* pZ = z[0];
 
+    // a[i] = coef(Q || Cksm(Q), i, w), chains end at 2^w - 1
+    Ipp8u chainStart[CP_SIG_MAX_Y_WORDSIZE];
+    Ipp8u chainEnd[CP_SIG_MAX_Y_WORDSIZE];
     for(Ipp32u i = 0; i < pParam; i++) {
-        // a = coef(Q || Cksm(Q), i, w)
-        Ipp32u a = cpCoef(Q_CksmQ, i, wParam);
-        //tmp = y[i]
-        Ipp8u tmp[CP_LMS_MAX_HASH_BYTESIZE];
-        CopyBlock(lmotsSig.pY + i*nParam, tmp, (cpSize)nParam);
-
-        // I || u32str(q)
-        Ipp8u* tmpBuff = pBuffer;
-        // I || u32str(q) || u16str(i)
-        toByte(tmpBuff+CP_PK_I_BYTESIZE+/*q byteLen*/4,/*i byteLen*/2,i);
-        for(Ipp32u j = a; j < (Ipp32u)((1 << wParam) - 1); j++) {
-            // I || u32str(q) || u16str(i) || u8str(j)
-            toByte(tmpBuff+CP_PK_I_BYTESIZE+/*q byteLen*/4+/*i byteLen*/2,/*j byteLen*/1,j);
-            // I || u32str(q) || u16str(i) || u8str(j) || tmp
-            CopyBlock(tmp, tmpBuff+CP_PK_I_BYTESIZE+/*q byteLen*/4+/*i byteLen*/2+/*j byteLen*/1, (cpSize)nParam);
-            // tmp = H(I || u32str(q) || u16str(i) || u8str(j) || tmp)
-            ippcpSts = ippsHashMessage_rmf(tmpBuff,
-                                           (int)(CP_PK_I_BYTESIZE+/*q byteLen*/4+/*i byteLen*/2+/*j byteLen*/1+nParam),
-                                           tmp,
-                                           lmsParams.hash_method);
-            IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
-        }
-        CopyBlock(tmp, pZ+(i+1)*nParam, (cpSize)nParam);
+        chainStart[i] = (Ipp8u)cpCoef(Q_CksmQ, i, wParam);
+        chainEnd[i] = (Ipp8u)((1 << wParam) - 1);
+    }
+    // z[i+1] = chain of y[i] from a[i], the chains are hashed in parallel
+    // tmp = H(I || u32str(q) || u16str(i) || u8str(j) || tmp)
+    {
+        Ipp8u* pOut[1] = { pZ+nParam };
+        const Ipp8u* pIn[1] = { lmotsSig.pY };
+        const Ipp8u* pIq[1] = { tmpQBuf };
+        const Ipp8u* pStart[1] = { chainStart };
+        const Ipp8u* pEnd[1] = { chainEnd };
+        ippcpSts = cpLMOTSChains(pOut, pIn, pIq, pStart, pEnd, /*numSets*/1, &lmotsParams);
     }
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
     //                                              I           u32str(q)   u16str(D_PBLC)
     Ipp32s zStartOffset = (Ipp32s)(nParam - (CP_PK_I_BYTESIZE +     4     +      2        ));
     //                                            I          u16str(D_PBLC)
@@ -0,0 +1,252 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+#include "owndefs.h"
+#include "lms_internal/lms.h"
+#include "pcphash_mb_rmf.h"
+
+/*F*
+//    Name: ippsLMSVerify_MB
+//
+// Purpose: LMS verification of several signatures made with the same public key.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pMsg == NULL
+//                            msgLen == NULL
+//                            pSign == NULL
+//                            pIsSignValid == NULL
+//                            pKey == NULL
+//                            pBuffer == NULL
+//                            pMsg[i] == NULL
+//                            pSign[i] == NULL
+//    ippStsBadArgErr         wrong LMS or LMOTS parameters inside pKey
+//    ippStsContextMatchErr   pSign[i] or pKey contexts are invalid
+//    ippStsSizeErr           numSigns < 1
+//    ippStsLengthErr         msgLen[i] < 1
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pMsg           array of pointers to the messages
+//    msgLen         array of the messages lengths, bytes
+//    pSign          array of pointers to the LMS signature states
+//    pIsSignValid   array of results: pIsSignValid[i] is 1 if i-th signature is valid, 0 - vice versa
+//    numSigns       number of signatures
+//    pKey           pointer to the LMS public key state
+//    pBuffer        pointer to the temporary memory of ippsLMSBufferGetSize_MB() size
+//
+// Note:
+//    signature with LMS or LMOTS type different from pKey types or with incorrect q
+//    is reported as invalid (pIsSignValid[i] = 0).
+//
+*F*/
+
+IPPFUN(IppStatus, ippsLMSVerify_MB, (const Ipp8u* const pMsg[], const Ipp32s msgLen[],
+                                     const IppsLMSSignatureState* const pSign[],
+                                     int pIsSignValid[], Ipp32s numSigns,
+                                     const IppsLMSPublicKeyState* pKey,
+                                     Ipp8u* pBuffer))
+{
+    IppStatus ippcpSts = ippStsNoErr;
+
+    /* Check if any of input pointers are NULL */
+    IPP_BAD_PTR4_RET(pMsg, msgLen, pSign, pIsSignValid)
+    IPP_BAD_PTR2_RET(pKey, pBuffer)
+    IPP_BADARG_RET(numSigns < 1, ippStsSizeErr)
+    IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pKey), ippStsContextMatchErr );
+    for(Ipp32s s = 0; s < numSigns; s++) {
+        IPP_BAD_PTR2_RET(pMsg[s], pSign[s])
+        IPP_BADARG_RET(msgLen[s] < 1, ippStsLengthErr)
+        IPP_BADARG_RET( !CP_LMS_VALID_CTX_ID(pSign[s]), ippStsContextMatchErr );
+        pIsSignValid[s] = 0;
+    }
+
+    /*     Parse public key(Pk) once for all signatures     */
+    /* ---------------------------------------------------- */
+    IppsLMSAlgo lmsTypePk = pKey->lmsOIDAlgo;
+    IppsLMOTSAlgo lmotsTypePk = pKey->lmotsOIDAlgo;
+
+    // Set LMOTS and LMS parameters
+    cpLMOTSParams lmotsParams;
+    cpLMSParams lmsParams;
+    ippcpSts = setLMOTSParams(lmotsTypePk, &lmotsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    ippcpSts = setLMSParams(lmsTypePk, &lmsParams);
+    IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+    Ipp32u nParam = lmotsParams.n;
+    Ipp32u wParam = lmotsParams.w;
+    Ipp32u pParam = lmotsParams.p;
+    Ipp32u hParam = lmsParams.h;
+    Ipp32u mParam = lmsParams.m;
+    const IppsHashMethod* pHashMethod = lmsParams.hash_method;
+
+    /* Buffer layout: MB hash state || CP_LMS_MB_MAX_SIGNS of I || u32str(q) || u16str(D_PBLC) || z[0] || ... || z[p-1] */
+    IppsHashState_MB_rmf* pHashState = (IppsHashState_MB_rmf*)IPP_ALIGNED_PTR(pBuffer, CP_LMS_MB_ALIGNMENT);
+    Ipp8u* pZBuffer = (Ipp8u*)pHashState + sizeof(IppsHashState_MB_rmf);
+    //                       I           u32str(q)   u16str(D_PBLC)
+    Ipp32u zPrefixLen = CP_PK_I_BYTESIZE +    4     +      2;
+    Ipp32u zLen = zPrefixLen + pParam*nParam;
+
+    // signatures are processed by groups of CP_LMS_MB_MAX_SIGNS
+    for(Ipp32s s0 = 0; s0 < numSigns; s0 += CP_LMS_MB_MAX_SIGNS) {
+        const Ipp8u* pMsgs[CP_LMS_MB_MAX_SIGNS];
+        int lens[CP_LMS_MB_MAX_SIGNS];
+        Ipp8u* pMDs[CP_LMS_MB_MAX_SIGNS];
+        Ipp32s sIdx[CP_LMS_MB_MAX_SIGNS];
+        Ipp32u node_num[CP_LMS_MB_MAX_SIGNS];
+        int nLanes = 0;
+
+        // select signatures matched to the public key
+        for(Ipp32s s = s0; s < IPP_MIN(s0 + CP_LMS_MB_MAX_SIGNS, numSigns); s++) {
+            const IppsLMSSignatureState* pSig = pSign[s];
+            if((lmsTypePk == pSig->_lmsOIDAlgo) && (lmotsTypePk == pSig->_lmotsSig._lmotsOIDAlgo) &&
+               (pSig->_q < ((Ipp32u)1 << hParam))) {
+                sIdx[nLanes++] = s;
+            }
+        }
+        if(0 == nLanes) {
+            continue;
+        }
+
+        /* LM-OTS pub key candidates of the group (Algorithms 6a and 4b) */
+        /* ------------------------------------------------------------ */
+        // message hashes, chains and Kc of all lanes go through the multi-buffer hash
+        Ipp8u prefix[CP_LMS_MB_MAX_SIGNS][CP_PK_I_BYTESIZE+4+2+CP_LMS_MAX_HASH_BYTESIZE];
+        Ipp8u Q_CksmQ[CP_LMS_MB_MAX_SIGNS][CP_LMS_MAX_HASH_BYTESIZE+CP_CKSM_BYTESIZE];
+        for(int k = 0; k < nLanes; k++) {
+            const IppsLMSSignatureState* pSig = pSign[sIdx[k]];
+            // I || u32str(q) || u16str(D_MESG) || C
+            CopyBlock(pKey->I, prefix[k], CP_PK_I_BYTESIZE);
+            toByte(prefix[k]+CP_PK_I_BYTESIZE, /*q byteLen*/ 4, pSig->_q);
+            toByte(prefix[k]+CP_PK_I_BYTESIZE+4, /*D_MESG byteLen*/ 2, D_MESG);
+            CopyBlock(pSig->_lmotsSig.pC, prefix[k]+CP_PK_I_BYTESIZE+4+2, (cpSize)nParam);
+            pMsgs[k] = prefix[k];
+            lens[k] = (int)(CP_PK_I_BYTESIZE+4+2+nParam);
+            pMDs[k] = Q_CksmQ[k];
+        }
+
+        // Q = H(I || u32str(q) || u16str(D_MESG) || C || message)
+        ippcpSts = ippsHashInit_MB_rmf(pHashState, pHashMethod, nLanes);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        ippcpSts = ippsHashUpdate_MB_rmf(pMsgs, lens, pHashState);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        for(int k = 0; k < nLanes; k++) {
+            pMsgs[k] = pMsg[sIdx[k]];
+            lens[k] = msgLen[sIdx[k]];
+        }
+        ippcpSts = ippsHashUpdate_MB_rmf(pMsgs, lens, pHashState);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        ippcpSts = ippsHashFinal_MB_rmf(pMDs, pHashState);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // chains of all signatures of the group
+        Ipp8u chainStart[CP_LMS_MB_MAX_SIGNS][CP_SIG_MAX_Y_WORDSIZE];
+        Ipp8u chainEnd[CP_SIG_MAX_Y_WORDSIZE];
+        Ipp8u* pOut[CP_LMS_MB_MAX_SIGNS];
+        const Ipp8u* pIn[CP_LMS_MB_MAX_SIGNS];
+        const Ipp8u* pIq[CP_LMS_MB_MAX_SIGNS];
+        const Ipp8u* pStart[CP_LMS_MB_MAX_SIGNS];
+        const Ipp8u* pEnd[CP_LMS_MB_MAX_SIGNS];
+        for(Ipp32u i = 0; i < pParam; i++) {
+            chainEnd[i] = (Ipp8u)((1 << wParam) - 1);
+        }
+        for(int k = 0; k < nLanes; k++) {
+            const IppsLMSSignatureState* pSig = pSign[sIdx[k]];
+            Ipp8u* pZ = pZBuffer + k*zLen;
+
+            /* Calculate checksum Cksm(Q) and append it to Q */
+            Ipp32u cksmQ = cpCksm(Q_CksmQ[k], lmotsParams);
+            toByte(Q_CksmQ[k]+nParam, /*cksmQ byteLen*/2, cksmQ);
+            // a[i] = coef(Q || Cksm(Q), i, w)
+            for(Ipp32u i = 0; i < pParam; i++) {
+                chainStart[k][i] = (Ipp8u)cpCoef(Q_CksmQ[k], i, wParam);
+            }
+
+            // I || u32str(q) || u16str(D_PBLC)
+            CopyBlock(prefix[k], pZ, CP_PK_I_BYTESIZE + /*q byteLen*/4);
+            toByte(pZ + CP_PK_I_BYTESIZE + 4, /*D_PBLC byteLen*/2, D_PBLC);
+
+            pOut[k] = pZ + zPrefixLen;
+            pIn[k] = pSig->_lmotsSig.pY;
+            pIq[k] = pZ;
+            pStart[k] = chainStart[k];
+            pEnd[k] = chainEnd;
+        }
+        // z[i] = chain of y[i] from a[i]
+        ippcpSts = cpLMOTSChains(pOut, pIn, pIq, pStart, pEnd, nLanes, &lmotsParams);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // Kc = H(I || u32str(q) || u16str(D_PBLC) || z[0] || z[1] || ... || z[p-1])
+        Ipp8u Kc[CP_LMS_MB_MAX_SIGNS][CP_LMS_MAX_HASH_BYTESIZE];
+        for(int k = 0; k < nLanes; k++) {
+            pMsgs[k] = pZBuffer + k*zLen;
+            lens[k] = (int)zLen;
+            pMDs[k] = Kc[k];
+        }
+        ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, pHashMethod);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        /*  Candidate LMS roots Tc of the group, level by level  */
+        /* ----------------------------------------------------- */
+        // node messages of all lanes are built in node[], one multi-buffer hash call per tree level updates tmp[]
+        Ipp8u tmp[CP_LMS_MB_MAX_SIGNS][CP_LMS_MAX_HASH_BYTESIZE];
+        Ipp8u node[CP_LMS_MB_MAX_SIGNS][CP_PK_I_BYTESIZE+4+2+2*CP_LMS_MAX_HASH_BYTESIZE];
+        for(int k = 0; k < nLanes; k++) {
+            node_num[k] = ((Ipp32u)1 << hParam) + pSign[sIdx[k]]->_q;
+            // I || u32str(node_num) || u16str(D_LEAF) || Kc
+            CopyBlock(pKey->I, node[k], CP_PK_I_BYTESIZE);
+            toByte(node[k]+CP_PK_I_BYTESIZE, /*node_num byteLen*/4, node_num[k]);
+            toByte(node[k]+CP_PK_I_BYTESIZE+4, /*D_LEAF byteLen*/2, D_LEAF);
+            CopyBlock(Kc[k], node[k]+CP_PK_I_BYTESIZE+4+2, (cpSize)mParam);
+            pMsgs[k] = node[k];
+            lens[k] = (int)(CP_PK_I_BYTESIZE+4+2+mParam);
+            pMDs[k] = tmp[k];
+        }
+        ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, pHashMethod);
+        IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+
+        // all signatures have the same path length h
+        for(Ipp32u i = 0; i < hParam; i++) {
+            for(int k = 0; k < nLanes; k++) {
+                const Ipp8u* pAuthPath = pSign[sIdx[k]]->_pAuthPath;
+                // I || u32str(node_num/2) || u16str(D_INTR)
+                toByte(node[k]+CP_PK_I_BYTESIZE, /*node_num byteLen*/4, node_num[k]/2);
+                toByte(node[k]+CP_PK_I_BYTESIZE+4, /*D_INTR byteLen*/2, D_INTR);
+                if((node_num[k] & 1) == 1) {
+                    // I || u32str(node_num/2) || u16str(D_INTR) || path[i] || tmp
+                    CopyBlock(pAuthPath+i*mParam, node[k]+CP_PK_I_BYTESIZE+4+2, (cpSize)mParam);
+                    CopyBlock(tmp[k], node[k]+CP_PK_I_BYTESIZE+4+2+mParam, (cpSize)mParam);
+                }
+                else {
+                    // I || u32str(node_num/2) || u16str(D_INTR) || tmp || path[i]
+                    CopyBlock(tmp[k], node[k]+CP_PK_I_BYTESIZE+4+2, (cpSize)mParam);
+                    CopyBlock(pAuthPath+i*mParam, node[k]+CP_PK_I_BYTESIZE+4+2+mParam, (cpSize)mParam);
+                }
+                lens[k] = (int)(CP_PK_I_BYTESIZE+4+2+2*mParam);
+                node_num[k] >>= 1;
+            }
+            ippcpSts = ippsHashMessage_MB_rmf(pMsgs, lens, pMDs, nLanes, lmotsParams.hash_method);
+            IPP_BADARG_RET((ippStsNoErr != ippcpSts), ippcpSts)
+        }
+
+        /*  Compare each lane's root with the public key  */
+        /* ---------------------------------------------- */
+        for(int k = 0; k < nLanes; k++) {
+            BNU_CHUNK_T is_equal = cpIsEquBlock_ct(pKey->T1, tmp[k], (int)mParam);
+            pIsSignValid[sIdx[k]] = is_equal ? 1 : 0;
+        }
+    }
+
+    return ippcpSts;
+}
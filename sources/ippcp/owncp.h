@@ -176,6 +176,25 @@ __IPPCP_INLINE Ipp32u IsFeatureEnabled(Ipp64u niMmask)
 #define IPPCP_OMP_NUM_THREADS() num_threads( IPPCP_GET_NUM_THREADS() )
 #define IPPCP_OMP_LIMIT_MAX_NUM_THREADS(n)  num_threads( IPP_MIN(IPPCP_GET_NUM_THREADS(),(n)))
 
+/*
+// Minimal amount of data (bytes) processed by single thread in bulk operations.
+// Shorter buffers are processed single-threaded to avoid threading overhead.
+*/
+#define IPPCP_OMP_MIN_CHUNK_SIZE  (64*1024)
+
+/* number of threads to process len bytes of data */
+__IPPCP_INLINE int cpNumThreadsForLen(Ipp64s len)
+{
+#if defined(_OPENMP)
+   Ipp64s nThreads = len / IPPCP_OMP_MIN_CHUNK_SIZE;
+   nThreads = IPP_MIN(nThreads, (Ipp64s)IPPCP_GET_NUM_THREADS());
+   return (nThreads>1)? (int)nThreads : 1;
+#else
+   IPP_UNREFERENCED_PARAMETER(len);
+   return 1;
+#endif
+}
+
 /* copy under mask */
 #define MASKED_COPY_BNU(dst, mask, src1, src2, len) { \
    cpSize i; \
@@ -26,31 +26,27 @@
 
 #if (_IPP==_IPP_H9) || (_IPP32E==_IPP32E_L9)
 
-IPP_OWN_DEFN (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pState))
+IPP_OWN_DEFN (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 {
    // dispatching to older code path in case of short plain text
    if (len < 256) {
-      IppsAESSpec* pAES = AESGCM_CIPHER(pState);
       RijnCipher encoder = RIJ_ENCODER(pAES);
       Ipp8u hkeys_old_order[48];
 
       // put the hash keys in the correct order (hKey*t, (hKey*t)^2, (hKey*t)^4)
       for (int i = 0; i < 32; i++) {
-         *(hkeys_old_order+i) = *(AESGCM_HKEY(pState)+i); // HKEY 0-32
+         *(hkeys_old_order+i) = *(pHKey+i); // HKEY 0-32
          if (i < 16)
-            *(hkeys_old_order+i+32) = *(AESGCM_HKEY(pState)+i+48); // HKEY 32-48
+            *(hkeys_old_order+i+32) = *(pHKey+i+48); // HKEY 32-48
       }
 
-      AesGcmEnc_avx(pDst, pSrc, len, encoder, RIJ_NR(pAES), RIJ_EKEYS(pAES), AESGCM_GHASH(pState),
-         AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState), hkeys_old_order);
+      AesGcmEnc_avx(pDst, pSrc, len, encoder, RIJ_NR(pAES), RIJ_EKEYS(pAES), pGhash,
+         pCounter, pECounter, hkeys_old_order);
 
       // zeroizing 
       zeroize_256((Ipp32u*)hkeys_old_order, 12);
    }
    else {
-      IppsRijndael128Spec* pAES = AESGCM_CIPHER(pState);
-      Ipp8u* pCounter = AESGCM_COUNTER(pState);
-      Ipp8u* pECounter = AESGCM_ECOUNTER(pState);
       __m256i pCounter256, pCounter256_1, pCounter256_2, pCounter256_3, pCounter256_4, pCounter256_5, pCounter256_6, pCounter256_7;
       __m256i block, block1, block2, block3, block4, block5, block6, block7;
       __m256i cipherText, cipherText_1, cipherText_2, cipherText_3, cipherText_4, cipherText_5, cipherText_6, cipherText_7;
@@ -94,12 +90,12 @@ IPP_OWN_DEFN (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int le
       pCounter256_6 = pCounter256_7;
       IncrementRegister256(pCounter256_7, increment2, shuffle_mask);
       
-      lo = _mm_loadu_si128((__m128i*)AESGCM_GHASH(pState));
+      lo = _mm_loadu_si128((__m128i*)pGhash);
       hi = _mm_setzero_si128();
       rpHash[0] = _mm256_setr_m128i(_mm_shuffle_epi8(lo, shuff_mask_128), hi);
 
       // setting hash keys
-      Ipp8u *pkeys = AESGCM_HKEY(pState);
+      const Ipp8u *pkeys = pHKey;
       for (int i = 0; i < 8; i++) {
          HashKey[i] = _mm256_setr_m128i(_mm_loadu_si128((void*)(pkeys+16)), _mm_loadu_si128((void*)pkeys));
          pkeys += 32;
@@ -535,7 +531,7 @@ IPP_OWN_DEFN (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int le
          _mm_storeu_si128((void*)pDst, _mm256_castsi256_si128(cipherText));
          pDst += BLOCK_SIZE;
          // hash calculation stage
-         HashKey[0] = _mm256_setr_m128i(_mm_loadu_si128((void*)(AESGCM_HKEY(pState))), _mm_loadu_si128((void*)(AESGCM_HKEY(pState))));
+         HashKey[0] = _mm256_setr_m128i(_mm_loadu_si128((void*)(pHKey)), _mm_loadu_si128((void*)(pHKey)));
          rpHash[0] = _mm256_xor_si256(rpHash[0], _mm256_shuffle_epi8(cipherText, shuff_mask_256));
          resultHash = avx2_clmul_gcm(rpHash, HashKey);
          len -= BLOCK_SIZE;
@@ -566,7 +562,7 @@ IPP_OWN_DEFN (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int le
       _mm_storeu_si128((void*)pECounter, _mm256_castsi256_si128(block));
       _mm_storeu_si128((void*)pCounter, _mm256_castsi256_si128(pCounter256));
       resultHash = _mm_shuffle_epi8(resultHash, shuff_mask_128);
-      _mm_storeu_si128((void*)(AESGCM_GHASH(pState)), resultHash);
+      _mm_storeu_si128((void*)(pGhash), resultHash);
 
       // HKeys zeroizing
       for (int i = 0; i < 8; i++)
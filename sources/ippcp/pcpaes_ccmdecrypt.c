@@ -31,46 +31,16 @@
 #  include "pcprijtables.h"
 #endif
 
-/*F*
-//    Name: ippsAES_CCMDecrypt
-//
-// Purpose: Decrypts data and updates authentication tag.
-//
-// Returns:                Reason:
-//    ippStsNullPtrErr        pState == NULL
-//                            pSrc == NULL
-//                            pDst == NULL
-//    ippStsContextMatchErr   !VALID_AESCCM_ID()
-//    ippStsLengthErr         if exceed overall length of message is being processed
-//    ippStsNoErr             no errors
-//
-// Parameters:
-//    pSrc        pointer to the cipher text buffer
-//    pDst        pointer to the plane text buffer
-//    len         length of the buffer
-//    pState      pointer to the CCM context
-//
-*F*/
-IPPFUN(IppStatus, ippsAES_CCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState))
+/*
+// Decrypts payload and updates MAC.
+*/
+IPP_OWN_DEFN(void, cpAES_CCMDecrypt, (const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState, const IppsAESSpec* pAES))
 {
-   /* test pState pointer */
-   IPP_BAD_PTR1_RET(pState);
-
-   /* test state ID */
-   IPP_BADARG_RET(!VALID_AESCCM_ID(pState), ippStsContextMatchErr);
-
-   /* test source/destination data */
-   IPP_BAD_PTR2_RET(pSrc, pDst);
-
-   /* test message length */
-   IPP_BADARG_RET(len<0 || AESCCM_LENPRO(pState)+(Ipp64u)len >AESCCM_MSGLEN(pState), ippStsLengthErr);
-
    /*
    // enctypt payload and update MAC
    */
    if(len) {
       /* setup encoder method */
-      IppsAESSpec* pAES = AESCCM_CIPHER(pState);
       RijnCipher encoder = RIJ_ENCODER(pAES);
 
       Ipp32u flag = (Ipp32u)( AESCCM_LENPRO(pState) &(MBS_RIJ128-1) );
@@ -208,6 +178,42 @@ IPPFUN(IppStatus, ippsAES_CCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, I
       /* clear secret data */
       PurgeBlock(S, sizeof(S));
    }
+}
+
+/*F*
+//    Name: ippsAES_CCMDecrypt
+//
+// Purpose: Decrypts data and updates authentication tag.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pSrc == NULL
+//                            pDst == NULL
+//    ippStsContextMatchErr   !VALID_AESCCM_ID()
+//    ippStsLengthErr         if exceed overall length of message is being processed
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to the cipher text buffer
+//    pDst        pointer to the plane text buffer
+//    len         length of the buffer
+//    pState      pointer to the CCM context
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_CCMDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState))
+{
+   /* test pState pointer */
+   IPP_BAD_PTR1_RET(pState);
+
+   /* test state ID */
+   IPP_BADARG_RET(!VALID_AESCCM_ID(pState), ippStsContextMatchErr);
+
+   /* test source/destination data */
+   IPP_BAD_PTR2_RET(pSrc, pDst);
+
+   /* test message length */
+   IPP_BADARG_RET(len<0 || AESCCM_LENPRO(pState)+(Ipp64u)len >AESCCM_MSGLEN(pState), ippStsLengthErr);
 
+   cpAES_CCMDecrypt(pSrc, pDst, len, pState, AESCCM_CIPHER(pState));
    return ippStsNoErr;
 }
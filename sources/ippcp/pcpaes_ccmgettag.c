@@ -31,6 +31,34 @@
 #  include "pcprijtables.h"
 #endif
 
+/*
+// Computes the authentication tag.
+*/
+IPP_OWN_DEFN(void, cpAES_CCMGetTag, (Ipp8u* pTag, int tagLen, const IppsAES_CCMState* pState, const IppsAESSpec* pAES))
+{
+   Ipp32u flag = (Ipp32u)( AESCCM_LENPRO(pState) &(MBS_RIJ128-1) );
+
+   Ipp32u MAC[NB(128)];
+   CopyBlock16(AESCCM_MAC(pState), MAC);
+
+   if(flag) {
+      RijnCipher encoder = RIJ_ENCODER(pAES);
+
+      Ipp8u  BLK[MBS_RIJ128];
+      FillBlock16(0, NULL,BLK, 0);
+      CopyBlock(AESCCM_BLK(pState), BLK, (cpSize)flag);
+
+      XorBlock16(MAC, BLK, MAC);
+      #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+      encoder((Ipp8u*)MAC, (Ipp8u*)MAC, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+      #else
+      encoder((Ipp8u*)MAC, (Ipp8u*)MAC, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+      #endif
+   }
+
+   XorBlock(MAC, AESCCM_S0(pState), pTag, (cpSize)tagLen);
+}
+
 /*F*
 //    Name: ippsAES_CCMGetTag
 //
@@ -63,29 +91,6 @@ IPPFUN(IppStatus, ippsAES_CCMGetTag,(Ipp8u* pTag, int tagLen, const IppsAES_CCMS
    IPP_BAD_PTR1_RET(pTag);
    IPP_BADARG_RET((Ipp32u)tagLen>AESCCM_TAGLEN(pState) || tagLen<1, ippStsLengthErr);
 
-   {
-      Ipp32u flag = (Ipp32u)( AESCCM_LENPRO(pState) &(MBS_RIJ128-1) );
-
-      Ipp32u MAC[NB(128)];
-      CopyBlock16(AESCCM_MAC(pState), MAC);
-
-      if(flag) {
-         IppsAESSpec* pAES = AESCCM_CIPHER(pState);
-         RijnCipher encoder = RIJ_ENCODER(pAES);
-
-         Ipp8u  BLK[MBS_RIJ128];
-         FillBlock16(0, NULL,BLK, 0);
-         CopyBlock(AESCCM_BLK(pState), BLK, (cpSize)flag);
-
-         XorBlock16(MAC, BLK, MAC);
-         #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
-         encoder((Ipp8u*)MAC, (Ipp8u*)MAC, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
-         #else
-         encoder((Ipp8u*)MAC, (Ipp8u*)MAC, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
-         #endif
-      }
-
-      XorBlock(MAC, AESCCM_S0(pState), pTag, (cpSize)tagLen);
-      return ippStsNoErr;
-   }
+   cpAES_CCMGetTag(pTag, tagLen, pState, AESCCM_CIPHER(pState));
+   return ippStsNoErr;
 }
@@ -0,0 +1,111 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//
+//     Context:
+//        ippsAES_CCMSeal()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesauthccm.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsAES_CCMSeal
+//
+// Purpose: One-shot authenticated encryption of a message in the CCM mode.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pKey == NULL
+//                            pIV == NULL
+//                            pAD == NULL, adLen>0
+//                            pSrc == NULL or pDst == NULL, len>0
+//                            pTag == NULL
+//    ippStsContextMatchErr   !VALID_AESCCM_ID()
+//    ippStsLengthErr         13 < ivLen < 7
+//                            adLen < 0
+//                            len < 0 or len does not fit in (15-ivLen) bytes
+//                            MBS_RIJ128 < tagLen < 4 or tagLen is odd
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pIV      pointer to the IV (nonce)
+//    ivLen    length of the IV (in bytes)
+//    pAD      pointer to the Associated Data (header)
+//    adLen    length of the AD (in bytes)
+//    pSrc     pointer to the plane text buffer
+//    pDst     pointer to the cipher text buffer
+//    len      length of the message (in bytes)
+//    pTag     pointer to the output authentication tag
+//    tagLen   length of the tag (in bytes)
+//    pKey     pointer to the AES-CCM state initialized by ippsAES_CCMInit()
+//
+// Note:
+//    The state is used as an expanded key only and is never modified, so it can be
+//    shared by several threads. The message length and tag length set in the state
+//    are ignored, the message processing state is kept on the stack.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_CCMSeal,(const Ipp8u* pIV, int ivLen,
+                                   const Ipp8u* pAD, int adLen,
+                                   const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                   Ipp8u* pTag, int tagLen,
+                                   const IppsAES_CCMState* pKey))
+{
+   /* test pKey pointer */
+   IPP_BAD_PTR1_RET(pKey);
+   IPP_BADARG_RET(!VALID_AESCCM_ID(pKey), ippStsContextMatchErr);
+
+   /* test IV (or nonce) */
+   IPP_BAD_PTR1_RET(pIV);
+   IPP_BADARG_RET((ivLen<7)||(ivLen>13), ippStsLengthErr);
+
+   /* test AAD pointer if defined */
+   IPP_BADARG_RET(adLen<0, ippStsLengthErr);
+   IPP_BADARG_RET(adLen && !pAD, ippStsNullPtrErr);
+
+   /* test message: its length is encoded in (15-ivLen) bytes */
+   IPP_BADARG_RET(len<0, ippStsLengthErr);
+   IPP_BADARG_RET(len && !(pSrc && pDst), ippStsNullPtrErr);
+   IPP_BADARG_RET(ivLen>11 && (len>>((15-ivLen)*8)), ippStsLengthErr);
+
+   /* test tag */
+   IPP_BAD_PTR1_RET(pTag);
+   IPP_BADARG_RET(tagLen>MBS_RIJ128 || tagLen<4 || tagLen&1, ippStsLengthErr);
+
+   {
+      const IppsAESSpec* pAES = AESCCM_CIPHER(pKey);
+
+      /* message state, the cipher field is not used */
+      IppsAES_CCMState msg;
+      AESCCM_MSGLEN(&msg) = (Ipp64u)len;
+      AESCCM_TAGLEN(&msg) = (Ipp32u)tagLen;
+
+      cpAES_CCMStart(pIV, ivLen, pAD, adLen, &msg, pAES);
+      cpAES_CCMEncrypt(pSrc, pDst, len, &msg, pAES);
+      cpAES_CCMGetTag(pTag, tagLen, &msg, pAES);
+
+      /* clear secret data */
+      PurgeBlock(&msg, (int)((Ipp8u*)AESCCM_CIPHER(&msg) - (Ipp8u*)&msg));
+   }
+
+   return ippStsNoErr;
+}
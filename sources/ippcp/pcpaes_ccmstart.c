@@ -31,51 +31,17 @@
 #  include "pcprijtables.h"
 #endif
 
-/*F*
-//    Name: ippsAES_CCMStart
-//
-// Purpose: Start the process (encryption+generation) or (decryption+verification).
-//
-// Returns:                Reason:
-//    ippStsNullPtrErr        pState == NULL
-//                            pIV == NULL
-//                            pAD == NULL
-//    ippStsContextMatchErr   !VALID_AESCCM_ID()
-//    ippStsLengthErr         13 < ivLen < 7
-//    ippStsNoErr             no errors
-//
-// Parameters:
-//    pIV      pointer to the IV (nonce)
-//    ivLen    length of the IV (in bytes)
-//    pAD      pointer to the Associated Data (header)
-//    adLen    length of the AD (in bytes)
-//    pState   pointer to the AES-CCM state
-//
-*F*/
-IPPFUN(IppStatus, ippsAES_CCMStart,(const Ipp8u* pIV, int ivLen,
-                                    const Ipp8u* pAD, int adLen,
-                                    IppsAES_CCMState* pState))
+/*
+// Starts processing of a new message: computes S0, encodes B0 and AD into the MAC.
+*/
+IPP_OWN_DEFN(void, cpAES_CCMStart, (const Ipp8u* pIV, int ivLen, const Ipp8u* pAD, int adLen, IppsAES_CCMState* pState, const IppsAESSpec* pAES))
 {
-   /* test pState pointer */
-   IPP_BAD_PTR1_RET(pState);
-   IPP_BADARG_RET(!VALID_AESCCM_ID(pState), ippStsContextMatchErr);
-
-   /* test IV (or nonce) */
-   IPP_BAD_PTR1_RET(pIV);
-   IPP_BADARG_RET((ivLen<7)||(ivLen>13), ippStsLengthErr);
-
-   /* test AAD pointer if defined */
-   IPP_BADARG_RET(adLen<0, ippStsLengthErr);
-   if(adLen)
-      IPP_BAD_PTR1_RET(pAD);
-
    /* init for new message */
    AESCCM_LENPRO(pState) = 0;
    AESCCM_COUNTER(pState) = 0;
 
    {
       /* setup encoder method */
-      IppsAESSpec* pAES = AESCCM_CIPHER(pState);
       RijnCipher encoder = RIJ_ENCODER(pAES);
 
       Ipp32u MAC[NB(128)];
@@ -207,7 +173,47 @@ IPPFUN(IppStatus, ippsAES_CCMStart,(const Ipp8u* pIV, int ivLen,
 
       AESCCM_COUNTER(pState) = 0;
       CopyBlock16(MAC, AESCCM_MAC(pState));
-
-      return ippStsNoErr;
    }
 }
+
+/*F*
+//    Name: ippsAES_CCMStart
+//
+// Purpose: Start the process (encryption+generation) or (decryption+verification).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pIV == NULL
+//                            pAD == NULL
+//    ippStsContextMatchErr   !VALID_AESCCM_ID()
+//    ippStsLengthErr         13 < ivLen < 7
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pIV      pointer to the IV (nonce)
+//    ivLen    length of the IV (in bytes)
+//    pAD      pointer to the Associated Data (header)
+//    adLen    length of the AD (in bytes)
+//    pState   pointer to the AES-CCM state
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_CCMStart,(const Ipp8u* pIV, int ivLen,
+                                    const Ipp8u* pAD, int adLen,
+                                    IppsAES_CCMState* pState))
+{
+   /* test pState pointer */
+   IPP_BAD_PTR1_RET(pState);
+   IPP_BADARG_RET(!VALID_AESCCM_ID(pState), ippStsContextMatchErr);
+
+   /* test IV (or nonce) */
+   IPP_BAD_PTR1_RET(pIV);
+   IPP_BADARG_RET((ivLen<7)||(ivLen>13), ippStsLengthErr);
+
+   /* test AAD pointer if defined */
+   IPP_BADARG_RET(adLen<0, ippStsLengthErr);
+   if(adLen)
+      IPP_BAD_PTR1_RET(pAD);
+
+   cpAES_CCMStart(pIV, ivLen, pAD, adLen, pState, AESCCM_CIPHER(pState));
+   return ippStsNoErr;
+}
@@ -0,0 +1,295 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-CMAC Multi Buffer
+//
+//  Contents:
+//        ippsAES_CMAC_MB()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpcmac.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_cmac_stuff.h"
+#include "aes_cmac_vaes_mb.h"
+#include "aes_cmac_aesni_mb.h"
+
+/* Work Load Size from Buffers */
+#define WORKLOAD_LINES_16 (AES_MB_MAX_KERNEL_SIZE)    /* size 16 */
+#define WORKLOAD_LINES_8 (AES_MB_MAX_KERNEL_SIZE / 2) /* size  8 */
+#define WORKLOAD_LINES_4 (AES_MB_MAX_KERNEL_SIZE / 4) /* size  4 */
+
+/*
+// Length of the message part processed before the last (complete or padded) block
+*/
+__IPPCP_INLINE int cmacBulkLen(int len)
+{
+   return len ? ((len-1) & ~(MBS_RIJ128-1)) : 0;
+}
+
+/*
+// Forms the last block of the message M* = M_n ^ K1 or (M_n||10..0) ^ K2
+*/
+static void cmacLastBlock(Ipp8u lastBlk[MBS_RIJ128], const Ipp8u* pSrc, int len, const IppsAES_CMACState* pCtx)
+{
+   int bulkLen = cmacBulkLen(len);
+   int tailLen = len - bulkLen;
+
+   if(MBS_RIJ128==tailLen)
+      XorBlock16(pSrc+bulkLen, CMAC_K1(pCtx), lastBlk);
+   else {
+      PadBlock(0, lastBlk, MBS_RIJ128);
+      CopyBlock(pSrc+bulkLen, lastBlk, tailLen);
+      lastBlk[tailLen] = 0x80;
+      XorBlock16(lastBlk, CMAC_K2(pCtx), lastBlk);
+   }
+}
+
+#if (_IPP32E>=_IPP32E_Y8)
+/*
+// CBC-MAC kernel processing up to 4/8/16 independent buffers
+*/
+typedef void (*cmacMbKernel)(const Ipp8u* const source_pa[], const int len[], const int num_of_rounds, const Ipp32u* enc_keys[], Ipp8u* const mac_pa[]);
+
+/*
+// Computes CMAC of min(numBuffers, workLoadSize) buffers:
+// the whole blocks except the last one are processed by the first kernel call,
+// the last blocks masked by K1/K2 are processed by the second one.
+*/
+static void cmacProcessMb(const Ipp8u* const pSrc[], const int len[], Ipp8u* const pMD[], int mdLen,
+                          const IppsAES_CMACState* const pCtx[],
+                          int numBuffers, int workLoadSize, cmacMbKernel kernel)
+{
+   int i;
+
+   const Ipp8u* loc_src[AES_MB_MAX_KERNEL_SIZE];
+   Ipp8u* loc_mac[AES_MB_MAX_KERNEL_SIZE];
+   Ipp32u const* loc_enc_keys[AES_MB_MAX_KERNEL_SIZE];
+   int loc_len[AES_MB_MAX_KERNEL_SIZE];
+   int numRounds = 0;
+
+   __ALIGN16 Ipp8u mac[AES_MB_MAX_KERNEL_SIZE][MBS_RIJ128];
+   __ALIGN16 Ipp8u lastBlk[AES_MB_MAX_KERNEL_SIZE][MBS_RIJ128];
+
+   /* fill buffers */
+   for (i = 0; i < workLoadSize; i++) {
+      if (i >= numBuffers) {
+         loc_src[i]      = NULL;
+         loc_mac[i]      = NULL;
+         loc_enc_keys[i] = NULL;
+         loc_len[i]      = 0;
+         continue;
+      }
+
+      const IppsAESSpec* pAES = &CMAC_CIPHER(pCtx[i]);
+
+      loc_src[i]      = pSrc[i];
+      loc_mac[i]      = mac[i];
+      loc_enc_keys[i] = (Ipp32u*)RIJ_EKEYS(pAES);
+      loc_len[i]      = cmacBulkLen(len[i]);
+      /* As numRounds is the same for all buffers, get it from the last one */
+      numRounds = RIJ_NR(pAES);
+
+      PadBlock(0, mac[i], MBS_RIJ128);
+      cmacLastBlock(lastBlk[i], pSrc[i], len[i], pCtx[i]);
+   }
+
+   /* M_1 .. M_{n-1} */
+   kernel(loc_src, loc_len, numRounds, loc_enc_keys, loc_mac);
+
+   /* M* */
+   for (i = 0; i < workLoadSize && i < numBuffers; i++) {
+      loc_src[i] = lastBlk[i];
+      loc_len[i] = MBS_RIJ128;
+   }
+   kernel(loc_src, loc_len, numRounds, loc_enc_keys, loc_mac);
+
+   for (i = 0; i < workLoadSize && i < numBuffers; i++)
+      CopyBlock(mac[i], pMD[i], mdLen);
+
+   PurgeBlock(mac, sizeof(mac));
+   PurgeBlock(lastBlk, sizeof(lastBlk));
+}
+#endif
+
+/*!
+ *  \brief ippsAES_CMAC_MB
+ *
+ *  Name:         ippsAES_CMAC_MB
+ *
+ *  Purpose:      AES-CMAC Multi Buffer computation of the message digests
+ *
+ *  Parameters:
+ *    \param[in]   pSrc                 Pointer to the array of input messages
+ *    \param[in]   len                  Pointer to the array of input message lengths (in bytes)
+ *    \param[out]  pMD                  Pointer to the array of output message digests
+ *    \param[in]   mdLen                Length of the message digests (in bytes)
+ *    \param[in]   pCtx                 Pointer to the array of initialized AES-CMAC contexts
+ *    \param[out]  status               Pointer to the IppStatus array that contains status
+ *                                      for each processed buffer
+ *    \param[in]   numBuffers           Number of buffers to be processed
+ *
+ *  Returns:                          Reason:
+ *    \return ippStsNullPtrErr            Indicates an error condition if any of the specified pointers is NULL:
+ *                                        NULL == pSrc
+ *                                        NULL == len
+ *                                        NULL == pMD
+ *                                        NULL == pCtx
+ *                                        NULL == status
+ *    \return ippStsContextMatchErr       Indicates an error condition if input buffers have different key sizes
+ *    \return ippStsLengthErr             Indicates an error condition if numBuffers < 1
+ *                                        or mdLen < 1 or mdLen > 16
+ *    \return ippStsErr                   One or more of performed operation executed with error
+ *                                        Check status array for details
+ *    \return ippStsNoErr                 No error
+ *
+ *  Note:
+ *    Each message digest is computed over pSrc[i] only, the contexts are used as
+ *    read-only expanded keys (round keys and K1/K2 subkeys): a message buffered
+ *    in a context by ippsAES_CMACUpdate is neither used nor changed.
+ */
+IPPFUN(IppStatus, ippsAES_CMAC_MB, (const Ipp8u* pSrc[], int len[], Ipp8u* pMD[], int mdLen,
+                                    const IppsAES_CMACState* pCtx[],
+                                    IppStatus status[], int numBuffers))
+{
+    int i;
+
+    // Check input pointers
+    IPP_BAD_PTR2_RET(pCtx, pMD);
+    IPP_BAD_PTR3_RET(pSrc, len, status);
+
+    // Check number of buffers to be processed and the digest length
+    IPP_BADARG_RET((numBuffers < 1), ippStsLengthErr);
+    IPP_BADARG_RET((mdLen < 1) || (MBS_RIJ128 < mdLen), ippStsLengthErr);
+
+    // Sequential check of all input buffers
+    int isAllBuffersValid = 1;
+    for (i = 0; i < numBuffers; i++) {
+        // Test the digest and context pointers
+        if (pMD[i] == NULL || pCtx[i] == NULL) {
+            status[i] = ippStsNullPtrErr;
+            isAllBuffersValid = 0;
+            continue;
+        }
+
+        // Test the context ID
+        if (!VALID_AESCMAC_ID(pCtx[i])) {
+            status[i] = ippStsContextMatchErr;
+            isAllBuffersValid = 0;
+            continue;
+        }
+
+        // Test message length, an empty message is allowed
+        if (len[i] < 0) {
+            status[i] = ippStsLengthErr;
+            isAllBuffersValid = 0;
+            continue;
+        }
+
+        // Test message pointer
+        if (len[i] && pSrc[i] == NULL) {
+            status[i] = ippStsNullPtrErr;
+            isAllBuffersValid = 0;
+            continue;
+        }
+
+        status[i] = ippStsNoErr;
+    }
+
+    // If any of the input buffer is not valid stop the processing
+    IPP_BADARG_RET(!isAllBuffersValid, ippStsErr)
+
+    // Check compatibility of the keys
+    int referenceKeySize = RIJ_NK(&CMAC_CIPHER(pCtx[0]));
+    for (i = 0; i < numBuffers; i++) {
+        IPP_BADARG_RET((RIJ_NK(&CMAC_CIPHER(pCtx[i])) != referenceKeySize), ippStsContextMatchErr);
+    }
+
+    #if (_IPP32E>=_IPP32E_Y8)
+    int buffersProcessed = 0;
+    #endif
+
+    #if(_IPP32E>=_IPP32E_K1)
+    if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
+        while(numBuffers > 0) {
+            int workLoadSize;
+            cmacMbKernel kernel;
+
+            /* init work load size and choose a core */
+            if (numBuffers > WORKLOAD_LINES_8) {
+                workLoadSize = WORKLOAD_LINES_16;
+                kernel = aes_cmac_vaes_mb16;
+            } else if (numBuffers > WORKLOAD_LINES_4) {
+                workLoadSize = WORKLOAD_LINES_8;
+                kernel = aes_cmac_vaes_mb8;
+            } else {
+                workLoadSize = WORKLOAD_LINES_4;
+                kernel = aes_cmac_vaes_mb4;
+            }
+
+            cmacProcessMb(pSrc + buffersProcessed, len + buffersProcessed, pMD + buffersProcessed, mdLen,
+                          pCtx + buffersProcessed, numBuffers, workLoadSize, kernel);
+
+            /* changing the remaining buffers for processing */
+            numBuffers -= workLoadSize;
+            buffersProcessed += workLoadSize;
+        }
+    }
+    #endif // if(_IPP32E>=_IPP32E_K1)
+
+    #if (_IPP32E>=_IPP32E_Y8)
+    if( IsFeatureEnabled(ippCPUID_AES) ) {
+        while(numBuffers > 0) {
+            cmacProcessMb(pSrc + buffersProcessed, len + buffersProcessed, pMD + buffersProcessed, mdLen,
+                          pCtx + buffersProcessed, numBuffers, WORKLOAD_LINES_4, aes_cmac_aesni_mb4);
+
+            numBuffers -= WORKLOAD_LINES_4;
+            buffersProcessed += WORKLOAD_LINES_4;
+        }
+    }
+    #endif // (_IPP32E>=_IPP32E_Y8)
+
+    for (i = 0; i < numBuffers; i++) {
+        const IppsAESSpec* pAES = &CMAC_CIPHER(pCtx[i]);
+        __ALIGN16 Ipp8u mac[MBS_RIJ128];
+        __ALIGN16 Ipp8u lastBlk[MBS_RIJ128];
+
+        PadBlock(0, mac, MBS_RIJ128);
+        cmacLastBlock(lastBlk, pSrc[i], len[i], pCtx[i]);
+
+        AES_CMAC_processing(mac, pSrc[i], cmacBulkLen(len[i]), pAES);
+        AES_CMAC_processing(mac, lastBlk, MBS_RIJ128, pAES);
+
+        CopyBlock(mac, pMD[i], mdLen);
+
+        PurgeBlock(mac, sizeof(mac));
+        PurgeBlock(lastBlk, sizeof(lastBlk));
+    }
+
+    return ippStsNoErr;
+}
+
+#undef WORKLOAD_LINES_16
+#undef WORKLOAD_LINES_8
+#undef WORKLOAD_LINES_4
@@ -22,6 +22,7 @@
 //
 //  Contents:
 //        init()
+//        AES_CMAC_processing()
 //
 */
 
@@ -31,6 +32,10 @@
 #include "pcpaesm.h"
 #include "pcptool.h"
 
+#if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+#  include "pcprijtables.h"
+#endif
+
 #if !defined(_PCP_AES_CMAC_STUFF_H_)
 #define _PCP_AES_CMAC_STUFF_H_
 
@@ -47,4 +52,35 @@ static void init(IppsAES_CMACState* pCtx)
    PadBlock(0, CMAC_MAC(pCtx), MBS_RIJ128);
 }
 
+/* updates intermediate digest by the whole blocks of the input stream */
+static void AES_CMAC_processing(Ipp8u* pDigest, const Ipp8u* pSrc, int processedLen, const IppsAESSpec* pAES)
+{
+#if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   if(AES_NI_ENABLED==RIJ_AESNI(pAES)) {
+      cpAESCMAC_Update_AES_NI(pDigest, pSrc, processedLen, RIJ_NR(pAES), RIJ_EKEYS(pAES));
+   }
+   else
+#endif
+   {
+      /* setup encoder method */
+      RijnCipher encoder = RIJ_ENCODER(pAES);
+
+      while(processedLen) {
+         ((Ipp32u*)pDigest)[0] ^= ((Ipp32u*)pSrc)[0];
+         ((Ipp32u*)pDigest)[1] ^= ((Ipp32u*)pSrc)[1];
+         ((Ipp32u*)pDigest)[2] ^= ((Ipp32u*)pSrc)[2];
+         ((Ipp32u*)pDigest)[3] ^= ((Ipp32u*)pSrc)[3];
+
+         #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+         encoder(pDigest, pDigest, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+         #else
+         encoder(pDigest, pDigest, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+         #endif
+
+         pSrc += MBS_RIJ128;
+         processedLen -= MBS_RIJ128;
+      }
+   }
+}
+
 #endif /* #if !defined(_PCP_AES_CMAC_STUFF_H_) */
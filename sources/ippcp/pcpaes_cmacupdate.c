@@ -30,6 +30,7 @@
 #include "pcpcmac.h"
 #include "pcpaesm.h"
 #include "pcptool.h"
+#include "pcpaes_cmac_stuff.h"
 
 #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
 #  include "pcprijtables.h"
@@ -54,36 +55,6 @@
 //    pState   pointer to the CMAC context
 //
 *F*/
-static void AES_CMAC_processing(Ipp8u* pDigest, const Ipp8u* pSrc, int processedLen, const IppsAESSpec* pAES)
-{
-#if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
-   if(AES_NI_ENABLED==RIJ_AESNI(pAES)) {
-      cpAESCMAC_Update_AES_NI(pDigest, pSrc, processedLen, RIJ_NR(pAES), RIJ_EKEYS(pAES));
-   }
-   else
-#endif
-   {
-      /* setup encoder method */
-      RijnCipher encoder = RIJ_ENCODER(pAES);
-
-      while(processedLen) {
-         ((Ipp32u*)pDigest)[0] ^= ((Ipp32u*)pSrc)[0];
-         ((Ipp32u*)pDigest)[1] ^= ((Ipp32u*)pSrc)[1];
-         ((Ipp32u*)pDigest)[2] ^= ((Ipp32u*)pSrc)[2];
-         ((Ipp32u*)pDigest)[3] ^= ((Ipp32u*)pSrc)[3];
-
-         #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
-         encoder(pDigest, pDigest, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
-         #else
-         encoder(pDigest, pDigest, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
-         #endif
-
-         pSrc += MBS_RIJ128;
-         processedLen -= MBS_RIJ128;
-      }
-   }
-}
-
 IPPFUN(IppStatus, ippsAES_CMACUpdate,(const Ipp8u* pSrc, int len, IppsAES_CMACState* pState))
 {
    int processedLen;
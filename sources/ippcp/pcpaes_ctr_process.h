@@ -77,6 +77,94 @@ __IPPCP_INLINE void MaskCounter128(Ipp8u* pMaskIV, int ctrBtSize)
    }
 }
 
+/*
+// Add n to the counter part (selected by pMaskIV) of the big-endian counter block
+*/
+__IPPCP_INLINE void cpAddCounter128(Ipp8u* pCtrValue, const Ipp8u* pMaskIV, Ipp64u n)
+{
+   Ipp32u carry = 0;
+   int i;
+   for(i=MBS_RIJ128-1; i>=0; i--) {
+      Ipp32u mask = pMaskIV[i];
+      Ipp32u sum = (pCtrValue[i] & mask) + (Ipp32u)(n & 0xFF) + carry;
+      pCtrValue[i] = (Ipp8u)((pCtrValue[i] & ~mask) | (sum & mask));
+      carry = sum >> 8;
+      n >>= 8;
+   }
+}
+
+#if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+
+/* process data chunk and update counter value */
+typedef void (*cpProcessAES_ctr_chunk)(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
+                                       const IppsAESSpec* pCtx,
+                                       Ipp8u* pCtrValue, const Ipp8u* pMaskIV);
+
+__IPPCP_INLINE void cpProcessAES_ctr_pipe(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
+                                          const IppsAESSpec* pCtx,
+                                          Ipp8u* pCtrValue, const Ipp8u* pMaskIV)
+{
+#if(_IPP32E>=_IPP32E_K1)
+   if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
+      EncryptCTR_RIJ128pipe_VAES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), dataLen, pCtrValue, pMaskIV);
+   }
+   else
+#endif
+   {
+      EncryptCTR_RIJ128pipe_AES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), dataLen, pCtrValue, pMaskIV);
+   }
+}
+
+/*
+// Multi-threaded CTR processing.
+//
+// Data stream is split on block boundaries into nThreads chunks,
+// counter of each chunk is advanced by the number of blocks preceding the chunk.
+// The counter updated by the last chunk is returned in pCtrValue.
+*/
+__IPPCP_INLINE void cpProcessAES_ctr_mt(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
+                                        const IppsAESSpec* pCtx,
+                                        Ipp8u* pCtrValue, const Ipp8u* pMaskIV,
+                                        cpProcessAES_ctr_chunk processChunk)
+{
+   int nThreads = cpNumThreadsForLen(dataLen);
+
+   if(1==nThreads)
+      processChunk(pSrc, pDst, dataLen, pCtx, pCtrValue, pMaskIV);
+
+   else {
+      int nBlocks = dataLen / MBS_RIJ128;
+      Ipp8u initCtr[MBS_RIJ128];
+      int t;
+
+      CopyBlock16(pCtrValue, initCtr);
+
+      #if defined(_OPENMP)
+      #pragma omp parallel for IPPCP_OMP_LIMIT_MAX_NUM_THREADS(nThreads)
+      #endif
+      for(t=0; t<nThreads; t++) {
+         int firstBlk = (int)((Ipp64s)nBlocks*t/nThreads);
+         int lastBlk  = (int)((Ipp64s)nBlocks*(t+1)/nThreads);
+         int chunkLen = (lastBlk-firstBlk)*MBS_RIJ128;
+         Ipp8u ctr[MBS_RIJ128];
+
+         CopyBlock16(initCtr, ctr);
+         cpAddCounter128(ctr, pMaskIV, (Ipp64u)firstBlk);
+
+         /* last thread processes the partial block and returns the counter */
+         if(t==nThreads-1)
+            chunkLen += dataLen & (MBS_RIJ128-1);
+
+         processChunk(pSrc+firstBlk*MBS_RIJ128, pDst+firstBlk*MBS_RIJ128, chunkLen, pCtx, ctr, pMaskIV);
+
+         if(t==nThreads-1)
+            CopyBlock16(ctr, pCtrValue);
+      }
+   }
+}
+
+#endif /* #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8) */
+
 static
 IppStatus cpProcessAES_ctr(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
                            const IppsAESSpec* pCtx,
@@ -123,15 +211,7 @@ IppStatus cpProcessAES_ctr(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
       Ipp8u maskIV[MBS_RIJ128];
       MaskCounter128(maskIV, ctrNumBitSize); /* const-exe-time version */
 
-#if(_IPP32E>=_IPP32E_K1)
-      if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
-         EncryptCTR_RIJ128pipe_VAES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), dataLen, pCtrValue, maskIV);
-      }
-      else
-#endif
-      {
-         EncryptCTR_RIJ128pipe_AES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), dataLen, pCtrValue, maskIV);
-      }
+      cpProcessAES_ctr_mt(pSrc, pDst, dataLen, pCtx, pCtrValue, maskIV, cpProcessAES_ctr_pipe);
       return ippStsNoErr;
    }
    else
@@ -201,6 +281,45 @@ IppStatus cpProcessAES_ctr(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
 
 #if (_IPP32E>=_IPP32E_Y8)
 
+/*
+// process data chunk with 128-bit counter (pMaskIV is not used)
+*/
+__IPPCP_INLINE void cpProcessAES_ctr128_stream(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen,
+                                               const IppsAESSpec* pCtx,
+                                               Ipp8u* pCtrValue, const Ipp8u* pMaskIV)
+{
+   IPP_UNREFERENCED_PARAMETER(pMaskIV);
+
+   while(dataLen>=MBS_RIJ128) {
+      Ipp32u blocks = (Ipp32u)(dataLen>>4); /* number of blocks per loop processing */
+
+      /* low LE 32 bit of counter */
+      Ipp32u ctr32 = ((Ipp32u*)(pCtrValue))[3];
+      ctr32 = ENDIANNESS32(ctr32);
+
+      /* compute number of locks being processed without ctr32 overflow */
+      ctr32 += blocks;
+      if(ctr32 < blocks)
+         blocks -= ctr32;
+
+#if(_IPP32E>=_IPP32E_K1)
+      if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
+         EncryptStreamCTR32_VAES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), (Ipp32s)blocks*MBS_RIJ128, pCtrValue);
+      }
+      else
+#endif
+      EncryptStreamCTR32_AES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), (Ipp32s)blocks*MBS_RIJ128, pCtrValue);
+
+      pSrc += blocks*MBS_RIJ128;
+      pDst += blocks*MBS_RIJ128;
+      dataLen -= blocks*MBS_RIJ128;
+   }
+
+   if(dataLen) {
+      EncryptStreamCTR32_AES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), dataLen, pCtrValue);
+   }
+}
+
 /*
 // special version: 128-bit counter
 */
@@ -218,34 +337,11 @@ IppStatus cpProcessAES_ctr128(const Ipp8u* pSrc, Ipp8u* pDst, int dataLen, const
    IPP_BADARG_RET((dataLen<1), ippStsLengthErr);
 
    {
-      while(dataLen>=MBS_RIJ128) {
-         Ipp32u blocks = (Ipp32u)(dataLen>>4); /* number of blocks per loop processing */
-
-         /* low LE 32 bit of counter */
-         Ipp32u ctr32 = ((Ipp32u*)(pCtrValue))[3];
-         ctr32 = ENDIANNESS32(ctr32);
-
-         /* compute number of locks being processed without ctr32 overflow */
-         ctr32 += blocks;
-         if(ctr32 < blocks)
-            blocks -= ctr32;
-
-#if(_IPP32E>=_IPP32E_K1)
-         if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
-            EncryptStreamCTR32_VAES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), (Ipp32s)blocks*MBS_RIJ128, pCtrValue);
-         }
-         else
-#endif
-         EncryptStreamCTR32_AES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), (Ipp32s)blocks*MBS_RIJ128, pCtrValue);
-
-         pSrc += blocks*MBS_RIJ128;
-         pDst += blocks*MBS_RIJ128;
-         dataLen -= blocks*MBS_RIJ128;
-      }
+      /* whole counter block is incremented */
+      Ipp8u maskIV[MBS_RIJ128];
+      PadBlock(0xFF, maskIV, MBS_RIJ128);
 
-      if(dataLen) {
-         EncryptStreamCTR32_AES_NI(pSrc, pDst, RIJ_NR(pCtx), RIJ_EKEYS(pCtx), dataLen, pCtrValue);
-      }
+      cpProcessAES_ctr_mt(pSrc, pDst, dataLen, pCtx, pCtrValue, maskIV, cpProcessAES_ctr128_stream);
 
       return ippStsNoErr;
    }
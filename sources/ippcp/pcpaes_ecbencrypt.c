@@ -151,7 +151,19 @@ IPPFUN(IppStatus, ippsAESEncryptECB,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
    } else
 #endif
    {
-      cpEncryptAES_ecb_dispatch(pSrc, pDst, len, pCtx);
+      /* independent blocks are split between threads (single chunk if threading is off) */
+      int nThreads = cpNumThreadsForLen(len);
+      int nBlocks = len / MBS_RIJ128;
+      int t;
+
+      #if defined(_OPENMP)
+      #pragma omp parallel for IPPCP_OMP_LIMIT_MAX_NUM_THREADS(nThreads)
+      #endif
+      for(t=0; t<nThreads; t++) {
+         int firstBlk = (int)((Ipp64s)nBlocks*t/nThreads);
+         int lastBlk  = (int)((Ipp64s)nBlocks*(t+1)/nThreads);
+         cpEncryptAES_ecb_dispatch(pSrc+firstBlk*MBS_RIJ128, pDst+firstBlk*MBS_RIJ128, (lastBlk-firstBlk)*MBS_RIJ128, pCtx);
+      }
    }
     
    return ippStsNoErr;
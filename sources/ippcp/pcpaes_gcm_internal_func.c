@@ -20,6 +20,7 @@
 //     Cryptography Primitive.
 //        * Initialization functions for internal methods and pointers inside AES-GCM context;
 //        * AES-GCM encryption kernels with the conditional noise injections mechanism;
+//        * scatter-gather and one-shot AES-GCM processing;
 //
 */
 
@@ -29,6 +30,10 @@
 #include "pcpaesm.h"
 #include "pcptool.h"
 
+#if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+#  include "pcprijtables.h"
+#endif
+
 #if (_IPP32E >= _IPP32E_K0)
 #include "pcpaesauthgcm_avx512.h"
 #else
@@ -168,7 +173,8 @@ IPP_OWN_DEFN(void, condNoisedGCMEncryption, (const Ipp8u* pSrc, Ipp8u* pDst, int
          encFunc(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState), 
                  pDst, pSrc, (Ipp64u)chunk_size);
       #else
-         encFunc(pDst, pSrc, chunk_size, pState);
+         encFunc(pDst, pSrc, chunk_size, AESGCM_CIPHER(pState), AESGCM_HKEY(pState),
+                 AESGCM_GHASH(pState), AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState));
       #endif
 
          cpAESRandomNoise(NULL,
@@ -187,7 +193,8 @@ IPP_OWN_DEFN(void, condNoisedGCMEncryption, (const Ipp8u* pSrc, Ipp8u* pDst, int
       encFunc(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState), 
               pDst, pSrc, (Ipp64u)ptxt_len);
    #else
-      encFunc(pDst, pSrc, ptxt_len, pState);
+      encFunc(pDst, pSrc, ptxt_len, AESGCM_CIPHER(pState), AESGCM_HKEY(pState),
+              AESGCM_GHASH(pState), AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState));
    #endif
    }
 }
@@ -232,7 +239,8 @@ IPP_OWN_DEFN(void, condNoisedGCMDecryption, (const Ipp8u* pSrc, Ipp8u* pDst, int
          decFunc(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState), 
                  pDst, pSrc, (Ipp64u)chunk_size);
       #else
-         decFunc(pDst, pSrc, chunk_size, pState);
+         decFunc(pDst, pSrc, chunk_size, AESGCM_CIPHER(pState), AESGCM_HKEY(pState),
+                 AESGCM_GHASH(pState), AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState));
       #endif
 
          cpAESRandomNoise(NULL,
@@ -251,7 +259,591 @@ IPP_OWN_DEFN(void, condNoisedGCMDecryption, (const Ipp8u* pSrc, Ipp8u* pDst, int
       decFunc(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState), 
               pDst, pSrc, (Ipp64u)ctxt_len);
    #else
-      decFunc(pDst, pSrc, ctxt_len, pState);
+      decFunc(pDst, pSrc, ctxt_len, AESGCM_CIPHER(pState), AESGCM_HKEY(pState),
+              AESGCM_GHASH(pState), AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState));
+   #endif
+   }
+}
+
+/*!
+ * This function completes IV processing: computes the initial counter block and its encryption
+ * and switches the context to AAD processing.
+ *
+ * Parameters:
+ *    \param[in] pState    Pointer to the AES-GCM context in GcmIVprocessing state.
+ */
+IPP_OWN_DEFN(void, cpAES_GCMCompleteIV, (IppsAES_GCMState* pState))
+{
+#if(_IPP32E>=_IPP32E_K0)
+   IvFinalize_ ivHashFinalize = AES_GCM_IV_FINALIZE(pState);
+
+   /* complete IV processing */
+   ivHashFinalize(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState),
+                  AESGCM_COUNTER(pState), (Ipp64u)AESGCM_BUFLEN(pState), AESGCM_IV_LEN(pState));
+#else
+   /* complete IV processing */
+   if(CTR_POS==AESGCM_IV_LEN(pState)) {
+      /* apply special format if IV length is 12 bytes */
+      AESGCM_COUNTER(pState)[12] = 0;
+      AESGCM_COUNTER(pState)[13] = 0;
+      AESGCM_COUNTER(pState)[14] = 0;
+      AESGCM_COUNTER(pState)[15] = 1;
+   } else {
+      /* get method */
+      MulGcm_ hashFunc = AESGCM_HASH(pState);
+
+      /* process the rest of IV */
+      if(AESGCM_BUFLEN(pState))
+         hashFunc(AESGCM_COUNTER(pState), AESGCM_HKEY(pState), AesGcmConst_table);
+
+      /* add IV bit length */
+      {
+         Ipp64u ivBitLen = AESGCM_IV_LEN(pState)*BYTESIZE;
+         Ipp8u tmp[BLOCK_SIZE];
+         PadBlock(0, tmp, BLOCK_SIZE-8);
+         U32_TO_HSTRING(tmp+8,  IPP_HIDWORD(ivBitLen));
+         U32_TO_HSTRING(tmp+12, IPP_LODWORD(ivBitLen));
+         XorBlock16(tmp, AESGCM_COUNTER(pState), AESGCM_COUNTER(pState));
+         hashFunc(AESGCM_COUNTER(pState), AESGCM_HKEY(pState), AesGcmConst_table);
+      }
+   }
+
+   /* prepare initial counter */
+   {
+      IppsAESSpec* pAES = AESGCM_CIPHER(pState);
+      RijnCipher encoder = RIJ_ENCODER(pAES);
+      #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+      encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER0(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+      #else
+      encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER0(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+      #endif
+   }
+#endif /* #if(_IPP32E>=_IPP32E_K0) */
+
+   /* switch mode and init counters */
+   AESGCM_STATE(pState) = GcmAADprocessing;
+   AESGCM_AAD_LEN(pState) = CONST_64(0);
+   AESGCM_BUFLEN(pState) = 0;
+}
+
+/* position inside an array of segments */
+typedef struct {
+   const IppsAES_GCMSegment* pSeg;  /* current segment */
+   const IppsAES_GCMSegment* pEnd;  /* end of the array */
+   int offset;                      /* number of bytes of the current segment already taken */
+} gcmSegIter;
+
+static void gcmSegInit(gcmSegIter* pIt, const IppsAES_GCMSegment* pSeg, int numSeg)
+{
+   pIt->pSeg = pSeg;
+   pIt->pEnd = numSeg? pSeg+numSeg : pSeg;
+   pIt->offset = 0;
+}
+
+/*
+// Takes the next piece of at most maxLen bytes, the piece does not cross segment boundaries.
+// Empty segments are skipped. Returns length of the piece, 0 if there is no data left.
+*/
+static int gcmSegNext(gcmSegIter* pIt, int maxLen, const Ipp8u** ppSrc, Ipp8u** ppDst)
+{
+   int len;
+   while(pIt->pSeg<pIt->pEnd && pIt->offset==pIt->pSeg->len) {
+      pIt->pSeg++;
+      pIt->offset = 0;
+   }
+   if(pIt->pSeg==pIt->pEnd)
+      return 0;
+
+   len = IPP_MIN(maxLen, pIt->pSeg->len - pIt->offset);
+   *ppSrc = pIt->pSeg->pSrc + pIt->offset;
+   if(ppDst)
+      *ppDst = pIt->pSeg->pDst + pIt->offset;
+   pIt->offset += len;
+   return len;
+}
+
+/*
+// Absorbs the AAD segments. A partial block is completed by the pieces of the next segments,
+// the rest is hashed in place by whole blocks; the tail is left in the context.
+*/
+static void gcmProcessAADSegments(IppsAES_GCMState* pState, const IppsAES_GCMSegment* pAAD, int numAAD)
+{
+   gcmSegIter it;
+   const Ipp8u* pSrc;
+   int len;
+
+   gcmSegInit(&it, pAAD, numAAD);
+   for(;;) {
+      int bufLen = (int)AESGCM_BUFLEN(pState);
+      len = gcmSegNext(&it, bufLen? BLOCK_SIZE-bufLen : IPP_MAX_32S, &pSrc, NULL);
+      if(0==len)
+         break;
+      AESGCM_AAD_LEN(pState) += (Ipp64u)len;
+
+#if(_IPP32E>=_IPP32E_K0)
+      /* Note: GHASH in the IPsec context is byte-reflected */
+      if(bufLen) {
+         XorBlockMirror(pSrc, AESGCM_GHASH(pState), AESGCM_GHASH(pState), BLOCK_SIZE-bufLen, len);
+         AESGCM_BUFLEN(pState) += (Ipp64u)len;
+         if(BLOCK_SIZE==AESGCM_BUFLEN(pState)) {
+            AES_GCM_GMUL(pState)(&AES_GCM_KEY_DATA(pState), AESGCM_GHASH(pState));
+            AESGCM_BUFLEN(pState) = 0;
+         }
+      }
+      else {
+         int lenBlks = len & (-BLOCK_SIZE);
+         if(lenBlks)
+            AES_GCM_AAD_UPDATE(pState)(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState), pSrc, (Ipp64u)lenBlks);
+         if(len-lenBlks) {
+            XorBlockMirror(pSrc+lenBlks, AESGCM_GHASH(pState), AESGCM_GHASH(pState), BLOCK_SIZE, len-lenBlks);
+            AESGCM_BUFLEN(pState) = (Ipp64u)(len-lenBlks);
+         }
+      }
+#else
+      if(bufLen) {
+         XorBlock(pSrc, AESGCM_GHASH(pState)+bufLen, AESGCM_GHASH(pState)+bufLen, len);
+         AESGCM_BUFLEN(pState) += len;
+         if(BLOCK_SIZE==AESGCM_BUFLEN(pState)) {
+            AESGCM_HASH(pState)(AESGCM_GHASH(pState), AESGCM_HKEY(pState), AesGcmConst_table);
+            AESGCM_BUFLEN(pState) = 0;
+         }
+      }
+      else {
+         int lenBlks = len & (-BLOCK_SIZE);
+         if(lenBlks)
+            AESGCM_AUTH(pState)(AESGCM_GHASH(pState), pSrc, lenBlks, AESGCM_HKEY(pState), AesGcmConst_table);
+         if(len-lenBlks) {
+            XorBlock(pSrc+lenBlks, AESGCM_GHASH(pState), AESGCM_GHASH(pState), len-lenBlks);
+            AESGCM_BUFLEN(pState) = len-lenBlks;
+         }
+      }
+#endif /* #if(_IPP32E>=_IPP32E_K0) */
+   }
+}
+
+/* completes AAD processing and switches the context to text processing */
+static void gcmStartText(IppsAES_GCMState* pState)
+{
+#if(_IPP32E>=_IPP32E_K0)
+   if(AESGCM_BUFLEN(pState))
+      AES_GCM_GMUL(pState)(&AES_GCM_KEY_DATA(pState), AESGCM_GHASH(pState));
+#else
+   IppsAESSpec* pAES = AESGCM_CIPHER(pState);
+   RijnCipher encoder = RIJ_ENCODER(pAES);
+
+   if(AESGCM_BUFLEN(pState))
+      AESGCM_HASH(pState)(AESGCM_GHASH(pState), AESGCM_HKEY(pState), AesGcmConst_table);
+
+   /* increment counter block */
+   IncrementCounter32(AESGCM_COUNTER(pState));
+   /* and encrypt counter */
+   #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+   encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+   #else
+   encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
    #endif
+#endif /* #if(_IPP32E>=_IPP32E_K0) */
+
+   AESGCM_STATE(pState) = GcmTXTprocessing;
+   AESGCM_TXT_LEN(pState) = CONST_64(0);
+   AESGCM_BUFLEN(pState) = 0;
+}
+
+#if(_IPP32E<_IPP32E_K0)
+/*
+// Processes a piece of text that fits into the partial block (len <= BLOCK_SIZE-BUFLEN).
+// When the block is complete it is hashed and the next counter block is encrypted.
+*/
+static void gcmTxtPartial(IppsAES_GCMState* pState, const Ipp8u* pSrc, Ipp8u* pDst, int len, int isEncrypt)
+{
+   Ipp8u* pHash = AESGCM_GHASH(pState)+AESGCM_BUFLEN(pState);
+   Ipp8u* pECounter = AESGCM_ECOUNTER(pState)+AESGCM_BUFLEN(pState);
+
+   /* the ciphertext is hashed */
+   if(isEncrypt) {
+      XorBlock(pSrc, pECounter, pDst, len);
+      XorBlock(pDst, pHash, pHash, len);
+   }
+   else {
+      XorBlock(pSrc, pHash, pHash, len);
+      XorBlock(pSrc, pECounter, pDst, len);
+   }
+   AESGCM_BUFLEN(pState) += len;
+   AESGCM_TXT_LEN(pState) += (Ipp64u)len;
+
+   if(BLOCK_SIZE==AESGCM_BUFLEN(pState)) {
+      IppsAESSpec* pAES = AESGCM_CIPHER(pState);
+      RijnCipher encoder = RIJ_ENCODER(pAES);
+
+      AESGCM_HASH(pState)(AESGCM_GHASH(pState), AESGCM_HKEY(pState), AesGcmConst_table);
+      AESGCM_BUFLEN(pState) = 0;
+
+      /* Inject the noise for the case of partial blocks processing */
+   #if (_AES_PROB_NOISE == _FEATURE_ON_)
+      cpAESNoiseParams *params = (cpAESNoiseParams*)&AESGCM_NOISE_PARAMS(pState);
+      if (AES_NOISE_LEVEL(params) > 0)
+         cpAESRandomNoise(NULL,
+                  MISTLETOE3_BASE_NOISE_LEVEL + AES_NOISE_LEVEL(params),
+                  MISTLETOE3_NOISE_RATE,
+                  &AES_NOISE_RAND(params));
+   #endif
+
+      /* increment counter block */
+      IncrementCounter32(AESGCM_COUNTER(pState));
+      /* and encrypt counter */
+      #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+      encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+      #else
+      encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+      #endif
    }
 }
+#endif /* #if(_IPP32E<_IPP32E_K0) */
+
+/*
+// Encrypts or decrypts the text segments in place. The keystream and GHASH state (counter block,
+// partial block) is kept in the context across the segments, whole blocks of every segment
+// are passed to the AES-GCM kernel directly.
+*/
+static void gcmProcessTxtSegments(IppsAES_GCMState* pState, const IppsAES_GCMSegment* pTxt, int numTxt, int isEncrypt)
+{
+   gcmSegIter it;
+   const Ipp8u* pSrc;
+   Ipp8u* pDst;
+   int len;
+
+   gcmSegInit(&it, pTxt, numTxt);
+#if(_IPP32E>=_IPP32E_K0)
+   /* the kernel keeps the partial block in the context data */
+   while(0 != (len = gcmSegNext(&it, IPP_MAX_32S, &pSrc, &pDst))) {
+      if(isEncrypt)
+         condNoisedGCMEncryption(pSrc, pDst, len, pState);
+      else
+         condNoisedGCMDecryption(pSrc, pDst, len, pState);
+   }
+#else
+   for(;;) {
+      int bufLen = AESGCM_BUFLEN(pState);
+      len = gcmSegNext(&it, bufLen? BLOCK_SIZE-bufLen : IPP_MAX_32S, &pSrc, &pDst);
+      if(0==len)
+         break;
+
+      if(bufLen)
+         gcmTxtPartial(pState, pSrc, pDst, len, isEncrypt);
+      else {
+         int lenBlks = len & (-BLOCK_SIZE);
+         if(lenBlks) {
+            if(isEncrypt)
+               condNoisedGCMEncryption(pSrc, pDst, lenBlks, pState);
+            else
+               condNoisedGCMDecryption(pSrc, pDst, lenBlks, pState);
+            AESGCM_TXT_LEN(pState) += (Ipp64u)lenBlks;
+         }
+         if(len-lenBlks)
+            gcmTxtPartial(pState, pSrc+lenBlks, pDst+lenBlks, len-lenBlks, isEncrypt);
+      }
+   }
+#endif /* #if(_IPP32E>=_IPP32E_K0) */
+}
+
+/*!
+ * This function processes AAD and text given as arrays of segments (scatter-gather AES-GCM).
+ *
+ * The segments are walked by an iterator: a partial AAD or text block is completed by the
+ * bytes of the following segments, whole blocks are processed in place by the AES-GCM kernels.
+ * The partial block, the counter block and GHASH are carried across segment boundaries
+ * in the context, so no data is copied and the result is the same as for a single buffer.
+ *
+ * All the arguments and the context state are validated before any data is processed.
+ *
+ * Parameters:
+ *    \param[in] pAAD      Pointer to the array of AAD segments (pDst is ignored).
+ *    \param[in] numAAD    Number of AAD segments.
+ *    \param[in] pTxt      Pointer to the array of text segments.
+ *    \param[in] numTxt    Number of text segments.
+ *    \param[in] pState    Pointer to the AES-GCM context.
+ *    \param[in] isEncrypt Encryption (1) or decryption (0).
+ */
+IPP_OWN_DEFN(IppStatus, cpAES_GCMProcessV, (const IppsAES_GCMSegment* pAAD, int numAAD,
+                                           const IppsAES_GCMSegment* pTxt, int numTxt,
+                                           IppsAES_GCMState* pState, int isEncrypt))
+{
+   /* test pState pointer */
+   IPP_BAD_PTR1_RET(pState);
+   /* use aligned context */
+   pState = (IppsAES_GCMState*)( IPP_ALIGNED_PTR(pState, AESGCM_ALIGNMENT) );
+   /* test state ID */
+   IPP_BADARG_RET(!AESGCM_VALID_ID(pState), ippStsContextMatchErr);
+
+   /* test segment arrays */
+   IPP_BADARG_RET(numAAD<0 || numTxt<0, ippStsLengthErr);
+   IPP_BADARG_RET((numAAD && !pAAD) || (numTxt && !pTxt), ippStsNullPtrErr);
+
+   /* test call sequence: IV must be started, AAD precedes text */
+   IPP_BADARG_RET(GcmInit==AESGCM_STATE(pState), ippStsBadArgErr);
+   if(numAAD) {
+      IPP_BADARG_RET(!(GcmIVprocessing==AESGCM_STATE(pState) || GcmAADprocessing==AESGCM_STATE(pState)), ippStsBadArgErr);
+      IPP_BADARG_RET(GcmIVprocessing==AESGCM_STATE(pState) && 0==AESGCM_IV_LEN(pState), ippStsBadArgErr);
+   }
+   else if(numTxt) {
+      /* same as ippsAES_GCMEncrypt/ippsAES_GCMDecrypt */
+      IPP_BADARG_RET(!(GcmAADprocessing==AESGCM_STATE(pState) || GcmTXTprocessing==AESGCM_STATE(pState)), ippStsBadArgErr);
+   }
+
+   {
+      Ipp64u aadLen = 0;
+      Ipp64u txtLen = 0;
+      int n;
+
+      for(n=0; n<numAAD; n++) {
+         IPP_BADARG_RET(pAAD[n].len<0, ippStsLengthErr);
+         IPP_BADARG_RET(pAAD[n].len && !pAAD[n].pSrc, ippStsNullPtrErr);
+         aadLen += (Ipp64u)pAAD[n].len;
+      }
+      for(n=0; n<numTxt; n++) {
+         IPP_BADARG_RET(pTxt[n].len<0, ippStsLengthErr);
+         IPP_BADARG_RET(pTxt[n].len && !(pTxt[n].pSrc && pTxt[n].pDst), ippStsNullPtrErr);
+         txtLen += (Ipp64u)pTxt[n].len;
+      }
+
+      /* NIST SP 800-38D, p.5.2.1.1: text shall be between 0 and 2^39-256 bits */
+      {
+         Ipp64u prevAadLen = (GcmAADprocessing==AESGCM_STATE(pState))? AESGCM_AAD_LEN(pState) : 0;
+         Ipp64u prevTxtLen = (GcmTXTprocessing==AESGCM_STATE(pState))? AESGCM_TXT_LEN(pState) : 0;
+         const Ipp64u MAX_TXT_LEN = ((Ipp64u)1 << 36) - 32; /* length in bytes */
+         IPP_BADARG_RET((prevAadLen + aadLen) < aadLen, ippStsScaleRangeErr);
+         IPP_BADARG_RET(txtLen > MAX_TXT_LEN || prevTxtLen > MAX_TXT_LEN - txtLen, ippStsScaleRangeErr);
+      }
+   }
+
+   /* process AAD */
+   if(numAAD) {
+      if(GcmIVprocessing==AESGCM_STATE(pState))
+         cpAES_GCMCompleteIV(pState);
+      gcmProcessAADSegments(pState, pAAD, numAAD);
+   }
+
+   /* process text */
+   if(numTxt) {
+      if(GcmAADprocessing==AESGCM_STATE(pState))
+         gcmStartText(pState);
+      gcmProcessTxtSegments(pState, pTxt, numTxt, isEncrypt);
+   }
+
+   return ippStsNoErr;
+}
+
+/*!
+ * This function processes a whole message (IV, AAD and text) and computes its tag in one call.
+ * The context pKey is used as an expanded key and is not modified.
+ *
+ * The message state (struct gcm_context_data with Intel(R) AVX-512 code, the counter blocks and
+ * GHASH otherwise) is kept on the stack, the kernels read round keys and hash key powers
+ * directly from pKey.
+ *
+ * All the arguments are expected to be validated by the caller.
+ *
+ * Parameters:
+ *    \param[in]  pIV        Pointer to the IV.
+ *    \param[in]  ivLen      Length of the IV in bytes (>0).
+ *    \param[in]  pAAD       Pointer to the AAD.
+ *    \param[in]  aadLen     Length of the AAD in bytes.
+ *    \param[in]  pSrc       Pointer to the input text.
+ *    \param[out] pDst       Pointer to the output text.
+ *    \param[in]  len        Length of the text in bytes.
+ *    \param[out] pTag       Pointer to the tag.
+ *    \param[in]  tagLen     Length of the tag in bytes.
+ *    \param[in]  pKey       Pointer to the aligned AES-GCM context initialized by ippsAES_GCMInit().
+ *    \param[in]  isEncrypt  Encryption (1) or decryption (0).
+ */
+IPP_OWN_DEFN(void, cpAES_GCMOneShot, (const Ipp8u* pIV, int ivLen, const Ipp8u* pAAD, int aadLen,
+                                     const Ipp8u* pSrc, Ipp8u* pDst, int len, Ipp8u* pTag, int tagLen,
+                                     const IppsAES_GCMState* pKey, int isEncrypt))
+{
+#if(_IPP32E>=_IPP32E_K0)
+   const struct gcm_key_data* pKeyData = &AES_GCM_KEY_DATA(pKey);
+   __ALIGN16 struct gcm_context_data ctx;
+   __ALIGN16 Ipp8u buf[BLOCK_SIZE];
+   int lenBlks;
+
+   PadBlock(0, &ctx, sizeof(ctx));
+
+   /* IV processing */
+   lenBlks = ivLen & (-BLOCK_SIZE);
+   if(lenBlks)
+      AES_GCM_IV_UPDATE(pKey)(pKeyData, &ctx, pIV, (Ipp64u)lenBlks);
+   PadBlock(0, buf, BLOCK_SIZE);
+   CopyBlock(pIV+lenBlks, buf, ivLen-lenBlks);
+   AES_GCM_IV_FINALIZE(pKey)(pKeyData, &ctx, buf, (Ipp64u)(ivLen-lenBlks), (Ipp64u)ivLen);
+
+   /* AAD processing */
+   lenBlks = aadLen & (-BLOCK_SIZE);
+   if(lenBlks)
+      AES_GCM_AAD_UPDATE(pKey)(pKeyData, &ctx, pAAD, (Ipp64u)lenBlks);
+   if(aadLen-lenBlks) {
+      /* Note: GHASH in the IPsec context is byte-reflected */
+      XorBlockMirror(pAAD+lenBlks, ctx.aad_hash, ctx.aad_hash, BLOCK_SIZE, aadLen-lenBlks);
+      AES_GCM_GMUL(pKey)(pKeyData, ctx.aad_hash);
+   }
+   ctx.aad_length = (Ipp64u)aadLen;
+   ctx.in_length = 0;
+   ctx.partial_block_length = 0;
+
+   /* text processing */
+   if(len) {
+      EncryptUpdate_ updateFunc = isEncrypt? AES_GCM_ENCRYPT_UPDATE(pKey) : AES_GCM_DECRYPT_UPDATE(pKey);
+   #if (_AES_PROB_NOISE == _FEATURE_ON_)
+      /* Mistletoe3 mitigation */
+      cpAESNoiseParams *params = (cpAESNoiseParams*)&AESGCM_NOISE_PARAMS(pKey);
+      if (AES_NOISE_LEVEL(params) > 0) {
+         while (len > 0) {
+            int chunk_size = IPP_MIN(len, MISTLETOE3_MAX_CHUNK_SIZE);
+            updateFunc(pKeyData, &ctx, pDst, pSrc, (Ipp64u)chunk_size);
+            cpAESRandomNoise(NULL,
+                     MISTLETOE3_BASE_NOISE_LEVEL + AES_NOISE_LEVEL(params),
+                     MISTLETOE3_NOISE_RATE,
+                     &AES_NOISE_RAND(params));
+            pSrc += chunk_size;
+            pDst += chunk_size;
+            len -= chunk_size;
+         }
+      } else
+   #endif
+      updateFunc(pKeyData, &ctx, pDst, pSrc, (Ipp64u)len);
+   }
+
+   AES_GCM_GET_TAG(pKey)(pKeyData, &ctx, pTag, (Ipp64u)tagLen);
+
+   /* clear secret data */
+   PurgeBlock(&ctx, sizeof(ctx));
+   PurgeBlock(buf, sizeof(buf));
+#else
+   IppsAESSpec* pAES = AESGCM_CIPHER(pKey);
+   RijnCipher encoder = RIJ_ENCODER(pAES);
+   const Ipp8u* pHKey = AESGCM_HKEY(pKey);
+   MulGcm_ hashFunc = AESGCM_HASH(pKey);
+   Auth_ authFunc = AESGCM_AUTH(pKey);
+   /* message state */
+   __ALIGN16 Ipp8u counter[BLOCK_SIZE];
+   __ALIGN16 Ipp8u ecounter0[BLOCK_SIZE];
+   __ALIGN16 Ipp8u ecounter[BLOCK_SIZE];
+   __ALIGN16 Ipp8u ghash[BLOCK_SIZE];
+   __ALIGN16 Ipp8u buf[BLOCK_SIZE];
+   int lenBlks;
+
+   /* IV processing */
+   PadBlock(0, counter, BLOCK_SIZE);
+   if(CTR_POS==ivLen) {
+      /* apply special format if IV length is 12 bytes */
+      CopyBlock(pIV, counter, CTR_POS);
+      counter[15] = 1;
+   }
+   else {
+      Ipp64u ivBitLen = (Ipp64u)ivLen*BYTESIZE;
+      lenBlks = ivLen & (-BLOCK_SIZE);
+      if(lenBlks)
+         authFunc(counter, pIV, lenBlks, pHKey, AesGcmConst_table);
+      if(ivLen-lenBlks) {
+         XorBlock(pIV+lenBlks, counter, counter, ivLen-lenBlks);
+         hashFunc(counter, pHKey, AesGcmConst_table);
+      }
+      /* add IV bit length */
+      PadBlock(0, buf, BLOCK_SIZE-8);
+      U32_TO_HSTRING(buf+8,  IPP_HIDWORD(ivBitLen));
+      U32_TO_HSTRING(buf+12, IPP_LODWORD(ivBitLen));
+      XorBlock16(buf, counter, counter);
+      hashFunc(counter, pHKey, AesGcmConst_table);
+   }
+   #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+   encoder(counter, ecounter0, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+   #else
+   encoder(counter, ecounter0, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+   #endif
+
+   /* AAD processing */
+   PadBlock(0, ghash, BLOCK_SIZE);
+   lenBlks = aadLen & (-BLOCK_SIZE);
+   if(lenBlks)
+      authFunc(ghash, pAAD, lenBlks, pHKey, AesGcmConst_table);
+   if(aadLen-lenBlks) {
+      XorBlock(pAAD+lenBlks, ghash, ghash, aadLen-lenBlks);
+      hashFunc(ghash, pHKey, AesGcmConst_table);
+   }
+
+   /* text processing */
+   IncrementCounter32(counter);
+   #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
+   encoder(counter, ecounter, RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
+   #else
+   encoder(counter, ecounter, RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
+   #endif
+   {
+      Encrypt_ updateFunc = isEncrypt? AESGCM_ENC(pKey) : AESGCM_DEC(pKey);
+      int txtLen = len;
+
+      lenBlks = len & (-BLOCK_SIZE);
+      if(lenBlks) {
+      #if (_AES_PROB_NOISE == _FEATURE_ON_)
+         /* Mistletoe3 mitigation */
+         cpAESNoiseParams *params = (cpAESNoiseParams*)&AESGCM_NOISE_PARAMS(pKey);
+         if (AES_NOISE_LEVEL(params) > 0) {
+            while (lenBlks > 0) {
+               int chunk_size = IPP_MIN(lenBlks, MISTLETOE3_MAX_CHUNK_SIZE);
+               updateFunc(pDst, pSrc, chunk_size, pAES, pHKey, ghash, counter, ecounter);
+               cpAESRandomNoise(NULL,
+                        MISTLETOE3_BASE_NOISE_LEVEL + AES_NOISE_LEVEL(params),
+                        MISTLETOE3_NOISE_RATE,
+                        &AES_NOISE_RAND(params));
+               pSrc += chunk_size;
+               pDst += chunk_size;
+               lenBlks -= chunk_size;
+               len -= chunk_size;
+            }
+         } else
+      #endif
+         {
+            updateFunc(pDst, pSrc, lenBlks, pAES, pHKey, ghash, counter, ecounter);
+            pSrc += lenBlks;
+            pDst += lenBlks;
+            len -= lenBlks;
+         }
+      }
+
+      /* the rest of text, the ciphertext is hashed */
+      if(len) {
+         if(isEncrypt) {
+            XorBlock(pSrc, ecounter, pDst, len);
+            XorBlock(pDst, ghash, ghash, len);
+         }
+         else {
+            XorBlock(pSrc, ghash, ghash, len);
+            XorBlock(pSrc, ecounter, pDst, len);
+         }
+         hashFunc(ghash, pHKey, AesGcmConst_table);
+      }
+
+      /* process lengths of AAD and text */
+      {
+         Ipp64u aadBitLen = (Ipp64u)aadLen*BYTESIZE;
+         Ipp64u txtBitLen = (Ipp64u)txtLen*BYTESIZE;
+         U32_TO_HSTRING(buf,   IPP_HIDWORD(aadBitLen));
+         U32_TO_HSTRING(buf+4, IPP_LODWORD(aadBitLen));
+         U32_TO_HSTRING(buf+8, IPP_HIDWORD(txtBitLen));
+         U32_TO_HSTRING(buf+12,IPP_LODWORD(txtBitLen));
+      }
+      XorBlock16(ghash, buf, ghash);
+      hashFunc(ghash, pHKey, AesGcmConst_table);
+   }
+
+   /* add encrypted initial counter */
+   XorBlock16(ghash, ecounter0, ghash);
+   CopyBlock(ghash, pTag, tagLen);
+
+   /* clear secret data */
+   PurgeBlock(counter, sizeof(counter));
+   PurgeBlock(ecounter0, sizeof(ecounter0));
+   PurgeBlock(ecounter, sizeof(ecounter));
+   PurgeBlock(ghash, sizeof(ghash));
+   PurgeBlock(buf, sizeof(buf));
+#endif /* #if(_IPP32E>=_IPP32E_K0) */
+}
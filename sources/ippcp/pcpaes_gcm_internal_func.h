@@ -38,4 +38,17 @@ IPP_OWN_DECL(void, condNoisedGCMEncryption, (const Ipp8u* pSrc, Ipp8u* pDst, int
 #define condNoisedGCMDecryption OWNAPI(condNoisedGCMDecryption)
 IPP_OWN_DECL(void, condNoisedGCMDecryption, (const Ipp8u* pSrc, Ipp8u* pDst, int ptxt_len, IppsAES_GCMState* pState))
 
+#define cpAES_GCMCompleteIV OWNAPI(cpAES_GCMCompleteIV)
+IPP_OWN_DECL(void, cpAES_GCMCompleteIV, (IppsAES_GCMState* pState))
+
+#define cpAES_GCMProcessV OWNAPI(cpAES_GCMProcessV)
+IPP_OWN_DECL(IppStatus, cpAES_GCMProcessV, (const IppsAES_GCMSegment* pAAD, int numAAD,
+                                           const IppsAES_GCMSegment* pTxt, int numTxt,
+                                           IppsAES_GCMState* pState, int isEncrypt))
+
+#define cpAES_GCMOneShot OWNAPI(cpAES_GCMOneShot)
+IPP_OWN_DECL(void, cpAES_GCMOneShot, (const Ipp8u* pIV, int ivLen, const Ipp8u* pAAD, int aadLen,
+                                     const Ipp8u* pSrc, Ipp8u* pDst, int len, Ipp8u* pTag, int tagLen,
+                                     const IppsAES_GCMState* pKey, int isEncrypt))
+
 #endif /* _PCP_AES_GCM_INTERNAL_FUNC_H */
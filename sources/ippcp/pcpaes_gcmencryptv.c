@@ -0,0 +1,72 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM
+//
+//  Contents:
+//        ippsAES_GCMEncryptV()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcm_internal_func.h"
+
+/*F*
+//    Name: ippsAES_GCMEncryptV
+//
+// Purpose: Encrypts a text given as an array of segments in the GCM mode
+//          (scatter-gather), AAD is given as an array of segments as well.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pState == NULL
+//                            pAAD == NULL, numAAD>0
+//                            pTxt == NULL, numTxt>0
+//                            segment pointer == NULL, segment length >0
+//    ippStsContextMatchErr  !AESGCM_VALID_ID()
+//    ippStsLengthErr         numAAD<0 or numTxt<0
+//                            segment length <0
+//    ippStsScaleRangeErr     total length of AAD or text exceeds the limit
+//    ippStsBadArgErr         illegal sequence call
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pAAD        Pointer to the array of AAD segments (pDst field is not used).
+//    numAAD      Number of AAD segments (it could be 0).
+//    pTxt        Pointer to the array of plaintext/ciphertext segments.
+//    numTxt      Number of text segments (it could be 0).
+//    pState      Pointer to the context
+//
+// Notes:
+//    The result is the same as ippsAES_GCMProcessAAD() called for every AAD segment
+//    followed by ippsAES_GCMEncrypt() called for every text segment.
+//    Segment lengths need not to be multiple of the AES block size.
+//    Each output segment may coincide with its input one, but shall not overlap others.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_GCMEncryptV,(const IppsAES_GCMSegment* pAAD, int numAAD,
+                                       const IppsAES_GCMSegment* pTxt, int numTxt,
+                                       IppsAES_GCMState* pState))
+{
+   return cpAES_GCMProcessV(pAAD, numAAD, pTxt, numTxt, pState, 1);
+}
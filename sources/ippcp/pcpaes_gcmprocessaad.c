@@ -29,6 +29,7 @@
 #include "owncp.h"
 #include "pcpaesm.h"
 #include "pcptool.h"
+#include "pcpaes_gcm_internal_func.h"
 
 #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
 #  include "pcprijtables.h"
@@ -81,57 +82,7 @@ IPPFUN(IppStatus, ippsAES_GCMProcessAAD,(const Ipp8u* pAAD, int aadLen, IppsAES_
    if( GcmIVprocessing==AESGCM_STATE(pState) ) {
       IPP_BADARG_RET(0==AESGCM_IV_LEN(pState), ippStsBadArgErr);
 
-#if(_IPP32E>=_IPP32E_K0)
-      IvFinalize_ ivHashFinalize = AES_GCM_IV_FINALIZE(pState);
-
-      /* complete IV processing */
-      ivHashFinalize(&AES_GCM_KEY_DATA(pState), &AES_GCM_CONTEXT_DATA(pState),
-                     AESGCM_COUNTER(pState), (Ipp64u)AESGCM_BUFLEN(pState), AESGCM_IV_LEN(pState));
-#else
-      /* complete IV processing */
-      if(CTR_POS==AESGCM_IV_LEN(pState)) {
-         /* apply special format if IV length is 12 bytes */
-         AESGCM_COUNTER(pState)[12] = 0;
-         AESGCM_COUNTER(pState)[13] = 0;
-         AESGCM_COUNTER(pState)[14] = 0;
-         AESGCM_COUNTER(pState)[15] = 1;
-      } else {
-         /* get method */
-         MulGcm_ hashFunc = AESGCM_HASH(pState);
-
-         /* process the rest of IV */
-         if(AESGCM_BUFLEN(pState))
-            hashFunc(AESGCM_COUNTER(pState), AESGCM_HKEY(pState), AesGcmConst_table);
-
-         /* add IV bit length */
-         {
-            Ipp64u ivBitLen = AESGCM_IV_LEN(pState)*BYTESIZE;
-            Ipp8u tmp[BLOCK_SIZE];
-            PadBlock(0, tmp, BLOCK_SIZE-8);
-            U32_TO_HSTRING(tmp+8,  IPP_HIDWORD(ivBitLen));
-            U32_TO_HSTRING(tmp+12, IPP_LODWORD(ivBitLen));
-            XorBlock16(tmp, AESGCM_COUNTER(pState), AESGCM_COUNTER(pState));
-            hashFunc(AESGCM_COUNTER(pState), AESGCM_HKEY(pState), AesGcmConst_table);
-         }
-      }
-
-      /* prepare initial counter */
-      {
-         IppsAESSpec* pAES = AESGCM_CIPHER(pState);
-         RijnCipher encoder = RIJ_ENCODER(pAES);
-         //encoder((Ipp32u*)AESGCM_COUNTER(pState), (Ipp32u*)AESGCM_ECOUNTER0(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), (const Ipp32u (*)[256])RIJ_ENC_SBOX(pAES));
-         #if (_ALG_AES_SAFE_==_ALG_AES_SAFE_COMPACT_SBOX_)
-         encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER0(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), RijEncSbox/*NULL*/);
-         #else
-         encoder(AESGCM_COUNTER(pState), AESGCM_ECOUNTER0(pState), RIJ_NR(pAES), RIJ_EKEYS(pAES), NULL);
-         #endif
-      }
-#endif /* #if(_IPP32E>=_IPP32E_K0) */
-
-      /* switch mode and init counters */
-      AESGCM_STATE(pState) = GcmAADprocessing;
-      AESGCM_AAD_LEN(pState) = CONST_64(0);
-      AESGCM_BUFLEN(pState) = 0;
+      cpAES_GCMCompleteIV(pState);
    }
 
    /*
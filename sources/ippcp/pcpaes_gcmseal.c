@@ -0,0 +1,104 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM
+//
+//  Contents:
+//        ippsAES_GCMSeal()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcm_internal_func.h"
+
+#if(_IPP32E>=_IPP32E_K0)
+#include "pcpaesauthgcm_avx512.h"
+#else
+#include "pcpaesauthgcm.h"
+#endif /* #if(_IPP32E>=_IPP32E_K0) */
+
+/*F*
+//    Name: ippsAES_GCMSeal
+//
+// Purpose: One-shot authenticated encryption of a message in the GCM mode.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pKey == NULL
+//                            pIV == NULL
+//                            pAAD == NULL, aadLen>0
+//                            pSrc == NULL or pDst == NULL, len>0
+//                            pTag == NULL
+//    ippStsContextMatchErr  !AESGCM_VALID_ID()
+//    ippStsLengthErr         ivLen<1
+//                            aadLen<0
+//                            len<0
+//                            tagLen<=0 or tagLen>16
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pIV         Pointer to the IV.
+//    ivLen       Length of the IV in bytes.
+//    pAAD        Pointer to the AAD.
+//    aadLen      Length of the AAD in bytes (it could be 0).
+//    pSrc        Pointer to plaintext.
+//    pDst        Pointer to ciphertext.
+//    len         Length of the text in bytes (it could be 0).
+//    pTag        Pointer to the output authentication tag.
+//    tagLen      Length of the tag in bytes.
+//    pKey        Pointer to the context initialized by ippsAES_GCMInit().
+//
+// Note:
+//    The context is used as an expanded key (round keys and hash key powers) only
+//    and is never modified: the message state is kept on the stack. So the same
+//    context can be shared by several threads calling ippsAES_GCMSeal/ippsAES_GCMOpen.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_GCMSeal,(const Ipp8u* pIV, int ivLen,
+                                   const Ipp8u* pAAD, int aadLen,
+                                   const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                   Ipp8u* pTag, int tagLen,
+                                   const IppsAES_GCMState* pKey))
+{
+   /* test pKey pointer */
+   IPP_BAD_PTR1_RET(pKey);
+   /* use aligned context */
+   pKey = (IppsAES_GCMState*)( IPP_ALIGNED_PTR(pKey, AESGCM_ALIGNMENT) );
+   /* test state ID */
+   IPP_BADARG_RET(!AESGCM_VALID_ID(pKey), ippStsContextMatchErr);
+
+   /* test IV, AAD and text */
+   IPP_BAD_PTR1_RET(pIV);
+   IPP_BADARG_RET(ivLen<1, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen<0 || len<0, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen && !pAAD, ippStsNullPtrErr);
+   IPP_BADARG_RET(len && !(pSrc && pDst), ippStsNullPtrErr);
+
+   /* test tag */
+   IPP_BAD_PTR1_RET(pTag);
+   IPP_BADARG_RET(tagLen<=0 || tagLen>BLOCK_SIZE, ippStsLengthErr);
+
+   cpAES_GCMOneShot(pIV, ivLen, pAAD, aadLen, pSrc, pDst, len, pTag, tagLen, pKey, 1);
+
+   return ippStsNoErr;
+}
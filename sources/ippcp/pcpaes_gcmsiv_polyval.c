@@ -0,0 +1,279 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV: POLYVAL (RFC 8452)
+//
+//  Contents:
+//        cpPolyvalPrecompute()
+//        cpPolyvalUpdate()
+//
+*/
+
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcmsivstuff.h"
+
+/*
+// POLYVAL works in GF(2^128) defined by x^128 + x^127 + x^126 + x^121 + 1,
+// the product is dot(a,b) = a*b*x^(-128). Unlike GHASH the blocks are not bit-reflected,
+// so 128-bit little-endian loads feed carry-less multiplication directly.
+//
+// The reduction is Montgomery-like: two multiplications of the low 64-bit half
+// by 0xC200000000000000 with halves swapping.
+*/
+#define POLYVAL_POLY_HI  (CONST_64(0xC200000000000000))
+
+/* portable constant time implementation */
+static void clmul64(Ipp64u* pLo, Ipp64u* pHi, Ipp64u a, Ipp64u b)
+{
+   Ipp64u lo = 0;
+   Ipp64u hi = 0;
+   int i;
+   for(i=0; i<64; i++) {
+      Ipp64u mask = (Ipp64u)0 - ((b>>i) & 1);
+      lo ^= (a<<i) & mask;
+      hi ^= ((a>>1)>>(63-i)) & mask;
+   }
+   *pLo = lo;
+   *pHi = hi;
+}
+
+static void polyvalMul_c(Ipp64u r[2], const Ipp64u a[2], const Ipp64u b[2])
+{
+   Ipp64u l0, l1, h0, h1, m0, m1, t0, t1, x;
+
+   /* 256-bit product (h1:h0:l1:l0) */
+   clmul64(&l0, &l1, a[0], b[0]);
+   clmul64(&h0, &h1, a[1], b[1]);
+   clmul64(&m0, &m1, a[0], b[1]);
+   clmul64(&t0, &t1, a[1], b[0]);
+   m0 ^= t0;
+   m1 ^= t1;
+   l1 ^= m0;
+   h0 ^= m1;
+
+   /* reduction */
+   clmul64(&t0, &t1, l0, POLYVAL_POLY_HI);
+   x  = l1 ^ t0;
+   l1 = l0 ^ t1;
+   l0 = x;
+   clmul64(&t0, &t1, l0, POLYVAL_POLY_HI);
+   x  = l1 ^ t0;
+   l1 = l0 ^ t1;
+   l0 = x;
+
+   r[0] = h0 ^ l0;
+   r[1] = h1 ^ l1;
+}
+
+static void polyvalLoad_c(Ipp64u x[2], const Ipp8u* p)
+{
+   int n;
+   x[0] = x[1] = 0;
+   for(n=7; n>=0; n--) {
+      x[0] = (x[0]<<8) | p[n];
+      x[1] = (x[1]<<8) | p[n+8];
+   }
+}
+
+static void polyvalStore_c(Ipp8u* p, const Ipp64u x[2])
+{
+   int n;
+   for(n=0; n<8; n++) {
+      p[n]   = (Ipp8u)(x[0] >> (n*8));
+      p[n+8] = (Ipp8u)(x[1] >> (n*8));
+   }
+}
+
+#if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+
+__IPPCP_INLINE __m128i polyvalReduce(__m128i lo, __m128i hi)
+{
+   const __m128i poly = _mm_set_epi64x((Ipp64s)POLYVAL_POLY_HI, 1);
+   __m128i t;
+
+   t  = _mm_clmulepi64_si128(lo, poly, 0x10);
+   lo = _mm_shuffle_epi32(lo, 78);
+   lo = _mm_xor_si128(lo, t);
+   t  = _mm_clmulepi64_si128(lo, poly, 0x10);
+   lo = _mm_shuffle_epi32(lo, 78);
+   lo = _mm_xor_si128(lo, t);
+
+   return _mm_xor_si128(hi, lo);
+}
+
+__IPPCP_INLINE __m128i polyvalMul_clmul(__m128i a, __m128i b)
+{
+   __m128i lo  = _mm_clmulepi64_si128(a, b, 0x00);
+   __m128i hi  = _mm_clmulepi64_si128(a, b, 0x11);
+   __m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x01), _mm_clmulepi64_si128(a, b, 0x10));
+   lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+   hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+   return polyvalReduce(lo, hi);
+}
+
+/* absorbs nBlks<=16 blocks: block i is multiplied by H^(nBlks-i), single reduction */
+__IPPCP_INLINE __m128i polyvalBlocks_clmul(__m128i acc, const Ipp8u* pSrc, int nBlks, const Ipp8u* pHtbl)
+{
+   const Ipp8u* pH = pHtbl + (POLYVAL_NPOWERS-nBlks)*MBS_RIJ128;
+   __m128i lo = _mm_setzero_si128();
+   __m128i hi = _mm_setzero_si128();
+   __m128i mid = _mm_setzero_si128();
+   int n;
+
+   for(n=0; n<nBlks; n++) {
+      __m128i x = _mm_loadu_si128((const __m128i*)(pSrc + n*MBS_RIJ128));
+      __m128i h = _mm_loadu_si128((const __m128i*)(pH + n*MBS_RIJ128));
+      if(0==n)
+         x = _mm_xor_si128(x, acc);
+      lo  = _mm_xor_si128(lo, _mm_clmulepi64_si128(x, h, 0x00));
+      hi  = _mm_xor_si128(hi, _mm_clmulepi64_si128(x, h, 0x11));
+      mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(x, h, 0x01));
+      mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(x, h, 0x10));
+   }
+   lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+   hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+   return polyvalReduce(lo, hi);
+}
+#endif /* _IPP_P8, _IPP32E_Y8 */
+
+#if (_IPP32E>=_IPP32E_K1)
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+#pragma warning(disable: 4310) // cast truncates constant value in MSVC
+#endif
+
+__IPPCP_INLINE __m128i xorLanes512(__m512i x)
+{
+   __m256i t = _mm256_xor_si256(_mm512_castsi512_si256(x), _mm512_extracti64x4_epi64(x, 1));
+   return _mm_xor_si128(_mm256_castsi256_si128(t), _mm256_extracti128_si256(t, 1));
+}
+
+/* absorbs 16-block chunks: 4 blocks per register, single reduction per chunk */
+static __m128i polyvalBlocks16_vclmul(__m128i acc, const Ipp8u* pSrc, int nChunks, const Ipp8u* pHtbl)
+{
+   const __m512i h0 = _mm512_loadu_si512(pHtbl + 0*4*MBS_RIJ128);  /* H^16..H^13 */
+   const __m512i h1 = _mm512_loadu_si512(pHtbl + 1*4*MBS_RIJ128);  /* H^12..H^9  */
+   const __m512i h2 = _mm512_loadu_si512(pHtbl + 2*4*MBS_RIJ128);  /* H^8 ..H^5  */
+   const __m512i h3 = _mm512_loadu_si512(pHtbl + 3*4*MBS_RIJ128);  /* H^4 ..H^1  */
+
+   for(; nChunks>0; nChunks--, pSrc += POLYVAL_NPOWERS*MBS_RIJ128) {
+      __m512i x0 = _mm512_xor_si512(_mm512_loadu_si512(pSrc), _mm512_zextsi128_si512(acc));
+      __m512i x1 = _mm512_loadu_si512(pSrc + 1*4*MBS_RIJ128);
+      __m512i x2 = _mm512_loadu_si512(pSrc + 2*4*MBS_RIJ128);
+      __m512i x3 = _mm512_loadu_si512(pSrc + 3*4*MBS_RIJ128);
+
+      __m512i lo = _mm512_clmulepi64_epi128(x0, h0, 0x00);
+      __m512i hi = _mm512_clmulepi64_epi128(x0, h0, 0x11);
+      __m512i mid = _mm512_xor_si512(_mm512_clmulepi64_epi128(x0, h0, 0x01), _mm512_clmulepi64_epi128(x0, h0, 0x10));
+
+      lo  = _mm512_ternarylogic_epi64(lo,  _mm512_clmulepi64_epi128(x1, h1, 0x00), _mm512_clmulepi64_epi128(x2, h2, 0x00), 0x96);
+      hi  = _mm512_ternarylogic_epi64(hi,  _mm512_clmulepi64_epi128(x1, h1, 0x11), _mm512_clmulepi64_epi128(x2, h2, 0x11), 0x96);
+      mid = _mm512_ternarylogic_epi64(mid, _mm512_clmulepi64_epi128(x1, h1, 0x01), _mm512_clmulepi64_epi128(x1, h1, 0x10), 0x96);
+      mid = _mm512_ternarylogic_epi64(mid, _mm512_clmulepi64_epi128(x2, h2, 0x01), _mm512_clmulepi64_epi128(x2, h2, 0x10), 0x96);
+      lo  = _mm512_xor_si512(lo, _mm512_clmulepi64_epi128(x3, h3, 0x00));
+      hi  = _mm512_xor_si512(hi, _mm512_clmulepi64_epi128(x3, h3, 0x11));
+      mid = _mm512_ternarylogic_epi64(mid, _mm512_clmulepi64_epi128(x3, h3, 0x01), _mm512_clmulepi64_epi128(x3, h3, 0x10), 0x96);
+
+      /* fold middle parts, then lanes */
+      lo = _mm512_xor_si512(lo, _mm512_bslli_epi128(mid, 8));
+      hi = _mm512_xor_si512(hi, _mm512_bsrli_epi128(mid, 8));
+
+      acc = polyvalReduce(xorLanes512(lo), xorLanes512(hi));
+   }
+   return acc;
+}
+#endif /* _IPP32E_K1 */
+
+/*
+// Precomputes H^16, H^15, ..., H^1
+*/
+IPP_OWN_DEFN (void, cpPolyvalPrecompute, (Ipp8u* pHtbl, const Ipp8u* pH))
+{
+   Ipp8u* pPwr = pHtbl + (POLYVAL_NPOWERS-1)*MBS_RIJ128;
+   CopyBlock16(pH, pPwr);
+
+#if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   if(IsFeatureEnabled(ippCPUID_CLMUL)) {
+      __m128i h = _mm_loadu_si128((const __m128i*)pH);
+      __m128i hPwr = h;
+      for(; pPwr>pHtbl; pPwr -= MBS_RIJ128) {
+         hPwr = polyvalMul_clmul(hPwr, h);
+         _mm_storeu_si128((__m128i*)(pPwr-MBS_RIJ128), hPwr);
+      }
+   }
+   else
+#endif
+   {
+      Ipp64u h[2], hPwr[2];
+      polyvalLoad_c(h, pH);
+      polyvalLoad_c(hPwr, pH);
+      for(; pPwr>pHtbl; pPwr -= MBS_RIJ128) {
+         polyvalMul_c(hPwr, hPwr, h);
+         polyvalStore_c(pPwr-MBS_RIJ128, hPwr);
+      }
+   }
+}
+
+/*
+// Updates POLYVAL accumulator by len (multiple of 16) bytes
+*/
+IPP_OWN_DEFN (void, cpPolyvalUpdate, (Ipp8u* pAcc, const Ipp8u* pSrc, int len, const Ipp8u* pHtbl))
+{
+   int nBlks = len/MBS_RIJ128;
+
+#if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   if(IsFeatureEnabled(ippCPUID_CLMUL)) {
+      __m128i acc = _mm_loadu_si128((const __m128i*)pAcc);
+
+      #if (_IPP32E>=_IPP32E_K1)
+      if(IsFeatureEnabled(ippCPUID_AVX512VCLMUL) && nBlks>=POLYVAL_NPOWERS) {
+         int nChunks = nBlks/POLYVAL_NPOWERS;
+         acc = polyvalBlocks16_vclmul(acc, pSrc, nChunks, pHtbl);
+         pSrc += nChunks*POLYVAL_NPOWERS*MBS_RIJ128;
+         nBlks -= nChunks*POLYVAL_NPOWERS;
+      }
+      #endif
+
+      while(nBlks) {
+         int n = IPP_MIN(nBlks, POLYVAL_NPOWERS);
+         acc = polyvalBlocks_clmul(acc, pSrc, n, pHtbl);
+         pSrc += n*MBS_RIJ128;
+         nBlks -= n;
+      }
+      _mm_storeu_si128((__m128i*)pAcc, acc);
+   }
+   else
+#endif
+   {
+      const Ipp8u* pH = pHtbl + (POLYVAL_NPOWERS-1)*MBS_RIJ128;
+      Ipp64u acc[2], h[2], x[2];
+      polyvalLoad_c(acc, pAcc);
+      polyvalLoad_c(h, pH);
+      for(; nBlks>0; nBlks--, pSrc += MBS_RIJ128) {
+         polyvalLoad_c(x, pSrc);
+         acc[0] ^= x[0];
+         acc[1] ^= x[1];
+         polyvalMul_c(acc, acc, h);
+      }
+      polyvalStore_c(pAcc, acc);
+   }
+}
@@ -0,0 +1,130 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV Functions (RFC 8452)
+//
+//  Contents:
+//        ippsAES_GCM_SIVDecrypt()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpmask_ct.h"
+#include "pcpaes_gcmsivstuff.h"
+
+/*F*
+//    Name: ippsAES_GCM_SIVDecrypt
+//
+// Purpose: RFC 8452 nonce misuse-resistant authenticated decryption
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSrc==NULL or pDst==NULL, len>0
+//                            pAuthPassed == NULL
+//                            pKey == NULL
+//                            pNonce == NULL
+//                            pAAD == NULL, aadLen>0
+//                            pTag == NULL
+//    ippStsLengthErr         keyLen != 16 and keyLen != 32
+//                            nonceLen != 12
+//                            len<0
+//                            aadLen<0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc        pointer to ciphertext
+//    pDst        pointer to plaintext
+//    len         length (in bytes) of ciphertext/plaintext (it could be 0)
+//    pAuthPassed pointer to authentication result: 1 if passed, 0 otherwise
+//    pKey        pointer to the key-generating key
+//    keyLen      length of the key (in bytes)
+//    pNonce      pointer to the nonce
+//    nonceLen    length of the nonce (in bytes)
+//    pAAD        pointer to the additional authenticated data
+//    aadLen      length of the AAD (in bytes)
+//    pTag        pointer to the 16-byte tag
+//
+// Note:
+//    If authentication fails, the output buffer is zeroized.
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_GCM_SIVDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                          int* pAuthPassed,
+                                          const Ipp8u* pKey, int keyLen,
+                                          const Ipp8u* pNonce, int nonceLen,
+                                          const Ipp8u* pAAD, int aadLen,
+                                          const Ipp8u* pTag))
+{
+   /* test ciphertext, plaintext and length */
+   IPP_BADARG_RET(0>len, ippStsLengthErr);
+   IPP_BADARG_RET(len && !(pSrc && pDst), ippStsNullPtrErr);
+
+   /* test result */
+   IPP_BAD_PTR1_RET(pAuthPassed);
+
+   /* test key & keyLen */
+   IPP_BAD_PTR1_RET(pKey);
+   IPP_BADARG_RET(keyLen!=16 && keyLen!=32, ippStsLengthErr);
+
+   /* test nonce */
+   IPP_BAD_PTR1_RET(pNonce);
+   IPP_BADARG_RET(GCMSIV_NONCE_LEN!=nonceLen, ippStsLengthErr);
+
+   /* test AAD */
+   IPP_BADARG_RET(0>aadLen, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen && !pAAD, ippStsNullPtrErr);
+
+   /* test input tag */
+   IPP_BAD_PTR1_RET(pTag);
+
+   {
+      Ipp8u authKey[MBS_RIJ128];
+      Ipp8u tag[GCMSIV_TAG_LEN];
+
+      /* AES context */
+      Ipp8u aesBlob[sizeof(IppsAESSpec)];
+      IppsAESSpec* paesCtx = (IppsAESSpec*)aesBlob;
+
+      /* per-nonce keys */
+      cpAES_GCMSIV_DeriveKeys(authKey, paesCtx, pKey, keyLen, pNonce);
+
+      /* perform AES-CTR decryption, the received tag is the initial counter */
+      if(len)
+         cpAES_GCMSIV_CTR(pSrc, pDst, len, pTag, paesCtx);
+
+      /* re-compute tag over the plaintext */
+      cpAES_GCMSIV_Tag(tag, pAAD, aadLen, pDst, len, pNonce, authKey, paesCtx);
+
+      /* test */
+      *pAuthPassed = (int)(cpIsEquBlock_ct(tag, pTag, GCMSIV_TAG_LEN) & 1);
+
+      /* do not release unauthenticated plaintext */
+      if(!*pAuthPassed && len)
+         PurgeBlock(pDst, len);
+
+      PurgeBlock(authKey, sizeof(authKey));
+      PurgeBlock(tag, sizeof(tag));
+      PurgeBlock(&aesBlob, sizeof(aesBlob));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,114 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV Functions (RFC 8452)
+//
+//  Contents:
+//        ippsAES_GCM_SIVEncrypt()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+#include "pcpaes_gcmsivstuff.h"
+
+/*F*
+//    Name: ippsAES_GCM_SIVEncrypt
+//
+// Purpose: RFC 8452 nonce misuse-resistant authenticated encryption
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSrc==NULL or pDst==NULL, len>0
+//                            pTag == NULL
+//                            pKey == NULL
+//                            pNonce == NULL
+//                            pAAD == NULL, aadLen>0
+//    ippStsLengthErr         keyLen != 16 and keyLen != 32
+//                            nonceLen != 12
+//                            len<0
+//                            aadLen<0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc     pointer to plaintext
+//    pDst     pointer to ciphertext
+//    len      length (in bytes) of plaintext/ciphertext (it could be 0)
+//    pTag     pointer to the output 16-byte tag
+//    pKey     pointer to the key-generating key
+//    keyLen   length of the key (in bytes)
+//    pNonce   pointer to the nonce
+//    nonceLen length of the nonce (in bytes)
+//    pAAD     pointer to the additional authenticated data
+//    aadLen   length of the AAD (in bytes)
+//
+*F*/
+IPPFUN(IppStatus, ippsAES_GCM_SIVEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                                Ipp8u* pTag,
+                                          const Ipp8u* pKey, int keyLen,
+                                          const Ipp8u* pNonce, int nonceLen,
+                                          const Ipp8u* pAAD, int aadLen))
+{
+   /* test plaintext, ciphertext and length */
+   IPP_BADARG_RET(0>len, ippStsLengthErr);
+   IPP_BADARG_RET(len && !(pSrc && pDst), ippStsNullPtrErr);
+
+   /* test key & keyLen */
+   IPP_BAD_PTR1_RET(pKey);
+   IPP_BADARG_RET(keyLen!=16 && keyLen!=32, ippStsLengthErr);
+
+   /* test nonce */
+   IPP_BAD_PTR1_RET(pNonce);
+   IPP_BADARG_RET(GCMSIV_NONCE_LEN!=nonceLen, ippStsLengthErr);
+
+   /* test AAD */
+   IPP_BADARG_RET(0>aadLen, ippStsLengthErr);
+   IPP_BADARG_RET(aadLen && !pAAD, ippStsNullPtrErr);
+
+   /* test output tag */
+   IPP_BAD_PTR1_RET(pTag);
+
+   {
+      Ipp8u authKey[MBS_RIJ128];
+      Ipp8u tag[GCMSIV_TAG_LEN];
+
+      /* AES context */
+      Ipp8u aesBlob[sizeof(IppsAESSpec)];
+      IppsAESSpec* paesCtx = (IppsAESSpec*)aesBlob;
+
+      /* per-nonce keys */
+      cpAES_GCMSIV_DeriveKeys(authKey, paesCtx, pKey, keyLen, pNonce);
+
+      /* tag over the plaintext */
+      cpAES_GCMSIV_Tag(tag, pAAD, aadLen, pSrc, len, pNonce, authKey, paesCtx);
+
+      /* perform AES-CTR encryption, the tag is the initial counter */
+      if(len)
+         cpAES_GCMSIV_CTR(pSrc, pDst, len, tag, paesCtx);
+
+      CopyBlock16(tag, pTag);
+
+      PurgeBlock(authKey, sizeof(authKey));
+      PurgeBlock(&aesBlob, sizeof(aesBlob));
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,181 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-GCM-SIV Functions (RFC 8452)
+//
+//  Contents:
+//        Stuff()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpaesm.h"
+#include "pcptool.h"
+
+#if !defined(_PCP_AES_GCMSIV_STUFF_H_)
+#define _PCP_AES_GCMSIV_STUFF_H_
+
+#define GCMSIV_NONCE_LEN   (12)                /* nonce length (bytes) */
+#define GCMSIV_TAG_LEN     (MBS_RIJ128)        /* tag length (bytes) */
+#define POLYVAL_NPOWERS    (16)                /* number of precomputed hash key powers */
+#define GCMSIV_CTR_BLKS    (64)                /* number of counter blocks encrypted by one ECB call */
+
+/*
+// POLYVAL (RFC 8452, p.3)
+//    pHtbl[] = {H^16, H^15, ..., H^1} (POLYVAL products), 16 bytes each
+//    cpPolyvalUpdate() absorbs len (multiple of 16) bytes into the accumulator
+*/
+#define cpPolyvalPrecompute OWNAPI(cpPolyvalPrecompute)
+   IPP_OWN_DECL (void, cpPolyvalPrecompute, (Ipp8u* pHtbl, const Ipp8u* pH))
+#define cpPolyvalUpdate OWNAPI(cpPolyvalUpdate)
+   IPP_OWN_DECL (void, cpPolyvalUpdate, (Ipp8u* pAcc, const Ipp8u* pSrc, int len, const Ipp8u* pHtbl))
+
+/* absorbs arbitrary length data, the last partial block is zero padded */
+__IPPCP_INLINE void cpPolyvalUpdatePad(Ipp8u* pAcc, const Ipp8u* pSrc, int len, const Ipp8u* pHtbl)
+{
+   int lenBlks = len & (-MBS_RIJ128);
+   if(lenBlks)
+      cpPolyvalUpdate(pAcc, pSrc, lenBlks, pHtbl);
+   if(len-lenBlks) {
+      Ipp8u blk[MBS_RIJ128];
+      FillBlock16(0, pSrc+lenBlks, blk, len-lenBlks);
+      cpPolyvalUpdate(pAcc, blk, MBS_RIJ128, pHtbl);
+      PurgeBlock(blk, sizeof(blk));
+   }
+}
+
+/*
+// derives message authentication and encryption keys from the key-generating key and nonce
+// (RFC 8452, p.4): the 4 (or 6) key blocks are encrypted by a single ECB call
+*/
+__IPPCP_INLINE void cpAES_GCMSIV_DeriveKeys(Ipp8u authKey[MBS_RIJ128], IppsAESSpec* pEncAES,
+                                            const Ipp8u* pKey, int keyLen, const Ipp8u* pNonce)
+{
+   __ALIGN16 Ipp8u blocks[6*MBS_RIJ128];
+   Ipp8u encKey[32];
+   int nBlocks = 2 + keyLen/8;
+   int n;
+
+   for(n=0; n<nBlocks; n++) {
+      Ipp8u* pBlk = blocks + n*MBS_RIJ128;
+      pBlk[0] = (Ipp8u)n;
+      pBlk[1] = pBlk[2] = pBlk[3] = 0;
+      CopyBlock(pNonce, pBlk+4, GCMSIV_NONCE_LEN);
+   }
+
+   /* the key-generating key schedule is reused for the message encryption key */
+   ippsAESInit(pKey, keyLen, pEncAES, (int)sizeof(IppsAESSpec));
+   ippsAESEncryptECB(blocks, blocks, nBlocks*MBS_RIJ128, pEncAES);
+
+   /* the first 8 bytes of each block */
+   CopyBlock(blocks,                 authKey,   8);
+   CopyBlock(blocks+MBS_RIJ128,      authKey+8, 8);
+   for(n=2; n<nBlocks; n++)
+      CopyBlock(blocks+n*MBS_RIJ128, encKey+(n-2)*8, 8);
+
+   ippsAESInit(encKey, keyLen, pEncAES, (int)sizeof(IppsAESSpec));
+
+   PurgeBlock(blocks, sizeof(blocks));
+   PurgeBlock(encKey, sizeof(encKey));
+}
+
+/*
+// computes the tag: POLYVAL over AAD, plaintext and the lengths block,
+// xor with nonce, clear the msb, encrypt by the message encryption key
+*/
+__IPPCP_INLINE void cpAES_GCMSIV_Tag(Ipp8u tag[GCMSIV_TAG_LEN],
+                                     const Ipp8u* pAAD, int aadLen, const Ipp8u* pTxt, int txtLen,
+                                     const Ipp8u* pNonce, const Ipp8u authKey[MBS_RIJ128],
+                                     const IppsAESSpec* pEncAES)
+{
+   __ALIGN16 Ipp8u hTbl[POLYVAL_NPOWERS*MBS_RIJ128];
+   __ALIGN16 Ipp8u S[MBS_RIJ128];
+   Ipp8u lenBlk[MBS_RIJ128];
+   Ipp64u aadBitLen = (Ipp64u)aadLen*BYTESIZE;
+   Ipp64u txtBitLen = (Ipp64u)txtLen*BYTESIZE;
+   int n;
+
+   cpPolyvalPrecompute(hTbl, authKey);
+
+   PadBlock(0, S, MBS_RIJ128);
+   cpPolyvalUpdatePad(S, pAAD, aadLen, hTbl);
+   cpPolyvalUpdatePad(S, pTxt, txtLen, hTbl);
+
+   /* little-endian bit lengths */
+   for(n=0; n<8; n++) {
+      lenBlk[n]   = (Ipp8u)(aadBitLen >> (n*8));
+      lenBlk[n+8] = (Ipp8u)(txtBitLen >> (n*8));
+   }
+   cpPolyvalUpdate(S, lenBlk, MBS_RIJ128, hTbl);
+
+   XorBlock(S, pNonce, S, GCMSIV_NONCE_LEN);
+   S[MBS_RIJ128-1] &= 0x7F;
+
+   ippsAESEncryptECB(S, tag, MBS_RIJ128, pEncAES);
+
+   PurgeBlock(hTbl, sizeof(hTbl));
+   PurgeBlock(S, sizeof(S));
+}
+
+/*
+// AES-CTR with the 32-bit little-endian counter in the first word of the counter block
+// initial counter block is the tag with the msb set
+// counter blocks are encrypted by the pipelined ECB in chunks of GCMSIV_CTR_BLKS blocks
+*/
+__IPPCP_INLINE void cpAES_GCMSIV_CTR(const Ipp8u* pSrc, Ipp8u* pDst, int len,
+                                     const Ipp8u tag[GCMSIV_TAG_LEN], const IppsAESSpec* pEncAES)
+{
+   __ALIGN16 Ipp8u keystream[GCMSIV_CTR_BLKS*MBS_RIJ128];
+   /* part of the keystream buffer to be cleared */
+   int usedLen = (IPP_MIN(len, (int)sizeof(keystream)) + MBS_RIJ128-1) & (-MBS_RIJ128);
+   Ipp32u ctr32;
+   Ipp8u ctrBlk[MBS_RIJ128];
+
+   CopyBlock16(tag, ctrBlk);
+   ctrBlk[MBS_RIJ128-1] |= 0x80;
+   ctr32 = (Ipp32u)ctrBlk[0] | ((Ipp32u)ctrBlk[1]<<8) | ((Ipp32u)ctrBlk[2]<<16) | ((Ipp32u)ctrBlk[3]<<24);
+
+   while(len > 0) {
+      int chunkLen = IPP_MIN(len, GCMSIV_CTR_BLKS*MBS_RIJ128);
+      int nBlocks = (chunkLen + MBS_RIJ128-1)/MBS_RIJ128;
+      int n;
+
+      for(n=0; n<nBlocks; n++, ctr32++) {
+         Ipp8u* pBlk = keystream + n*MBS_RIJ128;
+         CopyBlock16(ctrBlk, pBlk);
+         pBlk[0] = (Ipp8u)ctr32;
+         pBlk[1] = (Ipp8u)(ctr32>>8);
+         pBlk[2] = (Ipp8u)(ctr32>>16);
+         pBlk[3] = (Ipp8u)(ctr32>>24);
+      }
+      ippsAESEncryptECB(keystream, keystream, nBlocks*MBS_RIJ128, pEncAES);
+      XorBlock(pSrc, keystream, pDst, chunkLen);
+
+      pSrc += chunkLen;
+      pDst += chunkLen;
+      len -= chunkLen;
+   }
+
+   PurgeBlock(keystream, usedLen);
+}
+
+#endif /* _PCP_AES_GCMSIV_STUFF_H_ */
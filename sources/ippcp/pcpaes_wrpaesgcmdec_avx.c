@@ -59,17 +59,16 @@
 //    pState      pointer to the context
 //
 *F*/
-IPP_OWN_DEFN (void, wrpAesGcmDec_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int lenBlks, IppsAES_GCMState* pState))
+IPP_OWN_DEFN (void, wrpAesGcmDec_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int lenBlks, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 {
-   IppsAESSpec* pAES = AESGCM_CIPHER(pState);
    RijnCipher encoder = RIJ_ENCODER(pAES);
 
    AesGcmDec_avx(pDst, pSrc, lenBlks,
                  encoder, RIJ_NR(pAES), RIJ_EKEYS(pAES),
-                 AESGCM_GHASH(pState),
-                 AESGCM_COUNTER(pState),
-                 AESGCM_ECOUNTER(pState),
-                 AESGCM_HKEY(pState));
+                 pGhash,
+                 pCounter,
+                 pECounter,
+                 pHKey);
 }
 
 #endif /* (_IPP32E<_IPP32E_K0) */
@@ -35,18 +35,6 @@
 #  include "pcprijtables.h"
 #endif
 
-//
-//
-static void cpAES_XTS_DecBlock(Ipp8u* ctxt, const Ipp8u* ptxt, const Ipp8u* tweak, const IppsAESSpec* pEncCtx)
-{
-   /* pre-whitening */
-   XorBlock16(ptxt, tweak, ctxt);
-   /* encryption */
-   ippsAESDecryptECB(ctxt, ctxt, AES_BLK_SIZE, pEncCtx);
-   /* post-whitening */
-   XorBlock16(ctxt, tweak, ctxt);
-}
-
 /*F*
 //    Name: ippsAES_XTSDecrypt
 //
@@ -104,8 +92,7 @@ IPPFUN(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
          #endif
 
          /* update tweakCT */
-         for(; startCipherBlkNo>0; startCipherBlkNo--)
-            gf_mul_by_primitive(tweakCT);
+         gf_mul_by_primitive_pow(tweakCT, (Ipp64u)startCipherBlkNo);
       }
 
       /* XTS decryption */
@@ -121,13 +108,13 @@ IPPFUN(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
             #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
             /* use Intel(R) AES New Instructions version if possible */
             if(AES_NI_ENABLED==RIJ_AESNI(pdatAES)) {
+               cpAESProcessXTS processXTS = cpAESDecryptXTS_AES_NI;
                #if(_IPP32E>=_IPP32E_K1)
                if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
-                  cpAESDecryptXTS_VAES(pDst, pSrc, encBlocks, RIJ_DKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT);
+                  processXTS = cpAESDecryptXTS_VAES;
                }
-               else
                #endif
-               cpAESDecryptXTS_AES_NI(pDst, pSrc, encBlocks, RIJ_DKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT);
+               cpAESProcessXTS_mt(pDst, pSrc, encBlocks, RIJ_DKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT, processXTS);
                pSrc += encBlocks*AES_BLK_SIZE;
                pDst += encBlocks*AES_BLK_SIZE;
             }
@@ -135,7 +122,7 @@ IPPFUN(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
             #endif
             {
                for(; encBlocks>0; encBlocks--) {
-                  cpAES_XTS_DecBlock(pDst, pSrc, tweakCT, pdatAES);
+                  cpAES_XTS_ProcessBlock(pDst, pSrc, tweakCT, pdatAES, XTS_DECRYPT);
                   gf_mul_by_primitive(tweakCT);
                   pSrc += AES_BLK_SIZE;
                   pDst += AES_BLK_SIZE;
@@ -151,7 +138,7 @@ IPPFUN(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
             __ALIGN16 Ipp8u pp[AES_BLK_SIZE];
             CopyBlock16(tweakCT, cc);
             gf_mul_by_primitive(cc);
-            cpAES_XTS_DecBlock(pp, pSrc, cc, pdatAES);
+            cpAES_XTS_ProcessBlock(pp, pSrc, cc, pdatAES, XTS_DECRYPT);
 
             CopyBlock16(pp, cc);
             CopyBlock(pSrc+AES_BLK_SIZE, cc, partBlockSize);
@@ -166,7 +153,7 @@ IPPFUN(IppStatus, ippsAES_XTSDecrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
                pp[partBlockSize] &= partBlockMask;
                partBlockSize++;
             }
-            cpAES_XTS_DecBlock(pDst, cc, tweakCT, pdatAES);
+            cpAES_XTS_ProcessBlock(pDst, cc, tweakCT, pdatAES, XTS_DECRYPT);
 
             CopyBlock(pp, pDst+AES_BLK_SIZE, partBlockSize);
 
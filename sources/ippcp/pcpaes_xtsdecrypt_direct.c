@@ -142,8 +142,7 @@ IPPFUN(IppStatus, ippsAESDecryptXTS_Direct,(const Ipp8u* pSrc, Ipp8u* pDst, int
          sts = ippsAESInit(pConfKey, keySize, &aesCtx, sizeof(aesCtx));
          if(ippStsNoErr!=sts) break;
 
-         for(; aesBlkNo>0; aesBlkNo--)
-            gf_mul_by_primitive(tweakCT);
+         gf_mul_by_primitive_pow(tweakCT, (Ipp64u)aesBlkNo);
 
          if(encBlocklast) encBlocks--;
 
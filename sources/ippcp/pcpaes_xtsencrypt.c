@@ -35,16 +35,6 @@
 #  include "pcprijtables.h"
 #endif
 
-static void cpAES_XTS_EncBlock(Ipp8u* ctxt, const Ipp8u* ptxt, const Ipp8u* tweak, const IppsAESSpec* pEncCtx)
-{
-   /* pre-whitening */
-   XorBlock16(ptxt, tweak, ctxt);
-   /* encryption */
-   ippsAESEncryptECB(ctxt, ctxt, AES_BLK_SIZE, pEncCtx);
-   /* post-whitening */
-   XorBlock16(ctxt, tweak, ctxt);
-}
-
 /*F*
 //    Name: ippsAES_XTSEncrypt
 //
@@ -102,8 +92,7 @@ IPPFUN(IppStatus, ippsAES_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
          #endif
 
          /* update tweakCT */
-         for(; startCipherBlkNo>0; startCipherBlkNo--)
-            gf_mul_by_primitive(tweakCT);
+         gf_mul_by_primitive_pow(tweakCT, (Ipp64u)startCipherBlkNo);
       }
 
       /* XTS encryption */
@@ -119,13 +108,13 @@ IPPFUN(IppStatus, ippsAES_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
             #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
             /* use Intel(R) AES New Instructions version if possible */
             if(AES_NI_ENABLED==RIJ_AESNI(pdatAES)) {
+               cpAESProcessXTS processXTS = cpAESEncryptXTS_AES_NI;
                #if(_IPP32E>=_IPP32E_K1)
                if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
-                  cpAESEncryptXTS_VAES(pDst, pSrc, encBlocks, RIJ_EKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT);
+                  processXTS = cpAESEncryptXTS_VAES;
                }
-               else
                #endif
-               cpAESEncryptXTS_AES_NI(pDst, pSrc, encBlocks, RIJ_EKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT);
+               cpAESProcessXTS_mt(pDst, pSrc, encBlocks, RIJ_EKEYS(pdatAES), RIJ_NR(pdatAES), tweakCT, processXTS);
                pSrc += encBlocks*AES_BLK_SIZE;
                pDst += encBlocks*AES_BLK_SIZE;
             }
@@ -133,7 +122,7 @@ IPPFUN(IppStatus, ippsAES_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
             #endif
             {
                for(; encBlocks>0; encBlocks--) {
-                  cpAES_XTS_EncBlock(pDst, pSrc, tweakCT, pdatAES);
+                  cpAES_XTS_ProcessBlock(pDst, pSrc, tweakCT, pdatAES, XTS_ENCRYPT);
                   gf_mul_by_primitive(tweakCT);
                   pSrc += AES_BLK_SIZE;
                   pDst += AES_BLK_SIZE;
@@ -147,7 +136,7 @@ IPPFUN(IppStatus, ippsAES_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
 
             __ALIGN16 Ipp8u cc[AES_BLK_SIZE];
             __ALIGN16 Ipp8u pp[AES_BLK_SIZE];
-            cpAES_XTS_EncBlock(cc, pSrc, tweakCT, pdatAES);
+            cpAES_XTS_ProcessBlock(cc, pSrc, tweakCT, pdatAES, XTS_ENCRYPT);
             gf_mul_by_primitive(tweakCT);
 
             CopyBlock16(cc, pp);
@@ -163,7 +152,7 @@ IPPFUN(IppStatus, ippsAES_XTSEncrypt,(const Ipp8u* pSrc, Ipp8u* pDst, int bitLen
                cc[partBlockSize] &= partBlockMask;
                partBlockSize++;
             }
-            cpAES_XTS_EncBlock(pDst, pp, tweakCT, pdatAES);
+            cpAES_XTS_ProcessBlock(pDst, pp, tweakCT, pdatAES, XTS_ENCRYPT);
 
             CopyBlock(cc, pDst+AES_BLK_SIZE, partBlockSize);
          }
@@ -0,0 +1,155 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     AES-XTS Functions (IEEE P1619)
+//
+//  Contents:
+//        ippsAES_XTSEncryptDataUnits()
+//
+*/
+
+#include "owncp.h"
+#include "pcpaesmxts.h"
+#include "pcptool.h"
+#include "pcpaesmxtsstuff.h"
+
+/* encrypt nDUs whole-block data units of duBlocks blocks with given (encrypted) tweaks */
+static void cpAES_XTS_EncDataUnits(Ipp8u* pDst, const Ipp8u* pSrc, int nDUs, int duBlocks,
+                                   Ipp8u* pTweaks, const IppsAESSpec* pdatAES)
+{
+   #if (_IPP>=_IPP_P8) || (_IPP32E>=_IPP32E_Y8)
+   /* use Intel(R) AES New Instructions version if possible */
+   if(AES_NI_ENABLED==RIJ_AESNI(pdatAES)) {
+      cpAESProcessXTS processXTS = cpAESEncryptXTS_AES_NI;
+      #if(_IPP32E>=_IPP32E_K1)
+      if (IsFeatureEnabled(ippCPUID_AVX512VAES)) {
+         processXTS = cpAESEncryptXTS_VAES;
+      }
+      #endif
+      for(; nDUs>0; nDUs--, pTweaks+=AES_BLK_SIZE) {
+         processXTS(pDst, pSrc, duBlocks, RIJ_EKEYS(pdatAES), RIJ_NR(pdatAES), pTweaks);
+         pSrc += duBlocks*AES_BLK_SIZE;
+         pDst += duBlocks*AES_BLK_SIZE;
+      }
+   }
+   else
+   #endif
+   {
+      for(; nDUs>0; nDUs--, pTweaks+=AES_BLK_SIZE) {
+         int n;
+         for(n=0; n<duBlocks; n++) {
+            cpAES_XTS_ProcessBlock(pDst, pSrc, pTweaks, pdatAES, XTS_ENCRYPT);
+            gf_mul_by_primitive(pTweaks);
+            pSrc += AES_BLK_SIZE;
+            pDst += AES_BLK_SIZE;
+         }
+      }
+   }
+}
+
+/*F*
+//    Name: ippsAES_XTSEncryptDataUnits
+//
+// Purpose: AES-XTS encryption of several consecutive data units.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSrc == NULL
+//                            pDst == NULL
+//                            pCtx == NULL
+//    ippStsLengthErr         numDUs <1
+//                            data unit size <128 bits
+//    ippStsContextMatchErr   !VALID_AES_XTS_ID(pCtx)
+//    ippStsBadArgErr         data unit size is not a multiple of 8 bits
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSrc              points input buffer (numDUs data units of the context's size)
+//    pDst              points output buffer
+//    numDUs            number of data units (sectors)
+//    startDUNo         sequence number of the first data unit
+//    pCtx              points AES_XTS context
+//
+// Note:
+//    The tweak of data unit startDUNo+k is its sequence number as 128-bit
+//    little-endian value (IEEE P1619), so random-offset access costs the same
+//    as sequential access.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsAES_XTSEncryptDataUnits,(const Ipp8u* pSrc, Ipp8u* pDst, int numDUs,
+                                               Ipp64u startDUNo,
+                                               const IppsAES_XTSSpec* pCtx))
+{
+   /* test pointers */
+   IPP_BAD_PTR1_RET(pCtx);
+   /* test the context ID */
+   IPP_BADARG_RET(!VALID_AES_XTS_ID(pCtx), ippStsContextMatchErr);
+
+   /* test data pointers */
+   IPP_BAD_PTR2_RET(pSrc, pDst);
+
+   /* test number of data units and their size */
+   IPP_BADARG_RET(numDUs < 1, ippStsLengthErr);
+   IPP_BADARG_RET(pCtx->duBitsize % BYTESIZE, ippStsBadArgErr);
+
+   {
+      int duBitsize = pCtx->duBitsize;
+      Ipp64s duSize = duBitsize/BYTESIZE;
+
+      /* data units with partial last block: "stealing" is done by ippsAES_XTSEncrypt */
+      if(duBitsize % IPP_AES_BLOCK_BITSIZE) {
+         __ALIGN16 Ipp64u tweakPT[2];
+         int k;
+         for(k=0; k<numDUs; k++) {
+            IppStatus sts;
+            tweakPT[0] = startDUNo + (Ipp64u)k;
+            tweakPT[1] = (tweakPT[0] < startDUNo);
+            sts = ippsAES_XTSEncrypt(pSrc+k*duSize, pDst+k*duSize, duBitsize, pCtx, (Ipp8u*)tweakPT, 0);
+            IPP_BADARG_RET(ippStsNoErr!=sts, sts);
+         }
+      }
+
+      /* data units are independent and split between threads (single chunk if threading is off) */
+      else {
+         int duBlocks = duBitsize/IPP_AES_BLOCK_BITSIZE;
+         int nThreads = cpNumThreadsForLen((Ipp64s)numDUs*duSize);
+         int t;
+
+         #if defined(_OPENMP)
+         #pragma omp parallel for IPPCP_OMP_LIMIT_MAX_NUM_THREADS(nThreads)
+         #endif
+         for(t=0; t<nThreads; t++) {
+            int firstDU = (int)((Ipp64s)numDUs*t/nThreads);
+            int lastDU  = (int)((Ipp64s)numDUs*(t+1)/nThreads);
+            __ALIGN16 Ipp8u tweaks[AES_DUS_PER_BUFFER*AES_BLK_SIZE];
+
+            while(firstDU < lastDU) {
+               int n = IPP_MIN(lastDU-firstDU, AES_DUS_PER_BUFFER);
+               cpXTSduTweaks(tweaks, n, startDUNo+(Ipp64u)firstDU, &pCtx->tweakAES);
+               cpAES_XTS_EncDataUnits(pDst+firstDU*duSize, pSrc+firstDU*duSize, n, duBlocks, tweaks, &pCtx->datumAES);
+               firstDU += n;
+            }
+         }
+      }
+
+      return ippStsNoErr;
+   }
+}
@@ -77,6 +77,20 @@ struct _cpAES_CCM {
    IPP_OWN_DECL (void, DecryptAuth_RIJ128_AES_NI, (const Ipp8u* inpBlk, Ipp8u* outBlk, int nr, const void* pRKey, Ipp32u len, void* pLocalCtx))
 #endif
 
+/*
+// Message processing with the cipher given explicitly:
+// the state holds per-message data only, so it can be a local one
+// while the expanded key is shared (one-shot ippsAES_CCMSeal/ippsAES_CCMOpen)
+*/
+#define cpAES_CCMStart OWNAPI(cpAES_CCMStart)
+   IPP_OWN_DECL (void, cpAES_CCMStart, (const Ipp8u* pIV, int ivLen, const Ipp8u* pAD, int adLen, IppsAES_CCMState* pState, const IppsAESSpec* pAES))
+#define cpAES_CCMEncrypt OWNAPI(cpAES_CCMEncrypt)
+   IPP_OWN_DECL (void, cpAES_CCMEncrypt, (const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState, const IppsAESSpec* pAES))
+#define cpAES_CCMDecrypt OWNAPI(cpAES_CCMDecrypt)
+   IPP_OWN_DECL (void, cpAES_CCMDecrypt, (const Ipp8u* pSrc, Ipp8u* pDst, int len, IppsAES_CCMState* pState, const IppsAESSpec* pAES))
+#define cpAES_CCMGetTag OWNAPI(cpAES_CCMGetTag)
+   IPP_OWN_DECL (void, cpAES_CCMGetTag, (Ipp8u* pTag, int tagLen, const IppsAES_CCMState* pState, const IppsAESSpec* pAES))
+
 /* Counter block formatter */
 static Ipp8u* CounterEnc(Ipp32u* pBuffer, int fmt, Ipp64u counter)
 {
@@ -40,11 +40,13 @@ IPP_OWN_FUNPTR (void, MulGcm_, (Ipp8u* pGHash, const Ipp8u* pHKey, const void* p
 /* GCM Authentication prototype: GHash = (GHash^src[])*HKey mod G() */
 IPP_OWN_FUNPTR (void, Auth_, (Ipp8u* pHash, const Ipp8u* pSrc, int len, const Ipp8u* pHKey, const void* pParam))
 
-/* GCM Encrypt_Authentication prototype */
-IPP_OWN_FUNPTR (void, Encrypt_, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+/* GCM Encrypt_Authentication prototype:
+// whole blocks are processed with the round keys of pAES and the hash key (powers) pHKey,
+// pGhash, pCounter and pECounter are the message state updated by the kernel */
+IPP_OWN_FUNPTR (void, Encrypt_, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 
 /* GCM Authentication_Decrypt prototype */
-IPP_OWN_FUNPTR (void, Decrypt_, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+IPP_OWN_FUNPTR (void, Decrypt_, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 
 typedef enum {
    GcmInit,
@@ -172,9 +174,9 @@ __IPPCP_INLINE void IncrementCounter32(Ipp8u* pCtr)
 #define AesGcmAuth_avx OWNAPI(AesGcmAuth_avx)
    IPP_OWN_DECL (void, AesGcmAuth_avx, (Ipp8u* pGhash, const Ipp8u* pSrc, int len, const Ipp8u* pHkey, const void* pParam))
 #define wrpAesGcmEnc_avx OWNAPI(wrpAesGcmEnc_avx)
-   IPP_OWN_DECL (void, wrpAesGcmEnc_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+   IPP_OWN_DECL (void, wrpAesGcmEnc_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 #define wrpAesGcmDec_avx OWNAPI(wrpAesGcmDec_avx)
-   IPP_OWN_DECL (void, wrpAesGcmDec_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+   IPP_OWN_DECL (void, wrpAesGcmDec_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 #define AesGcmEnc_avx OWNAPI(AesGcmEnc_avx)
    IPP_OWN_DECL (void, AesGcmEnc_avx, (Ipp8u* pDst, const Ipp8u* pSrc, int len, RijnCipher cipher, int nr, const Ipp8u* pKeys, Ipp8u* pGhash, Ipp8u* pCnt, Ipp8u* pECnt, const Ipp8u* pMuls))
 #define AesGcmDec_avx OWNAPI(AesGcmDec_avx)
@@ -208,15 +210,15 @@ __IPPCP_INLINE void IncrementCounter32(Ipp8u* pCtr)
    IPP_OWN_DECL (void, AesGcmAuth_table2K_ct, (Ipp8u* pGhash, const Ipp8u* pSrc, int len, const Ipp8u* pHkey, const void* pParam))
 
 #define wrpAesGcmEnc_table2K OWNAPI(wrpAesGcmEnc_table2K)
-   IPP_OWN_DECL (void, wrpAesGcmEnc_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+   IPP_OWN_DECL (void, wrpAesGcmEnc_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 #define wrpAesGcmDec_table2K OWNAPI(wrpAesGcmDec_table2K)
-   IPP_OWN_DECL (void, wrpAesGcmDec_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+   IPP_OWN_DECL (void, wrpAesGcmDec_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 
 #if (_IPP==_IPP_H9) || (_IPP32E==_IPP32E_L9)
 #define AesGcmEnc_vaes_avx2 OWNAPI(AesGcmEnc_vaes_avx2)
-   IPP_OWN_DECL (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+   IPP_OWN_DECL (void, AesGcmEnc_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 #define AesGcmDec_vaes_avx2 OWNAPI(AesGcmDec_vaes_avx2)
-   IPP_OWN_DECL (void, AesGcmDec_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pCtx))
+   IPP_OWN_DECL (void, AesGcmDec_vaes_avx2, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 #endif /* #if (_IPP==_IPP_H9) || (_IPP32E==_IPP32E_L9) */
 
 extern const Ipp16u AesGcmConst_table[256];            /* precomputed reduction table */
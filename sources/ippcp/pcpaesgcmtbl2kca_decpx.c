@@ -43,16 +43,12 @@
 /*
 // authenticates and decrypts n*BLOCK_SIZE bytes
 */
-IPP_OWN_DEFN (void, wrpAesGcmDec_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pState))
+IPP_OWN_DEFN (void, wrpAesGcmDec_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 {
-   //AesGcmAuth_table2K(AESGCM_GHASH(pState), pSrc, len, AESGCM_HKEY(pState), AesGcmConst_table);
-   AesGcmAuth_table2K_ct(AESGCM_GHASH(pState), pSrc, len, AESGCM_HKEY(pState), AesGcmConst_table);
+   //AesGcmAuth_table2K(pGhash, pSrc, len, pHKey, AesGcmConst_table);
+   AesGcmAuth_table2K_ct(pGhash, pSrc, len, pHKey, AesGcmConst_table);
 
    {
-      Ipp8u* pCounter = AESGCM_COUNTER(pState);
-      Ipp8u* pECounter = AESGCM_ECOUNTER(pState);
-
-      IppsRijndael128Spec* pAES = AESGCM_CIPHER(pState);
       RijnCipher encoder = RIJ_ENCODER(pAES);
 
       while(len>=BLOCK_SIZE) {
@@ -43,15 +43,11 @@
 /*
 // encrypts and authenticates n*BLOCK_SIZE bytes
 */
-IPP_OWN_DEFN (void, wrpAesGcmEnc_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, IppsAES_GCMState* pState))
+IPP_OWN_DEFN (void, wrpAesGcmEnc_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int len, const IppsAESSpec* pAES, const Ipp8u* pHKey, Ipp8u* pGhash, Ipp8u* pCounter, Ipp8u* pECounter))
 {
    Ipp8u* pHashedData = pDst;
    int hashedDataLen = len;
 
-   Ipp8u* pCounter = AESGCM_COUNTER(pState);
-   Ipp8u* pECounter = AESGCM_ECOUNTER(pState);
-
-   IppsRijndael128Spec* pAES = AESGCM_CIPHER(pState);
    RijnCipher encoder = RIJ_ENCODER(pAES);
 
    while(len>=BLOCK_SIZE) {
@@ -73,8 +69,8 @@ IPP_OWN_DEFN (void, wrpAesGcmEnc_table2K, (Ipp8u* pDst, const Ipp8u* pSrc, int l
       #endif
    }
 
-   //AesGcmAuth_table2K(AESGCM_GHASH(pState), pHashedData, hashedDataLen, AESGCM_HKEY(pState), AesGcmConst_table);
-   AesGcmAuth_table2K_ct(AESGCM_GHASH(pState), pHashedData, hashedDataLen, AESGCM_HKEY(pState), AesGcmConst_table);
+   //AesGcmAuth_table2K(pGhash, pHashedData, hashedDataLen, pHKey, AesGcmConst_table);
+   AesGcmAuth_table2K_ct(pGhash, pHashedData, hashedDataLen, pHKey, AesGcmConst_table);
 }
 
 #endif
@@ -39,6 +39,7 @@
 #endif
 
 #define AES_BLKS_PER_BUFFER (32)
+#define AES_DUS_PER_BUFFER  (32)  /* number of data unit tweaks computed at once */
 
 struct _cpAES_XTS
 {
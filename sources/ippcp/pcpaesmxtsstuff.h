@@ -28,6 +28,7 @@
 
 #include "owncp.h"
 #include "pcpaesm.h"
+#include "pcptool.h"
 
 /*
    multiplication by primirive element alpha (==2)
@@ -48,6 +49,156 @@ __IPPCP_INLINE void gf_mul_by_primitive(void* x)
    x64[1] = (x64[1]+x64[1]) + addH;
 }
 
+/*
+   multiplication over GF(2^128)
+   z = x*y
+
+   LE version, constant time with respect to x and y
+*/
+__IPPCP_INLINE void gf_mul(void* z, const void* x, const void* y)
+{
+   const Ipp64u* x64 = (const Ipp64u*)x;
+   const Ipp64u* y64 = (const Ipp64u*)y;
+   Ipp64u r64[2] = {0, 0};
+   int i;
+   for(i=127; i>=0; i--) {
+      Ipp64u mask = (Ipp64u)0 - ((y64[i>>6] >> (i&63)) & 1);
+      gf_mul_by_primitive(r64);
+      r64[0] ^= x64[0] & mask;
+      r64[1] ^= x64[1] & mask;
+   }
+   ((Ipp64u*)z)[0] = r64[0];
+   ((Ipp64u*)z)[1] = r64[1];
+}
+
+/*
+   multiplication by n-th power of primitive element: x = x*alpha^n
+
+   the low bits of n are processed by gf_mul_by_primitive(), the rest by multiplications
+   by precomputed alpha^(2^i), so the cost is O(log n); n is not a secret
+*/
+#define GF_POW_SHIFT_BITS  (6)
+
+__IPPCP_INLINE void gf_mul_by_primitive_pow(void* x, Ipp64u n)
+{
+   /* alpha^(2^i), i = GF_POW_SHIFT_BITS, ..., 63 */
+   static const Ipp64u alphaPow[64-GF_POW_SHIFT_BITS][2] = {
+      {CONST_64(0x0000000000000000), CONST_64(0x0000000000000001)}, /* alpha^(2^6) */
+      {CONST_64(0x0000000000000087), CONST_64(0x0000000000000000)}, /* alpha^(2^7) */
+      {CONST_64(0x0000000000004015), CONST_64(0x0000000000000000)}, /* alpha^(2^8) */
+      {CONST_64(0x0000000010000111), CONST_64(0x0000000000000000)}, /* alpha^(2^9) */
+      {CONST_64(0x0100000000010101), CONST_64(0x0000000000000000)}, /* alpha^(2^10) */
+      {CONST_64(0x0000000100010001), CONST_64(0x0001000000000000)}, /* alpha^(2^11) */
+      {CONST_64(0x0000000100000001), CONST_64(0x0000008700000001)}, /* alpha^(2^12) */
+      {CONST_64(0x0000000000000086), CONST_64(0x000000000021caea)}, /* alpha^(2^13) */
+      {CONST_64(0x00021cae93f7cfc8), CONST_64(0x0000000000000000)}, /* alpha^(2^14) */
+      {CONST_64(0x4105551550555040), CONST_64(0x0000000401504454)}, /* alpha^(2^15) */
+      {CONST_64(0x118fe6196978ef70), CONST_64(0x1001001111110961)}, /* alpha^(2^16) */
+      {CONST_64(0x93c692c775187987), CONST_64(0x860140d2541486c6)}, /* alpha^(2^17) */
+      {CONST_64(0xea618e11df04ea1e), CONST_64(0x8b69509b312d6501)}, /* alpha^(2^18) */
+      {CONST_64(0xcad0352d30b311b4), CONST_64(0xb715594eb7756558)}, /* alpha^(2^19) */
+      {CONST_64(0x54e1a6f865fe82b9), CONST_64(0x01afdeffd35e5fde)}, /* alpha^(2^20) */
+      {CONST_64(0x218289f09c0659ed), CONST_64(0x11b4a30358935542)}, /* alpha^(2^21) */
+      {CONST_64(0x97b14587eebe264d), CONST_64(0x83a513579eda5793)}, /* alpha^(2^22) */
+      {CONST_64(0x38d15180f9de45ad), CONST_64(0x83ad91f69582bddf)}, /* alpha^(2^23) */
+      {CONST_64(0x1a97936b620f481d), CONST_64(0xc7f8a41756ad614d)}, /* alpha^(2^24) */
+      {CONST_64(0xe94bf5687ccf4c39), CONST_64(0xbb844bf6957599a6)}, /* alpha^(2^25) */
+      {CONST_64(0x5aadb3837634c244), CONST_64(0x2c3bd83d0661350d)}, /* alpha^(2^26) */
+      {CONST_64(0x1f726995c3f33829), CONST_64(0x24f6fc2353c7f232)}, /* alpha^(2^27) */
+      {CONST_64(0xa5b7efc52c5e9c53), CONST_64(0x150e344316f35f82)}, /* alpha^(2^28) */
+      {CONST_64(0x891738c79d5ad319), CONST_64(0xcbe66ebbc72d228a)}, /* alpha^(2^29) */
+      {CONST_64(0xfbb824714f38f6c2), CONST_64(0xd331a77342cf2867)}, /* alpha^(2^30) */
+      {CONST_64(0x62609e6968de22b0), CONST_64(0x60dcdee4d2f1fc92)}, /* alpha^(2^31) */
+      {CONST_64(0x21777af80695052a), CONST_64(0x782d0a995dd3b018)}, /* alpha^(2^32) */
+      {CONST_64(0xde0a74a95b11a7b2), CONST_64(0xcec3202236b9330f)}, /* alpha^(2^33) */
+      {CONST_64(0x800a7b44dd8e7a70), CONST_64(0xcad1b2dd09125a5f)}, /* alpha^(2^34) */
+      {CONST_64(0x7016c540c190dd74), CONST_64(0xd3f537e04c700e27)}, /* alpha^(2^35) */
+      {CONST_64(0x09bbaa007aff17a4), CONST_64(0x20b022e1c1d1bc08)}, /* alpha^(2^36) */
+      {CONST_64(0xa5ea62f173a564de), CONST_64(0x1c621e475a73acae)}, /* alpha^(2^37) */
+      {CONST_64(0xc1d3ada9e183a6f8), CONST_64(0xeaab3a58b8a02fe2)}, /* alpha^(2^38) */
+      {CONST_64(0x2ee29c077314ee0d), CONST_64(0xdffeae5cfc8592a2)}, /* alpha^(2^39) */
+      {CONST_64(0x1794c9c6116bca12), CONST_64(0x1854548bb6f4de8e)}, /* alpha^(2^40) */
+      {CONST_64(0x5046371c4cc9eaa8), CONST_64(0xa7ddbe68af10b36c)}, /* alpha^(2^41) */
+      {CONST_64(0xe77bd7620dd51099), CONST_64(0xc7c20e0075b34cb3)}, /* alpha^(2^42) */
+      {CONST_64(0xe385088258930c85), CONST_64(0xeed7a7597ab9140e)}, /* alpha^(2^43) */
+      {CONST_64(0xd9bf3b428f207eec), CONST_64(0xd3807dd9d6a39649)}, /* alpha^(2^44) */
+      {CONST_64(0x7d1adaba58301148), CONST_64(0x64fb855fc75b066a)}, /* alpha^(2^45) */
+      {CONST_64(0xaba3d15b0b675aaa), CONST_64(0x710a093e99bb9946)}, /* alpha^(2^46) */
+      {CONST_64(0x66216c6f770b3b1e), CONST_64(0xafc267d97044a1c8)}, /* alpha^(2^47) */
+      {CONST_64(0xfe1d7816d9eb81fd), CONST_64(0xe316b61772920218)}, /* alpha^(2^48) */
+      {CONST_64(0xb87c1159421de6c0), CONST_64(0xfbcf8c1e442c8cf5)}, /* alpha^(2^49) */
+      {CONST_64(0x687634c0bd8f66a6), CONST_64(0x4d328e5ae8b1bde5)}, /* alpha^(2^50) */
+      {CONST_64(0xc8b21bf16608e4db), CONST_64(0x4d758c29eeb484f7)}, /* alpha^(2^51) */
+      {CONST_64(0x939b53119c4b7496), CONST_64(0x097da6d2e8f7686d)}, /* alpha^(2^52) */
+      {CONST_64(0xccbb31a458da0423), CONST_64(0x60488351c7403436)}, /* alpha^(2^53) */
+      {CONST_64(0xaba321469362905f), CONST_64(0x3c5814a4c792b3be)}, /* alpha^(2^54) */
+      {CONST_64(0xfbcf513b18b860f7), CONST_64(0xf6fd92c58b52c44d)}, /* alpha^(2^55) */
+      {CONST_64(0xe213b075ac781973), CONST_64(0x740252435434bd93)}, /* alpha^(2^56) */
+      {CONST_64(0xbb228613735755a8), CONST_64(0xb7740311b0146782)}, /* alpha^(2^57) */
+      {CONST_64(0x4e059e6f77db9735), CONST_64(0x14a4e774428f86a1)}, /* alpha^(2^58) */
+      {CONST_64(0x6728ba4f8b5ad996), CONST_64(0x9f07d44ae7b5f72d)}, /* alpha^(2^59) */
+      {CONST_64(0xe68d429870a86444), CONST_64(0x783e0e827a3c43a2)}, /* alpha^(2^60) */
+      {CONST_64(0xdddef6f866a8cb3a), CONST_64(0x9ed6f0fd3b898356)}, /* alpha^(2^61) */
+      {CONST_64(0xac6ea52692d6e84f), CONST_64(0x3dd46c137e3f5775)}, /* alpha^(2^62) */
+      {CONST_64(0x81aae137a9a1f2ac), CONST_64(0xf64e2b2e01a18185)}  /* alpha^(2^63) */
+   };
+   int i;
+
+   for(i=(int)(n & ((1<<GF_POW_SHIFT_BITS)-1)); i>0; i--)
+      gf_mul_by_primitive(x);
+
+   for(n>>=GF_POW_SHIFT_BITS, i=0; n; n>>=1, i++) {
+      if(n & 1)
+         gf_mul(x, x, alphaPow[i]);
+   }
+}
+
+/*
+   multi-threaded processing of nBlks whole data blocks by XTS kernel
+
+   each thread starts with pTweak*alpha^(number of preceding blocks),
+   the tweak updated by the last thread is returned in pTweak
+*/
+typedef void (*cpAESProcessXTS)(Ipp8u* outBlk, const Ipp8u* inpBlk, int nBlks, const Ipp8u* pRKey, int nr, Ipp8u* pTweak);
+
+__IPPCP_INLINE void cpAESProcessXTS_mt(Ipp8u* outBlk, const Ipp8u* inpBlk, int nBlks,
+                                       const Ipp8u* pRKey, int nr, Ipp8u* pTweak,
+                                       cpAESProcessXTS processXTS)
+{
+   int nThreads = cpNumThreadsForLen((Ipp64s)nBlks*MBS_RIJ128);
+
+   if(1==nThreads)
+      processXTS(outBlk, inpBlk, nBlks, pRKey, nr, pTweak);
+
+   else {
+      __ALIGN16 Ipp64u initTweak[2];
+      int t;
+
+      initTweak[0] = ((Ipp64u*)pTweak)[0];
+      initTweak[1] = ((Ipp64u*)pTweak)[1];
+
+      #if defined(_OPENMP)
+      #pragma omp parallel for IPPCP_OMP_LIMIT_MAX_NUM_THREADS(nThreads)
+      #endif
+      for(t=0; t<nThreads; t++) {
+         int firstBlk = (int)((Ipp64s)nBlks*t/nThreads);
+         int lastBlk  = (int)((Ipp64s)nBlks*(t+1)/nThreads);
+         __ALIGN16 Ipp64u tweak[2];
+
+         tweak[0] = initTweak[0];
+         tweak[1] = initTweak[1];
+         gf_mul_by_primitive_pow(tweak, (Ipp64u)firstBlk);
+
+         processXTS(outBlk+firstBlk*MBS_RIJ128, inpBlk+firstBlk*MBS_RIJ128, lastBlk-firstBlk, pRKey, nr, (Ipp8u*)tweak);
+
+         if(t==nThreads-1) {
+            ((Ipp64u*)pTweak)[0] = tweak[0];
+            ((Ipp64u*)pTweak)[1] = tweak[1];
+         }
+      }
+   }
+}
+
 /*
    the following are especially for multi-block processing
 */
@@ -78,4 +229,41 @@ static void cpXTSxor16(Ipp8u* pDst, const Ipp8u* pSrc1, const Ipp8u* pSrc2, int
    }
 }
 
+/*
+   tweaks of n consecutive data units starting from duNo:
+   128-bit little-endian data unit numbers encrypted by the tweak key
+   (the blocks are independent, so they go through the ECB pipeline at once)
+*/
+__IPPCP_INLINE void cpXTSduTweaks(Ipp8u* pTweaks, int n, Ipp64u duNo, const IppsAESSpec* ptwkAES)
+{
+   Ipp64u* ptwk64 = (Ipp64u*)pTweaks;
+   int k;
+   for(k=0; k<n; k++, ptwk64+=2) {
+      ptwk64[0] = duNo + (Ipp64u)k;
+      ptwk64[1] = (ptwk64[0] < duNo); /* carry */
+   }
+   ippsAESEncryptECB(pTweaks, pTweaks, n*MBS_RIJ128, ptwkAES);
+}
+
+/*
+   single block XTS: whitening by the tweak around AES-ECB encryption (XTS_ENCRYPT)
+   or decryption (XTS_DECRYPT) of the block
+*/
+#define XTS_DECRYPT  (0)
+#define XTS_ENCRYPT  (1)
+
+__IPPCP_INLINE void cpAES_XTS_ProcessBlock(Ipp8u* out, const Ipp8u* inp, const Ipp8u* tweak,
+                                           const IppsAESSpec* pAES, int encrypt)
+{
+   /* pre-whitening */
+   XorBlock16(inp, tweak, out);
+   /* encryption/decryption */
+   if(encrypt)
+      ippsAESEncryptECB(out, out, MBS_RIJ128, pAES);
+   else
+      ippsAESDecryptECB(out, out, MBS_RIJ128, pAES);
+   /* post-whitening */
+   XorBlock16(out, tweak, out);
+}
+
 #endif /* _PCP_AES_XTS_STUFF_H */
@@ -0,0 +1,185 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     Operations over GF(p).
+//
+//     Context:
+//        ippsGFpBatchInvBufferSize()
+//        ippsGFpBatchInv()
+//        ippsGFpBatchInv_CT()
+//
+*/
+#include "owndefs.h"
+#include "owncp.h"
+
+#include "pcpgfpstuff.h"
+#include "pcpgfpxstuff.h"
+#include "pcptool.h"
+
+/*F*
+// Name: ippsGFpBatchInvBufferSize
+//
+// Purpose: Gets the size of the scratch buffer for ippsGFpBatchInv(), ippsGFpBatchInv_CT(),
+//          ippsGFpECBatchGetPoint() and ippsGFpECBatchGetPoint_CT()
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr          pGFp == NULL
+//                              pBufferSize == NULL
+//    ippStsContextMatchErr     incorrect pGFp's context id
+//    ippStsBadArgErr           0>=nItems
+//    ippStsSizeErr             required buffer size exceeds IPP_MAX_32S
+//    ippStsNoErr               no error
+//
+// Parameters:
+//    nItems          Number of elements (points)
+//    pGFp            Pointer to the context of the finite field
+//    pBufferSize     Pointer to the calculated buffer size in bytes
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpBatchInvBufferSize,(int nItems, const IppsGFpState* pGFp, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pGFp, pBufferSize);
+   IPP_BADARG_RET( !GFP_VALID_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr );
+
+   {
+      /* pointers to the sources and results, products and inverses of the elements */
+      Ipp64u itemSize = 2*sizeof(BNU_CHUNK_T*) + 2*(Ipp64u)GFP_FELEN(GFP_PMA(pGFp))*sizeof(BNU_CHUNK_T);
+      Ipp64u size = (Ipp64u)nItems*itemSize + CACHE_LINE_SIZE;
+      IPP_BADARG_RET( size > (Ipp64u)IPP_MAX_32S, ippStsSizeErr );
+
+      *pBufferSize = (int)size;
+      return ippStsNoErr;
+   }
+}
+
+static IppStatus gfpBatchInv(const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems,
+                             int isCT, IppsGFpState* pGFp, Ipp8u* pScratchBuffer)
+{
+   IPP_BAD_PTR4_RET(ppA, ppR, pGFp, pScratchBuffer);
+   IPP_BADARG_RET( !GFP_VALID_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr );
+   {
+      gsModEngine* pGFE = GFP_PMA(pGFp);
+      int elemLen = GFP_FELEN(pGFE);
+
+      BNU_CHUNK_T* pProd = (BNU_CHUNK_T*)(IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE));
+      const BNU_CHUNK_T** ppAdata = (const BNU_CHUNK_T**)(pProd + nItems*elemLen);
+      BNU_CHUNK_T** ppRdata = (BNU_CHUNK_T**)(ppAdata + nItems);
+
+      int i;
+      for(i=0; i<nItems; i++) {
+         IPP_BAD_PTR2_RET(ppA[i], ppR[i]);
+         IPP_BADARG_RET( !GFPE_VALID_ID(ppA[i]), ippStsContextMatchErr );
+         IPP_BADARG_RET( !GFPE_VALID_ID(ppR[i]), ippStsContextMatchErr );
+         IPP_BADARG_RET( (GFPE_ROOM(ppA[i])!=elemLen) || (GFPE_ROOM(ppR[i])!=elemLen), ippStsOutOfRangeErr);
+         IPP_BADARG_RET( !isCT && GFP_IS_ZERO(GFPE_DATA(ppA[i]),elemLen), ippStsDivByZeroErr );
+
+         ppAdata[i] = GFPE_DATA(ppA[i]);
+         ppRdata[i] = GFPE_DATA(ppR[i]);
+      }
+
+      cpGFpxBatchInv(ppRdata, ppAdata, nItems, isCT, pGFE, pProd);
+
+      /* clear products */
+      if(isCT)
+         PurgeBlock(pProd, nItems*elemLen*(Ipp32s)sizeof(BNU_CHUNK_T));
+
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpBatchInv
+//
+// Purpose: Multiplicative inverses of several GF elements
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pGFp
+//                               NULL == ppA, NULL == ppA[i]
+//                               NULL == ppR, NULL == ppR[i]
+//                               NULL == pScratchBuffer
+//
+//    ippStsContextMatchErr      invalid pGFp->idCtx
+//                               invalid ppA[i]->idCtx
+//                               invalid ppR[i]->idCtx
+//
+//    ippStsOutOfRangeErr        GFPE_ROOM() != GFP_FELEN()
+//
+//    ippStsDivByZeroErr         ppA[i] is zero
+//
+//    ippStsBadArgErr            0>=nItems
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    ppA            Array of pointers to the source finite field elements
+//    ppR            Array of pointers to the resulting finite field elements
+//    nItems         Number of elements
+//    pGFp           Pointer to the context of the finite field
+//    pScratchBuffer Pointer to the scratch buffer of ippsGFpBatchInvBufferSize() size
+//
+// Note:
+//    The inverses are computed by a single inversion, the execution time depends on
+//    the elements values. Use ippsGFpBatchInv_CT() for the secret data.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpBatchInv,(const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems,
+                                   IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
+{
+   return gfpBatchInv(ppA, ppR, nItems, 0, pGFp, pScratchBuffer);
+}
+
+/*F*
+// Name: ippsGFpBatchInv_CT
+//
+// Purpose: Multiplicative inverses of several GF elements, constant time version
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pGFp
+//                               NULL == ppA, NULL == ppA[i]
+//                               NULL == ppR, NULL == ppR[i]
+//                               NULL == pScratchBuffer
+//
+//    ippStsContextMatchErr      invalid pGFp->idCtx
+//                               invalid ppA[i]->idCtx
+//                               invalid ppR[i]->idCtx
+//
+//    ippStsOutOfRangeErr        GFPE_ROOM() != GFP_FELEN()
+//
+//    ippStsBadArgErr            0>=nItems
+//
+//    ippStsNoErr                no error
+//
+// Parameters:
+//    ppA            Array of pointers to the source finite field elements
+//    ppR            Array of pointers to the resulting finite field elements
+//    nItems         Number of elements
+//    pGFp           Pointer to the context of the finite field
+//    pScratchBuffer Pointer to the scratch buffer of ippsGFpBatchInvBufferSize() size
+//
+// Note:
+//    Zero elements are not reported, their inverses are set to zero.
+//    Over GF(p) the execution time does not depend on the elements values.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpBatchInv_CT,(const IppsGFpElement* const ppA[], IppsGFpElement* const ppR[], int nItems,
+                                      IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
+{
+   return gfpBatchInv(ppA, ppR, nItems, 1, pGFp, pScratchBuffer);
+}
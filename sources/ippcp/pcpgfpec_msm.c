@@ -0,0 +1,602 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     Internal EC over GF(p^m) basic Definitions & Function Prototypes
+//
+//     Context:
+//        gfec_point_msm_bufsize()
+//        gfec_point_msm()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+#include "pcpgfpxstuff.h"
+
+/*
+// Multi-scalar multiplication R = [k0]*P0 + [k1]*P1 + ... by the bucket (Pippenger) method:
+//    - scalars are recoded into signed c-bit digits in [-2^(c-1), 2^(c-1)],
+//    - the points are converted to affine coordinates by one simultaneous inversion
+//      (points given with Z=1 are taken as is),
+//    - the points are accumulated into 2^(c-1) affine buckets of every window,
+//    - the buckets of every window are summed by the running sum,
+//    - window sums are combined by c doublings each.
+//
+// Bucket accumulation and running sums are made of affine additions. Independent
+// additions (at most one per accumulator) are collected into a batch and the slopes
+// of the batch share one simultaneous inversion, so an addition costs about 6
+// multiplications instead of 11 of the mixed (Jacobian+affine) addition.
+// All windows are processed together to keep the batches long. The few additions
+// left serialized on hot buckets at the end of the accumulation are made in
+// Jacobian coordinates.
+//
+// The window size c is selected by the number of points.
+//
+// Note: the computation depends on the scalars values, use it with public data only.
+*/
+
+#define MSM_MIN_WINDOW  (2)
+#define MSM_MAX_WINDOW  (16)
+#define MSM_BATCH_SIZE  (1024) /* max number of additions sharing one inversion */
+#define MSM_MIN_BATCH   (16)   /* smaller batch does not pay for the inversion */
+
+/* state of the affine accumulator (bucket, running or window sum) */
+#define MSM_EMPTY (0)   /* point at infinity */
+#define MSM_SET   (1)   /* affine point */
+#define MSM_BUSY  (2)   /* affine point, an addition to it is in the batch */
+
+/* kind of the addition R = R + A in the batch */
+#define MSM_OP_ADD (0)  /* R != +/-A */
+#define MSM_OP_DBL (1)  /* R == A */
+#define MSM_OP_INF (2)  /* R == -A */
+
+typedef struct {
+   BNU_CHUNK_T*       pR;      /* accumulator */
+   Ipp8u*             pState;  /* accumulator's state */
+   const BNU_CHUNK_T* pA;      /* added point */
+   int                negA;    /* -A is added */
+   int                op;      /* kind of the addition */
+} msmAddition;
+
+typedef struct {
+   msmAddition*  pAdd;         /* additions */
+   BNU_CHUNK_T** ppDen;        /* denominators of the slopes */
+   BNU_CHUNK_T*  pProd;        /* products of the simultaneous inversion */
+   int           num;          /* number of additions */
+} msmBatch;
+
+/*
+// window size minimizing number of additions: windows * (points + 2*buckets - min(points, buckets)),
+// the first point of a bucket is copied rather than added
+*/
+static int msmWindowSize(int nItems, int scalarBitSize)
+{
+   int c;
+   int bestC = MSM_MIN_WINDOW;
+   Ipp64u bestCost = (Ipp64u)(-1);
+   for(c=MSM_MIN_WINDOW; c<=MSM_MAX_WINDOW; c++) {
+      Ipp64u numBuckets = (Ipp64u)1<<(c-1);
+      Ipp64u cost = (Ipp64u)(scalarBitSize/c +1) * (numBuckets + IPP_MAX((Ipp64u)nItems, numBuckets));
+      if(cost < bestCost) {
+         bestCost = cost;
+         bestC = c;
+      }
+   }
+   return bestC;
+}
+
+/* c bits of the scalar started at bitPos */
+static Ipp32u msmGetBits(const BNU_CHUNK_T* pScalar, int scalarLen, int bitPos, int c)
+{
+   int word = bitPos / BNU_CHUNK_BITS;
+   int shift = bitPos % BNU_CHUNK_BITS;
+   BNU_CHUNK_T lo = (word < scalarLen)? pScalar[word] : 0;
+   BNU_CHUNK_T hi = (word+1 < scalarLen)? pScalar[word+1] : 0;
+   BNU_CHUNK_T value = lo >> shift;
+   if(shift)
+      value |= hi << (BNU_CHUNK_BITS - shift);
+   return (Ipp32u)value & (((Ipp32u)1<<c) -1);
+}
+
+/*
+// Adds affine point A to Jacobian point B (B = B+A), variable time:
+// handles B==infinity, B==A and B==-A cases which are not covered by gfec_affine_point_add()
+*/
+static void msmAddAffine(BNU_CHUNK_T* pBdata, const BNU_CHUNK_T* pAdata, BNU_CHUNK_T* pTdata, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+
+   if(GFP_IS_ZERO(pBdata+2*elemLen, elemLen)) {
+      cpGFpElementCopy(pBdata, pAdata, 2*elemLen);
+      cpGFpElementCopy(pBdata+2*elemLen, GFP_MNT_R(pGFE), elemLen);
+      return;
+   }
+
+   gfec_affine_point_add(pTdata, pBdata, pAdata, pEC);
+   if(!GFP_IS_ZERO(pTdata+2*elemLen, elemLen)) {
+      cpGFpElementCopy(pBdata, pTdata, 3*elemLen);
+      return;
+   }
+
+   /* X(B) == X(A): B == A if Y(B) == Y(A)*Z(B)^3, B == -A otherwise */
+   {
+      mod_mul mulF = GFP_METHOD(pGFE)->mul;
+      mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+      BNU_CHUNK_T* pS = cpGFpGetPool(1, pGFE);
+
+      sqrF(pS, pBdata+2*elemLen, pGFE);
+      mulF(pS, pS, pBdata+2*elemLen, pGFE);
+      mulF(pS, pS, pAdata+elemLen, pGFE);
+      if(GFP_EQ(pS, pBdata+elemLen, elemLen))
+         gfec_point_double(pBdata, pBdata, pEC);
+      else
+         cpGFpElementPad(pBdata, 3*elemLen, 0);
+
+      cpGFpReleasePool(1, pGFE);
+   }
+}
+
+/*
+// Puts affine addition R = R + A (R = R - A if negA) into the batch.
+// R == infinity is processed at once, the other cases are left for msmFlush().
+*/
+static void msmPut(msmBatch* pBatch, BNU_CHUNK_T* pR, Ipp8u* pState, const BNU_CHUNK_T* pA, int negA, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   mod_neg negF = GFP_METHOD(pGFE)->neg;
+
+   msmAddition* pAdd;
+   int op = MSM_OP_ADD;
+
+   if(MSM_EMPTY==*pState) {
+      cpGFpElementCopy(pR, pA, elemLen);
+      if(negA)
+         negF(pR+elemLen, pA+elemLen, pGFE);
+      else
+         cpGFpElementCopy(pR+elemLen, pA+elemLen, elemLen);
+      *pState = MSM_SET;
+      return;
+   }
+
+   /* X(R) == X(A): R == A or R == -A */
+   if(GFP_EQ(pR, pA, elemLen)) {
+      BNU_CHUNK_T* pY = cpGFpGetPool(1, pGFE);
+      if(negA)
+         negF(pY, pA+elemLen, pGFE);
+      else
+         cpGFpElementCopy(pY, pA+elemLen, elemLen);
+      op = (GFP_EQ(pY, pR+elemLen, elemLen) && !GFP_IS_ZERO(pY, elemLen))? MSM_OP_DBL : MSM_OP_INF;
+      cpGFpReleasePool(1, pGFE);
+   }
+
+   pAdd = pBatch->pAdd + pBatch->num;
+   pAdd->pR = pR;
+   pAdd->pState = pState;
+   pAdd->pA = pA;
+   pAdd->negA = negA;
+   pAdd->op = op;
+   pBatch->num++;
+   *pState = MSM_BUSY;
+}
+
+/*
+// Makes the additions of the batch:
+//    lambda = (Y(A)-Y(R))/(X(A)-X(R))    (addition)
+//    lambda = (3*X(R)^2+a)/(2*Y(R))      (doubling)
+//    X = lambda^2 - X(R) - X(A), Y = lambda*(X(R)-X) - Y(R)
+// all the denominators are inverted at once.
+//
+// The additions are made in the order they were put, so an accumulator
+// may be used as the added point A of the preceding additions.
+*/
+static void msmFlush(msmBatch* pBatch, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+
+   mod_add  addF = GFP_METHOD(pGFE)->add;
+   mod_sub  subF = GFP_METHOD(pGFE)->sub;
+   mod_neg  negF = GFP_METHOD(pGFE)->neg;
+   mod_mul2 mul2F= GFP_METHOD(pGFE)->mul2;
+   mod_mul3 mul3F= GFP_METHOD(pGFE)->mul3;
+   mod_mul  mulF = GFP_METHOD(pGFE)->mul;
+   mod_sqr  sqrF = GFP_METHOD(pGFE)->sqr;
+
+   int num = pBatch->num;
+   int t;
+
+   if(0==num)
+      return;
+
+   for(t=0; t<num; t++) {
+      const msmAddition* pAdd = pBatch->pAdd + t;
+      BNU_CHUNK_T* pDen = pBatch->ppDen[t];
+      if(MSM_OP_ADD==pAdd->op)
+         subF(pDen, pAdd->pA, pAdd->pR, pGFE);
+      else if(MSM_OP_DBL==pAdd->op)
+         mul2F(pDen, pAdd->pR+elemLen, pGFE);
+      else
+         cpGFpElementPad(pDen, elemLen, 0);   /* skipped by the inversion */
+   }
+
+   cpGFpxBatchInv(pBatch->ppDen, (const BNU_CHUNK_T* const*)pBatch->ppDen, num, 0, pGFE, pBatch->pProd);
+
+   {
+      BNU_CHUNK_T* pL = cpGFpGetPool(2, pGFE);
+      BNU_CHUNK_T* pX = pL + GFP_PELEN(pGFE);
+
+      for(t=0; t<num; t++) {
+         const msmAddition* pAdd = pBatch->pAdd + t;
+         BNU_CHUNK_T* pR = pAdd->pR;
+         const BNU_CHUNK_T* pA = pAdd->pA;
+
+         if(MSM_OP_INF==pAdd->op) {
+            *pAdd->pState = MSM_EMPTY;
+            continue;
+         }
+
+         if(MSM_OP_ADD==pAdd->op) {
+            if(pAdd->negA) {
+               addF(pL, pA+elemLen, pR+elemLen, pGFE);
+               negF(pL, pL, pGFE);
+            }
+            else
+               subF(pL, pA+elemLen, pR+elemLen, pGFE);
+         }
+         else {
+            sqrF(pL, pR, pGFE);
+            mul3F(pL, pL, pGFE);
+            addF(pL, pL, ECP_A(pEC), pGFE);
+         }
+         mulF(pL, pL, pBatch->ppDen[t], pGFE);
+
+         sqrF(pX, pL, pGFE);
+         subF(pX, pX, pR, pGFE);
+         subF(pX, pX, pA, pGFE);
+
+         subF(pR, pR, pX, pGFE);
+         mulF(pR, pR, pL, pGFE);
+         subF(pR+elemLen, pR, pR+elemLen, pGFE);
+         cpGFpElementCopy(pR, pX, elemLen);
+
+         *pAdd->pState = MSM_SET;
+      }
+
+      cpGFpReleasePool(2, pGFE);
+   }
+
+   pBatch->num = 0;
+}
+
+/*
+// Makes the batch of bucket additions and puts the deferred additions
+// (the ones whose bucket was busy) into the next batch.
+// pDefer[] keeps pairs (bucket, point), the point index of -P is stored as ~i.
+// Returns number of additions left deferred.
+*/
+static int msmFlushBuckets(msmBatch* pBatch, Ipp32s* pDefer, int nDefer,
+                           BNU_CHUNK_T* pBuckets, Ipp8u* pBucketState, const BNU_CHUNK_T* pAffine,
+                           IppsGFpECState* pEC)
+{
+   int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+   int k, n;
+
+   msmFlush(pBatch, pEC);
+
+   for(k=0, n=0; k<nDefer; k++) {
+      Ipp32s b = pDefer[2*k];
+      Ipp32s i = pDefer[2*k+1];
+      if(MSM_BUSY==pBucketState[b]) {
+         pDefer[2*n] = b;
+         pDefer[2*n+1] = i;
+         n++;
+      }
+      else {
+         int negA = (i<0);
+         if(negA) i = ~i;
+         msmPut(pBatch, pBuckets+b*2*elemLen, pBucketState+b, pAffine+i*2*elemLen, negA, pEC);
+      }
+   }
+   return n;
+}
+
+/*
+// Completes the deferred additions in Jacobian coordinates, one inversion per bucket.
+// The additions left at the end of the accumulation are serialized on a few buckets
+// (typically of the short top window) and would be flushed by nearly empty batches.
+*/
+static void msmAddDeferred(Ipp32s* pDefer, int nDefer,
+                           BNU_CHUNK_T* pBuckets, Ipp8u* pBucketState, const BNU_CHUNK_T* pAffine,
+                           BNU_CHUNK_T* pBuffer, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int pointLen = ECP_POINTLEN(pEC);
+
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+   mod_neg negF = GFP_METHOD(pGFE)->neg;
+
+   BNU_CHUNK_T* pB = cpEcGFpGetPool(3, pEC);  /* points from the pool */
+   BNU_CHUNK_T* pT = pB + pointLen;
+   BNU_CHUNK_T* pNegA = pT + pointLen;
+   int k, m;
+
+   for(k=0; k<nDefer; k++) {
+      Ipp32s b = pDefer[2*k];
+      BNU_CHUNK_T* pR;
+      if(b<0)
+         continue;
+      pR = pBuckets + b*2*elemLen;
+
+      if(MSM_EMPTY==pBucketState[b])
+         cpGFpElementPad(pB, pointLen, 0);
+      else {
+         cpGFpElementCopy(pB, pR, 2*elemLen);
+         cpGFpElementCopy(pB+2*elemLen, GFP_MNT_R(pGFE), elemLen);
+      }
+
+      /* all additions to the bucket, the processed ones are marked by -1 */
+      for(m=k; m<nDefer; m++) {
+         Ipp32s i = pDefer[2*m+1];
+         if(b!=pDefer[2*m])
+            continue;
+         pDefer[2*m] = -1;
+         if(i<0) {
+            const BNU_CHUNK_T* pA = pAffine+(~i)*2*elemLen;
+            cpGFpElementCopy(pNegA, pA, elemLen);
+            negF(pNegA+elemLen, pA+elemLen, pGFE);
+            msmAddAffine(pB, pNegA, pT, pEC);
+         }
+         else
+            msmAddAffine(pB, pAffine+i*2*elemLen, pT, pEC);
+      }
+
+      if(GFP_IS_ZERO(pB+2*elemLen, elemLen)) {
+         pBucketState[b] = MSM_EMPTY;
+         continue;
+      }
+
+      /* x = X/Z^2, y = Y/Z^3 */
+      {
+         BNU_CHUNK_T* pZinv = pT;
+         BNU_CHUNK_T* pZ = pB+2*elemLen;
+         cpGFpxBatchInv(&pZinv, (const BNU_CHUNK_T* const*)&pZ, 1, 0, pGFE, pBuffer);
+         sqrF(pT+elemLen, pZinv, pGFE);
+         mulF(pR, pB, pT+elemLen, pGFE);
+         mulF(pT+elemLen, pT+elemLen, pZinv, pGFE);
+         mulF(pR+elemLen, pB+elemLen, pT+elemLen, pGFE);
+         pBucketState[b] = MSM_SET;
+      }
+   }
+
+   cpEcGFpReleasePool(3, pEC);
+}
+
+IPP_OWN_DEFN (int, gfec_point_msm_bufsize, (int nItems, int scalarBitSize, const IppsGFpECState* pEC))
+{
+   int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+   int c = msmWindowSize(nItems, scalarBitSize);
+   int numWin = scalarBitSize/c +1;
+   Ipp64u numBuckets = (Ipp64u)numWin << (c-1);
+
+   Ipp64u size = (Ipp64u)nItems * (Ipp64u)(2*elemLen) * sizeof(BNU_CHUNK_T)                  /* affine points */
+               + (Ipp64u)IPP_MAX(nItems, MSM_BATCH_SIZE) * (Ipp64u)elemLen * sizeof(BNU_CHUNK_T) /* products of the simultaneous inversions */
+               + (Ipp64u)MSM_BATCH_SIZE * (Ipp64u)elemLen * sizeof(BNU_CHUNK_T)                 /* denominators */
+               + (numBuckets + 2*(Ipp64u)numWin) * (Ipp64u)(2*elemLen) * sizeof(BNU_CHUNK_T)   /* buckets, running and window sums */
+               + (Ipp64u)MSM_BATCH_SIZE * (sizeof(BNU_CHUNK_T*) + sizeof(msmAddition))         /* batch */
+               + (Ipp64u)nItems * (Ipp64u)numWin * sizeof(Ipp32s)                               /* signed digits */
+               + (Ipp64u)MSM_BATCH_SIZE * 2 * sizeof(Ipp32s)                                    /* deferred additions */
+               + (numBuckets + 2*(Ipp64u)numWin) * sizeof(Ipp8u)                               /* states */
+               + CACHE_LINE_SIZE;
+   return (size > (Ipp64u)IPP_MAX_32S)? 0 : (int)size;
+}
+
+IPP_OWN_DEFN (void, gfec_point_msm, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* const ppPdata[], const BNU_CHUNK_T* const ppScalar[], const int pScalarLen[], int nItems, int scalarBitSize, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int pointLen = ECP_POINTLEN(pEC);
+
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+
+   int c = msmWindowSize(nItems, scalarBitSize);
+   int numWin = scalarBitSize/c +1;
+   int numBuckets = 1<<(c-1);
+
+   /* scratch buffer layout */
+   BNU_CHUNK_T* pAffine = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE);
+   BNU_CHUNK_T* pProd = pAffine + nItems*2*elemLen;
+   BNU_CHUNK_T* pDen = pProd + IPP_MAX(nItems, MSM_BATCH_SIZE)*elemLen;
+   BNU_CHUNK_T* pBuckets = pDen + MSM_BATCH_SIZE*elemLen;
+   BNU_CHUNK_T* pSums = pBuckets + numWin*numBuckets*2*elemLen;
+   BNU_CHUNK_T* pWins = pSums + numWin*2*elemLen;
+   BNU_CHUNK_T** ppDen = (BNU_CHUNK_T**)(pWins + numWin*2*elemLen);
+   msmAddition* pAdd = (msmAddition*)(ppDen + MSM_BATCH_SIZE);
+   Ipp32s* pDigits = (Ipp32s*)(pAdd + MSM_BATCH_SIZE);
+   Ipp32s* pDefer = pDigits + nItems*numWin;
+   Ipp8u* pBucketState = (Ipp8u*)(pDefer + 2*MSM_BATCH_SIZE);
+   Ipp8u* pSumState = pBucketState + numWin*numBuckets;
+   Ipp8u* pWinState = pSumState + numWin;
+
+   msmBatch batch;
+   int nDefer = 0;
+
+   BNU_CHUNK_T* pAcc = cpEcGFpGetPool(2, pEC);  /* points from the pool */
+   BNU_CHUNK_T* pTmp = pAcc + pointLen;
+
+   int i, j, k;
+
+   /*
+   // affine coordinates by simultaneous inversion:
+   // pProd[i] = Z0*...*Zi (points at infinity and affine points are skipped), 1/Zi = pProd[i-1]/pProd[i]
+   */
+   {
+      BNU_CHUNK_T* pInv = cpGFpGetPool(2, pGFE);
+      BNU_CHUNK_T* pZinv = pInv + elemLen;
+      const BNU_CHUNK_T* pPrev = GFP_MNT_R(pGFE);
+
+      for(i=0; i<nItems; i++) {
+         const BNU_CHUNK_T* pZ = ppPdata[i]+2*elemLen;
+         if(GFP_IS_ZERO(pZ, elemLen) || GFP_EQ(pZ, GFP_MNT_R(pGFE), elemLen))
+            cpGFpElementCopy(pProd+i*elemLen, pPrev, elemLen);
+         else
+            mulF(pProd+i*elemLen, pPrev, pZ, pGFE);
+         pPrev = pProd+i*elemLen;
+      }
+      /* the points are public, variable time inversion is used */
+      cpGFpxBatchInv(&pInv, &pPrev, 1, 0, pGFE, pDen);
+
+      for(i=nItems-1; i>=0; i--) {
+         const BNU_CHUNK_T* pP = ppPdata[i];
+         BNU_CHUNK_T* pA = pAffine+i*2*elemLen;
+         if(GFP_IS_ZERO(pP+2*elemLen, elemLen)) {
+            cpGFpElementPad(pA, 2*elemLen, 0);
+            continue;
+         }
+         if(GFP_EQ(pP+2*elemLen, GFP_MNT_R(pGFE), elemLen)) {
+            cpGFpElementCopy(pA, pP, 2*elemLen);
+            continue;
+         }
+         if(i)
+            mulF(pZinv, pInv, pProd+(i-1)*elemLen, pGFE);
+         else
+            cpGFpElementCopy(pZinv, pInv, elemLen);
+         mulF(pInv, pInv, pP+2*elemLen, pGFE);
+
+         /* x = X/Z^2, y = Y/Z^3 */
+         sqrF(pTmp, pZinv, pGFE);
+         mulF(pA, pP, pTmp, pGFE);
+         mulF(pTmp, pTmp, pZinv, pGFE);
+         mulF(pA+elemLen, pP+elemLen, pTmp, pGFE);
+      }
+
+      cpGFpReleasePool(2, pGFE);
+   }
+
+   /* signed digits: digit[i][j] of the window j of the scalar i */
+   for(i=0; i<nItems; i++) {
+      Ipp32u carry = 0;
+      int isInfinity = GFP_IS_ZERO(ppPdata[i]+2*elemLen, elemLen);
+      for(j=0; j<numWin; j++) {
+         Ipp32s d = (Ipp32s)(msmGetBits(ppScalar[i], pScalarLen[i], j*c, c) + carry);
+         carry = (d > numBuckets);
+         d -= (Ipp32s)(carry << c);
+         pDigits[i*numWin+j] = isInfinity? 0 : d;
+      }
+   }
+
+   batch.pAdd = pAdd;
+   batch.ppDen = ppDen;
+   batch.pProd = pProd;
+   batch.num = 0;
+   for(k=0; k<MSM_BATCH_SIZE; k++)
+      ppDen[k] = pDen + k*elemLen;
+
+   /*
+   // accumulation of all windows:
+   // addition to the bucket busy in the current batch is deferred to the next one,
+   // the tail of deferred additions is completed by msmAddDeferred()
+   */
+   for(k=0; k<numWin*numBuckets; k++)
+      pBucketState[k] = MSM_EMPTY;
+
+   for(i=0; i<nItems; i++) {
+      const BNU_CHUNK_T* pA = pAffine+i*2*elemLen;
+      const Ipp32s* pPointDigits = pDigits + i*numWin;
+
+      for(j=0; j<numWin; j++) {
+         Ipp32s d = pPointDigits[j];
+         Ipp32s b;
+         if(0==d)
+            continue;
+
+         b = j*numBuckets + ((d>0)? d : -d) -1;
+         if(MSM_BUSY==pBucketState[b]) {
+            pDefer[2*nDefer] = b;
+            pDefer[2*nDefer+1] = (d>0)? i : ~i;
+            nDefer++;
+         }
+         else
+            msmPut(&batch, pBuckets+b*2*elemLen, pBucketState+b, pA, d<0, pEC);
+
+         while(MSM_BATCH_SIZE==batch.num || MSM_BATCH_SIZE==nDefer)
+            nDefer = msmFlushBuckets(&batch, pDefer, nDefer, pBuckets, pBucketState, pAffine, pEC);
+      }
+   }
+   while(batch.num || nDefer) {
+      nDefer = msmFlushBuckets(&batch, pDefer, nDefer, pBuckets, pBucketState, pAffine, pEC);
+      if(nDefer && MSM_MIN_BATCH>batch.num) {
+         msmFlush(&batch, pEC);
+         msmAddDeferred(pDefer, nDefer, pBuckets, pBucketState, pAffine, pProd, pEC);
+         nDefer = 0;
+      }
+   }
+
+   /*
+   // window sums W = sum (k+1)*bucket[k] by the running sums S of all windows:
+   // the step k adds the previous S to W and then bucket[k] to S,
+   // both additions of the step share the batch (see msmFlush()),
+   // the last step (k==-1) adds S to W only
+   */
+   for(j=0; j<numWin; j++) {
+      pSumState[j] = MSM_EMPTY;
+      pWinState[j] = MSM_EMPTY;
+   }
+   for(k=numBuckets-1; k>=-1; k--) {
+      for(j=0; j<numWin; j++) {
+         if(MSM_EMPTY!=pSumState[j]) {
+            if(MSM_BATCH_SIZE==batch.num)
+               msmFlush(&batch, pEC);
+            msmPut(&batch, pWins+j*2*elemLen, pWinState+j, pSums+j*2*elemLen, 0, pEC);
+         }
+      }
+      for(j=0; j<numWin && k>=0; j++) {
+         Ipp32s b = j*numBuckets + k;
+         if(MSM_EMPTY!=pBucketState[b]) {
+            if(MSM_BATCH_SIZE==batch.num)
+               msmFlush(&batch, pEC);
+            msmPut(&batch, pSums+j*2*elemLen, pSumState+j, pBuckets+b*2*elemLen, 0, pEC);
+         }
+      }
+      msmFlush(&batch, pEC);
+   }
+
+   /* R = sum 2^(c*j) * W[j] */
+   cpGFpElementPad(pAcc, pointLen, 0);
+   for(j=numWin-1; j>=0; j--) {
+      if(!GFP_IS_ZERO(pAcc+2*elemLen, elemLen)) {
+         for(k=0; k<c; k++)
+            gfec_point_double(pAcc, pAcc, pEC);
+      }
+      if(MSM_EMPTY!=pWinState[j])
+         msmAddAffine(pAcc, pWins+j*2*elemLen, pTmp, pEC);
+   }
+
+   if(GFP_IS_ZERO(pAcc+2*elemLen, elemLen))
+      cpGFpElementPad(pAcc, pointLen, 0);
+   cpGFpElementCopy(pRdata, pAcc, pointLen);
+
+   cpEcGFpReleasePool(2, pEC);
+}
@@ -0,0 +1,199 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p^m) Operations
+//
+//     Context:
+//        ippsGFpECBatchGetPoint()
+//        ippsGFpECBatchGetPoint_CT()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+#include "pcpgfpxstuff.h"
+#include "pcptool.h"
+
+static IppStatus gfecBatchGetPoint(const IppsGFpECPoint* const ppPoint[],
+                                   IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int nItems,
+                                   int isCT, IppsGFpECState* pEC, Ipp8u* pScratchBuffer)
+{
+   IPP_BAD_PTR3_RET(ppPoint, pEC, pScratchBuffer);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr );
+   {
+      gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+      int elemLen = GFP_FELEN(pGFE);
+      mod_mul mulF = GFP_METHOD(pGFE)->mul;
+      mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+
+      /* scratch buffer layout (see ippsGFpBatchInvBufferSize) */
+      BNU_CHUNK_T* pProd = (BNU_CHUNK_T*)(IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE));
+      BNU_CHUNK_T* pZinv = pProd + nItems*elemLen;
+      BNU_CHUNK_T** ppZdata = (BNU_CHUNK_T**)(pZinv + nItems*elemLen);
+
+      int i;
+      for(i=0; i<nItems; i++) {
+         const IppsGFpECPoint* pPoint = ppPoint[i];
+         IPP_BAD_PTR1_RET(pPoint);
+         IPP_BADARG_RET( !ECP_POINT_VALID_ID(pPoint), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(pPoint)!=elemLen, ippStsOutOfRangeErr);
+         if(ppX) {
+            IPP_BAD_PTR1_RET(ppX[i]);
+            IPP_BADARG_RET( !GFPE_VALID_ID(ppX[i]), ippStsContextMatchErr );
+            IPP_BADARG_RET( GFPE_ROOM(ppX[i])!=elemLen, ippStsOutOfRangeErr);
+         }
+         if(ppY) {
+            IPP_BAD_PTR1_RET(ppY[i]);
+            IPP_BADARG_RET( !GFPE_VALID_ID(ppY[i]), ippStsContextMatchErr );
+            IPP_BADARG_RET( GFPE_ROOM(ppY[i])!=elemLen, ippStsOutOfRangeErr);
+         }
+      }
+
+      /* Z coordinates, zero for the points at infinity */
+      for(i=0; i<nItems; i++) {
+         const IppsGFpECPoint* pPoint = ppPoint[i];
+         BNU_CHUNK_T* pZ = pZinv + i*elemLen;
+         if(IS_ECP_FINITE_POINT(pPoint))
+            cpGFpElementCopy(pZ, ECP_POINT_Z(pPoint), elemLen);
+         else
+            cpGFpElementPad(pZ, elemLen, 0);
+         ppZdata[i] = pZ;
+      }
+
+      cpGFpxBatchInv(ppZdata, (const BNU_CHUNK_T* const*)ppZdata, nItems, isCT, pGFE, pProd);
+
+      /* x = X/Z^2, y = Y/Z^3 */
+      {
+         BNU_CHUNK_T* pT = cpGFpGetPool(1, pGFE);
+         for(i=0; i<nItems; i++) {
+            const IppsGFpECPoint* pPoint = ppPoint[i];
+            BNU_CHUNK_T* pZ = pZinv + i*elemLen;
+
+            sqrF(pT, pZ, pGFE);
+            if(ppX)
+               mulF(GFPE_DATA(ppX[i]), ECP_POINT_X(pPoint), pT, pGFE);
+            if(ppY) {
+               mulF(pT, pT, pZ, pGFE);
+               mulF(GFPE_DATA(ppY[i]), ECP_POINT_Y(pPoint), pT, pGFE);
+            }
+         }
+         cpGFpReleasePool(1, pGFE);
+      }
+
+      /* clear products and inverses */
+      if(isCT)
+         PurgeBlock(pProd, 2*nItems*elemLen*(Ipp32s)sizeof(BNU_CHUNK_T));
+
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECBatchGetPoint
+//
+// Purpose: Retrieves coordinates of several points on an elliptic curve
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppPoint == NULL, ppPoint[i] == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   ppX != NULL && ppX[i] == NULL
+//                                   ppY != NULL && ppY[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid ppPoint[i]->idCtx
+//                                   ppX != NULL && invalid ppX[i]->idCtx
+//                                   ppY != NULL && invalid ppY[i]->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppPoint[i])!=GFP_FELEN()
+//                                   ppX != NULL && GFPE_ROOM(ppX[i])!=GFP_FELEN()
+//                                   ppY != NULL && GFPE_ROOM(ppY[i])!=GFP_FELEN()
+//
+//    ippStsBadArgErr                0>=nItems
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppPoint         Array of pointers to the IppsGFpECPoint contexts
+//    ppX, ppY        Arrays of pointers to the X and Y coordinates of the points (may be NULL)
+//    nItems          Number of points
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpBatchInvBufferSize() size
+//                    for the finite field of the elliptic curve
+//
+// Note:
+//    The coordinates are converted by a single inversion, the execution time depends on
+//    the points. Use ippsGFpECBatchGetPoint_CT() for the secret data.
+//    (X,Y) == (0,0) is returned for the points at infinity.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECBatchGetPoint,(const IppsGFpECPoint* const ppPoint[],
+                                          IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int nItems,
+                                          IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+{
+   return gfecBatchGetPoint(ppPoint, ppX, ppY, nItems, 0, pEC, pScratchBuffer);
+}
+
+/*F*
+// Name: ippsGFpECBatchGetPoint_CT
+//
+// Purpose: Retrieves coordinates of several points on an elliptic curve, constant time version
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppPoint == NULL, ppPoint[i] == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   ppX != NULL && ppX[i] == NULL
+//                                   ppY != NULL && ppY[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid ppPoint[i]->idCtx
+//                                   ppX != NULL && invalid ppX[i]->idCtx
+//                                   ppY != NULL && invalid ppY[i]->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppPoint[i])!=GFP_FELEN()
+//                                   ppX != NULL && GFPE_ROOM(ppX[i])!=GFP_FELEN()
+//                                   ppY != NULL && GFPE_ROOM(ppY[i])!=GFP_FELEN()
+//
+//    ippStsBadArgErr                0>=nItems
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppPoint         Array of pointers to the IppsGFpECPoint contexts
+//    ppX, ppY        Arrays of pointers to the X and Y coordinates of the points (may be NULL)
+//    nItems          Number of points
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpBatchInvBufferSize() size
+//                    for the finite field of the elliptic curve
+//
+// Note:
+//    Over GF(p) the execution time does not depend on the coordinates of the points.
+//    (X,Y) == (0,0) is returned for the points at infinity.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECBatchGetPoint_CT,(const IppsGFpECPoint* const ppPoint[],
+                                             IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int nItems,
+                                             IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+{
+   return gfecBatchGetPoint(ppPoint, ppX, ppY, nItems, 1, pEC, pScratchBuffer);
+}
@@ -0,0 +1,166 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECMultiScalarMulBufferSize()
+//        ippsGFpECMultiScalarMul()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+
+/* size of the scalars and points references stored ahead of the gfec_point_msm() buffer */
+static int msmRefsSize(int nItems)
+{
+   return nItems * (Ipp32s)(2*sizeof(BNU_CHUNK_T*) + sizeof(int));
+}
+
+/*F*
+// Name: ippsGFpECMultiScalarMulBufferSize
+//
+// Purpose: Gets the size of the scratch buffer for ippsGFpECMultiScalarMul().
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr          pEC == NULL
+//                              pBufferSize == NULL
+//    ippStsContextMatchErr     invalid pEC->idCtx
+//    ippStsBadArgErr           0>=nItems
+//    ippStsSizeErr             required buffer size exceeds IPP_MAX_32S
+//    ippStsNoErr               no error
+//
+// Parameters:
+//    nItems          Number of points and scalars
+//    pEC             Pointer to the context of the elliptic curve
+//    pBufferSize     Pointer to the calculated buffer size in bytes
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECMultiScalarMulBufferSize,(int nItems, const IppsGFpECState* pEC, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pBufferSize);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr );
+
+   IPP_BADARG_RET( nItems>(IPP_MAX_32S/(Ipp32s)(2*sizeof(BNU_CHUNK_T*)+sizeof(int))), ippStsSizeErr );
+
+   {
+      int msmSize = gfec_point_msm_bufsize(nItems, ECP_ORDBITSIZE(pEC), pEC);
+      int refsSize = msmRefsSize(nItems);
+      IPP_BADARG_RET( 0==msmSize, ippStsSizeErr );
+      IPP_BADARG_RET( msmSize > IPP_MAX_32S - refsSize - (Ipp32s)sizeof(BNU_CHUNK_T*), ippStsSizeErr );
+
+      *pBufferSize = refsSize + (Ipp32s)sizeof(BNU_CHUNK_T*) + msmSize;
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECMultiScalarMul
+//
+// Purpose: Computes multi-scalar multiplication R = [N0]*P0 + [N1]*P1 + ... + [Nn-1]*Pn-1
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppPoints == NULL
+//                                   ppScalars == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   any ppPoints[i] == NULL
+//                                   any ppScalars[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid ppPoints[i]->idCtx
+//                                   invalid ppScalars[i]->idCtx
+//                                   invalid pR->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppPoints[i])!=GFP_FELEN()
+//                                   ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                0>=nItems
+//                                   any ppScalars[i] is negative
+//                                   any ppScalars[i] > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppPoints        Array of pointers to the points on the elliptic curve
+//    ppScalars       Array of pointers to the Big Number contexts storing the scalar values
+//    nItems          Number of points and scalars
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to the scratch buffer of ippsGFpECMultiScalarMulBufferSize() size
+//
+//  Note:
+//    The bucket (Pippenger) method is used, its execution time depends on the scalar values.
+//    The function is intended for the public data (e.g. signature verification) only.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECMultiScalarMul,(const IppsGFpECPoint* const ppPoints[],
+                                           const IppsBigNumState* const ppScalars[],
+                                           int nItems,
+                                           IppsGFpECPoint* pR,
+                                           IppsGFpECState* pEC,
+                                           Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(ppPoints, ppScalars, pR, pEC);
+   IPP_BAD_PTR1_RET(pScratchBuffer);
+   IPP_BADARG_RET( !VALID_ECP_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( 0>=nItems, ippStsBadArgErr );
+
+   IPP_BADARG_RET( !ECP_POINT_VALID_ID(pR), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr );
+
+   {
+      int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+      const BNU_CHUNK_T* pOrder = MOD_MODULUS(ECP_MONT_R(pEC));
+      int orderLen = MOD_LEN(ECP_MONT_R(pEC));
+
+      /* references to the points and scalars */
+      const BNU_CHUNK_T** ppPdata = (const BNU_CHUNK_T**)(IPP_ALIGNED_PTR(pScratchBuffer, sizeof(BNU_CHUNK_T*)));
+      const BNU_CHUNK_T** ppNdata = ppPdata + nItems;
+      int* pNlen = (int*)(ppNdata + nItems);
+      Ipp8u* pMsmBuffer = (Ipp8u*)(pNlen + nItems);
+
+      int i;
+      for(i=0; i<nItems; i++) {
+         const IppsGFpECPoint* pP = ppPoints[i];
+         const IppsBigNumState* pN = ppScalars[i];
+
+         IPP_BAD_PTR2_RET(pP, pN);
+         IPP_BADARG_RET( !ECP_POINT_VALID_ID(pP), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=elemLen, ippStsOutOfRangeErr );
+         IPP_BADARG_RET( !BN_VALID_ID(pN), ippStsContextMatchErr );
+         IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+         IPP_BADARG_RET( 0<cpCmp_BNU(BN_NUMBER(pN), BN_SIZE(pN), pOrder, orderLen), ippStsBadArgErr );
+
+         ppPdata[i] = ECP_POINT_X(pP);
+         ppNdata[i] = BN_NUMBER(pN);
+         pNlen[i] = BN_SIZE(pN);
+      }
+
+      gfec_point_msm(ECP_POINT_X(pR), ppPdata, ppNdata, pNlen, nItems, ECP_ORDBITSIZE(pEC), pEC, pMsmBuffer);
+      ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
+
+      return ippStsNoErr;
+   }
+}
@@ -261,6 +261,8 @@ __IPPCP_INLINE void booth_recode(Ipp8u* sign, Ipp8u* digit, Ipp8u in, int w)
 #define gfec_point_prod OWNAPI(gfec_point_prod)
 #define gfec_base_point_mul OWNAPI(gfec_base_point_mul)
 #define setupTable OWNAPI(setupTable)
+#define gfec_point_msm OWNAPI(gfec_point_msm)
+#define gfec_point_msm_bufsize OWNAPI(gfec_point_msm_bufsize)
 
 IPP_OWN_DECL (void, gfec_point_add, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const BNU_CHUNK_T* pQdata, IppsGFpECState* pEC))
 IPP_OWN_DECL (void, gfec_affine_point_add, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const BNU_CHUNK_T* pAdata, IppsGFpECState* pEC))
@@ -269,6 +271,8 @@ IPP_OWN_DECL (void, gfec_point_mul, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPd
 IPP_OWN_DECL (void, gfec_point_prod, (BNU_CHUNK_T* pointR, const BNU_CHUNK_T* pointA, const Ipp8u* pScalarA, const BNU_CHUNK_T* pointB, const Ipp8u* pScalarB, int scalarBitSize, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 IPP_OWN_DECL (void, gfec_base_point_mul, (BNU_CHUNK_T* pRdata, const Ipp8u* pScalarB, int scalarBitSize, IppsGFpECState* pEC))
 IPP_OWN_DECL (void, setupTable, (BNU_CHUNK_T* pTbl, const BNU_CHUNK_T* pPdata, IppsGFpECState* pEC))
+IPP_OWN_DECL (void, gfec_point_msm, (BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* const ppPdata[], const BNU_CHUNK_T* const ppScalar[], const int pScalarLen[], int nItems, int scalarBitSize, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPP_OWN_DECL (int, gfec_point_msm_bufsize, (int nItems, int scalarBitSize, const IppsGFpECState* pEC))
 
 
 /* size of context */
@@ -0,0 +1,419 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//
+//     Context:
+//        ippsGFpECVerifyDSABatchBufferSize()
+//        ippsGFpECVerifyDSABatch()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpeccp.h"
+
+/*
+// Batch verification:
+//    signature (r,s) of the message h under the public key Q is valid if
+//       R = [u1]G + [u2]Q,  u1 = h/s, u2 = r/s  and x(R) = r
+//    Point R is recovered from r and the recovery id, for the random weights z[i]
+//       [sum(z[i]*u1[i])]G + sum([z[i]*u2[i]]Q[i]) + sum([z[i]](-R[i])) == O
+//    is checked by one multi-scalar multiplication. If the check fails
+//    the set of signatures is bisected until the invalid ones are found.
+*/
+
+/* max bit size of the random weights */
+#define DSA_BATCH_WEIGHT_BITS  (128)
+
+typedef struct {
+   int zLen;                        /* length of the weight */
+   BNU_CHUNK_T* pZ;                 /* weights z[i] */
+   BNU_CHUNK_T* pA;                 /* z[i]*u1[i] mod order */
+   BNU_CHUNK_T* pB;                 /* z[i]*u2[i] mod order */
+   BNU_CHUNK_T* pNegR;              /* points -R[i] */
+   BNU_CHUNK_T* pSumA;              /* sum(z[i]*u1[i]) mod order */
+   BNU_CHUNK_T* pSum;               /* result of the check */
+   const BNU_CHUNK_T** ppPdata;     /* multi-scalar multiplication points */
+   const BNU_CHUNK_T** ppNdata;     /* multi-scalar multiplication scalars */
+   int* pNlen;                      /* length of the scalars */
+   Ipp8u* pBuffer;                  /* scratch buffer */
+} cpDSABatch;
+
+/* size of the per-signature data and references */
+static Ipp64u dsaBatchDataSize(int nItems, const IppsGFpECState* pEC)
+{
+   int orderLen = MOD_LEN(ECP_MONT_R(pEC));
+   Ipp64u chunks = (Ipp64u)nItems * (Ipp64u)(3*orderLen + ECP_POINTLEN(pEC))
+                 + (Ipp64u)orderLen + (Ipp64u)ECP_POINTLEN(pEC);
+   Ipp64u refs = (Ipp64u)(2*nItems+1) * (2*sizeof(BNU_CHUNK_T*) + sizeof(int));
+   return chunks*sizeof(BNU_CHUNK_T) + refs + (Ipp64u)nItems*sizeof(int) + CACHE_LINE_SIZE;
+}
+
+/* size of the scratch buffer for gfec_point_msm() and ippsGFpECVerifyDSA() */
+static int dsaBatchOpBufferSize(int nItems, const IppsGFpECState* pEC)
+{
+   /* ippsGFpECVerifyDSA(): two points table */
+   int prodSize = 2 * ECP_POINTLEN(pEC)*(Ipp32s)sizeof(BNU_CHUNK_T) * (1<<(5-1)) + CACHE_LINE_SIZE;
+   int msmSize = gfec_point_msm_bufsize(2*nItems+1, ECP_ORDBITSIZE(pEC), pEC);
+   if(0==msmSize)
+      return 0;
+   return IPP_MAX(prodSize, msmSize);
+}
+
+/* checks sum of the weighted verification equations of the signatures pIdx[0..num-1] */
+static int dsaBatchCheck(const int* pIdx, int num, const IppsGFpECPoint* const ppRegPublic[], cpDSABatch* pBatch, IppsGFpECState* pEC)
+{
+   gsModEngine* pMontR = ECP_MONT_R(pEC);
+   BNU_CHUNK_T* pOrder = MOD_MODULUS(pMontR);
+   int orderLen = MOD_LEN(pMontR);
+   int pointLen = ECP_POINTLEN(pEC);
+   int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+
+   BNU_CHUNK_T* pTmp = pBatch->pSum;
+   int k;
+
+   cpGFpElementPad(pBatch->pSumA, orderLen, 0);
+   for(k=0; k<num; k++) {
+      int i = pIdx[k];
+      cpModAdd_BNU(pBatch->pSumA, pBatch->pSumA, pBatch->pA+i*orderLen, pOrder, orderLen, pTmp);
+
+      pBatch->ppPdata[1+2*k] = ECP_POINT_X(ppRegPublic[i]);
+      pBatch->ppNdata[1+2*k] = pBatch->pB+i*orderLen;
+      pBatch->pNlen[1+2*k]   = orderLen;
+
+      pBatch->ppPdata[2+2*k] = pBatch->pNegR+i*pointLen;
+      pBatch->ppNdata[2+2*k] = pBatch->pZ+i*orderLen;
+      pBatch->pNlen[2+2*k]   = pBatch->zLen;
+   }
+   pBatch->ppPdata[0] = ECP_G(pEC);
+   pBatch->ppNdata[0] = pBatch->pSumA;
+   pBatch->pNlen[0]   = orderLen;
+
+   gfec_point_msm(pBatch->pSum, pBatch->ppPdata, pBatch->ppNdata, pBatch->pNlen, 2*num+1, ECP_ORDBITSIZE(pEC), pEC, pBatch->pBuffer);
+
+   return GFP_IS_ZERO(pBatch->pSum+2*elemLen, elemLen);
+}
+
+/*
+// bisection of the signatures pIdx[0..num-1] which have not passed the batch check,
+// isFailed - the check of the whole set is known as failed
+*/
+static void dsaBatchBisect(const int* pIdx, int num, int isFailed,
+                           const IppsBigNumState* const ppMsgDigest[],
+                           const IppsGFpECPoint* const ppRegPublic[],
+                           const IppsBigNumState* const ppSignR[], const IppsBigNumState* const ppSignS[],
+                           IppECResult pResult[],
+                           cpDSABatch* pBatch, IppsGFpECState* pEC)
+{
+   int k;
+
+   if(1==num) {
+      int i = pIdx[0];
+      ippsGFpECVerifyDSA(ppMsgDigest[i], ppRegPublic[i], ppSignR[i], ppSignS[i], &pResult[i], pEC, pBatch->pBuffer);
+      return;
+   }
+
+   if(!isFailed && dsaBatchCheck(pIdx, num, ppRegPublic, pBatch, pEC)) {
+      for(k=0; k<num; k++)
+         pResult[pIdx[k]] = ippECValid;
+      return;
+   }
+
+   {
+      int half = num/2;
+      int isHalfValid = dsaBatchCheck(pIdx, half, ppRegPublic, pBatch, pEC);
+      if(isHalfValid) {
+         for(k=0; k<half; k++)
+            pResult[pIdx[k]] = ippECValid;
+      }
+      else
+         dsaBatchBisect(pIdx, half, 1, ppMsgDigest, ppRegPublic, ppSignR, ppSignS, pResult, pBatch, pEC);
+
+      /* if the first half is valid then the second one is known as failed */
+      dsaBatchBisect(pIdx+half, num-half, isHalfValid, ppMsgDigest, ppRegPublic, ppSignR, ppSignS, pResult, pBatch, pEC);
+   }
+}
+
+/*F*
+//    Name: ippsGFpECVerifyDSABatchBufferSize
+//
+// Purpose: Gets the size of the scratch buffer for ippsGFpECVerifyDSABatch().
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pEC
+//                               NULL == pBufferSize
+//
+//    ippStsContextMatchErr      illegal pEC->idCtx
+//
+//    ippStsBadArgErr            0>=nItems
+//
+//    ippStsSizeErr              required buffer size exceeds IPP_MAX_32S
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    nItems         number of signatures
+//    pEC            pointer to the EC context
+//    pBufferSize    pointer to the calculated buffer size in bytes
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECVerifyDSABatchBufferSize,(int nItems, const IppsGFpECState* pEC, int* pBufferSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pBufferSize);
+   IPP_BADARG_RET(!VALID_ECP_ID(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET(0>=nItems, ippStsBadArgErr);
+   IPP_BADARG_RET(nItems>(IPP_MAX_32S/2-1), ippStsSizeErr);
+
+   {
+      Ipp64u dataSize = dsaBatchDataSize(nItems, pEC);
+      int opSize = dsaBatchOpBufferSize(nItems, pEC);
+      IPP_BADARG_RET(0==opSize, ippStsSizeErr);
+      IPP_BADARG_RET(dataSize + (Ipp64u)opSize > (Ipp64u)IPP_MAX_32S, ippStsSizeErr);
+
+      *pBufferSize = (int)(dataSize + (Ipp64u)opSize);
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+//    Name: ippsGFpECVerifyDSABatch
+//
+// Purpose: DSA Signature Verification of several signatures.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           NULL == pEC
+//                               NULL == ppMsgDigest, NULL == ppMsgDigest[i]
+//                               NULL == ppRegPublic, NULL == ppRegPublic[i]
+//                               NULL == ppSignR, NULL == ppSignR[i]
+//                               NULL == ppSignS, NULL == ppSignS[i]
+//                               NULL == pResult
+//                               NULL == rndFunc
+//                               NULL == pScratchBuffer
+//
+//    ippStsContextMatchErr      illegal pEC->idCtx
+//                               pEC->subgroup == NULL
+//                               illegal ppMsgDigest[i]->idCtx
+//                               illegal ppRegPublic[i]->idCtx
+//                               illegal ppSignR[i]->idCtx
+//                               illegal ppSignS[i]->idCtx
+//
+//    ippStsBadArgErr            0>=nItems
+//
+//    ippStsMessageErr           0> MsgDigest[i]
+//                               order<= MsgDigest[i]
+//
+//    ippStsRangeErr             SignR[i] < 0 or SignS[i] < 0
+//
+//    ippStsOutOfRangeErr        bitsize(pRegPublic[i]) != bitsize(prime)
+//
+//    ippStsNotSupportedModeErr  1<GFP_EXTDEGREE(pGFE)
+//
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    ppMsgDigest    array of pointers to the message representatives
+//    ppRegPublic    array of pointers to the regular public keys
+//    ppSignR        array of pointers to the r components of the signatures
+//    ppSignS        array of pointers to the s components of the signatures
+//    pRecoveryId    array of recovery ids of the signatures R points (may be NULL):
+//                      bit 0 - parity of y(R), bit 1 - x(R) = r + order
+//    nItems         number of signatures
+//    pResult        array of results: ippECValid/ippECInvalidSignature
+//    rndFunc        random generator of the weights
+//    pRndParam      pointer to the random generator context
+//    pEC            pointer to the EC context
+//    pScratchBuffer pointer to the buffer of ippsGFpECVerifyDSABatchBufferSize() size
+//
+// Note:
+//    The signatures without recovery ids or with the R points which can not be
+//    recovered are verified one by one. The batch check is done in variable time,
+//    all its input is public.
+//
+*F*/
+IPPFUN(IppStatus, ippsGFpECVerifyDSABatch,(const IppsBigNumState* const ppMsgDigest[],
+                                           const IppsGFpECPoint* const ppRegPublic[],
+                                           const IppsBigNumState* const ppSignR[],
+                                           const IppsBigNumState* const ppSignS[],
+                                           const Ipp8u* pRecoveryId,
+                                           int nItems,
+                                           IppECResult pResult[],
+                                           IppBitSupplier rndFunc, void* pRndParam,
+                                           IppsGFpECState* pEC,
+                                           Ipp8u* pScratchBuffer))
+{
+   IppsGFpState* pGF;
+   gsModEngine* pGFE;
+   int i;
+
+   /* EC context and buffer */
+   IPP_BAD_PTR2_RET(pEC, pScratchBuffer);
+   IPP_BADARG_RET(!VALID_ECP_ID(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   pGF  = ECP_GFP(pEC);
+   pGFE = GFP_PMA(pGF);
+   IPP_BADARG_RET(1 < GFP_EXTDEGREE(pGFE), ippStsNotSupportedModeErr);
+
+   IPP_BAD_PTR4_RET(ppMsgDigest, ppRegPublic, ppSignR, ppSignS);
+   IPP_BAD_PTR2_RET(pResult, rndFunc);
+   IPP_BADARG_RET(0>=nItems, ippStsBadArgErr);
+
+   for(i=0; i<nItems; i++) {
+      /* test message representative */
+      IPP_BAD_PTR1_RET(ppMsgDigest[i]);
+      IPP_BADARG_RET(!BN_VALID_ID(ppMsgDigest[i]), ippStsContextMatchErr);
+      IPP_BADARG_RET(BN_NEGATIVE(ppMsgDigest[i]), ippStsMessageErr);
+      IPP_BADARG_RET(ECP_ORDBITSIZE(pEC) < cpBN_bitsize(ppMsgDigest[i]), ippStsMessageErr);
+
+      /* test regular public key */
+      IPP_BAD_PTR1_RET(ppRegPublic[i]);
+      IPP_BADARG_RET(!ECP_POINT_VALID_ID(ppRegPublic[i]), ippStsContextMatchErr);
+      IPP_BADARG_RET(ECP_POINT_FELEN(ppRegPublic[i]) != GFP_FELEN(pGFE), ippStsOutOfRangeErr);
+
+      /* test signature */
+      IPP_BAD_PTR2_RET(ppSignR[i], ppSignS[i]);
+      IPP_BADARG_RET(!BN_VALID_ID(ppSignR[i]), ippStsContextMatchErr);
+      IPP_BADARG_RET(!BN_VALID_ID(ppSignS[i]), ippStsContextMatchErr);
+      IPP_BADARG_RET(BN_NEGATIVE(ppSignR[i]), ippStsRangeErr);
+      IPP_BADARG_RET(BN_NEGATIVE(ppSignS[i]), ippStsRangeErr);
+   }
+
+   {
+      gsModEngine* pMontR = ECP_MONT_R(pEC);
+      BNU_CHUNK_T* pOrder = MOD_MODULUS(pMontR);
+      int orderLen = MOD_LEN(pMontR);
+      int elemLen = GFP_FELEN(pGFE);
+      int pelmLen = GFP_PELEN(pGFE);
+      int pointLen = ECP_POINTLEN(pEC);
+      int zBits = IPP_MIN(DSA_BATCH_WEIGHT_BITS, ECP_ORDBITSIZE(pEC)-1);
+
+      cpDSABatch batch;
+      int* pIdx;
+      int numBatch = 0;
+
+      /* scratch buffer layout */
+      batch.zLen    = BITS_BNU_CHUNK(zBits);
+      batch.pZ      = (BNU_CHUNK_T*)(IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE));
+      batch.pA      = batch.pZ + nItems*orderLen;
+      batch.pB      = batch.pA + nItems*orderLen;
+      batch.pNegR   = batch.pB + nItems*orderLen;
+      batch.pSumA   = batch.pNegR + nItems*pointLen;
+      batch.pSum    = batch.pSumA + orderLen;
+      batch.ppPdata = (const BNU_CHUNK_T**)(batch.pSum + pointLen);
+      batch.ppNdata = batch.ppPdata + (2*nItems+1);
+      batch.pNlen   = (int*)(batch.ppNdata + (2*nItems+1));
+      pIdx          = batch.pNlen + (2*nItems+1);
+      batch.pBuffer = (Ipp8u*)(pIdx + nItems);
+
+      for(i=0; i<nItems; i++) {
+         const IppsBigNumState* pSignR = ppSignR[i];
+         const IppsBigNumState* pSignS = ppSignS[i];
+
+         pResult[i] = ippECInvalidSignature;
+
+         /* test signature value */
+         if(cpEqu_BNU_CHUNK(BN_NUMBER(pSignR), BN_SIZE(pSignR), 0) ||
+            cpEqu_BNU_CHUNK(BN_NUMBER(pSignS), BN_SIZE(pSignS), 0) ||
+            0 <= cpCmp_BNU(BN_NUMBER(pSignR), BN_SIZE(pSignR), pOrder, orderLen) ||
+            0 <= cpCmp_BNU(BN_NUMBER(pSignS), BN_SIZE(pSignS), pOrder, orderLen))
+            continue;
+
+         /* no recovery id: verify the signature alone */
+         if(!pRecoveryId) {
+            ippsGFpECVerifyDSA(ppMsgDigest[i], ppRegPublic[i], pSignR, pSignS, &pResult[i], pEC, batch.pBuffer);
+            continue;
+         }
+
+         {
+            BNU_CHUNK_T* pX = cpGFpGetPool(3, pGFE);
+            BNU_CHUNK_T* pH = pX + pelmLen;
+            BNU_CHUNK_T* pT = pH + pelmLen;
+            BNU_CHUNK_T* pNegR = batch.pNegR + i*pointLen;
+            int xLen;
+            int isRecovered = 0;
+
+            /* x(R) = r or r + order */
+            ZEXPAND_COPY_BNU(pX, pelmLen, BN_NUMBER(pSignR), BN_SIZE(pSignR));
+            if(pRecoveryId[i] & 2) {
+               cpGFpElementPad(pH, pelmLen, 0);
+               cpGFpElementCopy(pH, pOrder, orderLen);
+               cpAdd_BNU(pX, pX, pH, pelmLen);
+            }
+
+            xLen = pelmLen;
+            FIX_BNU(pX, xLen);
+            if(0 > cpCmp_BNU(pX, xLen, GFP_MODULUS(pGFE), elemLen)) {
+               IppsGFpECPoint R;
+               cpEcGFpInitPoint(&R, pNegR, 0, pEC);
+               GFP_METHOD(pGFE)->encode(pX, pX, pGFE);
+               if(gfec_MakePoint(&R, pX, pEC)) {
+                  /* -R has y of the opposite parity */
+                  GFP_METHOD(pGFE)->decode(pT, ECP_POINT_Y(&R), pGFE);
+                  if((pT[0] & 1) == (BNU_CHUNK_T)(pRecoveryId[i] & 1))
+                     GFP_METHOD(pGFE)->neg(ECP_POINT_Y(&R), ECP_POINT_Y(&R), pGFE);
+                  isRecovered = 1;
+               }
+            }
+
+            if(isRecovered) {
+               BNU_CHUNK_T* pZ = batch.pZ + i*orderLen;
+               BNU_CHUNK_T* pA = batch.pA + i*orderLen;
+               BNU_CHUNK_T* pB = batch.pB + i*orderLen;
+               IppStatus sts;
+
+               /* random weight z */
+               cpGFpElementPad(pZ, orderLen, 0);
+               sts = rndFunc((Ipp32u*)pZ, zBits, pRndParam);
+               if(ippStsNoErr != sts) {
+                  cpGFpReleasePool(3, pGFE);
+                  return sts;
+               }
+               if(cpEqu_BNU_CHUNK(pZ, orderLen, 0))
+                  pZ[0] = 1;
+
+               /* u1 = msg/s, u2 = r/s */
+               ZEXPAND_COPY_BNU(pA, orderLen, BN_NUMBER(ppMsgDigest[i]), BN_SIZE(ppMsgDigest[i]));
+               cpModSub_BNU(pA, pA, pOrder, pOrder, orderLen, pT);
+               ZEXPAND_COPY_BNU(pH, orderLen, BN_NUMBER(pSignS), BN_SIZE(pSignS));
+               gs_mont_inv(pH, pH, pMontR, alm_mont_inv);
+               cpMontMul_BNU(pA, pH, pA, pMontR);
+               ZEXPAND_COPY_BNU(pB, orderLen, BN_NUMBER(pSignR), BN_SIZE(pSignR));
+               cpMontMul_BNU(pB, pH, pB, pMontR);
+
+               /* z*u1, z*u2 */
+               cpMontEnc_BNU(pH, pZ, pMontR);
+               cpMontMul_BNU(pA, pH, pA, pMontR);
+               cpMontMul_BNU(pB, pH, pB, pMontR);
+
+               pIdx[numBatch++] = i;
+            }
+
+            cpGFpReleasePool(3, pGFE);
+
+            /* R can not be recovered: verify the signature alone */
+            if(!isRecovered)
+               ippsGFpECVerifyDSA(ppMsgDigest[i], ppRegPublic[i], pSignR, pSignS, &pResult[i], pEC, batch.pBuffer);
+         }
+      }
+
+      if(numBatch)
+         dsaBatchBisect(pIdx, numBatch, 0, ppMsgDigest, ppRegPublic, ppSignR, ppSignS, pResult, &batch, pEC);
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,121 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     Internal operations over GF(p) extension.
+//
+//     Context:
+//        cpGFpxBatchInv()
+//
+*/
+#include "owncp.h"
+#include "pcpgfpxstuff.h"
+#include "pcpmask_ct.h"
+
+/*
+// Simultaneous inversion (Montgomery's trick):
+//    P[i] = A[0]*...*A[i],  t = 1/P[n-1],
+//    1/A[i] = t*P[i-1], t = t*A[i]  for i = n-1,...,1
+// costs one inversion and 3(n-1) multiplications.
+//
+// Zero elements are mapped to zero.
+// isCT==0: zero elements are skipped, the inversion is not constant time (public data)
+// isCT!=0: zero elements are replaced by 1 under the mask,
+//          constant time (for the basic field GF(p)) regardless of the element values
+//
+// pBuffer holds nItems elements of the product P.
+// ppR[i] and ppA[i] may point to the same element.
+*/
+IPP_OWN_DEFN (void, cpGFpxBatchInv, (BNU_CHUNK_T* const ppR[], const BNU_CHUNK_T* const ppA[], int nItems, int isCT, gsModEngine* pGFEx, BNU_CHUNK_T* pBuffer))
+{
+   int elemLen = GFP_FELEN(pGFEx);
+   mod_mul mulF = GFP_METHOD(pGFEx)->mul;
+
+   BNU_CHUNK_T* pA = cpGFpGetPool(3, pGFEx);
+   BNU_CHUNK_T* pInv = pA + GFP_PELEN(pGFEx);
+   BNU_CHUNK_T* pT = pInv + GFP_PELEN(pGFEx);
+
+   const BNU_CHUNK_T* pPrev = NULL;
+   int i;
+
+   /* products */
+   for(i=0; i<nItems; i++) {
+      BNU_CHUNK_T* pProd = pBuffer + i*elemLen;
+
+      if(isCT) {
+         const BNU_CHUNK_T* pAi = ppA[i];
+         BNU_CHUNK_T isZero = GFPE_IS_ZERO_CT(pAi, elemLen);
+         MASKED_COPY_BNU(pA, isZero, GFP_MNT_R(pGFEx), pAi, elemLen);
+      }
+      else {
+         if(GFP_IS_ZERO(ppA[i], elemLen)) {
+            cpGFpElementCopy(pProd, pPrev? pPrev : GFP_MNT_R(pGFEx), elemLen);
+            pPrev = pProd;
+            continue;
+         }
+         cpGFpElementCopy(pA, ppA[i], elemLen);
+      }
+
+      if(pPrev)
+         mulF(pProd, pPrev, pA, pGFEx);
+      else
+         cpGFpElementCopy(pProd, pA, elemLen);
+      pPrev = pProd;
+   }
+
+   /* one inversion */
+   if(!isCT && GFP_IS_BASIC(pGFEx)) {
+      GFP_METHOD(pGFEx)->decode(pInv, pPrev, pGFEx);
+      gs_mont_inv(pInv, pInv, pGFEx, alm_mont_inv);
+   }
+   else
+      cpGFpxInv(pInv, pPrev, pGFEx);
+
+   /* inverses */
+   for(i=nItems-1; i>=0; i--) {
+      if(isCT) {
+         const BNU_CHUNK_T* pAi = ppA[i];
+         BNU_CHUNK_T* pRi = ppR[i];
+         BNU_CHUNK_T isZero = GFPE_IS_ZERO_CT(pAi, elemLen);
+         MASKED_COPY_BNU(pA, isZero, GFP_MNT_R(pGFEx), pAi, elemLen);
+
+         if(i)
+            mulF(pT, pInv, pBuffer+(i-1)*elemLen, pGFEx);
+         else
+            cpGFpElementCopy(pT, pInv, elemLen);
+         mulF(pInv, pInv, pA, pGFEx);
+
+         /* zero element: 1/0 = 0 */
+         cpGFpElementPad(pA, elemLen, 0);
+         MASKED_COPY_BNU(pRi, isZero, pA, pT, elemLen);
+      }
+      else {
+         if(GFP_IS_ZERO(ppA[i], elemLen)) {
+            cpGFpElementPad(ppR[i], elemLen, 0);
+            continue;
+         }
+         if(i)
+            mulF(pT, pInv, pBuffer+(i-1)*elemLen, pGFEx);
+         else
+            cpGFpElementCopy(pT, pInv, elemLen);
+         mulF(pInv, pInv, ppA[i], pGFEx);
+         cpGFpElementCopy(ppR[i], pT, elemLen);
+      }
+   }
+
+   cpGFpReleasePool(3, pGFEx);
+}
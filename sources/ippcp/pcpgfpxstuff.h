@@ -135,6 +135,8 @@ __IPPCP_INLINE int cpGFpxCopyFromChunk(Ipp32u* pA, const BNU_CHUNK_T* pElm, cons
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxNeg, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
 #define cpGFpxInv OWNAPI(cpGFpxInv)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxInv, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
+#define cpGFpxBatchInv OWNAPI(cpGFpxBatchInv)
+   IPP_OWN_DECL (void, cpGFpxBatchInv, (BNU_CHUNK_T* const ppR[], const BNU_CHUNK_T* const ppA[], int nItems, int isCT, gsModEngine* pGFEx, BNU_CHUNK_T* pBuffer))
 #define cpGFpxHalve OWNAPI(cpGFpxHalve)
    IPP_OWN_DECL (BNU_CHUNK_T*, cpGFpxHalve, (BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFEx))
 #define InitGFpxCtx OWNAPI(InitGFpxCtx)
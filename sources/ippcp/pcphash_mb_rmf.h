@@ -0,0 +1,73 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Internal Definitions and Internal Functions Prototypes
+//
+*/
+
+#if !defined(_CP_HASH_MB_RMF_H)
+#define _CP_HASH_MB_RMF_H
+
+#include "pcphash.h"
+#include "pcphashmethod_rmf.h"
+
+/* max number of buffers processed simultaneously */
+#define HASH_MB_MAX_BUFFERS   (IPP_HASH_MB_MAX_BUFFERS)
+
+/* generalized multi-buffer hash context */
+struct _cpHashCtx_MB_rmf {
+   Ipp32u      idCtx;                                          /* hash identifier   */
+   const cpHashMethod_rmf* pMethod;                            /* hash methods      */
+   int         numBuffers;                                     /* number of buffers */
+   int         msgBuffIdx[HASH_MB_MAX_BUFFERS];                /* buffer index      */
+   Ipp64u      msgLenLo[HASH_MB_MAX_BUFFERS];                  /* processed message */
+   Ipp64u      msgLenHi[HASH_MB_MAX_BUFFERS];                  /* length (bytes)    */
+   Ipp8u       msgBuffer[HASH_MB_MAX_BUFFERS][MBS_HASH_MAX];   /* buffer            */
+   cpHash      msgHash[HASH_MB_MAX_BUFFERS];                   /* hash values       */
+};
+
+/* accessors (see others in pcphash.h) */
+#define HASH_MB_METHOD(stt)      ((stt)->pMethod)
+#define HASH_MB_NUM_BUFFERS(stt) ((stt)->numBuffers)
+
+/*
+// Hash of whole message blocks of several buffers:
+// msgLen[i] is multiple of message block size, hash values are updated in place
+*/
+#define cpHashUpdate_MB_rmf OWNAPI(cpHashUpdate_MB_rmf)
+   IPP_OWN_DECL (void, cpHashUpdate_MB_rmf, (cpHash pHash[], const Ipp8u* const pMsg[], const int msgLen[], int numBuffers, const IppsHashMethod* method))
+#define cpFinalize_MB_rmf OWNAPI(cpFinalize_MB_rmf)
+   IPP_OWN_DECL (void, cpFinalize_MB_rmf, (cpHash pHash[], const Ipp8u* const inpBuffer[], const int inpLen[], const Ipp64u lenLo[], const Ipp64u lenHi[], int numBuffers, const IppsHashMethod* method))
+
+#if (_IPP32E>=_IPP32E_K1)
+/* 16-lane SHA-256 and 8-lane SHA-512 compression functions (Intel® AVX-512 instructions) */
+#define cpSHA256_MB16_avx512 OWNAPI(cpSHA256_MB16_avx512)
+   IPP_OWN_DECL (void, cpSHA256_MB16_avx512, (cpHash pHash[16], const Ipp8u* const pMsg[16], const int nBlocks[16]))
+#define cpSHA512_MB8_avx512 OWNAPI(cpSHA512_MB8_avx512)
+   IPP_OWN_DECL (void, cpSHA512_MB8_avx512, (cpHash pHash[8], const Ipp8u* const pMsg[8], const int nBlocks[8]))
+#endif
+
+#if (_IPP32E>=_IPP32E_L9)
+/* 8-lane SHA-256 compression function (Intel® AVX2 instructions) */
+#define cpSHA256_MB8_avx2 OWNAPI(cpSHA256_MB8_avx2)
+   IPP_OWN_DECL (void, cpSHA256_MB8_avx2, (cpHash pHash[8], const Ipp8u* const pMsg[8], const int nBlocks[8]))
+#endif
+
+#endif /* _CP_HASH_MB_RMF_H */
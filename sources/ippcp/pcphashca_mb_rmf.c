@@ -0,0 +1,159 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Generalized Functionality
+//
+//  Contents:
+//     cpHashUpdate_MB_rmf()
+//     cpFinalize_MB_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+#include "pcptool.h"
+
+#if (_IPP32E>=_IPP32E_L9)
+/*
+// Min number of non-empty buffers to use multi-buffer kernels,
+// a few buffers are processed faster by single-buffer code (e.g. SHA-NI)
+*/
+#define SHA256_MB16_MIN_BUFFERS  (4)
+#define SHA512_MB8_MIN_BUFFERS   (2)
+#define SHA256_MB8_MIN_BUFFERS   (4)
+#endif
+
+IPP_OWN_DEFN (void, cpHashUpdate_MB_rmf, (cpHash pHash[], const Ipp8u* const pMsg[], const int msgLen[], int numBuffers, const IppsHashMethod* method))
+{
+   int n = 0;
+
+   #if (_IPP32E>=_IPP32E_K1)
+   IppHashAlgId algId = method->hashAlgId;
+   int isSHA256 = (ippHashAlg_SHA256==algId) || (ippHashAlg_SHA224==algId);
+   int isSHA512 = (ippHashAlg_SHA512==algId) || (ippHashAlg_SHA384==algId)
+               || (ippHashAlg_SHA512_224==algId) || (ippHashAlg_SHA512_256==algId);
+
+   if(isSHA256 || isSHA512) {
+      int mbs = method->msgBlkSize; /* message block size */
+      int nLanes = isSHA256 ? 16 : 8;
+      int minBuffers = isSHA256 ? SHA256_MB16_MIN_BUFFERS : SHA512_MB8_MIN_BUFFERS;
+
+      for(; (numBuffers-n) >= minBuffers; n += nLanes) {
+         const Ipp8u* pBlk[16];
+         int nBlocks[16];
+         int nActive = 0;
+         int i;
+
+         for(i=0; i<nLanes; i++) {
+            int k = n+i;
+            int isActive = (k<numBuffers) && (msgLen[k]>0);
+            pBlk[i]    = isActive ? pMsg[k] : NULL;
+            nBlocks[i] = isActive ? msgLen[k]/mbs : 0;
+            nActive += isActive;
+         }
+
+         if(nActive < minBuffers) {
+            /* process by single-buffer code */
+            for(i=0; i<nLanes; i++) {
+               if(nBlocks[i])
+                  method->hashUpdate(pHash[n+i], pBlk[i], msgLen[n+i]);
+            }
+         }
+         else if(isSHA256)
+            cpSHA256_MB16_avx512(pHash+n, pBlk, nBlocks);
+         else
+            cpSHA512_MB8_avx512(pHash+n, pBlk, nBlocks);
+      }
+   }
+   #elif (_IPP32E>=_IPP32E_L9)
+   IppHashAlgId algId = method->hashAlgId;
+   int isSHA256 = (ippHashAlg_SHA256==algId) || (ippHashAlg_SHA224==algId);
+
+   if(isSHA256) {
+      for(; (numBuffers-n) >= SHA256_MB8_MIN_BUFFERS; n += 8) {
+         const Ipp8u* pBlk[8];
+         int nBlocks[8];
+         int nActive = 0;
+         int i;
+
+         for(i=0; i<8; i++) {
+            int k = n+i;
+            int isActive = (k<numBuffers) && (msgLen[k]>0);
+            pBlk[i]    = isActive ? pMsg[k] : NULL;
+            nBlocks[i] = isActive ? msgLen[k]/MBS_SHA256 : 0;
+            nActive += isActive;
+         }
+
+         if(nActive < SHA256_MB8_MIN_BUFFERS) {
+            /* process by single-buffer code */
+            for(i=0; i<8; i++) {
+               if(nBlocks[i])
+                  method->hashUpdate(pHash[n+i], pBlk[i], msgLen[n+i]);
+            }
+         }
+         else
+            cpSHA256_MB8_avx2(pHash+n, pBlk, nBlocks);
+      }
+   }
+   #endif
+
+   /* the rest of buffers */
+   for(; n<numBuffers; n++) {
+      if(msgLen[n])
+         method->hashUpdate(pHash[n], pMsg[n], msgLen[n]);
+   }
+}
+
+IPP_OWN_DEFN (void, cpFinalize_MB_rmf, (cpHash pHash[], const Ipp8u* const inpBuffer[], const int inpLen[], const Ipp64u lenLo[], const Ipp64u lenHi[], int numBuffers, const IppsHashMethod* method))
+{
+   int mbs = method->msgBlkSize;    /* message block size */
+   int mrl = method->msgLenRepSize; /* processed length representation size */
+
+   /* local buffers and their lengths */
+   Ipp8u buffer[HASH_MB_MAX_BUFFERS][MBS_SHA512*2];
+   const Ipp8u* pBuffer[HASH_MB_MAX_BUFFERS];
+   int bufferLen[HASH_MB_MAX_BUFFERS];
+   int n;
+
+   for(n=0; n<numBuffers; n++) {
+      int len = inpLen[n];
+      bufferLen[n] = len < (mbs-mrl)? mbs : mbs*2;
+      pBuffer[n] = buffer[n];
+
+      /* copy rest of message into internal buffer */
+      CopyBlock(inpBuffer[n], buffer[n], len);
+
+      /* pad message */
+      buffer[n][len++] = 0x80;
+      PadBlock(0, buffer[n]+len, bufferLen[n]-len-mrl);
+
+      /* message length representation */
+      method->msgLenRep(buffer[n]+bufferLen[n]-mrl, lenLo[n], lenHi[n]);
+   }
+
+   /* complete hash computation */
+   cpHashUpdate_MB_rmf(pHash, pBuffer, bufferLen, numBuffers, method);
+
+   /* clear the padded copies of the message tails */
+   for(n=0; n<numBuffers; n++)
+      PurgeBlock(buffer[n], bufferLen[n]);
+}
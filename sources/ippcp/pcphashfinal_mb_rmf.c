@@ -0,0 +1,86 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Generalized Functionality
+//
+//  Contents:
+//        ippsHashFinal_MB_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsHashFinal_MB_rmf
+//
+// Purpose: Complete messages digesting and return digests.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           pMD == NULL
+//                               pMD[i] == NULL
+//                               pState == NULL
+//    ippStsContextMatchErr      pState->idCtx != idCtxHashMB
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    pMD     array of addresses of the output digests
+//    pState  pointer to the multi-buffer Hash state
+//
+*F*/
+IPPFUN(IppStatus, ippsHashFinal_MB_rmf,(Ipp8u* const pMD[], IppsHashState_MB_rmf* pState))
+{
+   /* test state pointer and ID */
+   IPP_BAD_PTR2_RET(pMD, pState);
+   IPP_BADARG_RET(!HASH_VALID_ID(pState, idCtxHashMB), ippStsContextMatchErr);
+
+   {
+      const IppsHashMethod* method = HASH_MB_METHOD(pState);
+      int numBuffers = HASH_MB_NUM_BUFFERS(pState);
+      const Ipp8u* pBuff[HASH_MB_MAX_BUFFERS] = {NULL};
+      int n;
+
+      for(n=0; n<numBuffers; n++) {
+         IPP_BAD_PTR1_RET(pMD[n]);
+         pBuff[n] = HASH_BUFF(pState)[n];
+      }
+
+      cpFinalize_MB_rmf(HASH_VALUE(pState),
+                        pBuff, HASH_BUFFIDX(pState),
+                        HASH_LENLO(pState), HASH_LENHI(pState),
+                        numBuffers, method);
+
+      for(n=0; n<numBuffers; n++) {
+         /* convert hash into oct string */
+         method->hashOctStr(pMD[n], HASH_VALUE(pState)[n]);
+
+         /* re-init hash value */
+         HASH_BUFFIDX(pState)[n] = 0;
+         HASH_LENLO(pState)[n] = 0;
+         HASH_LENHI(pState)[n] = 0;
+         method->hashInit(HASH_VALUE(pState)[n]);
+      }
+
+      return ippStsNoErr;
+   }
+}
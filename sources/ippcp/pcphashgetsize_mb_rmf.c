@@ -0,0 +1,54 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Generalized Functionality
+//
+//  Contents:
+//        ippsHashGetSize_MB_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+
+/*F*
+//    Name: ippsHashGetSize_MB_rmf
+//
+// Purpose: Returns size (bytes) of IppsHashState_MB_rmf state.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize       pointer to state size
+//
+*F*/
+IPPFUN(IppStatus, ippsHashGetSize_MB_rmf,(int* pSize))
+{
+   /* test pointers */
+   IPP_BAD_PTR1_RET(pSize);
+
+   *pSize = sizeof(IppsHashState_MB_rmf);
+
+   return ippStsNoErr;
+}
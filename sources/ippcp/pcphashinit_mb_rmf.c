@@ -0,0 +1,70 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Generalized Functionality
+//
+//  Contents:
+//        ippsHashInit_MB_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsHashInit_MB_rmf
+//
+// Purpose: Init multi-buffer Hash state.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr           pState == NULL
+//                               pMethod == NULL
+//    ippStsSizeErr              numBuffers < 1 or numBuffers > IPP_HASH_MB_MAX_BUFFERS
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    pState      pointer to the multi-buffer Hash state
+//    pMethod     hash method
+//    numBuffers  number of buffers
+//
+*F*/
+IPPFUN(IppStatus, ippsHashInit_MB_rmf,(IppsHashState_MB_rmf* pState, const IppsHashMethod* pMethod, int numBuffers))
+{
+   /* test ctx pointers */
+   IPP_BAD_PTR2_RET(pState, pMethod);
+   /* test number of buffers */
+   IPP_BADARG_RET((numBuffers<1) || (numBuffers>HASH_MB_MAX_BUFFERS), ippStsSizeErr);
+
+   {
+      int n;
+
+      PadBlock(0, pState, sizeof(IppsHashState_MB_rmf));
+      HASH_MB_METHOD(pState) = pMethod;
+      HASH_MB_NUM_BUFFERS(pState) = numBuffers;
+      HASH_SET_ID(pState, idCtxHashMB);
+      for(n=0; n<numBuffers; n++)
+         pMethod->hashInit(HASH_VALUE(pState)[n]);
+
+      return ippStsNoErr;
+   }
+}
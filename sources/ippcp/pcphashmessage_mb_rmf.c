@@ -0,0 +1,106 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Generalized Functionality
+//
+//  Contents:
+//        ippsHashMessage_MB_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsHashMessage_MB_rmf
+//
+// Purpose: Hash of the whole messages of several buffers.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr           pMsg == NULL
+//                               len == NULL
+//                               pMD == NULL
+//                               pMD[i] == NULL
+//                               pMethod == NULL
+//                               pMsg[i] == NULL but len[i]!=0
+//    ippStsSizeErr              numBuffers < 1 or numBuffers > IPP_HASH_MB_MAX_BUFFERS
+//    ippStsLengthErr            len[i] <0
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    pMsg        array of pointers to the input messages
+//    len         array of input messages lengths
+//    pMD         array of addresses of the output digests
+//    numBuffers  number of buffers
+//    pMethod     hash methods
+//
+*F*/
+IPPFUN(IppStatus, ippsHashMessage_MB_rmf,(const Ipp8u* const pMsg[], const int len[], Ipp8u* const pMD[],
+                                          int numBuffers, const IppsHashMethod* pMethod))
+{
+   /* test pointers */
+   IPP_BAD_PTR4_RET(pMsg, len, pMD, pMethod);
+   /* test number of buffers */
+   IPP_BADARG_RET((numBuffers<1) || (numBuffers>HASH_MB_MAX_BUFFERS), ippStsSizeErr);
+
+   {
+      cpHash hash[HASH_MB_MAX_BUFFERS];
+      const Ipp8u* pMsgRest[HASH_MB_MAX_BUFFERS];
+      int msgLenBlks[HASH_MB_MAX_BUFFERS];
+      int msgLenRest[HASH_MB_MAX_BUFFERS];
+      Ipp64u lenLo[HASH_MB_MAX_BUFFERS];
+      Ipp64u lenHi[HASH_MB_MAX_BUFFERS];
+      int n;
+
+      /* test messages and digests */
+      for(n=0; n<numBuffers; n++) {
+         IPP_BAD_PTR1_RET(pMD[n]);
+         IPP_BADARG_RET(0>len[n], ippStsLengthErr);
+         IPP_BADARG_RET((len[n] && !pMsg[n]), ippStsNullPtrErr);
+      }
+
+      for(n=0; n<numBuffers; n++) {
+         /* message length in the multiple MBS and the rest */
+         msgLenBlks[n] = len[n] &(-pMethod->msgBlkSize);
+         msgLenRest[n] = len[n] - msgLenBlks[n];
+         pMsgRest[n] = pMsg[n] + msgLenBlks[n];
+         lenLo[n] = (Ipp64u)len[n];
+         lenHi[n] = 0;
+
+         /* init hash */
+         pMethod->hashInit(hash[n]);
+      }
+
+      /* process main part of the messages */
+      cpHashUpdate_MB_rmf(hash, pMsg, msgLenBlks, numBuffers, pMethod);
+      cpFinalize_MB_rmf(hash,
+                        pMsgRest, msgLenRest,
+                        lenLo, lenHi,
+                        numBuffers, pMethod);
+
+      for(n=0; n<numBuffers; n++)
+         pMethod->hashOctStr(pMD[n], hash[n]);
+
+      return ippStsNoErr;
+   }
+}
@@ -0,0 +1,127 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Security Hash Standard
+//     Multi-buffer Generalized Functionality
+//
+//  Contents:
+//        ippsHashUpdate_MB_rmf()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+#include "pcptool.h"
+
+/*F*
+//    Name: ippsHashUpdate_MB_rmf
+//
+// Purpose: Updates intermediate hash values based on input streams.
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr           pState == NULL
+//                               pSrc == NULL
+//                               len == NULL
+//    ippStsNullPtrErr           pSrc[i]==0 but len[i]!=0
+//    ippStsContextMatchErr      pState->idCtx != idCtxHashMB
+//    ippStsLengthErr            len[i] <0
+//    ippStsNoErr                no errors
+//
+// Parameters:
+//    pSrc     array of pointers to the input streams
+//    len      array of input streams lengths
+//    pState   pointer to the multi-buffer Hash state
+//
+*F*/
+IPPFUN(IppStatus, ippsHashUpdate_MB_rmf,(const Ipp8u* const pSrc[], const int len[], IppsHashState_MB_rmf* pState))
+{
+   /* test state pointer and ID */
+   IPP_BAD_PTR3_RET(pSrc, len, pState);
+   IPP_BADARG_RET(!HASH_VALID_ID(pState, idCtxHashMB), ippStsContextMatchErr);
+
+   {
+      const IppsHashMethod* method = HASH_MB_METHOD(pState);
+      int msgBlkSize = method->msgBlkSize;   /* message block size */
+      int numBuffers = HASH_MB_NUM_BUFFERS(pState);
+
+      const Ipp8u* pMsg[HASH_MB_MAX_BUFFERS] = {NULL};
+      int msgLen[HASH_MB_MAX_BUFFERS] = {0};
+      const Ipp8u* pBlk[HASH_MB_MAX_BUFFERS] = {NULL};
+      int blkLen[HASH_MB_MAX_BUFFERS] = {0};
+      int n;
+
+      /* test input streams */
+      for(n=0; n<numBuffers; n++) {
+         IPP_BADARG_RET((len[n]<0), ippStsLengthErr);
+         IPP_BADARG_RET((len[n] && !pSrc[n]), ippStsNullPtrErr);
+      }
+
+      for(n=0; n<numBuffers; n++) {
+         int idx = HASH_BUFFIDX(pState)[n];
+
+         /* update length of processed message */
+         Ipp64u lenLo = HASH_LENLO(pState)[n] + (Ipp64u)len[n];
+         if(lenLo < HASH_LENLO(pState)[n]) HASH_LENHI(pState)[n]++;
+         HASH_LENLO(pState)[n] = lenLo;
+
+         pMsg[n] = pSrc[n];
+         msgLen[n] = len[n];
+         pBlk[n] = HASH_BUFF(pState)[n];
+         blkLen[n] = 0;
+
+         /* if internal buffer is not empty */
+         if(idx) {
+            int procLen = IPP_MIN(msgLen[n], (msgBlkSize-idx));
+            CopyBlock(pMsg[n], HASH_BUFF(pState)[n]+idx, procLen);
+            idx += procLen;
+
+            /* complete message block will be processed */
+            if(msgBlkSize==idx) {
+               blkLen[n] = msgBlkSize;
+               idx = 0;
+            }
+
+            /* update message pointer and length */
+            pMsg[n] += procLen;
+            msgLen[n] -= procLen;
+            HASH_BUFFIDX(pState)[n] = idx;
+         }
+      }
+      /* process complete internal buffers */
+      cpHashUpdate_MB_rmf(HASH_VALUE(pState), pBlk, blkLen, numBuffers, method);
+
+      /* process main part of the inputs */
+      for(n=0; n<numBuffers; n++)
+         blkLen[n] = msgLen[n] & ~(msgBlkSize-1);
+      cpHashUpdate_MB_rmf(HASH_VALUE(pState), pMsg, blkLen, numBuffers, method);
+
+      /* store the rest of inputs in the buffers */
+      for(n=0; n<numBuffers; n++) {
+         int rest = msgLen[n] - blkLen[n];
+         if(rest) {
+            CopyBlock(pMsg[n]+blkLen[n], HASH_BUFF(pState)[n], rest);
+            HASH_BUFFIDX(pState)[n] += rest;
+         }
+      }
+
+      return ippStsNoErr;
+   }
+}
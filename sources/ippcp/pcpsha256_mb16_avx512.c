@@ -0,0 +1,163 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Multi-buffer SHA256 message digest (16 buffers)
+//
+//  Contents:
+//     cpSHA256_MB16_avx512()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+
+#if (_IPP32E>=_IPP32E_K1)
+
+/* SHA256 logical functions */
+#define SIGMA0(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi32((x), 2), _mm512_ror_epi32((x),13)), _mm512_ror_epi32((x),22))
+#define SIGMA1(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi32((x), 6), _mm512_ror_epi32((x),11)), _mm512_ror_epi32((x),25))
+#define sigma0(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi32((x), 7), _mm512_ror_epi32((x),18)), _mm512_srli_epi32((x), 3))
+#define sigma1(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi32((x),17), _mm512_ror_epi32((x),19)), _mm512_srli_epi32((x),10))
+#define CH(x,y,z)    _mm512_ternarylogic_epi32((x),(y),(z), 0xCA)
+#define MAJ(x,y,z)   _mm512_ternarylogic_epi32((x),(y),(z), 0xE8)
+
+/*
+// Load 64-byte message blocks of 16 buffers and transpose them:
+// w[t] keeps t-th big-endian word of message block of all buffers
+*/
+static void loadTransposeBlocks16(__m512i w[16], const Ipp8u* const pMsg[16], __mmask16 laneMask)
+{
+   const __m512i bswap = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+   __m512i r[16], t[16];
+   int i;
+
+   /* blocks of inactive buffers are not loaded */
+   for(i=0; i<16; i++)
+      r[i] = _mm512_maskz_loadu_epi32((__mmask16)(0 - ((laneMask>>i) & 1)), pMsg[i]);
+
+   for(i=0; i<16; i+=2) {
+      t[i]   = _mm512_unpacklo_epi32(r[i], r[i+1]);
+      t[i+1] = _mm512_unpackhi_epi32(r[i], r[i+1]);
+   }
+   for(i=0; i<16; i+=4) {
+      r[i]   = _mm512_unpacklo_epi64(t[i],   t[i+2]);
+      r[i+1] = _mm512_unpackhi_epi64(t[i],   t[i+2]);
+      r[i+2] = _mm512_unpacklo_epi64(t[i+1], t[i+3]);
+      r[i+3] = _mm512_unpackhi_epi64(t[i+1], t[i+3]);
+   }
+   for(i=0; i<4; i++) {
+      t[i]    = _mm512_shuffle_i32x4(r[i],   r[i+4],  0x88);
+      t[i+4]  = _mm512_shuffle_i32x4(r[i],   r[i+4],  0xdd);
+      t[i+8]  = _mm512_shuffle_i32x4(r[i+8], r[i+12], 0x88);
+      t[i+12] = _mm512_shuffle_i32x4(r[i+8], r[i+12], 0xdd);
+   }
+   for(i=0; i<4; i++) {
+      w[i]    = _mm512_shuffle_i32x4(t[i],   t[i+8],  0x88);
+      w[i+8]  = _mm512_shuffle_i32x4(t[i],   t[i+8],  0xdd);
+      w[i+4]  = _mm512_shuffle_i32x4(t[i+4], t[i+12], 0x88);
+      w[i+12] = _mm512_shuffle_i32x4(t[i+4], t[i+12], 0xdd);
+   }
+
+   for(i=0; i<16; i++)
+      w[i] = _mm512_shuffle_epi8(w[i], bswap);
+}
+
+/*
+// Updates hash values of 16 buffers by nBlocks[i] 64-byte message blocks of each buffer.
+// Buffers with nBlocks[i]==0 are not processed (pHash[i] and pMsg[i] are not accessed).
+*/
+IPP_OWN_DEFN (void, cpSHA256_MB16_avx512, (cpHash pHash[16], const Ipp8u* const pMsg[16], const int nBlocks[16]))
+{
+   __ALIGN64 Ipp32u hashT[8][16];
+   const Ipp8u* pBlk[16];
+   __m512i blkCnt = _mm512_loadu_si512(nBlocks);
+   __m512i s[8];
+   __mmask16 laneMask = _mm512_cmpgt_epi32_mask(blkCnt, _mm512_setzero_si512());
+   int i, k;
+
+   /* load hash values of active buffers in transposed form */
+   for(i=0; i<16; i++) {
+      pBlk[i] = pMsg[i];
+      for(k=0; k<8; k++)
+         hashT[k][i] = ((laneMask>>i) & 1) ? ((Ipp32u*)pHash[i])[k] : 0;
+   }
+   for(k=0; k<8; k++)
+      s[k] = _mm512_load_si512(hashT[k]);
+
+   while(laneMask) {
+      __m512i w[16];
+      __m512i a = s[0], b = s[1], c = s[2], d = s[3];
+      __m512i e = s[4], f = s[5], g = s[6], h = s[7];
+      int t;
+
+      loadTransposeBlocks16(w, pBlk, laneMask);
+
+      for(t=0; t<64; t++) {
+         __m512i t1, t2;
+         __m512i wt = w[t & 15];
+         if(t>=16) {
+            /* message schedule */
+            wt = _mm512_add_epi32(_mm512_add_epi32(sigma1(w[(t-2) & 15]), w[(t-7) & 15]),
+                                  _mm512_add_epi32(sigma0(w[(t-15) & 15]), wt));
+            w[t & 15] = wt;
+         }
+         t1 = _mm512_add_epi32(_mm512_add_epi32(h, SIGMA1(e)),
+                               _mm512_add_epi32(CH(e,f,g), _mm512_add_epi32(wt, _mm512_set1_epi32((int)SHA256_cnt[t]))));
+         t2 = _mm512_add_epi32(SIGMA0(a), MAJ(a,b,c));
+         h = g; g = f; f = e;
+         e = _mm512_add_epi32(d, t1);
+         d = c; c = b; b = a;
+         a = _mm512_add_epi32(t1, t2);
+      }
+
+      /* update hash of active buffers only */
+      s[0] = _mm512_mask_add_epi32(s[0], laneMask, s[0], a);
+      s[1] = _mm512_mask_add_epi32(s[1], laneMask, s[1], b);
+      s[2] = _mm512_mask_add_epi32(s[2], laneMask, s[2], c);
+      s[3] = _mm512_mask_add_epi32(s[3], laneMask, s[3], d);
+      s[4] = _mm512_mask_add_epi32(s[4], laneMask, s[4], e);
+      s[5] = _mm512_mask_add_epi32(s[5], laneMask, s[5], f);
+      s[6] = _mm512_mask_add_epi32(s[6], laneMask, s[6], g);
+      s[7] = _mm512_mask_add_epi32(s[7], laneMask, s[7], h);
+
+      /* next blocks */
+      for(i=0; i<16; i++)
+         if((laneMask>>i) & 1) pBlk[i] += MBS_SHA256;
+      blkCnt = _mm512_mask_sub_epi32(blkCnt, laneMask, blkCnt, _mm512_set1_epi32(1));
+      laneMask = _mm512_cmpgt_epi32_mask(blkCnt, _mm512_setzero_si512());
+   }
+
+   /* store hash values */
+   for(k=0; k<8; k++)
+      _mm512_store_si512(hashT[k], s[k]);
+   for(i=0; i<16; i++) {
+      if(nBlocks[i]>0) {
+         for(k=0; k<8; k++)
+            ((Ipp32u*)pHash[i])[k] = hashT[k][i];
+      }
+   }
+
+   /* clear the copy of hash values */
+   for(k=0; k<8; k++)
+      _mm512_store_si512(hashT[k], _mm512_setzero_si512());
+}
+
+#endif /* #if (_IPP32E>=_IPP32E_K1) */
@@ -0,0 +1,170 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Multi-buffer SHA256 message digest (8 buffers)
+//
+//  Contents:
+//     cpSHA256_MB8_avx2()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+
+#if (_IPP32E>=_IPP32E_L9)
+
+#define VROR32(x,n)   _mm256_or_si256(_mm256_srli_epi32((x),(n)), _mm256_slli_epi32((x),32-(n)))
+
+/* SHA256 logical functions */
+#define SIGMA0(x)    _mm256_xor_si256(_mm256_xor_si256(VROR32((x), 2), VROR32((x),13)), VROR32((x),22))
+#define SIGMA1(x)    _mm256_xor_si256(_mm256_xor_si256(VROR32((x), 6), VROR32((x),11)), VROR32((x),25))
+#define sigma0(x)    _mm256_xor_si256(_mm256_xor_si256(VROR32((x), 7), VROR32((x),18)), _mm256_srli_epi32((x), 3))
+#define sigma1(x)    _mm256_xor_si256(_mm256_xor_si256(VROR32((x),17), VROR32((x),19)), _mm256_srli_epi32((x),10))
+#define CH(x,y,z)    _mm256_xor_si256(_mm256_and_si256((x), _mm256_xor_si256((y),(z))), (z))
+#define MAJ(x,y,z)   _mm256_or_si256(_mm256_and_si256((x),(y)), _mm256_and_si256(_mm256_or_si256((x),(y)),(z)))
+
+/* transpose 8x8 matrix of 32-bit words */
+static void transpose8x8_I32(__m256i w[8], const __m256i r[8])
+{
+   __m256i t[8], u[8];
+   int i;
+
+   for(i=0; i<8; i+=2) {
+      t[i]   = _mm256_unpacklo_epi32(r[i], r[i+1]);
+      t[i+1] = _mm256_unpackhi_epi32(r[i], r[i+1]);
+   }
+   for(i=0; i<8; i+=4) {
+      u[i]   = _mm256_unpacklo_epi64(t[i],   t[i+2]);
+      u[i+1] = _mm256_unpackhi_epi64(t[i],   t[i+2]);
+      u[i+2] = _mm256_unpacklo_epi64(t[i+1], t[i+3]);
+      u[i+3] = _mm256_unpackhi_epi64(t[i+1], t[i+3]);
+   }
+   for(i=0; i<4; i++) {
+      w[i]   = _mm256_permute2x128_si256(u[i], u[i+4], 0x20);
+      w[i+4] = _mm256_permute2x128_si256(u[i], u[i+4], 0x31);
+   }
+}
+
+/*
+// Load 64-byte message blocks of 8 buffers and transpose them:
+// w[t] keeps t-th big-endian word of message block of all buffers
+*/
+static void loadTransposeBlocks8(__m256i w[16], const Ipp8u* const pMsg[8], int laneMask)
+{
+   const __m256i bswap = _mm256_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,
+                                          3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);
+   __m256i r[8];
+   int i, k;
+
+   /* blocks of inactive buffers are not loaded */
+   for(k=0; k<2; k++) {
+      for(i=0; i<8; i++)
+         r[i] = ((laneMask>>i) & 1) ? _mm256_loadu_si256((const __m256i*)(pMsg[i] + k*32)) : _mm256_setzero_si256();
+      transpose8x8_I32(w + k*8, r);
+   }
+
+   for(i=0; i<16; i++)
+      w[i] = _mm256_shuffle_epi8(w[i], bswap);
+}
+
+/*
+// Updates hash values of 8 buffers by nBlocks[i] 64-byte message blocks of each buffer.
+// Buffers with nBlocks[i]==0 are not processed (pHash[i] and pMsg[i] are not accessed).
+*/
+IPP_OWN_DEFN (void, cpSHA256_MB8_avx2, (cpHash pHash[8], const Ipp8u* const pMsg[8], const int nBlocks[8]))
+{
+   __ALIGN32 Ipp32u hashT[8][8];
+   const Ipp8u* pBlk[8];
+   __m256i blkCnt = _mm256_loadu_si256((const __m256i*)nBlocks);
+   __m256i laneMaskV = _mm256_cmpgt_epi32(blkCnt, _mm256_setzero_si256());
+   __m256i s[8];
+   int laneMask = _mm256_movemask_ps(_mm256_castsi256_ps(laneMaskV));
+   int i, k;
+
+   /* load hash values of active buffers in transposed form */
+   for(i=0; i<8; i++) {
+      pBlk[i] = pMsg[i];
+      for(k=0; k<8; k++)
+         hashT[k][i] = ((laneMask>>i) & 1) ? ((Ipp32u*)pHash[i])[k] : 0;
+   }
+   for(k=0; k<8; k++)
+      s[k] = _mm256_load_si256((const __m256i*)hashT[k]);
+
+   while(laneMask) {
+      __m256i w[16];
+      __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+      __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+      int t;
+
+      loadTransposeBlocks8(w, pBlk, laneMask);
+
+      for(t=0; t<64; t++) {
+         __m256i t1, t2;
+         __m256i wt = w[t & 15];
+         if(t>=16) {
+            /* message schedule */
+            wt = _mm256_add_epi32(_mm256_add_epi32(sigma1(w[(t-2) & 15]), w[(t-7) & 15]),
+                                  _mm256_add_epi32(sigma0(w[(t-15) & 15]), wt));
+            w[t & 15] = wt;
+         }
+         t1 = _mm256_add_epi32(_mm256_add_epi32(h, SIGMA1(e)),
+                               _mm256_add_epi32(CH(e,f,g), _mm256_add_epi32(wt, _mm256_set1_epi32((int)SHA256_cnt[t]))));
+         t2 = _mm256_add_epi32(SIGMA0(a), MAJ(a,b,c));
+         h = g; g = f; f = e;
+         e = _mm256_add_epi32(d, t1);
+         d = c; c = b; b = a;
+         a = _mm256_add_epi32(t1, t2);
+      }
+
+      /* update hash of active buffers only */
+      s[0] = _mm256_add_epi32(s[0], _mm256_and_si256(a, laneMaskV));
+      s[1] = _mm256_add_epi32(s[1], _mm256_and_si256(b, laneMaskV));
+      s[2] = _mm256_add_epi32(s[2], _mm256_and_si256(c, laneMaskV));
+      s[3] = _mm256_add_epi32(s[3], _mm256_and_si256(d, laneMaskV));
+      s[4] = _mm256_add_epi32(s[4], _mm256_and_si256(e, laneMaskV));
+      s[5] = _mm256_add_epi32(s[5], _mm256_and_si256(f, laneMaskV));
+      s[6] = _mm256_add_epi32(s[6], _mm256_and_si256(g, laneMaskV));
+      s[7] = _mm256_add_epi32(s[7], _mm256_and_si256(h, laneMaskV));
+
+      /* next blocks (laneMaskV lanes are -1 for active buffers) */
+      for(i=0; i<8; i++)
+         if((laneMask>>i) & 1) pBlk[i] += MBS_SHA256;
+      blkCnt = _mm256_add_epi32(blkCnt, laneMaskV);
+      laneMaskV = _mm256_cmpgt_epi32(blkCnt, _mm256_setzero_si256());
+      laneMask = _mm256_movemask_ps(_mm256_castsi256_ps(laneMaskV));
+   }
+
+   /* store hash values */
+   for(k=0; k<8; k++)
+      _mm256_store_si256((__m256i*)hashT[k], s[k]);
+   for(i=0; i<8; i++) {
+      if(nBlocks[i]>0) {
+         for(k=0; k<8; k++)
+            ((Ipp32u*)pHash[i])[k] = hashT[k][i];
+      }
+   }
+
+   /* clear the copy of hash values */
+   for(k=0; k<8; k++)
+      _mm256_store_si256((__m256i*)hashT[k], _mm256_setzero_si256());
+}
+
+#endif /* #if (_IPP32E>=_IPP32E_L9) */
@@ -0,0 +1,167 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Cryptography Primitive.
+//     Multi-buffer SHA512 message digest (8 buffers)
+//
+//  Contents:
+//     cpSHA512_MB8_avx512()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcphash_mb_rmf.h"
+
+#if (_IPP32E>=_IPP32E_K1)
+
+/* SHA512 logical functions */
+#define SIGMA0(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi64((x),28), _mm512_ror_epi64((x),34)), _mm512_ror_epi64((x),39))
+#define SIGMA1(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi64((x),14), _mm512_ror_epi64((x),18)), _mm512_ror_epi64((x),41))
+#define sigma0(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi64((x), 1), _mm512_ror_epi64((x), 8)), _mm512_srli_epi64((x), 7))
+#define sigma1(x)    _mm512_xor_si512(_mm512_xor_si512(_mm512_ror_epi64((x),19), _mm512_ror_epi64((x),61)), _mm512_srli_epi64((x), 6))
+#define CH(x,y,z)    _mm512_ternarylogic_epi64((x),(y),(z), 0xCA)
+#define MAJ(x,y,z)   _mm512_ternarylogic_epi64((x),(y),(z), 0xE8)
+
+/* transpose 8x8 matrix of 64-bit words */
+static void transpose8x8_I64(__m512i w[8], __m512i r[8])
+{
+   __m512i t[8], u[8];
+   int i;
+
+   for(i=0; i<8; i+=2) {
+      t[i]   = _mm512_unpacklo_epi64(r[i], r[i+1]);
+      t[i+1] = _mm512_unpackhi_epi64(r[i], r[i+1]);
+   }
+   for(i=0; i<8; i+=4) {
+      u[i]   = _mm512_shuffle_i64x2(t[i],   t[i+2], 0x88);
+      u[i+1] = _mm512_shuffle_i64x2(t[i+1], t[i+3], 0x88);
+      u[i+2] = _mm512_shuffle_i64x2(t[i],   t[i+2], 0xdd);
+      u[i+3] = _mm512_shuffle_i64x2(t[i+1], t[i+3], 0xdd);
+   }
+   for(i=0; i<4; i++) {
+      w[i]   = _mm512_shuffle_i64x2(u[i], u[i+4], 0x88);
+      w[i+4] = _mm512_shuffle_i64x2(u[i], u[i+4], 0xdd);
+   }
+}
+
+/*
+// Load 128-byte message blocks of 8 buffers and transpose them:
+// w[t] keeps t-th big-endian word of message block of all buffers
+*/
+static void loadTransposeBlocks8(__m512i w[16], const Ipp8u* const pMsg[8], __mmask8 laneMask)
+{
+   const __m512i bswap = _mm512_set4_epi32(0x08090a0b, 0x0c0d0e0f, 0x00010203, 0x04050607);
+   __m512i r[8];
+   int i;
+
+   /* blocks of inactive buffers are not loaded */
+   for(i=0; i<8; i++)
+      r[i] = _mm512_maskz_loadu_epi64((__mmask8)(0 - ((laneMask>>i) & 1)), pMsg[i]);
+   transpose8x8_I64(w, r);
+
+   for(i=0; i<8; i++)
+      r[i] = _mm512_maskz_loadu_epi64((__mmask8)(0 - ((laneMask>>i) & 1)), pMsg[i] + MBS_SHA512/2);
+   transpose8x8_I64(w+8, r);
+
+   for(i=0; i<16; i++)
+      w[i] = _mm512_shuffle_epi8(w[i], bswap);
+}
+
+/*
+// Updates hash values of 8 buffers by nBlocks[i] 128-byte message blocks of each buffer.
+// Buffers with nBlocks[i]==0 are not processed (pHash[i] and pMsg[i] are not accessed).
+*/
+IPP_OWN_DEFN (void, cpSHA512_MB8_avx512, (cpHash pHash[8], const Ipp8u* const pMsg[8], const int nBlocks[8]))
+{
+   __ALIGN64 Ipp64u hashT[8][8];
+   const Ipp8u* pBlk[8];
+   __m512i blkCnt = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)nBlocks));
+   __m512i s[8];
+   __mmask8 laneMask = _mm512_cmpgt_epi64_mask(blkCnt, _mm512_setzero_si512());
+   int i, k;
+
+   /* load hash values of active buffers in transposed form */
+   for(i=0; i<8; i++) {
+      pBlk[i] = pMsg[i];
+      for(k=0; k<8; k++)
+         hashT[k][i] = ((laneMask>>i) & 1) ? pHash[i][k] : 0;
+   }
+   for(k=0; k<8; k++)
+      s[k] = _mm512_load_si512(hashT[k]);
+
+   while(laneMask) {
+      __m512i w[16];
+      __m512i a = s[0], b = s[1], c = s[2], d = s[3];
+      __m512i e = s[4], f = s[5], g = s[6], h = s[7];
+      int t;
+
+      loadTransposeBlocks8(w, pBlk, laneMask);
+
+      for(t=0; t<80; t++) {
+         __m512i t1, t2;
+         __m512i wt = w[t & 15];
+         if(t>=16) {
+            /* message schedule */
+            wt = _mm512_add_epi64(_mm512_add_epi64(sigma1(w[(t-2) & 15]), w[(t-7) & 15]),
+                                  _mm512_add_epi64(sigma0(w[(t-15) & 15]), wt));
+            w[t & 15] = wt;
+         }
+         t1 = _mm512_add_epi64(_mm512_add_epi64(h, SIGMA1(e)),
+                               _mm512_add_epi64(CH(e,f,g), _mm512_add_epi64(wt, _mm512_set1_epi64((long long)SHA512_cnt[t]))));
+         t2 = _mm512_add_epi64(SIGMA0(a), MAJ(a,b,c));
+         h = g; g = f; f = e;
+         e = _mm512_add_epi64(d, t1);
+         d = c; c = b; b = a;
+         a = _mm512_add_epi64(t1, t2);
+      }
+
+      /* update hash of active buffers only */
+      s[0] = _mm512_mask_add_epi64(s[0], laneMask, s[0], a);
+      s[1] = _mm512_mask_add_epi64(s[1], laneMask, s[1], b);
+      s[2] = _mm512_mask_add_epi64(s[2], laneMask, s[2], c);
+      s[3] = _mm512_mask_add_epi64(s[3], laneMask, s[3], d);
+      s[4] = _mm512_mask_add_epi64(s[4], laneMask, s[4], e);
+      s[5] = _mm512_mask_add_epi64(s[5], laneMask, s[5], f);
+      s[6] = _mm512_mask_add_epi64(s[6], laneMask, s[6], g);
+      s[7] = _mm512_mask_add_epi64(s[7], laneMask, s[7], h);
+
+      /* next blocks */
+      for(i=0; i<8; i++)
+         if((laneMask>>i) & 1) pBlk[i] += MBS_SHA512;
+      blkCnt = _mm512_mask_sub_epi64(blkCnt, laneMask, blkCnt, _mm512_set1_epi64(1));
+      laneMask = _mm512_cmpgt_epi64_mask(blkCnt, _mm512_setzero_si512());
+   }
+
+   /* store hash values */
+   for(k=0; k<8; k++)
+      _mm512_store_si512(hashT[k], s[k]);
+   for(i=0; i<8; i++) {
+      if(nBlocks[i]>0) {
+         for(k=0; k<8; k++)
+            pHash[i][k] = hashT[k][i];
+      }
+   }
+
+   /* clear the copy of hash values */
+   for(k=0; k<8; k++)
+      _mm512_store_si512(hashT[k], _mm512_setzero_si512());
+}
+
+#endif /* #if (_IPP32E>=_IPP32E_K1) */
@@ -103,76 +103,21 @@ IPP_OWN_DEFN(IppStatus, prf, (const Ipp8u* key, const Ipp8u* msg, Ipp8u* out, Ip
 }
 
 /*
- * Computes an iteration of F on an n-byte X using outputs of PRF. It takes an
- * OTS hash address (adrs) as input. This address will have the first six
- * 32-bit words set to encode the address of this chain. In each iteration, PRF
- * is used to generate a key for F and a bitmask that is XORed to the
- * intermediate result before it is processed by F. In the following, pSeed is an
- * n-byte string. To generate the keys and bitmasks, PRF is called with
- * pSeed as key and adrs as input. The chaining function also takes as input
- * a start index i, a number of steps s. The chaining function returns as output the array
- * obtained by iterating F for s times on input X, using the outputs of PRF.)
- *
- * temp_buf size is 4 * n bytes at least.
- */
-
-IPP_OWN_DEFN(IppStatus, chain, (Ipp8u* X, Ipp8u i, Ipp8u s, Ipp8u* pSeed, Ipp8u* adrs,
-            Ipp8u* out, Ipp8u* temp_buf, cpWOTSParams* params)) {
-    IppStatus retCode = ippStsNoErr;
-    Ipp8u* bm = temp_buf;
-    Ipp8u* key = bm;
-    CopyBlock(X, out, params->n);
-
-    for (Ipp8u k = i; k < (i + s) && k < params->w; k++) {
-        adrs[set_adrs_1_byte(6)] = /*hash address*/ k;
-
-        // BM = PRF(SEED, ADRS);
-        adrs[set_adrs_1_byte(7)] = /*bitmask for bm*/ 1;
-        retCode = prf(pSeed, adrs, bm, temp_buf + params->n, params);
-        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
-
-        // out = out ^ BM;
-        for (Ipp32s j = 0; j < params->n; ++j) {
-            out[j] = out[j] ^ bm[j];
-        }
-
-        // KEY = PRF(SEED, ADRS);
-        adrs[set_adrs_1_byte(7)] = /*bitmask for key*/ 0;
-        retCode = prf(pSeed, adrs, key, temp_buf + params->n, params);
-        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
-
-        // tmp = F(KEY, out);
-        retCode = do_xmss_hash(/*F function padding id*/ 0, key, out, params->n, out, temp_buf + params->n, params);
-        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
-    }
-    return retCode;
-}
-
-/*
- * In order to verify a signature sig on a message M, the verifier
- * computes a WOTS+ public key value from the signature. This can be
- * done by "completing" the chain computations starting from the
- * signature values, using the base params->w values of the message hash and its
- * checksum. An OTS hash address adrs and a seed pSeed have to be provided by the calling
- * algorithm. This address will encode the address of the WOTS+ key
- * pair within a greater structure. Hence, a WOTS+ algorithm MUST NOT
- * manipulate any parts of adrs except for the last three 32-bit words.
- * Please note that the pSeed used here is public information also
- * available to a verifier.
- *
- * temp_buf size is (2 * params->len - params->len_1 + 4 * n) bytes at least.
+ * Converts the n-byte message M and its checksum to base w: the start
+ * points of the WOTS+ chains for the signature verification.
  *
- * Output parameters:
- *    out   resulted len * n bytes array that contains WOTS+ public key
+ * Input parameters:
+ *    M         n-byte message
+ *    params    WOTS parameters (w, log2_w, n, len, len_1, hash_method)
  *
+ * Output parameters:
+ *    msg       len base w values of message and checksum
+ *              (size is (2 * params->len - params->len_1) bytes at least)
  */
 
-IPP_OWN_DEFN(IppStatus, WOTS_pkFromSig, (const Ipp8u* M, Ipp8u* sig, Ipp8u* pSeed,
-            Ipp8u* adrs, Ipp8u* out, Ipp8u* temp_buf, cpWOTSParams* params)) {
-    IppStatus retCode = ippStsNoErr;
+IPP_OWN_DEFN(void, WOTS_msgToBaseW, (const Ipp8u* M, Ipp8u* msg, cpWOTSParams* params)) {
     // Convert message to base w
     Ipp32s len_2 = params->len - params->len_1;
-    Ipp8u* msg = temp_buf;
     base_w(M, params->len_1, msg, params);
 
     // Compute checksum
@@ -186,20 +131,202 @@ IPP_OWN_DEFN(IppStatus, WOTS_pkFromSig, (const Ipp8u* M, Ipp8u* sig, Ipp8u* pSee
     Ipp32s len_2_bytes = cpCeil( ( len_2 * params->log2_w) / 8.0 );
     toByte(msg + params->len, len_2_bytes, csum);
     base_w(msg + params->len, len_2, msg + params->len_1, params);
+}
+
+/*
+ * The first message block of all PRF calls with the same key is
+ * toByte(3, n) || key (2 * n bytes is the block size of SHA-256 and SHA-512),
+ * so it is hashed once and the hash state is reused by prf_MB.
+ *
+ * Input parameters:
+ *    key        n-byte key for the hash function
+ *    params     WOTS parameters (w, log2_w, n, len, len_1, hash_method)
+ *
+ * Output parameters:
+ *    prfState   hash state after the first message block
+ */
+
+IPP_OWN_DEFN(void, prf_prehash, (const Ipp8u* key, cpHash prfState, cpWOTSParams* params)) {
+    Ipp8u block[2 * CP_XMSS_MAX_HASH_BYTESIZE];
+    toByte(block, params->n, /*prf function padding id*/ 3);
+    CopyBlock(key, block + params->n, params->n);
+
+    params->hash_method->hashInit(prfState);
+    params->hash_method->hashUpdate(prfState, block, 2 * params->n);
+}
+
+/*
+ * Multi-buffer version of prf: num pseudorandom outputs Hash(toByte(3, n) || key || index[k])
+ * of the same key computed by groups of CP_XMSS_MB_MAX_LANES.
+ *
+ * Input parameters:
+ *    prfState  hash state of toByte(3, n) || key (see prf_prehash)
+ *    index     num 32-byte arrays
+ *    num       number of outputs
+ *    params    WOTS parameters (w, log2_w, n, len, len_1, hash_method)
+ *
+ * Output parameters:
+ *    out       num resulted n-byte arrays
+ */
+
+IPP_OWN_DEFN(void, prf_MB, (const cpHash prfState, const Ipp8u* const index[], Ipp8u* const out[], Ipp32s num,
+                cpWOTSParams* params)) {
+    const IppsHashMethod* method = params->hash_method;
+    cpHash hash[CP_XMSS_MB_MAX_LANES];
+    int indexLen[CP_XMSS_MB_MAX_LANES];
+    Ipp64u lenLo[CP_XMSS_MB_MAX_LANES];
+    Ipp64u lenHi[CP_XMSS_MB_MAX_LANES];
+
+    for (Ipp32s k = 0; k < CP_XMSS_MB_MAX_LANES; k++) {
+        indexLen[k] = /*bit size of index*/32;
+        lenLo[k] = (Ipp64u)(2 * params->n + /*bit size of index*/32);
+        lenHi[k] = 0;
+    }
+
+    for (Ipp32s k0 = 0; k0 < num; k0 += CP_XMSS_MB_MAX_LANES) {
+        Ipp32s nLanes = IPP_MIN(num - k0, CP_XMSS_MB_MAX_LANES);
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            CopyBlock(prfState, hash[k], sizeof(cpHash));
+        }
+        cpFinalize_MB_rmf(hash, index + k0, indexLen, lenLo, lenHi, nLanes, method);
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            method->hashOctStr(out[k0 + k], hash[k]);
+        }
+    }
+}
 
-    for (Ipp32s i = 0; i < params->len; i++ ) {
-        adrs[set_adrs_1_byte(5)] = /*chain address*/ (Ipp8u)i;
-        retCode = chain(sig + i * params->n,
-            msg[i],
-            (Ipp8u)(params->w - 1 - msg[i]),
-            pSeed,
-            adrs,
-            out + (i * params->n),
-            temp_buf + (params->len + len_2), params
-        );
+/*
+ * Computes WOTS+ public keys of numSets signatures made with the same pSeed:
+ * each chain is completed from the signature value, starting at the base w
+ * digit of the message (or checksum) and ending at w - 1.
+ *
+ * All (numSets * len) chains are independent, so they are computed in parallel:
+ * each of CP_XMSS_MB_MAX_LANES lanes keeps one chain and takes the next one as soon
+ * as the current is completed. One step of the chain costs PRF of bitmasks and keys
+ * and F of all lanes. The messages of the lanes are kept between the steps:
+ * only hash address of ADRS is updated and PRF key is written in place of F key.
+ *
+ * Input parameters:
+ *    M         numSets n-byte messages
+ *    sig       numSets WOTS+ signatures (len * n bytes each)
+ *    pSeed     n-byte seed
+ *    adrs      numSets 32-byte OTS hash addresses
+ *    numSets   number of signatures
+ *    params    WOTS parameters (w, log2_w, n, len, len_1, hash_method)
+ *
+ * Output parameters:
+ *    out       numSets resulted len * n bytes arrays that contain WOTS+ public keys
+ */
+
+IPP_OWN_DEFN(IppStatus, WOTS_pkFromSig_MB, (const Ipp8u* const M[], const Ipp8u* const sig[], const Ipp8u* pSeed,
+            const Ipp8u* const adrs[], Ipp8u* const out[], Ipp32s numSets, cpWOTSParams* params)) {
+    IppStatus retCode = ippStsNoErr;
+    Ipp32s n = params->n;
+    Ipp32s len = params->len;
+    Ipp8u end = (Ipp8u)(params->w - 1);
+
+    cpHash prfState;
+    prf_prehash(pSeed, prfState, params);
+
+    // lanes: F message toByte(0, n) || KEY || (out ^ BM) and ADRS of BM and KEY
+    Ipp8u fMsg[CP_XMSS_MB_MAX_LANES][3 * CP_XMSS_MAX_HASH_BYTESIZE];
+    Ipp8u bm[CP_XMSS_MB_MAX_LANES][CP_XMSS_MAX_HASH_BYTESIZE];
+    Ipp8u md[CP_XMSS_MB_MAX_LANES][CP_XMSS_MAX_HASH_BYTESIZE];
+    Ipp8u adrsLane[CP_XMSS_MB_MAX_LANES][2][32];
+    const Ipp8u* pAdrs[2 * CP_XMSS_MB_MAX_LANES];
+    Ipp8u* pPrfOut[2 * CP_XMSS_MB_MAX_LANES];
+    const Ipp8u* pMsg[CP_XMSS_MB_MAX_LANES];
+    Ipp8u* pMD[CP_XMSS_MB_MAX_LANES];
+    int lens[CP_XMSS_MB_MAX_LANES];
+    Ipp32s setIdx[CP_XMSS_MB_MAX_LANES];
+    Ipp32s chainIdx[CP_XMSS_MB_MAX_LANES];
+    Ipp32s nLanes = 0;
+
+    // chains start points of the current set
+    Ipp8u msg[2 * CP_WOTS_MAX_LEN];
+    Ipp32s nextSet = 0;
+    Ipp32s nextChain = 0;
+
+    for (Ipp32s k = 0; k < CP_XMSS_MB_MAX_LANES; k++) {
+        toByte(fMsg[k], n, /*F function padding id*/ 0);
+        pMsg[k] = fMsg[k];
+        pMD[k] = md[k];
+        lens[k] = 3 * n;
+    }
+
+    for (;;) {
+        // fill the free lanes by the next chains
+        while (nLanes < CP_XMSS_MB_MAX_LANES && nextSet < numSets) {
+            Ipp32s s = nextSet;
+            Ipp32s i = nextChain++;
+            if (0 == i) {
+                WOTS_msgToBaseW(M[s], msg, params);
+            }
+            if (nextChain == len) {
+                nextChain = 0;
+                nextSet++;
+            }
+            if (msg[i] >= end) {
+                // nothing to hash
+                CopyBlock(sig[s] + i * n, out[s] + i * n, n);
+                continue;
+            }
+            CopyBlock(sig[s] + i * n, fMsg[nLanes] + 2 * n, n);
+            CopyBlock(adrs[s], adrsLane[nLanes][0], 32);
+            adrsLane[nLanes][0][set_adrs_1_byte(5)] = /*chain address*/ (Ipp8u)i;
+            adrsLane[nLanes][0][set_adrs_1_byte(6)] = /*hash address*/ msg[i];
+            adrsLane[nLanes][0][set_adrs_1_byte(7)] = /*bitmask for bm*/ 1;
+            CopyBlock(adrsLane[nLanes][0], adrsLane[nLanes][1], 32);
+            adrsLane[nLanes][1][set_adrs_1_byte(7)] = /*bitmask for key*/ 0;
+            setIdx[nLanes] = s;
+            chainIdx[nLanes++] = i;
+        }
+        if (0 == nLanes) {
+            break;
+        }
+
+        // BM = PRF(SEED, ADRS); KEY = PRF(SEED, ADRS);
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            pAdrs[k] = adrsLane[k][0];
+            pPrfOut[k] = bm[k];
+            pAdrs[nLanes + k] = adrsLane[k][1];
+            pPrfOut[nLanes + k] = fMsg[k] + n;
+        }
+        prf_MB(prfState, pAdrs, pPrfOut, 2 * nLanes, params);
+
+        // out = out ^ BM;
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            for (Ipp32s j = 0; j < n; ++j) {
+                fMsg[k][2 * n + j] ^= bm[k][j];
+            }
+        }
+
+        // tmp = F(KEY, out);
+        retCode = ippsHashMessage_MB_rmf(pMsg, lens, pMD, (int)nLanes, params->hash_method);
         IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+
+        // step the chains, release lanes of the completed chains
+        for (Ipp32s k = 0; k < nLanes; ) {
+            Ipp8u hashAdrs = (Ipp8u)(adrsLane[k][0][set_adrs_1_byte(6)] + 1);
+            if (hashAdrs < end) {
+                CopyBlock(md[k], fMsg[k] + 2 * n, n);
+                adrsLane[k][0][set_adrs_1_byte(6)] = hashAdrs;
+                adrsLane[k][1][set_adrs_1_byte(6)] = hashAdrs;
+                k++;
+            }
+            else {
+                CopyBlock(md[k], out[setIdx[k]] + chainIdx[k] * n, n);
+                // move the last lane in place of the completed one
+                nLanes--;
+                if (k != nLanes) {
+                    CopyBlock(fMsg[nLanes] + 2 * n, fMsg[k] + 2 * n, n);
+                    CopyBlock(md[nLanes], md[k], n);
+                    CopyBlock(adrsLane[nLanes], adrsLane[k], 2 * 32);
+                    setIdx[k] = setIdx[nLanes];
+                    chainIdx[k] = chainIdx[nLanes];
+                }
+            }
+        }
     }
-    // null chain address for next call
-    adrs[set_adrs_1_byte(5)] = 0;
     return retCode;
 }
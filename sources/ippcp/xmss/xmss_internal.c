@@ -66,45 +66,131 @@ IPP_OWN_DEFN(IppStatus, rand_hash, (Ipp8u* left, Ipp8u* right, Ipp8u* seed,
 }
 
 /*
- * Compute the leaves of the binary hash tree, a so-called L-tree.
- * An L-tree is an unbalanced binary hash tree, distinct but
- * similar to the main XMSS binary hash tree. The function takes as input a
- * WOTS+ public key pk and compresses it to a single n-byte value pk[0].
- * It also takes as input an L-tree address adrs that encodes the address
- * of the L-tree and seed
+ * Multi-buffer version of rand_hash: num (<= CP_XMSS_MB_MAX_LANES) randomized
+ * hashes with the same seed. PRF of the keys and both bitmasks of all hashes
+ * are computed together.
  *
- * temp_buf size is 6 * n bytes at least.
+ * Input parameters:
+ *    left        num left  halves of the hash function input (n-byte arrays)
+ *    right       num right halves of the hash function input (n-byte arrays)
+ *    seed        key for the prf function (n-byte array)
+ *    adrs        num addresses ADRS of the hash function calls
+ *    num         number of hashes
+ *    params      WOTS parameters (w, log2_w, n, len, len_1, hash_method)
+ *
+ * Output parameters:
+ *    out         num resulted n-byte arrays (out[k] == left[k] or out[k] == right[k] is allowed)
+ */
+
+IPP_OWN_DEFN(IppStatus, rand_hash_MB, (const Ipp8u* const left[], const Ipp8u* const right[], const Ipp8u* seed,
+            const Ipp8u* const adrs[], Ipp8u* const out[], Ipp32s num, cpWOTSParams* params)) {
+    Ipp32s n = params->n;
+
+    // H message toByte(1, n) || KEY || (LEFT XOR BM_0) || (RIGHT XOR BM_1)
+    Ipp8u hMsg[CP_XMSS_MB_MAX_LANES][4 * CP_XMSS_MAX_HASH_BYTESIZE];
+    Ipp8u adrsMask[CP_XMSS_MB_MAX_LANES][3][32];
+    const Ipp8u* pAdrs[3 * CP_XMSS_MB_MAX_LANES];
+    Ipp8u* pPrfOut[3 * CP_XMSS_MB_MAX_LANES];
+    const Ipp8u* pMsg[CP_XMSS_MB_MAX_LANES];
+    int lens[CP_XMSS_MB_MAX_LANES];
+
+    cpHash prfState;
+    prf_prehash(seed, prfState, params);
+
+    for (Ipp32s k = 0; k < num; k++) {
+        for (Ipp8u m = 0; m < 3; m++) {
+            // m = 0: key bitmask, m = 1: left bitmask, m = 2: right bitmask
+            CopyBlock(adrs[k], adrsMask[k][m], 32);
+            adrsMask[k][m][set_adrs_1_byte(7)] = m;
+            pAdrs[3 * k + m] = adrsMask[k][m];
+            pPrfOut[3 * k + m] = hMsg[k] + (m + 1) * n;
+        }
+        toByte(hMsg[k], n, /*H padding id*/ 1);
+        pMsg[k] = hMsg[k];
+        lens[k] = 4 * n;
+    }
+    prf_MB(prfState, pAdrs, pPrfOut, 3 * num, params);
+
+    // (LEFT XOR BM_0) || (RIGHT XOR BM_1)
+    for (Ipp32s k = 0; k < num; k++) {
+        for (Ipp32s i = 0; i < n; ++i) {
+            hMsg[k][2 * n + i] ^= left[k][i];
+            hMsg[k][3 * n + i] ^= right[k][i];
+        }
+    }
+
+    //H(KEY, pMsg);
+    return ippsHashMessage_MB_rmf(pMsg, lens, out, (int)num, params->hash_method);
+}
+
+/*
+ * Compresses numSets WOTS+ public keys made with the same seed by L-trees
+ * (unbalanced binary hash trees, the odd node of a level is lifted to the next one).
+ * The nodes of a level of all L-trees are independent,
+ * they are hashed by CP_XMSS_MB_MAX_LANES in parallel.
  *
+ * Input parameters:
+ *    pk        numSets WOTS+ public keys (len * n bytes each)
+ *    seed      key for the prf function (n-byte array)
+ *    adrs      numSets L-tree addresses
+ *    numSets   number of public keys
+ *    params    WOTS parameters (w, log2_w, n, len, len_1, hash_method)
+ *
+ * Output parameters:
+ *    pk        first n bytes of pk[s] contain the compressed public key
  */
 
-IPP_OWN_DEFN(IppStatus, ltree, (Ipp8u* pk, Ipp8u* seed, Ipp8u* adrs, Ipp8u* temp_buf, cpWOTSParams* params)) {
+IPP_OWN_DEFN(IppStatus, ltree_MB, (Ipp8u* const pk[], const Ipp8u* seed, const Ipp8u* const adrs[], Ipp32s numSets,
+            cpWOTSParams* params)) {
     IppStatus retCode = ippStsNoErr;
     Ipp32s len_ = params->len;
     Ipp32s n_ = params->n;
+    Ipp8u height = 0;
 
-    // tree height is 0 for now
-    adrs[set_adrs_1_byte(5)] = 0;
+    Ipp8u nodeAdrs[CP_XMSS_MB_MAX_LANES][32];
+    const Ipp8u* pAdrs[CP_XMSS_MB_MAX_LANES];
+    const Ipp8u* pLeft[CP_XMSS_MB_MAX_LANES];
+    const Ipp8u* pRight[CP_XMSS_MB_MAX_LANES];
+    Ipp8u* pOut[CP_XMSS_MB_MAX_LANES];
+
+    for (Ipp32s k = 0; k < CP_XMSS_MB_MAX_LANES; k++) {
+        pAdrs[k] = nodeAdrs[k];
+    }
 
     while (len_ > 1) {
-        for (Ipp32s i = 0; i < len_ / 2; i++) {
-            adrs[set_adrs_1_byte(6)] = /*tree index*/ (Ipp8u) i;
+        // all nodes (s, i) of the level; outputs of a group never overlap
+        // inputs of the next groups, since node i is written to pk[s] + i * n
+        Ipp32s numNodes = numSets * (len_ / 2);
+        Ipp32s k = 0;
+        for (Ipp32s node = 0; node < numNodes; node++) {
+            Ipp32s s = node / (len_ / 2);
+            Ipp32s i = node % (len_ / 2);
+
+            CopyBlock(adrs[s], nodeAdrs[k], 32);
+            nodeAdrs[k][set_adrs_1_byte(5)] = /*tree height*/ height;
+            nodeAdrs[k][set_adrs_1_byte(6)] = /*tree index*/ (Ipp8u) i;
+            pLeft[k] = pk[s] + (2 * i * n_);
+            pRight[k] = pk[s] + ((2 * i * n_) + n_);
+            pOut[k] = pk[s] + (i * n_);
+            k++;
 
-            retCode = rand_hash(pk + (2 * i * n_), pk + ((2 * i * n_) + n_), seed, adrs, pk + (i * n_), temp_buf, params);
-            IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+            if (k == CP_XMSS_MB_MAX_LANES || node == numNodes - 1) {
+                retCode = rand_hash_MB(pLeft, pRight, seed, pAdrs, pOut, k, params);
+                IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+                k = 0;
+            }
         }
         if ((len_ & 1) == 1) {
-            CopyBlock(pk + (n_ * (len_ - 1)), pk + (n_ * (len_ / 2)), n_);
+            for (Ipp32s s = 0; s < numSets; s++) {
+                CopyBlock(pk[s] + (n_ * (len_ - 1)), pk[s] + (n_ * (len_ / 2)), n_);
+            }
             len_ = (len_ >> 1) + 1;
         }
         else {
             len_ = len_ >> 1;
         }
         // increase the tree height
-        adrs[set_adrs_1_byte(5)] += 1;
+        height++;
     }
-
-    // null tree height and tree index
-    adrs[set_adrs_1_byte(5)] = 0;
-    adrs[set_adrs_1_byte(6)] = 0;
     return retCode;
 }
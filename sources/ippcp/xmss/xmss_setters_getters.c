@@ -16,6 +16,7 @@
 
 #include "owndefs.h"
 #include "xmss_internal/xmss.h"
+#include "pcphash_mb_rmf.h"
 
 /*F*
 //    Name: ippsXMSSSetPublicKeyState
@@ -253,3 +254,43 @@ IPPFUN(IppStatus, ippsXMSSBufferGetSize,( Ipp32s* pSize, Ipp32s maxMessageLength
     *pSize = (numTempBufs + len) * n + maxMessageLength;
     return status;
 }
+
+/*F*
+//    Name: ippsXMSSBufferGetSize_MB
+//
+// Purpose: Get the temporary buffer size (bytes) of the XMSS verification
+//          of several signatures (ippsXMSSVerify_MB).
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pSize == NULL
+//    ippStsBadArgErr         OIDAlgo > Max value for IppsXMSSAlgo
+//    ippStsBadArgErr         OIDAlgo <= 0
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pSize             pointer to the size
+//    OIDAlgo           id of XMSS set of parameters (algorithm)
+//
+// Note:
+//    the size does not depend on the messages lengths and number of signatures.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsXMSSBufferGetSize_MB,( Ipp32s* pSize, IppsXMSSAlgo OIDAlgo))
+{
+    IppStatus status = ippStsNoErr;
+
+    IPP_BAD_PTR1_RET(pSize);
+    IPP_BADARG_RET(OIDAlgo >  6, ippStsBadArgErr);
+    IPP_BADARG_RET(OIDAlgo <= 0, ippStsBadArgErr);
+
+    /* Set XMSS parameters */
+    Ipp32s h = 0;
+    cpWOTSParams params;
+    status = setXMSSParams(OIDAlgo, &h, &params);
+    IPP_BADARG_RET((ippStsNoErr != status), status)
+
+    *pSize = (Ipp32s)sizeof(IppsHashState_MB_rmf) + CP_XMSS_MB_ALIGNMENT - 1 + /* multi-buffer hash state */
+             CP_XMSS_MB_MAX_LANES * params.len * params.n;                    /* WOTS+ public keys       */
+    return status;
+}
@@ -113,11 +113,16 @@ IPPFUN(IppStatus, ippsXMSSVerify,( const Ipp8u* pMsg,
     set_adrs_idx(adrs, idx, /*start point in adrs to write idx*/4);
 
     // 1. get ots public key working with msg and ots signature
-    retCode = WOTS_pkFromSig(pMsg_, pSign->pOTSSign, pKey->pSeed, adrs, temp_key, temp_buf, &params);
+    //    (independent chains and L-tree nodes are hashed in parallel by the multi-buffer versions)
+    const Ipp8u* const pMsgSet[1] = { pMsg_ };
+    const Ipp8u* const pOTSSet[1] = { pSign->pOTSSign };
+    const Ipp8u* const pAdrsSet[1] = { adrs };
+    Ipp8u* const pKeySet[1] = { temp_key };
+    retCode = WOTS_pkFromSig_MB(pMsgSet, pOTSSet, pKey->pSeed, pAdrsSet, pKeySet, 1, &params);
     IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
 
     adrs[set_adrs_1_byte(3)] = /*tree type is L-tree*/ 1;
-    retCode = ltree(temp_key, pKey->pSeed, adrs, temp_buf, &params);
+    retCode = ltree_MB(pKeySet, pKey->pSeed, pAdrsSet, 1, &params);
     IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
 
     // 2. do hashing using authorization path
@@ -0,0 +1,186 @@
+/*************************************************************************
+* Copyright (C) 2024 Intel Corporation
+*
+* Licensed under the Apache License,  Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* 	http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law  or agreed  to  in  writing,  software
+* distributed under  the License  is  distributed  on  an  "AS IS"  BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the  specific  language  governing  permissions  and
+* limitations under the License.
+*************************************************************************/
+#include "owndefs.h"
+#include "xmss_internal/xmss.h"
+#include "pcphash_mb_rmf.h"
+
+/*F*
+//    Name: ippsXMSSVerify_MB
+//
+// Purpose: XMSS verification of several signatures made with the same public key.
+//
+// Returns:                Reason:
+//    ippStsNullPtrErr        pMsg == NULL
+//                            msgLen == NULL
+//                            pSign == NULL
+//                            pIsSignValid == NULL
+//                            pKey == NULL
+//                            pBuffer == NULL
+//                            pMsg[i] == NULL
+//                            pSign[i] == NULL
+//    ippStsBadArgErr         wrong XMSS parameters inside pKey
+//    ippStsSizeErr           numSigns < 1
+//    ippStsLengthErr         msgLen[i] < 1
+//    ippStsNoErr             no errors
+//
+// Parameters:
+//    pMsg           array of pointers to the messages
+//    msgLen         array of the messages lengths, bytes
+//    pSign          array of pointers to the XMSS signatures
+//    pIsSignValid   array of results: pIsSignValid[i] is 1 if i-th signature is valid, 0 - vice versa
+//    numSigns       number of signatures
+//    pKey           pointer to the XMSS public key
+//    pBuffer        pointer to the temporary memory of ippsXMSSBufferGetSize_MB() size
+//
+// Note:
+//    signature with incorrect index idx is reported as invalid (pIsSignValid[i] = 0).
+//
+*F*/
+IPPFUN(IppStatus, ippsXMSSVerify_MB,( const Ipp8u* const pMsg[],
+                                      const Ipp32s msgLen[],
+                                      const IppsXMSSSignatureState* const pSign[],
+                                      int pIsSignValid[],
+                                      Ipp32s numSigns,
+                                      const IppsXMSSPublicKeyState* pKey,
+                                      Ipp8u* pBuffer))
+{
+    IppStatus retCode = ippStsNoErr;
+
+    /* Check if any of input pointers are NULL */
+    IPP_BAD_PTR4_RET(pMsg, msgLen, pSign, pIsSignValid)
+    IPP_BAD_PTR2_RET(pKey, pBuffer)
+    IPP_BADARG_RET(numSigns < 1, ippStsSizeErr)
+    for (Ipp32s s = 0; s < numSigns; s++) {
+        IPP_BAD_PTR2_RET(pMsg[s], pSign[s])
+        IPP_BADARG_RET(msgLen[s] < 1, ippStsLengthErr)
+        pIsSignValid[s] = 0;
+    }
+
+    /* Parameters of the current XMSS, the same for all signatures */
+    Ipp32s h = 0;
+    cpWOTSParams params;
+    retCode = setXMSSParams(pKey->OIDAlgo, &h, &params);
+    IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+    Ipp32s len = params.len;
+    Ipp32s n = params.n;
+
+    /* Buffer layout: MB hash state || CP_XMSS_MB_MAX_LANES WOTS+ public keys of len * n bytes */
+    IppsHashState_MB_rmf* pHashState = (IppsHashState_MB_rmf*)IPP_ALIGNED_PTR(pBuffer, CP_XMSS_MB_ALIGNMENT);
+    Ipp8u* pKeyBuffer = (Ipp8u*)pHashState + sizeof(IppsHashState_MB_rmf);
+
+    // signatures are processed by groups of CP_XMSS_MB_MAX_LANES
+    for (Ipp32s s0 = 0; s0 < numSigns; s0 += CP_XMSS_MB_MAX_LANES) {
+        const Ipp8u* pMsgs[CP_XMSS_MB_MAX_LANES];
+        int lens[CP_XMSS_MB_MAX_LANES];
+        Ipp32s sIdx[CP_XMSS_MB_MAX_LANES];
+        Ipp32s nLanes = 0;
+
+        for (Ipp32s s = s0; s < IPP_MIN(s0 + CP_XMSS_MB_MAX_LANES, numSigns); s++) {
+            if (pSign[s]->idx < ((Ipp32u)1 << h)) {
+                sIdx[nLanes++] = s;
+            }
+        }
+        if (0 == nLanes) {
+            continue;
+        }
+
+        // byte[n] M_ = H_msg(r || getRoot(PK) || (toByte(idx_sig, n)), M);
+        Ipp8u prefix[CP_XMSS_MB_MAX_LANES][4 * CP_XMSS_MAX_HASH_BYTESIZE];
+        Ipp8u msg_[CP_XMSS_MB_MAX_LANES][CP_XMSS_MAX_HASH_BYTESIZE];
+        Ipp8u* pMsg_[CP_XMSS_MB_MAX_LANES];
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            const IppsXMSSSignatureState* pSig = pSign[sIdx[k]];
+            toByte(prefix[k], n, /*h_msg padding id*/ 2);
+            CopyBlock(pSig->r, prefix[k] + n, n);
+            CopyBlock(pKey->pRoot, prefix[k] + 2 * n, n);
+            toByte(prefix[k] + 3 * n, n, pSig->idx);
+            pMsgs[k] = prefix[k];
+            lens[k] = 4 * n;
+            pMsg_[k] = msg_[k];
+        }
+        retCode = ippsHashInit_MB_rmf(pHashState, params.hash_method, (int)nLanes);
+        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+        retCode = ippsHashUpdate_MB_rmf(pMsgs, lens, pHashState);
+        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            pMsgs[k] = pMsg[sIdx[k]];
+            lens[k] = msgLen[sIdx[k]];
+        }
+        retCode = ippsHashUpdate_MB_rmf(pMsgs, lens, pHashState);
+        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+        retCode = ippsHashFinal_MB_rmf(pMsg_, pHashState);
+        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+
+        // see ippsXMSSVerify for description of the address
+        Ipp8u adrs[CP_XMSS_MB_MAX_LANES][32];
+        const Ipp8u* pAdrs[CP_XMSS_MB_MAX_LANES];
+        const Ipp8u* pOTSSign[CP_XMSS_MB_MAX_LANES];
+        Ipp8u* pTempKey[CP_XMSS_MB_MAX_LANES];
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            PadBlock(0, adrs[k], 32);
+            set_adrs_idx(adrs[k], pSign[sIdx[k]]->idx, /*start point in adrs to write idx*/4);
+            pAdrs[k] = adrs[k];
+            pOTSSign[k] = pSign[sIdx[k]]->pOTSSign;
+            pTempKey[k] = pKeyBuffer + k * len * n;
+        }
+
+        // 1. get ots public keys working with msg and ots signatures
+        retCode = WOTS_pkFromSig_MB((const Ipp8u* const*)pMsg_, pOTSSign, pKey->pSeed, pAdrs, pTempKey, nLanes, &params);
+        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            adrs[k][set_adrs_1_byte(3)] = /*tree type is L-tree*/ 1;
+        }
+        retCode = ltree_MB(pTempKey, pKey->pSeed, pAdrs, nLanes, &params);
+        IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+
+        // 2. do hashing using authorization paths
+        const Ipp8u* pLeft[CP_XMSS_MB_MAX_LANES];
+        const Ipp8u* pRight[CP_XMSS_MB_MAX_LANES];
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            adrs[k][set_adrs_1_byte(3)] = /*tree type is hash tree*/ 2;
+            set_adrs_idx(adrs[k], 0, 4);
+        }
+        for (Ipp32s i = 0; i < h; ++i) {
+            for (Ipp32s k = 0; k < nLanes; k++) {
+                const IppsXMSSSignatureState* pSig = pSign[sIdx[k]];
+                Ipp8u* pAuth = pSig->pAuthPath + (i * n);
+                adrs[k][set_adrs_1_byte(5)] = /*tree height*/(Ipp8u) i;
+                // if we are the left child
+                if (((pSig->idx >> i) & 1) == 0) {
+                    // leaf || auth_path
+                    pLeft[k] = pTempKey[k];
+                    pRight[k] = pAuth;
+                }
+                else {
+                    // auth_path || leaf
+                    pLeft[k] = pAuth;
+                    pRight[k] = pTempKey[k];
+                }
+                set_adrs_idx(adrs[k], pSig->idx >> (i + 1), 6);
+            }
+            retCode = rand_hash_MB(pLeft, pRight, pKey->pSeed, pAdrs, pTempKey, nLanes, &params);
+            IPP_BADARG_RET((ippStsNoErr != retCode), retCode)
+        }
+
+        // 3. verify with public key
+        for (Ipp32s k = 0; k < nLanes; k++) {
+            BNU_CHUNK_T is_equal = cpIsEquBlock_ct(pKey->pRoot, pTempKey[k], n);
+            pIsSignValid[sIdx[k]] = is_equal ? 1 : 0;
+        }
+    }
+    return retCode;
+}